@@ -32,6 +32,7 @@
 #include "Alignment_Rigid.h"
 #include "Alignment_Field.h"
 #include "Alignment_Demons.h"
+#include "Gaussian_Blur.h"
 
 #if __has_include(<sycl/sycl.hpp>)
     #include <sycl/sycl.hpp>
@@ -112,6 +113,16 @@ public:
         return deformation;
     }
 
+    // Replace the deformation field, e.g., with one upsampled from a coarser pyramid level, and re-warp the moving
+    // image accordingly.
+    void initialize_deformation(const demons_volume<double> &d){
+        if(d.data.size() != this->vector_volume_size){
+            throw std::invalid_argument("Initial deformation field does not match the registration geometry");
+        }
+        this->copy_host_vector_to_device(d, this->deformation_dev);
+        this->warp_moving();
+    }
+
 private:
     demons_volume<float> fixed;
     demons_volume<float> moving;
@@ -132,8 +143,8 @@ private:
     double *gradient_dev = nullptr;
     double *update_dev = nullptr;
     double *deformation_dev = nullptr;
-    double *mse_term_dev = nullptr;
-    int64_t *valid_dev = nullptr;
+    double *mse_sum_dev = nullptr;
+    int64_t *valid_count_dev = nullptr;
     std::exception_ptr async_exception = nullptr;
     std::mutex async_exception_mutex;
 
@@ -175,8 +186,8 @@ private:
         gradient_dev = dcma_sycl::malloc_shared<double>(this->vector_volume_size, q);
         update_dev = dcma_sycl::malloc_shared<double>(this->vector_volume_size, q);
         deformation_dev = dcma_sycl::malloc_shared<double>(this->vector_volume_size, q);
-        mse_term_dev = dcma_sycl::malloc_shared<double>(this->scalar_voxel_count, q);
-        valid_dev = dcma_sycl::malloc_shared<int64_t>(this->scalar_voxel_count, q);
+        mse_sum_dev = dcma_sycl::malloc_shared<double>(1, q);
+        valid_count_dev = dcma_sycl::malloc_shared<int64_t>(1, q);
 
         std::copy(fixed.data.begin(), fixed.data.end(), fixed_dev);
         std::copy(moving.data.begin(), moving.data.end(), moving_dev);
@@ -193,16 +204,16 @@ private:
         if(gradient_dev) dcma_sycl::free(gradient_dev, q);
         if(update_dev) dcma_sycl::free(update_dev, q);
         if(deformation_dev) dcma_sycl::free(deformation_dev, q);
-        if(mse_term_dev) dcma_sycl::free(mse_term_dev, q);
-        if(valid_dev) dcma_sycl::free(valid_dev, q);
+        if(mse_sum_dev) dcma_sycl::free(mse_sum_dev, q);
+        if(valid_count_dev) dcma_sycl::free(valid_count_dev, q);
         fixed_dev = nullptr;
         moving_dev = nullptr;
         warped_dev = nullptr;
         gradient_dev = nullptr;
         update_dev = nullptr;
         deformation_dev = nullptr;
-        mse_term_dev = nullptr;
-        valid_dev = nullptr;
+        mse_sum_dev = nullptr;
+        valid_count_dev = nullptr;
     }
 
     void compute_gradient(){
@@ -280,23 +291,25 @@ private:
         const double normalization = params.normalization_factor;
         const double max_update = params.max_update_magnitude;
 
+        // The squared differences and valid voxel counts are accumulated with reductions.
         q.parallel_for(dcma_sycl::range<3>(static_cast<size_t>(slices),
                                            static_cast<size_t>(rows),
                                            static_cast<size_t>(cols)),
-                       [=](dcma_sycl::id<3> id){
+                       dcma_sycl::reduction(mse_sum_dev, dcma_sycl::plus<double>(),
+                           dcma_sycl::property_list{dcma_sycl::property::reduction::initialize_to_identity{}}),
+                       dcma_sycl::reduction(valid_count_dev, dcma_sycl::plus<int64_t>(),
+                           dcma_sycl::property_list{dcma_sycl::property::reduction::initialize_to_identity{}}),
+                       [=](dcma_sycl::id<3> id, auto &mse_sum, auto &valid_count){
             const int64_t z = static_cast<int64_t>(id[0]);
             const int64_t y = static_cast<int64_t>(id[1]);
             const int64_t x = static_cast<int64_t>(id[2]);
 
-            const auto vox_idx = static_cast<size_t>((z * rows + y) * cols + x);
             const auto f_idx = static_cast<size_t>(((z * rows + y) * cols + x) * channels);
             const auto g_idx = static_cast<size_t>(((z * rows + y) * cols + x) * 3);
             const float fixed_val = fixed_dev[f_idx];
             const float moving_val = warped_dev[f_idx];
 
             if(!(dcma_sycl::isfinite(fixed_val) && dcma_sycl::isfinite(moving_val))){
-                mse_term_dev[vox_idx] = 0.0;
-                valid_dev[vox_idx] = 0;
                 update_dev[g_idx + 0] = 0.0;
                 update_dev[g_idx + 1] = 0.0;
                 update_dev[g_idx + 2] = 0.0;
@@ -304,8 +317,8 @@ private:
             }
 
             const double diff = static_cast<double>(fixed_val) - static_cast<double>(moving_val);
-            mse_term_dev[vox_idx] = diff * diff;
-            valid_dev[vox_idx] = 1;
+            mse_sum += diff * diff;
+            valid_count += 1;
 
             double ux = 0.0, uy = 0.0, uz = 0.0;
             const double gx = gradient_dev[g_idx + 0];
@@ -331,12 +344,8 @@ private:
         });
         this->wait_and_rethrow();
 
-        mse = 0.0;
-        n_voxels = 0;
-        for(size_t i = 0; i < this->scalar_voxel_count; ++i){
-            mse += mse_term_dev[i];
-            n_voxels += valid_dev[i];
-        }
+        mse = *mse_sum_dev;
+        n_voxels = *valid_count_dev;
         if(n_voxels > 0){
             mse /= static_cast<double>(n_voxels);
         }
@@ -559,7 +568,8 @@ private:
 
     // Smooth a vector field on device using separable 3D Gaussian filtering.
     // Allocates a temporary buffer, applies smoothing along each axis in sequence,
-    // and writes the result back to the input buffer.
+    // and writes the result back to the input buffer. Wide kernels are instead handled on the host using a
+    // recursive filter.
     void smooth_on_device(double *field_dev, double sigma_mm){
         if(sigma_mm <= 0.0){
             return;
@@ -570,34 +580,34 @@ private:
         const double pxl_dx = fixed.pxl_dx;
         const double pxl_dy = fixed.pxl_dy;
         const double pxl_dz = fixed.pxl_dz;
-        // Compute kernel radii based on 3-sigma rule.
-        const int64_t rad_x = std::max<int64_t>(1, static_cast<int64_t>(3.0 * sigma_mm / pxl_dx));
-        const int64_t rad_y = std::max<int64_t>(1, static_cast<int64_t>(3.0 * sigma_mm / pxl_dy));
-        const int64_t rad_z = std::max<int64_t>(1, static_cast<int64_t>(3.0 * sigma_mm / pxl_dz));
         // Sigma in pixel units for each axis.
         const double sigma_x = sigma_mm / pxl_dx;
         const double sigma_y = sigma_mm / pxl_dy;
         const double sigma_z = sigma_mm / pxl_dz;
+        // Wide kernels are applied on the host with a recursive filter, since its cost does not depend on sigma.
+        // The field is allocated in shared memory, so it is directly accessible from the host.
+        if( Gaussian_Blur_Prefers_Recursive(sigma_x)
+        ||  Gaussian_Blur_Prefers_Recursive(sigma_y)
+        ||  Gaussian_Blur_Prefers_Recursive(sigma_z) ){
+            this->wait_and_rethrow();
+            GaussianBlurParams blur_params;
+            blur_params.sigma = {{ sigma_z, sigma_y, sigma_x }};
+            blur_params.method = GaussianBlurMethod::Automatic;
+            Gaussian_Blur_Volume(field_dev, {{ slices, rows, cols }}, 3, blur_params);
+            return;
+        }
         // Allocate temporary buffer on device for intermediate results.
         double *temp_dev = dcma_sycl::malloc_shared<double>(this->vector_volume_size, q);
         if(temp_dev == nullptr){
             throw std::runtime_error("Failed to allocate temporary device buffer for smoothing");
         }
-        // Helper lambda to create 1D Gaussian weights (precomputed on host, copied to device).
-        auto make_kernel = [](int64_t radius, double sigma_pix) -> std::vector<double> {
-            std::vector<double> k(2 * radius + 1);
-            double sum = 0.0;
-            for(int64_t i = -radius; i <= radius; ++i){
-                double v = dcma_sycl::exp(-0.5 * (static_cast<double>(i * i)) / (sigma_pix * sigma_pix));
-                k[static_cast<size_t>(i + radius)] = v;
-                sum += v;
-            }
-            for(auto &v : k) v /= sum;
-            return k;
-        };
-        const auto kernel_x = make_kernel(rad_x, sigma_x);
-        const auto kernel_y = make_kernel(rad_y, sigma_y);
-        const auto kernel_z = make_kernel(rad_z, sigma_z);
+        // 1D Gaussian weights (precomputed on host, copied to device) extending 3 sigma.
+        const auto kernel_x = Gaussian_Kernel_Weights(sigma_x);
+        const auto kernel_y = Gaussian_Kernel_Weights(sigma_y);
+        const auto kernel_z = Gaussian_Kernel_Weights(sigma_z);
+        const int64_t rad_x = static_cast<int64_t>(kernel_x.size() / 2);
+        const int64_t rad_y = static_cast<int64_t>(kernel_y.size() / 2);
+        const int64_t rad_z = static_cast<int64_t>(kernel_z.size() / 2);
         // Copy kernels to device (using shared memory for simplicity).
         double *kx_dev = dcma_sycl::malloc_shared<double>(kernel_x.size(), q);
         double *ky_dev = dcma_sycl::malloc_shared<double>(kernel_y.size(), q);
@@ -892,6 +902,120 @@ AlignViaDemonsHelpers::histogram_match(
 
 
 
+// Helper function to build the next (coarser) pyramid level.
+demons_volume<float>
+AlignViaDemonsHelpers::downsample_volume(const demons_volume<float> &vol, int64_t min_extent){
+    const auto halve = [&](int64_t n) -> bool {
+        return (2 <= n) && (min_extent <= n);
+    };
+    const bool halve_z = halve(vol.slices);
+    const bool halve_y = halve(vol.rows);
+    const bool halve_x = halve(vol.cols);
+
+    // Anti-alias along the subsampled axes. A one-voxel sigma approximately band-limits the fine volume to the
+    // coarse Nyquist frequency.
+    auto smoothed = vol;
+    GaussianBlurParams blur_params;
+    blur_params.sigma = {{ halve_z ? 1.0 : 0.0,
+                           halve_y ? 1.0 : 0.0,
+                           halve_x ? 1.0 : 0.0 }};
+    Gaussian_Blur_Volume(smoothed.data.data(), {{ vol.slices, vol.rows, vol.cols }}, vol.channels, blur_params);
+
+    demons_volume<float> out;
+    out.slices = halve_z ? (vol.slices + 1) / 2 : vol.slices;
+    out.rows = halve_y ? (vol.rows + 1) / 2 : vol.rows;
+    out.cols = halve_x ? (vol.cols + 1) / 2 : vol.cols;
+    out.channels = vol.channels;
+    out.pxl_dx = halve_x ? vol.pxl_dx * 2.0 : vol.pxl_dx;
+    out.pxl_dy = halve_y ? vol.pxl_dy * 2.0 : vol.pxl_dy;
+    out.pxl_dz = halve_z ? vol.pxl_dz * 2.0 : vol.pxl_dz;
+    out.data.resize(static_cast<size_t>(out.slices * out.rows * out.cols * out.channels));
+
+    for(int64_t z = 0; z < out.slices; ++z){
+        const int64_t fz = halve_z ? z * 2 : z;
+        for(int64_t y = 0; y < out.rows; ++y){
+            const int64_t fy = halve_y ? y * 2 : y;
+            for(int64_t x = 0; x < out.cols; ++x){
+                const int64_t fx = halve_x ? x * 2 : x;
+                for(int64_t c = 0; c < out.channels; ++c){
+                    // Blurring fills non-finite voxels, but they are out-of-bounds in the moving image and need to
+                    // remain so.
+                    const auto orig = vol.data[vol_idx(vol, fz, fy, fx, c)];
+                    out.data[vol_idx(out, z, y, x, c)] = std::isfinite(orig) ? smoothed.data[vol_idx(smoothed, fz, fy, fx, c)]
+                                                                             : orig;
+                }
+            }
+        }
+    }
+    return out;
+}
+
+
+// Helper function to transfer a deformation field from a coarse pyramid level to a finer level.
+demons_volume<double>
+AlignViaDemonsHelpers::upsample_deformation(const demons_volume<double> &coarse, const demons_volume<float> &fine_geometry){
+    if(coarse.channels != 3){
+        throw std::invalid_argument("Deformation field must have three channels");
+    }
+
+    demons_volume<double> out;
+    out.slices = fine_geometry.slices;
+    out.rows = fine_geometry.rows;
+    out.cols = fine_geometry.cols;
+    out.channels = 3;
+    out.pxl_dx = fine_geometry.pxl_dx;
+    out.pxl_dy = fine_geometry.pxl_dy;
+    out.pxl_dz = fine_geometry.pxl_dz;
+    out.data.assign(static_cast<size_t>(out.slices * out.rows * out.cols * 3), 0.0);
+
+    // Map a fine voxel index to a (clamped) coarse voxel coordinate, returning the bracketing indices and weight.
+    const auto map_axis = [](int64_t i, double fine_pxl, double coarse_pxl, int64_t N_coarse,
+                             int64_t &i0, int64_t &i1, double &t){
+        const double s = std::clamp(static_cast<double>(i) * fine_pxl / coarse_pxl,
+                                    0.0, static_cast<double>(N_coarse - 1));
+        i0 = static_cast<int64_t>(std::floor(s));
+        i1 = std::min<int64_t>(i0 + 1, N_coarse - 1);
+        t = s - static_cast<double>(i0);
+    };
+
+    for(int64_t z = 0; z < out.slices; ++z){
+        int64_t z0 = 0, z1 = 0;
+        double tz = 0.0;
+        map_axis(z, out.pxl_dz, coarse.pxl_dz, coarse.slices, z0, z1, tz);
+        for(int64_t y = 0; y < out.rows; ++y){
+            int64_t y0 = 0, y1 = 0;
+            double ty = 0.0;
+            map_axis(y, out.pxl_dy, coarse.pxl_dy, coarse.rows, y0, y1, ty);
+            for(int64_t x = 0; x < out.cols; ++x){
+                int64_t x0 = 0, x1 = 0;
+                double tx = 0.0;
+                map_axis(x, out.pxl_dx, coarse.pxl_dx, coarse.cols, x0, x1, tx);
+
+                // Displacements are in physical units, so they carry over between levels without scaling.
+                for(int64_t c = 0; c < 3; ++c){
+                    double sum = 0.0;
+                    double wsum = 0.0;
+                    for(const auto &[zz, wz] : { std::make_pair(z0, 1.0 - tz), std::make_pair(z1, tz) }){
+                        for(const auto &[yy, wy] : { std::make_pair(y0, 1.0 - ty), std::make_pair(y1, ty) }){
+                            for(const auto &[xx, wx] : { std::make_pair(x0, 1.0 - tx), std::make_pair(x1, tx) }){
+                                const double v = coarse.data[vol_idx(coarse, zz, yy, xx, c)];
+                                const double w = wz * wy * wx;
+                                if(std::isfinite(v) && (0.0 < w)){
+                                    sum += w * v;
+                                    wsum += w;
+                                }
+                            }
+                        }
+                    }
+                    out.data[vol_idx(out, z, y, x, c)] = (0.0 < wsum) ? (sum / wsum) : 0.0;
+                }
+            }
+        }
+    }
+    return out;
+}
+
+
 // Helper function to warp an image using a deformation field.
 planar_image_collection<float, double>
 AlignViaDemonsHelpers::warp_image_with_field(
@@ -971,31 +1095,67 @@ AlignViaDemons(AlignViaDemonsParams & params,
             moving = histogram_match(moving, stationary, params.histogram_bins, params.histogram_outlier_fraction);
         }
 
-        // Step 3: Initialize demons algorithm
-        const auto fixed_vol = marshal_collection_to_volume(stationary);
-        const auto moving_vol = marshal_collection_to_volume(moving);
-        sycl_demons_engine engine(fixed_vol, moving_vol, params);
+        // Step 3: Build the pyramid, from the full-resolution volumes (level zero) to the coarsest level.
+        std::vector<demons_volume<float>> fixed_pyramid;
+        std::vector<demons_volume<float>> moving_pyramid;
+        fixed_pyramid.emplace_back( marshal_collection_to_volume(stationary) );
+        moving_pyramid.emplace_back( marshal_collection_to_volume(moving) );
+        for(int64_t l = 1; l < params.pyramid_levels; ++l){
+            auto fixed_l = downsample_volume(fixed_pyramid.back(), params.pyramid_min_extent);
+            if(fixed_l.data.size() == fixed_pyramid.back().data.size()){
+                break; // No axis can be subsampled further.
+            }
+            moving_pyramid.emplace_back( downsample_volume(moving_pyramid.back(), params.pyramid_min_extent) );
+            fixed_pyramid.emplace_back( std::move(fixed_l) );
+        }
+        const auto N_levels = static_cast<int64_t>(fixed_pyramid.size());
+        if(N_levels < params.pyramid_levels){
+            YLOGWARN("Volume is too small for " << params.pyramid_levels << " pyramid levels, using " << N_levels);
+        }
 
-        // Step 4: Iterative demons algorithm
-        double prev_mse = std::numeric_limits<double>::infinity();
-        for(int64_t iter = 0; iter < params.max_iterations; ++iter){
-            const double mse = engine.compute_single_iteration();
-            if(params.verbosity >= 1){
-                YLOGINFO("Iteration " << iter << ": MSE = " << mse);
+        // Step 4: Iterative demons algorithm, coarse-to-fine.
+        std::optional<demons_volume<double>> deformation_vol;
+        for(int64_t l = N_levels - 1; 0 <= l; --l){
+            // Schedules are ordered from the coarsest requested level, which might have been omitted.
+            const auto sched = static_cast<size_t>(params.pyramid_levels - 1 - l);
+            AlignViaDemonsParams level_params = params;
+            if(sched < params.pyramid_iterations.size()){
+                level_params.max_iterations = params.pyramid_iterations[sched];
+            }
+            if(sched < params.pyramid_smoothing_sigmas.size()){
+                level_params.deformation_field_smoothing_sigma = params.pyramid_smoothing_sigmas[sched];
+            }
+
+            const auto &fixed_vol = fixed_pyramid.at(l);
+            if((params.verbosity >= 1) && (1 < N_levels)){
+                YLOGINFO("Registering pyramid level " << l << " with dimensions "
+                         << fixed_vol.cols << "x" << fixed_vol.rows << "x" << fixed_vol.slices);
+            }
+            sycl_demons_engine engine(fixed_vol, moving_pyramid.at(l), level_params);
+            if(deformation_vol){
+                engine.initialize_deformation( upsample_deformation(deformation_vol.value(), fixed_vol) );
             }
 
-            const double mse_change = std::abs(prev_mse - mse);
-            if(mse_change < params.convergence_threshold && iter > 0){
+            double prev_mse = std::numeric_limits<double>::infinity();
+            for(int64_t iter = 0; iter < level_params.max_iterations; ++iter){
+                const double mse = engine.compute_single_iteration();
                 if(params.verbosity >= 1){
-                    YLOGINFO("Converged after " << iter << " iterations");
+                    YLOGINFO("Iteration " << iter << ": MSE = " << mse);
                 }
-                break;
+
+                const double mse_change = std::abs(prev_mse - mse);
+                if(mse_change < params.convergence_threshold && iter > 0){
+                    if(params.verbosity >= 1){
+                        YLOGINFO("Converged after " << iter << " iterations");
+                    }
+                    break;
+                }
+                prev_mse = mse;
             }
-            prev_mse = mse;
+            deformation_vol = engine.export_deformation_volume();
         }
 
-        auto deformation_vol = engine.export_deformation_volume();
-        auto def_coll = marshal_volume_to_collection(deformation_vol, stationary);
+        auto def_coll = marshal_volume_to_collection(deformation_vol.value(), stationary);
         return deformation_field(std::move(def_coll));
 
     }catch(const std::exception &e){
@@ -7,6 +7,7 @@
 #include <functional>
 #include <iosfwd>
 #include <cstdint>
+#include <vector>
 
 #include "YgorMisc.h"         //Needed for FUNCINFO, FUNCWARN, FUNCERR macros.
 #include "YgorLog.h"
@@ -56,6 +57,23 @@ struct AlignViaDemonsParams {
     // This prevents large, unstable updates.
     double max_update_magnitude = 2.0;
     
+    // The number of levels in the coarse-to-fine Gaussian pyramid. A single level registers at full resolution
+    // only. Each additional level is smoothed and then subsampled by a factor of two along every axis that spans at
+    // least 'pyramid_min_extent' voxels. Registration begins at the coarsest level, and the deformation field is
+    // upsampled to seed each finer level. Fewer levels are used when the volume becomes too small to subsample.
+    int64_t pyramid_levels = 1;
+
+    // Axes with fewer voxels than this are not subsampled when building the pyramid.
+    int64_t pyramid_min_extent = 8;
+
+    // The maximum number of iterations to perform at each pyramid level, ordered from the coarsest to the finest
+    // level. Levels without an entry use 'max_iterations'.
+    std::vector<int64_t> pyramid_iterations;
+
+    // The deformation field smoothing sigma (in DICOM units, mm) to use at each pyramid level, ordered from the
+    // coarsest to the finest level. Levels without an entry use 'deformation_field_smoothing_sigma'.
+    std::vector<double> pyramid_smoothing_sigmas;
+    
     // Verbosity level for logging intermediate results.
     int64_t verbosity = 1;
 };
@@ -135,6 +153,19 @@ warp_image_with_field(
     const deformation_field & def_field );
 
 
+// Helper function to build the next (coarser) pyramid level.
+// Each axis spanning at least 'min_extent' voxels is smoothed to suppress aliasing and then subsampled by a factor of
+// two, so coarse voxel i coincides with fine voxel 2i. Non-finite voxels remain non-finite.
+demons_volume<float>
+downsample_volume(const demons_volume<float> &vol, int64_t min_extent);
+
+
+// Helper function to transfer a deformation field (in DICOM units, mm) from a coarse pyramid level to a finer level.
+// The volumes are assumed to share the position of the first voxel, as produced by downsample_volume().
+demons_volume<double>
+upsample_deformation(const demons_volume<double> &coarse, const demons_volume<float> &fine_geometry);
+
+
 // Helper functions to marshal back-and-forth planar_image_collection (for Drover) <--> demons_volume (for SYCL).
 template <class T>
 demons_volume<T>
@@ -227,6 +258,9 @@ marshal_volume_to_collection(const demons_volume<T> &vol,
 // The diffeomorphic variant uses an exponential update scheme to ensure the transformation
 // is invertible (diffeomorphic).
 //
+// Optionally, the algorithm is applied coarse-to-fine over a Gaussian pyramid. Coarse levels capture large
+// deformations cheaply, and finer levels only need to refine the upsampled field.
+//
 // Note: This routine handles images that are not aligned or have different orientations
 // by first resampling the moving image onto the fixed image's grid.
 //
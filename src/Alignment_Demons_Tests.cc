@@ -654,3 +654,118 @@ TEST_CASE( "AlignViaDemons convergence threshold stops iteration" ){
     // Should have converged, with MSE substantially reduced.
     CHECK(mse_after < mse_before * 0.5);
 }
+
+
+TEST_CASE( "downsample_volume and upsample_deformation" ){
+    demons_volume<float> vol;
+    vol.slices = 1;
+    vol.rows = 20;
+    vol.cols = 20;
+    vol.channels = 1;
+    vol.pxl_dx = 1.0;
+    vol.pxl_dy = 2.0;
+    vol.pxl_dz = 3.0;
+    vol.data.assign(static_cast<size_t>(vol.rows * vol.cols), 5.0f);
+    vol.data[0] = std::numeric_limits<float>::quiet_NaN();
+
+    SUBCASE("large axes are halved and non-finite voxels are preserved"){
+        const auto coarse = downsample_volume(vol, 8);
+        REQUIRE(coarse.slices == 1);
+        REQUIRE(coarse.rows == 10);
+        REQUIRE(coarse.cols == 10);
+        CHECK(coarse.pxl_dx == doctest::Approx(2.0));
+        CHECK(coarse.pxl_dy == doctest::Approx(4.0));
+        CHECK(coarse.pxl_dz == doctest::Approx(3.0));
+        CHECK(std::isnan(coarse.data[vol_idx(coarse, 0, 0, 0, 0)]));
+        CHECK(coarse.data[vol_idx(coarse, 0, 5, 5, 0)] == doctest::Approx(5.0));
+
+        // Small axes are left intact.
+        const auto coarser = downsample_volume(downsample_volume(coarse, 8), 8);
+        CHECK(coarser.rows == 5);
+        CHECK(coarser.cols == 5);
+    }
+
+    SUBCASE("upsampled linear displacements are reproduced"){
+        const auto coarse = downsample_volume(vol, 8);
+        demons_volume<double> def;
+        def.slices = coarse.slices;
+        def.rows = coarse.rows;
+        def.cols = coarse.cols;
+        def.channels = 3;
+        def.pxl_dx = coarse.pxl_dx;
+        def.pxl_dy = coarse.pxl_dy;
+        def.pxl_dz = coarse.pxl_dz;
+        def.data.assign(static_cast<size_t>(def.rows * def.cols * 3), 0.0);
+        for(int64_t y = 0; y < def.rows; ++y){
+            for(int64_t x = 0; x < def.cols; ++x){
+                def.data[vol_idx(def, 0, y, x, 0)] = 0.1 * static_cast<double>(x) * def.pxl_dx;
+                def.data[vol_idx(def, 0, y, x, 1)] = 1.5;
+            }
+        }
+
+        const auto fine = upsample_deformation(def, vol);
+        REQUIRE(fine.rows == vol.rows);
+        REQUIRE(fine.cols == vol.cols);
+        for(int64_t x = 0; x < vol.cols - 1; ++x){
+            CHECK(fine.data[vol_idx(fine, 0, 7, x, 0)] == doctest::Approx(0.1 * static_cast<double>(x)));
+            CHECK(fine.data[vol_idx(fine, 0, 7, x, 1)] == doctest::Approx(1.5));
+            CHECK(fine.data[vol_idx(fine, 0, 7, x, 2)] == doctest::Approx(0.0));
+        }
+    }
+}
+
+
+TEST_CASE( "AlignViaDemons pyramid recovers a large shift" ){
+    // A shift several times larger than the maximum update magnitude is difficult at full resolution, but is only a
+    // fraction of a voxel at the coarsest level.
+    const int64_t N = 48;
+
+    auto stationary = make_test_image_collection(1, N, N,
+        [](int64_t, int64_t row, int64_t col){
+            const double dr = row - 24.0;
+            const double dc = col - 24.0;
+            return static_cast<float>(100.0 * std::exp(-(dr * dr + dc * dc) / 50.0));
+        });
+
+    auto moving = make_test_image_collection(1, N, N,
+        [](int64_t, int64_t row, int64_t col){
+            const double dr = row - 24.0;
+            const double dc = col - 24.0 - 6.0;
+            return static_cast<float>(100.0 * std::exp(-(dr * dr + dc * dc) / 50.0));
+        });
+
+    const auto [mse_before, count_before] = compute_mse_and_count(stationary, moving);
+
+    AlignViaDemonsParams params;
+    params.max_iterations = 50;
+    params.convergence_threshold = 0.0;
+    params.deformation_field_smoothing_sigma = 1.0;
+    params.update_field_smoothing_sigma = 0.0;
+    params.use_diffeomorphic = false;
+    params.max_update_magnitude = 1.0;
+    params.verbosity = 0;
+    params.pyramid_levels = 3;
+    params.pyramid_iterations = { 100, 50 };
+    params.pyramid_smoothing_sigmas = { 4.0, 2.0 };
+
+    auto result = AlignViaDemons(params, moving, stationary);
+    REQUIRE(result.has_value());
+
+    // The field is defined on the full-resolution grid.
+    const auto &def_imgs = result->get_imagecoll_crefw().get().images;
+    REQUIRE(def_imgs.size() == 1);
+    REQUIRE(def_imgs.front().rows == N);
+    REQUIRE(def_imgs.front().columns == N);
+
+    auto warped = warp_image_with_field(moving, *result);
+    const auto [mse_after, count_after] = compute_mse_and_count(stationary, warped);
+    CHECK(mse_after < mse_before * 0.1);
+    CHECK(count_after >= count_before - 8 * N);
+
+    // Requesting more levels than the volume supports falls back to fewer levels.
+    params.pyramid_levels = 10;
+    params.pyramid_iterations.clear();
+    params.pyramid_smoothing_sigmas.clear();
+    params.max_iterations = 20;
+    CHECK(AlignViaDemons(params, moving, stationary).has_value());
+}
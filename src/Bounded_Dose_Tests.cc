@@ -0,0 +1,77 @@
+//Bounded_Dose_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the Drover::Bounded_Dose_*() routines defined in Structs.cc.
+// Tests are separated into their own file because Structs_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <cstdint>
+#include <list>
+#include <memory>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "Structs.h"
+
+
+static
+std::shared_ptr<Image_Array>
+make_test_dose_array(float dose){
+    auto ia = std::make_shared<Image_Array>();
+    ia->imagecoll.images.emplace_back();
+    auto &img = ia->imagecoll.images.back();
+    img.init_buffer(10, 10, 1);
+    img.init_spatial(1.0, 1.0, 1.0, vec3<double>(0.0, 0.0, 0.0), vec3<double>(0.0, 0.0, 0.0));
+    img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+    img.fill_pixels(dose);
+    img.metadata["Modality"] = "RTDOSE";
+    return ia;
+}
+
+// A square that bounds a 3x3 block of voxel centres.
+static
+contour_of_points<double>
+make_test_square(){
+    contour_of_points<double> c;
+    c.closed = true;
+    c.points.emplace_back( vec3<double>(1.5, 1.5, 0.0) );
+    c.points.emplace_back( vec3<double>(4.5, 1.5, 0.0) );
+    c.points.emplace_back( vec3<double>(4.5, 4.5, 0.0) );
+    c.points.emplace_back( vec3<double>(1.5, 4.5, 0.0) );
+    return c;
+}
+
+static
+Drover
+make_test_drover(int64_t N_contours){
+    Drover d;
+    d.image_data.emplace_back( make_test_dose_array(2.0f) );
+    d.contour_data = std::make_shared<Contour_Data>();
+    d.contour_data->ccs.emplace_back();
+    for(int64_t i = 0; i < N_contours; ++i){
+        d.contour_data->ccs.back().contours.emplace_back( make_test_square() );
+    }
+    return d;
+}
+
+
+TEST_CASE("Bounded_Dose_Bulk_Values counts voxels once per bounding contour"){
+    const auto single = make_test_drover(1).Bounded_Dose_Bulk_Values();
+    REQUIRE(single.size() == 9);
+    for(const auto &v : single) REQUIRE(v == doctest::Approx(2.0));
+
+    // Overlapping contours within the same ROI are not merged, so shared voxels are counted for each contour.
+    const auto doubled = make_test_drover(2).Bounded_Dose_Bulk_Values();
+    REQUIRE(doubled.size() == 2 * single.size());
+    for(const auto &v : doubled) REQUIRE(v == doctest::Approx(2.0));
+}
+
+TEST_CASE("Bounded_Dose_Bulk_Values ignores degenerate contours"){
+    auto d = make_test_drover(1);
+    d.contour_data->ccs.back().contours.emplace_back();
+    d.contour_data->ccs.back().contours.back().points.emplace_back( vec3<double>(2.0, 2.0, 0.0) );
+    d.contour_data->ccs.back().contours.back().points.emplace_back( vec3<double>(3.0, 3.0, 0.0) );
+    REQUIRE(d.Bounded_Dose_Bulk_Values().size() == 9);
+}
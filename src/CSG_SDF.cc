@@ -14,6 +14,9 @@
 #include <random>
 #include <chrono>
 #include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 
 #include "YgorString.h"
 #include "YgorMath.h"
@@ -42,6 +45,50 @@ void aa_bbox::digest(const vec3<double>& r){
     this->max.z = std::max<double>( this->max.z, r.z );
 }
 
+static
+tape::instruction
+make_instruction(tape::opcode op, int64_t a, int64_t b = -1){
+    tape::instruction i;
+    i.op = op;
+    i.a = a;
+    i.b = b;
+    return i;
+}
+
+// Compile all children and emit an n-ary combination of their values.
+static
+int64_t
+compile_nary(tape &t, int64_t coord_slot, const std::vector<std::shared_ptr<node>>& nodes, tape::opcode op, double p0){
+    std::vector<int64_t> slots;
+    slots.reserve(nodes.size());
+    for(const auto& c_it : nodes){
+        slots.emplace_back( c_it->compile(t, coord_slot) );
+    }
+    auto i = make_instruction(op, -1);
+    i.first = t.add_operands(slots);
+    i.count = static_cast<int64_t>(slots.size());
+    i.p[0] = p0;
+    return t.emit(i);
+}
+
+// Express an affine map (given as a functor) as an instruction by sampling it at the origin and along each axis.
+template <class F>
+static
+tape::instruction
+make_affine_instruction(int64_t coord_slot, F f){
+    const vec3<double> zero3(0.0, 0.0, 0.0);
+    const auto t = f(zero3);
+    const auto cx = f(vec3<double>(1.0, 0.0, 0.0)) - t;
+    const auto cy = f(vec3<double>(0.0, 1.0, 0.0)) - t;
+    const auto cz = f(vec3<double>(0.0, 0.0, 1.0)) - t;
+    auto i = make_instruction(tape::opcode::affine, coord_slot);
+    i.p = {{ cx.x, cy.x, cz.x,
+             cx.y, cy.y, cz.y,
+             cx.z, cy.z, cz.z,
+             t.x,  t.y,  t.z }};
+    return i;
+}
+
 
 // -------------------------------- 3D Shapes -------------------------------------
 namespace shape {
@@ -137,6 +184,56 @@ aa_bbox poly_chain::evaluate_aa_bbox() const {
     return bb;
 }
 
+// Compilation.
+int64_t sphere::compile(tape &t, int64_t coord_slot) const {
+    auto i = make_instruction(tape::opcode::sphere, coord_slot);
+    i.p[0] = this->radius;
+    return t.emit(i);
+}
+
+int64_t aa_box::compile(tape &t, int64_t coord_slot) const {
+    auto i = make_instruction(tape::opcode::aa_box, coord_slot);
+    i.p[0] = std::abs(this->radii.x);
+    i.p[1] = std::abs(this->radii.y);
+    i.p[2] = std::abs(this->radii.z);
+    return t.emit(i);
+}
+
+int64_t plane::compile(tape &t, int64_t coord_slot) const {
+    auto i = make_instruction(tape::opcode::plane, coord_slot);
+    i.p[0] = this->point.x;
+    i.p[1] = this->point.y;
+    i.p[2] = this->point.z;
+    i.p[3] = this->normal.x;
+    i.p[4] = this->normal.y;
+    i.p[5] = this->normal.z;
+    return t.emit(i);
+}
+
+int64_t poly_chain::compile(tape &t, int64_t coord_slot) const {
+    if(this->vertices.size() < 2UL){
+        throw std::runtime_error("poly_chain: this operation requires at least two vertices");
+    }
+
+    // Note: degenerate (zero-length) segments are ignored, as in evaluate_sdf().
+    auto i = make_instruction(tape::opcode::poly_chain, coord_slot);
+    i.first = -1;
+    const auto end = std::cend(this->vertices);
+    auto A_it = std::cbegin(this->vertices);
+    auto B_it = std::next(A_it);
+    for( ; B_it != end; ++A_it, ++B_it){
+        const auto seg = t.add_segment(*A_it, *B_it);
+        if(seg < 0) continue;
+        if(i.first < 0) i.first = seg;
+        ++(i.count);
+    }
+    if(i.count == 0){
+        throw std::runtime_error("poly_chain: computed non-finite SDF");
+    }
+    i.p[0] = this->radius;
+    return t.emit(i);
+}
+
 } // namespace shape
 
 // -------------------------------- Operations ------------------------------------
@@ -517,8 +614,498 @@ aa_bbox extrude::evaluate_aa_bbox() const {
 }
 
 
+// Compilation.
+int64_t translate::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 1UL){
+        throw std::runtime_error("translate: this operation requires a single child node");
+    }
+    auto i = make_instruction(tape::opcode::translate, coord_slot);
+    i.p[0] = this->dR.x;
+    i.p[1] = this->dR.y;
+    i.p[2] = this->dR.z;
+    return this->children[0]->compile(t, t.emit(i));
+}
+
+int64_t rotate::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 1UL){
+        throw std::runtime_error("rotate: this operation requires a single child node");
+    }
+    const auto i = make_affine_instruction(coord_slot, [&](vec3<double> r){
+        this->rot.apply_to(r);
+        return r;
+    });
+    return this->children[0]->compile(t, t.emit(i));
+}
+
+int64_t join::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.empty()){
+        throw std::runtime_error("join: no children present");
+    }
+    return compile_nary(t, coord_slot, this->children, tape::opcode::min, 0.0);
+}
+
+int64_t subtract::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 2UL){
+        throw std::runtime_error("subtract: incorrect number of children present, subtraction requires exactly two");
+    }
+    const auto cA = this->children[0]->compile(t, coord_slot);
+    const auto cB = this->children[1]->compile(t, coord_slot);
+    return t.emit( make_instruction(tape::opcode::subtract, cA, cB) );
+}
+
+int64_t intersect::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() < 2UL){
+        throw std::runtime_error("intersect: insufficient children present, cannot compute intersect");
+    }
+    return compile_nary(t, coord_slot, this->children, tape::opcode::max, 0.0);
+}
+
+int64_t chamfer_join::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.empty()){
+        throw std::runtime_error("chamfer_join: no children present, cannot compute chamfer_join");
+    }
+    return compile_nary(t, coord_slot, this->children, tape::opcode::chamfer_min, this->thickness);
+}
+
+int64_t chamfer_subtract::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 2UL){
+        throw std::runtime_error("chamfer_subtract: incorrect number of children present, chamfer_subtraction requires exactly two");
+    }
+    const auto cA = this->children[0]->compile(t, coord_slot);
+    const auto cB = this->children[1]->compile(t, coord_slot);
+    auto i = make_instruction(tape::opcode::chamfer_subtract, cA, cB);
+    i.p[0] = this->thickness;
+    return t.emit(i);
+}
+
+int64_t chamfer_intersect::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.empty()){
+        throw std::runtime_error("chamfer_intersect: no children present, cannot compute chamfer_intersect");
+    }
+    return compile_nary(t, coord_slot, this->children, tape::opcode::chamfer_max, this->thickness);
+}
+
+int64_t dilate::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 1UL){
+        throw std::runtime_error("dilate: this operation requires a single child node");
+    }
+    auto i = make_instruction(tape::opcode::offset, this->children[0]->compile(t, coord_slot));
+    i.p[0] = -this->offset;
+    return t.emit(i);
+}
+
+int64_t erode::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 1UL){
+        throw std::runtime_error("erode: this operation requires a single child node");
+    }
+    auto i = make_instruction(tape::opcode::offset, this->children[0]->compile(t, coord_slot));
+    i.p[0] = this->offset;
+    return t.emit(i);
+}
+
+int64_t extrude::compile(tape &t, int64_t coord_slot) const {
+    if(this->children.size() != 1UL){
+        throw std::runtime_error("extrude: this operation requires a single child node");
+    }
+
+    // The child is evaluated on the projection of the positions onto the cut plane.
+    const auto proj = make_affine_instruction(coord_slot, [&](const vec3<double> &r){
+        return this->cut_plane.Project_Onto_Plane_Orthogonally(r);
+    });
+    const auto c = this->children[0]->compile(t, t.emit(proj));
+
+    // The signed distance to the cut plane is an affine function of the position.
+    const vec3<double> zero3(0.0, 0.0, 0.0);
+    const auto h = this->cut_plane.Get_Signed_Distance_To_Point(zero3);
+    auto i = make_instruction(tape::opcode::extrude, c, coord_slot);
+    i.p[0] = this->cut_plane.Get_Signed_Distance_To_Point(vec3<double>(1.0, 0.0, 0.0)) - h;
+    i.p[1] = this->cut_plane.Get_Signed_Distance_To_Point(vec3<double>(0.0, 1.0, 0.0)) - h;
+    i.p[2] = this->cut_plane.Get_Signed_Distance_To_Point(vec3<double>(0.0, 0.0, 1.0)) - h;
+    i.p[3] = h;
+    i.p[4] = this->distance;
+    return t.emit(i);
+}
+
 } // namespace op
 
+// ---------------------------------- Tapes ---------------------------------------
+
+// Scalar forms of the combinations, shared by the batch and interval evaluators.
+//
+// Note: each of these is non-decreasing in every operand, except subtraction which is non-increasing in the second.
+static inline double chamfer_min_impl(double m1, double m2, double thickness){
+    // m1 and m2 are the smallest and second-smallest operands. The minimum over all pairs reduces to this pair.
+    return std::min<double>( m1, (m1 + m2 - thickness) * std::sqrt(0.5) );
+}
+static inline double chamfer_max_impl(double m1, double m2, double thickness){
+    // m1 and m2 are the largest and second-largest operands.
+    return std::max<double>( m1, (m1 + m2 + thickness) * std::sqrt(0.5) );
+}
+static inline double chamfer_subtract_impl(double a, double b, double thickness){
+    return std::max<double>( std::max<double>(a, -b), (a - b + thickness) * std::sqrt(0.5) );
+}
+static inline double extrude_impl(double dz, double c){
+    const auto pdz = std::max<double>(0.0, dz);
+    const auto pc = std::max<double>(0.0, c);
+    return std::min<double>(0.0, std::max<double>(dz, c)) + std::sqrt(pdz * pdz + pc * pc);
+}
+
+tape::tape(const std::shared_ptr<node> &n){
+    if(!n){
+        throw std::invalid_argument("Cannot compile an empty SDF");
+    }
+    this->root = n->compile(*this, 0);
+}
+
+tape::tape(const node &n){
+    this->root = n.compile(*this, 0);
+}
+
+int64_t tape::emit(instruction i){
+    const bool writes_coords = (i.op == opcode::translate) || (i.op == opcode::affine);
+    i.out = writes_coords ? (this->N_coord_slots++) : (this->N_value_slots++);
+    this->instructions.emplace_back(i);
+    return i.out;
+}
+
+int64_t tape::add_operands(const std::vector<int64_t> &slots){
+    const auto first = static_cast<int64_t>(this->operands.size());
+    this->operands.insert( std::end(this->operands), std::begin(slots), std::end(slots) );
+    return first;
+}
+
+int64_t tape::add_segment(const vec3<double> &A, const vec3<double> &B){
+    const auto dBA = B - A;
+    const auto inv_sq_len = 1.0 / dBA.Dot(dBA);
+    if(!std::isfinite(inv_sq_len)){
+        return -1;
+    }
+    const auto seg = static_cast<int64_t>(this->segments.size() / 7UL);
+    this->segments.insert( std::end(this->segments), { A.x, A.y, A.z, dBA.x, dBA.y, dBA.z, inv_sq_len } );
+    return seg;
+}
+
+int64_t tape::size() const {
+    return static_cast<int64_t>(this->instructions.size());
+}
+
+void tape::execute(workspace &w, int64_t N) const {
+    constexpr auto B = batch_size;
+    const auto inf = std::numeric_limits<double>::infinity();
+    const auto coord = [&](int64_t slot, int64_t axis) -> double* {
+        return w.coords.data() + (slot * 3 + axis) * B;
+    };
+    const auto value = [&](int64_t slot) -> double* {
+        return w.values.data() + slot * B;
+    };
+
+    for(const auto &i : this->instructions){
+        const auto &p = i.p;
+        switch(i.op){
+            case opcode::translate:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *ox = coord(i.out, 0), *oy = coord(i.out, 1), *oz = coord(i.out, 2);
+                for(int64_t n = 0; n < N; ++n){
+                    ox[n] = ix[n] - p[0];
+                    oy[n] = iy[n] - p[1];
+                    oz[n] = iz[n] - p[2];
+                }
+                break;
+            }
+            case opcode::affine:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *ox = coord(i.out, 0), *oy = coord(i.out, 1), *oz = coord(i.out, 2);
+                for(int64_t n = 0; n < N; ++n){
+                    const auto x = ix[n], y = iy[n], z = iz[n];
+                    ox[n] = p[0] * x + p[1] * y + p[2] * z + p[9];
+                    oy[n] = p[3] * x + p[4] * y + p[5] * z + p[10];
+                    oz[n] = p[6] * x + p[7] * y + p[8] * z + p[11];
+                }
+                break;
+            }
+
+            case opcode::sphere:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n){
+                    o[n] = std::sqrt(ix[n] * ix[n] + iy[n] * iy[n] + iz[n] * iz[n]) - p[0];
+                }
+                break;
+            }
+            case opcode::aa_box:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n){
+                    const auto dx = std::abs(ix[n]) - p[0];
+                    const auto dy = std::abs(iy[n]) - p[1];
+                    const auto dz = std::abs(iz[n]) - p[2];
+                    const auto px = std::max<double>(dx, 0.0);
+                    const auto py = std::max<double>(dy, 0.0);
+                    const auto pz = std::max<double>(dz, 0.0);
+                    o[n] = std::sqrt(px * px + py * py + pz * pz)
+                         + std::min<double>( std::max<double>(dx, std::max<double>(dy, dz)), 0.0 );
+                }
+                break;
+            }
+            case opcode::plane:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n){
+                    o[n] = (ix[n] - p[0]) * p[3] + (iy[n] - p[1]) * p[4] + (iz[n] - p[2]) * p[5];
+                }
+                break;
+            }
+            case opcode::poly_chain:
+            {
+                const double *ix = coord(i.a, 0), *iy = coord(i.a, 1), *iz = coord(i.a, 2);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n) o[n] = inf;
+                for(int64_t k = i.first; k < (i.first + i.count); ++k){
+                    const double *s = this->segments.data() + k * 7;
+                    for(int64_t n = 0; n < N; ++n){
+                        const auto dx = ix[n] - s[0];
+                        const auto dy = iy[n] - s[1];
+                        const auto dz = iz[n] - s[2];
+                        const auto t = std::clamp<double>( (dx * s[3] + dy * s[4] + dz * s[5]) * s[6], 0.0, 1.0 );
+                        const auto ex = dx - s[3] * t;
+                        const auto ey = dy - s[4] * t;
+                        const auto ez = dz - s[5] * t;
+                        o[n] = std::min<double>( o[n], ex * ex + ey * ey + ez * ez );
+                    }
+                }
+                for(int64_t n = 0; n < N; ++n) o[n] = std::sqrt(o[n]) - p[0];
+                break;
+            }
+
+            case opcode::min:
+            case opcode::max:
+            {
+                const bool is_min = (i.op == opcode::min);
+                double *o = value(i.out);
+                const double *v0 = value(this->operands[i.first]);
+                for(int64_t n = 0; n < N; ++n) o[n] = v0[n];
+                for(int64_t k = i.first + 1; k < (i.first + i.count); ++k){
+                    const double *v = value(this->operands[k]);
+                    if(is_min){
+                        for(int64_t n = 0; n < N; ++n) o[n] = std::min<double>(o[n], v[n]);
+                    }else{
+                        for(int64_t n = 0; n < N; ++n) o[n] = std::max<double>(o[n], v[n]);
+                    }
+                }
+                break;
+            }
+            case opcode::subtract:
+            {
+                const double *a = value(i.a), *b = value(i.b);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n) o[n] = std::max<double>(a[n], -b[n]);
+                break;
+            }
+            case opcode::chamfer_min:
+            case opcode::chamfer_max:
+            {
+                // Track the two extreme operands. A single operand has no pairs, so the result is +-inf.
+                const bool is_min = (i.op == opcode::chamfer_min);
+                double *m1 = value(i.out);
+                w.scratch.resize(B);
+                double *m2 = w.scratch.data();
+                if(i.count < 2){
+                    for(int64_t n = 0; n < N; ++n) m1[n] = (is_min ? inf : -inf);
+                    break;
+                }
+                for(int64_t n = 0; n < N; ++n) m1[n] = m2[n] = (is_min ? inf : -inf);
+                for(int64_t k = i.first; k < (i.first + i.count); ++k){
+                    const double *v = value(this->operands[k]);
+                    if(is_min){
+                        for(int64_t n = 0; n < N; ++n){
+                            m2[n] = std::min<double>(m2[n], std::max<double>(m1[n], v[n]));
+                            m1[n] = std::min<double>(m1[n], v[n]);
+                        }
+                    }else{
+                        for(int64_t n = 0; n < N; ++n){
+                            m2[n] = std::max<double>(m2[n], std::min<double>(m1[n], v[n]));
+                            m1[n] = std::max<double>(m1[n], v[n]);
+                        }
+                    }
+                }
+                if(is_min){
+                    for(int64_t n = 0; n < N; ++n) m1[n] = chamfer_min_impl(m1[n], m2[n], p[0]);
+                }else{
+                    for(int64_t n = 0; n < N; ++n) m1[n] = chamfer_max_impl(m1[n], m2[n], p[0]);
+                }
+                break;
+            }
+            case opcode::chamfer_subtract:
+            {
+                const double *a = value(i.a), *b = value(i.b);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n) o[n] = chamfer_subtract_impl(a[n], b[n], p[0]);
+                break;
+            }
+            case opcode::offset:
+            {
+                const double *a = value(i.a);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n) o[n] = a[n] + p[0];
+                break;
+            }
+            case opcode::extrude:
+            {
+                const double *c = value(i.a);
+                const double *ix = coord(i.b, 0), *iy = coord(i.b, 1), *iz = coord(i.b, 2);
+                double *o = value(i.out);
+                for(int64_t n = 0; n < N; ++n){
+                    const auto sd = p[0] * ix[n] + p[1] * iy[n] + p[2] * iz[n] + p[3];
+                    o[n] = extrude_impl(std::abs(sd) - p[4], c[n]);
+                }
+                break;
+            }
+        }
+    }
+    return;
+}
+
+void tape::evaluate(const double *x, const double *y, const double *z, double *out, int64_t N, workspace &w) const {
+    if(this->root < 0){
+        throw std::logic_error("Tape has not been compiled");
+    }
+    constexpr auto B = batch_size;
+    w.coords.resize(this->N_coord_slots * 3 * B);
+    w.values.resize(this->N_value_slots * B);
+
+    for(int64_t first = 0; first < N; first += B){
+        const auto M = std::min<int64_t>(B, N - first);
+        std::copy(x + first, x + first + M, w.coords.data() + 0 * B);
+        std::copy(y + first, y + first + M, w.coords.data() + 1 * B);
+        std::copy(z + first, z + first + M, w.coords.data() + 2 * B);
+        this->execute(w, M);
+        const double *v = w.values.data() + this->root * B;
+        std::copy(v, v + M, out + first);
+    }
+    return;
+}
+
+double tape::evaluate(const vec3<double> &pos) const {
+    workspace w;
+    double out = std::numeric_limits<double>::quiet_NaN();
+    this->evaluate(&pos.x, &pos.y, &pos.z, &out, 1, w);
+    return out;
+}
+
+interval tape::evaluate_interval(const vec3<double> &centre, double radius) const {
+    if(this->root < 0){
+        throw std::logic_error("Tape has not been compiled");
+    }
+    constexpr auto B = batch_size;
+    radius = std::abs(radius);
+
+    // Evaluate every slot at the centre of the ball. Since all coordinate transformations are non-expanding, the
+    // ball in every coordinate slot has (at most) the same radius.
+    workspace w;
+    w.coords.resize(this->N_coord_slots * 3 * B);
+    w.values.resize(this->N_value_slots * B);
+    w.coords[0 * B] = centre.x;
+    w.coords[1 * B] = centre.y;
+    w.coords[2 * B] = centre.z;
+    this->execute(w, 1);
+
+    std::vector<double> lo(this->N_value_slots);
+    std::vector<double> hi(this->N_value_slots);
+    const auto inf = std::numeric_limits<double>::infinity();
+    for(const auto &i : this->instructions){
+        const auto &p = i.p;
+        switch(i.op){
+            case opcode::translate:
+            case opcode::affine:
+                break;
+
+            case opcode::sphere:
+            case opcode::aa_box:
+            case opcode::plane:
+            case opcode::poly_chain:
+            {
+                // Shapes are exact distance functions, so they cannot change faster than the position.
+                const auto v = w.values[i.out * B];
+                lo[i.out] = v - radius;
+                hi[i.out] = v + radius;
+                break;
+            }
+
+            case opcode::min:
+            case opcode::max:
+            {
+                const bool is_min = (i.op == opcode::min);
+                lo[i.out] = lo[this->operands[i.first]];
+                hi[i.out] = hi[this->operands[i.first]];
+                for(int64_t k = i.first + 1; k < (i.first + i.count); ++k){
+                    const auto o = this->operands[k];
+                    lo[i.out] = is_min ? std::min<double>(lo[i.out], lo[o]) : std::max<double>(lo[i.out], lo[o]);
+                    hi[i.out] = is_min ? std::min<double>(hi[i.out], hi[o]) : std::max<double>(hi[i.out], hi[o]);
+                }
+                break;
+            }
+            case opcode::subtract:
+                lo[i.out] = std::max<double>(lo[i.a], -hi[i.b]);
+                hi[i.out] = std::max<double>(hi[i.a], -lo[i.b]);
+                break;
+            case opcode::chamfer_min:
+            case opcode::chamfer_max:
+            {
+                const bool is_min = (i.op == opcode::chamfer_min);
+                if(i.count < 2){
+                    lo[i.out] = hi[i.out] = (is_min ? inf : -inf);
+                    break;
+                }
+                // The combination is non-decreasing in every operand, so it can be evaluated at the interval ends.
+                for(auto *v : { &lo, &hi }){
+                    double m1 = (is_min ? inf : -inf);
+                    double m2 = m1;
+                    for(int64_t k = i.first; k < (i.first + i.count); ++k){
+                        const auto x = (*v)[this->operands[k]];
+                        m2 = is_min ? std::min<double>(m2, std::max<double>(m1, x)) : std::max<double>(m2, std::min<double>(m1, x));
+                        m1 = is_min ? std::min<double>(m1, x) : std::max<double>(m1, x);
+                    }
+                    (*v)[i.out] = is_min ? chamfer_min_impl(m1, m2, p[0]) : chamfer_max_impl(m1, m2, p[0]);
+                }
+                break;
+            }
+            case opcode::chamfer_subtract:
+                lo[i.out] = chamfer_subtract_impl(lo[i.a], hi[i.b], p[0]);
+                hi[i.out] = chamfer_subtract_impl(hi[i.a], lo[i.b], p[0]);
+                break;
+            case opcode::offset:
+                lo[i.out] = lo[i.a] + p[0];
+                hi[i.out] = hi[i.a] + p[0];
+                break;
+            case opcode::extrude:
+            {
+                const auto x = w.coords[(i.b * 3 + 0) * B];
+                const auto y = w.coords[(i.b * 3 + 1) * B];
+                const auto z = w.coords[(i.b * 3 + 2) * B];
+                const auto sd = p[0] * x + p[1] * y + p[2] * z + p[3];
+                const auto abs_sd_lo = std::max<double>(0.0, std::abs(sd) - radius);
+                const auto abs_sd_hi = std::abs(sd) + radius;
+                lo[i.out] = extrude_impl(abs_sd_lo - p[4], lo[i.a]);
+                hi[i.out] = extrude_impl(abs_sd_hi - p[4], hi[i.a]);
+                break;
+            }
+        }
+    }
+    return { lo[this->root], hi[this->root] };
+}
+
+interval tape::evaluate_interval(const aa_bbox &bb) const {
+    const auto centre = (bb.min + bb.max) * 0.5;
+    const auto radius = (bb.max - bb.min).length() * 0.5;
+    return this->evaluate_interval(centre, radius);
+}
+
+
 // Convert text to a 3D representation using SDFs.
 std::shared_ptr<node> text(const std::string& text,
                            double radius,
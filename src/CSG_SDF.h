@@ -11,6 +11,9 @@
 #include <functional>
 #include <regex>
 #include <memory>
+#include <array>
+#include <vector>
+#include <cstdint>
 
 #include "YgorString.h"
 #include "YgorMath.h"
@@ -32,12 +35,18 @@ struct aa_bbox {
     void digest(const vec3<double>&);
 };
 
+class tape;
+
 // Abstract base expression tree node.
 struct node {
     std::vector<std::shared_ptr<node>> children;
 
     virtual double evaluate_sdf(const vec3<double>&) const = 0;
     virtual aa_bbox evaluate_aa_bbox() const = 0;
+
+    // Append instructions that evaluate this node (and its children) to the tape. The positions are read from the
+    // given coordinate slot and the index of the value slot holding the result is returned.
+    virtual int64_t compile(tape &, int64_t coord_slot) const = 0;
     virtual ~node(){};
 };
 
@@ -52,6 +61,7 @@ struct sphere : public node {
     sphere(double);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 // Axis-aligned box centred at (0,0,0).
@@ -61,6 +71,7 @@ struct aa_box : public node {
     aa_box(const vec3<double>& dR);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 // Infinite plane.
@@ -77,6 +88,7 @@ struct plane : public node {
           double bbox_width);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 // Connected line segments with rounded edges.
@@ -88,6 +100,7 @@ struct poly_chain : public node {
     poly_chain(double r, const std::list<vec3<double>> &pc);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 } // namespace shape
@@ -104,6 +117,7 @@ struct translate : public node {
     translate(const vec3<double>& dR);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 
@@ -114,6 +128,7 @@ struct rotate : public node {
     rotate(const vec3<double>& axis, double angle_rad);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 
@@ -122,6 +137,7 @@ struct join : public node {
     join();
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 // Boolean 'difference' or 'subtract.'
@@ -129,6 +145,7 @@ struct subtract : public node {
     subtract();
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 // Boolean 'OR' or 'intersect.'
@@ -136,6 +153,7 @@ struct intersect : public node {
     intersect();
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 
@@ -146,6 +164,7 @@ struct chamfer_join : public node {
     chamfer_join(double thickness);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 struct chamfer_subtract : public node {
@@ -154,6 +173,7 @@ struct chamfer_subtract : public node {
     chamfer_subtract(double thickness);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 struct chamfer_intersect : public node {
@@ -162,6 +182,7 @@ struct chamfer_intersect : public node {
     chamfer_intersect(double thickness);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 
@@ -179,6 +200,7 @@ struct dilate : public node {
     dilate(double);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 struct erode : public node {
@@ -187,6 +209,7 @@ struct erode : public node {
     erode(double);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 
@@ -198,10 +221,108 @@ struct extrude : public node {
     extrude(double, const plane<double> &);
     double evaluate_sdf(const vec3<double>& pos) const override;
     aa_bbox evaluate_aa_bbox() const override;
+    int64_t compile(tape &, int64_t coord_slot) const override;
 };
 
 } // namespace op
 
+// ---------------------------------- Tapes ---------------------------------------
+
+// Bounds on the value of an SDF over a region.
+struct interval {
+    double lo;
+    double hi;
+};
+
+// A 'compiled' expression tree, which is flattened into a linear sequence of instructions.
+//
+// Evaluating a tree node-by-node costs one virtual call per node per point, which dominates when an SDF is sampled
+// on a dense grid. A tape instead evaluates each instruction over a batch of points (stored as separate x, y, and z
+// arrays) before moving on to the next, so the per-instruction overhead is amortized and the inner loops are simple
+// enough to be vectorized by the compiler.
+//
+// Tapes can also bound the SDF over a ball of positions using interval arithmetic. Since all shapes are exact
+// distance functions and all operations are either non-expanding transformations of space or monotonic in their
+// operands, the bounds are conservative. They are useful for skipping regions far from the surface.
+//
+// Note: structural problems (e.g., incorrect number of children) are reported when the tape is compiled rather
+//       than when it is evaluated.
+class tape {
+  public:
+    enum class opcode {
+        // Coordinate transformations. These read and write coordinate slots.
+        translate,         // out = a - p[0:2].
+        affine,            // out = M a + t, where M = p[0:8] (row-major) and t = p[9:11]. Must be non-expanding.
+
+        // Shapes. These read a coordinate slot and write a value slot.
+        sphere,            // p[0] = radius.
+        aa_box,            // p[0:2] = radii.
+        plane,             // p[0:2] = point, p[3:5] = unit normal.
+        poly_chain,        // segments[first, first + count), p[0] = radius.
+
+        // Combinations. These read and write value slots.
+        min,               // operands[first, first + count).
+        max,               // operands[first, first + count).
+        subtract,          // a, b.
+        chamfer_min,       // operands[first, first + count), p[0] = thickness.
+        chamfer_max,       // operands[first, first + count), p[0] = thickness.
+        chamfer_subtract,  // a, b, p[0] = thickness.
+        offset,            // out = a + p[0].
+        extrude,           // a = child value slot, b = unprojected coordinate slot, signed distance to the cut plane
+                           // is p[0:2] . b + p[3], p[4] = extrusion distance.
+    };
+
+    struct instruction {
+        opcode op;
+        int64_t out   = -1; // Output slot. Filled in when the instruction is emitted.
+        int64_t a     = -1;
+        int64_t b     = -1;
+        int64_t first = 0;
+        int64_t count = 0;
+        std::array<double, 12> p = {{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }};
+    };
+
+    // Scratch space used during evaluation. Reusing a workspace avoids repeated allocations.
+    struct workspace {
+        std::vector<double> coords;
+        std::vector<double> values;
+        std::vector<double> scratch;
+    };
+
+    // The number of points evaluated together.
+    static constexpr int64_t batch_size = 256;
+
+  private:
+    std::vector<instruction> instructions;
+    std::vector<int64_t> operands;
+    std::vector<double> segments; // Poly-chain segments, stored as (A, B - A, 1/|B - A|^2).
+    int64_t N_coord_slots = 1; // Slot 0 holds the input positions.
+    int64_t N_value_slots = 0;
+    int64_t root = -1;
+
+    void execute(workspace &, int64_t N) const;
+
+  public:
+    tape() = default;
+    explicit tape(const std::shared_ptr<node> &);
+    explicit tape(const node &);
+
+    // Used by nodes to emit instructions. Returns the output slot.
+    int64_t emit(instruction);
+    int64_t add_operands(const std::vector<int64_t> &);
+    int64_t add_segment(const vec3<double> &A, const vec3<double> &B);
+
+    int64_t size() const;
+
+    // Evaluate the SDF for N points. The output array must have (at least) N elements.
+    void evaluate(const double *x, const double *y, const double *z, double *out, int64_t N, workspace &) const;
+    double evaluate(const vec3<double> &) const;
+
+    // Bound the SDF for all points within the given ball or bounding box.
+    interval evaluate_interval(const vec3<double> &centre, double radius) const;
+    interval evaluate_interval(const aa_bbox &) const;
+};
+
 // Convert text to a 3D representation using SDFs.
 std::shared_ptr<node> text(const std::string& text,
                            double radius = 1.0,
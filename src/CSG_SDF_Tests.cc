@@ -0,0 +1,192 @@
+//CSG_SDF_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the CSG-SDF routines defined in CSG_SDF.cc.
+// Tests are separated into their own file because CSG_SDF_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorMath.h"
+
+#include "CSG_SDF.h"
+
+
+// A tree which exercises every node type.
+static
+std::shared_ptr<csg::sdf::node>
+make_test_tree(){
+    using namespace csg::sdf;
+    const vec3<double> zero3(0.0, 0.0, 0.0);
+
+    auto sph = std::make_shared<shape::sphere>(3.0);
+    auto box = std::make_shared<shape::aa_box>( vec3<double>(2.0, -1.0, 4.0) );
+    auto pln = std::make_shared<shape::plane>( vec3<double>(0.0, 0.0, -2.0), vec3<double>(0.2, 0.1, 1.0), 10.0 );
+    auto pc  = std::make_shared<shape::poly_chain>( 0.5, std::vector<vec3<double>>{{
+                   vec3<double>(-4.0, 0.0, 0.0), vec3<double>(-4.0, 0.0, 0.0), // Degenerate segment.
+                   vec3<double>(0.0, 3.0, 1.0), vec3<double>(4.0, -1.0, 2.0) }} );
+
+    auto tr = std::make_shared<op::translate>( vec3<double>(1.0, -2.0, 0.5) );
+    tr->children.emplace_back(sph);
+
+    auto rot = std::make_shared<op::rotate>( vec3<double>(1.0, 1.0, 0.0), 0.7 );
+    rot->children.emplace_back(box);
+
+    auto cj = std::make_shared<op::chamfer_join>(1.0);
+    cj->children = { tr, rot, pc };
+
+    auto cs = std::make_shared<op::chamfer_subtract>(0.5);
+    cs->children = { cj, std::make_shared<shape::sphere>(1.5) };
+
+    auto ci = std::make_shared<op::chamfer_intersect>(0.8);
+    ci->children = { cs, std::make_shared<shape::sphere>(6.0), pln };
+
+    auto ex = std::make_shared<op::extrude>( 1.5, plane<double>( vec3<double>(0.0, 1.0, 1.0).unit(), vec3<double>(0.0, 0.5, 0.0) ) );
+    ex->children.emplace_back( pc );
+
+    auto dil = std::make_shared<op::dilate>(0.3);
+    dil->children.emplace_back(ex);
+
+    auto ero = std::make_shared<op::erode>(0.2);
+    ero->children.emplace_back(rot);
+
+    auto sub = std::make_shared<op::subtract>();
+    sub->children = { dil, ero };
+
+    auto isect = std::make_shared<op::intersect>();
+    isect->children = { sub, std::make_shared<shape::sphere>(8.0) };
+
+    auto root = std::make_shared<op::join>();
+    root->children = { ci, isect };
+    return root;
+}
+
+
+TEST_CASE("tape evaluation matches tree evaluation"){
+    const auto root = make_test_tree();
+    const csg::sdf::tape t(root);
+    REQUIRE(0 < t.size());
+
+    std::mt19937 re(1234);
+    std::uniform_real_distribution<double> rd(-10.0, 10.0);
+
+    // Use a count that is not a multiple of the batch size.
+    const int64_t N = csg::sdf::tape::batch_size * 5 + 17;
+    std::vector<double> x(N), y(N), z(N), out(N);
+    for(int64_t n = 0; n < N; ++n){
+        x[n] = rd(re);
+        y[n] = rd(re);
+        z[n] = rd(re);
+    }
+    csg::sdf::tape::workspace w;
+    t.evaluate(x.data(), y.data(), z.data(), out.data(), N, w);
+
+    double max_diff = 0.0;
+    for(int64_t n = 0; n < N; ++n){
+        const vec3<double> pos(x[n], y[n], z[n]);
+        const auto expected = root->evaluate_sdf(pos);
+        max_diff = std::max(max_diff, std::abs(expected - out[n]));
+        REQUIRE(t.evaluate(pos) == doctest::Approx(expected));
+    }
+    REQUIRE(max_diff < 1E-9);
+}
+
+TEST_CASE("tape compilation validates structure"){
+    auto j = std::make_shared<csg::sdf::op::join>();
+    REQUIRE_THROWS(csg::sdf::tape(j));
+
+    auto s = std::make_shared<csg::sdf::op::subtract>();
+    s->children.emplace_back( std::make_shared<csg::sdf::shape::sphere>(1.0) );
+    REQUIRE_THROWS(csg::sdf::tape(s));
+
+    auto pc = std::make_shared<csg::sdf::shape::poly_chain>( 1.0, std::vector<vec3<double>>{{ vec3<double>(0.0, 0.0, 0.0) }} );
+    REQUIRE_THROWS(csg::sdf::tape(pc));
+
+    // A single child has no pairs to chamfer.
+    auto cj = std::make_shared<csg::sdf::op::chamfer_join>(1.0);
+    cj->children.emplace_back( std::make_shared<csg::sdf::shape::sphere>(1.0) );
+    const csg::sdf::tape t(cj);
+    REQUIRE(std::isinf(t.evaluate( vec3<double>(0.0, 0.0, 0.0) )));
+}
+
+TEST_CASE("tape interval evaluation bounds the SDF"){
+    const auto root = make_test_tree();
+    const csg::sdf::tape t(root);
+
+    std::mt19937 re(4321);
+    std::uniform_real_distribution<double> rd(-10.0, 10.0);
+    std::uniform_real_distribution<double> rr(0.0, 3.0);
+    std::uniform_real_distribution<double> ru(-1.0, 1.0);
+
+    for(int64_t i = 0; i < 200; ++i){
+        const vec3<double> centre(rd(re), rd(re), rd(re));
+        const auto radius = rr(re);
+        const auto bounds = t.evaluate_interval(centre, radius);
+        REQUIRE(bounds.lo <= bounds.hi);
+
+        for(int64_t j = 0; j < 50; ++j){
+            vec3<double> dR(ru(re), ru(re), ru(re));
+            if(1.0 < dR.length()) dR = dR.unit();
+            const auto sdf = root->evaluate_sdf(centre + dR * radius);
+            REQUIRE(bounds.lo <= sdf + 1E-9);
+            REQUIRE(sdf <= bounds.hi + 1E-9);
+        }
+    }
+
+    SUBCASE("distant regions are bounded away from the surface"){
+        auto sph = std::make_shared<csg::sdf::shape::sphere>(1.0);
+        const csg::sdf::tape ts(sph);
+        const auto far = ts.evaluate_interval( vec3<double>(10.0, 0.0, 0.0), 1.0 );
+        REQUIRE(far.lo == doctest::Approx(8.0));
+        REQUIRE(far.hi == doctest::Approx(10.0));
+
+        csg::sdf::aa_bbox bb;
+        bb.digest( vec3<double>(-0.1, -0.1, -0.1) );
+        bb.digest( vec3<double>( 0.1,  0.1,  0.1) );
+        const auto inside = ts.evaluate_interval(bb);
+        REQUIRE(inside.hi < 0.0);
+    }
+}
+
+TEST_CASE("tape evaluation benchmark"){
+    const auto root = make_test_tree();
+    const csg::sdf::tape t(root);
+
+    const int64_t N_side = 64;
+    const int64_t N = N_side * N_side * N_side;
+    std::vector<double> x(N), y(N), z(N), out(N);
+    for(int64_t n = 0; n < N; ++n){
+        x[n] = -10.0 + 20.0 * static_cast<double>(n % N_side) / N_side;
+        y[n] = -10.0 + 20.0 * static_cast<double>((n / N_side) % N_side) / N_side;
+        z[n] = -10.0 + 20.0 * static_cast<double>(n / (N_side * N_side)) / N_side;
+    }
+
+    const auto t_start = std::chrono::steady_clock::now();
+    double sum_tree = 0.0;
+    for(int64_t n = 0; n < N; ++n){
+        sum_tree += root->evaluate_sdf( vec3<double>(x[n], y[n], z[n]) );
+    }
+    const auto t_tree = std::chrono::steady_clock::now();
+    csg::sdf::tape::workspace w;
+    t.evaluate(x.data(), y.data(), z.data(), out.data(), N, w);
+    const auto t_tape = std::chrono::steady_clock::now();
+    double sum_tape = 0.0;
+    for(const auto &v : out) sum_tape += v;
+
+    const auto ms = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count() / 1000.0;
+    };
+    MESSAGE("Evaluating " << N << " points with " << t.size() << " instructions:"
+            << " tree " << ms(t_start, t_tree) << " ms,"
+            << " tape " << ms(t_tree, t_tape) << " ms");
+    REQUIRE(sum_tape == doctest::Approx(sum_tree));
+}
+
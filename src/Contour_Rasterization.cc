@@ -0,0 +1,545 @@
+//Contour_Rasterization.cc - A part of DICOMautomaton 2026. Written by hal clark.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+#include "YgorMisc.h"
+#include "YgorLog.h"
+
+#include "Contour_Rasterization.h"
+
+
+bool roi_mask::contains(int64_t row, int64_t col) const {
+    if( (row < 0) || (this->rows <= row) ) return false;
+    const auto beg = std::next(std::begin(this->runs), this->row_offsets[row]);
+    const auto end = std::next(std::begin(this->runs), this->row_offsets[row + 1]);
+    const auto it = std::upper_bound(beg, end, col, [](int64_t c, const std::pair<int64_t,int64_t> &run){
+        return (c < run.first);
+    });
+    return (it != beg) && (col < std::prev(it)->second);
+}
+
+int64_t roi_mask::count() const {
+    int64_t out = 0;
+    for(const auto &run : this->runs) out += run.second - run.first;
+    return out;
+}
+
+int64_t roi_mask::memory_usage() const {
+    return static_cast<int64_t>( sizeof(roi_mask)
+                               + this->row_offsets.size() * sizeof(int64_t)
+                               + this->runs.size() * sizeof(std::pair<int64_t,int64_t>) );
+}
+
+
+namespace {
+
+// A contour projected onto the image plane, expressed in fractional (row, column) coordinates.
+struct projected_contour {
+    std::vector<double> r;
+    std::vector<double> c;
+    double r_min;
+    double r_max;
+    int64_t orientation; // +1 or -1, the sign of the area in (row, column) coordinates.
+};
+
+using runs_t = std::vector<std::pair<int64_t,int64_t>>;
+
+std::vector<const contour_of_points<double>*>
+select_contours( const planar_image<float,double> &img,
+                 const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl ){
+    std::vector<const contour_of_points<double>*> out;
+    for(const auto &cc_refw : ccsl){
+        for(const auto &c : cc_refw.get().contours){
+            if(c.points.size() < 3) continue;
+            if(!img.sandwiches_point_within_top_bottom_planes(c.First_N_Point_Avg(3))) continue;
+            out.push_back(&c);
+        }
+    }
+    return out;
+}
+
+std::vector<projected_contour>
+project_contours( const planar_image<float,double> &img,
+                  const std::vector<const contour_of_points<double>*> &contours ){
+    // The lattice basis is derived from the image's own position() mapping so that voxel membership is consistent
+    // with voxel positions used elsewhere.
+    const auto p0 = img.position(0, 0);
+    const auto dR = (1 < img.rows)    ? (img.position(1, 0) - p0) : (img.row_unit * img.pxl_dx);
+    const auto dC = (1 < img.columns) ? (img.position(0, 1) - p0) : (img.col_unit * img.pxl_dy);
+
+    // Solve p - p0 = r * dR + c * dC in the least-squares sense, which projects orthogonally onto the image plane.
+    const double g11 = dR.Dot(dR);
+    const double g12 = dR.Dot(dC);
+    const double g22 = dC.Dot(dC);
+    const double det = g11 * g22 - g12 * g12;
+    if( !std::isfinite(det) || (det <= 0.0) ){
+        throw std::invalid_argument("Image has a degenerate voxel lattice. Cannot rasterize contours");
+    }
+
+    std::vector<projected_contour> out;
+    out.reserve(contours.size());
+    for(const auto &cop : contours){
+        out.emplace_back();
+        auto &pc = out.back();
+        pc.r.reserve(cop->points.size());
+        pc.c.reserve(cop->points.size());
+        pc.r_min = std::numeric_limits<double>::infinity();
+        pc.r_max = -pc.r_min;
+        double area = 0.0;
+        for(const auto &p : cop->points){
+            const auto d = p - p0;
+            const double b1 = d.Dot(dR);
+            const double b2 = d.Dot(dC);
+            const double r = ( g22 * b1 - g12 * b2) / det;
+            const double c = (-g12 * b1 + g11 * b2) / det;
+            if(!pc.r.empty()){
+                area += pc.r.back() * c - r * pc.c.back();
+            }
+            pc.r.push_back(r);
+            pc.c.push_back(c);
+            pc.r_min = std::min(pc.r_min, r);
+            pc.r_max = std::max(pc.r_max, r);
+        }
+        area += pc.r.back() * pc.c.front() - pc.r.front() * pc.c.back();
+        pc.orientation = (area < 0.0) ? -1 : 1;
+    }
+    return out;
+}
+
+// Scan-convert the contours along a lattice of sample points at fractional coordinates (r0 + k, c0 + m) for k in
+// [0, K) and m in [0, M). Sample points are bounded using the half-open crossing rule, i.e., a point is inside when
+// an odd number of edges cross the row strictly to its right, and the per-contour results are combined according to
+// the overlap rule.
+std::vector<runs_t>
+scan_lattice( const std::vector<projected_contour> &pcs,
+              double r0, int64_t K,
+              double c0, int64_t M,
+              Mutate_Voxels_Opts::ContourOverlap overlap ){
+    std::vector<runs_t> out(K);
+
+    std::vector<double> crossings;
+    std::vector<std::pair<int64_t,int64_t>> events; // (column, winding delta).
+    for(int64_t k = 0; k < K; ++k){
+        const double y = r0 + static_cast<double>(k);
+        events.clear();
+
+        for(const auto &pc : pcs){
+            if( (y < pc.r_min) || (pc.r_max < y) ) continue;
+
+            crossings.clear();
+            const auto N = pc.r.size();
+            for(size_t i = 0, j = N - 1; i < N; j = i++){
+                const auto ri = pc.r[i];
+                const auto rj = pc.r[j];
+                if( ((ri <= y) && (y < rj)) || ((rj <= y) && (y < ri)) ){
+                    crossings.push_back( pc.c[i] + (pc.c[j] - pc.c[i]) * (y - ri) / (rj - ri) );
+                }
+            }
+            std::sort(std::begin(crossings), std::end(crossings));
+
+            const int64_t w = (overlap == Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations) ? pc.orientation : 1;
+            for(size_t i = 0; (i + 1) < crossings.size(); i += 2){
+                // Lattice columns m satisfying crossings[i] <= c0 + m < crossings[i+1].
+                const auto m_lo = std::clamp<int64_t>( static_cast<int64_t>(std::ceil(crossings[i] - c0)), 0, M );
+                const auto m_hi = std::clamp<int64_t>( static_cast<int64_t>(std::ceil(crossings[i+1] - c0)), 0, M );
+                if(m_lo < m_hi){
+                    events.emplace_back(m_lo,  w);
+                    events.emplace_back(m_hi, -w);
+                }
+            }
+        }
+        if(events.empty()) continue;
+
+        // Sweep along the row, tracking the combined winding.
+        std::sort(std::begin(events), std::end(events));
+        const auto is_bounded = [overlap](int64_t winding) -> bool {
+            switch(overlap){
+                case Mutate_Voxels_Opts::ContourOverlap::Ignore:
+                    return (0 < winding);
+                case Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations:
+                    return (winding != 0);
+                case Mutate_Voxels_Opts::ContourOverlap::ImplicitOrientations:
+                    return ((winding % 2) != 0);
+                default:
+                    break;
+            }
+            throw std::invalid_argument("Contour overlap option not understood");
+        };
+
+        auto &row_runs = out[k];
+        int64_t winding = 0;
+        int64_t run_begin = -1;
+        for(size_t i = 0; i < events.size(); ){
+            const auto m = events[i].first;
+            for( ; (i < events.size()) && (events[i].first == m); ++i) winding += events[i].second;
+
+            const bool inside = is_bounded(winding);
+            if(inside && (run_begin < 0)){
+                run_begin = m;
+            }else if(!inside && (0 <= run_begin)){
+                row_runs.emplace_back(run_begin, m);
+                run_begin = -1;
+            }
+        }
+    }
+    return out;
+}
+
+runs_t union_runs(const runs_t &a, const runs_t &b){
+    runs_t all;
+    all.reserve(a.size() + b.size());
+    std::merge(std::begin(a), std::end(a), std::begin(b), std::end(b), std::back_inserter(all));
+
+    runs_t out;
+    for(const auto &run : all){
+        if(!out.empty() && (run.first <= out.back().second)){
+            out.back().second = std::max(out.back().second, run.second);
+        }else{
+            out.push_back(run);
+        }
+    }
+    return out;
+}
+
+runs_t intersect_runs(const runs_t &a, const runs_t &b){
+    runs_t out;
+    size_t i = 0;
+    size_t j = 0;
+    while( (i < a.size()) && (j < b.size()) ){
+        const auto lo = std::max(a[i].first, b[j].first);
+        const auto hi = std::min(a[i].second, b[j].second);
+        if(lo < hi) out.emplace_back(lo, hi);
+        if(a[i].second < b[j].second){
+            ++i;
+        }else{
+            ++j;
+        }
+    }
+    return out;
+}
+
+roi_mask
+rasterize_selected( const planar_image<float,double> &img,
+                    const std::vector<const contour_of_points<double>*> &contours,
+                    Mutate_Voxels_Opts::Inclusivity inclusivity,
+                    Mutate_Voxels_Opts::ContourOverlap overlap ){
+    roi_mask out;
+    out.rows = img.rows;
+    out.columns = img.columns;
+    out.row_offsets.assign(img.rows + 1, 0);
+    if( contours.empty()
+    ||  (img.rows <= 0)
+    ||  (img.columns <= 0) ){
+        return out;
+    }
+
+    const auto pcs = project_contours(img, contours);
+
+    // Runs for each voxel row.
+    std::vector<runs_t> voxel_runs;
+    if(inclusivity == Mutate_Voxels_Opts::Inclusivity::Centre){
+        voxel_runs = scan_lattice(pcs, 0.0, img.rows, 0.0, img.columns, overlap);
+
+    }else if( (inclusivity == Mutate_Voxels_Opts::Inclusivity::Inclusive)
+          ||  (inclusivity == Mutate_Voxels_Opts::Inclusivity::Exclusive) ){
+        // Planar corners form a (rows + 1) x (columns + 1) lattice offset by half a voxel.
+        const auto corner_runs = scan_lattice(pcs, -0.5, img.rows + 1, -0.5, img.columns + 1, overlap);
+        voxel_runs.resize(img.rows);
+
+        if(inclusivity == Mutate_Voxels_Opts::Inclusivity::Inclusive){
+            // Any planar corner (or the centre) is bounded. A corner run [a, b) touches voxels [a - 1, b).
+            const auto centre_runs = scan_lattice(pcs, 0.0, img.rows, 0.0, img.columns, overlap);
+            for(int64_t r = 0; r < img.rows; ++r){
+                auto touched = union_runs(corner_runs[r], corner_runs[r + 1]);
+                for(auto &run : touched){
+                    run.first = std::max<int64_t>(run.first - 1, 0);
+                    run.second = std::min<int64_t>(run.second, img.columns);
+                }
+                voxel_runs[r] = union_runs(touched, centre_runs[r]);
+            }
+        }else{
+            // All four planar corners are bounded. A corner run [a, b) fully covers voxels [a, b - 1).
+            for(int64_t r = 0; r < img.rows; ++r){
+                auto covered = intersect_runs(corner_runs[r], corner_runs[r + 1]);
+                for(const auto &run : covered){
+                    if((run.first + 1) < run.second) voxel_runs[r].emplace_back(run.first, run.second - 1);
+                }
+            }
+        }
+
+    }else{
+        throw std::invalid_argument("Inclusivity option not understood");
+    }
+
+    for(int64_t r = 0; r < img.rows; ++r){
+        out.row_offsets[r] = static_cast<int64_t>(out.runs.size());
+        out.runs.insert(std::end(out.runs), std::begin(voxel_runs[r]), std::end(voxel_runs[r]));
+    }
+    out.row_offsets[img.rows] = static_cast<int64_t>(out.runs.size());
+    out.runs.shrink_to_fit();
+    return out;
+}
+
+// The full cache inputs. Only contours that intersect the image participate, so edits to contours on other slices do
+// not invalidate this image's mask.
+void gather_inputs( const planar_image<float,double> &img,
+                    const std::vector<const contour_of_points<double>*> &contours,
+                    std::vector<int64_t> &sizes,
+                    std::vector<double> &values ){
+    size_t N_points = 0;
+    for(const auto &cop : contours) N_points += cop->points.size();
+
+    sizes.clear();
+    sizes.reserve(3 + contours.size());
+    sizes.push_back(img.rows);
+    sizes.push_back(img.columns);
+    sizes.push_back(static_cast<int64_t>(contours.size()));
+    for(const auto &cop : contours) sizes.push_back(static_cast<int64_t>(cop->points.size()));
+
+    const auto add = [&](const vec3<double> &v){
+        values.push_back(v.x);
+        values.push_back(v.y);
+        values.push_back(v.z);
+    };
+    values.clear();
+    values.reserve(15 + 3 * N_points);
+    values.push_back(img.pxl_dx);
+    values.push_back(img.pxl_dy);
+    values.push_back(img.pxl_dz);
+    add(img.anchor);
+    add(img.offset);
+    add(img.row_unit);
+    add(img.col_unit);
+    for(const auto &cop : contours){
+        for(const auto &p : cop->points) add(p);
+    }
+    return;
+}
+
+// FNV-1a.
+void hash_bytes(uint64_t &h, const void *p, size_t n){
+    const auto *b = static_cast<const unsigned char*>(p);
+    for(size_t i = 0; i < n; ++i){
+        h ^= static_cast<uint64_t>(b[i]);
+        h *= 1099511628211ULL;
+    }
+    return;
+}
+void hash_value(uint64_t &h, int64_t x){
+    hash_bytes(h, &x, sizeof(x));
+    return;
+}
+void hash_value(uint64_t &h, double x){
+    if(x == 0.0) x = 0.0; // Fold negative zero.
+    hash_bytes(h, &x, sizeof(x));
+    return;
+}
+
+uint64_t hash_inputs(const std::vector<int64_t> &sizes, const std::vector<double> &values){
+    uint64_t h = 14695981039346656037ULL;
+    for(const auto &x : sizes) hash_value(h, x);
+    for(const auto &x : values) hash_value(h, x);
+    return h;
+}
+
+} // namespace
+
+
+roi_mask Rasterize_Contours( const planar_image<float,double> &img,
+                             const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                             Mutate_Voxels_Opts::Inclusivity inclusivity,
+                             Mutate_Voxels_Opts::ContourOverlap overlap ){
+    return rasterize_selected(img, select_contours(img, ccsl), inclusivity, overlap);
+}
+
+
+bool roi_mask_cache::key_t::operator<(const key_t &rhs) const {
+    return std::tie(this->inputs_hash, this->inclusivity, this->overlap)
+         < std::tie(rhs.inputs_hash, rhs.inclusivity, rhs.overlap);
+}
+
+// Note that negative zero compares equal to zero, consistent with the hash.
+bool roi_mask_cache::inputs_t::operator==(const inputs_t &rhs) const {
+    return (this->sizes == rhs.sizes)
+        && (this->values == rhs.values);
+}
+
+int64_t roi_mask_cache::inputs_t::memory_usage() const {
+    return static_cast<int64_t>( sizeof(*this)
+                               + this->sizes.capacity() * sizeof(int64_t)
+                               + this->values.capacity() * sizeof(double) );
+}
+
+roi_mask_cache::roi_mask_cache(int64_t capacity_bytes) : capacity_bytes(capacity_bytes) {}
+
+std::shared_ptr<const roi_mask>
+roi_mask_cache::get( const planar_image<float,double> &img,
+                     const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                     Mutate_Voxels_Opts::Inclusivity inclusivity,
+                     Mutate_Voxels_Opts::ContourOverlap overlap ){
+    const auto contours = select_contours(img, ccsl);
+    inputs_t inputs;
+    gather_inputs(img, contours, inputs.sizes, inputs.values);
+    const key_t key = { hash_inputs(inputs.sizes, inputs.values),
+                        static_cast<int64_t>(inclusivity),
+                        static_cast<int64_t>(overlap) };
+
+    // The hash only locates candidates; the inputs must match exactly.
+    const auto find = [&]() -> lru_list_t::iterator {
+        const auto range = this->index.equal_range(key);
+        for(auto it = range.first; it != range.second; ++it){
+            if(it->second->inputs == inputs) return it->second;
+        }
+        return std::end(this->lru);
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(this->m);
+        const auto it = find();
+        if(it != std::end(this->lru)){
+            ++(this->n_hits);
+            this->lru.splice(std::begin(this->lru), this->lru, it);
+            return it->mask;
+        }
+        ++(this->n_misses);
+    }
+
+    // Rasterize without holding the lock so other threads can proceed. Concurrent misses on the same key are benign.
+    auto mask = std::make_shared<const roi_mask>( rasterize_selected(img, contours, inclusivity, overlap) );
+    const auto entry_bytes = mask->memory_usage() + inputs.memory_usage();
+
+    std::lock_guard<std::mutex> lock(this->m);
+    if( (find() == std::end(this->lru))
+    &&  (entry_bytes <= this->capacity_bytes) ){
+        this->lru.push_front( entry_t{ key, std::move(inputs), mask, entry_bytes } );
+        this->index.emplace(key, std::begin(this->lru));
+        this->used_bytes += entry_bytes;
+
+        while(this->capacity_bytes < this->used_bytes){
+            const auto oldest = std::prev(std::end(this->lru));
+            this->used_bytes -= oldest->bytes;
+
+            const auto range = this->index.equal_range(oldest->key);
+            for(auto it = range.first; it != range.second; ++it){
+                if(it->second == oldest){
+                    this->index.erase(it);
+                    break;
+                }
+            }
+            this->lru.erase(oldest);
+        }
+    }
+    return mask;
+}
+
+void roi_mask_cache::clear(){
+    std::lock_guard<std::mutex> lock(this->m);
+    this->index.clear();
+    this->lru.clear();
+    this->used_bytes = 0;
+    return;
+}
+
+int64_t roi_mask_cache::hits() const {
+    std::lock_guard<std::mutex> lock(this->m);
+    return this->n_hits;
+}
+
+int64_t roi_mask_cache::misses() const {
+    std::lock_guard<std::mutex> lock(this->m);
+    return this->n_misses;
+}
+
+
+roi_mask_cache & ROI_Mask_Cache(){
+    static roi_mask_cache cache;
+    return cache;
+}
+
+std::shared_ptr<const roi_mask> Rasterize_Contours_Cached( const planar_image<float,double> &img,
+                                                           const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                                                           Mutate_Voxels_Opts::Inclusivity inclusivity,
+                                                           Mutate_Voxels_Opts::ContourOverlap overlap ){
+    return ROI_Mask_Cache().get(img, ccsl, inclusivity, overlap);
+}
+
+
+std::shared_ptr<const roi_mask> Rasterize_Contour_Cached( const planar_image<float,double> &img,
+                                                          const contour_of_points<double> &contour,
+                                                          Mutate_Voxels_Opts::Inclusivity inclusivity ){
+    contour_collection<double> cc;
+    if(3 <= contour.points.size()) cc.contours.push_back(contour);
+    return ROI_Mask_Cache().get(img, { std::ref(cc) }, inclusivity, Mutate_Voxels_Opts::ContourOverlap::Ignore);
+}
+
+
+void Mutate_Voxels_Rasterized( std::reference_wrapper<planar_image<float,double>> img_refw,
+                               std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs,
+                               std::list<std::reference_wrapper<contour_collection<double>>> ccsl,
+                               Mutate_Voxels_Opts opts,
+                               Mutate_Voxels_Functor<float,double> f_bounded,
+                               Mutate_Voxels_Functor<float,double> f_unbounded,
+                               Mutate_Voxels_Functor<float,double> f_visitor ){
+    auto &img = img_refw.get();
+
+    // With a single selected image, which is also the image being edited, every aggregate reduces to the voxel's own
+    // value.
+    const bool only_self = (selected_imgs.size() == 1)
+                        && (std::addressof(selected_imgs.front().get()) == std::addressof(img));
+    const bool handled = only_self
+                      && (opts.editstyle == Mutate_Voxels_Opts::EditStyle::InPlace)
+                      && (opts.adjacency == Mutate_Voxels_Opts::Adjacency::SingleVoxel)
+                      && (opts.maskmod   == Mutate_Voxels_Opts::MaskMod::Noop)
+                      && ( (opts.aggregate == Mutate_Voxels_Opts::Aggregate::First)
+                        || (opts.aggregate == Mutate_Voxels_Opts::Aggregate::Mean) );
+    if(!handled){
+        Mutate_Voxels<float,double>( img_refw, selected_imgs, ccsl, opts, f_bounded, f_unbounded, f_visitor );
+        return;
+    }
+    if( !f_bounded && !f_unbounded && !f_visitor ) return;
+
+    const auto mask = Rasterize_Contours_Cached(img, ccsl, opts.inclusivity, opts.contouroverlap);
+
+    planar_image<float,double> mask_img;
+    mask_img.init_buffer(img.rows, img.columns, 1);
+    mask_img.init_spatial(img.pxl_dx, img.pxl_dy, img.pxl_dz, img.anchor, img.offset);
+    mask_img.init_orientation(img.row_unit, img.col_unit);
+    mask_img.fill_pixels(0.0f);
+    mask->visit_bounded([&](int64_t r, int64_t c){
+        mask_img.reference(r, c, 0) = 1.0f;
+    });
+    auto mask_img_refw = std::ref(mask_img);
+
+    for(int64_t r = 0; r < img.rows; ++r){
+        for(int64_t c = 0; c < img.columns; ++c){
+            const bool is_bounded = (mask_img.value(r, c, 0) != 0.0f);
+            for(int64_t chnl = 0; chnl < img.channels; ++chnl){
+                float val = img.value(r, c, chnl);
+                if(is_bounded){
+                    if(f_bounded) f_bounded(r, c, chnl, img_refw, mask_img_refw, val);
+                }else{
+                    if(f_unbounded) f_unbounded(r, c, chnl, img_refw, mask_img_refw, val);
+                }
+                if(f_visitor) f_visitor(r, c, chnl, img_refw, mask_img_refw, val);
+                img.reference(r, c, chnl) = val;
+            }
+        }
+    }
+    return;
+}
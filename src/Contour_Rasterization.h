@@ -0,0 +1,151 @@
+//Contour_Rasterization.h - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file provides scanline rasterization of contours onto planar image grids. Each image's bounded voxels are
+// encoded as compact per-row runs, which are far cheaper to produce than testing every voxel against every contour
+// with point-in-polygon tests. Masks can be cached by contour content and image geometry so repeated operations on
+// the same ROIs and grid reuse them.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+
+// Voxels bounded by contours on a single image.
+struct roi_mask {
+    int64_t rows = 0;
+    int64_t columns = 0;
+
+    // Bounded voxels are stored as half-open [first, last) column runs. Runs for row 'r' are stored in
+    // runs[row_offsets[r]] ... runs[row_offsets[r+1] - 1], sorted and non-overlapping.
+    std::vector<int64_t> row_offsets;
+    std::vector<std::pair<int64_t, int64_t>> runs;
+
+    bool contains(int64_t row, int64_t col) const;
+
+    // The number of bounded voxels.
+    int64_t count() const;
+
+    // Approximate storage footprint, in bytes.
+    int64_t memory_usage() const;
+
+    // Invoke f(row, col) for every bounded voxel, in row-major order.
+    template <class F>
+    void visit_bounded(F &&f) const {
+        for(int64_t r = 0; r < this->rows; ++r){
+            for(int64_t i = this->row_offsets[r]; i < this->row_offsets[r+1]; ++i){
+                for(int64_t c = this->runs[i].first; c < this->runs[i].second; ++c){
+                    f(r, c);
+                }
+            }
+        }
+        return;
+    }
+};
+
+
+// Scan-convert the contours that intersect the image's slab into a mask.
+//
+// Contours are projected orthogonally onto the image plane, and only contours whose vertex average lies within the
+// image's top and bottom planes are considered. Inclusivity controls whether voxel centres, any planar corner (or the
+// centre), or all planar corners must be bounded. Overlap controls how multiple contours on the same slice combine:
+// 'Ignore' takes their union, 'HonourOppositeOrientations' sums orientation-signed windings so oppositely-oriented
+// interior contours carve holes, and 'ImplicitOrientations' cancels any overlap (even-odd rule).
+roi_mask Rasterize_Contours( const planar_image<float,double> &img,
+                             const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                             Mutate_Voxels_Opts::Inclusivity inclusivity,
+                             Mutate_Voxels_Opts::ContourOverlap overlap );
+
+
+// A thread-safe, size-bounded cache of masks keyed by contour content, image geometry, and rasterization options.
+//
+// Entries are keyed by a hash of the contour content and image geometry, so contours copied into new containers still
+// hit the cache, while any edit to the contours or image geometry produces a new entry. Each entry retains a copy of
+// its inputs, which are compared on lookup so a hash collision can never return another entry's mask.
+// Least-recently-used masks are evicted first.
+class roi_mask_cache {
+  public:
+    explicit roi_mask_cache(int64_t capacity_bytes = 256L * 1024L * 1024L);
+
+    std::shared_ptr<const roi_mask> get( const planar_image<float,double> &img,
+                                         const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                                         Mutate_Voxels_Opts::Inclusivity inclusivity,
+                                         Mutate_Voxels_Opts::ContourOverlap overlap );
+
+    void clear();
+
+    int64_t hits() const;
+    int64_t misses() const;
+
+  private:
+    struct key_t {
+        uint64_t inputs_hash;
+        int64_t inclusivity;
+        int64_t overlap;
+
+        bool operator<(const key_t &rhs) const;
+    };
+
+    // The image geometry and contour vertices used to produce a mask.
+    struct inputs_t {
+        std::vector<int64_t> sizes;  // Image rows and columns, the number of contours, and each contour's vertex count.
+        std::vector<double> values;  // Image geometry followed by the contour vertex coordinates.
+
+        bool operator==(const inputs_t &rhs) const;
+        int64_t memory_usage() const;
+    };
+
+    struct entry_t {
+        key_t key;
+        inputs_t inputs;
+        std::shared_ptr<const roi_mask> mask;
+        int64_t bytes;
+    };
+    using lru_list_t = std::list<entry_t>;
+
+    mutable std::mutex m;
+    int64_t capacity_bytes;
+    int64_t used_bytes = 0;
+    int64_t n_hits = 0;
+    int64_t n_misses = 0;
+    lru_list_t lru; // Most-recently used at the front.
+    std::multimap<key_t, lru_list_t::iterator> index; // Colliding hashes share a key.
+};
+
+// The process-wide mask cache.
+roi_mask_cache & ROI_Mask_Cache();
+
+// Rasterize using the process-wide cache.
+std::shared_ptr<const roi_mask> Rasterize_Contours_Cached( const planar_image<float,double> &img,
+                                                           const std::list<std::reference_wrapper<contour_collection<double>>> &ccsl,
+                                                           Mutate_Voxels_Opts::Inclusivity inclusivity,
+                                                           Mutate_Voxels_Opts::ContourOverlap overlap );
+
+// Rasterize a single contour using the process-wide cache. Contours with fewer than three vertices bound nothing.
+std::shared_ptr<const roi_mask> Rasterize_Contour_Cached( const planar_image<float,double> &img,
+                                                          const contour_of_points<double> &contour,
+                                                          Mutate_Voxels_Opts::Inclusivity inclusivity
+                                                              = Mutate_Voxels_Opts::Inclusivity::Centre );
+
+// A drop-in replacement for Ygor's Mutate_Voxels() that partitions voxels using cached scanline masks.
+//
+// The common case -- editing a single image in-place using only its own voxel values -- is handled here. Voxels are
+// visited in row-major order and each functor receives a single-channel mask image in which bounded voxels are one
+// and all others are zero. All other option combinations are forwarded to Mutate_Voxels().
+void Mutate_Voxels_Rasterized( std::reference_wrapper<planar_image<float,double>> img_refw,
+                               std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs,
+                               std::list<std::reference_wrapper<contour_collection<double>>> ccsl,
+                               Mutate_Voxels_Opts opts,
+                               Mutate_Voxels_Functor<float,double> f_bounded,
+                               Mutate_Voxels_Functor<float,double> f_unbounded = {},
+                               Mutate_Voxels_Functor<float,double> f_visitor = {} );
+
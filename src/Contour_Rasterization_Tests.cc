@@ -0,0 +1,342 @@
+//Contour_Rasterization_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the contour rasterization routines defined in Contour_Rasterization.cc.
+// Tests are separated into their own file because Contour_Rasterization_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "Contour_Rasterization.h"
+
+
+static
+planar_image<float,double>
+make_test_image(int64_t rows, int64_t cols){
+    planar_image<float,double> img;
+    img.init_buffer(rows, cols, 1);
+    img.init_spatial(1.0, 1.5, 2.0, vec3<double>(-10.0, -20.0, 5.0), vec3<double>(0.0, 0.0, 0.0));
+    img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+    img.fill_pixels(0.0f);
+    return img;
+}
+
+// An irregular polygon centred at the given position. A negative angular step reverses the orientation.
+static
+contour_of_points<double>
+make_test_contour(const vec3<double> &centre, double radius, int64_t N, double dir, std::mt19937 &re){
+    std::uniform_real_distribution<double> rd(0.6, 1.0);
+    contour_of_points<double> c;
+    c.closed = true;
+    for(int64_t i = 0; i < N; ++i){
+        const auto t = dir * 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(N);
+        const auto r = radius * rd(re);
+        c.points.emplace_back( centre + vec3<double>(r * std::cos(t), r * std::sin(t), 0.0) );
+    }
+    return c;
+}
+
+// Reference voxel membership using per-voxel point-in-polygon tests. Orientations are provided explicitly.
+static
+bool
+brute_force_bounded(const planar_image<float,double> &img,
+                    const contour_collection<double> &cc,
+                    const std::vector<int64_t> &orientations,
+                    int64_t row, int64_t col,
+                    Mutate_Voxels_Opts::Inclusivity inclusivity,
+                    Mutate_Voxels_Opts::ContourOverlap overlap){
+    const auto pln = img.image_plane();
+    const auto dR = img.position(1, 0) - img.position(0, 0);
+    const auto dC = img.position(0, 1) - img.position(0, 0);
+
+    const auto point_bounded = [&](const vec3<double> &p) -> bool {
+        int64_t winding = 0;
+        auto o_it = std::begin(orientations);
+        for(const auto &c : cc.contours){
+            const auto orientation = *(o_it++);
+            if(!img.sandwiches_point_within_top_bottom_planes(c.First_N_Point_Avg(3))) continue;
+            if(!c.Is_Point_In_Polygon_Projected_Orthogonally(pln, p)) continue;
+            if(overlap == Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations){
+                winding += orientation;
+            }else{
+                winding += 1;
+            }
+        }
+        if(overlap == Mutate_Voxels_Opts::ContourOverlap::ImplicitOrientations) return ((winding % 2) != 0);
+        return (winding != 0);
+    };
+
+    const auto centre = img.position(row, col);
+    const std::vector<vec3<double>> corners = { centre - dR * 0.5 - dC * 0.5,
+                                                centre - dR * 0.5 + dC * 0.5,
+                                                centre + dR * 0.5 - dC * 0.5,
+                                                centre + dR * 0.5 + dC * 0.5 };
+    if(inclusivity == Mutate_Voxels_Opts::Inclusivity::Centre){
+        return point_bounded(centre);
+    }else if(inclusivity == Mutate_Voxels_Opts::Inclusivity::Inclusive){
+        bool out = point_bounded(centre);
+        for(const auto &p : corners) out = out || point_bounded(p);
+        return out;
+    }
+    bool out = true;
+    for(const auto &p : corners) out = out && point_bounded(p);
+    return out;
+}
+
+
+TEST_CASE("rasterization matches per-voxel point-in-polygon tests"){
+    std::mt19937 re(1234);
+    const auto img = make_test_image(40, 50);
+
+    contour_collection<double> cc;
+    const vec3<double> centre = img.position(20, 25);
+    cc.contours.emplace_back( make_test_contour(centre, 25.0, 37, 1.0, re) );
+    cc.contours.emplace_back( make_test_contour(centre + vec3<double>(1.3, -2.1, 0.0), 9.0, 23, -1.0, re) );
+    cc.contours.emplace_back( make_test_contour(centre + vec3<double>(14.2, 11.7, 0.0), 8.0, 19, 1.0, re) );
+
+    // A contour on another slice, which should be ignored.
+    cc.contours.emplace_back( make_test_contour(centre + vec3<double>(0.0, 0.0, 10.0), 20.0, 11, 1.0, re) );
+    const std::vector<int64_t> orientations = { 1, -1, 1, 1 };
+
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+
+    for(const auto inclusivity : { Mutate_Voxels_Opts::Inclusivity::Centre,
+                                   Mutate_Voxels_Opts::Inclusivity::Inclusive,
+                                   Mutate_Voxels_Opts::Inclusivity::Exclusive }){
+        for(const auto overlap : { Mutate_Voxels_Opts::ContourOverlap::Ignore,
+                                   Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations,
+                                   Mutate_Voxels_Opts::ContourOverlap::ImplicitOrientations }){
+            const auto mask = Rasterize_Contours(img, ccsl, inclusivity, overlap);
+            REQUIRE(mask.rows == img.rows);
+            REQUIRE(mask.columns == img.columns);
+
+            int64_t count = 0;
+            int64_t mismatches = 0;
+            for(int64_t r = 0; r < img.rows; ++r){
+                for(int64_t c = 0; c < img.columns; ++c){
+                    const bool expected = brute_force_bounded(img, cc, orientations, r, c, inclusivity, overlap);
+                    if(expected) ++count;
+                    if(expected != mask.contains(r, c)) ++mismatches;
+                }
+            }
+            REQUIRE(0 < count);
+            REQUIRE(mismatches == 0);
+            REQUIRE(mask.count() == count);
+
+            int64_t visited = 0;
+            mask.visit_bounded([&](int64_t r, int64_t c){
+                REQUIRE(mask.contains(r, c));
+                ++visited;
+            });
+            REQUIRE(visited == count);
+        }
+    }
+}
+
+TEST_CASE("overlap options combine contours as expected"){
+    const auto img = make_test_image(20, 20);
+    const auto p = [&](double r, double c){
+        return img.position(0, 0) + (img.position(1, 0) - img.position(0, 0)) * r
+                                  + (img.position(0, 1) - img.position(0, 0)) * c;
+    };
+    const auto square = [&](double r0, double c0, double r1, double c1, bool reverse){
+        contour_of_points<double> c;
+        c.closed = true;
+        c.points = { p(r0, c0), p(r0, c1), p(r1, c1), p(r1, c0) };
+        if(reverse) c.points.reverse();
+        return c;
+    };
+
+    contour_collection<double> cc;
+    cc.contours.emplace_back( square(1.5, 1.5, 11.5, 11.5, false) ); // 10x10 voxels.
+    cc.contours.emplace_back( square(3.5, 3.5,  7.5,  7.5, true) );  // 4x4 voxels, opposite orientation.
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+
+    const auto centre = Mutate_Voxels_Opts::Inclusivity::Centre;
+    REQUIRE(Rasterize_Contours(img, ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::Ignore).count() == 100);
+    REQUIRE(Rasterize_Contours(img, ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations).count() == 84);
+    REQUIRE(Rasterize_Contours(img, ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::ImplicitOrientations).count() == 84);
+
+    // With identical orientations, overlap only cancels for the even-odd rule.
+    cc.contours.back().points.reverse();
+    REQUIRE(Rasterize_Contours(img, ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::HonourOppositeOrientations).count() == 100);
+    REQUIRE(Rasterize_Contours(img, ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::ImplicitOrientations).count() == 84);
+
+    SUBCASE("contours extending beyond the image are clipped"){
+        contour_collection<double> big;
+        big.contours.emplace_back( square(-5.5, -5.5, 30.5, 30.5, false) );
+        const std::list<std::reference_wrapper<contour_collection<double>>> big_ccsl = { std::ref(big) };
+        REQUIRE(Rasterize_Contours(img, big_ccsl, centre, Mutate_Voxels_Opts::ContourOverlap::Ignore).count() == 400);
+    }
+}
+
+TEST_CASE("mask cache reuses masks by content"){
+    std::mt19937 re(4321);
+    const auto img = make_test_image(30, 30);
+
+    contour_collection<double> cc;
+    cc.contours.emplace_back( make_test_contour(img.position(15, 15), 10.0, 17, 1.0, re) );
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+
+    roi_mask_cache cache;
+    const auto incl = Mutate_Voxels_Opts::Inclusivity::Centre;
+    const auto ovr = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+
+    const auto a = cache.get(img, ccsl, incl, ovr);
+    REQUIRE(cache.misses() == 1);
+
+    // A copy of the contours in a new container hits the cache.
+    contour_collection<double> cc_copy = cc;
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl_copy = { std::ref(cc_copy) };
+    const auto b = cache.get(img, ccsl_copy, incl, ovr);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(a.get() == b.get());
+
+    // Changing the options, contours, or geometry does not.
+    cache.get(img, ccsl, Mutate_Voxels_Opts::Inclusivity::Inclusive, ovr);
+    REQUIRE(cache.misses() == 2);
+
+    cc_copy.contours.front().points.front().x += 0.25;
+    cache.get(img, ccsl_copy, incl, ovr);
+    REQUIRE(cache.misses() == 3);
+
+    auto img_shifted = img;
+    img_shifted.offset += vec3<double>(0.1, 0.0, 0.0);
+    cache.get(img_shifted, ccsl, incl, ovr);
+    REQUIRE(cache.misses() == 4);
+
+    cache.clear();
+    cache.get(img, ccsl, incl, ovr);
+    REQUIRE(cache.misses() == 5);
+}
+
+TEST_CASE("mask cache only returns masks for identical inputs"){
+    std::mt19937 re(8765);
+    const auto img = make_test_image(30, 30);
+
+    contour_collection<double> cc;
+    cc.contours.emplace_back( make_test_contour(img.position(15, 15), 10.0, 17, 1.0, re) );
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+
+    const auto incl = Mutate_Voxels_Opts::Inclusivity::Centre;
+    const auto ovr = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+    const auto expected = [&](const std::list<std::reference_wrapper<contour_collection<double>>> &l){
+        const auto m = Rasterize_Contours(img, l, incl, ovr);
+        return std::make_pair(m.row_offsets, m.runs);
+    };
+
+    roi_mask_cache cache;
+    const auto a = cache.get(img, ccsl, incl, ovr);
+    REQUIRE(std::make_pair(a->row_offsets, a->runs) == expected(ccsl));
+
+    // Even the smallest change to a vertex produces a distinct entry.
+    contour_collection<double> cc_nudged = cc;
+    auto &p = cc_nudged.contours.front().points.front();
+    p.x = std::nextafter(p.x, p.x + 1.0);
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl_nudged = { std::ref(cc_nudged) };
+    const auto b = cache.get(img, ccsl_nudged, incl, ovr);
+    REQUIRE(cache.misses() == 2);
+    REQUIRE(a.get() != b.get());
+    REQUIRE(std::make_pair(b->row_offsets, b->runs) == expected(ccsl_nudged));
+
+    // Both entries remain available.
+    REQUIRE(cache.get(img, ccsl, incl, ovr).get() == a.get());
+    REQUIRE(cache.get(img, ccsl_nudged, incl, ovr).get() == b.get());
+    REQUIRE(cache.hits() == 2);
+
+    // Entries are evicted once the capacity is exceeded.
+    roi_mask_cache small_cache(1);
+    small_cache.get(img, ccsl, incl, ovr);
+    small_cache.get(img, ccsl, incl, ovr);
+    REQUIRE(small_cache.hits() == 0);
+    REQUIRE(small_cache.misses() == 2);
+}
+
+
+TEST_CASE("Mutate_Voxels_Rasterized partitions voxels like Mutate_Voxels"){
+    std::mt19937 re(2468);
+    auto img = make_test_image(30, 40);
+    img.init_buffer(30, 40, 2);
+    img.fill_pixels(5.0f);
+
+    contour_collection<double> cc;
+    cc.contours.emplace_back( make_test_contour(img.position(15, 20), 12.0, 23, 1.0, re) );
+    cc.contours.emplace_back( make_test_contour(img.position(8, 30), 5.0, 13, -1.0, re) );
+    const std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+
+    Mutate_Voxels_Opts opts;
+    opts.editstyle      = Mutate_Voxels_Opts::EditStyle::InPlace;
+    opts.inclusivity    = Mutate_Voxels_Opts::Inclusivity::Centre;
+    opts.contouroverlap = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+    opts.aggregate      = Mutate_Voxels_Opts::Aggregate::First;
+    opts.adjacency      = Mutate_Voxels_Opts::Adjacency::SingleVoxel;
+    opts.maskmod        = Mutate_Voxels_Opts::MaskMod::Noop;
+
+    int64_t N_visited = 0;
+    int64_t N_mask_mismatches = 0;
+    Mutate_Voxels_Functor<float,double> f_bounded = [](int64_t, int64_t, int64_t chnl,
+                                                       std::reference_wrapper<planar_image<float,double>>,
+                                                       std::reference_wrapper<planar_image<float,double>>,
+                                                       float &val){
+        val = 10.0f + static_cast<float>(chnl);
+    };
+    Mutate_Voxels_Functor<float,double> f_unbounded = [](int64_t, int64_t, int64_t,
+                                                         std::reference_wrapper<planar_image<float,double>>,
+                                                         std::reference_wrapper<planar_image<float,double>>,
+                                                         float &val){
+        val = -val;
+    };
+    Mutate_Voxels_Functor<float,double> f_visitor = [&](int64_t r, int64_t c, int64_t,
+                                                        std::reference_wrapper<planar_image<float,double>>,
+                                                        std::reference_wrapper<planar_image<float,double>> mask_img_refw,
+                                                        float &val){
+        ++N_visited;
+        const auto &m = mask_img_refw.get();
+        if((m.value(r, c, m.channels - 1) != 0.0f) != (0.0f < val)) ++N_mask_mismatches;
+    };
+
+    auto expected = img;
+    Mutate_Voxels<float,double>( std::ref(expected), { std::ref(expected) }, ccsl, opts, f_bounded, f_unbounded );
+
+    auto actual = img;
+    Mutate_Voxels_Rasterized( std::ref(actual), { std::ref(actual) }, ccsl, opts, f_bounded, f_unbounded, f_visitor );
+    REQUIRE(N_visited == actual.rows * actual.columns * actual.channels);
+    REQUIRE(N_mask_mismatches == 0);
+
+    const auto mask = Rasterize_Contours(img, ccsl, opts.inclusivity, opts.contouroverlap);
+    REQUIRE(0 < mask.count());
+    for(int64_t r = 0; r < img.rows; ++r){
+        for(int64_t c = 0; c < img.columns; ++c){
+            for(int64_t chnl = 0; chnl < img.channels; ++chnl){
+                const auto v = actual.value(r, c, chnl);
+                REQUIRE(v == expected.value(r, c, chnl));
+                REQUIRE(v == (mask.contains(r, c) ? 10.0f + static_cast<float>(chnl) : -5.0f));
+            }
+        }
+    }
+
+    SUBCASE("unsupported options are forwarded to Mutate_Voxels"){
+        opts.editstyle = Mutate_Voxels_Opts::EditStyle::Surrogate;
+        auto expected_s = img;
+        Mutate_Voxels<float,double>( std::ref(expected_s), { std::ref(expected_s) }, ccsl, opts, f_bounded, f_unbounded );
+        auto actual_s = img;
+        Mutate_Voxels_Rasterized( std::ref(actual_s), { std::ref(actual_s) }, ccsl, opts, f_bounded, f_unbounded );
+        for(int64_t r = 0; r < img.rows; ++r){
+            for(int64_t c = 0; c < img.columns; ++c){
+                for(int64_t chnl = 0; chnl < img.channels; ++chnl){
+                    REQUIRE(actual_s.value(r, c, chnl) == expected_s.value(r, c, chnl));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,493 @@
+//Convolution_FFT.cc - A part of DICOMautomaton 2026. Written by hal clark.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "YgorLog.h"
+
+#include "Thread_Pool.h"
+#include "Convolution_FFT.h"
+
+
+conv_volume::conv_volume(int64_t images, int64_t rows, int64_t cols, float fill)
+  : images(images), rows(rows), cols(cols),
+    data(static_cast<size_t>(std::max<int64_t>(0, images * rows * cols)), fill) {}
+
+
+int64_t FFT_Next_Power_Of_Two(int64_t n){
+    int64_t p = 1;
+    while(p < n) p *= 2;
+    return p;
+}
+
+fft_plan::fft_plan(int64_t n) : n(n) {
+    if( (n < 1) || (n != FFT_Next_Power_Of_Two(n)) ){
+        throw std::invalid_argument("FFT length must be a power of two");
+    }
+
+    const double pi = std::acos(-1.0);
+    this->twiddles.reserve(n / 2);
+    for(int64_t k = 0; k < (n / 2); ++k){
+        const double a = -2.0 * pi * static_cast<double>(k) / static_cast<double>(n);
+        this->twiddles.emplace_back( std::cos(a), std::sin(a) );
+    }
+
+    int64_t bits = 0;
+    while((1L << bits) < n) ++bits;
+    this->bit_reversal.resize(n);
+    for(int64_t i = 0; i < n; ++i){
+        int64_t r = 0;
+        for(int64_t b = 0; b < bits; ++b){
+            if(i & (1L << b)) r |= (1L << (bits - 1 - b));
+        }
+        this->bit_reversal[i] = r;
+    }
+}
+
+void fft_plan::execute(std::complex<double> *x, bool inverse) const {
+    for(int64_t i = 0; i < this->n; ++i){
+        const auto j = this->bit_reversal[i];
+        if(i < j) std::swap(x[i], x[j]);
+    }
+
+    for(int64_t len = 2; len <= this->n; len *= 2){
+        const int64_t half = len / 2;
+        const int64_t step = this->n / len;
+        for(int64_t i = 0; i < this->n; i += len){
+            for(int64_t j = 0; j < half; ++j){
+                const auto &t = this->twiddles[j * step];
+                const auto w = inverse ? std::conj(t) : t;
+                const auto u = x[i + j];
+                const auto v = x[i + j + half] * w;
+                x[i + j] = u + v;
+                x[i + j + half] = u - v;
+            }
+        }
+    }
+    return;
+}
+
+void fft_plan::execute(std::complex<double> *x, int64_t stride, bool inverse, std::vector<std::complex<double>> &scratch) const {
+    if(stride == 1){
+        this->execute(x, inverse);
+        return;
+    }
+    scratch.resize(this->n);
+    for(int64_t i = 0; i < this->n; ++i) scratch[i] = x[i * stride];
+    this->execute(scratch.data(), inverse);
+    for(int64_t i = 0; i < this->n; ++i) x[i * stride] = scratch[i];
+    return;
+}
+
+
+namespace {
+
+// The arrangement of overlap-save blocks used to cover a volume.
+struct block_layout_t {
+    std::array<int64_t, 3> block = {{ 1, 1, 1 }}; // FFT block extents.
+    std::array<int64_t, 3> valid = {{ 1, 1, 1 }}; // Outgoing voxels produced by each block.
+    std::array<int64_t, 3> count = {{ 0, 0, 0 }}; // Number of blocks along each axis.
+    double cost = std::numeric_limits<double>::infinity();
+};
+
+int64_t
+product(const std::array<int64_t, 3> &a){
+    return a[0] * a[1] * a[2];
+}
+
+// Select power-of-two block extents that minimize the estimated cost of covering the volume.
+block_layout_t
+choose_block_layout(const std::array<int64_t, 3> &N,
+                    const std::array<int64_t, 3> &K,
+                    int64_t max_block_voxels){
+    std::array<std::vector<int64_t>, 3> candidates;
+    for(size_t d = 0; d < 3; ++d){
+        const auto hi = FFT_Next_Power_Of_Two(N[d] + K[d] - 1);
+        for(auto b = FFT_Next_Power_Of_Two(K[d]); b <= hi; b *= 2){
+            candidates[d].emplace_back(b);
+        }
+    }
+
+    block_layout_t best;
+    block_layout_t smallest;
+    for(const auto b0 : candidates[0]){
+        for(const auto b1 : candidates[1]){
+            for(const auto b2 : candidates[2]){
+                block_layout_t l;
+                l.block = {{ b0, b1, b2 }};
+                for(size_t d = 0; d < 3; ++d){
+                    l.valid[d] = l.block[d] - K[d] + 1;
+                    l.count[d] = (N[d] + l.valid[d] - 1) / l.valid[d];
+                }
+
+                // Two blocks are packed into each complex transform. Each transform pair costs ~n*log2(n) butterflies
+                // for each of the forward and inverse transforms, plus the gather, spectral product, and scatter.
+                const auto n = static_cast<double>(product(l.block));
+                const auto pairs = static_cast<double>((product(l.count) + 1) / 2);
+                l.cost = pairs * n * (2.0 * std::max(1.0, std::log2(n)) + 3.0);
+
+                if( (product(l.block) <= max_block_voxels)
+                &&  (l.cost < best.cost) ){
+                    best = l;
+                }
+                if( (smallest.cost == std::numeric_limits<double>::infinity())
+                ||  (product(l.block) < product(smallest.block)) ){
+                    smallest = l;
+                }
+            }
+        }
+    }
+
+    // Honour the kernel even if it exceeds the requested block size.
+    if(!std::isfinite(best.cost)) best = smallest;
+    return best;
+}
+
+// Transform a block in-place along all three axes.
+void
+fft_3d(std::vector<std::complex<double>> &buf,
+       const std::array<int64_t, 3> &B,
+       const std::array<fft_plan, 3> &plans,
+       bool inverse,
+       std::vector<std::complex<double>> &scratch){
+    for(int64_t i = 0; i < B[0]; ++i){
+        for(int64_t r = 0; r < B[1]; ++r){
+            plans[2].execute(&buf[(i * B[1] + r) * B[2]], inverse);
+        }
+    }
+    if(1 < B[1]){
+        for(int64_t i = 0; i < B[0]; ++i){
+            for(int64_t c = 0; c < B[2]; ++c){
+                plans[1].execute(&buf[i * B[1] * B[2] + c], B[2], inverse, scratch);
+            }
+        }
+    }
+    if(1 < B[0]){
+        for(int64_t r = 0; r < B[1]; ++r){
+            for(int64_t c = 0; c < B[2]; ++c){
+                plans[0].execute(&buf[r * B[2] + c], B[1] * B[2], inverse, scratch);
+            }
+        }
+    }
+    return;
+}
+
+// Replace each voxel with the sum over the window [x - d, x - d + K - 1] along one axis. Voxels outside the volume
+// contribute zero.
+void
+box_sum_axis(std::vector<double> &v,
+             const std::array<int64_t, 3> &N,
+             size_t axis,
+             int64_t K,
+             int64_t d){
+    const int64_t len = N[axis];
+    const int64_t stride = (axis == 2) ? 1 : ( (axis == 1) ? N[2] : N[1] * N[2] );
+    auto M = N;
+    M[axis] = 1;
+
+    std::vector<double> prefix(len + 1, 0.0);
+    for(int64_t i = 0; i < M[0]; ++i){
+        for(int64_t r = 0; r < M[1]; ++r){
+            for(int64_t c = 0; c < M[2]; ++c){
+                const int64_t base = (i * N[1] + r) * N[2] + c;
+                for(int64_t x = 0; x < len; ++x){
+                    prefix[x + 1] = prefix[x] + v[base + x * stride];
+                }
+                for(int64_t x = 0; x < len; ++x){
+                    const auto lo = std::clamp<int64_t>(x - d, 0, len);
+                    const auto hi = std::clamp<int64_t>(x - d + K, 0, len);
+                    v[base + x * stride] = (lo < hi) ? (prefix[hi] - prefix[lo]) : 0.0;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void
+box_sum_3d(std::vector<double> &v,
+           const std::array<int64_t, 3> &N,
+           const std::array<int64_t, 3> &K,
+           const std::array<int64_t, 3> &d){
+    for(size_t axis = 0; axis < 3; ++axis){
+        box_sum_axis(v, N, axis, K[axis], d[axis]);
+    }
+    return;
+}
+
+void
+validate_inputs(const conv_volume &vol, const conv_volume &kernel){
+    for(const auto *v : { &vol, &kernel }){
+        if( (v->images < 1) || (v->rows < 1) || (v->cols < 1)
+        ||  (v->data.size() != static_cast<size_t>(product(v->dims()))) ){
+            throw std::invalid_argument("Volume is empty or inconsistent. Cannot continue.");
+        }
+    }
+    return;
+}
+
+int64_t
+thread_count(const ConvolveVolumeParams &params){
+    if(0 < params.threads) return params.threads;
+    return std::max<int64_t>(1, static_cast<int64_t>(std::thread::hardware_concurrency()));
+}
+
+} // namespace
+
+
+double Estimate_Direct_Convolution_Cost(const std::array<int64_t, 3> &/*volume_dims*/,
+                                        const std::array<int64_t, 3> &kernel_dims,
+                                        int64_t N_evaluated){
+    // Each kernel voxel requires a bounds check, a voxel look-up, and a multiply-add, which is roughly twice the cost
+    // of a single butterfly.
+    return 2.0 * static_cast<double>(N_evaluated) * static_cast<double>(product(kernel_dims));
+}
+
+double Estimate_FFT_Convolution_Cost(const std::array<int64_t, 3> &volume_dims,
+                                     const std::array<int64_t, 3> &kernel_dims,
+                                     const ConvolveVolumeParams &params){
+    const auto l = choose_block_layout(volume_dims, kernel_dims, params.max_block_voxels);
+
+    // The volume is also visited a handful of times to assemble the outgoing voxels and determine validity.
+    return l.cost + 8.0 * static_cast<double>(product(volume_dims));
+}
+
+bool Prefer_FFT_Convolution(const std::array<int64_t, 3> &volume_dims,
+                            const std::array<int64_t, 3> &kernel_dims,
+                            int64_t N_evaluated,
+                            const ConvolveVolumeParams &params){
+    return Estimate_FFT_Convolution_Cost(volume_dims, kernel_dims, params)
+         < Estimate_Direct_Convolution_Cost(volume_dims, kernel_dims, N_evaluated);
+}
+
+
+conv_volume Convolve_Volume_Direct(const conv_volume &vol,
+                                   const conv_volume &kernel,
+                                   const ConvolveVolumeParams &params){
+    validate_inputs(vol, kernel);
+
+    const auto nan = std::numeric_limits<float>::quiet_NaN();
+    const bool is_conv = (params.operation == ConvolveVolumeParams::Operation::Convolution);
+    const bool is_mtch = (params.operation == ConvolveVolumeParams::Operation::PatternMatch);
+    const auto s = is_conv ? -1L : 1L;
+    const auto &d = params.kernel_centre;
+
+    conv_volume out(vol.images, vol.rows, vol.cols, nan);
+    {
+        work_queue<std::function<void(void)>> wq(static_cast<unsigned int>(thread_count(params)));
+        for(int64_t i = 0; i < vol.images; ++i){
+            wq.submit_task([&,i]() -> void {
+                for(int64_t r = 0; r < vol.rows; ++r){
+                    for(int64_t c = 0; c < vol.cols; ++c){
+                        double acc = 0.0;
+                        bool valid = true;
+                        for(int64_t ki = 0; valid && (ki < kernel.images); ++ki){
+                            const auto l_i = i + s * (ki - d[0]);
+                            for(int64_t kr = 0; valid && (kr < kernel.rows); ++kr){
+                                const auto l_r = r + s * (kr - d[1]);
+                                for(int64_t kc = 0; kc < kernel.cols; ++kc){
+                                    const auto l_c = c + s * (kc - d[2]);
+                                    if( (l_i < 0) || (vol.images <= l_i)
+                                    ||  (l_r < 0) || (vol.rows <= l_r)
+                                    ||  (l_c < 0) || (vol.cols <= l_c) ){
+                                        valid = false;
+                                        break;
+                                    }
+                                    const double k = kernel.data[kernel.index(ki, kr, kc)];
+                                    const double v = vol.data[vol.index(l_i, l_r, l_c)];
+                                    acc += is_mtch ? (v - k) * (v - k) : k * v;
+                                }
+                            }
+                        }
+                        if(valid){
+                            out.data[out.index(i, r, c)] = static_cast<float>(is_mtch ? std::sqrt(acc) : acc);
+                        }
+                    }
+                }
+            });
+        }
+    }
+    return out;
+}
+
+
+conv_volume Convolve_Volume_FFT(const conv_volume &vol,
+                                const conv_volume &kernel,
+                                const ConvolveVolumeParams &params){
+    validate_inputs(vol, kernel);
+
+    const auto nan = std::numeric_limits<float>::quiet_NaN();
+    const bool is_conv = (params.operation == ConvolveVolumeParams::Operation::Convolution);
+    const bool is_mtch = (params.operation == ConvolveVolumeParams::Operation::PatternMatch);
+
+    // Express the operation as a correlation. Convolution is a correlation with the spatially-inverted kernel, which
+    // moves the kernel centre to the mirrored voxel.
+    conv_volume g = kernel;
+    auto d = params.kernel_centre;
+    if(is_conv){
+        for(int64_t i = 0; i < kernel.images; ++i){
+            for(int64_t r = 0; r < kernel.rows; ++r){
+                for(int64_t c = 0; c < kernel.cols; ++c){
+                    g.data[g.index(kernel.images - 1 - i, kernel.rows - 1 - r, kernel.cols - 1 - c)]
+                        = kernel.data[kernel.index(i, r, c)];
+                }
+            }
+        }
+        const auto K = kernel.dims();
+        for(size_t a = 0; a < 3; ++a) d[a] = K[a] - 1 - d[a];
+    }
+
+    const auto N = vol.dims();
+    const auto K = g.dims();
+    conv_volume out(vol.images, vol.rows, vol.cols, nan);
+    for(size_t a = 0; a < 3; ++a){
+        if(N[a] < K[a]) return out; // The kernel footprint never fits within the volume.
+    }
+
+    const auto l = choose_block_layout(N, K, params.max_block_voxels);
+    const auto &B = l.block;
+    const auto B_n = product(B);
+    YLOGINFO("Applying kernel using " << product(l.count) << " FFT blocks of "
+             << B[0] << "x" << B[1] << "x" << B[2] << " voxels");
+
+    const std::array<fft_plan, 3> plans = {{ fft_plan(B[0]), fft_plan(B[1]), fft_plan(B[2]) }};
+
+    // Pre-compute the (conjugated and normalized) kernel spectrum, which is shared by all blocks.
+    std::vector<std::complex<double>> G(B_n, std::complex<double>(0.0, 0.0));
+    {
+        std::vector<std::complex<double>> scratch;
+        for(int64_t i = 0; i < K[0]; ++i){
+            for(int64_t r = 0; r < K[1]; ++r){
+                for(int64_t c = 0; c < K[2]; ++c){
+                    G[(i * B[1] + r) * B[2] + c] = g.data[g.index(i, r, c)];
+                }
+            }
+        }
+        fft_3d(G, B, plans, false, scratch);
+        const double norm = 1.0 / static_cast<double>(B_n);
+        for(auto &z : G) z = std::conj(z) * norm;
+    }
+
+    // Pattern-matching requires more precision for the correlation than the outgoing voxels provide.
+    std::vector<double> corr;
+    if(is_mtch) corr.resize(vol.data.size(), 0.0);
+
+    const int64_t N_blocks = product(l.count);
+    const auto block_origin = [&](int64_t n) -> std::array<int64_t, 3> {
+        const auto c = n % l.count[2];
+        const auto r = (n / l.count[2]) % l.count[1];
+        const auto i = n / (l.count[2] * l.count[1]);
+        return {{ i * l.valid[0], r * l.valid[1], c * l.valid[2] }};
+    };
+
+    {
+        work_queue<std::function<void(void)>> wq(static_cast<unsigned int>(thread_count(params)));
+        for(int64_t n = 0; n < N_blocks; n += 2){
+            wq.submit_task([&,n]() -> void {
+                std::vector<std::complex<double>> buf(B_n, std::complex<double>(0.0, 0.0));
+                std::vector<std::complex<double>> scratch;
+
+                // Pack two real-valued blocks into the real and imaginary parts. Since the kernel is real, the
+                // correlations of both blocks can be recovered from the real and imaginary parts of the result.
+                const int64_t n_pair = std::min<int64_t>(2, N_blocks - n);
+                std::array<std::array<int64_t, 3>, 2> origins;
+                for(int64_t p = 0; p < n_pair; ++p){
+                    origins[p] = block_origin(n + p);
+                    const auto &o = origins[p];
+                    for(int64_t i = 0; i < B[0]; ++i){
+                        const auto l_i = o[0] - d[0] + i;
+                        if( (l_i < 0) || (N[0] <= l_i) ) continue;
+                        for(int64_t r = 0; r < B[1]; ++r){
+                            const auto l_r = o[1] - d[1] + r;
+                            if( (l_r < 0) || (N[1] <= l_r) ) continue;
+                            const auto c_lo = std::max<int64_t>(0, d[2] - o[2]);
+                            const auto c_hi = std::min<int64_t>(B[2], N[2] - o[2] + d[2]);
+                            auto *b = &buf[(i * B[1] + r) * B[2]];
+                            const auto *v = &vol.data[vol.index(l_i, l_r, 0)];
+                            for(int64_t c = c_lo; c < c_hi; ++c){
+                                const double x = v[o[2] - d[2] + c];
+                                if(!std::isfinite(x)) continue; // Handled separately.
+                                if(p == 0){
+                                    b[c].real(x);
+                                }else{
+                                    b[c].imag(x);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                fft_3d(buf, B, plans, false, scratch);
+                for(int64_t k = 0; k < B_n; ++k) buf[k] *= G[k];
+                fft_3d(buf, B, plans, true, scratch);
+
+                // Outgoing voxels at the start of each block are free of circular wrap-around.
+                for(int64_t p = 0; p < n_pair; ++p){
+                    const auto &o = origins[p];
+                    for(int64_t i = 0; (i < l.valid[0]) && (o[0] + i < N[0]); ++i){
+                        for(int64_t r = 0; (r < l.valid[1]) && (o[1] + r < N[1]); ++r){
+                            const auto c_hi = std::min<int64_t>(l.valid[2], N[2] - o[2]);
+                            const auto *b = &buf[(i * B[1] + r) * B[2]];
+                            const auto idx = vol.index(o[0] + i, o[1] + r, o[2]);
+                            for(int64_t c = 0; c < c_hi; ++c){
+                                const double x = (p == 0) ? b[c].real() : b[c].imag();
+                                if(is_mtch){
+                                    corr[idx + c] = x;
+                                }else{
+                                    out.data[idx + c] = static_cast<float>(x);
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    // Identify outgoing voxels whose kernel footprint includes a non-finite voxel.
+    std::vector<double> nonfinite;
+    if(std::any_of(std::begin(vol.data), std::end(vol.data), [](float x){ return !std::isfinite(x); })){
+        nonfinite.resize(vol.data.size());
+        std::transform(std::begin(vol.data), std::end(vol.data), std::begin(nonfinite),
+                       [](float x){ return std::isfinite(x) ? 0.0 : 1.0; });
+        box_sum_3d(nonfinite, N, K, d);
+    }
+
+    // Pattern-matching expands the Euclidean distance as sum(I^2) - 2 sum(I*K) + sum(K^2).
+    std::vector<double> sq;
+    double k_sq = 0.0;
+    if(is_mtch){
+        sq.resize(vol.data.size());
+        std::transform(std::begin(vol.data), std::end(vol.data), std::begin(sq),
+                       [](float x){ return std::isfinite(x) ? static_cast<double>(x) * x : 0.0; });
+        box_sum_3d(sq, N, K, d);
+        for(const auto &x : g.data) k_sq += static_cast<double>(x) * x;
+    }
+
+    for(int64_t i = 0; i < N[0]; ++i){
+        const bool i_valid = (d[0] <= i) && (i <= N[0] - K[0] + d[0]);
+        for(int64_t r = 0; r < N[1]; ++r){
+            const bool r_valid = (d[1] <= r) && (r <= N[1] - K[1] + d[1]);
+            for(int64_t c = 0; c < N[2]; ++c){
+                const bool c_valid = (d[2] <= c) && (c <= N[2] - K[2] + d[2]);
+                const auto idx = out.index(i, r, c);
+                if( !(i_valid && r_valid && c_valid)
+                ||  (!nonfinite.empty() && (0.5 < nonfinite[idx])) ){
+                    out.data[idx] = nan;
+                }else if(is_mtch){
+                    out.data[idx] = static_cast<float>(std::sqrt(std::max(0.0, sq[idx] - 2.0 * corr[idx] + k_sq)));
+                }
+            }
+        }
+    }
+    return out;
+}
+
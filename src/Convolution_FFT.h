@@ -0,0 +1,110 @@
+//Convolution_FFT.h - A part of DICOMautomaton 2026. Written by hal clark.
+
+#pragma once
+
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+
+// A dense, regularly-sampled 3D scalar volume in voxel-number space.
+//
+// Voxels are stored with columns varying fastest, then rows, then images.
+struct conv_volume {
+    int64_t images = 0;
+    int64_t rows = 0;
+    int64_t cols = 0;
+    std::vector<float> data;
+
+    conv_volume() = default;
+    conv_volume(int64_t images, int64_t rows, int64_t cols, float fill = 0.0f);
+
+    size_t index(int64_t i, int64_t r, int64_t c) const {
+        return static_cast<size_t>((i * rows + r) * cols + c);
+    }
+    std::array<int64_t, 3> dims() const {
+        return {{ images, rows, cols }};
+    }
+};
+
+
+// Parameters for applying a kernel to a volume.
+//
+// The semantics mirror the ConvolveImages operation. The kernel voxel at (image, row, column) = j is paired with the
+// volume voxel at x + (j - kernel_centre) for correlation and pattern-matching, and x - (j - kernel_centre) for
+// convolution. Outgoing voxels whose kernel footprint extends beyond the volume or includes a non-finite voxel are
+// set to NaN.
+struct ConvolveVolumeParams {
+    enum class Operation {
+        Convolution,   // Inner product with the spatially-inverted kernel.
+        Correlation,   // Inner product with the kernel as-is.
+        PatternMatch,  // Euclidean distance between the kernel and the voxel neighbourhood.
+    } operation = Operation::Convolution;
+
+    // The kernel voxel that is applied to the outgoing voxel, ordered like (image, row, column).
+    std::array<int64_t, 3> kernel_centre = {{ 0, 0, 0 }};
+
+    // An upper bound on the number of voxels in a single FFT block. Blocks are processed concurrently, with one
+    // complex buffer of this size (or smaller) per thread.
+    int64_t max_block_voxels = (1L << 21);
+
+    // The number of threads to use. Zero selects the hardware concurrency.
+    int64_t threads = 0;
+};
+
+
+// A reusable, in-place, radix-2 complex FFT for a fixed power-of-two length.
+class fft_plan {
+  private:
+    int64_t n = 0;
+    std::vector<std::complex<double>> twiddles;
+    std::vector<int64_t> bit_reversal;
+
+  public:
+    explicit fft_plan(int64_t n);
+
+    int64_t size() const { return n; }
+
+    // Transform 'n' elements separated by 'stride'. The inverse transform is not normalized.
+    void execute(std::complex<double> *x, bool inverse) const;
+    void execute(std::complex<double> *x, int64_t stride, bool inverse, std::vector<std::complex<double>> &scratch) const;
+};
+
+// Returns the smallest power of two that is >= n.
+int64_t FFT_Next_Power_Of_Two(int64_t n);
+
+
+// Estimated relative costs of the direct summation and blocked FFT approaches. These are heuristics used to select
+// an engine automatically, and are not meaningful in absolute terms.
+//
+// 'N_evaluated' is the number of outgoing voxels that will be computed, which can be fewer than the number of voxels
+// in the volume when the direct approach is restricted to an ROI.
+double Estimate_Direct_Convolution_Cost(const std::array<int64_t, 3> &volume_dims,
+                                        const std::array<int64_t, 3> &kernel_dims,
+                                        int64_t N_evaluated);
+
+double Estimate_FFT_Convolution_Cost(const std::array<int64_t, 3> &volume_dims,
+                                     const std::array<int64_t, 3> &kernel_dims,
+                                     const ConvolveVolumeParams &params);
+
+bool Prefer_FFT_Convolution(const std::array<int64_t, 3> &volume_dims,
+                            const std::array<int64_t, 3> &kernel_dims,
+                            int64_t N_evaluated,
+                            const ConvolveVolumeParams &params);
+
+
+// Apply a kernel to every voxel of a volume by direct summation.
+conv_volume Convolve_Volume_Direct(const conv_volume &vol,
+                                   const conv_volume &kernel,
+                                   const ConvolveVolumeParams &params);
+
+// Apply a kernel to every voxel of a volume using overlap-save blocks of zero-padded 3D FFTs.
+//
+// Two real-valued blocks are packed into the real and imaginary parts of each complex transform, so every transform
+// pair produces two blocks of outgoing voxels. Results agree with Convolve_Volume_Direct() up to floating-point
+// round-off, though pattern-matching costs near zero are subject to cancellation.
+conv_volume Convolve_Volume_FFT(const conv_volume &vol,
+                                const conv_volume &kernel,
+                                const ConvolveVolumeParams &params);
+
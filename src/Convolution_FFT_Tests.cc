@@ -0,0 +1,171 @@
+//Convolution_FFT_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the FFT-based convolution routines defined in Convolution_FFT.cc.
+// Tests are separated into their own file because Convolution_FFT_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "Convolution_FFT.h"
+
+
+static
+conv_volume
+random_volume(int64_t images, int64_t rows, int64_t cols, std::mt19937 &re){
+    std::uniform_real_distribution<float> rd(-10.0f, 10.0f);
+    conv_volume v(images, rows, cols);
+    for(auto &x : v.data) x = rd(re);
+    return v;
+}
+
+// Returns the largest absolute difference, requiring both volumes to have NaNs in the same places.
+static
+double
+max_abs_difference(const conv_volume &a, const conv_volume &b){
+    REQUIRE(a.data.size() == b.data.size());
+    double diff = 0.0;
+    int64_t nan_mismatches = 0;
+    for(size_t i = 0; i < a.data.size(); ++i){
+        if(std::isnan(a.data[i]) != std::isnan(b.data[i])){
+            ++nan_mismatches;
+        }else if(!std::isnan(a.data[i])){
+            diff = std::max(diff, static_cast<double>(std::abs(a.data[i] - b.data[i])));
+        }
+    }
+    REQUIRE(nan_mismatches == 0);
+    return diff;
+}
+
+
+TEST_CASE("fft_plan"){
+    std::mt19937 re(12345);
+    std::uniform_real_distribution<double> rd(-1.0, 1.0);
+
+    REQUIRE_THROWS(fft_plan(12));
+    REQUIRE(FFT_Next_Power_Of_Two(1) == 1);
+    REQUIRE(FFT_Next_Power_Of_Two(17) == 32);
+
+    for(const int64_t n : { 1, 2, 8, 64 }){
+        fft_plan plan(n);
+        std::vector<std::complex<double>> x(n);
+        for(auto &z : x) z = std::complex<double>(rd(re), rd(re));
+
+        // Compare with a naive DFT.
+        const double pi = std::acos(-1.0);
+        std::vector<std::complex<double>> X(n);
+        for(int64_t k = 0; k < n; ++k){
+            for(int64_t j = 0; j < n; ++j){
+                X[k] += x[j] * std::polar(1.0, -2.0 * pi * static_cast<double>(j * k) / static_cast<double>(n));
+            }
+        }
+        auto y = x;
+        plan.execute(y.data(), false);
+        for(int64_t k = 0; k < n; ++k) REQUIRE(std::abs(y[k] - X[k]) < 1E-9);
+
+        plan.execute(y.data(), true);
+        for(int64_t k = 0; k < n; ++k) REQUIRE(std::abs(y[k] / static_cast<double>(n) - x[k]) < 1E-12);
+    }
+}
+
+TEST_CASE("Convolve_Volume_FFT agrees with direct summation"){
+    std::mt19937 re(314159);
+
+    const auto vol = random_volume(9, 23, 17, re);
+    using op_t = ConvolveVolumeParams::Operation;
+    for(const auto op : { op_t::Convolution, op_t::Correlation, op_t::PatternMatch }){
+        for(const auto &kdims : { std::array<int64_t,3>{{ 1, 1, 1 }},
+                                  std::array<int64_t,3>{{ 1, 3, 3 }},
+                                  std::array<int64_t,3>{{ 3, 4, 5 }},
+                                  std::array<int64_t,3>{{ 5, 7, 2 }} }){
+            const auto kernel = random_volume(kdims[0], kdims[1], kdims[2], re);
+
+            ConvolveVolumeParams p;
+            p.operation = op;
+            p.kernel_centre = {{ kdims[0] / 2, kdims[1] / 2, kdims[2] / 2 }};
+            p.max_block_voxels = 16 * 16 * 16; // Force several blocks.
+
+            const auto direct = Convolve_Volume_Direct(vol, kernel, p);
+            const auto fft = Convolve_Volume_FFT(vol, kernel, p);
+            const double tol = (op == op_t::PatternMatch) ? 1E-2 : 1E-3;
+            REQUIRE(max_abs_difference(direct, fft) < tol);
+
+            // The border is undefined.
+            REQUIRE(std::isnan(fft.data[fft.index(0, 0, 0)]) == (1 < kernel.data.size()));
+            REQUIRE(std::isfinite(fft.data[fft.index(4, 11, 8)]));
+        }
+    }
+
+    SUBCASE("non-finite voxels invalidate the surrounding neighbourhood"){
+        auto v = vol;
+        v.data[v.index(4, 10, 8)] = std::numeric_limits<float>::quiet_NaN();
+        const auto kernel = random_volume(3, 3, 3, re);
+        ConvolveVolumeParams p;
+        p.operation = ConvolveVolumeParams::Operation::Correlation;
+        p.kernel_centre = {{ 1, 1, 1 }};
+
+        const auto direct = Convolve_Volume_Direct(v, kernel, p);
+        const auto fft = Convolve_Volume_FFT(v, kernel, p);
+        REQUIRE(max_abs_difference(direct, fft) < 1E-3);
+        REQUIRE(std::isnan(fft.data[fft.index(5, 11, 9)]));
+        REQUIRE(std::isfinite(fft.data[fft.index(5, 12, 9)]));
+    }
+
+    SUBCASE("exact pattern matches have zero cost"){
+        conv_volume kernel(3, 5, 5);
+        for(int64_t i = 0; i < 3; ++i){
+            for(int64_t r = 0; r < 5; ++r){
+                for(int64_t c = 0; c < 5; ++c){
+                    kernel.data[kernel.index(i, r, c)] = vol.data[vol.index(3 + i, 8 + r, 6 + c)];
+                }
+            }
+        }
+        ConvolveVolumeParams p;
+        p.operation = ConvolveVolumeParams::Operation::PatternMatch;
+        p.kernel_centre = {{ 1, 2, 2 }};
+        const auto fft = Convolve_Volume_FFT(vol, kernel, p);
+        REQUIRE(fft.data[fft.index(4, 10, 8)] < 1E-2);
+        REQUIRE(1.0 < fft.data[fft.index(4, 10, 9)]);
+    }
+}
+
+TEST_CASE("Convolve_Volume_FFT benchmark"){
+    // Sweep kernel sizes over a moderately-sized volume, comparing against direct summation and reporting the engine
+    // that would be selected automatically.
+    std::mt19937 re(271828);
+    const auto vol = random_volume(24, 64, 64, re);
+
+    const auto ms = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count() / 1000.0;
+    };
+    for(const int64_t k : { 1, 2, 3, 5, 9, 15 }){
+        const auto kernel = random_volume(k, k, k, re);
+        ConvolveVolumeParams p;
+        p.operation = ConvolveVolumeParams::Operation::Convolution;
+        p.kernel_centre = {{ k / 2, k / 2, k / 2 }};
+
+        const auto t_start = std::chrono::steady_clock::now();
+        const auto direct = Convolve_Volume_Direct(vol, kernel, p);
+        const auto t_direct = std::chrono::steady_clock::now();
+        const auto fft = Convolve_Volume_FFT(vol, kernel, p);
+        const auto t_fft = std::chrono::steady_clock::now();
+
+        const bool prefer_fft = Prefer_FFT_Convolution(vol.dims(), kernel.dims(),
+                                                       static_cast<int64_t>(vol.data.size()), p);
+        MESSAGE("Kernel " << k << "^3 on " << vol.images << "x" << vol.rows << "x" << vol.cols << ":"
+                << " direct " << ms(t_start, t_direct) << " ms,"
+                << " FFT " << ms(t_direct, t_fft) << " ms,"
+                << " automatic selection: " << std::string(prefer_fft ? "FFT" : "direct"));
+        REQUIRE(max_abs_difference(direct, fft) < 1E-2);
+    }
+}
+
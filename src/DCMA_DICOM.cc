@@ -21,6 +21,18 @@
 #include <cstring>
 #include <stdexcept>
 #include <cctype>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <fcntl.h>        //Needed for open().
+    #include <sys/mman.h>     //Needed for mmap().
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 #include "YgorMisc.h"
 #include "YgorLog.h"
@@ -1707,7 +1719,8 @@ DCMA_DICOM::Node read_data_element(std::istream &is,
 
 void Node::read_DICOM(std::istream &is,
                       const std::vector<const DICOMDictionary*> &dicts,
-                      DICOMDictionary *mutable_dict){
+                      DICOMDictionary *mutable_dict,
+                      std::optional<std::pair<uint16_t, uint16_t>> stop_before){
     verify_little_endian();
 
     // Initialize this node as root.
@@ -1769,12 +1782,447 @@ void Node::read_DICOM(std::istream &is,
 
     // Parse remaining data elements using the determined encoding.
     while(is.good() && (is.peek() != std::char_traits<char>::eof())){
+        if(stop_before){
+            // Top-level elements are stored in ascending tag order, so everything after this point can be skipped.
+            auto pos = is.tellg();
+            uint16_t g = read_uint16_le(is);
+            uint16_t e = read_uint16_le(is);
+            is.seekg(pos);
+            if(stop_before.value() <= std::make_pair(g, e)) break;
+        }
+
         auto node = read_data_element(is, data_enc, dicts, mutable_dict);
         this->children.push_back(std::move(node));
     }
 }
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Zero-copy reading.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Bounds-checked little-endian reader over an in-memory byte span.
+struct span_reader {
+    std::string_view b;
+    size_t pos = 0;
+
+    bool at_end() const {
+        return (b.size() <= pos);
+    }
+
+    std::string_view take(size_t count){
+        if((b.size() - pos) < count){
+            throw std::runtime_error("Unexpected end of DICOM buffer while reading "_s
+                                     + std::to_string(count) + " bytes.");
+        }
+        const auto out = b.substr(pos, count);
+        pos += count;
+        return out;
+    }
+
+    uint16_t u16(){
+        uint16_t val = 0;
+        std::memcpy(&val, this->take(2).data(), 2);
+        return val;
+    }
+
+    uint32_t u32(){
+        uint32_t val = 0;
+        std::memcpy(&val, this->take(4).data(), 4);
+        return val;
+    }
+
+    std::pair<uint16_t, uint16_t> peek_tag() const {
+        span_reader r = *this;
+        const uint16_t g = r.u16();
+        const uint16_t e = r.u16();
+        return { g, e };
+    }
+};
+
+// Parsing state shared by the zero-copy reader routines.
+struct view_context {
+    DCMA_DICOM::Encoding enc;
+    const std::vector<const DCMA_DICOM::DICOMDictionary*> &dicts;
+    DCMA_DICOM::DICOMDictionary *mutable_dict;
+    std::vector<DCMA_DICOM::NodeView> &nodes;
+};
+
+// Forward declarations.
+void view_read_data_element(span_reader &r, view_context &ctx);
+void view_skip_data_element(span_reader &r, view_context &ctx);
+
+// Append a placeholder node and return its index. The 'end' member is set once all descendants have been appended.
+size_t view_open_node(std::vector<DCMA_DICOM::NodeView> &nodes,
+                      uint16_t group,
+                      uint16_t tag,
+                      uint32_t element,
+                      const std::string &vr){
+    if(std::numeric_limits<uint32_t>::max() <= nodes.size()){
+        throw std::runtime_error("Too many DICOM elements to index.");
+    }
+    nodes.emplace_back();
+    nodes.back().key.group = group;
+    nodes.back().key.tag = tag;
+    nodes.back().key.element = element;
+    nodes.back().VR = vr;
+    return nodes.size() - 1;
+}
+
+void view_close_node(std::vector<DCMA_DICOM::NodeView> &nodes, size_t i){
+    nodes[i].end = static_cast<uint32_t>(nodes.size());
+}
+
+// Read (or skip) the elements of a single sequence item. The item tag and length have already been consumed.
+void view_read_item_contents(span_reader &r,
+                             view_context &ctx,
+                             uint32_t item_length,
+                             bool skip){
+    const auto element_f = (skip) ? view_skip_data_element : view_read_data_element;
+    if(item_length == 0xFFFFFFFF){
+        while(!r.at_end()){
+            const auto [g, e] = r.peek_tag();
+            if(g == 0xFFFE && e == 0xE00D){
+                r.u16();
+                r.u16();
+                const uint32_t delim_len = r.u32();
+                if(delim_len != 0){
+                    YLOGWARN("Item delimiter length is non-zero (" << delim_len << "), expected 0");
+                }
+                break;
+            }
+            element_f(r, ctx);
+        }
+    }else if(skip){
+        r.take(item_length);
+    }else{
+        const auto item_start = r.pos;
+        while(!r.at_end() && ((r.pos - item_start) < item_length)){
+            element_f(r, ctx);
+        }
+    }
+}
+
+void view_read_sequence_items(span_reader &r,
+                              view_context &ctx,
+                              uint32_t seq_length,
+                              bool skip){
+    const bool defined = (seq_length != 0xFFFFFFFF);
+    if(defined && skip){
+        r.take(seq_length);
+        return;
+    }
+
+    const auto seq_start = r.pos;
+    uint32_t item_number = 0;
+    while(!r.at_end()){
+        if(defined && (seq_length <= (r.pos - seq_start))) break;
+
+        const uint16_t g = r.u16();
+        const uint16_t e = r.u16();
+        const uint32_t item_length = r.u32();
+
+        if(g == 0xFFFE && e == 0xE000){
+            if(skip){
+                view_read_item_contents(r, ctx, item_length, skip);
+            }else{
+                const auto i = view_open_node(ctx.nodes, 0xFFFE, 0xE000, item_number, "MULTI");
+                view_read_item_contents(r, ctx, item_length, skip);
+                view_close_node(ctx.nodes, i);
+            }
+            ++item_number;
+        }else if(g == 0xFFFE && e == 0xE0DD){
+            break; // Sequence delimiter.
+        }else{
+            throw std::runtime_error("Expected item tag (FFFE,E000) or sequence delimiter in sequence, got ("
+                                     + std::to_string(g) + "," + std::to_string(e) + ").");
+        }
+    }
+}
+
+// Encapsulated fragments are retained individually (the first is the basic offset table) rather than concatenated.
+void view_read_encapsulated_data(span_reader &r,
+                                 view_context &ctx,
+                                 bool skip){
+    uint32_t fragment_number = 0;
+    while(!r.at_end()){
+        const uint16_t g = r.u16();
+        const uint16_t e = r.u16();
+        const uint32_t frag_length = r.u32();
+
+        if(g == 0xFFFE && e == 0xE000){
+            const auto frag = r.take(frag_length);
+            if(!skip){
+                const auto i = view_open_node(ctx.nodes, 0xFFFE, 0xE000, fragment_number, "OB");
+                ctx.nodes[i].raw = frag;
+                view_close_node(ctx.nodes, i);
+            }
+            ++fragment_number;
+        }else if(g == 0xFFFE && e == 0xE0DD){
+            break; // Sequence delimiter.
+        }else{
+            throw std::runtime_error("Unexpected tag in encapsulated pixel data.");
+        }
+    }
+}
+
+// Read an element header, returning the tag, VR, and value length.
+std::tuple<uint16_t, uint16_t, std::string, uint32_t>
+view_read_element_header(span_reader &r, view_context &ctx){
+    const uint16_t group = r.u16();
+    const uint16_t tag   = r.u16();
+
+    std::string vr;
+    uint32_t length = 0;
+    if(ctx.enc == DCMA_DICOM::Encoding::ELE){
+        vr = std::string(r.take(2));
+        if(vr_has_extended_length(vr)){
+            [[maybe_unused]] const uint16_t reserved = r.u16();
+            length = r.u32();
+        }else{
+            length = static_cast<uint32_t>(r.u16());
+        }
+    }else if(ctx.enc == DCMA_DICOM::Encoding::ILE){
+        length = r.u32();
+        vr = DCMA_DICOM::lookup_VR(group, tag, ctx.dicts);
+        if(vr.empty()) vr = "UN";
+    }else{
+        throw std::runtime_error("Unsupported encoding for DICOM reading.");
+    }
+    return { group, tag, vr, length };
+}
+
+// Handle the value of an element, recording nodes unless skipping. The header has already been consumed.
+void view_read_element_value(span_reader &r,
+                             view_context &ctx,
+                             uint16_t group,
+                             uint16_t tag,
+                             const std::string &vr,
+                             uint32_t length,
+                             bool skip){
+    const bool is_pixel_data_tag = (group == static_cast<uint16_t>(0x7FE0u))
+                                && (tag   == static_cast<uint16_t>(0x0010u));
+
+    if( (vr == "SQ")
+    ||  ( (length == 0xFFFFFFFF) && skip && !is_pixel_data_tag ) ){
+        // When skipping an undefined-length element with an unknown VR, a sequence is the only valid possibility.
+        view_read_sequence_items(r, ctx, length, skip);
+
+    }else if(length == 0xFFFFFFFF){
+        const bool vr_allows_encapsulation = (vr == "OB" || vr == "OW" || vr == "UN");
+        if(!is_pixel_data_tag || !vr_allows_encapsulation){
+            throw std::runtime_error(
+                "Unsupported undefined-length non-sequence DICOM element: "
+                "only PixelData (7FE0,0010) with VR OB/OW/UN may be encapsulated.");
+        }
+        if(!skip) ctx.nodes.back().encapsulated = true;
+        view_read_encapsulated_data(r, ctx, skip);
+
+    }else{
+        const auto raw = r.take(length);
+        if(!skip) ctx.nodes.back().raw = raw;
+    }
+}
+
+void view_read_data_element(span_reader &r, view_context &ctx){
+    const auto [group, tag, vr, length] = view_read_element_header(r, ctx);
+
+    if( (ctx.enc == DCMA_DICOM::Encoding::ELE)
+    &&  (ctx.mutable_dict != nullptr) ){
+        const std::string expected_vr = DCMA_DICOM::lookup_VR(group, tag, ctx.dicts);
+        if(expected_vr.empty() || expected_vr != vr){
+            (*ctx.mutable_dict)[ DCMA_DICOM::dict_key_t{group, tag} ] = {vr, ""};
+        }
+    }
+
+    const auto i = view_open_node(ctx.nodes, group, tag, 0, vr);
+    view_read_element_value(r, ctx, group, tag, vr, length, false);
+    view_close_node(ctx.nodes, i);
+}
+
+// Advance past an element without recording anything. Values with a defined length are never touched.
+void view_skip_data_element(span_reader &r, view_context &ctx){
+    const auto [group, tag, vr, length] = view_read_element_header(r, ctx);
+    view_read_element_value(r, ctx, group, tag, vr, length, true);
+}
+
+// Map a file into memory. Returns the owner (which unmaps on destruction) and the mapped bytes.
+//
+// Falls back to reading the whole file into a single buffer where memory mapping is unavailable.
+std::pair<std::shared_ptr<const void>, std::string_view>
+map_file(const std::filesystem::path &p){
+#if !defined(_WIN32) && !defined(_WIN64)
+    const int fd = ::open(p.c_str(), O_RDONLY);
+    if(fd < 0) throw std::runtime_error("Unable to open '"_s + p.string() + "' for reading.");
+
+    struct stat sb;
+    if( (::fstat(fd, &sb) != 0)
+    ||  (sb.st_size <= 0) ){
+        ::close(fd);
+        throw std::runtime_error("Unable to map '"_s + p.string() + "': file is empty or inaccessible.");
+    }
+    const auto size = static_cast<size_t>(sb.st_size);
+    void *addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(addr == MAP_FAILED){
+        throw std::runtime_error("Unable to map '"_s + p.string() + "' into memory.");
+    }
+    std::shared_ptr<const void> owner(addr, [size](const void *a){ ::munmap(const_cast<void*>(a), size); });
+    return { owner, std::string_view(static_cast<const char*>(addr), size) };
+#else
+    std::ifstream ifs(p, std::ios::in | std::ios::binary);
+    if(!ifs) throw std::runtime_error("Unable to open '"_s + p.string() + "' for reading.");
+    auto buf = std::make_shared<std::string>( std::istreambuf_iterator<char>(ifs),
+                                              std::istreambuf_iterator<char>() );
+    const std::string_view bytes(*buf);
+    return { std::shared_ptr<const void>(buf, buf.get()), bytes };
+#endif
+}
+
+} // anonymous namespace
+
+
+std::string NodeView::value() const {
+    if(vr_is_text(this->VR)){
+        return strip_text_padding(std::string(this->raw), this->VR);
+    }else if(this->VR == "US" || this->VR == "SS" || this->VR == "UL" || this->VR == "SL"
+          || this->VR == "FL" || this->VR == "FD" || this->VR == "AT"
+          || this->VR == "SV" || this->VR == "UV"){
+        return decode_binary_value(std::string(this->raw), this->VR);
+    }
+    return std::string(this->raw);
+}
+
+
+void TreeView::read_DICOM(const std::filesystem::path &p,
+                          const std::vector<const DICOMDictionary*> &dicts,
+                          const ReadOptions &opts){
+    auto [owner, bytes] = map_file(p);
+    this->storage = std::move(owner);
+    this->bytes = bytes;
+    this->parse(dicts, opts);
+}
+
+void TreeView::read_DICOM(std::shared_ptr<const std::string> buffer,
+                          const std::vector<const DICOMDictionary*> &dicts,
+                          const ReadOptions &opts){
+    if(buffer == nullptr) throw std::invalid_argument("No buffer provided.");
+    this->bytes = std::string_view(*buffer);
+    this->storage = std::move(buffer);
+    this->parse(dicts, opts);
+}
+
+void TreeView::parse(const std::vector<const DICOMDictionary*> &dicts,
+                     const ReadOptions &opts){
+    verify_little_endian();
+
+    this->nodes.clear();
+    view_open_node(this->nodes, 0, 0, 0, "SQ"); // The root.
+
+    span_reader r;
+    r.b = this->bytes;
+    r.take(128); // Preamble.
+    if(r.take(4) != "DICM"){
+        throw std::runtime_error("Not a valid DICOM Part 10 file (missing 'DICM' prefix).");
+    }
+
+    // Meta information group (0x0002), always Explicit VR Little Endian.
+    view_context ctx { Encoding::ELE, dicts, opts.mutable_dict, this->nodes };
+    while(!r.at_end() && (r.peek_tag().first == 0x0002)){
+        view_read_data_element(r, ctx);
+    }
+
+    {
+        const auto *ts_node = this->find(0x0002, 0x0010);
+        if(ts_node != nullptr){
+            std::string ts(ts_node->raw);
+            while(!ts.empty() && (ts.back() == '\0' || ts.back() == ' ')) ts.pop_back();
+
+            if(ts == "1.2.840.10008.1.2"){
+                ctx.enc = Encoding::ILE;
+            }else if(ts == "1.2.840.10008.1.2.2"){
+                throw std::runtime_error("Big-endian DICOM transfer syntax is not supported.");
+            }
+        }
+    }
+
+    // Top-level elements are stored in ascending tag order, so reading can halt as soon as a limit is passed.
+    while(!r.at_end()){
+        const auto key = r.peek_tag();
+        if( (opts.stop_before && (opts.stop_before.value() <= key))
+        ||  (opts.stop_after && (opts.stop_after.value() < key)) ){
+            break;
+        }
+
+        if(opts.skip_groups.count(key.first) != 0){
+            view_skip_data_element(r, ctx);
+        }else{
+            view_read_data_element(r, ctx);
+        }
+    }
+    view_close_node(this->nodes, 0);
+}
+
+void Node::read_DICOM(const std::filesystem::path &p,
+                      const std::vector<const DICOMDictionary*> &dicts,
+                      const ReadOptions &opts){
+    TreeView view;
+    view.read_DICOM(p, dicts, opts);
+    *this = view.to_Node();
+}
+
+std::vector<size_t> TreeView::children(size_t i) const {
+    std::vector<size_t> out;
+    const size_t end = this->nodes.at(i).end;
+    for(size_t c = i + 1; c < end; c = this->nodes[c].end){
+        out.push_back(c);
+    }
+    return out;
+}
+
+const NodeView* TreeView::find(uint16_t group, uint16_t tag) const {
+    // Nodes are stored in depth-first order, matching the traversal order of Node::find().
+    for(size_t i = 1; i < this->nodes.size(); ++i){
+        const auto &n = this->nodes[i];
+        if(n.key.group == group && n.key.tag == tag) return &n;
+    }
+    return nullptr;
+}
+
+std::list<const NodeView*> TreeView::find_all(uint16_t group, uint16_t tag) const {
+    std::list<const NodeView*> results;
+    for(size_t i = 1; i < this->nodes.size(); ++i){
+        const auto &n = this->nodes[i];
+        if(n.key.group == group && n.key.tag == tag) results.push_back(&n);
+    }
+    return results;
+}
+
+Node TreeView::to_Node(size_t i) const {
+    const auto &n = this->nodes.at(i);
+
+    Node out;
+    out.key = n.key;
+    out.VR = n.VR;
+    if(n.encapsulated){
+        // Match Node::read_DICOM(), which concatenates all fragments.
+        size_t total = 0;
+        for(const auto c : this->children(i)) total += this->nodes[c].raw.size();
+        out.val.reserve(total);
+        for(const auto c : this->children(i)) out.val.append(this->nodes[c].raw);
+        return out;
+    }
+
+    out.val = n.value();
+    for(const auto c : this->children(i)){
+        out.children.push_back(this->to_Node(c));
+    }
+    return out;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Tree search and modification utilities.
 ///////////////////////////////////////////////////////////////////////////////
@@ -3,11 +3,15 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <iosfwd>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <list>
 #include <functional>
 #include <map>
+#include <set>
 #include <vector>
 #include <utility>
 #include <optional>
@@ -35,6 +39,24 @@ struct NodeKey {
                           // The instance of the tag. (Modern DICOM prefers explicit sequences.)
 };
 
+// Options for reading DICOM files from memory-mapped files or buffers.
+struct ReadOptions {
+    // If provided, reading halts (without consuming it) at the first top-level element with
+    // (group, tag) greater than or equal to 'stop_before'.
+    std::optional<std::pair<uint16_t, uint16_t>> stop_before;
+
+    // If provided, reading halts after the top-level element with (group, tag) equal to 'stop_after'
+    // (or, if it is absent, where it would have been).
+    std::optional<std::pair<uint16_t, uint16_t>> stop_after;
+
+    // Top-level elements in these groups are skipped using their encoded lengths. Their values are
+    // never read, and no nodes are created for them.
+    std::set<uint16_t> skip_groups;
+
+    // If non-null, updated with VRs encountered in explicit-VR files (see Node::read_DICOM).
+    DICOMDictionary *mutable_dict = nullptr;
+};
+
 //////////////
 
 struct Node {
@@ -78,9 +100,20 @@ struct Node {
     // If 'mutable_dict' is non-null, it is updated with VRs encountered in
     // explicit-VR files: unknown tags are added, and different-than-expected VRs
     // are recorded. The mutable dictionary can be persisted via write_dictionary.
+    // If 'stop_before' is provided, reading halts (without consuming it) at the first
+    // top-level element with (group, tag) greater than or equal to 'stop_before'.
+    // This permits cheap header-only reads, e.g., by stopping at PixelData (7FE0,0010).
     void read_DICOM(std::istream &is,
                     const std::vector<const DICOMDictionary*> &dicts = {},
-                    DICOMDictionary *mutable_dict = nullptr);
+                    DICOMDictionary *mutable_dict = nullptr,
+                    std::optional<std::pair<uint16_t, uint16_t>> stop_before = {});
+
+    // Read a DICOM file via a memory-mapped TreeView (see below), populating this node as the root.
+    // The result is identical to the stream overload, but avoids per-element stream overhead and
+    // supports skipping groups and stopping after a given tag.
+    void read_DICOM(const std::filesystem::path &p,
+                    const std::vector<const DICOMDictionary*> &dicts = {},
+                    const ReadOptions &opts = {});
 
     // Find the first descendant node matching (group, tag).
     Node* find(uint16_t group, uint16_t tag);
@@ -125,6 +158,59 @@ struct Node {
 
 };
 
+//////////////
+// Read-only, zero-copy DICOM parsing.
+//
+// A TreeView references the bytes of a memory-mapped file (or a single shared buffer) rather than copying each value
+// into a separate Node. Nodes are stored contiguously in depth-first order, so the children of a sequence or item
+// occupy a contiguous range that immediately follows their parent. Values are only copied and decoded on request,
+// and to_Node() can be used to obtain a mutable deep copy of any subtree.
+
+struct NodeView {
+    NodeKey key;
+    std::string VR;            // Same as Node::VR.
+    std::string_view raw;      // Undecoded value bytes. Empty for sequences, items, and encapsulated data.
+    uint32_t end = 0;          // Index one past this node's last descendant.
+    bool encapsulated = false; // If true, the children are the encapsulated fragments (the first is the offset table).
+
+    // Decode the value. The result is identical to Node::val after Node::read_DICOM().
+    std::string value() const;
+};
+
+class TreeView {
+  private:
+    std::shared_ptr<const void> storage; // Owns the mapped file or buffer. Shared between copies.
+    std::string_view bytes;
+
+    void parse(const std::vector<const DICOMDictionary*> &dicts,
+               const ReadOptions &opts);
+
+  public:
+    std::vector<NodeView> nodes; // The root is nodes.front(), and is equivalent to the root Node of read_DICOM().
+
+    // Parse a DICOM file, memory-mapping it where possible. Dictionaries are used for implicit-VR tag lookup.
+    void read_DICOM(const std::filesystem::path &p,
+                    const std::vector<const DICOMDictionary*> &dicts = {},
+                    const ReadOptions &opts = {});
+
+    // Parse a DICOM file held in memory. The buffer is retained and must not be modified.
+    void read_DICOM(std::shared_ptr<const std::string> buffer,
+                    const std::vector<const DICOMDictionary*> &dicts = {},
+                    const ReadOptions &opts = {});
+
+    // Indices of the immediate children of the node at index 'i'.
+    std::vector<size_t> children(size_t i = 0) const;
+
+    // Find the first (or all) descendant nodes matching (group, tag), in the same order as Node::find().
+    const NodeView* find(uint16_t group, uint16_t tag) const;
+    std::list<const NodeView*> find_all(uint16_t group, uint16_t tag) const;
+
+    // Deep copy the subtree rooted at index 'i' into a mutable Node tree, equivalent to Node::read_DICOM().
+    Node to_Node(size_t i = 0) const;
+};
+
+//////////////
+
 // Evaluate whether the contents fit the DICOM VR.
 bool validate_VR_conformance( const std::string &VR,
                               const std::string &val,
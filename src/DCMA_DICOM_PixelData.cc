@@ -20,14 +20,26 @@
 #include <optional>
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string_view>
+#include <thread>
 
 #include "YgorLog.h"
+#include "YgorThreadPool.h"   //Needed for work_queue.
 #include "YgorImages.h"
 #include "YgorMath.h"
 
 #include "DCMA_DICOM.h"
 #include "DCMA_DICOM_PixelData.h"
 
+// Vectorized sample decoding kernels are compiled via function target attributes and selected at runtime, so the
+// build does not need to target a specific instruction set.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define DCMA_DICOM_PIXELDATA_X86_KERNELS
+    #include <immintrin.h>
+#endif
+
 // Bundled stb_image for JPEG baseline decoding. STB_IMAGE_STATIC ensures all symbols are
 // local to this translation unit, avoiding clashes with the copy in STB_Shim.cc.
 namespace dcma_stb_px {
@@ -574,9 +586,35 @@ bool convert_photometric_to_rgb(planar_image<float,double> &img,
 // Helper: build a planar_image from a flat vector of sample values.
 // ============================================================================
 
+// Allocate one uninitialized planar_image per frame with the dimensions given by a PixelDataDesc.
+// Default spatial parameters are used (1mm spacing, identity orientation).
+static planar_image_collection<float,double>
+allocate_frame_images(const PixelDataDesc &desc){
+    const int64_t rows = static_cast<int64_t>(desc.rows);
+    const int64_t cols = static_cast<int64_t>(desc.columns);
+    const int64_t chns = static_cast<int64_t>(desc.samples_per_pixel);
+
+    const double pxl_dx = 1.0;
+    const double pxl_dy = 1.0;
+    const double pxl_dz = 1.0;
+    const vec3<double> anchor(0.0, 0.0, 0.0);
+    const vec3<double> offset(0.0, 0.0, 0.0);
+    const vec3<double> row_unit(1.0, 0.0, 0.0);
+    const vec3<double> col_unit(0.0, 1.0, 0.0);
+
+    planar_image_collection<float,double> pic;
+    for(uint32_t f = 0; f < desc.number_of_frames; ++f){
+        pic.images.emplace_back();
+        auto &img = pic.images.back();
+        img.init_buffer(rows, cols, chns);
+        img.init_spatial(pxl_dx, pxl_dy, pxl_dz, anchor, offset);
+        img.init_orientation(row_unit, col_unit);
+    }
+    return pic;
+}
+
 // Populate a planar_image_collection from unpacked samples and a PixelDataDesc.
 // Handles multi-frame images (one image per frame) and planar → interleaved rearrangement.
-// Default spatial parameters are used (1mm spacing, identity orientation).
 static std::optional<planar_image_collection<float,double>>
 samples_to_images(const std::vector<double> &samples,
                   const PixelDataDesc &desc){
@@ -595,24 +633,11 @@ samples_to_images(const std::vector<double> &samples,
         return std::nullopt;
     }
 
-    planar_image_collection<float,double> pic;
-
-    const double pxl_dx = 1.0;
-    const double pxl_dy = 1.0;
-    const double pxl_dz = 1.0;
-    const vec3<double> anchor(0.0, 0.0, 0.0);
-    const vec3<double> offset(0.0, 0.0, 0.0);
-    const vec3<double> row_unit(1.0, 0.0, 0.0);
-    const vec3<double> col_unit(0.0, 1.0, 0.0);
-
-    for(uint32_t f = 0; f < nf; ++f){
+    auto pic = allocate_frame_images(desc);
+    auto img_it = pic.images.begin();
+    for(uint32_t f = 0; f < nf; ++f, ++img_it){
         const auto frame_offset = static_cast<size_t>(f) * samples_per_frame;
-
-        pic.images.emplace_back();
-        auto &img = pic.images.back();
-        img.init_buffer(rows, cols, chns);
-        img.init_spatial(pxl_dx, pxl_dy, pxl_dz, anchor, offset);
-        img.init_orientation(row_unit, col_unit);
+        auto &img = *img_it;
 
         if(desc.planar_configuration == 0 || chns == 1){
             // Interleaved: R0 G0 B0 R1 G1 B1 ...
@@ -646,6 +671,237 @@ samples_to_images(const std::vector<double> &samples,
 }
 
 
+// ============================================================================
+// Fused native sample decoding.
+// ============================================================================
+
+static void
+validate_sample_decode_params(const NativeSampleDecodeParams &p){
+    const auto ba = p.bits_allocated;
+    const auto bs = p.bits_stored;
+    const auto hb = p.high_bit;
+    if( (ba != 8) && (ba != 16) && (ba != 32) ){
+        throw std::invalid_argument("Fused sample decoding supports only 8, 16, and 32 bits allocated");
+    }
+    if( (bs == 0) || (ba < bs) || (ba <= hb) || ((hb + 1) < bs) ){
+        throw std::invalid_argument("Inconsistent Bits Stored / High Bit for fused sample decoding");
+    }
+}
+
+// Mask and sign-extend a single stored value.
+static inline int64_t
+extract_stored_value(uint32_t v, uint32_t low_bit, uint32_t bs, bool is_signed){
+    const uint32_t mask = (bs >= 32u) ? 0xFFFFFFFFu : ((1u << bs) - 1u);
+    v = (v >> low_bit) & mask;
+    if(is_signed){
+        const uint64_t sign = uint64_t(1) << (bs - 1u);
+        return static_cast<int64_t>(v ^ sign) - static_cast<int64_t>(sign);
+    }
+    return static_cast<int64_t>(v);
+}
+
+static void
+decode_native_samples_scalar(const uint8_t *src,
+                             uint64_t count,
+                             const NativeSampleDecodeParams &p,
+                             float *dst){
+    const uint32_t low_bit = p.high_bit + 1u - p.bits_stored;
+    const uint32_t bs = p.bits_stored;
+
+    // The rescale is performed in double precision and rounded once, exactly as apply_modality_lut() does.
+    for(uint64_t i = 0; i < count; ++i){
+        uint32_t w = 0;
+        if(p.bits_allocated == 8){
+            w = src[i];
+        }else if(p.bits_allocated == 16){
+            uint16_t h = 0;
+            std::memcpy(&h, src + i * 2u, 2);
+            if(p.byte_swap) h = static_cast<uint16_t>((h >> 8) | (h << 8));
+            w = h;
+        }else{
+            std::memcpy(&w, src + i * 4u, 4);
+            if(p.byte_swap){
+                w = ((w & 0x000000FFu) << 24) | ((w & 0x0000FF00u) << 8)
+                  | ((w & 0x00FF0000u) >> 8)  | ((w & 0xFF000000u) >> 24);
+            }
+        }
+        const auto v = extract_stored_value(w, low_bit, bs, p.is_signed);
+        dst[i] = static_cast<float>(p.slope * static_cast<double>(v) + p.intercept);
+    }
+    return;
+}
+
+#if defined(DCMA_DICOM_PIXELDATA_X86_KERNELS)
+// The vectorized kernels widen 8-bit samples to 16-bit lanes, then mask and sign-extend within 16-bit lanes using
+// shifts, and widen again to 32-bit lanes. The rescale is performed in double precision lanes and each result is
+// rounded once to single precision, so the output matches the scalar kernel and apply_modality_lut() exactly. Any
+// remainder is handled by the scalar kernel.
+//
+// Note: these functions are compiled for the named instruction set regardless of the compiler flags, so they must only
+// be called after verifying CPU support.
+__attribute__((target("sse4.1")))
+static inline __m128
+rescale_epi32_sse41(__m128i x, __m128d slope, __m128d intercept){
+    const __m128d d_lo = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(x), slope), intercept);
+    const __m128d d_hi = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), slope), intercept);
+    return _mm_movelh_ps(_mm_cvtpd_ps(d_lo), _mm_cvtpd_ps(d_hi));
+}
+
+__attribute__((target("sse4.1")))
+static void
+decode_native_samples_sse41(const uint8_t *src,
+                            uint64_t count,
+                            const NativeSampleDecodeParams &p,
+                            float *dst){
+    if(p.bits_allocated == 32){
+        decode_native_samples_scalar(src, count, p, dst);
+        return;
+    }
+
+    const int low_bit = p.high_bit + 1 - p.bits_stored;
+    const int ext_shift = 16 - p.bits_stored;
+    const __m128i low_bit_v = _mm_cvtsi32_si128(low_bit);
+    const __m128i ext_shift_v = _mm_cvtsi32_si128(ext_shift);
+    const __m128i mask_v = _mm_set1_epi16(static_cast<int16_t>((1u << p.bits_stored) - 1u));
+    const __m128i swap_v = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128d slope_v = _mm_set1_pd(p.slope);
+    const __m128d intercept_v = _mm_set1_pd(p.intercept);
+
+    const uint64_t bytes_per_sample = p.bits_allocated / 8u;
+    const uint64_t N = (count / 8u) * 8u;
+    for(uint64_t i = 0; i < N; i += 8u){
+        __m128i x;
+        if(bytes_per_sample == 1u){
+            x = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        }else{
+            x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2u));
+            if(p.byte_swap) x = _mm_shuffle_epi8(x, swap_v);
+        }
+        x = _mm_and_si128(_mm_srl_epi16(x, low_bit_v), mask_v);
+
+        __m128i lo;
+        __m128i hi;
+        if(p.is_signed){
+            x = _mm_sra_epi16(_mm_sll_epi16(x, ext_shift_v), ext_shift_v);
+            lo = _mm_cvtepi16_epi32(x);
+            hi = _mm_cvtepi16_epi32(_mm_srli_si128(x, 8));
+        }else{
+            lo = _mm_cvtepu16_epi32(x);
+            hi = _mm_cvtepu16_epi32(_mm_srli_si128(x, 8));
+        }
+        _mm_storeu_ps(dst + i, rescale_epi32_sse41(lo, slope_v, intercept_v));
+        _mm_storeu_ps(dst + i + 4u, rescale_epi32_sse41(hi, slope_v, intercept_v));
+    }
+    decode_native_samples_scalar(src + N * bytes_per_sample, count - N, p, dst + N);
+    return;
+}
+
+__attribute__((target("avx2")))
+static inline __m256
+rescale_epi32_avx2(__m256i x, __m256d slope, __m256d intercept){
+    const __m256d d_lo = _mm256_add_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), slope), intercept);
+    const __m256d d_hi = _mm256_add_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), slope), intercept);
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(d_lo)), _mm256_cvtpd_ps(d_hi), 1);
+}
+
+__attribute__((target("avx2")))
+static void
+decode_native_samples_avx2(const uint8_t *src,
+                           uint64_t count,
+                           const NativeSampleDecodeParams &p,
+                           float *dst){
+    if(p.bits_allocated == 32){
+        decode_native_samples_scalar(src, count, p, dst);
+        return;
+    }
+
+    const int low_bit = p.high_bit + 1 - p.bits_stored;
+    const int ext_shift = 16 - p.bits_stored;
+    const __m128i low_bit_v = _mm_cvtsi32_si128(low_bit);
+    const __m128i ext_shift_v = _mm_cvtsi32_si128(ext_shift);
+    const __m256i mask_v = _mm256_set1_epi16(static_cast<int16_t>((1u << p.bits_stored) - 1u));
+    const __m256i swap_v = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256d slope_v = _mm256_set1_pd(p.slope);
+    const __m256d intercept_v = _mm256_set1_pd(p.intercept);
+
+    const uint64_t bytes_per_sample = p.bits_allocated / 8u;
+    const uint64_t N = (count / 16u) * 16u;
+    for(uint64_t i = 0; i < N; i += 16u){
+        __m256i x;
+        if(bytes_per_sample == 1u){
+            x = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        }else{
+            x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 2u));
+            if(p.byte_swap) x = _mm256_shuffle_epi8(x, swap_v);
+        }
+        x = _mm256_and_si256(_mm256_srl_epi16(x, low_bit_v), mask_v);
+
+        __m256i lo;
+        __m256i hi;
+        if(p.is_signed){
+            x = _mm256_sra_epi16(_mm256_sll_epi16(x, ext_shift_v), ext_shift_v);
+            lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x));
+            hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+        }else{
+            lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(x));
+            hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(x, 1));
+        }
+        // Multiply and add are kept separate (i.e., no FMA) so the result matches the other kernels exactly.
+        _mm256_storeu_ps(dst + i, rescale_epi32_avx2(lo, slope_v, intercept_v));
+        _mm256_storeu_ps(dst + i + 8u, rescale_epi32_avx2(hi, slope_v, intercept_v));
+    }
+    decode_native_samples_scalar(src + N * bytes_per_sample, count - N, p, dst + N);
+    return;
+}
+#endif // defined(DCMA_DICOM_PIXELDATA_X86_KERNELS)
+
+bool sample_decode_kernel_is_supported(SampleDecodeKernel k){
+    if(k == SampleDecodeKernel::Scalar) return true;
+#if defined(DCMA_DICOM_PIXELDATA_X86_KERNELS)
+    __builtin_cpu_init();
+    if(k == SampleDecodeKernel::SSE41) return (__builtin_cpu_supports("sse4.1") != 0);
+    if(k == SampleDecodeKernel::AVX2)  return (__builtin_cpu_supports("avx2") != 0);
+#endif
+    return false;
+}
+
+SampleDecodeKernel best_sample_decode_kernel(){
+    static const SampleDecodeKernel best = [](){
+        for(const auto k : { SampleDecodeKernel::AVX2, SampleDecodeKernel::SSE41 }){
+            if(sample_decode_kernel_is_supported(k)) return k;
+        }
+        return SampleDecodeKernel::Scalar;
+    }();
+    return best;
+}
+
+void decode_native_samples(const uint8_t *src,
+                           uint64_t count,
+                           const NativeSampleDecodeParams &params,
+                           float *dst,
+                           SampleDecodeKernel kernel){
+    validate_sample_decode_params(params);
+    if(!sample_decode_kernel_is_supported(kernel)){
+        throw std::invalid_argument("Requested sample decoding kernel is not supported on this CPU");
+    }
+    if(count == 0) return;
+
+#if defined(DCMA_DICOM_PIXELDATA_X86_KERNELS)
+    if(kernel == SampleDecodeKernel::AVX2){
+        decode_native_samples_avx2(src, count, params, dst);
+        return;
+    }
+    if(kernel == SampleDecodeKernel::SSE41){
+        decode_native_samples_sse41(src, count, params, dst);
+        return;
+    }
+#endif
+    decode_native_samples_scalar(src, count, params, dst);
+    return;
+}
+
+
 // ============================================================================
 // Native (uncompressed) pixel data extraction.
 // ============================================================================
@@ -781,7 +1037,9 @@ unpack_native_samples(const std::string &raw,
 }
 
 
-std::optional<planar_image_collection<float,double>> extract_native_pixel_data(const Node &root){
+std::optional<planar_image_collection<float,double>>
+extract_native_pixel_data(const Node &root,
+                          const std::optional<ModalityLUTParams> &modality_lut){
     // Get pixel data descriptor.
     auto desc_opt = get_pixel_data_desc(root);
     if(!desc_opt) return std::nullopt;
@@ -827,6 +1085,41 @@ std::optional<planar_image_collection<float,double>> extract_native_pixel_data(c
         return std::nullopt;
     }
 
+    // Common integer encodings are decoded (and optionally rescaled) directly into the image buffers in one pass.
+    const auto ba = desc.bits_allocated;
+    if( !is_double_float
+    &&  !is_single_float
+    &&  ((ba == 8) || (ba == 16) || (ba == 32))
+    &&  ((desc.planar_configuration == 0) || (desc.samples_per_pixel == 1))
+    &&  (0 < desc.bits_stored) && (desc.bits_stored <= ba)
+    &&  (desc.high_bit < ba) && (desc.bits_stored <= (desc.high_bit + 1)) ){
+        const uint64_t bytes_per_sample = ba / 8u;
+        if(raw.size() < (total_samples * bytes_per_sample)){
+            YLOGWARN("Pixel data buffer underflow: expected "
+                     << (total_samples * bytes_per_sample) << " bytes, got " << raw.size());
+            return std::nullopt;
+        }
+
+        NativeSampleDecodeParams params;
+        params.bits_allocated = ba;
+        params.bits_stored    = desc.bits_stored;
+        params.high_bit       = desc.high_bit;
+        params.is_signed      = (desc.pixel_representation != 0);
+        if(modality_lut){
+            params.slope     = modality_lut->rescale_slope;
+            params.intercept = modality_lut->rescale_intercept;
+        }
+
+        auto pic = allocate_frame_images(desc);
+        const uint64_t samples_per_frame = total_samples / desc.number_of_frames;
+        const auto *src = reinterpret_cast<const uint8_t*>(raw.data());
+        for(auto &img : pic.images){
+            decode_native_samples(src, samples_per_frame, params, img.data.data());
+            src += samples_per_frame * bytes_per_sample;
+        }
+        return pic;
+    }
+
     std::vector<double> samples;
 
     if(is_double_float){
@@ -869,7 +1162,11 @@ std::optional<planar_image_collection<float,double>> extract_native_pixel_data(c
         }
     }
 
-    return samples_to_images(samples, desc);
+    auto pic = samples_to_images(samples, desc);
+    if(pic && modality_lut){
+        for(auto &img : pic->images) apply_modality_lut(img, *modality_lut);
+    }
+    return pic;
 }
 
 
@@ -957,7 +1254,7 @@ extract_overlay_data(const Node &root){
 
 // Find the position of the first JPEG SOI marker (0xFF 0xD8) in a byte buffer.
 // Returns the offset from the start, or std::string::npos if not found.
-static size_t find_jpeg_soi(const std::string &data){
+static size_t find_jpeg_soi(std::string_view data){
     for(size_t i = 0; i + 1 < data.size(); ++i){
         if(static_cast<uint8_t>(data[i]) == 0xFF
         && static_cast<uint8_t>(data[i + 1]) == 0xD8){
@@ -967,18 +1264,124 @@ static size_t find_jpeg_soi(const std::string &data){
     return std::string::npos;
 }
 
-std::optional<planar_image_collection<float,double>> extract_encapsulated_pixel_data(const Node &root){
-    auto desc_opt = get_pixel_data_desc(root);
-    if(!desc_opt){
-        YLOGWARN("Encapsulated pixel data extraction failed: pixel data descriptor could not be determined");
-        return std::nullopt;
+static bool begins_with_jpeg_soi(std::string_view data){
+    return (2 <= data.size())
+        && (static_cast<uint8_t>(data[0]) == 0xFF)
+        && (static_cast<uint8_t>(data[1]) == 0xD8);
+}
+
+// Read an unsigned little-endian integer of 'n' bytes. Encapsulated data is always little-endian.
+static uint64_t read_le_uint(const char *p, size_t n){
+    uint64_t v = 0;
+    for(size_t i = 0; i < n; ++i){
+        v |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (8u * i);
     }
-    const auto &desc = *desc_opt;
+    return v;
+}
 
-    // Only JPEG Baseline (Process 1) is supported via the bundled stb_image library.
-    // stb_image supports 8-bit baseline JPEG only (sequential DCT, Huffman-coded).
-    // Reject all other transfer syntaxes, including JPEG Extended (12-bit) and JPEG Lossless.
-    const auto ts_str = read_text(root, 0x0002, 0x0010);
+std::optional<std::vector<std::vector<std::string_view>>>
+locate_encapsulated_frames(const std::vector<std::string_view> &fragments,
+                           std::string_view basic_offset_table,
+                           uint32_t number_of_frames,
+                           std::string_view extended_offset_table){
+    if( (number_of_frames == 0) || fragments.empty() ) return std::nullopt;
+
+    std::vector<std::vector<std::string_view>> frames;
+    if(number_of_frames == 1){
+        frames.emplace_back(fragments);
+        return frames;
+    }
+
+    // Offsets are measured from the first byte of the first fragment's Item tag, so each fragment also occupies 8 bytes
+    // for its Item tag and length. See DICOM PS3.5 2026b, Section A.4.
+    std::vector<uint64_t> fragment_starts;
+    fragment_starts.reserve(fragments.size());
+    uint64_t pos = 0;
+    for(const auto &f : fragments){
+        fragment_starts.push_back(pos);
+        pos += 8u + f.size();
+    }
+
+    const auto group_by_offsets = [&](std::string_view table, size_t width) -> bool {
+        if(table.size() != (static_cast<size_t>(number_of_frames) * width)) return false;
+        frames.assign(number_of_frames, {});
+        size_t j = 0;
+        for(uint32_t k = 0; k < number_of_frames; ++k){
+            const auto offset = read_le_uint(table.data() + k * width, width);
+            if( (fragments.size() <= j) || (fragment_starts[j] != offset) ) return false;
+
+            const auto next = ((k + 1u) < number_of_frames) ? read_le_uint(table.data() + (k + 1u) * width, width)
+                                                             : std::numeric_limits<uint64_t>::max();
+            if(next <= offset) return false;
+            while( (j < fragments.size()) && (fragment_starts[j] < next) ){
+                frames[k].push_back(fragments[j]);
+                ++j;
+            }
+        }
+        return (j == fragments.size());
+    };
+
+    // Extended Offset Table (7FE0,0001): one 64-bit offset per frame. See DICOM PS3.3 2026b, C.7.6.3.1.8.
+    if(!extended_offset_table.empty()){
+        if(group_by_offsets(extended_offset_table, 8u)) return frames;
+        YLOGWARN("Extended Offset Table is inconsistent with the encapsulated fragments; ignoring it");
+    }
+
+    // Basic Offset Table: one 32-bit offset per frame. See DICOM PS3.5 2026b, Table A.4-1.
+    if(!basic_offset_table.empty()){
+        if(group_by_offsets(basic_offset_table, 4u)) return frames;
+        YLOGWARN("Basic Offset Table is inconsistent with the encapsulated fragments; ignoring it");
+    }
+
+    // Without a usable offset table, the most common layout is one fragment per frame.
+    frames.clear();
+    if(fragments.size() == number_of_frames){
+        for(const auto &f : fragments) frames.push_back({ f });
+        return frames;
+    }
+
+    // Otherwise, JPEG frames can be delineated by fragments that begin with an SOI marker.
+    for(const auto &f : fragments){
+        if(frames.empty() || begins_with_jpeg_soi(f)){
+            frames.emplace_back();
+        }
+        frames.back().push_back(f);
+    }
+    if(frames.size() == number_of_frames) return frames;
+
+    YLOGWARN("Unable to determine frame boundaries for " << number_of_frames << " frames in "
+             << fragments.size() << " encapsulated fragments");
+    return std::nullopt;
+}
+
+// Node::read_DICOM() concatenates all fragments, so frame boundaries must be recovered from the JPEG markers. Each frame
+// is a complete JPEG stream ending with an EOI marker (0xFF 0xD9), possibly followed by a single fragment padding byte,
+// and the next frame begins with an SOI marker (0xFF 0xD8). Neither marker can occur in entropy-coded data.
+static std::vector<std::vector<std::string_view>>
+split_concatenated_jpeg_frames(std::string_view data){
+    std::vector<std::vector<std::string_view>> frames;
+    size_t begin = 0;
+    for(size_t i = 0; (i + 3) < data.size(); ++i){
+        if( (static_cast<uint8_t>(data[i]) != 0xFF)
+        ||  (static_cast<uint8_t>(data[i + 1]) != 0xD9) ) continue;
+
+        size_t next = i + 2;
+        if(data[next] == '\0') ++next;
+        if(begins_with_jpeg_soi(data.substr(next))){
+            frames.push_back({ data.substr(begin, i + 2 - begin) });
+            begin = next;
+            i = next;
+        }
+    }
+    frames.push_back({ data.substr(begin) });
+    return frames;
+}
+
+// Only JPEG Baseline (Process 1) is supported via the bundled stb_image library.
+// stb_image supports 8-bit baseline JPEG only (sequential DCT, Huffman-coded).
+// Reject all other transfer syntaxes, including JPEG Extended (12-bit) and JPEG Lossless.
+static bool
+encapsulated_pixel_data_is_supported(const PixelDataDesc &desc, const std::string &ts_str){
     const auto ts_stripped = strip_ts_padding(ts_str);
     if(ts_stripped != "1.2.840.10008.1.2.4.50"){
         if(desc.transfer_syntax == TransferSyntaxType::EncapsulatedJPEG){
@@ -988,17 +1391,124 @@ std::optional<planar_image_collection<float,double>> extract_encapsulated_pixel_
             YLOGWARN("Encapsulated pixel data extraction is not yet implemented for transfer syntax type "
                      << static_cast<int>(desc.transfer_syntax));
         }
-        return std::nullopt;
+        return false;
     }
     if(desc.bits_allocated != 8 || desc.bits_stored != 8){
         YLOGWARN("Only 8-bit JPEG baseline is supported by the bundled JPEG decoder (stb_image);"
                  " BitsAllocated=" << desc.bits_allocated << ", BitsStored=" << desc.bits_stored);
+        return false;
+    }
+    return true;
+}
+
+// Decode a single JPEG baseline frame into a preallocated image. The image is only resized if the decoder reports a
+// different number of channels than expected.
+static bool
+decode_jpeg_baseline_frame(const std::vector<std::string_view> &fragments,
+                           planar_image<float,double> &img){
+    // Frames that span multiple fragments must be reassembled into a contiguous bitstream.
+    std::string joined;
+    std::string_view stream;
+    if(fragments.size() == 1){
+        stream = fragments.front();
+    }else{
+        for(const auto &f : fragments) joined.append(f);
+        stream = joined;
+    }
+
+    const auto soi_pos = find_jpeg_soi(stream);
+    if(soi_pos == std::string::npos){
+        YLOGWARN("No JPEG SOI marker (0xFF 0xD8) found in encapsulated pixel data");
+        return false;
+    }
+    const auto remaining = stream.size() - soi_pos;
+    if(remaining > static_cast<size_t>(std::numeric_limits<int>::max())){
+        YLOGWARN("Encapsulated JPEG data exceeds INT_MAX (" << remaining << " bytes); cannot decode");
+        return false;
+    }
+    const auto *jpeg_data = reinterpret_cast<const dcma_stb_px::stbi_uc*>(stream.data() + soi_pos);
+    const int jpeg_len = static_cast<int>(remaining);
+
+    int width = 0;
+    int height = 0;
+    int channels_actual = 0;
+    const int channels_requested = 0; // Keep original channel count.
+
+    unsigned char *pixels = dcma_stb_px::stbi_load_from_memory(
+        jpeg_data, jpeg_len, &width, &height, &channels_actual, channels_requested);
+
+    if(pixels == nullptr){
+        YLOGWARN("stb_image JPEG decoding failed: " << dcma_stb_px::stbi_failure_reason());
+        return false;
+    }
+
+    // Validate decoded dimensions against DICOM descriptor.
+    if(width != static_cast<int>(img.columns) || height != static_cast<int>(img.rows)){
+        YLOGWARN("JPEG decoded dimensions (" << width << "x" << height
+                 << ") do not match DICOM descriptor (" << img.columns << "x" << img.rows << ")");
+        dcma_stb_px::stbi_image_free(pixels);
+        return false;
+    }
+    if(channels_actual != static_cast<int>(img.channels)){
+        img.init_buffer(img.rows, img.columns, static_cast<int64_t>(channels_actual));
+    }
+
+    // The decoded samples are interleaved in the same order as planar_image.
+    const auto N = static_cast<size_t>(img.rows * img.columns * img.channels);
+    for(size_t i = 0; i < N; ++i){
+        img.data[i] = static_cast<float>(pixels[i]);
+    }
+
+    dcma_stb_px::stbi_image_free(pixels);
+    return true;
+}
+
+// Decode each frame into a preallocated image. Frames are independent, so they are decoded concurrently.
+static std::optional<planar_image_collection<float,double>>
+decode_encapsulated_frames(const PixelDataDesc &desc,
+                           const std::vector<std::vector<std::string_view>> &frames,
+                           uint32_t concurrency){
+    if(frames.size() != desc.number_of_frames){
+        YLOGWARN("Found " << frames.size() << " encapsulated frames, but expected " << desc.number_of_frames);
         return std::nullopt;
     }
 
-    // Multi-frame encapsulated images are not yet supported.
-    if(desc.number_of_frames > 1){
-        YLOGWARN("Multi-frame encapsulated pixel data is not yet supported");
+    auto pic = allocate_frame_images(desc);
+    std::vector<planar_image<float,double>*> slots;
+    slots.reserve(frames.size());
+    for(auto &img : pic.images) slots.push_back(&img);
+
+    std::atomic<uint64_t> failures(0);
+    if(frames.size() == 1){
+        if(!decode_jpeg_baseline_frame(frames.front(), *slots.front())) ++failures;
+    }else{
+        if(concurrency == 0) concurrency = std::max<uint32_t>(1U, std::thread::hardware_concurrency());
+        concurrency = static_cast<uint32_t>(std::min<size_t>(concurrency, frames.size()));
+
+        work_queue<std::function<void(void)>> wq(concurrency);
+        for(size_t i = 0; i < frames.size(); ++i){
+            wq.submit_task([&,i]() -> void {
+                if(!decode_jpeg_baseline_frame(frames[i], *slots[i])) ++failures;
+            });
+        }
+    } // Wait for all frames to be decoded.
+
+    if(failures.load() != 0){
+        YLOGWARN("Unable to decode " << failures.load() << " of " << frames.size() << " encapsulated frames");
+        return std::nullopt;
+    }
+    return pic;
+}
+
+std::optional<planar_image_collection<float,double>>
+extract_encapsulated_pixel_data(const Node &root, uint32_t concurrency){
+    auto desc_opt = get_pixel_data_desc(root);
+    if(!desc_opt){
+        YLOGWARN("Encapsulated pixel data extraction failed: pixel data descriptor could not be determined");
+        return std::nullopt;
+    }
+    const auto &desc = *desc_opt;
+    if(!encapsulated_pixel_data_is_supported(desc, read_text(root, 0x0002, 0x0010))){
         return std::nullopt;
     }
 
@@ -1036,75 +1546,73 @@ std::optional<planar_image_collection<float,double>> extract_encapsulated_pixel_
         }
     }
 
-    std::string jpeg_search_region;
-    if(search_offset == 0U){
-        jpeg_search_region.assign(raw.begin(), raw.end());
-    } else {
-        jpeg_search_region.assign(raw.begin() + static_cast<std::ptrdiff_t>(search_offset), raw.end());
-    }
-
+    const std::string_view jpeg_search_region = std::string_view(raw).substr(search_offset);
     const auto sub_soi_pos = find_jpeg_soi(jpeg_search_region);
     if(sub_soi_pos == std::string::npos){
         YLOGWARN("No JPEG SOI marker (0xFF 0xD8) found in encapsulated pixel data");
         return std::nullopt;
     }
+    const auto stream = jpeg_search_region.substr(sub_soi_pos);
 
-    const auto soi_pos = search_offset + sub_soi_pos;
-    const auto remaining = raw.size() - soi_pos;
-    if(remaining > static_cast<size_t>(std::numeric_limits<int>::max())){
-        YLOGWARN("Encapsulated JPEG data exceeds INT_MAX (" << remaining << " bytes); cannot decode");
-        return std::nullopt;
+    std::vector<std::vector<std::string_view>> frames;
+    if(desc.number_of_frames == 1){
+        frames.push_back({ stream });
+    }else{
+        frames = split_concatenated_jpeg_frames(stream);
     }
-    const auto *jpeg_data = reinterpret_cast<const dcma_stb_px::stbi_uc*>(raw.data() + soi_pos);
-    const int jpeg_len = static_cast<int>(remaining);
-
-    int width = 0;
-    int height = 0;
-    int channels_actual = 0;
-    const int channels_requested = 0; // Keep original channel count.
+    return decode_encapsulated_frames(desc, frames, concurrency);
+}
 
-    unsigned char *pixels = dcma_stb_px::stbi_load_from_memory(
-        jpeg_data, jpeg_len, &width, &height, &channels_actual, channels_requested);
+std::optional<planar_image_collection<float,double>>
+extract_encapsulated_pixel_data(const TreeView &view, uint32_t concurrency){
+    if(view.nodes.empty()) return std::nullopt;
+
+    // Only the top-level attributes that describe the pixel data are copied.
+    Node header;
+    const NodeView *pd_node = nullptr;
+    const NodeView *eot_node = nullptr;
+    for(const auto i : view.children()){
+        const auto &n = view.nodes[i];
+        if( (n.key.group == 0x0002) || (n.key.group == 0x0028) ){
+            header.emplace_child_node(view.to_Node(i));
+        }else if( (n.key.group == 0x7FE0) && (n.key.tag == 0x0010) ){
+            pd_node = &n;
+        }else if( (n.key.group == 0x7FE0) && (n.key.tag == 0x0001) ){
+            eot_node = &n;
+        }
+    }
 
-    if(pixels == nullptr){
-        YLOGWARN("stb_image JPEG decoding failed: " << dcma_stb_px::stbi_failure_reason());
+    auto desc_opt = get_pixel_data_desc(header);
+    if(!desc_opt){
+        YLOGWARN("Encapsulated pixel data extraction failed: pixel data descriptor could not be determined");
         return std::nullopt;
     }
-
-    // Validate decoded dimensions against DICOM descriptor.
-    if(width != static_cast<int>(desc.columns) || height != static_cast<int>(desc.rows)){
-        YLOGWARN("JPEG decoded dimensions (" << width << "x" << height
-                 << ") do not match DICOM descriptor (" << desc.columns << "x" << desc.rows << ")");
-        dcma_stb_px::stbi_image_free(pixels);
+    const auto &desc = *desc_opt;
+    if(!encapsulated_pixel_data_is_supported(desc, read_text(header, 0x0002, 0x0010))){
         return std::nullopt;
     }
 
-    const int64_t rows = static_cast<int64_t>(height);
-    const int64_t cols = static_cast<int64_t>(width);
-    const int64_t chns = static_cast<int64_t>(channels_actual);
-
-    planar_image_collection<float,double> pic;
-    pic.images.emplace_back();
-    auto &img = pic.images.back();
-    img.init_buffer(rows, cols, chns);
-    img.init_spatial(1.0, 1.0, 1.0,
-                     vec3<double>(0.0, 0.0, 0.0),
-                     vec3<double>(0.0, 0.0, 0.0));
-    img.init_orientation(vec3<double>(1.0, 0.0, 0.0),
-                         vec3<double>(0.0, 1.0, 0.0));
-
-    const unsigned char *p = pixels;
-    for(int64_t row = 0; row < rows; ++row){
-        for(int64_t col = 0; col < cols; ++col){
-            for(int64_t chn = 0; chn < chns; ++chn){
-                img.reference(row, col, chn) = static_cast<float>(*p);
-                ++p;
-            }
-        }
+    if( (pd_node == nullptr) || !pd_node->encapsulated ){
+        YLOGWARN("No encapsulated Pixel Data tag (7FE0,0010) found");
+        return std::nullopt;
+    }
+    const auto items = view.children(static_cast<size_t>(pd_node - view.nodes.data()));
+    if(items.size() < 2){
+        YLOGWARN("Encapsulated Pixel Data does not contain any fragments");
+        return std::nullopt;
     }
 
-    dcma_stb_px::stbi_image_free(pixels);
-    return pic;
+    // The first item is the Basic Offset Table, which may be empty.
+    std::vector<std::string_view> fragments;
+    fragments.reserve(items.size() - 1);
+    for(size_t i = 1; i < items.size(); ++i) fragments.push_back(view.nodes[items[i]].raw);
+
+    const auto frames = locate_encapsulated_frames(fragments,
+                                                   view.nodes[items.front()].raw,
+                                                   desc.number_of_frames,
+                                                   (eot_node == nullptr) ? std::string_view() : eot_node->raw);
+    if(!frames) return std::nullopt;
+    return decode_encapsulated_frames(desc, *frames, concurrency);
 }
 
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <string_view>
 #include "YgorImages.h"
 #include "YgorMath.h"
 #include "DCMA_DICOM.h"
@@ -203,8 +204,13 @@ bool convert_photometric_to_rgb(planar_image<float,double> &img,
 // planar_image with rows, columns, and channels matching the DICOM descriptor. Planar-
 // configured (planar_configuration == 1) data is rearranged to interleaved order.
 //
-// No pixel transformations (Modality LUT, VOI LUT, etc.) are applied; the caller may
-// compose them as needed.
+// If modality_lut is provided, the Modality LUT (linear rescale) is fused into the decode
+// so the samples are only visited once. The rescale is evaluated in double precision, as in
+// apply_modality_lut(), so the result is identical to calling apply_modality_lut() on each
+// image afterward whenever the stored values are exactly representable as floats (i.e.,
+// fewer than 25 bits stored). Wider integer samples are rescaled before rounding to single
+// precision, so they are more accurate than the two-step equivalent. No other pixel
+// transformations (VOI LUT, etc.) are applied; the caller may compose them as needed.
 //
 // Returns std::nullopt if the tree does not contain the expected pixel data or if the
 // parameters are inconsistent (e.g., compressed transfer syntax with native pixel data).
@@ -216,7 +222,54 @@ bool convert_photometric_to_rgb(planar_image<float,double> &img,
 // References:
 //   - DICOM PS3.5 2026b, Section 8.1.1: Pixel Data Encoding of Related Data Elements.
 //   - DICOM PS3.5 2026b, Section 8.2.1: Native Format Encoding.
-std::optional<planar_image_collection<float,double>> extract_native_pixel_data(const Node &root);
+std::optional<planar_image_collection<float,double>>
+extract_native_pixel_data(const Node &root,
+                          const std::optional<ModalityLUTParams> &modality_lut = std::nullopt);
+
+
+// ============================================================================
+// Fused native sample decoding.
+// ============================================================================
+//
+// Low-level kernels that convert a contiguous run of native integer samples directly into
+// floats, performing byte-swapping, bit-masking (High Bit / Bits Stored), sign-extension,
+// and the Modality LUT rescale in a single pass. These are used by extract_native_pixel_data()
+// but are exposed so callers holding raw sample spans (e.g., TreeView::NodeView::raw, which is
+// not byte-swapped) can decode without intermediate copies.
+//
+// Vectorized kernels are selected at runtime based on the host CPU. All kernels produce
+// identical results: (slope * value) + intercept is evaluated in double precision and rounded
+// once to single precision, exactly as apply_modality_lut() does.
+
+enum class SampleDecodeKernel {
+    Scalar,
+    SSE41,   // x86 SSE4.1.
+    AVX2,    // x86 AVX2.
+};
+
+struct NativeSampleDecodeParams {
+    uint16_t bits_allocated = 16;  // Only 8, 16, and 32 are supported.
+    uint16_t bits_stored    = 16;
+    uint16_t high_bit       = 15;
+    bool is_signed          = false;  // Pixel Representation == 1.
+    bool byte_swap          = false;  // Set when the samples are not in host byte order.
+    double slope            = 1.0;
+    double intercept        = 0.0;
+};
+
+// Whether the host CPU can execute the given kernel.
+bool sample_decode_kernel_is_supported(SampleDecodeKernel k);
+
+// The fastest kernel supported by the host CPU. The result is computed once and cached.
+SampleDecodeKernel best_sample_decode_kernel();
+
+// Decode 'count' samples from 'src' (which must hold count * bits_allocated / 8 bytes) into 'dst'.
+// Throws if the parameters are invalid or the kernel is not supported by the host CPU.
+void decode_native_samples(const uint8_t *src,
+                           uint64_t count,
+                           const NativeSampleDecodeParams &params,
+                           float *dst,
+                           SampleDecodeKernel kernel = best_sample_decode_kernel());
 
 
 // ============================================================================
@@ -263,8 +316,16 @@ extract_overlay_data(const Node &root);
 // Unsupported transfer syntaxes (JPEG Extended 12-bit, JPEG Lossless, JPEG 2000, JPEG-LS,
 // RLE, HTJ2K, JPEG XL) return std::nullopt. These may be added in the future.
 //
-// The result is returned directly as a planar_image_collection. For single-frame images,
-// one planar_image is produced. Multi-frame encapsulated images are not yet supported.
+// The result is returned directly as a planar_image_collection with one planar_image per
+// frame. Frames are independently decodable, so multi-frame images are decoded concurrently
+// using up to 'concurrency' threads (0 = one per hardware thread), with each frame written
+// directly into its own preallocated image.
+//
+// Node::read_DICOM() concatenates all fragments, so the Node overload must recover frame
+// boundaries from the JPEG SOI/EOI markers. The TreeView overload retains the individual
+// fragments and uses the Extended Offset Table (7FE0,0001) or Basic Offset Table when
+// available; it also avoids copying the compressed bitstreams, so it is preferred for
+// large multi-frame objects.
 //
 // No pixel transformations (Modality LUT, VOI LUT, etc.) are applied; the caller may
 // compose them as needed. The JPEG decoder produces RGB or grayscale output; no further
@@ -282,8 +343,8 @@ extract_overlay_data(const Node &root);
 //
 //   1. Locate the Pixel Data tag (7FE0,0010) whose raw value contains the concatenated
 //      encapsulated fragments (as assembled by read_encapsulated_data() during parsing).
-//   2. Parse the Basic Offset Table (first fragment, per DICOM PS3.5, Table A.4-1) to
-//      identify per-frame fragment boundaries in multi-frame images.
+//   2. Identify per-frame fragment boundaries in multi-frame images (see
+//      locate_encapsulated_frames()).
 //   3. Dispatch each frame's compressed byte stream to an appropriate codec based on the
 //      Transfer Syntax UID:
 //
@@ -356,7 +417,30 @@ extract_overlay_data(const Node &root);
 //   4. Populate the ExtractedPixelData output from the decoded frame samples.
 // --------------------------------------------------------------------------------------
 //
-std::optional<planar_image_collection<float,double>> extract_encapsulated_pixel_data(const Node &root);
+std::optional<planar_image_collection<float,double>>
+extract_encapsulated_pixel_data(const Node &root, uint32_t concurrency = 0);
+
+std::optional<planar_image_collection<float,double>>
+extract_encapsulated_pixel_data(const TreeView &view, uint32_t concurrency = 0);
+
+// Group encapsulated fragments into frames.
+//
+// 'fragments' holds the payload of each fragment Item following the Basic Offset Table, in
+// order. Frame boundaries are determined, in order of preference, from the Extended Offset
+// Table (7FE0,0001; 64-bit offsets), the Basic Offset Table (32-bit offsets), a layout of
+// one fragment per frame, or fragments beginning with a JPEG SOI marker. Offset tables that
+// are inconsistent with the fragments are ignored.
+//
+// Returns std::nullopt if the frame boundaries could not be determined.
+//
+// References:
+//   - DICOM PS3.5 2026b, Section A.4 and Table A.4-1: Basic Offset Table.
+//   - DICOM PS3.3 2026b, Section C.7.6.3.1.8: Extended Offset Table.
+std::optional<std::vector<std::vector<std::string_view>>>
+locate_encapsulated_frames(const std::vector<std::string_view> &fragments,
+                           std::string_view basic_offset_table,
+                           uint32_t number_of_frames,
+                           std::string_view extended_offset_table = {});
 
 
 } // namespace DCMA_DICOM
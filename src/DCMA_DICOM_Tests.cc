@@ -4,11 +4,17 @@
 // defined in DCMA_DICOM.cc. Tests are separated into their own file because
 // DCMA_DICOM_obj is linked into shared libraries which don't include doctest implementation.
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <list>
 #include <vector>
 #include <map>
@@ -377,6 +383,30 @@ TEST_CASE("DCMA_DICOM round-trip with Implicit VR Little Endian"){
 }
 
 
+TEST_CASE("DCMA_DICOM header-only read stops before the requested tag"){
+    auto root = create_minimal_dicom_tree(DCMA_DICOM::Encoding::ELE);
+    root.emplace_child_node({{0x7FE0, 0x0010}, "OW", std::string(2*2*3, '\x01')}); // PixelData.
+
+    std::stringstream ss;
+    root.emit_DICOM(ss, DCMA_DICOM::Encoding::ELE);
+    REQUIRE(ss.good());
+
+    DCMA_DICOM::Node read_root;
+    ss.seekg(0);
+    read_root.read_DICOM(ss, {}, nullptr, std::make_pair<uint16_t, uint16_t>(0x7FE0, 0x0010));
+
+    const auto *modality = read_root.find(0x0008, 0x0060);
+    REQUIRE(modality != nullptr);
+    CHECK(modality->val == "CT");
+
+    const auto *cols = read_root.find(0x0028, 0x0011);
+    REQUIRE(cols != nullptr);
+    CHECK(cols->val == "3");
+
+    CHECK(read_root.find(0x7FE0, 0x0010) == nullptr);
+}
+
+
 // ============================================================================
 // Tree search tests
 // ============================================================================
@@ -530,6 +560,203 @@ TEST_CASE("DCMA_DICOM round-trip with sequences"){
 }
 
 
+// Node::operator== only compares keys, so compare entire trees explicitly.
+static bool nodes_identical(const DCMA_DICOM::Node &a, const DCMA_DICOM::Node &b){
+    if( (a != b)
+    ||  (a.VR != b.VR)
+    ||  (a.val != b.val)
+    ||  (a.children.size() != b.children.size()) ){
+        return false;
+    }
+    return std::equal(a.children.begin(), a.children.end(), b.children.begin(), nodes_identical);
+}
+
+TEST_CASE("DCMA_DICOM TreeView matches read_DICOM"){
+    auto root = create_minimal_dicom_tree(DCMA_DICOM::Encoding::ELE);
+    auto *seq = root.emplace_child_node({{0x3006, 0x0020}, "SQ", ""}); // StructureSetROISequence.
+    for(const auto &name : { "ROI_A", "ROI_B" }){
+        DCMA_DICOM::Node item;
+        item.key = {0x3006, 0x0020};
+        item.VR = "MULTI";
+        item.emplace_child_node({{0x3006, 0x0026}, "LO", name});
+        seq->emplace_child_node(std::move(item));
+    }
+    root.emplace_child_node({{0x7FE0, 0x0010}, "OW", std::string(2*2*3, '\x01')}); // PixelData.
+
+    std::stringstream ss;
+    root.emit_DICOM(ss, DCMA_DICOM::Encoding::ELE);
+    REQUIRE(ss.good());
+    auto buf = std::make_shared<const std::string>(ss.str());
+
+    DCMA_DICOM::Node read_root;
+    read_root.read_DICOM(ss);
+
+    DCMA_DICOM::TreeView view;
+    view.read_DICOM(buf);
+
+    SUBCASE("values reference the buffer without copying"){
+        const auto *pixels = view.find(0x7FE0, 0x0010);
+        REQUIRE(pixels != nullptr);
+        CHECK(pixels->raw.size() == 12);
+        CHECK(buf->data() <= pixels->raw.data());
+        CHECK(pixels->raw.data() < (buf->data() + buf->size()));
+    }
+
+    SUBCASE("sequence items are contiguous"){
+        const auto *seq_v = view.find(0x3006, 0x0020);
+        REQUIRE(seq_v != nullptr);
+        const auto seq_i = static_cast<size_t>(seq_v - view.nodes.data());
+        const auto items = view.children(seq_i);
+        REQUIRE(items.size() == 2);
+        CHECK(items.front() == seq_i + 1);
+        CHECK(view.find_all(0x3006, 0x0026).size() == 2);
+        CHECK(view.nodes.at(items.back() + 1).value() == "ROI_B");
+    }
+
+    SUBCASE("deep copies are equivalent to read_DICOM"){
+        CHECK(nodes_identical(view.to_Node(), read_root));
+    }
+
+    SUBCASE("reading can stop early"){
+        DCMA_DICOM::TreeView header;
+        DCMA_DICOM::ReadOptions opts;
+        opts.stop_before = std::make_pair<uint16_t, uint16_t>(0x3006, 0x0000);
+        header.read_DICOM(buf, {}, opts);
+        CHECK(header.find(0x0008, 0x0060) != nullptr);
+        CHECK(header.find(0x3006, 0x0020) == nullptr);
+    }
+}
+
+
+TEST_CASE("DCMA_DICOM TreeView skips groups and stops after a tag"){
+    auto root = create_minimal_dicom_tree(DCMA_DICOM::Encoding::ELE);
+    auto *seq = root.emplace_child_node({{0x3006, 0x0020}, "SQ", ""}); // StructureSetROISequence.
+    {
+        DCMA_DICOM::Node item;
+        item.key = {0x3006, 0x0020};
+        item.VR = "MULTI";
+        item.emplace_child_node({{0x3006, 0x0026}, "LO", "ROI_A"});
+        seq->emplace_child_node(std::move(item));
+    }
+    root.emplace_child_node({{0x7FE0, 0x0010}, "OW", std::string(2*2*3, '\x01')}); // PixelData.
+
+    std::stringstream ss;
+    root.emit_DICOM(ss, DCMA_DICOM::Encoding::ELE);
+    REQUIRE(ss.good());
+    auto buf = std::make_shared<const std::string>(ss.str());
+
+    SUBCASE("skipped groups are not indexed, but later groups are"){
+        DCMA_DICOM::ReadOptions opts;
+        opts.skip_groups = { 0x3006 };
+        DCMA_DICOM::TreeView view;
+        view.read_DICOM(buf, {}, opts);
+        CHECK(view.find(0x3006, 0x0020) == nullptr);
+        CHECK(view.find(0x3006, 0x0026) == nullptr);
+        REQUIRE(view.find(0x7FE0, 0x0010) != nullptr);
+        CHECK(view.find(0x7FE0, 0x0010)->raw.size() == 12);
+    }
+
+    SUBCASE("reading stops after the requested tag"){
+        DCMA_DICOM::ReadOptions opts;
+        opts.stop_after = std::make_pair<uint16_t, uint16_t>(0x0008, 0x0060);
+        DCMA_DICOM::TreeView view;
+        view.read_DICOM(buf, {}, opts);
+        REQUIRE(view.find(0x0008, 0x0060) != nullptr);
+        CHECK(view.find(0x0008, 0x0060)->value() == "CT");
+        CHECK(view.find(0x0010, 0x0010) == nullptr);
+    }
+}
+
+TEST_CASE("DCMA_DICOM stream and memory-mapped reader benchmark"){
+    // Synthesize files resembling CT, RTDOSE, and RTSTRUCT objects, which respectively feature a moderate PixelData
+    // payload, a large multi-frame PixelData payload, and many deeply-nested sequence items.
+    const auto make_image = [](int64_t rows, int64_t cols, int64_t frames, int64_t bytes_per_pixel){
+        auto root = create_minimal_dicom_tree(DCMA_DICOM::Encoding::ELE);
+        root.emplace_child_node({{0x0028, 0x0008}, "IS", std::to_string(frames)}); // NumberOfFrames.
+        root.emplace_child_node({{0x7FE0, 0x0010}, "OW", std::string(rows*cols*frames*bytes_per_pixel, '\x02')});
+        return root;
+    };
+    const auto make_rtstruct = [](int64_t N_rois, int64_t N_contours, int64_t N_vertices){
+        auto root = create_minimal_dicom_tree(DCMA_DICOM::Encoding::ELE);
+        std::string contour_data;
+        for(int64_t i = 0; i < N_vertices * 3; ++i){
+            contour_data += (contour_data.empty() ? "" : "\\") + std::to_string(i % 500) + ".25";
+        }
+
+        auto *roi_contour_seq = root.emplace_child_node({{0x3006, 0x0039}, "SQ", ""}); // ROIContourSequence.
+        for(int64_t r = 0; r < N_rois; ++r){
+            DCMA_DICOM::Node roi_item;
+            roi_item.key = {0x3006, 0x0039};
+            roi_item.VR = "MULTI";
+            roi_item.emplace_child_node({{0x3006, 0x0084}, "IS", std::to_string(r)}); // ReferencedROINumber.
+            auto *contour_seq = roi_item.emplace_child_node({{0x3006, 0x0040}, "SQ", ""}); // ContourSequence.
+            for(int64_t c = 0; c < N_contours; ++c){
+                DCMA_DICOM::Node contour_item;
+                contour_item.key = {0x3006, 0x0040};
+                contour_item.VR = "MULTI";
+                contour_item.emplace_child_node({{0x3006, 0x0042}, "CS", "CLOSED_PLANAR"}); // ContourGeometricType.
+                contour_item.emplace_child_node({{0x3006, 0x0046}, "IS", std::to_string(N_vertices)}); // NumberOfContourPoints.
+                contour_item.emplace_child_node({{0x3006, 0x0050}, "DS", contour_data}); // ContourData.
+                contour_seq->emplace_child_node(std::move(contour_item));
+            }
+            roi_contour_seq->emplace_child_node(std::move(roi_item));
+        }
+        return root;
+    };
+
+    const std::list<std::pair<std::string, DCMA_DICOM::Node>> corpus = {
+        { "CT",       make_image(512, 512, 1, 2) },
+        { "RTDOSE",   make_image(128, 128, 64, 4) },
+        { "RTSTRUCT", make_rtstruct(20, 50, 100) },
+    };
+
+    for(const auto &[name, root] : corpus){
+        std::stringstream ss;
+        root.emit_DICOM(ss, DCMA_DICOM::Encoding::ELE);
+        REQUIRE(ss.good());
+        auto buf = std::make_shared<const std::string>(ss.str());
+
+        const auto time_us = [](const std::function<void()> &f){
+            const auto t_start = std::chrono::steady_clock::now();
+            f();
+            const auto t_end = std::chrono::steady_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start).count();
+        };
+
+        size_t N_stream = 0;
+        const auto stream_us = time_us([&](){
+            std::istringstream iss(*buf);
+            DCMA_DICOM::Node n;
+            n.read_DICOM(iss);
+            N_stream = n.find_all(0x3006, 0x0050).size();
+        });
+
+        size_t N_view = 0;
+        const auto view_us = time_us([&](){
+            DCMA_DICOM::TreeView view;
+            view.read_DICOM(buf);
+            N_view = view.find_all(0x3006, 0x0050).size();
+        });
+        CHECK(N_stream == N_view);
+
+        bool found_modality = false;
+        const auto header_us = time_us([&](){
+            DCMA_DICOM::ReadOptions opts;
+            opts.stop_after = std::make_pair<uint16_t, uint16_t>(0x0028, 0x0011);
+            opts.skip_groups = { 0x3006 };
+            DCMA_DICOM::TreeView view;
+            view.read_DICOM(buf, {}, opts);
+            found_modality = (view.find(0x0008, 0x0060) != nullptr);
+        });
+        CHECK(found_modality);
+
+        MESSAGE(name << " (" << buf->size() << " bytes): stream reader " << stream_us << " us,"
+                     << " memory-mapped reader " << view_us << " us,"
+                     << " memory-mapped header-only reader " << header_us << " us");
+    }
+}
+
+
 // ============================================================================
 // Remove / remove_all tests
 // ============================================================================
@@ -1148,6 +1375,162 @@ TEST_CASE("DCMA_DICOM extract_native_pixel_data Double Float Pixel Data (7FE0,00
     CHECK(img.value(0, 1, 0) == doctest::Approx(-1.0e10f).epsilon(1e-3));
 }
 
+TEST_CASE("DCMA_DICOM decode_native_samples kernels agree with a reference decode"){
+    std::mt19937 re(12345);
+    std::uniform_int_distribution<int> rd(0, 255);
+
+    // An odd count exercises the vectorized bodies and the scalar remainders.
+    const uint64_t N = 1037;
+    std::string raw(N * 4, '\0');
+    for(auto &c : raw) c = static_cast<char>(rd(re));
+    const auto *src = reinterpret_cast<const uint8_t*>(raw.data());
+
+    // Straightforward reference decode.
+    const auto reference = [&](const DCMA_DICOM::NativeSampleDecodeParams &p, uint64_t i) -> double {
+        uint64_t w = 0;
+        const uint64_t bytes = p.bits_allocated / 8u;
+        for(uint64_t b = 0; b < bytes; ++b){
+            const uint64_t byte = src[i * bytes + (p.byte_swap ? (bytes - 1u - b) : b)];
+            w |= (byte << (8u * b)); // Test hosts are little-endian.
+        }
+        const uint64_t low_bit = p.high_bit + 1u - p.bits_stored;
+        w = (w >> low_bit) & ((uint64_t(1) << p.bits_stored) - 1u);
+        int64_t v = static_cast<int64_t>(w);
+        if(p.is_signed && (w & (uint64_t(1) << (p.bits_stored - 1u)))){
+            v -= (int64_t(1) << p.bits_stored);
+        }
+        return p.slope * static_cast<double>(v) + p.intercept;
+    };
+
+    struct layout { uint16_t ba; uint16_t bs; uint16_t hb; };
+    const std::vector<layout> layouts = { { 8,  8,  7}, { 8,  6,  6},
+                                          {16, 16, 15}, {16, 12, 11}, {16, 12, 13}, {16, 10, 15},
+                                          {32, 32, 31}, {32, 24, 27} };
+    const std::vector<DCMA_DICOM::SampleDecodeKernel> kernels = { DCMA_DICOM::SampleDecodeKernel::Scalar,
+                                                                  DCMA_DICOM::SampleDecodeKernel::SSE41,
+                                                                  DCMA_DICOM::SampleDecodeKernel::AVX2 };
+    for(const auto &l : layouts){
+        for(const bool is_signed : { false, true }){
+            for(const bool byte_swap : { false, true }){
+                DCMA_DICOM::NativeSampleDecodeParams p;
+                p.bits_allocated = l.ba;
+                p.bits_stored    = l.bs;
+                p.high_bit       = l.hb;
+                p.is_signed      = is_signed;
+                p.byte_swap      = byte_swap;
+                p.slope          = 0.3725;
+                p.intercept      = -1024.123;
+
+                std::vector<float> scalar_out(N);
+                DCMA_DICOM::decode_native_samples(src, N, p, scalar_out.data(), DCMA_DICOM::SampleDecodeKernel::Scalar);
+                for(uint64_t i = 0; i < N; ++i){
+                    // The rescale is rounded once, so the result is exact.
+                    REQUIRE(scalar_out[i] == static_cast<float>(reference(p, i)));
+                }
+
+                for(const auto k : kernels){
+                    if(!DCMA_DICOM::sample_decode_kernel_is_supported(k)) continue;
+                    std::vector<float> out(N, -1.0f);
+                    DCMA_DICOM::decode_native_samples(src, N, p, out.data(), k);
+                    for(uint64_t i = 0; i < N; ++i){
+                        REQUIRE(out[i] == scalar_out[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    SUBCASE("invalid parameters are rejected"){
+        DCMA_DICOM::NativeSampleDecodeParams p;
+        std::vector<float> out(N);
+        p.bits_allocated = 12;
+        CHECK_THROWS(DCMA_DICOM::decode_native_samples(src, N, p, out.data()));
+        p.bits_allocated = 16;
+        p.bits_stored = 12;
+        p.high_bit = 9;
+        CHECK_THROWS(DCMA_DICOM::decode_native_samples(src, N, p, out.data()));
+    }
+}
+
+TEST_CASE("DCMA_DICOM extract_native_pixel_data fuses the modality LUT"){
+    std::mt19937 re(54321);
+    std::uniform_int_distribution<int> rd(0, 255);
+
+    // Three frames of a 12-bit signed image.
+    const uint16_t rows = 13;
+    const uint16_t cols = 17;
+    const uint32_t frames = 3;
+    std::string raw(static_cast<size_t>(rows) * cols * frames * 2, '\0');
+    for(auto &c : raw) c = static_cast<char>(rd(re));
+
+    auto root = create_image_dicom(rows, cols, 16, 12, 11, 1, "MONOCHROME2", raw);
+    root.emplace_child_node({{0x0028, 0x0008}, "IS", std::to_string(frames)});
+    root.emplace_child_node({{0x0028, 0x1053}, "DS", "0.3725"});
+    root.emplace_child_node({{0x0028, 0x1052}, "DS", "-1024.123"});
+
+    const auto mlut = DCMA_DICOM::get_modality_lut_params(root);
+    REQUIRE(mlut.has_value());
+
+    auto separate = DCMA_DICOM::extract_native_pixel_data(root);
+    const auto fused = DCMA_DICOM::extract_native_pixel_data(root, mlut);
+    REQUIRE(separate.has_value());
+    REQUIRE(fused.has_value());
+    REQUIRE(separate->images.size() == frames);
+    REQUIRE(fused->images.size() == frames);
+
+    auto s_it = separate->images.begin();
+    for(const auto &f_img : fused->images){
+        DCMA_DICOM::apply_modality_lut(*s_it, *mlut);
+        REQUIRE(f_img.rows == rows);
+        REQUIRE(f_img.columns == cols);
+        for(int64_t r = 0; r < rows; ++r){
+            for(int64_t c = 0; c < cols; ++c){
+                REQUIRE(f_img.value(r, c, 0) == s_it->value(r, c, 0));
+            }
+        }
+        ++s_it;
+    }
+
+    SUBCASE("short buffers are rejected"){
+        auto short_root = create_image_dicom(rows, cols, 16, 12, 11, 1, "MONOCHROME2", raw.substr(0, raw.size() - 2));
+        short_root.emplace_child_node({{0x0028, 0x0008}, "IS", std::to_string(frames)});
+        CHECK_FALSE(DCMA_DICOM::extract_native_pixel_data(short_root, mlut).has_value());
+    }
+}
+
+TEST_CASE("DCMA_DICOM native sample decoding benchmark"){
+    // A 1024x1024 16-bit frame, representative of XA and RT image series.
+    const uint64_t N = 1024 * 1024;
+    std::string raw(N * 2, '\0');
+    for(uint64_t i = 0; i < N; ++i){
+        const auto v = static_cast<uint16_t>((i * 2654435761u) >> 20);
+        std::memcpy(&raw[i * 2], &v, 2);
+    }
+    const auto *src = reinterpret_cast<const uint8_t*>(raw.data());
+
+    DCMA_DICOM::NativeSampleDecodeParams p;
+    p.bits_stored = 12;
+    p.high_bit = 11;
+    p.slope = 1.0;
+    p.intercept = -1024.0;
+
+    std::vector<float> out(N);
+    for(const auto k : { DCMA_DICOM::SampleDecodeKernel::Scalar,
+                         DCMA_DICOM::SampleDecodeKernel::SSE41,
+                         DCMA_DICOM::SampleDecodeKernel::AVX2 }){
+        if(!DCMA_DICOM::sample_decode_kernel_is_supported(k)) continue;
+        const int64_t reps = 20;
+        const auto t_start = std::chrono::steady_clock::now();
+        for(int64_t i = 0; i < reps; ++i){
+            DCMA_DICOM::decode_native_samples(src, N, p, out.data(), k);
+        }
+        const auto t_stop = std::chrono::steady_clock::now();
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(t_stop - t_start).count() / reps;
+        MESSAGE("Kernel " << static_cast<int>(k) << " decoded 1024x1024 16-bit samples in " << us << " us");
+        CHECK(out[1] == doctest::Approx(static_cast<double>(((2654435761u) >> 20) & 0xFFF) - 1024.0));
+    }
+}
+
 
 // ============================================================================
 // Overlay data extraction tests
@@ -1196,9 +1579,9 @@ TEST_CASE("DCMA_DICOM extract_overlay_data returns empty for no overlays"){
 // Encapsulated pixel data test (JPEG baseline 8-bit)
 // ============================================================================
 
-TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data JPEG baseline grayscale"){
-    // A pre-generated 2x2 grayscale JPEG (quality 100) with pixel values [10, 80, 160, 240].
-    // Generated using Pillow: Image.new('L', (2,2)); putpixel values; save JPEG q=100.
+// A pre-generated 2x2 grayscale JPEG (quality 100) with pixel values [10, 80, 160, 240].
+// Generated using Pillow: Image.new('L', (2,2)); putpixel values; save JPEG q=100.
+static std::string create_baseline_jpeg_2x2(){
     static const uint8_t jpeg_data[] = {
         0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
         0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
@@ -1234,7 +1617,11 @@ TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data JPEG baseline grayscale"){
         0x4f, 0x26, 0xbf, 0xff, 0xd9
     };
 
-    std::string jpeg_str(reinterpret_cast<const char*>(jpeg_data), sizeof(jpeg_data));
+    return std::string(reinterpret_cast<const char*>(jpeg_data), sizeof(jpeg_data));
+}
+
+TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data JPEG baseline grayscale"){
+    const auto jpeg_str = create_baseline_jpeg_2x2();
 
     DCMA_DICOM::Node root;
     root.emplace_child_node({{0x0002, 0x0010}, "UI", "1.2.840.10008.1.2.4.50"});  // JPEG Baseline.
@@ -1263,6 +1650,146 @@ TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data JPEG baseline grayscale"){
     CHECK(std::abs(img.value(1, 1, 0) - 240.0f) <= 1.0f);
 }
 
+TEST_CASE("DCMA_DICOM locate_encapsulated_frames"){
+    const std::vector<std::string> payloads = { "\xFF\xD8" "aa", "bbbb", "\xFF\xD8" "cc", "\xFF\xD8" "dddd" };
+    std::vector<std::string_view> fragments(payloads.begin(), payloads.end());
+
+    // Little-endian offset tables. Each fragment occupies 8 bytes for its Item tag and length.
+    const auto make_table = [](const std::vector<uint64_t> &offsets, size_t width){
+        std::string out;
+        for(const auto o : offsets){
+            for(size_t i = 0; i < width; ++i) out.push_back(static_cast<char>((o >> (8u * i)) & 0xFFu));
+        }
+        return out;
+    };
+    const auto bot = make_table({ 0, 24, 36 }, 4);
+    const auto eot = make_table({ 0, 24, 36 }, 8);
+
+    SUBCASE("single frames include all fragments"){
+        const auto frames = DCMA_DICOM::locate_encapsulated_frames(fragments, {}, 1);
+        REQUIRE(frames.has_value());
+        REQUIRE(frames->size() == 1);
+        CHECK(frames->front().size() == 4);
+    }
+    SUBCASE("the Basic Offset Table is used"){
+        const auto frames = DCMA_DICOM::locate_encapsulated_frames(fragments, bot, 3);
+        REQUIRE(frames.has_value());
+        REQUIRE(frames->size() == 3);
+        CHECK(frames->at(0).size() == 2);
+        CHECK(frames->at(1).size() == 1);
+        CHECK(frames->at(2).front() == payloads.at(3));
+    }
+    SUBCASE("the Extended Offset Table takes precedence"){
+        const auto bad_bot = make_table({ 0, 12, 36 }, 4);
+        const auto frames = DCMA_DICOM::locate_encapsulated_frames(fragments, bad_bot, 3, eot);
+        REQUIRE(frames.has_value());
+        REQUIRE(frames->size() == 3);
+        CHECK(frames->at(0).size() == 2);
+    }
+    SUBCASE("inconsistent offset tables are ignored in favour of JPEG markers"){
+        const auto bad_bot = make_table({ 0, 13, 36 }, 4);
+        const auto frames = DCMA_DICOM::locate_encapsulated_frames(fragments, bad_bot, 3);
+        REQUIRE(frames.has_value());
+        REQUIRE(frames->size() == 3);
+        CHECK(frames->at(0).size() == 2);
+    }
+    SUBCASE("one fragment per frame is assumed without an offset table"){
+        const auto frames = DCMA_DICOM::locate_encapsulated_frames(fragments, {}, 4);
+        REQUIRE(frames.has_value());
+        CHECK(frames->size() == 4);
+    }
+    SUBCASE("undeterminable boundaries are reported"){
+        CHECK_FALSE(DCMA_DICOM::locate_encapsulated_frames(fragments, {}, 2).has_value());
+        CHECK_FALSE(DCMA_DICOM::locate_encapsulated_frames({}, {}, 1).has_value());
+    }
+}
+
+TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data multi-frame JPEG baseline"){
+    const auto jpeg_str = create_baseline_jpeg_2x2();
+    const uint32_t N_frames = 5;
+
+    DCMA_DICOM::Node root;
+    root.emplace_child_node({{0x0002, 0x0010}, "UI", "1.2.840.10008.1.2.4.50"});  // JPEG Baseline.
+    root.emplace_child_node({{0x0028, 0x0002}, "US", "1"});
+    root.emplace_child_node({{0x0028, 0x0004}, "CS", "MONOCHROME2"});
+    root.emplace_child_node({{0x0028, 0x0008}, "IS", std::to_string(N_frames)});
+    root.emplace_child_node({{0x0028, 0x0010}, "US", "2"});
+    root.emplace_child_node({{0x0028, 0x0011}, "US", "2"});
+    root.emplace_child_node({{0x0028, 0x0100}, "US", "8"});
+    root.emplace_child_node({{0x0028, 0x0101}, "US", "8"});
+    root.emplace_child_node({{0x0028, 0x0102}, "US", "7"});
+    root.emplace_child_node({{0x0028, 0x0103}, "US", "0"});
+
+    const auto check_frames = [&](const std::optional<planar_image_collection<float,double>> &pics){
+        REQUIRE(pics.has_value());
+        REQUIRE(pics->images.size() == N_frames);
+        for(const auto &img : pics->images){
+            REQUIRE(img.rows == 2);
+            REQUIRE(img.columns == 2);
+            REQUIRE(img.channels == 1);
+            CHECK(std::abs(img.value(0, 0, 0) - 10.0f) <= 1.0f);
+            CHECK(std::abs(img.value(1, 1, 0) - 240.0f) <= 1.0f);
+        }
+    };
+
+    // Fragments are padded to an even length. The first frame is split over two fragments.
+    std::vector<std::string> fragments;
+    for(uint32_t i = 0; i < N_frames; ++i){
+        if(i == 0){
+            fragments.push_back(jpeg_str.substr(0, 100));
+            fragments.push_back(jpeg_str.substr(100));
+        }else{
+            fragments.push_back(jpeg_str);
+        }
+        if(fragments.back().size() % 2 != 0) fragments.back().push_back('\0');
+    }
+
+    SUBCASE("concatenated fragments in a Node"){
+        std::string concatenated;
+        for(const auto &f : fragments) concatenated += f;
+        root.emplace_child_node({{0x7FE0, 0x0010}, "OB", concatenated});
+        check_frames(DCMA_DICOM::extract_encapsulated_pixel_data(root, 3));
+    }
+
+    SUBCASE("individual fragments in a TreeView"){
+        std::stringstream ss;
+        root.emit_DICOM(ss, DCMA_DICOM::Encoding::ELE);
+        REQUIRE(ss.good());
+        std::string buf = ss.str();
+
+        const auto append_u16 = [&](uint16_t v){ buf.push_back(static_cast<char>(v & 0xFF)); buf.push_back(static_cast<char>(v >> 8)); };
+        const auto append_u32 = [&](uint32_t v){ append_u16(static_cast<uint16_t>(v & 0xFFFF)); append_u16(static_cast<uint16_t>(v >> 16)); };
+
+        // Basic Offset Table.
+        std::vector<uint32_t> offsets;
+        uint32_t pos = 0;
+        for(size_t i = 0; i < fragments.size(); ++i){
+            if(i != 1) offsets.push_back(pos);
+            pos += 8 + static_cast<uint32_t>(fragments[i].size());
+        }
+
+        append_u16(0x7FE0); append_u16(0x0010); buf += "OB"; append_u16(0); append_u32(0xFFFFFFFF);
+        append_u16(0xFFFE); append_u16(0xE000); append_u32(static_cast<uint32_t>(offsets.size() * 4));
+        for(const auto o : offsets) append_u32(o);
+        for(const auto &f : fragments){
+            append_u16(0xFFFE); append_u16(0xE000); append_u32(static_cast<uint32_t>(f.size()));
+            buf += f;
+        }
+        append_u16(0xFFFE); append_u16(0xE0DD); append_u32(0);
+
+        DCMA_DICOM::TreeView view;
+        view.read_DICOM(std::make_shared<const std::string>(buf));
+        check_frames(DCMA_DICOM::extract_encapsulated_pixel_data(view, 3));
+
+        // Frame count mismatches are rejected.
+        REQUIRE(view.find(0x0028, 0x0008) != nullptr);
+        auto *nf = &view.nodes.at(static_cast<size_t>(view.find(0x0028, 0x0008) - view.nodes.data()));
+        const std::string two = "2 ";
+        nf->raw = two;
+        CHECK_FALSE(DCMA_DICOM::extract_encapsulated_pixel_data(view).has_value());
+    }
+}
+
 TEST_CASE("DCMA_DICOM extract_encapsulated_pixel_data returns nullopt for unsupported TS"){
     // JPEG 2000 is not supported.
     DCMA_DICOM::Node root;
@@ -5,18 +5,30 @@
 
 #include <exception>
 #include <fstream>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>    
 #include <cstdint>
 //#include <cfenv>              //Needed for std::feclearexcept(FE_ALL_EXCEPT).
 
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include <boost/algorithm/string/predicate.hpp>
 #include <filesystem>
 #include <algorithm>
 #include <cstdlib>            //Needed for exit() calls.
 
+#if defined(__linux__)
+    #include <fcntl.h>        //Needed for posix_fadvise().
+    #include <unistd.h>
+#endif
+
 #include "Explicator.h"       //Needed for Explicator class.
 #include "Imebra_Shim.h"      //Wrapper for Imebra library. Black-boxed to speed up compilation.
 #include "Structs.h"
@@ -24,6 +36,7 @@
 #include "YgorMath.h"         //Needed for vec3 class.
 #include "YgorMisc.h"         //Needed for FUNCINFO, FUNCWARN, FUNCERR macros.
 #include "YgorLog.h"
+#include "YgorThreadPool.h"   //Needed for work_queue.
 
 
 static
@@ -37,8 +50,135 @@ Concatenate_Contour_Data(std::unique_ptr<Contour_Data> A,
 }
 
 
+// Determine how many files to parse concurrently.
+//
+// The default is to use all available cores, but this can be limited (e.g., to reduce contention on network-backed
+// storage) by setting the 'DICOMLoaderConcurrency' invocation metadata key or the 'DCMA_DICOM_LOADER_CONCURRENCY'
+// environment variable to a positive integer. The invocation metadata takes priority. Other values are rejected.
+static
+uint32_t
+get_loader_concurrency(const std::map<std::string,std::string> &InvocationMetadata){
+    const auto hw = std::max<uint32_t>(1U, std::thread::hardware_concurrency());
+
+    std::string setting;
+    if(const auto it = InvocationMetadata.find("DICOMLoaderConcurrency"); it != InvocationMetadata.end()){
+        setting = it->second;
+    }else if(const char *env = std::getenv("DCMA_DICOM_LOADER_CONCURRENCY"); env != nullptr){
+        setting = env;
+    }
+    if(setting.empty()) return hw;
+
+    int64_t n = 0;
+    try{
+        size_t pos = 0;
+        n = std::stol(setting, &pos);
+        if(pos != setting.size()) n = 0;
+    }catch(const std::exception &){}
+    if( (n <= 0) || (std::numeric_limits<uint32_t>::max() < n) ){
+        throw std::invalid_argument("DICOM loader concurrency setting '" + setting + "' is not a positive integer");
+    }
+    return static_cast<uint32_t>(n);
+}
+
+// Determine whether image pixel data should be decoded at load time or deferred until an operation needs it.
+//
+// Deferral is enabled by setting the 'DICOMLazyPixelData' invocation metadata key or the 'DCMA_DICOM_LAZY_PIXEL_DATA'
+// environment variable to 'true'. The invocation metadata takes priority.
+static
+bool
+get_lazy_pixel_data(const std::map<std::string,std::string> &InvocationMetadata){
+    std::string setting;
+    if(const auto it = InvocationMetadata.find("DICOMLazyPixelData"); it != InvocationMetadata.end()){
+        setting = it->second;
+    }else if(const char *env = std::getenv("DCMA_DICOM_LAZY_PIXEL_DATA"); env != nullptr){
+        setting = env;
+    }
+    return boost::iequals(setting, "true") || (setting == "1");
+}
+
+// Hint to the OS that a file will be read soon so that I/O can proceed before a worker begins parsing it.
+// This is purely advisory and failures are ignored.
+static
+void
+prefetch_file(const std::filesystem::path &p){
+#if defined(__linux__)
+    const int fd = ::open(p.c_str(), O_RDONLY);
+    if(fd < 0) return;
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    ::close(fd);
+#else
+    (void)(p);
+#endif
+    return;
+}
+
+// Holds the result of parsing a single file, so that files can be parsed out-of-order but consumed in-order.
+struct dicom_ingest_result_t {
+    std::string modality;
+    std::exception_ptr error;                    // Non-null iff parsing failed.
+
+    std::unique_ptr<Image_Array> img_arr;        // Images and dose arrays.
+    std::unique_ptr<Contour_Data> contour_data;  // RTSTRUCTs.
+    std::unique_ptr<RTPlan> rtplan;              // RTPLANs.
+    std::unique_ptr<Transform3> transform;       // REGs.
+};
+
+static
+std::string
+describe_exception(const std::exception_ptr &e){
+    try{
+        if(e) std::rethrow_exception(e);
+    }catch(const std::exception &ex){
+        return ex.what();
+    }catch(...){
+        return "unknown exception";
+    }
+    return "";
+}
+
+static
+bool
+is_image_modality(const std::string &Modality){
+    return boost::iequals(Modality,"CT")
+        || boost::iequals(Modality,"OT")
+        || boost::iequals(Modality,"US")
+        || boost::iequals(Modality,"MR")
+        || boost::iequals(Modality,"RTIMAGE")
+        || boost::iequals(Modality,"PT");
+}
+
+// Parse a single file. Only the modality-specific loader is invoked, and all exceptions are captured.
+static
+void
+ingest_file(const std::filesystem::path &Filename, bool defer_pixel_data, dicom_ingest_result_t &r){
+    try{
+        r.modality = get_modality(Filename);
+    }catch(const std::exception &e){
+        YLOGWARN("Unable to extract modality ('" << e.what() << "')");
+        r.modality = "";
+    };
+
+    try{
+        if(boost::iequals(r.modality,"REG")){
+            r.transform = Load_Transform(Filename);
+        }else if(boost::iequals(r.modality,"RTPLAN")){
+            r.rtplan = Load_RTPlan(Filename);
+        }else if(boost::iequals(r.modality,"RTSTRUCT")){
+            r.contour_data = get_Contour_Data(Filename);
+        }else if(boost::iequals(r.modality,"RTDOSE")){
+            r.img_arr = Load_Dose_Array(Filename);
+        }else if(is_image_modality(r.modality)){
+            r.img_arr = Load_Image_Array(Filename, defer_pixel_data);
+        }
+    }catch(...){
+        r.error = std::current_exception();
+    }
+    return;
+}
+
+
 bool Load_From_DICOM_Files( Drover &DICOM_data,
-                            std::map<std::string,std::string> & /* InvocationMetadata */,
+                            std::map<std::string,std::string> &InvocationMetadata,
                             const std::string &FilenameLex,
                             std::list<std::filesystem::path> &Filenames ){
 
@@ -61,22 +201,47 @@ bool Load_From_DICOM_Files( Drover &DICOM_data,
     loaded_imgs_storage.emplace_back();
     loaded_dose_storage.emplace_back();
 
-    size_t i = 0;
     const size_t N = Filenames.size();
 
+    // Parse all files concurrently. Each file is parsed independently (both header and pixel data) and results are
+    // written into pre-allocated slots so that the order files are consumed below is deterministic, regardless of the
+    // order in which parsing completes.
+    std::vector<dicom_ingest_result_t> results(N);
+    {
+        const auto concurrency = get_loader_concurrency(InvocationMetadata);
+        const auto defer_pixel_data = get_lazy_pixel_data(InvocationMetadata);
+        const std::vector<std::filesystem::path> paths(Filenames.begin(), Filenames.end());
+
+        // Files are claimed in order, so prefetching the file 'concurrency' ahead of the current one keeps I/O for the
+        // next round of parsing in flight while the current round is parsed.
+        const size_t prefetch_N = std::min<size_t>(N, concurrency);
+        for(size_t i = 0; i < prefetch_N; ++i) prefetch_file(paths[i]);
+
+        std::mutex printer;
+        size_t completed = 0;
+
+        work_queue<std::function<void(void)>> wq(concurrency);
+        for(size_t i = 0; i < N; ++i){
+            wq.submit_task([&,i]() -> void {
+                if((i + prefetch_N) < N) prefetch_file(paths[i + prefetch_N]);
+
+                ingest_file(paths[i], defer_pixel_data, results[i]);
+
+                std::lock_guard<std::mutex> lock(printer);
+                ++completed;
+                YLOGINFO("Parsed file #" << completed << "/" << N << " = " << 100*completed/N << "% \t" << paths[i]);
+            });
+        }
+    } // Wait for all parsing to complete.
+
+    // Consume the parsed files in the original order.
+    size_t i = 0;
     auto bfit = Filenames.begin();
     while(bfit != Filenames.end()){
-        YLOGINFO("Parsing file #" << i+1 << "/" << N << " = " << 100*(i+1)/N << "% \t" << *bfit);
+        auto &r = results[i];
         ++i;
 
-        const auto Filename = *bfit;
-        std::string Modality;
-        try{
-            Modality = get_modality(Filename);
-        }catch(const std::exception &e){
-            YLOGWARN("Unable to extract modality ('" << e.what() << "')");
-            Modality = "";
-        };
+        const auto &Modality = r.modality;
 
         if(boost::iequals(Modality,"RTRECORD")){
             YLOGWARN("RTRECORD file encountered. "
@@ -89,9 +254,8 @@ bool Load_From_DICOM_Files( Drover &DICOM_data,
             YLOGWARN("REG file support is experimental");
 
             try{
-                auto t = Load_Transform(Filename);
-if(t == nullptr) YLOGWARN("(t == nullptr)");
-if(std::get_if<std::monostate>(&(t->transform)) != nullptr) YLOGWARN("(std::get_if<std::monostate>(&(t->transform)) != nullptr)");
+                if(r.error) std::rethrow_exception(r.error);
+                auto &t = r.transform;
                 if( (t == nullptr)
                 ||  (std::get_if<std::monostate>(&(t->transform)) != nullptr) ){
                     throw std::runtime_error("unable to extract transformation");
@@ -103,8 +267,6 @@ if(std::get_if<std::monostate>(&(t->transform)) != nullptr) YLOGWARN("(std::get_
                 YLOGWARN("Difficulty encountered during registration transform loading: '" << e.what() << "'. Refusing to continue");
 
                 return false;
-                //bfit = Filenames.erase( bfit ); 
-                //continue;
             }
 
             bfit = Filenames.erase( bfit );  // Consume the file; we know what it is, but cannot make use of it.
@@ -112,25 +274,23 @@ if(std::get_if<std::monostate>(&(t->transform)) != nullptr) YLOGWARN("(std::get_
         }else if(boost::iequals(Modality,"RTPLAN")){
             YLOGWARN("RTPLAN file support is experimental");
 
-            auto rtplan = Load_RTPlan(Filename);
-            DICOM_data.rtplan_data.emplace_back( std::move(rtplan) );
+            if(r.error) std::rethrow_exception(r.error);
+            DICOM_data.rtplan_data.emplace_back( std::move(r.rtplan) );
 
             bfit = Filenames.erase( bfit ); 
 
         }else if(boost::iequals(Modality,"RTSTRUCT")){
-            const auto preloadcount = loaded_contour_data_storage->ccs.size();
-            try{
-                auto combined = Concatenate_Contour_Data( loaded_contour_data_storage->Duplicate(),
-                                                          get_Contour_Data(Filename));
-                loaded_contour_data_storage = std::move(combined);
-
-            }catch(const std::exception &e){
-                YLOGWARN("Difficulty encountered during contour data loading: '" << e.what() << "'. Ignoring file and continuing");
-                //loaded_contour_data_storage.back().pop_back();
+            if(r.error){
+                YLOGWARN("Difficulty encountered during contour data loading: '" << describe_exception(r.error) << "'. Ignoring file and continuing");
                 bfit = Filenames.erase( bfit ); 
                 continue;
             }
 
+            const auto preloadcount = loaded_contour_data_storage->ccs.size();
+            auto combined = Concatenate_Contour_Data( loaded_contour_data_storage->Duplicate(),
+                                                      std::move(r.contour_data) );
+            loaded_contour_data_storage = std::move(combined);
+
             const auto postloadcount = loaded_contour_data_storage->ccs.size();
             if(postloadcount == preloadcount){
                 YLOGWARN("RTSTRUCT file was loaded, but contained no ROIs");
@@ -143,32 +303,22 @@ if(std::get_if<std::monostate>(&(t->transform)) != nullptr) YLOGWARN("(std::get_
             bfit = Filenames.erase( bfit ); 
 
         }else if(boost::iequals(Modality,"RTDOSE")){
-            try{
-                loaded_dose_storage.back().push_back( Load_Dose_Array(Filename));
-            }catch(const std::exception &e){
-                YLOGWARN("Difficulty encountered during dose array loading: '" << e.what() << "'. Ignoring file and continuing");
-                //loaded_dose_storage.back().pop_back();
+            if(r.error){
+                YLOGWARN("Difficulty encountered during dose array loading: '" << describe_exception(r.error) << "'. Ignoring file and continuing");
                 bfit = Filenames.erase( bfit ); 
                 continue;
             }
+            loaded_dose_storage.back().push_back( std::move(r.img_arr) );
 
             bfit = Filenames.erase( bfit ); 
 
-        }else if(  boost::iequals(Modality,"CT")
-                || boost::iequals(Modality,"OT")
-                || boost::iequals(Modality,"US")
-                || boost::iequals(Modality,"MR")
-                || boost::iequals(Modality,"RTIMAGE")
-                || boost::iequals(Modality,"PT") ){
-
-            try{
-                loaded_imgs_storage.back().push_back( Load_Image_Array(Filename));
-            }catch(const std::exception &e){
-                YLOGWARN("Difficulty encountered during image array loading: '" << e.what() << "'. Ignoring file and continuing");
-                //loaded_imgs_storage.back().pop_back();
+        }else if(is_image_modality(Modality)){
+            if(r.error){
+                YLOGWARN("Difficulty encountered during image array loading: '" << describe_exception(r.error) << "'. Ignoring file and continuing");
                 bfit = Filenames.erase( bfit ); 
                 continue;
             }
+            loaded_imgs_storage.back().push_back( std::move(r.img_arr) );
 
             bfit = Filenames.erase( bfit ); 
 
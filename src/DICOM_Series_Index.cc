@@ -0,0 +1,365 @@
+//DICOM_Series_Index.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file provides a header-only DICOM file scanner and a persistent index built from it.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "YgorMisc.h"
+#include "YgorLog.h"
+#include "YgorString.h"
+#include "YgorThreadPool.h"   //Needed for work_queue.
+
+#include "DCMA_DICOM.h"
+#include "Imebra_Shim.h"      //Needed for get_metadata_top_level_tags().
+#include "Metadata.h"
+#include "DICOM_Series_Index.h"
+
+
+// Revision 2 adds rejected entries. Revision 1 files are still accepted.
+static const std::string index_signature = "DCMA_DICOM_SERIES_INDEX 2";
+static const std::string index_signature_r1 = "DCMA_DICOM_SERIES_INDEX 1";
+
+// Rejected files are stored as 'R', mtime, size, and path. The marker can not be confused with an mtime.
+static const std::string rejected_marker = "R";
+
+// All indexed attributes reside in groups 0x0008 - 0x0028, so parsing can stop well before private groups, RT
+// sequences (e.g., ROIContourSequence), and PixelData, which contain the overwhelming majority of bytes.
+static const std::pair<uint16_t, uint16_t> scan_stop_tag = { 0x0029, 0x0000 };
+
+
+// Only consider top-level elements. Nested elements (e.g., in referenced-image sequences) describe other objects.
+static
+std::string
+get_top_level_value(const DCMA_DICOM::Node &root, uint16_t group, uint16_t tag){
+    for(const auto &c : root.children){
+        if( (c.key.group == group) && (c.key.tag == tag) ) return c.val;
+    }
+    return "";
+}
+
+static
+std::optional<std::pair<int64_t, uint64_t>>
+get_file_stamp(const std::filesystem::path &p){
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(p, ec);
+    if(ec) return {};
+    const auto mtime = std::filesystem::last_write_time(p, ec);
+    if(ec) return {};
+    return std::make_pair(static_cast<int64_t>(mtime.time_since_epoch().count()), static_cast<uint64_t>(size));
+}
+
+// Harvest the indexed attributes using the full loader. It is slower, since the whole file is parsed, but it accepts
+// files that the header scanner does not (e.g., files lacking the Part 10 preamble).
+static
+std::optional<dicom_file_summary_t>
+scan_with_loader(const std::filesystem::path &p){
+    metadata_map_t m;
+    try{
+        m = get_metadata_top_level_tags(p);
+    }catch(const std::exception &){
+        return {};
+    }
+    const auto get = [&](const std::string &key) -> std::string {
+        const auto it = m.find(key);
+        return (it == m.end()) ? std::string() : it->second;
+    };
+
+    dicom_file_summary_t out;
+    out.PatientID               = get("PatientID");
+    out.StudyInstanceUID        = get("StudyInstanceUID");
+    out.SeriesInstanceUID       = get("SeriesInstanceUID");
+    out.SOPInstanceUID          = get("SOPInstanceUID");
+    out.FrameOfReferenceUID     = get("FrameOfReferenceUID");
+    out.Modality                = get("Modality");
+
+    out.ImagePositionPatient    = get("ImagePositionPatient");
+    out.ImageOrientationPatient = get("ImageOrientationPatient");
+    out.PixelSpacing            = get("PixelSpacing");
+    out.SliceThickness          = get("SliceThickness");
+    out.Rows                    = get("Rows");
+    out.Columns                 = get("Columns");
+    out.NumberOfFrames          = get("NumberOfFrames");
+    return out;
+}
+
+std::optional<dicom_file_summary_t>
+Scan_DICOM_File_Header(const std::filesystem::path &p){
+    const auto stamp = get_file_stamp(p);
+    if(!stamp) return {};
+
+    // The header is read with ordinary stream I/O rather than memory-mapping the file. Files that are concurrently
+    // being written or truncated therefore produce a read error rather than SIGBUS.
+    std::optional<dicom_file_summary_t> out;
+    try{
+        std::ifstream ifs(p, std::ios::in | std::ios::binary);
+        if(!ifs) return {};
+        const std::vector<const DCMA_DICOM::DICOMDictionary*> dicts = { &DCMA_DICOM::get_default_dictionary() };
+        DCMA_DICOM::Node root;
+        root.read_DICOM(ifs, dicts, nullptr, scan_stop_tag);
+
+        out.emplace();
+        out->PatientID               = get_top_level_value(root, 0x0010, 0x0020);
+        out->StudyInstanceUID        = get_top_level_value(root, 0x0020, 0x000D);
+        out->SeriesInstanceUID       = get_top_level_value(root, 0x0020, 0x000E);
+        out->SOPInstanceUID          = get_top_level_value(root, 0x0008, 0x0018);
+        out->FrameOfReferenceUID     = get_top_level_value(root, 0x0020, 0x0052);
+        out->Modality                = get_top_level_value(root, 0x0008, 0x0060);
+
+        out->ImagePositionPatient    = get_top_level_value(root, 0x0020, 0x0032);
+        out->ImageOrientationPatient = get_top_level_value(root, 0x0020, 0x0037);
+        out->PixelSpacing            = get_top_level_value(root, 0x0028, 0x0030);
+        out->SliceThickness          = get_top_level_value(root, 0x0018, 0x0050);
+        out->Rows                    = get_top_level_value(root, 0x0028, 0x0010);
+        out->Columns                 = get_top_level_value(root, 0x0028, 0x0011);
+        out->NumberOfFrames          = get_top_level_value(root, 0x0028, 0x0008);
+    }catch(const std::exception &){
+        out.reset();
+    }
+
+    // Files lacking these are almost certainly not DICOM objects we can load. Before giving up, defer to the loader,
+    // since it is more lenient than the header scanner.
+    const auto is_loadable = [](const std::optional<dicom_file_summary_t> &s){
+        return s && (!s->SOPInstanceUID.empty() || !s->Modality.empty());
+    };
+    if(!is_loadable(out)){
+        out = scan_with_loader(p);
+        if(!is_loadable(out)) return {};
+    }
+
+    // If the file changed while it was being read, the contents may be inconsistent. Such files are not indexed, and
+    // since the recorded stamp is stale they will be scanned again.
+    if(get_file_stamp(p) != stamp) return {};
+
+    out->path  = p;
+    out->mtime = stamp->first;
+    out->size  = stamp->second;
+    return out;
+}
+
+
+// The index is stored as tab-separated text, one file per line. The path is the final field so it may contain any
+// character except a newline.
+static
+std::string
+sanitize_field(std::string s){
+    std::replace_if(s.begin(), s.end(), [](char c){ return (c == '\t') || (c == '\n') || (c == '\r'); }, ' ');
+    return s;
+}
+
+void
+DICOM_Series_Index::read(const std::filesystem::path &p){
+    this->entries.clear();
+    this->rejected.clear();
+
+    std::ifstream ifs(p, std::ios::in | std::ios::binary);
+    if(!ifs) return;
+
+    std::string line;
+    if( !std::getline(ifs, line)
+    ||  ( (line != index_signature) && (line != index_signature_r1) ) ){
+        throw std::runtime_error("Index file '"_s + p.string() + "' is not a recognized DICOM series index");
+    }
+
+    while(std::getline(ifs, line)){
+        if(line.empty()) continue;
+
+        if(line.rfind(rejected_marker + "\t", 0) == 0){
+            std::stringstream ss(line);
+            std::string marker, mtime, size, path;
+            std::getline(ss, marker, '\t');
+            std::getline(ss, mtime, '\t');
+            std::getline(ss, size, '\t');
+            std::getline(ss, path);
+            try{
+                if(path.empty()) throw std::invalid_argument("Missing path");
+                this->rejected[path] = std::make_pair(static_cast<int64_t>(std::stoll(mtime)),
+                                                      static_cast<uint64_t>(std::stoull(size)));
+            }catch(const std::exception &){
+                YLOGWARN("Ignoring malformed index entry");
+            }
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while( (fields.size() < 15) && std::getline(ss, field, '\t') ) fields.push_back(field);
+        std::getline(ss, field); // The remainder is the path.
+        if( (fields.size() != 15) || field.empty() ){
+            YLOGWARN("Ignoring malformed index entry");
+            continue;
+        }
+
+        dicom_file_summary_t s;
+        try{
+            s.mtime = std::stoll(fields.at(0));
+            s.size  = std::stoull(fields.at(1));
+        }catch(const std::exception &){
+            YLOGWARN("Ignoring malformed index entry");
+            continue;
+        }
+        s.PatientID               = fields.at(2);
+        s.StudyInstanceUID        = fields.at(3);
+        s.SeriesInstanceUID       = fields.at(4);
+        s.SOPInstanceUID          = fields.at(5);
+        s.FrameOfReferenceUID     = fields.at(6);
+        s.Modality                = fields.at(7);
+        s.ImagePositionPatient    = fields.at(8);
+        s.ImageOrientationPatient = fields.at(9);
+        s.PixelSpacing            = fields.at(10);
+        s.SliceThickness          = fields.at(11);
+        s.Rows                    = fields.at(12);
+        s.Columns                 = fields.at(13);
+        s.NumberOfFrames          = fields.at(14);
+        s.path = field;
+
+        auto l_path = s.path;
+        this->entries[l_path] = std::move(s);
+    }
+    return;
+}
+
+void
+DICOM_Series_Index::write(const std::filesystem::path &p) const {
+    // Write to a temporary file and then move it into place so that concurrent readers never observe a partial index.
+    auto p_tmp = p;
+    p_tmp += ".tmp";
+    {
+        std::ofstream ofs(p_tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!ofs) throw std::runtime_error("Unable to write index file '"_s + p_tmp.string() + "'");
+
+        ofs << index_signature << "\n";
+        for(const auto &e : this->entries){
+            const auto &s = e.second;
+            const auto path_str = s.path.string();
+            if(path_str.find('\n') != std::string::npos) continue;
+
+            ofs << s.mtime << "\t"
+                << s.size << "\t"
+                << sanitize_field(s.PatientID) << "\t"
+                << sanitize_field(s.StudyInstanceUID) << "\t"
+                << sanitize_field(s.SeriesInstanceUID) << "\t"
+                << sanitize_field(s.SOPInstanceUID) << "\t"
+                << sanitize_field(s.FrameOfReferenceUID) << "\t"
+                << sanitize_field(s.Modality) << "\t"
+                << sanitize_field(s.ImagePositionPatient) << "\t"
+                << sanitize_field(s.ImageOrientationPatient) << "\t"
+                << sanitize_field(s.PixelSpacing) << "\t"
+                << sanitize_field(s.SliceThickness) << "\t"
+                << sanitize_field(s.Rows) << "\t"
+                << sanitize_field(s.Columns) << "\t"
+                << sanitize_field(s.NumberOfFrames) << "\t"
+                << path_str << "\n";
+        }
+        for(const auto &r : this->rejected){
+            const auto path_str = r.first.string();
+            if(path_str.find('\n') != std::string::npos) continue;
+
+            ofs << rejected_marker << "\t"
+                << r.second.first << "\t"
+                << r.second.second << "\t"
+                << path_str << "\n";
+        }
+        ofs.flush();
+        if(!ofs) throw std::runtime_error("Unable to write index file '"_s + p_tmp.string() + "'");
+    }
+    std::filesystem::rename(p_tmp, p);
+    return;
+}
+
+int64_t
+DICOM_Series_Index::update(const std::list<std::filesystem::path> &files,
+                           uint32_t concurrency){
+
+    // Purge entries for files that have been removed.
+    const auto purge = [](auto &m){
+        for(auto it = m.begin(); it != m.end(); ){
+            std::error_code ec;
+            if(!std::filesystem::exists(it->first, ec)){
+                it = m.erase(it);
+            }else{
+                ++it;
+            }
+        }
+    };
+    purge(this->entries);
+    purge(this->rejected);
+
+    // Identify new or modified files.
+    std::vector<std::filesystem::path> stale;
+    for(const auto &f : files){
+        const auto it = this->entries.find(f);
+        if(it != this->entries.end()){
+            const auto stamp = get_file_stamp(f);
+            if( stamp
+            &&  (stamp->first == it->second.mtime)
+            &&  (stamp->second == it->second.size) ){
+                continue;
+            }
+            this->entries.erase(it);
+        }
+        const auto r_it = this->rejected.find(f);
+        if(r_it != this->rejected.end()){
+            const auto stamp = get_file_stamp(f);
+            if( stamp
+            &&  (stamp.value() == r_it->second) ){
+                continue;
+            }
+            this->rejected.erase(r_it);
+        }
+        stale.push_back(f);
+    }
+    if(stale.empty()) return 0;
+
+    YLOGINFO("Scanning " << stale.size() << " new or modified files for the DICOM index");
+    std::vector<std::optional<std::pair<int64_t, uint64_t>>> stamps(stale.size());
+    std::vector<std::optional<dicom_file_summary_t>> scanned(stale.size());
+    {
+        if(concurrency == 0) concurrency = std::max<uint32_t>(1U, std::thread::hardware_concurrency());
+        work_queue<std::function<void(void)>> wq(concurrency);
+        for(size_t i = 0; i < stale.size(); ++i){
+            wq.submit_task([&,i]() -> void {
+                // The stamp is taken first so a file modified during the scan is rescanned next time.
+                stamps[i] = get_file_stamp(stale[i]);
+                scanned[i] = Scan_DICOM_File_Header(stale[i]);
+            });
+        }
+    } // Wait for all scans to complete.
+
+    for(size_t i = 0; i < stale.size(); ++i){
+        if(scanned[i]){
+            auto l_path = scanned[i]->path;
+            this->entries[l_path] = std::move(scanned[i].value());
+
+        // Files that could not be stat'd (e.g., removed during the scan) are simply scanned again next time.
+        }else if(stamps[i]){
+            this->rejected[stale[i]] = stamps[i].value();
+        }
+    }
+    return static_cast<int64_t>(stale.size());
+}
+
+std::list<std::filesystem::path>
+DICOM_Series_Index::select(const std::function<bool(const dicom_file_summary_t &)> &pred) const {
+    std::list<std::filesystem::path> out;
+    for(const auto &e : this->entries){
+        if(pred(e.second)) out.push_back(e.first);
+    }
+    return out;
+}
+
@@ -0,0 +1,73 @@
+//DICOM_Series_Index.h.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+
+// Summary of a single DICOM file, harvested from the header only (i.e., without reading PixelData).
+struct dicom_file_summary_t {
+    std::filesystem::path path;
+    int64_t mtime = 0;  // Modification time, in filesystem clock ticks. Used to detect stale entries.
+    uint64_t size = 0;  // File size in bytes. Used to detect stale entries.
+
+    std::string PatientID;
+    std::string StudyInstanceUID;
+    std::string SeriesInstanceUID;
+    std::string SOPInstanceUID;
+    std::string FrameOfReferenceUID;
+    std::string Modality;
+
+    // Geometry, stored verbatim as (possibly multi-valued) DICOM strings.
+    std::string ImagePositionPatient;
+    std::string ImageOrientationPatient;
+    std::string PixelSpacing;
+    std::string SliceThickness;
+    std::string Rows;
+    std::string Columns;
+    std::string NumberOfFrames;
+};
+
+// Scan the header of a DICOM file. Parsing stops before any bulk data (e.g., RT sequences and PixelData) is read.
+// Files the header scanner can not handle (e.g., those lacking a preamble) are passed to the regular DICOM loader
+// before being rejected. Returns nothing if the file could not be read, is not a DICOM file, or was modified while
+// it was being scanned.
+std::optional<dicom_file_summary_t> Scan_DICOM_File_Header(const std::filesystem::path &p);
+
+
+// A persistent, path-keyed index of DICOM file headers.
+//
+// The index can be used to avoid fully parsing large collections of files when only a subset is needed. Entries are
+// refreshed whenever a file's size or modification time changes.
+class DICOM_Series_Index {
+  public:
+    std::map<std::filesystem::path, dicom_file_summary_t> entries;
+
+    // Files that were scanned but could not be indexed (e.g., non-DICOM files), along with the modification time and
+    // size observed when they were scanned. They are not scanned again until they change.
+    std::map<std::filesystem::path, std::pair<int64_t, uint64_t>> rejected;
+
+    // Read the index from a file, replacing the current contents. A non-existent file results in an empty index.
+    void read(const std::filesystem::path &p);
+
+    // Write the index to a file. The file is replaced atomically.
+    void write(const std::filesystem::path &p) const;
+
+    // Ensure the index reflects the provided files. Only new or modified files are scanned, and files that are not
+    // DICOM are recorded as rejected rather than indexed. Entries for files that no longer exist are purged.
+    //
+    // Returns the number of files that were scanned.
+    int64_t update(const std::list<std::filesystem::path> &files,
+                   uint32_t concurrency = 0);
+
+    // Return the files whose summary satisfies the predicate, ordered by path.
+    std::list<std::filesystem::path> select(const std::function<bool(const dicom_file_summary_t &)> &pred) const;
+};
+
@@ -0,0 +1,239 @@
+//DICOM_Series_Index_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the DICOM series index defined in DICOM_Series_Index.cc.
+// Tests are separated into their own file because DICOM_Series_Index_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "doctest20251212/doctest.h"
+
+#include "DCMA_DICOM.h"
+#include "DICOM_Series_Index.h"
+
+
+namespace {
+
+struct temp_dir {
+    std::filesystem::path path;
+    temp_dir(){
+        std::random_device rd;
+        this->path = std::filesystem::temp_directory_path()
+                   / ("dcma_dicom_series_index_test_" + std::to_string(rd()) + "_" + std::to_string(rd()));
+        std::filesystem::create_directories(this->path);
+    }
+    ~temp_dir(){
+        std::error_code ec;
+        std::filesystem::remove_all(this->path, ec);
+    }
+};
+
+} // namespace
+
+static
+void
+write_dicom_file(const std::filesystem::path &f, const std::string &sop_uid, const std::string &series_uid){
+    DCMA_DICOM::Node root;
+    root.emplace_child_node({{0x0002, 0x0001}, "OB", std::string("\x00\x01", 2)}); // FileMetaInformationVersion.
+    root.emplace_child_node({{0x0002, 0x0002}, "UI", "1.2.840.10008.5.1.4.1.1.2"});  // MediaStorageSOPClassUID.
+    root.emplace_child_node({{0x0002, 0x0003}, "UI", sop_uid});                       // MediaStorageSOPInstanceUID.
+    root.emplace_child_node({{0x0002, 0x0010}, "UI", "1.2.840.10008.1.2.1"});        // TransferSyntaxUID: ELE.
+    root.emplace_child_node({{0x0002, 0x0012}, "UI", "1.2.3.4.5"});                  // ImplementationClassUID.
+    root.emplace_child_node({{0x0002, 0x0013}, "SH", "DCMA_TEST"});                  // ImplementationVersionName.
+
+    root.emplace_child_node({{0x0008, 0x0016}, "UI", "1.2.840.10008.5.1.4.1.1.2"});  // SOPClassUID.
+    root.emplace_child_node({{0x0008, 0x0018}, "UI", sop_uid});                       // SOPInstanceUID.
+    root.emplace_child_node({{0x0008, 0x0060}, "CS", "CT"});                          // Modality.
+    root.emplace_child_node({{0x0010, 0x0020}, "LO", "12345"});                       // PatientID.
+    root.emplace_child_node({{0x0020, 0x000E}, "UI", series_uid});                    // SeriesInstanceUID.
+
+    std::ofstream of(f, std::ios::out | std::ios::trunc | std::ios::binary);
+    root.emit_DICOM(of, DCMA_DICOM::Encoding::ELE);
+}
+
+static
+void
+write_text_file(const std::filesystem::path &f, const std::string &s){
+    std::ofstream of(f, std::ios::out | std::ios::trunc | std::ios::binary);
+    of << s;
+}
+
+
+TEST_CASE("DICOM_Series_Index read and write round-trip"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    const auto f_b = td.path / "b.dcm";
+    const auto f_c = td.path / "not dicom.txt";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    write_dicom_file(f_b, "1.2.3.2", "1.2.3.200");
+    write_text_file(f_c, "This is not a DICOM file.");
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_a, f_b, f_c }, 1) == 3);
+    REQUIRE(idx.entries.size() == 2);
+    REQUIRE(idx.rejected.size() == 1);
+
+    const auto f_idx = td.path / "index.txt";
+    idx.write(f_idx);
+
+    DICOM_Series_Index idx2;
+    idx2.read(f_idx);
+    REQUIRE(idx2.entries.size() == 2);
+    REQUIRE(idx2.rejected == idx.rejected);
+    for(const auto &p : { f_a, f_b }){
+        const auto &e1 = idx.entries.at(p);
+        const auto &e2 = idx2.entries.at(p);
+        REQUIRE(e2.path == e1.path);
+        REQUIRE(e2.mtime == e1.mtime);
+        REQUIRE(e2.size == e1.size);
+        REQUIRE(e2.PatientID == e1.PatientID);
+        REQUIRE(e2.SeriesInstanceUID == e1.SeriesInstanceUID);
+        REQUIRE(e2.SOPInstanceUID == e1.SOPInstanceUID);
+        REQUIRE(e2.Modality == e1.Modality);
+    }
+    REQUIRE(idx2.entries.at(f_b).SeriesInstanceUID == "1.2.3.200");
+
+    // A re-read index is current, so nothing needs to be scanned.
+    REQUIRE(idx2.update({ f_a, f_b, f_c }, 1) == 0);
+
+    SUBCASE("non-existent index files are empty"){
+        DICOM_Series_Index idx3;
+        idx3.read(td.path / "missing.txt");
+        REQUIRE(idx3.entries.empty());
+        REQUIRE(idx3.rejected.empty());
+    }
+
+    SUBCASE("unrecognized index files are rejected"){
+        const auto f_bad = td.path / "bad.txt";
+        write_text_file(f_bad, "SOMETHING ELSE\n");
+        DICOM_Series_Index idx3;
+        REQUIRE_THROWS(idx3.read(f_bad));
+    }
+}
+
+TEST_CASE("DICOM_Series_Index only rescans modified files"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    const auto f_b = td.path / "b.dcm";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    write_dicom_file(f_b, "1.2.3.2", "1.2.3.100");
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_a, f_b }, 1) == 2);
+    REQUIRE(idx.update({ f_a, f_b }, 1) == 0);
+
+    // The file size changes, so the entry is stale regardless of the filesystem's timestamp resolution.
+    write_dicom_file(f_b, "1.2.3.2", "1.2.3.200.300");
+    REQUIRE(idx.update({ f_a, f_b }, 1) == 1);
+    REQUIRE(idx.entries.at(f_b).SeriesInstanceUID == "1.2.3.200.300");
+    REQUIRE(idx.entries.at(f_a).SeriesInstanceUID == "1.2.3.100");
+    REQUIRE(idx.update({ f_a, f_b }, 1) == 0);
+
+    const auto sel = idx.select([](const dicom_file_summary_t &s){ return (s.SeriesInstanceUID == "1.2.3.100"); });
+    REQUIRE(sel == std::list<std::filesystem::path>{ f_a });
+}
+
+TEST_CASE("DICOM_Series_Index does not rescan rejected files until they change"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    const auto f_c = td.path / "c.dcm";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    write_text_file(f_c, "Not yet a DICOM file.");
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_a, f_c }, 1) == 2);
+    REQUIRE(idx.entries.count(f_c) == 0);
+    REQUIRE(idx.rejected.count(f_c) == 1);
+    REQUIRE(idx.update({ f_a, f_c }, 1) == 0);
+
+    // Once the file becomes a valid DICOM file it is indexed and no longer rejected.
+    write_dicom_file(f_c, "1.2.3.3", "1.2.3.100");
+    REQUIRE(idx.update({ f_a, f_c }, 1) == 1);
+    REQUIRE(idx.entries.count(f_c) == 1);
+    REQUIRE(idx.rejected.count(f_c) == 0);
+
+    // And vice versa.
+    write_text_file(f_c, "No longer a DICOM file.");
+    REQUIRE(idx.update({ f_a, f_c }, 1) == 1);
+    REQUIRE(idx.entries.count(f_c) == 0);
+    REQUIRE(idx.rejected.count(f_c) == 1);
+}
+
+TEST_CASE("DICOM_Series_Index defers to the regular loader before rejecting files"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+
+    // Strip the 128-byte preamble and 'DICM' magic, which the header scanner requires but the loader does not.
+    const auto f_b = td.path / "b.dcm";
+    {
+        std::ifstream ifs(f_a, std::ios::in | std::ios::binary);
+        const std::string contents( (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>() );
+        REQUIRE(132 < contents.size());
+        write_text_file(f_b, contents.substr(132));
+    }
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_b }, 1) == 1);
+    REQUIRE(idx.rejected.empty());
+    REQUIRE(idx.entries.count(f_b) == 1);
+    REQUIRE(idx.entries.at(f_b).SOPInstanceUID == "1.2.3.1");
+    REQUIRE(idx.entries.at(f_b).SeriesInstanceUID == "1.2.3.100");
+}
+
+TEST_CASE("DICOM_Series_Index rejects truncated files without crashing"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    const auto full_size = std::filesystem::file_size(f_a);
+
+    // Truncate the file partway through the header, as if it were still being written.
+    std::filesystem::resize_file(f_a, 140);
+    REQUIRE(!Scan_DICOM_File_Header(f_a));
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_a }, 1) == 1);
+    REQUIRE(idx.rejected.count(f_a) == 1);
+
+    // Once the write completes, the file is indexed.
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    REQUIRE(std::filesystem::file_size(f_a) == full_size);
+    REQUIRE(idx.update({ f_a }, 1) == 1);
+    REQUIRE(idx.entries.count(f_a) == 1);
+}
+
+TEST_CASE("DICOM_Series_Index purges removed files"){
+    temp_dir td;
+    const auto f_a = td.path / "a.dcm";
+    const auto f_b = td.path / "b.dcm";
+    const auto f_c = td.path / "c.txt";
+    write_dicom_file(f_a, "1.2.3.1", "1.2.3.100");
+    write_dicom_file(f_b, "1.2.3.2", "1.2.3.100");
+    write_text_file(f_c, "Not a DICOM file.");
+
+    DICOM_Series_Index idx;
+    REQUIRE(idx.update({ f_a, f_b, f_c }, 1) == 3);
+
+    std::filesystem::remove(f_b);
+    std::filesystem::remove(f_c);
+    REQUIRE(idx.update({ f_a }, 1) == 0);
+    REQUIRE(idx.entries.size() == 1);
+    REQUIRE(idx.entries.count(f_a) == 1);
+    REQUIRE(idx.rejected.empty());
+
+    // Purged entries are not written.
+    const auto f_idx = td.path / "index.txt";
+    idx.write(f_idx);
+    DICOM_Series_Index idx2;
+    idx2.read(f_idx);
+    REQUIRE(idx2.entries.size() == 1);
+    REQUIRE(idx2.rejected.empty());
+}
+
@@ -0,0 +1,483 @@
+//Directory_Watcher.cc - A part of DICOMautomaton 2026. Written by hal clark.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <climits>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #define DCMA_DIRECTORY_WATCHER_INOTIFY
+#endif
+
+#include "YgorLog.h"
+
+#include "Directory_Watcher.h"
+
+
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+static const uint32_t inotify_watch_mask = IN_CREATE
+                                         | IN_MODIFY
+                                         | IN_CLOSE_WRITE
+                                         | IN_MOVED_TO
+                                         | IN_MOVED_FROM
+                                         | IN_DELETE
+                                         | IN_DELETE_SELF
+                                         | IN_MOVE_SELF
+                                         | IN_ONLYDIR;
+#endif
+
+// Whether 'p' is 'dir' or is nested somewhere within 'dir'.
+static
+bool
+is_within(const std::filesystem::path &p, const std::filesystem::path &dir){
+    return (std::mismatch(dir.begin(), dir.end(), p.begin(), p.end()).first == dir.end());
+}
+
+
+directory_watcher::directory_watcher(const std::vector<std::filesystem::path> &dirs,
+                                     double settle_delay,
+                                     method m) : dirs(dirs), settle_delay(settle_delay) {
+
+    if(this->dirs.empty()){
+        throw std::invalid_argument("No directories to watch");
+    }
+    for(const auto &d : this->dirs){
+        if(!std::filesystem::is_directory(d)){
+            throw std::invalid_argument("Cannot access directory '" + d.string() + "'");
+        }
+    }
+
+    if(m == method::polling) return;
+
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    this->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if( (0 <= this->fd)
+    &&  (pipe2(this->interrupt_fds, O_NONBLOCK | O_CLOEXEC) == 0) ){
+        try{
+            for(const auto &d : this->dirs){
+                this->add_watches(d);
+            }
+            this->use_events = true;
+        }catch(const std::exception &e){
+            if(m == method::events) throw;
+            YLOGWARN("Unable to watch for filesystem changes ('" << e.what() << "'), falling back to polling");
+        }
+    }else if(m == method::events){
+        throw std::runtime_error("Unable to initialize filesystem change notifications");
+    }
+
+    if(!this->use_events){
+        if(0 <= this->fd) close(this->fd);
+        this->fd = -1;
+        this->watches.clear();
+    }
+#else
+    if(m == method::events){
+        throw std::runtime_error("Filesystem change notifications are not supported on this platform");
+    }
+#endif
+}
+
+directory_watcher::~directory_watcher(){
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    if(0 <= this->fd) close(this->fd);
+    for(const auto f : this->interrupt_fds){
+        if(0 <= f) close(f);
+    }
+#endif
+}
+
+bool directory_watcher::uses_events() const {
+    return this->use_events;
+}
+
+void directory_watcher::add_watches(const std::filesystem::path &dir){
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    // Watches are added before enumerating subdirectories so that subdirectories created concurrently are not missed.
+    const auto add = [&](const std::filesystem::path &d){
+        const int wd = inotify_add_watch(this->fd, d.c_str(), inotify_watch_mask);
+        if(wd < 0){
+            if(errno == ENOSPC){
+                throw std::runtime_error("Exceeded the maximum number of filesystem watches"
+                                         " (see /proc/sys/fs/inotify/max_user_watches)");
+            }
+            // The directory may have been removed in the meantime.
+            if(errno == ENOENT) return;
+            throw std::system_error(errno, std::generic_category(), "Unable to watch '" + d.string() + "'");
+        }
+        this->watches[wd] = d;
+    };
+    add(dir);
+
+    std::error_code ec;
+    for(auto it = std::filesystem::recursive_directory_iterator(dir, ec);
+        !ec && (it != std::filesystem::recursive_directory_iterator());
+        it.increment(ec)){
+        if(it->is_directory(ec) && !it->is_symlink(ec)) add(it->path());
+    }
+#else
+    static_cast<void>(dir);
+#endif
+    return;
+}
+
+void directory_watcher::remove_subtree(const std::filesystem::path &dir){
+    for(auto it = this->cache.begin(); it != this->cache.end(); ){
+        if(is_within(it->first, dir)){
+            it = this->cache.erase(it);
+        }else{
+            ++it;
+        }
+    }
+
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    // Watches for deleted directories are removed automatically, but moved directories remain watched.
+    for(auto it = this->watches.begin(); it != this->watches.end(); ){
+        if(is_within(it->second, dir)){
+            inotify_rm_watch(this->fd, it->first);
+            it = this->watches.erase(it);
+        }else{
+            ++it;
+        }
+    }
+#endif
+    return;
+}
+
+void directory_watcher::touch(const std::filesystem::path &f,
+                              clock_t::time_point now,
+                              bool mark_processed){
+    std::error_code ec;
+    const auto status = std::filesystem::status(f, ec);
+    if(ec || !std::filesystem::exists(status) || std::filesystem::is_directory(status)){
+        this->forget(f);
+        return;
+    }
+    const auto s = std::filesystem::file_size(f, ec);
+    if(ec){
+        this->forget(f);
+        return;
+    }
+
+    auto &subdir = this->cache[f.parent_path()];
+    auto it = subdir.find(f);
+    if(it == subdir.end()){
+        auto &entry = subdir[f];
+        entry.file_size = s;
+        entry.last_time = now;
+        entry.present   = true;
+        entry.processed = mark_processed;
+        entry.ready     = false;
+        if(!mark_processed) this->pending.insert(f);
+        return;
+    }
+
+    auto &entry = it->second;
+    entry.present = true;
+    if(entry.processed) return;
+
+    // Any alteration resets the settle timer.
+    entry.file_size = s;
+    entry.last_time = now;
+    entry.ready = false;
+    this->pending.insert(f);
+    return;
+}
+
+void directory_watcher::forget(const std::filesystem::path &f){
+    auto it = this->cache.find(f.parent_path());
+    if(it == this->cache.end()) return;
+    it->second.erase(f);
+    if(it->second.empty()) this->cache.erase(it);
+    this->pending.erase(f);
+    return;
+}
+
+void directory_watcher::rescan(bool mark_new_processed){
+    // Reset the cache visibility for each entry.
+    for(auto &block : this->cache){
+        for(auto &p : block.second){
+            p.second.present = false;
+        }
+    }
+
+    if(this->use_events){
+        for(const auto &d : this->dirs) this->add_watches(d);
+    }
+
+    const auto now = clock_t::now();
+    for(const auto &d : this->dirs){
+        for(const auto &e : std::filesystem::recursive_directory_iterator(d)){
+            if(!e.exists() || e.is_directory()) continue;
+
+            const auto f = e.path();
+            const auto s = e.file_size();
+            auto &subdir = this->cache[f.parent_path()];
+            auto it = subdir.find(f);
+
+            // If not yet seen, create an entry including relevant metadata.
+            if(it == subdir.end()){
+                auto &entry = subdir[f];
+                entry.file_size = s;
+                entry.last_time = now;
+                entry.present   = true;
+                entry.processed = mark_new_processed;
+                entry.ready     = false;
+                if(!mark_new_processed) this->pending.insert(f);
+                continue;
+            }
+
+            auto &entry = it->second;
+            entry.present = true;
+
+            // If the size is still being modified, then reset the entry metadata.
+            if(!entry.processed && (s != entry.file_size)){
+                entry.file_size = s;
+                entry.last_time = now;
+                entry.ready = false;
+                this->pending.insert(f);
+            }
+        }
+    }
+
+    // Purge any entries that are no longer visible, and any parent directories that are then empty.
+    for(auto b_it = this->cache.begin(); b_it != this->cache.end(); ){
+        auto &block = b_it->second;
+        for(auto it = block.begin(); it != block.end(); ){
+            if(!it->second.present){
+                this->pending.erase(it->first);
+                it = block.erase(it);
+            }else{
+                ++it;
+            }
+        }
+        if(block.empty()){
+            b_it = this->cache.erase(b_it);
+        }else{
+            ++b_it;
+        }
+    }
+
+    this->rescan_needed = false;
+    this->evaluate_pending(now);
+    return;
+}
+
+void directory_watcher::evaluate_pending(clock_t::time_point now){
+    for(auto p_it = this->pending.begin(); p_it != this->pending.end(); ){
+        const auto f = *p_it;
+        auto b_it = this->cache.find(f.parent_path());
+        if(b_it == this->cache.end()){
+            p_it = this->pending.erase(p_it);
+            continue;
+        }
+        auto it = b_it->second.find(f);
+        if( (it == b_it->second.end())
+        ||  it->second.processed
+        ||  it->second.ready ){
+            p_it = this->pending.erase(p_it);
+            continue;
+        }
+
+        auto &entry = it->second;
+        const auto dt = std::chrono::duration<double>(now - entry.last_time).count();
+        if(dt <= this->settle_delay){
+            ++p_it;
+            continue;
+        }
+
+        // Notifications can be coalesced or lost, so confirm the size has not changed before declaring readiness.
+        if(this->use_events){
+            std::error_code ec;
+            const auto s = std::filesystem::file_size(f, ec);
+            if(ec){
+                ++p_it;
+                this->forget(f);
+                continue;
+            }
+            if(s != entry.file_size){
+                entry.file_size = s;
+                entry.last_time = now;
+                ++p_it;
+                continue;
+            }
+        }
+        entry.ready = true;
+        p_it = this->pending.erase(p_it);
+    }
+    return;
+}
+
+int64_t directory_watcher::read_events(std::chrono::milliseconds timeout){
+    int64_t N_events = 0;
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    std::array<struct pollfd, 2> pfds;
+    pfds[0].fd = this->fd;
+    pfds[0].events = POLLIN;
+    pfds[0].revents = 0;
+    pfds[1].fd = this->interrupt_fds[0];
+    pfds[1].events = POLLIN;
+    pfds[1].revents = 0;
+
+    const auto timeout_ms = static_cast<int>(std::clamp<int64_t>(timeout.count(), 0, INT_MAX));
+    const int res = poll(pfds.data(), pfds.size(), timeout_ms);
+    if(res < 0){
+        if(errno == EINTR) return 0;
+        throw std::system_error(errno, std::generic_category(), "Unable to wait for filesystem changes");
+    }
+    if(res == 0) return 0;
+
+    const auto now = clock_t::now();
+    alignas(struct inotify_event) char buf[64 * 1024];
+    while(true){
+        const auto len = read(this->fd, buf, sizeof(buf));
+        if(len <= 0) break;
+
+        for(char *ptr = buf; ptr < (buf + len); ){
+            const auto *ev = reinterpret_cast<const struct inotify_event *>(ptr);
+            ptr += sizeof(struct inotify_event) + ev->len;
+            ++N_events;
+
+            if(ev->mask & IN_Q_OVERFLOW){
+                YLOGWARN("Filesystem change notifications overflowed; enumerating directories");
+                this->rescan_needed = true;
+                continue;
+            }
+            auto w_it = this->watches.find(ev->wd);
+            if(w_it == this->watches.end()) continue;
+            if(ev->mask & IN_IGNORED){
+                this->watches.erase(w_it);
+                continue;
+            }
+
+            const auto dir = w_it->second;
+            if(ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF)){
+                // Nested directories are handled via their parent, but the watched directories themselves have none.
+                if(std::find(std::begin(this->dirs), std::end(this->dirs), dir) != std::end(this->dirs)){
+                    this->rescan_needed = true;
+                }
+                continue;
+            }
+            if(ev->len == 0) continue;
+            const auto f = dir / std::filesystem::path(ev->name);
+
+            if(ev->mask & IN_ISDIR){
+                if(ev->mask & (IN_DELETE | IN_MOVED_FROM)){
+                    this->remove_subtree(f);
+                }else if(ev->mask & (IN_CREATE | IN_MOVED_TO)){
+                    // Files might have been added before the watch was established, so enumerate them.
+                    this->add_watches(f);
+                    std::error_code ec;
+                    for(auto it = std::filesystem::recursive_directory_iterator(f, ec);
+                        !ec && (it != std::filesystem::recursive_directory_iterator());
+                        it.increment(ec)){
+                        if(!it->is_directory(ec)) this->touch(it->path(), now, false);
+                    }
+                }
+                continue;
+            }
+
+            if(ev->mask & (IN_DELETE | IN_MOVED_FROM)){
+                this->forget(f);
+            }else{
+                this->touch(f, now, false);
+            }
+        }
+    }
+
+    // Drain any interruption notifications.
+    if(pfds[1].revents & POLLIN){
+        char c[64];
+        while(0 < read(this->interrupt_fds[0], c, sizeof(c))){}
+    }
+#else
+    static_cast<void>(timeout);
+#endif
+    return N_events;
+}
+
+int64_t directory_watcher::update(std::chrono::milliseconds timeout){
+    if(this->is_interrupted()) return 0;
+
+    if(!this->use_events){
+        {
+            std::unique_lock<std::mutex> lock(this->interrupt_m);
+            this->interrupt_cv.wait_for(lock, timeout, [&](){ return this->is_interrupted(); });
+        }
+        if(this->is_interrupted()) return 0;
+        this->rescan(false);
+        return 0;
+    }
+
+    if(this->rescan_needed) this->rescan(false);
+
+    // Wake when the next pending file could become ready.
+    auto wait = timeout;
+    if(const auto deadline = this->next_deadline()){
+        const auto dt = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - clock_t::now());
+        wait = std::clamp(dt, std::chrono::milliseconds(0), timeout);
+    }
+    const auto N_events = this->read_events(wait);
+    if(this->rescan_needed) this->rescan(false);
+    this->evaluate_pending(clock_t::now());
+    return N_events;
+}
+
+std::optional<directory_watcher::clock_t::time_point> directory_watcher::next_deadline() const {
+    std::optional<clock_t::time_point> out;
+    const auto settle = std::chrono::duration_cast<clock_t::duration>(std::chrono::duration<double>(this->settle_delay));
+    for(const auto &f : this->pending){
+        const auto b_it = this->cache.find(f.parent_path());
+        if(b_it == this->cache.end()) continue;
+        const auto it = b_it->second.find(f);
+        if(it == b_it->second.end()) continue;
+
+        // The file becomes ready once strictly more than the settle delay has passed.
+        const auto t = it->second.last_time + settle + std::chrono::milliseconds(1);
+        if(!out || (t < out.value())) out = t;
+    }
+    return out;
+}
+
+void directory_watcher::interrupt(){
+    {
+        std::lock_guard<std::mutex> lock(this->interrupt_m);
+        this->interrupted = true;
+    }
+    this->interrupt_cv.notify_all();
+#if defined(DCMA_DIRECTORY_WATCHER_INOTIFY)
+    if(0 <= this->interrupt_fds[1]){
+        const char c = 0;
+        [[maybe_unused]] const auto res = write(this->interrupt_fds[1], &c, 1);
+    }
+#endif
+    return;
+}
+
+bool directory_watcher::is_interrupted() const {
+    return this->interrupted.load();
+}
+
+directory_watcher::cache_t& directory_watcher::files(){
+    return this->cache;
+}
+
+const directory_watcher::cache_t& directory_watcher::files() const {
+    return this->cache;
+}
+
@@ -0,0 +1,172 @@
+//Directory_Watcher.h - A part of DICOMautomaton 2026. Written by hal clark.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+
+// Tracks the files within a set of directories (recursively), including whether each file has 'settled', i.e., has
+// not been altered for some time.
+//
+// Where supported (Linux), filesystem change notifications (inotify) are used so that only altered files need to be
+// examined and changes are noticed promptly. Otherwise, or if notifications cannot be established, the directories
+// are periodically enumerated and file sizes are compared instead.
+//
+// Note that change notifications are not generated for all filesystems, e.g., network filesystems altered by
+// other hosts. Polling should be used in these cases.
+class directory_watcher {
+  public:
+    enum class method {
+        automatic, // Use change notifications if available, otherwise polling.
+        events,    // Require change notifications.
+        polling,   // Always enumerate directories.
+    };
+
+    using clock_t = std::chrono::steady_clock;
+
+    struct file_metadata {
+        clock_t::time_point last_time; // When the file was last seen to change.
+        std::uintmax_t file_size = 0U;
+
+        bool present   = false; // File appeared in the most recent directory enumeration.
+        bool processed = false; // File has already been processed and should be ignored.
+        bool ready     = false; // File is ready to be processed, but could be waiting for sibling files to transit.
+    };
+
+    // Files are keyed by parent directory and then file path. The parent directory key is separate to facilitate
+    // easier access to all the files sharing a common parent directory.
+    using inner_cache_t = std::map<std::filesystem::path, file_metadata>;
+    using cache_t = std::map<std::filesystem::path, inner_cache_t>;
+
+  private:
+    std::vector<std::filesystem::path> dirs;
+    double settle_delay = 0.0;
+    bool use_events = false;
+
+    cache_t cache;
+
+    // Files that are neither processed nor ready, which need to be re-evaluated as time passes.
+    std::set<std::filesystem::path> pending;
+
+    // Change notification state.
+    int fd = -1;
+    std::map<int, std::filesystem::path> watches;
+    bool rescan_needed = false;
+
+    // Used to wake the watcher from another thread.
+    std::atomic<bool> interrupted = false;
+    std::mutex interrupt_m;
+    std::condition_variable interrupt_cv;
+    int interrupt_fds[2] = { -1, -1 };
+
+    void add_watches(const std::filesystem::path &dir);
+    void remove_subtree(const std::filesystem::path &dir);
+    void touch(const std::filesystem::path &f, clock_t::time_point now, bool mark_processed);
+    void forget(const std::filesystem::path &f);
+    int64_t read_events(std::chrono::milliseconds timeout);
+    void evaluate_pending(clock_t::time_point now);
+
+  public:
+    directory_watcher(const std::vector<std::filesystem::path> &dirs,
+                      double settle_delay,
+                      method m = method::automatic);
+    ~directory_watcher();
+
+    directory_watcher(const directory_watcher &) = delete;
+    directory_watcher& operator=(const directory_watcher &) = delete;
+
+    // Whether change notifications are being used.
+    bool uses_events() const;
+
+    // Enumerate the directories, synchronizing the cache with the filesystem. Files that were not previously known
+    // can optionally be considered already processed.
+    void rescan(bool mark_new_processed = false);
+
+    // Wait for changes, updating the cache.
+    //
+    // When notifications are used, this routine returns early when changes are detected or when a pending file could
+    // become ready. When polling, the directories are enumerated after the timeout elapses. Returns the number of
+    // changes that were processed (or zero when polling).
+    int64_t update(std::chrono::milliseconds timeout);
+
+    // The earliest time at which a pending file could become ready, if any files are pending.
+    std::optional<clock_t::time_point> next_deadline() const;
+
+    // Wake any thread waiting in update() and cause subsequent updates to return immediately.
+    // This is the only member that can be safely called concurrently with other members.
+    void interrupt();
+    bool is_interrupted() const;
+
+    // Access the cache. Files can be marked processed directly.
+    cache_t& files();
+    const cache_t& files() const;
+};
+
+
+// A simple thread-safe FIFO queue with a maximum capacity, used to pass work between pipeline stages.
+//
+// Producers block when the queue is full, which throttles upstream stages. Closing the queue wakes all waiting
+// threads; afterward pushes are rejected and pops drain the remaining items.
+template <class T>
+class bounded_queue {
+  private:
+    std::mutex m;
+    std::condition_variable cv_not_full;
+    std::condition_variable cv_not_empty;
+    std::deque<T> items;
+    size_t capacity;
+    bool closed = false;
+
+  public:
+    explicit bounded_queue(size_t capacity) : capacity(std::max<size_t>(1U, capacity)) {}
+
+    // Returns false if the queue was closed before the item could be inserted.
+    bool push(T item){
+        std::unique_lock<std::mutex> lock(this->m);
+        this->cv_not_full.wait(lock, [&](){ return this->closed || (this->items.size() < this->capacity); });
+        if(this->closed) return false;
+        this->items.emplace_back(std::move(item));
+        lock.unlock();
+        this->cv_not_empty.notify_one();
+        return true;
+    }
+
+    // Returns nothing if the queue is closed and empty.
+    std::optional<T> pop(){
+        std::unique_lock<std::mutex> lock(this->m);
+        this->cv_not_empty.wait(lock, [&](){ return this->closed || !this->items.empty(); });
+        if(this->items.empty()) return {};
+        std::optional<T> out(std::move(this->items.front()));
+        this->items.pop_front();
+        lock.unlock();
+        this->cv_not_full.notify_one();
+        return out;
+    }
+
+    void close(){
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            this->closed = true;
+        }
+        this->cv_not_full.notify_all();
+        this->cv_not_empty.notify_all();
+    }
+
+    size_t size(){
+        std::lock_guard<std::mutex> lock(this->m);
+        return this->items.size();
+    }
+};
+
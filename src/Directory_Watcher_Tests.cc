@@ -0,0 +1,194 @@
+//Directory_Watcher_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the directory watching routines defined in Directory_Watcher.cc.
+// Tests are separated into their own file because Directory_Watcher_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "Directory_Watcher.h"
+
+
+// Creates a unique, empty directory which is removed upon destruction.
+struct temp_dir {
+    std::filesystem::path path;
+    temp_dir(){
+        std::random_device rd;
+        this->path = std::filesystem::temp_directory_path()
+                   / ("dcma_directory_watcher_test_" + std::to_string(rd()) + "_" + std::to_string(rd()));
+        std::filesystem::create_directories(this->path);
+    }
+    ~temp_dir(){
+        std::error_code ec;
+        std::filesystem::remove_all(this->path, ec);
+    }
+};
+
+static
+void
+append(const std::filesystem::path &f, const std::string &s){
+    std::ofstream of(f, std::ios::out | std::ios::app | std::ios::binary);
+    of << s;
+}
+
+static
+const directory_watcher::file_metadata *
+find_entry(const directory_watcher &w, const std::filesystem::path &f){
+    const auto b_it = w.files().find(f.parent_path());
+    if(b_it == w.files().end()) return nullptr;
+    const auto it = b_it->second.find(f);
+    return (it == b_it->second.end()) ? nullptr : &(it->second);
+}
+
+// Update the watcher until the predicate is satisfied or the time limit is reached.
+template <class F>
+static
+bool
+update_until(directory_watcher &w, F f, std::chrono::milliseconds limit = std::chrono::milliseconds(5000)){
+    const auto t_end = std::chrono::steady_clock::now() + limit;
+    while(std::chrono::steady_clock::now() < t_end){
+        if(f()) return true;
+        w.update(std::chrono::milliseconds(20));
+    }
+    return f();
+}
+
+
+TEST_CASE("bounded_queue"){
+    bounded_queue<int64_t> q(2);
+    REQUIRE(q.push(1));
+    REQUIRE(q.push(2));
+
+    // A full queue blocks producers until a consumer makes room.
+    std::thread producer([&](){ q.push(3); });
+    REQUIRE(q.pop().value() == 1);
+    producer.join();
+    REQUIRE(q.size() == 2);
+
+    q.close();
+    REQUIRE(!q.push(4));
+    REQUIRE(q.pop().value() == 2);
+    REQUIRE(q.pop().value() == 3);
+    REQUIRE(!q.pop());
+}
+
+static
+void
+test_directory_watcher(directory_watcher::method m){
+    temp_dir td;
+    const auto existing = td.path / "existing.txt";
+    append(existing, "abc");
+
+    const double settle = 0.1;
+    directory_watcher w({ td.path }, settle, m);
+    if(m == directory_watcher::method::polling) REQUIRE(!w.uses_events());
+    w.rescan(true);
+
+    SUBCASE("existing files can be ignored"){
+        REQUIRE(find_entry(w, existing) != nullptr);
+        REQUIRE(find_entry(w, existing)->processed);
+    }
+
+    SUBCASE("new files become ready after settling"){
+        const auto t_start = std::chrono::steady_clock::now();
+        const auto f = td.path / "new.txt";
+        append(f, "123");
+        REQUIRE(update_until(w, [&](){ return (find_entry(w, f) != nullptr); }));
+        REQUIRE(!find_entry(w, f)->ready);
+        REQUIRE(update_until(w, [&](){ return find_entry(w, f)->ready; }));
+
+        const auto dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+        MESSAGE("File became ready after " << dt << " s using "
+                << std::string(w.uses_events() ? "change notifications" : "polling"));
+        REQUIRE(settle < dt);
+    }
+
+    SUBCASE("files in new subdirectories are detected"){
+        const auto d = td.path / "a" / "b";
+        std::filesystem::create_directories(d);
+        const auto f = d / "nested.txt";
+        append(f, "xyz");
+        REQUIRE(update_until(w, [&](){ return (find_entry(w, f) != nullptr) && find_entry(w, f)->ready; }));
+        REQUIRE(find_entry(w, f)->file_size == 3U);
+
+        // Removing the subdirectory purges the entries.
+        std::filesystem::remove_all(td.path / "a");
+        REQUIRE(update_until(w, [&](){ return (find_entry(w, f) == nullptr); }));
+    }
+
+    SUBCASE("alterations reset the settle timer"){
+        const auto f = td.path / "growing.txt";
+        append(f, "1");
+        REQUIRE(update_until(w, [&](){ return (find_entry(w, f) != nullptr); }));
+        const auto t_first = find_entry(w, f)->last_time;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        append(f, "2");
+        REQUIRE(update_until(w, [&](){ return find_entry(w, f)->file_size == 2U; }));
+        REQUIRE(t_first < find_entry(w, f)->last_time);
+        REQUIRE(update_until(w, [&](){ return find_entry(w, f)->ready; }));
+    }
+
+    SUBCASE("interruption wakes the watcher"){
+        std::thread t([&](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            w.interrupt();
+        });
+        const auto t_start = std::chrono::steady_clock::now();
+        w.update(std::chrono::milliseconds(10000));
+        const auto dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+        t.join();
+        REQUIRE(w.is_interrupted());
+        REQUIRE(dt < 5.0);
+    }
+}
+
+TEST_CASE("directory_watcher with change notifications"){
+    test_directory_watcher(directory_watcher::method::automatic);
+}
+
+TEST_CASE("directory_watcher with polling"){
+    test_directory_watcher(directory_watcher::method::polling);
+}
+
+TEST_CASE("directory_watcher benchmark"){
+    // Compare the cost of a full enumeration (i.e., a polling cycle) with the cost of handling a single change
+    // notification when many files are present.
+    temp_dir td;
+    const int64_t N_dirs = 50;
+    const int64_t N_files = 200;
+    for(int64_t d = 0; d < N_dirs; ++d){
+        const auto dir = td.path / ("d" + std::to_string(d));
+        std::filesystem::create_directories(dir);
+        for(int64_t f = 0; f < N_files; ++f){
+            append(dir / ("f" + std::to_string(f)), "x");
+        }
+    }
+
+    directory_watcher w({ td.path }, 0.0);
+    const auto t_start = std::chrono::steady_clock::now();
+    w.rescan(true);
+    const auto t_rescan = std::chrono::steady_clock::now();
+
+    const auto f = td.path / "d7" / "new";
+    append(f, "y");
+    REQUIRE(update_until(w, [&](){ return (find_entry(w, f) != nullptr) && find_entry(w, f)->ready; }));
+    const auto t_update = std::chrono::steady_clock::now();
+
+    const auto ms = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count() / 1000.0;
+    };
+    MESSAGE("With " << (N_dirs * N_files) << " files: enumeration " << ms(t_start, t_rescan) << " ms,"
+            << " detecting a new file " << ms(t_rescan, t_update) << " ms using "
+            << std::string(w.uses_events() ? "change notifications" : "polling"));
+}
+
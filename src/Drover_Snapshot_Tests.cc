@@ -0,0 +1,237 @@
+//Drover_Snapshot_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for Drover_Snapshot, defined in Structs.cc, and for the rollback behaviour of the
+// Transaction operation, which relies on the snapshot objects being detached by Operation_Dispatcher.
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "Structs.h"
+#include "Operation_Dispatcher.h"
+
+
+static
+std::shared_ptr<Image_Array>
+make_test_array(const std::string &tag){
+    auto ia = std::make_shared<Image_Array>();
+    ia->imagecoll.images.emplace_back();
+    auto &img = ia->imagecoll.images.back();
+    img.init_buffer(4, 4, 1);
+    img.init_spatial(1.0, 1.0, 1.0, vec3<double>(0.0, 0.0, 0.0), vec3<double>(0.0, 0.0, 0.0));
+    img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+    img.fill_pixels(1.0f);
+    img.metadata["Tag"] = tag;
+    return ia;
+}
+
+static
+Drover
+make_test_drover(){
+    Drover d;
+    d.image_data.emplace_back( make_test_array("first") );
+    d.image_data.emplace_back( make_test_array("second") );
+    return d;
+}
+
+static
+std::vector<std::string>
+tags_of(const Drover &d){
+    std::vector<std::string> out;
+    for(const auto &ia : d.image_data){
+        out.emplace_back( ia->imagecoll.images.front().metadata.at("Tag") );
+    }
+    return out;
+}
+
+static
+float
+first_pixel(const std::shared_ptr<Image_Array> &ia){
+    return ia->imagecoll.images.front().value(0, 0, 0);
+}
+
+
+TEST_CASE("Drover_Snapshot detaches protected objects and restores them"){
+    auto d = make_test_drover();
+    REQUIRE(!Drover_Snapshot::Active());
+    {
+        const Drover_Snapshot snap(d);
+        REQUIRE(Drover_Snapshot::Active());
+
+        auto &ia = d.image_data.front();
+        const auto *orig = ia.get();
+        REQUIRE(Drover_Snapshot::Detach(ia));
+        REQUIRE(ia.get() != orig);
+
+        // Detached copies are private, so they are not copied again.
+        REQUIRE(!Drover_Snapshot::Detach(ia));
+
+        ia->imagecoll.images.front().metadata["Tag"] = "modified";
+        ia->imagecoll.images.front().reference(0, 0, 0) = 5.0f;
+        d.image_data.emplace_back( make_test_array("third") );
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "modified", "second", "third" });
+
+        snap.Restore(d);
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "first", "second" });
+        REQUIRE(d.image_data.front().get() == orig);
+        REQUIRE(first_pixel(d.image_data.front()) == 1.0f);
+    }
+    REQUIRE(!Drover_Snapshot::Active());
+
+    // Without a snapshot, nothing is protected.
+    REQUIRE(!Drover_Snapshot::Detach(d.image_data.front()));
+    REQUIRE(Drover_Snapshot::Detach(d) == 0);
+}
+
+TEST_CASE("nested Drover_Snapshots restore their own states"){
+    auto d = make_test_drover();
+    {
+        const Drover_Snapshot outer(d);
+        REQUIRE(Drover_Snapshot::Detach(d) == 2);
+        d.image_data.front()->imagecoll.images.front().metadata["Tag"] = "outer";
+        {
+            const Drover_Snapshot inner(d);
+            REQUIRE(Drover_Snapshot::Detach(d) == 2);
+            d.image_data.front()->imagecoll.images.front().metadata["Tag"] = "inner";
+            d.image_data.back()->imagecoll.images.front().metadata["Tag"] = "inner";
+
+            inner.Restore(d);
+            REQUIRE(tags_of(d) == std::vector<std::string>{ "outer", "second" });
+        }
+
+        // Objects protected by the outer snapshot remain protected after the inner snapshot is released.
+        REQUIRE(Drover_Snapshot::Active());
+        auto l_d = d;
+        outer.Restore(l_d);
+        REQUIRE(Drover_Snapshot::Detach(l_d.image_data.back()));
+
+        outer.Restore(d);
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "first", "second" });
+    }
+    REQUIRE(!Drover_Snapshot::Active());
+}
+
+TEST_CASE("Operation_Dispatcher detaches all objects for operations that do not declare their targets"){
+    auto d = make_test_drover();
+    std::map<std::string, std::string> InvocationMetadata;
+    const std::string FilenameLex;
+
+    const Drover_Snapshot snap(d);
+
+    // This operation does not document how it uses its arguments, so it might modify anything.
+    std::list<OperationArgPkg> ops;
+    ops.emplace_back("ConvertNaNsToZeros");
+    REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+    REQUIRE(!Drover_Snapshot::Detach(d.image_data.front()));
+    REQUIRE(!Drover_Snapshot::Detach(d.image_data.back()));
+
+    // Emulate the operation modifying an array in-place.
+    d.image_data.back()->imagecoll.images.front().reference(0, 0, 0) = 7.0f;
+
+    snap.Restore(d);
+    REQUIRE(first_pixel(d.image_data.back()) == 1.0f);
+}
+
+TEST_CASE("Operation_Dispatcher only detaches the egress selections of operations that declare their targets"){
+    auto d = make_test_drover();
+    std::map<std::string, std::string> InvocationMetadata;
+    const std::string FilenameLex;
+
+    const Drover_Snapshot snap(d);
+    const auto *orig_first = d.image_data.front().get();
+    const auto *orig_second = d.image_data.back().get();
+
+    std::list<OperationArgPkg> ops;
+    ops.emplace_back("ModifyImageMetadata:ImageSelection=first:KeyValues=Tag@changed");
+    REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+    REQUIRE(tags_of(d) == std::vector<std::string>{ "changed", "second" });
+    REQUIRE(d.image_data.front().get() != orig_first);
+    REQUIRE(d.image_data.back().get() == orig_second);
+
+    snap.Restore(d);
+    REQUIRE(tags_of(d) == std::vector<std::string>{ "first", "second" });
+    REQUIRE(d.image_data.front().get() == orig_first);
+}
+
+TEST_CASE("Operation_Dispatcher does not copy objects for operations that only read"){
+    auto d = make_test_drover();
+    std::map<std::string, std::string> InvocationMetadata;
+    const std::string FilenameLex;
+
+    const Drover_Snapshot snap(d);
+    const auto *orig_first = d.image_data.front().get();
+    const auto *orig_second = d.image_data.back().get();
+
+    std::list<OperationArgPkg> ops;
+    ops.emplace_back("CountObjects:Key=N:ImageSelection=all");
+    REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+    REQUIRE(InvocationMetadata.at("N") == "2");
+
+    // Neither array was copied, so both are still shared with the snapshot.
+    REQUIRE(d.image_data.front().get() == orig_first);
+    REQUIRE(d.image_data.back().get() == orig_second);
+    REQUIRE(Drover_Snapshot::Detach(d.image_data.front()));
+    REQUIRE(Drover_Snapshot::Detach(d.image_data.back()));
+}
+
+TEST_CASE("Transaction rolls back on failure"){
+    std::map<std::string, std::string> InvocationMetadata;
+    const std::string FilenameLex;
+
+    SUBCASE("single transaction"){
+        auto d = make_test_drover();
+        std::list<OperationArgPkg> ops;
+        ops.emplace_back("Transaction");
+        ops.back().makeChild("ModifyImageMetadata:ImageSelection=all:KeyValues=Tag@changed");
+        ops.back().makeChild("False");
+
+        REQUIRE(!Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "first", "second" });
+        REQUIRE(!Drover_Snapshot::Active());
+    }
+
+    SUBCASE("successful transaction commits"){
+        auto d = make_test_drover();
+        std::list<OperationArgPkg> ops;
+        ops.emplace_back("Transaction");
+        ops.back().makeChild("ModifyImageMetadata:ImageSelection=all:KeyValues=Tag@changed");
+
+        REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "changed", "changed" });
+    }
+
+    SUBCASE("nested transactions"){
+        auto d = make_test_drover();
+
+        // The inner transaction fails and is rolled back, but the outer transaction succeeds.
+        OperationArgPkg inner("Transaction");
+        inner.makeChild("ModifyImageMetadata:ImageSelection=last:KeyValues=Tag@inner");
+        inner.makeChild("False");
+
+        OperationArgPkg ignore("Ignore");
+        ignore.makeChild(inner);
+
+        std::list<OperationArgPkg> ops;
+        ops.emplace_back("Transaction");
+        ops.back().makeChild("ModifyImageMetadata:ImageSelection=first:KeyValues=Tag@outer");
+        ops.back().makeChild(ignore);
+
+        REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+        REQUIRE(tags_of(d) == std::vector<std::string>{ "outer", "second" });
+
+        // Both transactions are rolled back when the outer transaction fails.
+        auto d2 = make_test_drover();
+        ops.back().makeChild("False");
+        REQUIRE(!Operation_Dispatcher(d2, InvocationMetadata, FilenameLex, ops));
+        REQUIRE(tags_of(d2) == std::vector<std::string>{ "first", "second" });
+        REQUIRE(!Drover_Snapshot::Active());
+    }
+}
+
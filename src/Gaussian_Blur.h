@@ -0,0 +1,51 @@
+//Gaussian_Blur.h - A part of DICOMautomaton 2026. Written by hal clark.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+// Controls how each separable 1D Gaussian pass is computed.
+enum class GaussianBlurMethod {
+    Automatic,  // Select the cheaper method for each axis based on sigma.
+    Truncated,  // Sampled kernel truncated at a fixed number of sigmas. Cost grows linearly with sigma.
+    Recursive,  // Third-order recursive (IIR) filter of Young and van Vliet. Cost is independent of sigma.
+};
+
+struct GaussianBlurParams {
+    // The standard deviation along each axis, in voxels, ordered like (image, row, column).
+    //
+    // Note: Axes with non-positive sigma are not blurred.
+    std::array<double, 3> sigma = {{ 1.0, 1.0, 1.0 }};
+
+    GaussianBlurMethod method = GaussianBlurMethod::Automatic;
+
+    // The extent of truncated kernels, in sigmas.
+    double truncation = 3.0;
+
+    // The number of threads to use. Zero selects the hardware concurrency.
+    int64_t threads = 0;
+};
+
+
+// Weights of a sampled 1D Gaussian, normalized to sum to one and truncated at ceil(truncation * sigma) voxels from
+// the centre. The kernel always comprises at least three weights.
+std::vector<double> Gaussian_Kernel_Weights(double sigma, double truncation = 3.0);
+
+// Whether the recursive filter is used for the given sigma (in voxels) when the method is Automatic.
+bool Gaussian_Blur_Prefers_Recursive(double sigma, double truncation = 3.0);
+
+
+// Blur a dense volume in-place using three separable 1D passes, one per axis.
+//
+// Voxels are stored with channels varying fastest, then columns, rows, and images. Channels are blurred
+// independently. Voxels beyond the volume and non-finite voxels do not contribute, and the remaining weights are
+// renormalized. Voxels without any meaningful contribution retain their original value.
+template <class T>
+void Gaussian_Blur_Volume(T *data,
+                          const std::array<int64_t, 3> &dims,
+                          int64_t channels,
+                          const GaussianBlurParams &params);
+
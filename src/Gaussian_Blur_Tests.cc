@@ -0,0 +1,163 @@
+//Gaussian_Blur_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the separable Gaussian blur routines defined in Gaussian_Blur.cc.
+// Tests are separated into their own file because Gaussian_Blur_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "Gaussian_Blur.h"
+
+
+// Variance of an impulse response along one axis, measured through the centre of the volume.
+static
+double
+axis_variance(const std::vector<double> &v, const std::array<int64_t, 3> &dims, size_t axis){
+    const std::array<int64_t, 3> centre = {{ dims[0] / 2, dims[1] / 2, dims[2] / 2 }};
+    double sum = 0.0;
+    double sum_xx = 0.0;
+    for(int64_t x = 0; x < dims[axis]; ++x){
+        auto p = centre;
+        p[axis] = x;
+        const auto val = v[(p[0] * dims[1] + p[1]) * dims[2] + p[2]];
+        const auto d = static_cast<double>(x - centre[axis]);
+        sum += val;
+        sum_xx += val * d * d;
+    }
+    return sum_xx / sum;
+}
+
+static
+std::vector<double>
+impulse(const std::array<int64_t, 3> &dims){
+    std::vector<double> v(dims[0] * dims[1] * dims[2], 0.0);
+    v[((dims[0] / 2) * dims[1] + dims[1] / 2) * dims[2] + dims[2] / 2] = 1.0;
+    return v;
+}
+
+
+TEST_CASE("Gaussian_Kernel_Weights"){
+    const auto w = Gaussian_Kernel_Weights(2.0);
+    REQUIRE(w.size() == 13);
+    REQUIRE(std::accumulate(std::begin(w), std::end(w), 0.0) == doctest::Approx(1.0));
+    REQUIRE(w.front() == doctest::Approx(w.back()));
+    REQUIRE(w[5] < w[6]);
+
+    REQUIRE(Gaussian_Kernel_Weights(0.1).size() == 3);
+    REQUIRE_THROWS(Gaussian_Kernel_Weights(0.0));
+
+    REQUIRE(!Gaussian_Blur_Prefers_Recursive(1.0));
+    REQUIRE(Gaussian_Blur_Prefers_Recursive(10.0));
+}
+
+TEST_CASE("Gaussian_Blur_Volume"){
+    const std::array<int64_t, 3> dims = {{ 61, 61, 61 }};
+
+    for(const auto method : { GaussianBlurMethod::Truncated, GaussianBlurMethod::Recursive }){
+        GaussianBlurParams p;
+        p.method = method;
+        p.truncation = 5.0;
+        const double tol = (method == GaussianBlurMethod::Truncated) ? 0.01 : 0.05;
+
+        SUBCASE("impulse response has the requested, anisotropic width"){
+            p.sigma = {{ 1.5, 3.0, 6.0 }};
+            auto v = impulse(dims);
+            Gaussian_Blur_Volume(v.data(), dims, 1, p);
+            REQUIRE(std::accumulate(std::begin(v), std::end(v), 0.0) == doctest::Approx(1.0).epsilon(0.01));
+            for(size_t a = 0; a < 3; ++a){
+                REQUIRE(axis_variance(v, dims, a) == doctest::Approx(p.sigma[a] * p.sigma[a]).epsilon(tol));
+            }
+        }
+
+        SUBCASE("constant volumes remain constant, including at boundaries"){
+            p.sigma = {{ 4.0, 8.0, 20.0 }};
+            std::vector<float> v(dims[0] * dims[1] * dims[2] * 2);
+            for(size_t i = 0; i < v.size(); ++i) v[i] = (i % 2 == 0) ? 3.0f : -7.0f;
+            Gaussian_Blur_Volume(v.data(), dims, 2, p);
+            double max_diff = 0.0;
+            for(size_t i = 0; i < v.size(); ++i){
+                max_diff = std::max(max_diff, std::abs(v[i] - ((i % 2 == 0) ? 3.0 : -7.0)));
+            }
+            REQUIRE(max_diff < 1E-3);
+        }
+
+        SUBCASE("non-finite voxels are ignored and replaced"){
+            p.sigma = {{ 1.0, 1.0, 1.0 }};
+            std::vector<float> v(dims[0] * dims[1] * dims[2], 5.0f);
+            v[1000] = std::numeric_limits<float>::quiet_NaN();
+            v[2000] = std::numeric_limits<float>::infinity();
+            Gaussian_Blur_Volume(v.data(), dims, 1, p);
+            REQUIRE(v[1000] == doctest::Approx(5.0));
+            REQUIRE(v[2000] == doctest::Approx(5.0));
+            REQUIRE(v[1001] == doctest::Approx(5.0));
+        }
+    }
+
+    SUBCASE("recursive and truncated filters agree"){
+        std::mt19937 re(1234);
+        std::uniform_real_distribution<double> rd(0.0, 100.0);
+        std::vector<double> a(dims[0] * dims[1] * dims[2]);
+        for(auto &x : a) x = rd(re);
+        auto b = a;
+
+        GaussianBlurParams p;
+        p.sigma = {{ 2.0, 3.0, 5.0 }};
+        p.truncation = 5.0;
+        p.method = GaussianBlurMethod::Truncated;
+        Gaussian_Blur_Volume(a.data(), dims, 1, p);
+        p.method = GaussianBlurMethod::Recursive;
+        Gaussian_Blur_Volume(b.data(), dims, 1, p);
+
+        double max_diff = 0.0;
+        for(size_t i = 0; i < a.size(); ++i) max_diff = std::max(max_diff, std::abs(a[i] - b[i]));
+        REQUIRE(max_diff < 1.0);
+    }
+}
+
+TEST_CASE("Gaussian_Blur_Volume benchmark"){
+    // Sweep sigma, comparing the truncated and recursive methods. The cost of the latter should not depend on sigma.
+    const std::array<int64_t, 3> dims = {{ 64, 128, 128 }};
+    std::mt19937 re(4321);
+    std::uniform_real_distribution<float> rd(0.0f, 100.0f);
+    std::vector<float> orig(dims[0] * dims[1] * dims[2]);
+    for(auto &x : orig) x = rd(re);
+
+    const auto ms = [](auto a, auto b){
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count() / 1000.0;
+    };
+    for(const double sigma : { 1.0, 2.0, 4.0, 8.0, 16.0 }){
+        GaussianBlurParams p;
+        p.sigma = {{ sigma, sigma, sigma }};
+
+        auto a = orig;
+        p.method = GaussianBlurMethod::Truncated;
+        const auto t_start = std::chrono::steady_clock::now();
+        Gaussian_Blur_Volume(a.data(), dims, 1, p);
+        const auto t_truncated = std::chrono::steady_clock::now();
+
+        auto b = orig;
+        p.method = GaussianBlurMethod::Recursive;
+        Gaussian_Blur_Volume(b.data(), dims, 1, p);
+        const auto t_recursive = std::chrono::steady_clock::now();
+
+        MESSAGE("Sigma " << sigma << " voxels on " << dims[0] << "x" << dims[1] << "x" << dims[2] << ":"
+                << " truncated " << ms(t_start, t_truncated) << " ms,"
+                << " recursive " << ms(t_truncated, t_recursive) << " ms,"
+                << " automatic selection: "
+                << std::string(Gaussian_Blur_Prefers_Recursive(sigma) ? "recursive" : "truncated"));
+        REQUIRE(std::isfinite(a[a.size() / 2]));
+        REQUIRE(std::isfinite(b[b.size() / 2]));
+    }
+}
+
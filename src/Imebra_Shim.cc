@@ -18,6 +18,8 @@
 #include <functional>
 #include <iostream>
 #include <iomanip>
+#include <mutex>
+#include <sstream>
 #include <limits>
 #include <list>
 #include <map>
@@ -25,6 +27,7 @@
 #include <random>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>        //Needed for std::pair.
 #include <vector>
@@ -37,6 +40,7 @@
 #include "YgorImages.h"
 #include "YgorImagesIO.h"
 #include "YgorTAR.h"
+#include "YgorThreadPool.h"  //Needed for work_queue.
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
@@ -48,6 +52,7 @@
 #include "Imebra_Shim.h"
 
 #include "DCMA_DICOM.h"
+#include "DCMA_DICOM_PixelData.h"
 #include "Structs.h"
 #include "Metadata.h"
 #include "String_Parsing.h"
@@ -884,6 +889,31 @@ YLOGINFO("    This node is a leaf node. Creating a leaf tag");
 //
 //NOTE: On error, the output will be an empty string.
 std::string get_tag_as_string(const std::filesystem::path &filename, size_t U, size_t L){
+    // Try a memory-mapped read first, which stops as soon as the tag has been read and does not copy any values.
+    // Imebra is more lenient (e.g., it accepts files without a preamble), so it is used as a fallback.
+    try{
+        const auto tag = std::make_pair(static_cast<uint16_t>(U), static_cast<uint16_t>(L));
+        DCMA_DICOM::ReadOptions opts;
+        opts.stop_after = tag;
+        DCMA_DICOM::TreeView view;
+        view.read_DICOM(filename, { &DCMA_DICOM::get_default_dictionary() }, opts);
+
+        for(const auto i : view.children()){
+            const auto &n = view.nodes[i];
+            if( (n.key.group != tag.first) || (n.key.tag != tag.second) ) continue;
+
+            // Match Imebra, which provides only the first value of multi-valued elements.
+            if( (n.VR == "SQ") || n.encapsulated ) break;
+            auto val = n.value();
+            if(n.VR != "OB" && n.VR != "OW" && n.VR != "UN"
+            && n.VR != "LT" && n.VR != "ST" && n.VR != "UT"){
+                val = val.substr(0, val.find('\\'));
+            }
+            return val;
+        }
+        return std::string("");
+    }catch(const std::exception &){}
+
     using namespace puntoexe;
     ptr<puntoexe::stream> readStream(new puntoexe::stream);
     readStream->openFile(filename.c_str(), std::ios::in);
@@ -908,24 +938,20 @@ std::string get_patient_ID(const std::filesystem::path &filename){
 //Mass top-level tag enumeration, for ingress into database.
 //
 //NOTE: May not be complete. Add additional tags as needed!
+//
+// This overload harvests tags from an already-parsed data set, so callers that have already loaded the file (possibly
+// without its large buffers) do not need to parse it a second time.
+static
 metadata_map_t
-get_metadata_top_level_tags(const std::filesystem::path &filename){
+get_metadata_top_level_tags(puntoexe::ptr<puntoexe::imebra::dataSet> tds,
+                            const std::filesystem::path &filename){
     metadata_map_t out;
     const auto ctrim = CANONICALIZE::TRIM_ENDS;
-
-    //Attempt to parse the DICOM file and harvest the elements of interest. We are only interested in
-    // top-level elements specifying metadata (i.e., not pixel data) and will not need to recurse into 
-    // any DICOM sequences.
-    puntoexe::ptr<puntoexe::stream> readStream(new puntoexe::stream);
-    readStream->openFile(filename.c_str(), std::ios::in);
-    if(readStream == nullptr){
+    if(tds == nullptr){
         YLOGWARN("Could not parse file '" << filename << "'. Is it valid DICOM? Cannot continue");
         return out;
     }
 
-    puntoexe::ptr<puntoexe::streamReader> reader(new puntoexe::streamReader(readStream));
-    puntoexe::ptr<puntoexe::imebra::dataSet> tds = puntoexe::imebra::codecs::codecFactory::getCodecFactory()->load(reader);
-
     //We pull out all the data we need as strings. For single element strings, the SQL engine can directly perform
     // the type casting. The benefit of this is twofold: (1) the SQL engine hides the checking code, simplifying
     // this implementation, and (2) the SQL engine can appropriately handle SQL NULLs without extra conditionals
@@ -1579,6 +1605,23 @@ get_metadata_top_level_tags(const std::filesystem::path &filename){
     return out;
 }
 
+metadata_map_t
+get_metadata_top_level_tags(const std::filesystem::path &filename){
+    //Attempt to parse the DICOM file and harvest the elements of interest. We are only interested in
+    // top-level elements specifying metadata (i.e., not pixel data) and will not need to recurse into 
+    // any DICOM sequences.
+    puntoexe::ptr<puntoexe::stream> readStream(new puntoexe::stream);
+    readStream->openFile(filename.c_str(), std::ios::in);
+    if(readStream == nullptr){
+        YLOGWARN("Could not parse file '" << filename << "'. Is it valid DICOM? Cannot continue");
+        return metadata_map_t();
+    }
+
+    puntoexe::ptr<puntoexe::streamReader> reader(new puntoexe::streamReader(readStream));
+    puntoexe::ptr<puntoexe::imebra::dataSet> tds = puntoexe::imebra::codecs::codecFactory::getCodecFactory()->load(reader);
+    return get_metadata_top_level_tags(tds, filename);
+}
+
 
 
 //------------------ Contours ---------------------
@@ -1765,22 +1808,117 @@ std::unique_ptr<Contour_Data> get_Contour_Data(const std::filesystem::path &file
 
 //-------------------- Images ----------------------
 
+// Images with deferred pixel data retain the file and frame they were loaded from in their metadata, so the reference
+// survives collation, copying, and partitioning. The keys are kept after the pixel data are decoded so that clean
+// images can be discarded and decoded again (see Image_Array::pixels_dirty).
+static const std::string deferred_file_key     = "DeferredPixelDataFile";
+static const std::string deferred_frame_key    = "DeferredPixelDataFrame";
+
+// Buffers larger than this are not read when loading with deferred pixel data.
+static const imbxUint32 deferred_max_buffer_load = 4096;
+
+// Decode uncompressed little-endian MONOCHROME2 pixel data directly, fusing the linear Modality LUT into a single pass
+// over the samples. This bypasses Imebra's per-sample accessors, which dominate load time for large images.
+//
+// Only files that Load_Image_Array() would map using the top-level RescaleSlope and RescaleIntercept alone are accepted,
+// so the result is identical to the Imebra path. Returns std::nullopt if the file is not eligible.
+static
+std::optional<planar_image_collection<float,double>>
+load_native_monochrome_frames(const std::filesystem::path &filename){
+    try{
+        DCMA_DICOM::TreeView view;
+        view.read_DICOM(filename, { &DCMA_DICOM::get_default_dictionary() });
+
+        // Real-world value maps and per-frame transformations take precedence over the rescale tags. Float pixel data
+        // are not handled by Imebra.
+        if( (view.find(0x0040, 0x9096) != nullptr)   // RealWorldValueMappingSequence
+        ||  (view.find(0x0028, 0x9145) != nullptr)   // PixelValueTransformationSequence
+        ||  (view.find(0x7FE0, 0x0008) != nullptr)   // FloatPixelData
+        ||  (view.find(0x7FE0, 0x0009) != nullptr) ){ // DoubleFloatPixelData
+            return std::nullopt;
+        }
+
+        // Big-endian and encapsulated transfer syntaxes are left to Imebra.
+        const auto *ts = view.find(0x0002, 0x0010);
+        auto ts_uid = (ts == nullptr) ? std::string() : ts->value();
+        while(!ts_uid.empty() && ((ts_uid.back() == '\0') || (ts_uid.back() == ' '))) ts_uid.pop_back();
+        if( (ts_uid != "1.2.840.10008.1.2")      // Implicit VR Little Endian.
+        &&  (ts_uid != "1.2.840.10008.1.2.1") ){ // Explicit VR Little Endian.
+            return std::nullopt;
+        }
+
+        const auto *pi = view.find(0x0028, 0x0004);
+        if( (pi == nullptr)
+        ||  (Canonicalize_String2(pi->value(), CANONICALIZE::TRIM_ENDS) != "MONOCHROME2") ){
+            return std::nullopt;
+        }
+
+        // Only now are the pixel data copied out of the mapped file.
+        const auto root = view.to_Node();
+        const auto has_top_level = [&root](uint16_t group, uint16_t tag){
+            return std::any_of(std::begin(root.children), std::end(root.children),
+                               [&](const DCMA_DICOM::Node &n){ return (n.key.group == group) && (n.key.tag == tag); });
+        };
+        if( !has_top_level(0x0028, 0x1052)    // RescaleIntercept
+        ||  !has_top_level(0x0028, 0x1053) ){ // RescaleSlope
+            return std::nullopt;
+        }
+
+        const auto desc = DCMA_DICOM::get_pixel_data_desc(root);
+        if( !desc
+        ||  (Canonicalize_String2(desc->photometric_interpretation, CANONICALIZE::TRIM_ENDS) != "MONOCHROME2")
+        ||  (desc->samples_per_pixel != 1)
+        ||  ( (desc->bits_allocated != 8) && (desc->bits_allocated != 16) && (desc->bits_allocated != 32) ) ){
+            return std::nullopt;
+        }
+        return DCMA_DICOM::extract_native_pixel_data(root, DCMA_DICOM::get_modality_lut_params(root));
+
+    }catch(const std::exception &e){
+        YLOGDEBUG("Native pixel data decoding failed: '" << e.what() << "'");
+    }
+    return std::nullopt;
+}
+
 // Load a single 2D image or a multi-frame MR image array.
 //
 // Note that individual images loaded as part of a set will likely need to be collated.
 std::unique_ptr<Image_Array>
-Load_Image_Array(const std::filesystem::path &FilenameIn){
+Load_Image_Array(const std::filesystem::path &FilenameIn,
+                 bool defer_pixel_data){
     const auto inf = std::numeric_limits<double>::infinity();
     auto out = std::make_unique<Image_Array>();
+    out->pixels_dirty = false;
+
+    // Deferred pixel data are decoded when an operation first selects the images.
+    if(defer_pixel_data){
+        static std::once_flag registered;
+        std::call_once(registered, [](){
+            Register_Deferred_Pixel_Decoder([](std::list<std::shared_ptr<Image_Array>> &img_arrays){
+                Materialize_Image_Pixels(img_arrays);
+            });
+        });
+    }
+
+    // Eligible pixel data are decoded without Imebra. The file is memory-mapped, so this is cheap when ineligible.
+    std::optional<planar_image_collection<float,double>> native_frames;
+    if(!defer_pixel_data){
+        native_frames = load_native_monochrome_frames(FilenameIn);
+    }
 
     using namespace puntoexe;
     ptr<puntoexe::stream> readStream(new puntoexe::stream);
     readStream->openFile(FilenameIn.c_str(), std::ios::in);
 
+    // When deferring pixel data, Imebra leaves large buffers (i.e., PixelData) in the file and only records their
+    // offsets, so they are never read from disk here. The same applies when the pixel data were decoded above; Imebra
+    // will load the buffers on demand if they are needed after all.
+    const imbxUint32 max_buffer_load = (defer_pixel_data || native_frames) ? deferred_max_buffer_load : 0xffffffff;
     ptr<puntoexe::streamReader> reader(new puntoexe::streamReader(readStream));
-    ptr<imebra::dataSet> TopDataSet = imebra::codecs::codecFactory::getCodecFactory()->load(reader);
+    ptr<imebra::dataSet> TopDataSet = imebra::codecs::codecFactory::getCodecFactory()->load(reader, max_buffer_load);
 
-    const auto tlm = get_metadata_top_level_tags(FilenameIn);
+    // Harvest metadata from the data set loaded above rather than re-parsing the file, which would read the pixel
+    // data even when deferring it.
+    const auto tlm = get_metadata_top_level_tags(TopDataSet, FilenameIn);
 
     const auto l_coalesce_metadata_as_vector_double = [&tlm](const std::list<std::string>& keys ){
         return convert_to_vector_double( coalesce_metadata_as_string(tlm, keys) );
@@ -1806,6 +1944,14 @@ Load_Image_Array(const std::filesystem::path &FilenameIn){
     const auto modality = l_coalesce_as_string({ { {0x0008, 0x0060, 0} } }).value();
     const auto frame_count = l_coalesce_as_long_int({ { {0x0028, 0x0008, 0} } }).value_or(1);
 
+    if( native_frames
+    &&  (static_cast<int64_t>(native_frames->images.size()) != frame_count) ){
+        YLOGDEBUG("Natively-decoded frame count does not match, falling back to Imebra");
+        native_frames = {};
+    }
+    auto native_frame_it = (native_frames) ? std::begin(native_frames->images)
+                                           : std::list<planar_image<float,double>>::iterator();
+
     // ---------------------------------------- Image Metadata ----------------------------------------------
 
     for(uint32_t f = 0; f < frame_count; ++f){
@@ -2060,6 +2206,44 @@ Load_Image_Array(const std::filesystem::path &FilenameIn){
 
         const bool real_world_map_present = !!real_world_mapping;
 
+        // Record where the pixel data can be found and allocate nothing. The number of channels is predicted from the
+        // colour transform performed below; it is verified when the pixel data are eventually decoded.
+        if(defer_pixel_data){
+            const auto photometric = l_coalesce_as_string({ { {0x0028, 0x0004, 0} } }).value_or(""); // PhotometricInterpretation
+            const auto samples = l_coalesce_as_long_int({ { {0x0028, 0x0002, 0} } }).value_or(1); // SamplesPerPixel
+            const int64_t img_chnls = (photometric == "PALETTE COLOR") ? 3 : std::max<int64_t>(1, samples);
+
+            l_meta[deferred_file_key]  = FilenameIn.string();
+            l_meta[deferred_frame_key] = std::to_string(f);
+
+            auto &img = out->imagecoll.images.back();
+            img.metadata = l_meta;
+            img.init_orientation(image_orien_r, image_orien_c);
+            img.init_buffer(image_rows, image_cols, img_chnls);
+            img.init_spatial(image_pxldx, image_pxldy, image_thickness, image_anchor, image_pos);
+            img.data.clear();
+            img.data.shrink_to_fit();
+            continue;
+        }
+
+        // Use the natively-decoded pixel data, which already have the Modality LUT applied.
+        if(native_frames){
+            auto &native_img = *(native_frame_it++);
+            if( (native_img.rows == image_rows)
+            &&  (native_img.columns == image_cols)
+            &&  (native_img.channels == 1)
+            &&  real_world_map_present ){
+                auto &img = out->imagecoll.images.back();
+                img.metadata = l_meta;
+                img.init_orientation(image_orien_r, image_orien_c);
+                img.init_buffer(image_rows, image_cols, 1);
+                img.init_spatial(image_pxldx, image_pxldy, image_thickness, image_anchor, image_pos);
+                img.data.swap(native_img.data);
+                continue;
+            }
+            YLOGDEBUG("Natively-decoded frame does not match, falling back to Imebra");
+        }
+
         // -------------------------------------- Image Pixel Data -----------------------------------------
         ptr<puntoexe::imebra::image> firstImage;
         try{
@@ -2259,13 +2443,44 @@ Load_Image_Array(const std::filesystem::path &FilenameIn){
     return out;
 }
 
-//These 'shared' pointers will actually be unique. This routine just converts from unique to shared for you.
-std::list<std::shared_ptr<Image_Array>>  Load_Image_Arrays(const std::list<std::filesystem::path> &filenames){
-    std::list<std::shared_ptr<Image_Array>> out;
-    for(const auto & filename : filenames){
-        out.push_back(Load_Image_Array(filename));
+//Apply a single-file loader to each file concurrently. The output order matches the input order. If any file cannot be
+// loaded, the first (in input order) exception is rethrown after all files have been processed.
+static
+std::list<std::shared_ptr<Image_Array>>
+load_arrays_concurrently(const std::list<std::filesystem::path> &filenames,
+                         uint32_t concurrency,
+                         const std::function<std::unique_ptr<Image_Array>(const std::filesystem::path &)> &loader){
+    const auto N = filenames.size();
+    std::vector<std::shared_ptr<Image_Array>> slots(N);
+    std::vector<std::exception_ptr> errors(N);
+    if(concurrency == 0) concurrency = std::max<uint32_t>(1U, std::thread::hardware_concurrency());
+    {
+        work_queue<std::function<void(void)>> wq(concurrency);
+        size_t i = 0;
+        for(const auto & filename : filenames){
+            wq.submit_task([&,i]() -> void {
+                try{
+                    slots[i] = loader(filename);
+                }catch(...){
+                    errors[i] = std::current_exception();
+                }
+            });
+            ++i;
+        }
+    } // Wait for all files to be loaded.
+
+    for(const auto &e : errors){
+        if(e) std::rethrow_exception(e);
     }
-    return out;
+    return std::list<std::shared_ptr<Image_Array>>(slots.begin(), slots.end());
+}
+
+//These 'shared' pointers will actually be unique. This routine just converts from unique to shared for you.
+std::list<std::shared_ptr<Image_Array>>  Load_Image_Arrays(const std::list<std::filesystem::path> &filenames,
+                                                           uint32_t concurrency){
+    return load_arrays_concurrently(filenames, concurrency, [](const std::filesystem::path &f){
+        return Load_Image_Array(f);
+    });
 }
 
 //Since many images must be loaded individually from a file, we will often have to collate them together.
@@ -2281,6 +2496,10 @@ std::unique_ptr<Image_Array> Collate_Image_Arrays(std::list<std::shared_ptr<Imag
     std::unique_ptr<Image_Array> out(new Image_Array);
     if(in.empty()) return out;
 
+    // The collated pixel data are only clean if all inputs are.
+    out->pixels_dirty = std::any_of(std::begin(in), std::end(in),
+                                    [](const std::shared_ptr<Image_Array> &ia){ return ia->pixels_dirty; });
+
     //Start from the end and work toward the beginning so we can easily pop the end. Keep all images in
     // the original list to ease collating to the first element.
     while(!in.empty()){
@@ -2297,6 +2516,107 @@ std::unique_ptr<Image_Array> Collate_Image_Arrays(std::list<std::shared_ptr<Imag
     return out;
 }
 
+bool Image_Pixels_Are_Deferred(const planar_image<float,double> &img){
+    return img.data.empty()
+        && (img.metadata.count(deferred_file_key) != 0)
+        && (0 < (img.rows * img.columns * img.channels));
+}
+
+int64_t Materialize_Image_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays,
+                                 uint32_t concurrency){
+    // Group deferred images by source file so each file is decoded only once, even when it contains many frames or
+    // when the images have been copied.
+    std::map<std::string, std::list<planar_image<float,double>*>> by_file;
+    for(auto &ia_ptr : img_arrays){
+        if(ia_ptr == nullptr) continue;
+        for(auto &img : ia_ptr->imagecoll.images){
+            if(Image_Pixels_Are_Deferred(img)){
+                by_file[ img.metadata.at(deferred_file_key) ].push_back(&img);
+            }
+        }
+    }
+    if(by_file.empty()) return 0;
+
+    int64_t count = 0;
+    for(const auto &p : by_file) count += static_cast<int64_t>(p.second.size());
+    YLOGINFO("Decoding deferred pixel data for " << count << " images from " << by_file.size() << " files");
+
+    std::vector<std::exception_ptr> errors(by_file.size());
+    {
+        if(concurrency == 0) concurrency = std::max<uint32_t>(1U, std::thread::hardware_concurrency());
+        work_queue<std::function<void(void)>> wq(concurrency);
+        size_t i = 0;
+        for(auto &p : by_file){
+            wq.submit_task([&,i]() -> void {
+                try{
+                    const auto loaded = Load_Image_Array(p.first);
+                    std::vector<planar_image<float,double>*> frames;
+                    for(auto &img : loaded->imagecoll.images) frames.push_back(&img);
+
+                    for(auto *img_ptr : p.second){
+                        const auto f = std::stoul(img_ptr->metadata.at(deferred_frame_key));
+                        if(frames.size() <= f){
+                            throw std::runtime_error("Deferred frame not found in '"_s + p.first + "'");
+                        }
+                        const auto &src = *(frames.at(f));
+                        if( (src.rows != img_ptr->rows)
+                        ||  (src.columns != img_ptr->columns) ){
+                            throw std::runtime_error("Deferred pixel data in '"_s + p.first + "' has changed dimensions");
+                        }
+                        img_ptr->channels = src.channels;
+                        img_ptr->data = src.data;
+                    }
+                }catch(...){
+                    errors[i] = std::current_exception();
+                }
+            });
+            ++i;
+        }
+    } // Wait for all files to be decoded.
+
+    for(const auto &e : errors){
+        if(e) std::rethrow_exception(e);
+    }
+    return count;
+}
+
+int64_t Evict_Image_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays,
+                           int64_t budget_bytes){
+    int64_t resident = 0;
+    for(const auto &ia_ptr : img_arrays){
+        if(ia_ptr == nullptr) continue;
+        for(const auto &img : ia_ptr->imagecoll.images){
+            resident += static_cast<int64_t>(img.data.size() * sizeof(float));
+        }
+    }
+
+    int64_t evicted = 0;
+    for(auto &ia_ptr : img_arrays){
+        if(resident <= budget_bytes) break;
+
+        // Only discard buffers that can be recovered exactly, i.e., those that have not been modified.
+        if( (ia_ptr == nullptr)
+        ||  ia_ptr->pixels_dirty ) continue;
+
+        for(auto &img : ia_ptr->imagecoll.images){
+            if(resident <= budget_bytes) break;
+            if( img.data.empty()
+            ||  (img.metadata.count(deferred_file_key) == 0)
+            ||  (img.metadata.count(deferred_frame_key) == 0) ) continue;
+
+            const auto bytes = static_cast<int64_t>(img.data.size() * sizeof(float));
+            img.data.clear();
+            img.data.shrink_to_fit();
+            resident -= bytes;
+            evicted += bytes;
+        }
+    }
+    if(0 < evicted){
+        YLOGINFO("Evicted " << evicted << " bytes of pixel data to satisfy the memory budget");
+    }
+    return evicted;
+}
+
 
 //--------------------- Dose -----------------------
 //This routine reads a single DICOM dose file.
@@ -2465,12 +2785,9 @@ std::unique_ptr<Image_Array>  Load_Dose_Array(const std::filesystem::path &Filen
 }
 
 //These 'shared' pointers will actually be unique. This routine just converts from unique to shared for you.
-std::list<std::shared_ptr<Image_Array>>  Load_Dose_Arrays(const std::list<std::filesystem::path> &filenames){
-    std::list<std::shared_ptr<Image_Array>> out;
-    for(const auto & filename : filenames){
-        out.push_back(Load_Dose_Array(filename));
-    }
-    return out;
+std::list<std::shared_ptr<Image_Array>>  Load_Dose_Arrays(const std::list<std::filesystem::path> &filenames,
+                                                          uint32_t concurrency){
+    return load_arrays_concurrently(filenames, concurrency, Load_Dose_Array);
 }
 
 //-------------------- Plans ------------------------
@@ -45,20 +45,46 @@ std::unique_ptr<Contour_Data>  get_Contour_Data(const std::filesystem::path &fil
 
 //-------------------- Images ----------------------
 //This routine will often result in an array with only a single image. So collate output as needed.
-std::unique_ptr<Image_Array> Load_Image_Array(const std::filesystem::path &filename);
+//
+//If 'defer_pixel_data' is true, image geometry and metadata are loaded but pixel data are neither read nor decoded.
+//Image buffers are left empty and the source file is recorded in the metadata; use Materialize_Image_Pixels() to
+//decode them before access.
+std::unique_ptr<Image_Array> Load_Image_Array(const std::filesystem::path &filename,
+                                              bool defer_pixel_data = false);
 
 //These pointers will actually be unique. This just aims to convert from unique_ptr to shared_ptr for you.
-std::list<std::shared_ptr<Image_Array>>  Load_Image_Arrays(const std::list<std::filesystem::path> &filenames);
+//
+//Files are loaded concurrently using at most 'concurrency' threads (zero means one per core). Output order matches input.
+std::list<std::shared_ptr<Image_Array>>  Load_Image_Arrays(const std::list<std::filesystem::path> &filenames,
+                                                           uint32_t concurrency = 0);
 
 //Since many images must be loaded individually from a file, we will often have to collate them together.
 std::unique_ptr<Image_Array> Collate_Image_Arrays(std::list<std::shared_ptr<Image_Array>> &in);
 
+//Deferred pixel data support.
+//
+//Returns true if the image's pixel data has not yet been decoded (or has been evicted).
+bool Image_Pixels_Are_Deferred(const planar_image<float,double> &img);
+
+//Decode all deferred pixel data. Each source file is decoded once. Returns the number of images decoded.
+int64_t Materialize_Image_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays,
+                                 uint32_t concurrency = 0);
+
+//Discard decoded pixel data until at most 'budget_bytes' remain resident. Only deferred pixel data in clean image
+//arrays (see Image_Array::pixels_dirty) can be decoded again and discarded, so the budget may not be achievable.
+//Returns the number of bytes discarded.
+int64_t Evict_Image_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays,
+                           int64_t budget_bytes);
+
 
 //--------------------- Dose -----------------------
 std::unique_ptr<Image_Array> Load_Dose_Array(const std::filesystem::path &filename);
 
 //These pointers will actually be unique. This just aims to convert from unique_ptr to shared_ptr for you.
-std::list<std::shared_ptr<Image_Array>>  Load_Dose_Arrays(const std::list<std::filesystem::path> &filenames);
+//
+//Files are loaded concurrently using at most 'concurrency' threads (zero means one per core). Output order matches input.
+std::list<std::shared_ptr<Image_Array>>  Load_Dose_Arrays(const std::list<std::filesystem::path> &filenames,
+                                                          uint32_t concurrency = 0);
 
 //-------------------- Plans ------------------------
 std::unique_ptr<RTPlan> Load_RTPlan(const std::filesystem::path &filename);
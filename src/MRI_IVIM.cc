@@ -17,6 +17,8 @@
 #include <numeric>
 #include <cstdint>
 #include <random>
+#include <thread>
+#include <functional>
 
 #include "YgorMisc.h"
 #include "YgorMath.h"
@@ -37,6 +39,7 @@
 #include "Regex_Selectors.h"
 #include "BED_Conversion.h"
 #include "YgorImages_Functors/Compute/Joint_Pixel_Sampler.h"
+#include "Thread_Pool.h"
 
 #include "MRI_IVIM.h"
 
@@ -733,6 +736,282 @@ std::array<double, 7> GetBiExp(const std::vector<float> &bvalues,
     return {f, D, pseudoD, static_cast<double>(iters_attempted), static_cast<double>(successful_updates), cost, 1100.0};
 }
 
+biexp_dictionary::biexp_dictionary(const std::vector<float> &bvalues,
+                                   int64_t N_pseudoD,
+                                   double pseudoD_min,
+                                   double pseudoD_max){
+    if( (N_pseudoD < 2)
+    ||  !(0.0 < pseudoD_min)
+    ||  !(pseudoD_min < pseudoD_max) ){
+        throw std::invalid_argument("Invalid pseudo-diffusion grid. Cannot continue.");
+    }
+    this->N_bvalues = static_cast<int64_t>(bvalues.size());
+
+    // Logarithmic spacing resolves the slowly-decaying (small Dp) curves, which differ most from one another.
+    const auto log_ratio = std::log(pseudoD_max / pseudoD_min);
+    for(int64_t k = 0; k < N_pseudoD; ++k){
+        const auto t = static_cast<double>(k) / static_cast<double>(N_pseudoD - 1);
+        const auto pseudoD = pseudoD_min * std::exp(t * log_ratio);
+        this->pseudoDs.push_back(pseudoD);
+        for(const auto &b : bvalues){
+            this->curves.push_back( std::exp(-static_cast<double>(b) * pseudoD) );
+        }
+    }
+}
+
+std::array<double, 2>
+biexp_dictionary::match(const double *sigs,
+                        const double *exp_D,
+                        double f_min,
+                        double f_max) const {
+    // With D fixed, the residual is linear in f:
+    //
+    //    sigs - exp(-b*D) = f * [ exp(-b*Dp) - exp(-b*D) ]   or   z = f * a
+    //
+    // so the optimal f for each tabulated Dp is <z,a>/<a,a>, and the cost (up to a constant) is f^2 <a,a> - 2 f <z,a>.
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    std::array<double, 2> best = {nan, nan};
+    double best_cost = std::numeric_limits<double>::infinity();
+
+    const auto N_pseudoD = static_cast<int64_t>(this->pseudoDs.size());
+    for(int64_t k = 0; k < N_pseudoD; ++k){
+        const double *curve = this->curves.data() + k * this->N_bvalues;
+        double za = 0.0;
+        double aa = 0.0;
+        for(int64_t i = 0; i < this->N_bvalues; ++i){
+            const double z = sigs[i] - exp_D[i];
+            const double a = curve[i] - exp_D[i];
+            za += z * a;
+            aa += a * a;
+        }
+        const double f = (0.0 < aa) ? std::clamp(za / aa, f_min, f_max) : f_min;
+        const double cost = f * f * aa - 2.0 * f * za;
+        if(cost < best_cost){
+            best_cost = cost;
+            best = {f, this->pseudoDs[k]};
+        }
+    }
+    return best;
+}
+
+int64_t
+biexp_dictionary::size() const {
+    return static_cast<int64_t>(this->pseudoDs.size());
+}
+
+std::vector<std::array<double, 7>> GetBiExp_Batch(const std::vector<float> &bvalues,
+                                                  const std::vector<float> &vals,
+                                                  int numIterations,
+                                                  float b_value_threshold,
+                                                  int64_t batch_size,
+                                                  int64_t concurrency){
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr auto index_vox_status = 6UL;
+    const auto number_bVals = bvalues.size();
+    if( (number_bVals == 0UL)
+    ||  ((vals.size() % number_bVals) != 0UL) ){
+        throw std::invalid_argument("Voxel intensities do not correspond to the b-values. Cannot continue.");
+    }
+    const auto N_voxels = vals.size() / number_bVals;
+
+    std::array<double, 7> default_out = {nan, nan, nan, nan, nan, nan, nan};
+    std::get<index_vox_status>(default_out) = 1001.0;
+    std::vector<std::array<double, 7>> out(N_voxels, default_out);
+
+    // The following only depend on the b-values, so they are shared by all voxels.
+    size_t b0_index = number_bVals;
+    for(size_t i = 0UL; (i < number_bVals); ++i){
+        if (bvalues[i] == 0.0){ 
+            b0_index = i;
+            break;
+        }
+    }
+    if(b0_index == number_bVals){
+        for(auto &o : out) std::get<index_vox_status>(o) = 1006.0;
+        return out;
+    }
+
+    std::vector<size_t> high_b_indices;
+    std::vector<float> bvaluesH;
+    for(size_t i = 0UL; i < number_bVals; ++i){
+        if (bvalues[i] > b_value_threshold){
+            high_b_indices.push_back(i);
+            bvaluesH.push_back(bvalues[i]);
+        }
+    }
+    if(bvaluesH.size() < 2UL){
+        for(auto &o : out) std::get<index_vox_status>(o) = 1011.0;
+        return out;
+    }
+
+    // Same parameter bounds as GetBiExp().
+    const double f_min = 0.0;
+    const double f_max = 0.5;
+    const double pseudoD_min = 3.0e-3;
+    const double pseudoD_max = 200.0e-3;
+    const biexp_dictionary dict(bvalues, 64, pseudoD_min, pseudoD_max);
+
+    const auto fit_voxels = [&](size_t first, size_t last) -> void {
+        // Scratch space, reused for every voxel in the batch.
+        std::vector<float> signalsH(bvaluesH.size());
+        std::vector<double> sigs(number_bVals);
+        std::vector<double> exp_D(number_bVals);
+        std::vector<double> exp_pseudo(number_bVals);
+        std::vector<double> exp_pseudo_new(number_bVals);
+        std::vector<double> r(number_bVals);
+        std::vector<double> r_new(number_bVals);
+
+        for(size_t v = first; v < last; ++v){
+            auto &o = out[v];
+            const float *S = vals.data() + v * number_bVals;
+
+            // Step 1: Estimate D using WLLS, falling back to ADC-ls.
+            for(size_t k = 0UL; k < high_b_indices.size(); ++k){
+                signalsH[k] = S[high_b_indices[k]];
+            }
+            double D = GetADC_WLLS(bvaluesH, signalsH);
+            if(!std::isfinite(D) || (D <= 0.0)){
+                D = GetADCls(bvaluesH, signalsH);
+                if(!std::isfinite(D) || (D <= 0.0)){
+                    std::get<index_vox_status>(o) = 1016.0;
+                    continue;
+                }
+            }
+
+            // Step 2: Normalize the signal.
+            bool normalized = true;
+            for(size_t i = 0UL; i < number_bVals; ++i){
+                const float norm_sig = S[i] / S[b0_index];
+                normalized = normalized && std::isfinite(norm_sig);
+                sigs[i] = norm_sig;
+                exp_D[i] = std::exp(-bvalues[i] * D);
+            }
+            if(!normalized){
+                std::get<index_vox_status>(o) = 1021.0;
+                continue;
+            }
+
+            // Step 3: Initialize f and D* from the dictionary.
+            auto [f, pseudoD] = dict.match(sigs.data(), exp_D.data(), f_min, f_max);
+
+            double cost = 0.0;
+            for(size_t i = 0UL; i < number_bVals; ++i){
+                exp_pseudo[i] = std::exp(-bvalues[i] * pseudoD);
+                r[i] = sigs[i] - (f * exp_pseudo[i] + (1.0 - f) * exp_D[i]);
+                cost += r[i] * r[i];
+            }
+            cost *= 0.5;
+            if(!std::isfinite(cost)){
+                std::get<index_vox_status>(o) = 1026.0;
+                continue;
+            }
+
+            // Step 4: Refine f and D* using Levenberg-Marquardt.
+            //
+            // Only two parameters are fitted, so the damped normal equations are solved in closed form. The dictionary
+            // match is already a valid estimate, so numerical difficulties end refinement rather than the fit.
+            double lambda = 1.0;
+            int64_t iters_attempted = 0;
+            int64_t successful_updates = 0;
+            for(int64_t iter = 0; iter < numIterations; ++iter){
+                ++iters_attempted;
+
+                // Accumulate J^T*J and J^T*r, where
+                //   S = f*exp(-b*D*) + (1-f)*exp(-b*D)  so  ∂/∂f = exp(-b*D*) - exp(-b*D)  and  ∂/∂D* = -b*f*exp(-b*D*).
+                double JTJ_00 = 0.0;
+                double JTJ_01 = 0.0;
+                double JTJ_11 = 0.0;
+                double JTr_0 = 0.0;
+                double JTr_1 = 0.0;
+                for(size_t i = 0UL; i < number_bVals; ++i){
+                    const double J_0 = exp_pseudo[i] - exp_D[i];
+                    const double J_1 = -bvalues[i] * f * exp_pseudo[i];
+                    JTJ_00 += J_0 * J_0;
+                    JTJ_01 += J_0 * J_1;
+                    JTJ_11 += J_1 * J_1;
+                    JTr_0 += J_0 * r[i];
+                    JTr_1 += J_1 * r[i];
+                }
+                const double det = JTJ_00 * JTJ_11 - JTJ_01 * JTJ_01;
+                if(!std::isfinite(det) || (std::abs(det) < 1e-15)){
+                    break;
+                }
+
+                const double A_00 = JTJ_00 + lambda;
+                const double A_11 = JTJ_11 + lambda;
+                const double A_det = A_00 * A_11 - JTJ_01 * JTJ_01;
+                const double h_0 = (A_11 * JTr_0 - JTJ_01 * JTr_1) / A_det;
+                const double h_1 = (A_00 * JTr_1 - JTJ_01 * JTr_0) / A_det;
+                if(!std::isfinite(h_0) || !std::isfinite(h_1)){
+                    break;
+                }
+
+                const double new_f = std::clamp(f + h_0, f_min, f_max);
+                const double new_pseudoD = std::clamp(pseudoD + h_1, pseudoD_min, pseudoD_max);
+
+                double new_cost = 0.0;
+                for(size_t i = 0UL; i < number_bVals; ++i){
+                    exp_pseudo_new[i] = std::exp(-bvalues[i] * new_pseudoD);
+                    r_new[i] = sigs[i] - (new_f * exp_pseudo_new[i] + (1.0 - new_f) * exp_D[i]);
+                    new_cost += r_new[i] * r_new[i];
+                }
+                new_cost *= 0.5;
+
+                if(!std::isfinite(new_cost)){
+                    lambda *= 2.0;
+                    continue;
+                }
+
+                if(new_cost < cost){
+                    const double rel_change = (cost - new_cost) / (cost + 1e-12);
+                    std::swap(r, r_new);
+                    std::swap(exp_pseudo, exp_pseudo_new);
+                    f = new_f;
+                    pseudoD = new_pseudoD;
+                    cost = new_cost;
+                    lambda /= 2.0;
+                    ++successful_updates;
+
+                    if(rel_change < 1e-8){
+                        break;
+                    }
+                }else{
+                    lambda *= 2.0;
+                }
+
+                if(lambda > 1e8){
+                    break;
+                }
+                if(lambda < 1e-10){
+                    lambda = 1e-10;
+                }
+            }
+
+            if(!std::isfinite(f) || !std::isfinite(D) || !std::isfinite(pseudoD)){
+                std::get<index_vox_status>(o) = 1056.0;
+                continue;
+            }
+            o = {f, D, pseudoD, static_cast<double>(iters_attempted), static_cast<double>(successful_updates), cost, 1100.0};
+        }
+        return;
+    };
+
+    batch_size = std::max<int64_t>(1, batch_size);
+    concurrency = (0 < concurrency) ? concurrency
+                                    : std::max<int64_t>(1, static_cast<int64_t>(std::thread::hardware_concurrency()));
+    {
+        work_queue<std::function<void(void)>> wq(static_cast<unsigned int>(concurrency));
+        for(size_t first = 0UL; first < N_voxels; first += static_cast<size_t>(batch_size)){
+            const auto last = std::min(N_voxels, first + static_cast<size_t>(batch_size));
+            wq.submit_task([&, first, last]() -> void {
+                fit_voxels(first, last);
+            });
+        }
+    } // Complete tasks and terminate thread pool.
+
+    return out;
+}
+
 
 std::array<double, 6> GetBiExp_SegmentedOLS(const std::vector<float> &bvalues,
                                             const std::vector<float> &vals,
@@ -1422,6 +1701,104 @@ TEST_CASE( "MRI_IVIM::GetBiExp_SegmentedOLS with Rician noise" ){
 }
 
 
+TEST_CASE( "MRI_IVIM::GetBiExp_Batch" ){
+    const std::vector<float> b_vals = { 0, 20, 30, 40, 50, 60, 70, 80, 90, 100, 120, 150, 250, 400, 800, 1000 };
+    const int num_iters = 100;
+
+    SUBCASE("dictionary matches tabulated curves exactly"){
+        const MRI_IVIM::biexp_dictionary dict(b_vals, 16, 3.0e-3, 200.0e-3);
+        REQUIRE(dict.size() == 16);
+
+        const double D = 0.001;
+        const double Dp = 3.0e-3 * std::pow(200.0 / 3.0, 5.0 / 15.0); // The 6th grid point.
+        std::vector<double> sigs;
+        std::vector<double> exp_D;
+        for(const auto b : b_vals){
+            sigs.push_back( MRI_IVIM::evaluate_biexp(b, 1.0, 0.2, D, Dp) );
+            exp_D.push_back( std::exp(-b * D) );
+        }
+        const auto [f, pseudoD] = dict.match(sigs.data(), exp_D.data(), 0.0, 0.5);
+        CHECK(f == doctest::Approx(0.2));
+        CHECK(pseudoD == doctest::Approx(Dp));
+    }
+
+    SUBCASE("noiseless voxels are recovered"){
+        const std::vector<std::array<double, 3>> params = { {0.3, 0.001, 0.01},
+                                                            {0.1, 0.0015, 0.05},
+                                                            {0.2, 0.0008, 0.02} };
+        std::vector<float> vals;
+        for(const auto &p : params){
+            for(const auto b : b_vals){
+                vals.push_back( static_cast<float>(MRI_IVIM::evaluate_biexp(b, 1000.0, p[0], p[1], p[2])) );
+            }
+        }
+
+        // Small batches exercise the batch boundaries.
+        const auto out = MRI_IVIM::GetBiExp_Batch(b_vals, vals, num_iters, 300.0f, 2, 2);
+        REQUIRE(out.size() == params.size());
+        for(size_t v = 0UL; v < params.size(); ++v){
+            CAPTURE(v);
+            REQUIRE(out[v].at(6) == 1100.0);
+            CHECK(params[v][0] == doctest::Approx(out[v].at(0)).scale(params[v][0]).epsilon(0.10));
+            CHECK(params[v][1] == doctest::Approx(out[v].at(1)).scale(params[v][1]).epsilon(0.05));
+            CHECK(params[v][2] == doctest::Approx(out[v].at(2)).scale(params[v][2]).epsilon(0.15));
+        }
+    }
+
+    SUBCASE("noisy voxels are fitted as accurately as individual fits"){
+        const double S0 = 1.0;
+        const double f_true = 0.3;
+        const double D_true = 0.001;
+        const double Dp_true = 0.01;
+
+        const int N_voxels = 50;
+        std::vector<float> vals;
+        std::vector<std::vector<float>> voxels;
+        for(int v = 0; v < N_voxels; ++v){
+            voxels.emplace_back( generate_noisy_Ss(b_vals, S0, f_true, D_true, Dp_true, 40.0, 2000 + v) );
+            vals.insert(std::end(vals), std::begin(voxels.back()), std::end(voxels.back()));
+        }
+
+        const auto out = MRI_IVIM::GetBiExp_Batch(b_vals, vals, num_iters, 300.0f);
+        REQUIRE(out.size() == voxels.size());
+
+        double err_f_batch = 0.0;
+        double err_f_single = 0.0;
+        int valid_batch = 0;
+        for(int v = 0; v < N_voxels; ++v){
+            const auto single = MRI_IVIM::GetBiExp(b_vals, voxels[v], num_iters, 300.0f);
+            if(std::isfinite(out[v].at(0))){
+                err_f_batch += std::abs(out[v].at(0) - f_true) / f_true;
+                ++valid_batch;
+            }
+            if(std::isfinite(single.at(0))){
+                err_f_single += std::abs(single.at(0) - f_true) / f_true;
+            }
+            // Diffusion is estimated identically.
+            if(std::isfinite(out[v].at(1)) && std::isfinite(single.at(1))){
+                CHECK(out[v].at(1) == doctest::Approx(single.at(1)));
+            }
+        }
+        REQUIRE(valid_batch == N_voxels);
+        CHECK(err_f_batch <= 1.25 * err_f_single);
+    }
+
+    SUBCASE("invalid inputs"){
+        // Missing b=0.
+        const std::vector<float> b_no0 = { 10, 400, 800 };
+        const auto out = MRI_IVIM::GetBiExp_Batch(b_no0, {1.0f, 0.5f, 0.25f}, num_iters, 200.0f);
+        REQUIRE(out.size() == 1UL);
+        CHECK(out[0].at(6) == 1006.0);
+        CHECK(!std::isfinite(out[0].at(0)));
+
+        // Incomplete voxels.
+        REQUIRE_THROWS(MRI_IVIM::GetBiExp_Batch(b_vals, {1.0f, 0.5f}, num_iters, 200.0f));
+
+        // No voxels.
+        CHECK(MRI_IVIM::GetBiExp_Batch(b_vals, {}, num_iters, 200.0f).empty());
+    }
+}
+
 TEST_CASE( "MRI_IVIM::Compare GetBiExp vs SegmentedOLS accuracy" ){
     // This test compares the two methods on the same noisy data
     // to see which performs better under various conditions
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <string>    
 #include <optional>
@@ -39,6 +40,46 @@ namespace MRI_IVIM {
              float b_value_threshold = 200.0f);
     
 
+    // A table of pseudo-diffusion decay curves, exp(-b * Dp), for a fixed set of b-values and a logarithmic grid of Dp.
+    //
+    // With D held fixed, the optimal f for each tabulated Dp can be found analytically, so the whole table can be
+    // searched cheaply to find a robust starting point for bi-exponential model refinement.
+    class biexp_dictionary {
+      public:
+        biexp_dictionary(const std::vector<float> &bvalues,
+                         int64_t N_pseudoD = 64,
+                         double pseudoD_min = 3.0e-3,
+                         double pseudoD_max = 200.0e-3);
+
+        // Returns the (f, Dp) pair that best matches the normalized signal, given the pure diffusion decay
+        // exp(-b * D) at each b-value. Both arrays must be ordered like the b-values used to build the table.
+        std::array<double, 2>
+        match(const double *sigs,
+              const double *exp_D,
+              double f_min,
+              double f_max) const;
+
+        int64_t size() const;
+
+      private:
+        int64_t N_bvalues;
+        std::vector<double> pseudoDs;
+        std::vector<double> curves; // exp(-b * Dp), stored contiguously for each Dp.
+    };
+
+    // Fits the bi-exponential model to many voxels at once.
+    //
+    // Voxel intensities are stored contiguously for each voxel, in the same order as the b-values. The outputs match
+    // GetBiExp(), but each fit is initialized from a biexp_dictionary match rather than a fixed guess, and voxels are
+    // refined in batches across a thread pool.
+    std::vector<std::array<double, 7>>
+    GetBiExp_Batch(const std::vector<float> &bvalues,
+                   const std::vector<float> &vals,
+                   int numIterations = 100,
+                   float b_value_threshold = 200.0f,
+                   int64_t batch_size = 1024,
+                   int64_t concurrency = 0);
+
     std::array<double, 6>
     GetBiExp_SegmentedOLS(const std::vector<float> &bvalues,
                           const std::vector<float> &vals,
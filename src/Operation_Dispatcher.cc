@@ -3,16 +3,25 @@
 // This routine routes loaded data to/through specified operations.
 //
 
-#include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
 #include <exception>
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <set>
 #include <stdexcept>
 #include <string>    
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <Explicator.h>
 
@@ -21,6 +30,9 @@
 #include <YgorString.h>
 
 #include "Structs.h"
+#include "Regex_Selectors.h"
+#include "Imebra_Shim.h"
+#include "Operation_Profiler.h"
 
 #include "Operations/AccumulateRowsColumns.h"
 #include "Operations/AnalyzeHistograms.h"
@@ -661,6 +673,85 @@ std::map<std::string, std::string> Operation_Lexicon(){
     return op_name_lex;
 }
 
+static
+std::string
+to_lower_op_name(std::string s){
+    std::transform(std::begin(s), std::end(s), std::begin(s),
+                   [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+    return s;
+}
+
+namespace {
+struct op_registry_t {
+    std::vector<registered_op_t> ops;
+    std::unordered_map<std::string, size_t> lexicon;      // Exact names and aliases.
+    std::unordered_map<std::string, size_t> lower_names;  // Lower-cased canonical names.
+
+    // Fuzzy matching state. The Explicator is only built if an inexact name is encountered.
+    std::mutex fuzzy_m;
+    std::unique_ptr<Explicator> fuzzy_X;
+    std::unordered_map<std::string, resolved_op_t> fuzzy_memo;
+
+    op_registry_t(){
+        const auto known_ops = Known_Operations();
+        this->ops.reserve(known_ops.size());
+        for(const auto &op_func : known_ops){
+            this->ops.push_back( registered_op_t{ op_func.first, op_func.second.first(), op_func.second.second } );
+        }
+
+        // Mirror Operation_Lexicon(), where later aliases override earlier entries.
+        for(size_t i = 0; i < this->ops.size(); ++i){
+            const auto &op = this->ops[i];
+            this->lexicon[op.name] = i;
+            for(const auto &alias : op.doc.aliases){
+                this->lexicon[alias] = i;
+            }
+            this->lower_names.emplace(to_lower_op_name(op.name), i);
+        }
+    }
+};
+} // namespace
+
+static
+op_registry_t&
+get_op_registry(){
+    static op_registry_t registry;
+    return registry;
+}
+
+resolved_op_t Resolve_Operation(const std::string &user_op_name){
+    auto &reg = get_op_registry();
+
+    resolved_op_t out;
+    if(const auto it = reg.lexicon.find(user_op_name); it != std::end(reg.lexicon)){
+        out.op = &(reg.ops.at(it->second));
+        out.score = 1.0;
+        return out;
+    }
+
+    std::lock_guard<std::mutex> lock(reg.fuzzy_m);
+    if(const auto it = reg.fuzzy_memo.find(user_op_name); it != std::end(reg.fuzzy_memo)){
+        return it->second;
+    }
+    if(!reg.fuzzy_X){
+        std::map<std::string, std::string> op_name_lex;
+        for(const auto &p : reg.lexicon) op_name_lex[p.first] = reg.ops.at(p.second).name;
+        reg.fuzzy_X = std::make_unique<Explicator>(op_name_lex);
+    }
+
+    const auto canonical_op_name = (*reg.fuzzy_X)(user_op_name);
+    out.op = Lookup_Operation(canonical_op_name);
+    out.score = reg.fuzzy_X->last_best_score;
+    reg.fuzzy_memo[user_op_name] = out;
+    return out;
+}
+
+const registered_op_t* Lookup_Operation(const std::string &op_name){
+    const auto &reg = get_op_registry();
+    const auto it = reg.lower_names.find(to_lower_op_name(op_name));
+    return (it == std::end(reg.lower_names)) ? nullptr : &(reg.ops.at(it->second));
+}
+
 static
 void extract_runtime_known_ops_tags( const OperationDoc &op_docs, known_ops_tags_t &tags ){
     const auto extract = [](const OperationDoc &op_docs,
@@ -766,13 +857,189 @@ known_ops_tags_t Get_Unique_Tags(const known_ops_t &kos){
 }
 
 
+// Deferred pixel data are decoded when image arrays are selected (see Whitelist()). Operations that declare their
+// argument flows only access images through their selection parameters, but other operations might access any image
+// array directly, so all deferred pixel data are decoded before they run. Operations that only dispatch others, import
+// files, or handle metadata or parameters do not access pixel data.
+static
+bool
+operation_bypasses_image_selection(const OperationDoc &OpDocs){
+    for(const auto &tag : OpDocs.tags){
+        if( (tag == "category: control flow")
+        ||  (tag == "category: file import")
+        ||  (tag == "category: metadata")
+        ||  (tag == "category: parameter table") ) return false;
+    }
+    return std::none_of(std::begin(OpDocs.args), std::end(OpDocs.args),
+                        [](const OperationArgDoc &a){ return (a.flow != OpArgFlow::Unknown); });
+}
+
+// Mark the image arrays an operation might modify as dirty, so their pixel data are never discarded and decoded again.
+// Modifiable image arrays are identified in the same way as in detach_snapshot_objects() below.
+static
+void
+mark_modifiable_image_arrays_dirty(Drover &DICOM_data,
+                                   const OperationArgPkg &optargs,
+                                   const OperationDoc &OpDocs){
+    const auto is_control_flow = std::any_of(std::begin(OpDocs.tags), std::end(OpDocs.tags),
+                                             [](const std::string &tag){ return (tag == "category: control flow"); });
+    if(is_control_flow) return;
+
+    std::set<std::string> egress_args;
+    bool is_declared = false;
+    for(const auto &a : OpDocs.args){
+        if(a.flow != OpArgFlow::Unknown) is_declared = true;
+        if( (a.flow == OpArgFlow::Egress)
+        ||  (a.flow == OpArgFlow::IngressEgress) ){
+            egress_args.insert(a.name);
+        }
+    }
+
+    bool mark_all = !is_declared;
+    optargs.visit_opts([&](const std::string &key, const std::string &val){
+        if(mark_all || (egress_args.count(key) == 0)) return;
+
+        const auto has = [&key](const std::string &s){ return (key.find(s) != std::string::npos); };
+        if(has("ImageSelection")){
+            try{
+                for(auto &it : Whitelist(All_IAs(DICOM_data), val)) (*it)->pixels_dirty = true;
+            }catch(const std::exception &){
+                mark_all = true;
+            }
+        }else if( !has("PointSelection") && !has("MeshSelection") && !has("RTPlanSelection")
+              &&  !has("LineSelection") && !has("LineSampleSelection") && !has("TransformSelection")
+              &&  !has("WarpSelection") && !has("TableSelection") && !has("ROI") ){
+            // An egress parameter of unknown type.
+            mark_all = true;
+        }
+        return;
+    });
+
+    if(mark_all){
+        for(auto &ia_ptr : DICOM_data.image_data){
+            if(ia_ptr != nullptr) ia_ptr->pixels_dirty = true;
+        }
+    }
+    return;
+}
+
+// Optional limit on the memory used by decoded pixel data. Only pixel data that was deferred at load time can be
+// evicted. The limit is given in bytes via the 'ImagePixelMemoryBudget' invocation metadata key or the
+// 'DCMA_IMAGE_PIXEL_MEMORY_BUDGET' environment variable. The invocation metadata takes priority.
+static
+std::optional<int64_t>
+get_pixel_memory_budget(const std::map<std::string,std::string> &InvocationMetadata){
+    std::string setting;
+    if(const auto it = InvocationMetadata.find("ImagePixelMemoryBudget"); it != InvocationMetadata.end()){
+        setting = it->second;
+    }else if(const char *env = std::getenv("DCMA_IMAGE_PIXEL_MEMORY_BUDGET"); env != nullptr){
+        setting = env;
+    }
+    if(setting.empty()) return {};
+
+    try{
+        const auto n = std::stoll(setting);
+        if(0 <= n) return static_cast<int64_t>(n);
+    }catch(const std::exception &){}
+    YLOGWARN("Ignoring invalid pixel memory budget '" << setting << "'");
+    return {};
+}
+
+
+// Detach the objects an operation might modify from any Drover snapshots (e.g., from an enclosing Transaction).
+//
+// Operations might modify any object, so all protected objects are detached unless the operation explicitly declares
+// how it uses its arguments. An operation declares this by documenting the flow of its arguments; once any argument
+// has a known flow, only the objects selected by egress parameters are detached, and operations that only read (i.e.,
+// have no egress parameters) copy nothing. Contours are all held by a single object, so an egress contour parameter
+// detaches all contours. Control flow operations only dispatch other operations, which are detached individually.
+//
+// Note that detached copies are not protected, so a Drover is copied at most once per snapshot.
+template <class T>
+static
+void
+detach_selected(std::list<typename std::list<std::shared_ptr<T>>::iterator> selected){
+    for(auto &it : selected) Drover_Snapshot::Detach(*it);
+    return;
+}
+
+static
+void
+detach_snapshot_objects(Drover &DICOM_data,
+                        const OperationArgPkg &optargs,
+                        const OperationDoc &OpDocs){
+    if(!Drover_Snapshot::Active()) return;
+
+    const auto is_control_flow = std::any_of(std::begin(OpDocs.tags), std::end(OpDocs.tags),
+                                             [](const std::string &tag){ return (tag == "category: control flow"); });
+    if(is_control_flow) return;
+
+    const auto is_declared = std::any_of(std::begin(OpDocs.args), std::end(OpDocs.args),
+                                         [](const OperationArgDoc &a){ return (a.flow != OpArgFlow::Unknown); });
+    if(!is_declared){
+        Drover_Snapshot::Detach(DICOM_data);
+        return;
+    }
+
+    std::set<std::string> egress_args;
+    for(const auto &a : OpDocs.args){
+        if( (a.flow == OpArgFlow::Egress)
+        ||  (a.flow == OpArgFlow::IngressEgress) ){
+            egress_args.insert(a.name);
+        }
+    }
+    if(egress_args.empty()) return;
+
+    bool detach_all = false;
+    bool detach_contours = false;
+    optargs.visit_opts([&](const std::string &key, const std::string &val){
+        if(egress_args.count(key) == 0) return;
+
+        const auto has = [&key](const std::string &s){ return (key.find(s) != std::string::npos); };
+        try{
+            if(has("ImageSelection")){
+                detach_selected<Image_Array>(Whitelist(All_IAs(DICOM_data), val));
+            }else if(has("PointSelection")){
+                detach_selected<Point_Cloud>(Whitelist(All_PCs(DICOM_data), val));
+            }else if(has("MeshSelection")){
+                detach_selected<Surface_Mesh>(Whitelist(All_SMs(DICOM_data), val));
+            }else if(has("RTPlanSelection")){
+                detach_selected<RTPlan>(Whitelist(All_TPs(DICOM_data), val));
+            }else if(has("LineSelection") || has("LineSampleSelection")){
+                detach_selected<Line_Sample>(Whitelist(All_LSs(DICOM_data), val));
+            }else if(has("TransformSelection") || has("WarpSelection")){
+                detach_selected<Transform3>(Whitelist(All_T3s(DICOM_data), val));
+            }else if(has("TableSelection")){
+                detach_selected<Sparse_Table>(Whitelist(All_STs(DICOM_data), val));
+            }else if(has("ROI")){
+                detach_contours = true;
+            }else{
+                // An egress parameter of unknown type.
+                detach_all = true;
+            }
+        }catch(const std::exception &){
+            // Let the operation report invalid selections, but play it safe in the meantime.
+            detach_all = true;
+        }
+        return;
+    });
+
+    if(detach_all){
+        Drover_Snapshot::Detach(DICOM_data);
+        return;
+    }
+    if(detach_contours){
+        Drover_Snapshot::Detach(DICOM_data.contour_data);
+    }
+    return;
+}
+
 bool Operation_Dispatcher( Drover &DICOM_data,
                            std::map<std::string,std::string> &InvocationMetadata,
                            const std::string &FilenameLex,
                            const std::list<OperationArgPkg> &Operations ){
 
-    auto op_name_mapping = Known_Operations();
-    Explicator op_name_X( Operation_Lexicon() );
+    Operation_Profiler_Scope profiler_scope(DICOM_data, InvocationMetadata);
 
     try{
         for(const auto &OptArgs : Operations){
@@ -780,63 +1047,73 @@ bool Operation_Dispatcher( Drover &DICOM_data,
 
             // Find or estimate the canonical name. If not an exact match, issue a warning.
             const auto user_op_name = optargs.getName();
-            const auto canonical_op_name = op_name_X(user_op_name);
-            if( op_name_X.last_best_score < 1.0 ){
-                YLOGWARN("Selecting operation '" << canonical_op_name << "' because '" << user_op_name << "' not understood");
+            const auto resolved = Resolve_Operation(user_op_name);
+            if(resolved.op == nullptr){
+                throw std::invalid_argument("No operation matched '" + user_op_name + "'");
+            }
+            const auto &op = *(resolved.op);
+            if( resolved.score < 1.0 ){
+                YLOGWARN("Selecting operation '" << op.name << "' because '" << user_op_name << "' not understood");
             }
 
-            bool WasFound = false;
-            for(const auto &op_func : op_name_mapping){
-                if(boost::iequals(op_func.first, canonical_op_name)){
-                    WasFound = true;
-
-                    // Attempt to insert all expected, documented parameters with the default value.
-                    //
-                    // Note that existing keys will not be replaced.
-                    auto OpDocs = op_func.second.first();
-                    for(const auto &r : OpDocs.args){
-                        if(r.expected) optargs.insert( r.name, r.default_val );
-                    }
-
-                    // Perform macro replacement using the parameter table.
-
-                    // First, try replace required-replacement macros like '$$xyz'.
-                    // If these cannot be replaced, do not proceed.
-                    optargs.visit_opts([&InvocationMetadata](const std::string &key, std::string &val){
-                        const std::string required_macro_symbol = "$$";
-                        val = ExpandMacros(val, InvocationMetadata, required_macro_symbol);
-
-                        const auto pos = val.find(required_macro_symbol);
-                        if(pos != std::string::npos){
-                            throw std::runtime_error("Unable to replace required macro for key '$$" + key + "'");
-                        }
-                        return;
-                    });
-
-                    // Second, replace '$' macros, which might need to be passed through to the operation
-                    // to be properly expanded.
-                    optargs.visit_opts([&InvocationMetadata](const std::string &/*key*/, std::string &val){
-                        val = ExpandMacros(val, InvocationMetadata, "$");
-                        return;
-                    });
-
-
-                    YLOGINFO("Performing operation '" << op_func.first << "' now..");
-                    optargs.visit_opts([](const std::string &key, const std::string &val){
-                        YLOGDEBUG("  Parameter '" << key << "' = '" << val << "'");
-                        return;
-                    });
-
-                    const bool res = op_func.second.second(DICOM_data,
-                                                           optargs,
-                                                           InvocationMetadata,
-                                                           FilenameLex);
-                    if(!res) throw std::runtime_error("Truthiness is false");
-
-                    break;
+            // Attempt to insert all expected, documented parameters with the default value.
+            //
+            // Note that existing keys will not be replaced.
+            const auto &OpDocs = op.doc;
+            for(const auto &r : OpDocs.args){
+                if(r.expected) optargs.insert( r.name, r.default_val );
+            }
+
+            // Perform macro replacement using the parameter table.
+
+            // First, try replace required-replacement macros like '$$xyz'.
+            // If these cannot be replaced, do not proceed.
+            optargs.visit_opts([&InvocationMetadata](const std::string &key, std::string &val){
+                const std::string required_macro_symbol = "$$";
+                val = ExpandMacros(val, InvocationMetadata, required_macro_symbol);
+
+                const auto pos = val.find(required_macro_symbol);
+                if(pos != std::string::npos){
+                    throw std::runtime_error("Unable to replace required macro for key '$$" + key + "'");
                 }
+                return;
+            });
+
+            // Second, replace '$' macros, which might need to be passed through to the operation
+            // to be properly expanded.
+            optargs.visit_opts([&InvocationMetadata](const std::string &/*key*/, std::string &val){
+                val = ExpandMacros(val, InvocationMetadata, "$");
+                return;
+            });
+
+
+            YLOGINFO("Performing operation '" << op.name << "' now..");
+            optargs.visit_opts([](const std::string &key, const std::string &val){
+                YLOGDEBUG("  Parameter '" << key << "' = '" << val << "'");
+                return;
+            });
+
+            // Ensure snapshots are not modified.
+            detach_snapshot_objects(DICOM_data, optargs, OpDocs);
+
+            // Decode deferred pixel data the operation might access without selecting, and prevent modified pixel data
+            // from being discarded.
+            if(operation_bypasses_image_selection(OpDocs)){
+                Decode_Deferred_Pixels(DICOM_data.image_data);
+            }
+            mark_modifiable_image_arrays_dirty(DICOM_data, optargs, OpDocs);
+
+            Operation_Profiler_Probe profiler_probe(DICOM_data, op.name);
+            const bool res = op.func(DICOM_data,
+                                     optargs,
+                                     InvocationMetadata,
+                                     FilenameLex);
+            if(!res) throw std::runtime_error("Truthiness is false");
+            profiler_probe.mark_succeeded();
+
+            if(const auto budget = get_pixel_memory_budget(InvocationMetadata)){
+                Evict_Image_Pixels(DICOM_data.image_data, budget.value());
             }
-            if(!WasFound) throw std::invalid_argument("No operation matched '" + optargs.getName() + "'");
         }
     }catch(const std::exception &e){
         YLOGWARN("Analysis failed: '" << e.what() << "'. Aborting remaining analyses");
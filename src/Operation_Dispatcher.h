@@ -32,6 +32,29 @@ known_ops_t Only_Operations(const known_ops_t &, known_ops_tags_t tags);
 known_ops_tags_t Get_Unique_Tags(const known_ops_t &);
 
 
+// Process-wide, immutable registry of the known operations.
+//
+// The registry is built from Known_Operations() on first use and then shared by all threads. Each operation's
+// documentation is generated once and cached, and names are resolved via hashing rather than repeated linear scans.
+struct registered_op_t {
+    std::string name;  // The canonical operation name.
+    OperationDoc doc;  // The canonical operation's documentation.
+    op_func_t func;
+};
+
+struct resolved_op_t {
+    const registered_op_t *op = nullptr; // Never nullptr unless no operations are registered.
+    double score = 0.0;                  // The fuzzy-matching score. 1.0 denotes an exact name or alias match.
+};
+
+// Resolve a user-provided operation name, alias, or approximate name to a registered operation. Fuzzy matching is only
+// performed for inexact names, and the result is memoized.
+resolved_op_t Resolve_Operation(const std::string &user_op_name);
+
+// Find a registered operation by canonical name (case-insensitive). Returns nullptr if not found.
+const registered_op_t* Lookup_Operation(const std::string &op_name);
+
+
 bool Operation_Dispatcher( Drover &DICOM_data,
                            std::map<std::string,std::string> &InvocationMetadata,
                            const std::string &FilenameLex,
@@ -0,0 +1,364 @@
+//Operation_Profiler.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file provides automatic per-operation profiling for the operation dispatcher.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/resource.h>
+#endif
+
+#include "YgorMisc.h"
+#include "YgorLog.h"
+#include "YgorFilesDirs.h"    //Needed for Get_Unique_Sequential_Filename().
+
+#include "Structs.h"
+#include "Metadata.h"
+#include "Tables.h"
+#include "Operation_Profiler.h"
+
+
+namespace {
+struct profile_session_t {
+    std::atomic<bool> active{false};
+
+    std::mutex m;
+    std::chrono::steady_clock::time_point epoch;
+    std::vector<op_profile_sample_t> samples;
+    std::map<std::thread::id, int64_t> threads;
+};
+} // namespace
+
+static
+profile_session_t&
+get_profile_session(){
+    static profile_session_t session;
+    return session;
+}
+
+// Nesting depth of operations on the current thread.
+static thread_local int64_t profile_depth = 0;
+
+
+static
+bool
+profiling_requested(const std::map<std::string, std::string> &InvocationMetadata){
+    std::string setting;
+    if(const auto it = InvocationMetadata.find("ProfileOperations"); it != InvocationMetadata.end()){
+        setting = it->second;
+    }else if(const char *env = std::getenv("DCMA_PROFILE_OPERATIONS"); env != nullptr){
+        setting = env;
+    }
+    return (setting == "true") || (setting == "1");
+}
+
+static
+double
+process_cpu_time_us(){
+    return 1.0E6 * static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+}
+
+static
+int64_t
+process_peak_rss_kb(){
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0){
+    #if defined(__APPLE__)
+        return static_cast<int64_t>(usage.ru_maxrss) / 1024; // Reported in bytes.
+    #else
+        return static_cast<int64_t>(usage.ru_maxrss); // Reported in kilobytes.
+    #endif
+    }
+#endif
+    return 0;
+}
+
+std::map<std::string, int64_t> Count_Drover_Objects(const Drover &DICOM_data){
+    std::map<std::string, int64_t> out;
+
+    out["contour_collections"] = (DICOM_data.contour_data == nullptr)
+                               ? 0 : static_cast<int64_t>(DICOM_data.contour_data->ccs.size());
+
+    int64_t images = 0;
+    for(const auto &ia : DICOM_data.image_data){
+        if(ia != nullptr) images += static_cast<int64_t>(ia->imagecoll.images.size());
+    }
+    out["image_arrays"] = static_cast<int64_t>(DICOM_data.image_data.size());
+    out["images"] = images;
+
+    out["point_clouds"] = static_cast<int64_t>(DICOM_data.point_data.size());
+    out["surface_meshes"] = static_cast<int64_t>(DICOM_data.smesh_data.size());
+    out["rtplans"] = static_cast<int64_t>(DICOM_data.rtplan_data.size());
+    out["line_samples"] = static_cast<int64_t>(DICOM_data.lsamp_data.size());
+    out["transforms"] = static_cast<int64_t>(DICOM_data.trans_data.size());
+    out["tables"] = static_cast<int64_t>(DICOM_data.table_data.size());
+    return out;
+}
+
+
+static
+std::string
+json_escape(const std::string &s){
+    std::stringstream ss;
+    for(const auto c : s){
+        if(false){
+        }else if(c == '"'){
+            ss << "\\\"";
+        }else if(c == '\\'){
+            ss << "\\\\";
+        }else if(static_cast<unsigned char>(c) < 0x20){
+            ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        }else{
+            ss << c;
+        }
+    }
+    return ss.str();
+}
+
+// Emit samples using the Chrome trace event format, which is understood by Perfetto and chrome://tracing.
+static
+void
+write_chrome_trace(const std::vector<op_profile_sample_t> &samples, std::ostream &os){
+    const auto emit_counts = [&os](const std::map<std::string, int64_t> &counts){
+        os << "{";
+        bool first = true;
+        for(const auto &p : counts){
+            os << (first ? "" : ",") << "\"" << json_escape(p.first) << "\":" << p.second;
+            first = false;
+        }
+        os << "}";
+    };
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for(const auto &s : samples){
+        os << (first ? "" : ",\n");
+        first = false;
+        os << std::fixed << std::setprecision(3)
+           << "{\"name\":\"" << json_escape(s.name) << "\""
+           << ",\"cat\":\"operation\""
+           << ",\"ph\":\"X\""
+           << ",\"pid\":1"
+           << ",\"tid\":" << s.thread
+           << ",\"ts\":" << s.start_us
+           << ",\"dur\":" << s.wall_us
+           << ",\"args\":{"
+           << "\"depth\":" << s.depth
+           << ",\"cpu_us\":" << s.cpu_us
+           << ",\"peak_rss_delta_kb\":" << s.peak_rss_delta_kb
+           << ",\"succeeded\":" << (s.succeeded ? "true" : "false")
+           << ",\"objects_before\":";
+        emit_counts(s.objects_before);
+        os << ",\"objects_after\":";
+        emit_counts(s.objects_after);
+        os << "}}";
+    }
+    os << "\n]}\n";
+    return;
+}
+
+// Summarize samples by operation name, ordered by decreasing total wall time.
+static
+std::shared_ptr<Sparse_Table>
+summarize_samples(const std::vector<op_profile_sample_t> &samples){
+    struct summary_t {
+        int64_t calls = 0;
+        int64_t failures = 0;
+        double wall_us = 0.0;
+        double cpu_us = 0.0;
+        int64_t peak_rss_delta_kb = 0;
+        std::map<std::string, int64_t> object_deltas;
+    };
+    std::map<std::string, summary_t> summaries;
+    std::set<std::string> object_types;
+    for(const auto &s : samples){
+        auto &summary = summaries[s.name];
+        summary.calls += 1;
+        summary.failures += (s.succeeded ? 0 : 1);
+        summary.wall_us += s.wall_us;
+        summary.cpu_us += s.cpu_us;
+        summary.peak_rss_delta_kb = std::max(summary.peak_rss_delta_kb, s.peak_rss_delta_kb);
+        for(const auto &p : s.objects_after){
+            const auto it = s.objects_before.find(p.first);
+            const auto before = (it == s.objects_before.end()) ? 0 : it->second;
+            summary.object_deltas[p.first] += (p.second - before);
+            object_types.insert(p.first);
+        }
+    }
+
+    std::vector<std::pair<std::string, summary_t>> ordered(summaries.begin(), summaries.end());
+    std::stable_sort(ordered.begin(), ordered.end(), [](const auto &l, const auto &r){
+        return (r.second.wall_us < l.second.wall_us);
+    });
+
+    auto st = std::make_shared<Sparse_Table>();
+    const auto to_str = [](double x){
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(6) << x;
+        return ss.str();
+    };
+
+    int64_t row = 0;
+    int64_t col = 0;
+    for(const auto &h : { "Operation", "Calls", "Failures", "Total wall time (s)", "Mean wall time (s)",
+                          "Total CPU time (s)", "Max peak RSS growth (kB)" }){
+        st->table.inject(row, col++, h);
+    }
+    for(const auto &t : object_types){
+        st->table.inject(row, col++, "Net change: " + t);
+    }
+
+    for(const auto &[name, summary] : ordered){
+        ++row;
+        col = 0;
+        st->table.inject(row, col++, name);
+        st->table.inject(row, col++, std::to_string(summary.calls));
+        st->table.inject(row, col++, std::to_string(summary.failures));
+        st->table.inject(row, col++, to_str(summary.wall_us * 1.0E-6));
+        st->table.inject(row, col++, to_str(summary.wall_us * 1.0E-6 / static_cast<double>(summary.calls)));
+        st->table.inject(row, col++, to_str(summary.cpu_us * 1.0E-6));
+        st->table.inject(row, col++, std::to_string(summary.peak_rss_delta_kb));
+        for(const auto &t : object_types){
+            const auto it = summary.object_deltas.find(t);
+            st->table.inject(row, col++, std::to_string((it == summary.object_deltas.end()) ? 0 : it->second));
+        }
+    }
+
+    st->table.metadata = coalesce_metadata_for_basic_table({}, meta_evolve::iterate);
+    st->table.metadata["TableLabel"] = "Operation profile";
+    st->table.metadata["NormalizedTableLabel"] = "operation_profile";
+    st->table.metadata["Description"] = "Per-operation profile. Times are inclusive of child operations.";
+    return st;
+}
+
+
+Operation_Profiler_Scope::Operation_Profiler_Scope(Drover &l_DICOM_data,
+                                                   const std::map<std::string, std::string> &InvocationMetadata){
+    auto &session = get_profile_session();
+    if( session.active.load()
+    ||  !profiling_requested(InvocationMetadata) ){
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(session.m);
+    if(session.active.load()) return;
+
+    this->DICOM_data = &l_DICOM_data;
+    this->owner = true;
+    if(const auto it = InvocationMetadata.find("ProfileTraceFile"); it != InvocationMetadata.end()){
+        this->trace_file = it->second;
+    }
+
+    session.epoch = std::chrono::steady_clock::now();
+    session.samples.clear();
+    session.threads.clear();
+    session.active.store(true);
+    YLOGINFO("Operation profiling enabled");
+}
+
+Operation_Profiler_Scope::~Operation_Profiler_Scope(){
+    if(!this->owner) return;
+
+    auto &session = get_profile_session();
+    std::vector<op_profile_sample_t> samples;
+    {
+        std::lock_guard<std::mutex> lock(session.m);
+        session.active.store(false);
+        samples.swap(session.samples);
+        session.threads.clear();
+    }
+
+    try{
+        // Samples are recorded when operations complete, so order them by start time for readability.
+        std::stable_sort(samples.begin(), samples.end(), [](const auto &l, const auto &r){
+            return (l.start_us < r.start_us);
+        });
+
+        if(this->trace_file.empty()){
+            const auto base = (std::filesystem::temp_directory_path() / "dcma_operation_profile_").string();
+            this->trace_file = Get_Unique_Sequential_Filename(base, 6, ".json");
+        }
+        std::ofstream ofs(this->trace_file, std::ios::out | std::ios::trunc);
+        write_chrome_trace(samples, ofs);
+        ofs.flush();
+        if(!ofs){
+            YLOGWARN("Unable to write operation profile trace to '" << this->trace_file << "'");
+        }else{
+            YLOGINFO("Wrote operation profile trace to '" << this->trace_file << "'");
+        }
+
+        this->DICOM_data->table_data.emplace_back( summarize_samples(samples) );
+    }catch(const std::exception &e){
+        YLOGWARN("Unable to emit operation profile: '" << e.what() << "'");
+    }
+}
+
+
+Operation_Profiler_Probe::Operation_Profiler_Probe(const Drover &l_DICOM_data, const std::string &op_name){
+    auto &session = get_profile_session();
+    if(!session.active.load()) return;
+
+    this->DICOM_data = &l_DICOM_data;
+    this->sample.name = op_name;
+    this->sample.depth = profile_depth++;
+    this->sample.objects_before = Count_Drover_Objects(l_DICOM_data);
+    {
+        std::lock_guard<std::mutex> lock(session.m);
+        const auto id = std::this_thread::get_id();
+        auto it = session.threads.find(id);
+        if(it == session.threads.end()){
+            it = session.threads.emplace(id, static_cast<int64_t>(session.threads.size())).first;
+        }
+        this->sample.thread = it->second;
+        this->sample.start_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                          - session.epoch).count();
+    }
+    this->start_cpu_us = process_cpu_time_us();
+    this->start_peak_rss_kb = process_peak_rss_kb();
+}
+
+Operation_Profiler_Probe::~Operation_Profiler_Probe(){
+    if(this->DICOM_data == nullptr) return;
+    --profile_depth;
+
+    const auto stop_cpu_us = process_cpu_time_us();
+    const auto stop_peak_rss_kb = process_peak_rss_kb();
+    auto &session = get_profile_session();
+    try{
+        this->sample.cpu_us = stop_cpu_us - this->start_cpu_us;
+        this->sample.peak_rss_delta_kb = stop_peak_rss_kb - this->start_peak_rss_kb;
+        this->sample.objects_after = Count_Drover_Objects(*(this->DICOM_data));
+
+        std::lock_guard<std::mutex> lock(session.m);
+        if(!session.active.load()) return; // The session ended while this operation was running.
+        this->sample.wall_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                         - session.epoch).count()
+                             - this->sample.start_us;
+        session.samples.emplace_back(std::move(this->sample));
+    }catch(const std::exception &){}
+}
+
+void Operation_Profiler_Probe::mark_succeeded(){
+    this->sample.succeeded = true;
+}
+
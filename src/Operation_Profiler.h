@@ -0,0 +1,77 @@
+//Operation_Profiler.h.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "Structs.h"
+
+
+// Automatic, per-operation profiling for Operation_Dispatcher.
+//
+// Profiling is enabled by setting the 'ProfileOperations' invocation metadata key (or, if absent, the
+// 'DCMA_PROFILE_OPERATIONS' environment variable) to 'true'. Every operation performed by the dispatcher is then
+// measured, including the children of control flow meta-operations. When the outermost dispatcher invocation
+// completes, a Chrome trace (viewable with Perfetto or chrome://tracing) is written to the file named by the
+// 'ProfileTraceFile' invocation metadata key (or a unique file in the temporary directory) and a summary table is
+// added to the Drover.
+//
+// Note that measurements are inclusive of child operations, and CPU time and peak memory are process-wide, so they
+// include concurrently-running operations.
+
+struct op_profile_sample_t {
+    std::string name;
+    int64_t depth = 0;             // Nesting depth. Top-level operations have depth 0.
+    int64_t thread = 0;            // Sequential identifier of the thread that performed the operation.
+    double start_us = 0.0;         // Start time, relative to the start of profiling.
+    double wall_us = 0.0;          // Elapsed wall time.
+    double cpu_us = 0.0;           // Elapsed process CPU time.
+    int64_t peak_rss_delta_kb = 0; // Growth of the process' peak resident set size.
+    bool succeeded = false;
+
+    std::map<std::string, int64_t> objects_before;
+    std::map<std::string, int64_t> objects_after;
+};
+
+// Count the objects of each type held by a Drover.
+std::map<std::string, int64_t> Count_Drover_Objects(const Drover &DICOM_data);
+
+
+// Bookkeeping for a single Operation_Dispatcher invocation. Profiling state is process-wide; the outermost
+// invocation that finds profiling requested owns the session and emits the results when it is destroyed.
+class Operation_Profiler_Scope {
+  private:
+    Drover *DICOM_data = nullptr;
+    bool owner = false;
+    std::string trace_file;
+
+  public:
+    Operation_Profiler_Scope(Drover &DICOM_data,
+                             const std::map<std::string, std::string> &InvocationMetadata);
+    ~Operation_Profiler_Scope();
+
+    Operation_Profiler_Scope(const Operation_Profiler_Scope &) = delete;
+    Operation_Profiler_Scope& operator=(const Operation_Profiler_Scope &) = delete;
+};
+
+// Measures a single operation. The sample is recorded when the probe is destroyed, so operations that throw are
+// recorded as having failed. Probes are inert when profiling is not active.
+class Operation_Profiler_Probe {
+  private:
+    const Drover *DICOM_data = nullptr;
+    op_profile_sample_t sample;
+    double start_cpu_us = 0.0;
+    int64_t start_peak_rss_kb = 0;
+
+  public:
+    Operation_Profiler_Probe(const Drover &DICOM_data, const std::string &op_name);
+    ~Operation_Profiler_Probe();
+
+    void mark_succeeded();
+
+    Operation_Profiler_Probe(const Operation_Profiler_Probe &) = delete;
+    Operation_Profiler_Probe& operator=(const Operation_Profiler_Probe &) = delete;
+};
+
@@ -0,0 +1,240 @@
+//Operation_Profiler_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the operation profiler defined in Operation_Profiler.cc.
+// Tests are separated into their own file because Operation_Profiler_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "Structs.h"
+#include "Tables.h"
+#include "Operation_Profiler.h"
+
+
+namespace {
+
+struct temp_trace_file {
+    std::filesystem::path path;
+    temp_trace_file(){
+        std::random_device rd;
+        this->path = std::filesystem::temp_directory_path()
+                   / ("dcma_operation_profiler_test_" + std::to_string(rd()) + "_" + std::to_string(rd()) + ".json");
+    }
+    ~temp_trace_file(){
+        std::error_code ec;
+        std::filesystem::remove(this->path, ec);
+    }
+};
+
+// A single event parsed from the emitted Chrome trace.
+struct trace_event_t {
+    std::string name;
+    double ts = 0.0;
+    double dur = 0.0;
+    int64_t depth = 0;
+    bool succeeded = false;
+};
+
+} // namespace
+
+static
+std::map<std::string, std::string>
+make_profiling_metadata(const std::filesystem::path &trace_file){
+    return { { "ProfileOperations", "true" },
+             { "ProfileTraceFile", trace_file.string() } };
+}
+
+static
+std::string
+read_file(const std::filesystem::path &p){
+    std::ifstream ifs(p, std::ios::in | std::ios::binary);
+    return std::string( (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>() );
+}
+
+// The trace is written one event per line, so events can be extracted without a JSON parser.
+static
+std::vector<trace_event_t>
+parse_trace_events(const std::string &trace){
+    const std::regex event_regex(R"***(\{"name":"([^"]*)".*"ts":([0-9.]+),"dur":([0-9.]+),"args":\{"depth":([0-9]+).*"succeeded":(true|false))***");
+    std::vector<trace_event_t> out;
+    for(auto it = std::sregex_iterator(trace.begin(), trace.end(), event_regex); it != std::sregex_iterator(); ++it){
+        const auto &m = *it;
+        trace_event_t e;
+        e.name = m[1].str();
+        e.ts = std::stod(m[2].str());
+        e.dur = std::stod(m[3].str());
+        e.depth = std::stol(m[4].str());
+        e.succeeded = (m[5].str() == "true");
+        out.push_back(e);
+    }
+    return out;
+}
+
+static
+std::optional<int64_t>
+find_column(const tables::table2 &t, const std::string &header){
+    const auto [min_col, max_col] = t.min_max_col();
+    for(int64_t c = min_col; c <= max_col; ++c){
+        if(t.value(0, c) == header) return c;
+    }
+    return {};
+}
+
+static
+std::optional<int64_t>
+find_row(const tables::table2 &t, const std::string &op_name){
+    const auto [min_row, max_row] = t.min_max_row();
+    for(int64_t r = min_row + 1; r <= max_row; ++r){
+        if(t.value(r, 0) == op_name) return r;
+    }
+    return {};
+}
+
+
+TEST_CASE("Count_Drover_Objects"){
+    Drover d;
+    d.image_data.emplace_back( std::make_shared<Image_Array>() );
+    d.image_data.back()->imagecoll.images.emplace_back();
+    d.image_data.back()->imagecoll.images.emplace_back();
+    d.image_data.emplace_back( std::make_shared<Image_Array>() );
+    d.table_data.emplace_back( std::make_shared<Sparse_Table>() );
+
+    const auto counts = Count_Drover_Objects(d);
+    REQUIRE(counts.at("image_arrays") == 2);
+    REQUIRE(counts.at("images") == 2);
+    REQUIRE(counts.at("tables") == 1);
+    REQUIRE(counts.at("point_clouds") == 0);
+    REQUIRE(counts.at("contour_collections") == 0);
+}
+
+TEST_CASE("Operation_Profiler is inert unless requested"){
+    Drover d;
+    {
+        Operation_Profiler_Scope scope(d, { { "ProfileOperations", "false" } });
+        Operation_Profiler_Probe probe(d, "NoOp");
+        probe.mark_succeeded();
+    }
+    REQUIRE(d.table_data.empty());
+}
+
+TEST_CASE("Operation_Profiler times nested operations"){
+    temp_trace_file tf;
+    Drover d;
+    {
+        Operation_Profiler_Scope scope(d, make_profiling_metadata(tf.path));
+        {
+            Operation_Profiler_Probe outer(d, "Outer");
+            {
+                // Nested dispatcher invocations do not start a new session.
+                Operation_Profiler_Scope inner_scope(d, make_profiling_metadata(tf.path));
+                Operation_Profiler_Probe inner(d, "Inner");
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                inner.mark_succeeded();
+            }
+            outer.mark_succeeded();
+        }
+    }
+
+    const auto events = parse_trace_events(read_file(tf.path));
+    REQUIRE(events.size() == 2);
+
+    // Events are ordered by start time, so the enclosing operation is first.
+    const auto &outer = events.at(0);
+    const auto &inner = events.at(1);
+    REQUIRE(outer.name == "Outer");
+    REQUIRE(inner.name == "Inner");
+    REQUIRE(outer.depth == 0);
+    REQUIRE(inner.depth == 1);
+    REQUIRE(outer.succeeded);
+    REQUIRE(inner.succeeded);
+
+    REQUIRE(15'000.0 <= inner.dur);
+    REQUIRE(outer.ts <= inner.ts);
+    REQUIRE((inner.ts + inner.dur) <= (outer.ts + outer.dur) + 1.0); // Allow for rounding in the trace.
+
+    // Only the outermost scope emits a summary.
+    REQUIRE(d.table_data.size() == 1);
+}
+
+TEST_CASE("Operation_Profiler aggregates calls, failures, and object counts"){
+    temp_trace_file tf;
+    Drover d;
+    {
+        Operation_Profiler_Scope scope(d, make_profiling_metadata(tf.path));
+        {
+            Operation_Profiler_Probe probe(d, "AddImages");
+            d.image_data.emplace_back( std::make_shared<Image_Array>() );
+            probe.mark_succeeded();
+        }
+        {
+            Operation_Profiler_Probe probe(d, "AddImages");
+            d.image_data.emplace_back( std::make_shared<Image_Array>() );
+            // Not marked as succeeded, as if the operation had thrown.
+        }
+        {
+            Operation_Profiler_Probe probe(d, "NoOp");
+            probe.mark_succeeded();
+        }
+    }
+
+    const auto events = parse_trace_events(read_file(tf.path));
+    REQUIRE(events.size() == 3);
+
+    REQUIRE(d.table_data.size() == 1);
+    const auto &t = d.table_data.back()->table;
+    REQUIRE(t.metadata.at("TableLabel") == "Operation profile");
+
+    const auto c_calls = find_column(t, "Calls");
+    const auto c_failures = find_column(t, "Failures");
+    const auto c_arrays = find_column(t, "Net change: image_arrays");
+    const auto c_tables = find_column(t, "Net change: tables");
+    REQUIRE(c_calls);
+    REQUIRE(c_failures);
+    REQUIRE(c_arrays);
+    REQUIRE(c_tables);
+
+    const auto r_add = find_row(t, "AddImages");
+    const auto r_noop = find_row(t, "NoOp");
+    REQUIRE(r_add);
+    REQUIRE(r_noop);
+
+    REQUIRE(t.value(r_add.value(), c_calls.value()) == "2");
+    REQUIRE(t.value(r_add.value(), c_failures.value()) == "1");
+    REQUIRE(t.value(r_add.value(), c_arrays.value()) == "2");
+    REQUIRE(t.value(r_noop.value(), c_calls.value()) == "1");
+    REQUIRE(t.value(r_noop.value(), c_failures.value()) == "0");
+    REQUIRE(t.value(r_noop.value(), c_arrays.value()) == "0");
+    REQUIRE(t.value(r_noop.value(), c_tables.value()) == "0");
+}
+
+TEST_CASE("Operation_Profiler writes a Chrome trace"){
+    temp_trace_file tf;
+    Drover d;
+    {
+        Operation_Profiler_Scope scope(d, make_profiling_metadata(tf.path));
+        Operation_Profiler_Probe probe(d, "Quote\"Name");
+        probe.mark_succeeded();
+    }
+
+    const auto trace = read_file(tf.path);
+    REQUIRE(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+    REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Quote\\\"Name\"") != std::string::npos);
+    REQUIRE(trace.find("\"objects_before\":{") != std::string::npos);
+    REQUIRE(trace.find("\"objects_after\":{") != std::string::npos);
+    REQUIRE(trace.find("\n]}\n") != std::string::npos);
+}
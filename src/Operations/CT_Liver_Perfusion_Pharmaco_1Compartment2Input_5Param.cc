@@ -701,7 +701,8 @@ bool CT_Liver_Perfusion_Pharmaco_1C2I_5Param(Drover &DICOM_data,
             DICOM_data.image_data.emplace_back( std::make_shared<Image_Array>( ) );
             pharmaco_model_k2.emplace_back( DICOM_data.image_data.back() );
 
-            if(!pharmaco_model_dummy.back()->imagecoll.Process_Images_Parallel( 
+            //Slices are processed serially; the voxel fits within each slice are distributed across all cores.
+            if(!pharmaco_model_dummy.back()->imagecoll.Process_Images( 
                               GroupSpatiallyOverlappingImages,
                               KineticModel_Liver_1C2I_5Param_Chebyshev_LevenbergMarquardt,
                               { std::ref(pharmaco_model_kA.back()->imagecoll),
@@ -810,7 +811,8 @@ bool CT_Liver_Perfusion_Pharmaco_1C2I_5Param(Drover &DICOM_data,
             DICOM_data.image_data.emplace_back( std::make_shared<Image_Array>( ) );
             pharmaco_model_k2.emplace_back( DICOM_data.image_data.back() );
 
-            if(!pharmaco_model_dummy.back()->imagecoll.Process_Images_Parallel( 
+            //Slices are processed serially; the voxel fits within each slice are distributed across all cores.
+            if(!pharmaco_model_dummy.back()->imagecoll.Process_Images( 
                               GroupSpatiallyOverlappingImages,
                               KineticModel_Liver_1C2I_5Param_LinearInterp,
                               { std::ref(pharmaco_model_kA.back()->imagecoll),
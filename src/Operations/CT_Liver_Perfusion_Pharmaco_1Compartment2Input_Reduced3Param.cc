@@ -685,7 +685,8 @@ bool CT_Liver_Perfusion_Pharmaco_1C2I_Reduced3Param(Drover &DICOM_data,
         DICOM_data.image_data.emplace_back( std::make_shared<Image_Array>( ) );
         pharmaco_model_k2.emplace_back( DICOM_data.image_data.back() );
 
-        if(!pharmaco_model_dummy.back()->imagecoll.Process_Images_Parallel( 
+        //Slices are processed serially; the voxel fits within each slice are distributed across all cores.
+        if(!pharmaco_model_dummy.back()->imagecoll.Process_Images( 
                           GroupSpatiallyOverlappingImages,
                           KineticModel_Liver_1C2I_Reduced3Param_Chebyshev_FreeformOptimization,
                           { std::ref(pharmaco_model_kA.back()->imagecoll),
@@ -168,6 +168,18 @@ OperationDoc OpArgDocContourViaThreshold(){
     out.args.back().examples = { "true", "false" };
     
 
+    out.args.emplace_back();
+    out.args.back().name = "NarrowBand";
+    out.args.back().desc = "Only applies to the marching cubes method."
+                           " Controls whether Marching Cubes only visits voxels near the boundary of the thresholded"
+                           " region, so the cost scales with the contour perimeter rather than the image size."
+                           " When enabled, regions touching the edge of the image are closed along the edge.";
+    out.args.back().default_val = "true";
+    out.args.back().expected = true;
+    out.args.back().examples = { "true", "false" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
+
     return out;
 }
 
@@ -186,6 +198,7 @@ bool ContourViaThreshold(Drover &DICOM_data,
     const auto ImageSelectionStr = OptArgs.getValueStr("ImageSelection").value();
     const auto MethodStr = OptArgs.getValueStr("Method").value();
     const auto SimplifyMergeAdjacentStr = OptArgs.getValueStr("SimplifyMergeAdjacent").value();
+    const auto NarrowBandStr = OptArgs.getValueStr("NarrowBand").value();
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto Lower = std::stod( LowerStr );
@@ -207,6 +220,7 @@ bool ContourViaThreshold(Drover &DICOM_data,
     const auto TrueRegex = Compile_Regex("^tr?u?e?$");
 
     const auto SimplifyMergeAdjacent = std::regex_match(SimplifyMergeAdjacentStr, TrueRegex);
+    const auto NarrowBand = std::regex_match(NarrowBandStr, TrueRegex);
 
     const auto NormalizedROILabel = X(ROILabel);
 
@@ -931,6 +945,7 @@ bool ContourViaThreshold(Drover &DICOM_data,
                     auto meshing_params = dcma_surface_meshes::Parameters();
                     meshing_params.MutateOpts.inclusivity = Mutate_Voxels_Opts::Inclusivity::Centre;
                     meshing_params.MutateOpts.contouroverlap = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+                    meshing_params.NarrowBand = NarrowBand;
                     YLOGWARN("Ignoring contour orientations; assuming ROI polyhderon is simple");
                     auto surface_mesh = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes( 
                                                                     grid_imgs,
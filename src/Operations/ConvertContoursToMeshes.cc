@@ -167,6 +167,18 @@ OperationDoc OpArgDocConvertContoursToMeshes(){
                                  "contours" };
     out.args.back().samples = OpArgSamples::Exhaustive;
 
+
+    out.args.emplace_back();
+    out.args.back().name = "NarrowBand";
+    out.args.back().desc = "Only applies to the 'marching' method."
+                           " Controls whether Marching Cubes only visits voxels near the rasterized contours."
+                           " The resulting mesh is the same either way, but enabling this option makes meshing"
+                           " time and memory scale with the surface area of the ROI rather than its bounding volume.";
+    out.args.back().default_val = "true";
+    out.args.back().expected = true;
+    out.args.back().examples = { "true", "false" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -185,6 +197,7 @@ bool ConvertContoursToMeshes(Drover &DICOM_data,
     const auto ROISelection = OptArgs.getValueStr("ROISelection").value();
     const auto MeshLabel = OptArgs.getValueStr("MeshLabel").value();
     const auto MethodStr = OptArgs.getValueStr("Method").value();
+    const auto NarrowBandStr = OptArgs.getValueStr("NarrowBand").value();
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto NormalizedMeshLabel = X(MeshLabel);
@@ -196,6 +209,9 @@ bool ConvertContoursToMeshes(Drover &DICOM_data,
     const auto ygor_dnc_convex_regex = Compile_Regex("^yg?o?r?[-_]?di?v?i?d?e?[-_]?a?n?d?[-_]?c?o?n?q?u?e?r?[-_]?conve?x?[-_]?h?u?l?l?$");
     const auto contours_regex = Compile_Regex("^conto?u?r?s?$");
 
+    const auto regex_true = Compile_Regex("^tr?u?e?$");
+    const auto NarrowBand = std::regex_match(NarrowBandStr, regex_true);
+
     auto cc_all = All_CCs( DICOM_data );
     auto cc_ROIs = Whitelist( cc_all, ROILabelRegex, NormalizedROILabelRegex, ROISelection );
     if(cc_ROIs.empty()){
@@ -576,6 +592,7 @@ bool ConvertContoursToMeshes(Drover &DICOM_data,
 
     }else if(std::regex_match(MethodStr, marching_regex)){
         auto meshing_params = dcma_surface_meshes::Parameters();
+        meshing_params.NarrowBand = NarrowBand;
         amesh = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes( cc_ref, meshing_params );
 
     }else if(std::regex_match(MethodStr, convex_regex)){
@@ -131,6 +131,19 @@ OperationDoc OpArgDocConvertImageToMeshes(){
     out.args.back().expected = true;
     out.args.back().examples = { "unspecified", "body", "air", "bone", "invalid", "above_zero", "below_5.3" };
 
+
+    out.args.emplace_back();
+    out.args.back().name = "NarrowBand";
+    out.args.back().desc = "Controls whether Marching Cubes is restricted to a narrow band around the surface."
+                           " Meshing time and memory then scale with the surface area rather than the image volume."
+                           " The surface is otherwise unchanged, except that surfaces touching the edge of the images"
+                           " are closed rather than left open."
+                           " This option does not apply to the geometrical method.";
+    out.args.back().default_val = "true";
+    out.args.back().expected = true;
+    out.args.back().examples = { "true", "false" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -150,10 +163,14 @@ bool ConvertImageToMeshes(Drover &DICOM_data,
     const auto ChannelStr = OptArgs.getValueStr("Channel").value();
     const auto MethodStr = OptArgs.getValueStr("Method").value();
     const auto MeshLabel = OptArgs.getValueStr("MeshLabel").value();
+    const auto NarrowBandStr = OptArgs.getValueStr("NarrowBand").value();
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto NormalizedMeshLabel = X(MeshLabel);
 
+    const auto regex_true = Compile_Regex("^tr?u?e?$");
+    const auto NarrowBand = std::regex_match(NarrowBandStr, regex_true);
+
     const auto Lower = std::stod( LowerStr );
     const auto Upper = std::stod( UpperStr );
     const auto Channel = std::stol( ChannelStr );
@@ -300,6 +317,7 @@ bool ConvertImageToMeshes(Drover &DICOM_data,
             }
             // Note: meshing parameter MutateOpts are irrelevant since we supply our own mask.
             auto meshing_params = dcma_surface_meshes::Parameters();
+            meshing_params.NarrowBand = NarrowBand;
             auto output_mesh = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes( 
                                                             mask_imgs,
                                                             inclusion_threshold, 
@@ -10,6 +10,7 @@
 #include <regex>
 #include <stdexcept>
 #include <numeric>        //Needed for std::inner_product().
+#include <set>
 #include <string>    
 #include <cstdint>
 
@@ -19,6 +20,9 @@
 
 #include "../Structs.h"
 #include "../Regex_Selectors.h"
+#include "../Thread_Pool.h"
+#include "../Convolution_FFT.h"
+#include "../Contour_Rasterization.h"
 #include "../YgorImages_Functors/ConvenienceRoutines.h"
 #include "../YgorImages_Functors/Grouping/Misc_Functors.h"
 #include "../YgorImages_Functors/Compute/Volumetric_Neighbourhood_Sampler.h"
@@ -53,6 +57,13 @@ OperationDoc OpArgDocConvolveImages(){
          " the average voxel intensity. However, for pattern matching the kernel need not"
          " be normalized (though it may make interpretting partial matches easier.)"
     );
+    out.notes.emplace_back(
+         "Large kernels are applied using blocks of zero-padded 3D fast Fourier transforms, which reduces the cost"
+         " per voxel from the number of kernel voxels to roughly the logarithm of the block size. Results are"
+         " equivalent to direct summation up to floating-point round-off. Note, however, that the FFT engine computes"
+         " every voxel before discarding those outside the selected ROIs, so direct summation can be faster when"
+         " the ROIs are small."
+    );
     
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
@@ -119,9 +130,132 @@ OperationDoc OpArgDocConvolveImages(){
                                  "pattern-match" };
     out.args.back().samples = OpArgSamples::Exhaustive;
 
+
+    out.args.emplace_back();
+    out.args.back().name = "Engine";
+    out.args.back().desc = "Controls how the kernel is applied."
+                           " 'direct' sums over the kernel voxels for every outgoing voxel."
+                           " 'fft' uses blocked fast Fourier transforms, which is much faster for large kernels."
+                           " Images must have consistent numbers of rows and columns to use the FFT engine."
+                           " 'auto' estimates the cost of each approach and selects the cheaper one, which will"
+                           " generally be direct summation for small kernels and the FFT engine otherwise.";
+    out.args.back().default_val = "auto";
+    out.args.back().expected = true;
+    out.args.back().examples = { "auto",
+                                 "direct",
+                                 "fft" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
+// Apply a kernel to an image array using the blocked FFT engine, updating the voxels within the ROIs.
+//
+// Returns false without altering the images if the FFT engine cannot be used or, unless forced, if direct summation
+// is estimated to be cheaper.
+static
+bool
+Convolve_Images_Via_FFT(planar_image_collection<float,double> &imagecoll,
+                        std::list<std::reference_wrapper<contour_collection<double>>> cc_ROIs,
+                        const conv_volume &kernel,
+                        const ConvolveVolumeParams &params,
+                        int64_t channel,
+                        bool force){
+    if(imagecoll.images.empty()) return false;
+
+    std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs;
+    for(auto &img : imagecoll.images){
+        selected_imgs.push_back( std::ref(img) );
+    }
+    if(!Images_Form_Rectilinear_Grid(selected_imgs)){
+        return false;
+    }
+
+    // The FFT engine requires a dense volume, so every image must have the same layout.
+    const int64_t rows = imagecoll.images.front().rows;
+    const int64_t cols = imagecoll.images.front().columns;
+    const int64_t channels = imagecoll.images.front().channels;
+    for(const auto &img : imagecoll.images){
+        if( (img.rows != rows) || (img.columns != cols) || (img.channels != channels) ){
+            YLOGWARN("Images have inconsistent dimensions. Unable to use the FFT engine");
+            return false;
+        }
+    }
+
+    const auto orientation_normal = Average_Contour_Normals(cc_ROIs);
+    planar_image_adjacency<float,double> img_adj( {}, { { std::ref(imagecoll) } }, orientation_normal );
+    const auto N_imgs = static_cast<int64_t>(img_adj.int_to_img.size());
+    if(N_imgs != static_cast<int64_t>(imagecoll.images.size())){
+        return false;
+    }
+
+    std::set<int64_t> chnls;
+    for(int64_t c = 0; c < channels; ++c){
+        if( (channel < 0) || (channel == c) ) chnls.insert(c);
+    }
+    if(chnls.empty()){
+        return false;
+    }
+
+    // The number of voxels within the ROIs is not known in advance, so the direct summation estimate assumes every voxel
+    // will be evaluated.
+    const std::array<int64_t, 3> dims = {{ N_imgs, rows, cols }};
+    if( !force
+    &&  !Prefer_FFT_Convolution(dims, kernel.dims(), N_imgs * rows * cols, params) ){
+        return false;
+    }
+    YLOGINFO("Using the FFT engine");
+
+    std::map<int64_t, conv_volume> results;
+    for(const auto &c : chnls){
+        conv_volume vol(N_imgs, rows, cols);
+        for(int64_t i = 0; i < N_imgs; ++i){
+            const auto img_refw = img_adj.index_to_image(i);
+            for(int64_t r = 0; r < rows; ++r){
+                for(int64_t col = 0; col < cols; ++col){
+                    vol.data[vol.index(i, r, col)] = img_refw.get().value(r, col, c);
+                }
+            }
+        }
+        results.emplace(c, Convolve_Volume_FFT(vol, kernel, params));
+    }
+
+    Mutate_Voxels_Opts mv_opts;
+    mv_opts.editstyle      = Mutate_Voxels_Opts::EditStyle::InPlace;
+    mv_opts.inclusivity    = Mutate_Voxels_Opts::Inclusivity::Centre;
+    mv_opts.contouroverlap = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+    mv_opts.aggregate      = Mutate_Voxels_Opts::Aggregate::First;
+    mv_opts.adjacency      = Mutate_Voxels_Opts::Adjacency::SingleVoxel;
+    mv_opts.maskmod        = Mutate_Voxels_Opts::MaskMod::Noop;
+
+    {
+        work_queue<std::function<void(void)>> wq;
+        for(auto &img : imagecoll.images){
+            std::reference_wrapper< planar_image<float, double>> img_refw( std::ref(img) );
+            const auto i = img_adj.image_to_index(img_refw);
+            wq.submit_task([&,img_refw,i]() -> void {
+                auto f_bounded = [&](int64_t E_row, int64_t E_col, int64_t chnl,
+                                     std::reference_wrapper<planar_image<float,double>> /*img_refw*/,
+                                     std::reference_wrapper<planar_image<float,double>> /*mask_img_refw*/,
+                                     float &voxel_val) {
+                    const auto r_it = results.find(chnl);
+                    if(r_it == std::end(results)) return;
+                    voxel_val = r_it->second.data[ r_it->second.index(i, E_row, E_col) ];
+                };
+                Mutate_Voxels_Rasterized( img_refw,
+                                          { img_refw },
+                                          cc_ROIs,
+                                          mv_opts,
+                                          f_bounded );
+
+                UpdateImageDescription( img_refw, "Image Convolved" );
+                UpdateImageWindowCentreWidth( img_refw );
+            });
+        }
+    }
+    return true;
+}
+
 bool ConvolveImages(Drover &DICOM_data,
                       const OperationArgPkg& OptArgs,
                       std::map<std::string, std::string>& /*InvocationMetadata*/,
@@ -137,6 +271,7 @@ bool ConvolveImages(Drover &DICOM_data,
 
     const auto Channel = std::stol( OptArgs.getValueStr("Channel").value() );
     const auto OperationStr = OptArgs.getValueStr("Operation").value();
+    const auto EngineStr = OptArgs.getValueStr("Engine").value();
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto regex_conv = Compile_Regex("^conv?o?l?u?t?i?o?n?$");
@@ -146,6 +281,17 @@ bool ConvolveImages(Drover &DICOM_data,
     const bool op_is_conv = std::regex_match(OperationStr, regex_conv);
     const bool op_is_corr = std::regex_match(OperationStr, regex_corr);
     const bool op_is_mtch = std::regex_match(OperationStr, regex_mtch);
+
+    const auto regex_auto = Compile_Regex("^au?t?o?m?a?t?i?c?$");
+    const auto regex_drct = Compile_Regex("^di?r?e?c?t?$");
+    const auto regex_fft  = Compile_Regex("^ff?t?$");
+
+    const bool engine_is_auto = std::regex_match(EngineStr, regex_auto);
+    const bool engine_is_drct = std::regex_match(EngineStr, regex_drct);
+    const bool engine_is_fft  = std::regex_match(EngineStr, regex_fft);
+    if(!engine_is_auto && !engine_is_drct && !engine_is_fft){
+        throw std::invalid_argument("Engine argument not understood. Cannot continue.");
+    }
     //-----------------------------------------------------------------------------------------------------------------
 
     // Identify the contours to use.
@@ -273,6 +419,34 @@ bool ConvolveImages(Drover &DICOM_data,
                 YLOGINFO("Neighbourhood comprises " << ud.voxel_triplets.size() << " neighbours");
             }
 
+            if(!engine_is_drct){
+                ConvolveVolumeParams p;
+                p.operation = op_is_conv ? ConvolveVolumeParams::Operation::Convolution
+                            : op_is_corr ? ConvolveVolumeParams::Operation::Correlation
+                                         : ConvolveVolumeParams::Operation::PatternMatch;
+                p.kernel_centre = {{ d_i, d_r, d_c }};
+
+                // Re-arrange the kernel voxels into the layout used by the FFT engine.
+                conv_volume kernel(k_imgs, k_rows, k_columns);
+                {
+                    auto k_it = std::begin(k_values);
+                    for(int64_t r = 0; r < k_rows; ++r){
+                        for(int64_t c = 0; c < k_columns; ++c){
+                            for(int64_t i = 0; i < k_imgs; ++i){
+                                kernel.data[kernel.index(i, r, c)] = *(k_it++);
+                            }
+                        }
+                    }
+                }
+
+                if(Convolve_Images_Via_FFT((*iap_it)->imagecoll, cc_ROIs, kernel, p, Channel, engine_is_fft)){
+                    continue;
+                }
+                if(engine_is_fft){
+                    throw std::runtime_error("Unable to convolve images using the FFT engine.");
+                }
+            }
+
             if(!(*iap_it)->imagecoll.Compute_Images( ComputeVolumetricNeighbourhoodSampler, 
                                                      {}, cc_ROIs, &ud )){
                 throw std::runtime_error("Unable to convolve images.");
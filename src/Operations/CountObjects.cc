@@ -68,48 +68,56 @@ OperationDoc OpArgDocCountObjects() {
     out.args.emplace_back();
     out.args.back() = NCWhitelistOpArgDoc();
     out.args.back().name = "NormalizedROILabelRegex";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = ".*";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = RCWhitelistOpArgDoc();
     out.args.back().name = "ROILabelRegex";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = ".*";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = CCWhitelistOpArgDoc();
     out.args.back().name = "ROISelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "all";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
     out.args.back().name = "ImageSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = LSWhitelistOpArgDoc();
     out.args.back().name = "LineSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = SMWhitelistOpArgDoc();
     out.args.back().name = "MeshSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = PCWhitelistOpArgDoc();
     out.args.back().name = "PointSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
     out.args.back().expected = false;
 
     out.args.emplace_back();
     out.args.back() = STWhitelistOpArgDoc();
     out.args.back().name = "TableSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
     out.args.back().expected = false;
 
@@ -44,6 +44,7 @@ OperationDoc OpArgDocDICOMExportImagesAsCT(){
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
     out.args.back().name = "ImageSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
@@ -38,6 +38,7 @@ OperationDoc OpArgDocDICOMExportImagesAsDose(){
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
     out.args.back().name = "ImageSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
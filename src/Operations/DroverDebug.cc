@@ -350,7 +350,7 @@ bool DroverDebug(Drover &DICOM_data,
 
             }else{
                 YLOGINFO("  Sparse_Table " << t_cnt << " has " << 
-                         tp->table.data.size() << " rows and " <<
+                         tp->table.size() << " cells and " <<
                          tp->table.metadata.size() << " metadata keys");
                 if(verbosity == verbosity_t::medium) continue;
                 if(IncludeMetadata){
@@ -22,6 +22,7 @@
 #include "../KineticModel_1Compartment2Input_5Param_Chebyshev_Common.h"
 #include "../KineticModel_1Compartment2Input_5Param_LinearInterp_Common.h"
 #include "../KineticModel_1Compartment2Input_Reduced3Param_Chebyshev_Common.h"
+#include "../Contour_Rasterization.h"
 #include "../Structs.h"
 #include "../Regex_Selectors.h"
 #include "../YgorImages_Functors/Grouping/Misc_Functors.h"
@@ -246,11 +247,6 @@ bool DumpPerROIParams_KineticModel_1Compartment2Input_5Param(
              all_k1A_images.remove(an_img_it); //std::list::remove() erases all elements equal to input value.
         }
         planar_image<float,double> &img = std::ref(*selected_k1A_imgs.front());
-        //Loop over the rois, rows, columns, channels, and finally any selected images (if applicable).
-        const auto row_unit   = img.row_unit;
-        const auto col_unit   = img.col_unit;
-        const auto ortho_unit = img.ortho_unit();
-    
         //Look for serialized model_params. Deserialize them. We basically are finding AIF and VIF only here.
         //
         // Note: we have to do this first, before loading voxel-specific data (e.g., k1A) because the
@@ -294,37 +290,13 @@ bool DumpPerROIParams_KineticModel_1Compartment2Input_5Param(
                     throw std::runtime_error("Missing necessary tags for reporting analysis results. Cannot continue");
                 }
                 
-        /*
-                //Construct a bounding box to reduce computational demand of checking every voxel.
-                auto BBox = roi_it->Bounding_Box_Along(row_unit, 1.0);
-                auto BBoxBestFitPlane = BBox.Least_Squares_Best_Fit_Plane(vec3<double>(0.0,0.0,1.0));
-                auto BBoxProjectedContour = BBox.Project_Onto_Plane_Orthogonally(BBoxBestFitPlane);
-                const bool BBoxAlreadyProjected = true;
-        */
-        
-                //Prepare a contour for fast is-point-within-the-polygon checking.
-                auto BestFitPlane = contour.Least_Squares_Best_Fit_Plane(ortho_unit);
-                auto ProjectedContour = contour.Project_Onto_Plane_Orthogonally(BestFitPlane);
-                const bool AlreadyProjected = true;
+                //Voxels bounded by the contour are found via scanline rasterization rather than per-voxel point-in-polygon tests.
+                const auto mask = Rasterize_Contour_Cached(img, contour);
         
                 for(auto row = 0; row < img.rows; ++row){
                     for(auto col = 0; col < img.columns; ++col){
-                        //Figure out the spatial location of the present voxel.
-                        const auto point = img.position(row,col);
-        
-        /*
-                        //Check if within the bounding box. It will generally be cheaper than the full contour (4 points vs. ? points).
-                        auto BBoxProjectedPoint = BBoxBestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                        if(!BBoxProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BBoxBestFitPlane,
-                                                                                            BBoxProjectedPoint,
-                                                                                            BBoxAlreadyProjected)) continue;
-        */
-        
-                        //Perform a more detailed check to see if we are in the ROI.
-                        auto ProjectedPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                        if(ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                       ProjectedPoint,
-                                                                                       AlreadyProjected)){
+                        //Check if the voxel is bounded by the contour.
+                        if(mask->contains(row, col)){
                             for(auto chan = 0; chan < img.channels; ++chan){
 
                                 model_5params_linear.k1A  = std::numeric_limits<double>::quiet_NaN();
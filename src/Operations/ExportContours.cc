@@ -51,17 +51,20 @@ OperationDoc OpArgDocExportContours(){
     out.args.emplace_back();
     out.args.back() = NCWhitelistOpArgDoc();
     out.args.back().name = "NormalizedROILabelRegex";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = ".*";
 
 
     out.args.emplace_back();
     out.args.back() = RCWhitelistOpArgDoc();
     out.args.back().name = "ROILabelRegex";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = ".*";
 
     out.args.emplace_back();
     out.args.back() = CCWhitelistOpArgDoc();
     out.args.back().name = "ROISelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "all";
 
 
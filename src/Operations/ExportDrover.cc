@@ -69,6 +69,27 @@ OperationDoc OpArgDocExportDrover(){
     out.args.back().expected = true;
     out.args.back().examples = { "out.ts_dcma", "/tmp/out.ts_dcma" };
 
+    out.args.emplace_back();
+    out.args.back().name = "ProtocolVersion";
+    out.args.back().desc = "The RPC protocol revision to write. Revision 1 can be read by all versions of this program."
+                           " Revision 2 packs bulk numerical arrays (e.g., pixel data, vertices) into binary blobs,"
+                           " which are considerably smaller and faster to read, but can only be read by versions"
+                           " that support it. Revisions that are not supported here are clamped to the most recent"
+                           " supported revision.";
+    out.args.back().default_val = "1";
+    out.args.back().expected = true;
+    out.args.back().examples = { "1", "2" };
+
+    out.args.emplace_back();
+    out.args.back().name = "Compression";
+    out.args.back().desc = "Controls how bulk numerical arrays are compressed. Only applies to protocol revision 2"
+                           " and later. The option 'zlib' compresses each blob, which reduces file size"
+                           " at the expense of some speed. The option 'none' leaves blobs uncompressed.";
+    out.args.back().default_val = "zlib";
+    out.args.back().expected = true;
+    out.args.back().examples = { "none", "zlib" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -80,7 +101,26 @@ bool ExportDrover(Drover &DICOM_data,
 
     //---------------------------------------------- User Parameters --------------------------------------------------
     const auto Filename = OptArgs.getValueStr("Filename").value();
+    const auto ProtocolVersion = std::stol( OptArgs.getValueStr("ProtocolVersion").value() );
+    const auto CompressionStr = OptArgs.getValueStr("Compression").value();
     //-----------------------------------------------------------------------------------------------------------------
+    const auto regex_none = Compile_Regex("^no?n?e?$");
+    const auto regex_zlib = Compile_Regex("^zl?i?b?$");
+
+    ::dcma::rpc::bulk_compression::type compression;
+    if(std::regex_match(CompressionStr, regex_none)){
+        compression = ::dcma::rpc::bulk_compression::UNCOMPRESSED;
+    }else if(std::regex_match(CompressionStr, regex_zlib)){
+        compression = ::dcma::rpc::bulk_compression::ZLIB;
+    }else{
+        throw std::invalid_argument("Compression argument '"_s + CompressionStr + "' is not valid");
+    }
+    if(ProtocolVersion < 1){
+        throw std::invalid_argument("ProtocolVersion must be positive");
+    }
+
+    // The eventual reader is treated as the peer, so the encoding is negotiated exactly as it is for RPC clients.
+    const auto enc = Negotiate_Bulk_Encoding(ProtocolVersion, Get_Protocol_Info().compressions, compression);
 
     const bool permit_read  = true;
     const bool permit_write = true;
@@ -95,7 +135,7 @@ bool ExportDrover(Drover &DICOM_data,
 
     try{
         ::dcma::rpc::Drover d;
-        Serialize(DICOM_data, d);
+        Serialize(DICOM_data, d, enc);
 
         transport->open();
         d.write(protocol.get());
@@ -48,6 +48,7 @@ OperationDoc OpArgDocExportPointClouds(){
     out.args.emplace_back();
     out.args.back() = PCWhitelistOpArgDoc();
     out.args.back().name = "PointSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
    
 
@@ -58,6 +58,7 @@ OperationDoc OpArgDocExportSurfaceMeshesSTL(){
     out.args.emplace_back();
     out.args.back() = SMWhitelistOpArgDoc();
     out.args.back().name = "MeshSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
    
 
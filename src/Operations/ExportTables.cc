@@ -30,6 +30,7 @@ OperationDoc OpArgDocExportTables(){
     out.args.emplace_back();
     out.args.back() = STWhitelistOpArgDoc();
     out.args.back().name = "TableSelection";
+    out.args.back().flow = OpArgFlow::Ingress;
     out.args.back().default_val = "last";
 
 
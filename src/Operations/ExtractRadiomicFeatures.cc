@@ -114,6 +114,16 @@ OperationDoc OpArgDocExtractRadiomicFeatures(){
     out.args.back().default_val = "all";
 
 
+    out.args.emplace_back();
+    out.args.back().name = "NarrowBand";
+    out.args.back().desc = "Controls whether the surface mesh used for mesh-based features is extracted only from"
+                           " voxels near the ROI boundary. Features are unaffected, but meshing large ROIs is"
+                           " faster and uses less memory when enabled.";
+    out.args.back().default_val = "true";
+    out.args.back().expected = true;
+    out.args.back().examples = { "true", "false" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -135,7 +145,11 @@ bool ExtractRadiomicFeatures(Drover &DICOM_data,
 
     const auto ImageSelectionStr = OptArgs.getValueStr("ImageSelection").value();
 
+    const auto NarrowBandStr = OptArgs.getValueStr("NarrowBand").value();
+
     //-----------------------------------------------------------------------------------------------------------------
+    const auto regex_true = Compile_Regex("^tr?u?e?$");
+    const auto NarrowBand = std::regex_match(NarrowBandStr, regex_true);
 
     //Stuff references to all contours into a list. Remember that you can still address specific contours through
     // the original holding containers (which are not modified here).
@@ -204,6 +218,7 @@ bool ExtractRadiomicFeatures(Drover &DICOM_data,
     std::stringstream smesh_report;
     {
         auto meshing_params = dcma_surface_meshes::Parameters();
+        meshing_params.NarrowBand = NarrowBand;
         auto fv_mesh = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes( 
                                                         cc_ROIs, meshing_params );
         auto smesh = dcma_surface_meshes::FVSMeshToPolyhedron(fv_mesh);
@@ -110,6 +110,7 @@ bool GenerateMeshes(Drover &DICOM_data,
     YLOGINFO("sdf at origin: " << sdf_at_origin );
 
     dcma_surface_meshes::Parameters meshing_params;
+    meshing_params.NarrowBand = true; // The SDF is only sampled near the surface.
     const double inclusion_threshold = 0.0;
     const bool below_is_interior = true;
     auto fv_mesh = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes( root,
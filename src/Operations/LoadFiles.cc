@@ -32,6 +32,7 @@
 #include "../Write_File.h"
 #include "../File_Loader.h"
 #include "../Operation_Dispatcher.h"
+#include "../DICOM_Series_Index.h"
 
 #include "LoadFiles.h"
 
@@ -61,6 +62,51 @@ OperationDoc OpArgDocLoadFiles(){
     out.args.back().expected = true;
     out.args.back().examples = { "/tmp/image.dcm", "rois.dcm", "dose.dcm", "image.fits", "point_cloud.xyz" };
 
+    out.args.emplace_back();
+    out.args.back().name = "IndexFile";
+    out.args.back().desc = "If non-empty, DICOM files are located using a persistent header index stored in this file."
+                           " The index is created if necessary, and files are added or refreshed when they are new or"
+                           " have been modified. Indexing only reads each file's header (pixel data is not read), so"
+                           " subsequent invocations can cheaply select a subset of files (e.g., a single series) from"
+                           " a large directory, and only the selected files will be fully parsed."
+                           " When this option is used, 'FileName' may be a directory, which is searched recursively."
+                           " Files that are not DICOM are not indexed and are ignored.";
+    out.args.back().default_val = "";
+    out.args.back().expected = false;
+    out.args.back().examples = { "", "/tmp/dicom_index.tsv", "/data/pacs/index.tsv" };
+
+    out.args.emplace_back();
+    out.args.back().name = "PatientID";
+    out.args.back().desc = "A regular expression that indexed files' PatientID must match to be loaded."
+                           " This option is only used when an 'IndexFile' is provided.";
+    out.args.back().default_val = ".*";
+    out.args.back().expected = false;
+    out.args.back().examples = { ".*", "123456", "ABC.*" };
+
+    out.args.emplace_back();
+    out.args.back().name = "StudyInstanceUID";
+    out.args.back().desc = "A regular expression that indexed files' StudyInstanceUID must match to be loaded."
+                           " This option is only used when an 'IndexFile' is provided.";
+    out.args.back().default_val = ".*";
+    out.args.back().expected = false;
+    out.args.back().examples = { ".*", "1[.]2[.]3[.]4[.]5" };
+
+    out.args.emplace_back();
+    out.args.back().name = "SeriesInstanceUID";
+    out.args.back().desc = "A regular expression that indexed files' SeriesInstanceUID must match to be loaded."
+                           " This option is only used when an 'IndexFile' is provided.";
+    out.args.back().default_val = ".*";
+    out.args.back().expected = false;
+    out.args.back().examples = { ".*", "1[.]2[.]3[.]4[.]5[.]6" };
+
+    out.args.emplace_back();
+    out.args.back().name = "Modality";
+    out.args.back().desc = "A regular expression that indexed files' Modality must match to be loaded."
+                           " This option is only used when an 'IndexFile' is provided.";
+    out.args.back().default_val = ".*";
+    out.args.back().expected = false;
+    out.args.back().examples = { ".*", "CT", "RTSTRUCT|RTDOSE" };
+
     return out;
 }
 
@@ -71,6 +117,12 @@ bool LoadFiles(Drover &DICOM_data,
 
     //---------------------------------------------- User Parameters --------------------------------------------------
     const auto FileNameStr = OptArgs.getValueStr("FileName").value();
+    const auto IndexFileStr = OptArgs.getValueStr("IndexFile").value_or("");
+
+    const auto PatientIDStr = OptArgs.getValueStr("PatientID").value_or(".*");
+    const auto StudyInstanceUIDStr = OptArgs.getValueStr("StudyInstanceUID").value_or(".*");
+    const auto SeriesInstanceUIDStr = OptArgs.getValueStr("SeriesInstanceUID").value_or(".*");
+    const auto ModalityStr = OptArgs.getValueStr("Modality").value_or(".*");
 
     //-----------------------------------------------------------------------------------------------------------------
 
@@ -94,10 +146,55 @@ bool LoadFiles(Drover &DICOM_data,
             throw std::invalid_argument(ss.str().c_str());
         }
     }
-    
+
+    // Use the index to select a subset of files, if requested.
+    if(!IndexFileStr.empty()){
+        const auto regex_patientid = Compile_Regex(PatientIDStr);
+        const auto regex_studyuid  = Compile_Regex(StudyInstanceUIDStr);
+        const auto regex_seriesuid = Compile_Regex(SeriesInstanceUIDStr);
+        const auto regex_modality  = Compile_Regex(ModalityStr);
+
+        std::list<std::filesystem::path> files;
+        for(const auto &p : Paths){
+            if(std::filesystem::is_directory(p)){
+                for(const auto &de : std::filesystem::recursive_directory_iterator(p)){
+                    if(de.is_regular_file()) files.emplace_back( std::filesystem::absolute(de.path()) );
+                }
+            }else{
+                files.emplace_back( std::filesystem::absolute(p) );
+            }
+        }
+
+        DICOM_Series_Index index;
+        index.read(IndexFileStr);
+        const auto N_scanned = index.update(files);
+        if(0 < N_scanned) index.write(IndexFileStr);
+        YLOGINFO("DICOM index contains " << index.entries.size() << " files (" << N_scanned << " were scanned)");
+
+        // Only consider the files that were requested, even if the index contains other files.
+        std::set<std::filesystem::path> requested(files.begin(), files.end());
+        Paths = index.select([&](const dicom_file_summary_t &s) -> bool {
+            return (requested.count(s.path) != 0)
+                && std::regex_match(s.PatientID, regex_patientid)
+                && std::regex_match(s.StudyInstanceUID, regex_studyuid)
+                && std::regex_match(s.SeriesInstanceUID, regex_seriesuid)
+                && std::regex_match(s.Modality, regex_modality);
+        });
+        YLOGINFO("Selected " << Paths.size() << " files from the DICOM index");
+        if(Paths.empty()){
+            YLOGWARN("No indexed files matched the selection criteria");
+            return true;
+        }
+    }
+
     // Load the files to a placeholder Drover class.
     Drover DD_work;
     std::map<std::string, std::string> dummy;
+    for(const auto &key : { "DICOMLazyPixelData", "DICOMLoaderConcurrency" }){
+        if(const auto it = InvocationMetadata.find(key); it != InvocationMetadata.end()){
+            dummy.insert(*it); // Loader settings are honoured, but nothing is passed back.
+        }
+    }
     std::list<OperationArgPkg> Operations;
     const auto res = Load_Files(DD_work, dummy, FilenameLex, Operations, Paths);
     if(!res){
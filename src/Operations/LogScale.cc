@@ -32,6 +32,7 @@ OperationDoc OpArgDocLogScale(){
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
     out.args.back().name = "ImageSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
     
     return out;
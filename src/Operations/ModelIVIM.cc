@@ -33,6 +33,7 @@
 #include "../Regex_Selectors.h"
 #include "../String_Parsing.h"
 #include "../YgorImages_Functors/Compute/Joint_Pixel_Sampler.h"
+#include "../YgorImages_Functors/ConvenienceRoutines.h"
 #include "../MRI_IVIM.h"
 using namespace MRI_IVIM;
 
@@ -131,9 +132,9 @@ OperationDoc OpArgDocModelIVIM(){
     out.args.back().name = "Model";
     out.args.back().desc = "The model that will be fitted."
 #ifdef DCMA_USE_EIGEN
-                           " Currently, 'adc-simple' , 'adc-ls' , 'auc-simple', 'biexp', 'biexp-ols', and 'kurtosis' are available."
+                           " Currently, 'adc-simple' , 'adc-ls' , 'auc-simple', 'biexp', 'biexp-batch', 'biexp-ols', and 'kurtosis' are available."
 #else
-                           " Currently, 'adc-simple' , 'adc-ls' , 'auc-simple', 'biexp', and 'biexp-ols' are available."
+                           " Currently, 'adc-simple' , 'adc-ls' , 'auc-simple', 'biexp', 'biexp-batch', and 'biexp-ols' are available."
 #endif //DCMA_USE_EIGEN
                            "\n\n"
                            "The 'adc-simple' is a simplistic diffusion model that ignores perfusion:"
@@ -168,6 +169,14 @@ OperationDoc OpArgDocModelIVIM(){
                            " pseudodiffusion (Dp), the number of attempted iterations, the number of steps in"
                            " Marquardt's algorithm where updates were accepted, final model cost, and voxel status."
                            "\n\n"
+                           "The 'biexp-batch' model fits the same biexponential model as 'biexp-lm' and produces the"
+                           " same output channels, but is intended for large images with many voxels."
+                           " Voxels are first gathered, and then each voxel's signal is matched against a precomputed"
+                           " table of pseudodiffusion curves to find a robust starting point. The Levenberg-Marquardt"
+                           " refinement is then performed for batches of voxels in parallel."
+                           " This model is typically much faster than 'biexp-lm' and is less sensitive to the"
+                           " initial guess."
+                           "\n\n"
                            "The 'biexp-ls' model uses a segmented fitting approach with linearized data to perform"
                            " analytical ordinary least-squares fitting of the biexponential model"
                            " $S(b) = S0 * \\left\\[ f * exp(-b * Dp) + (1 - f) * exp(-b * D)\\right\\].$"
@@ -196,6 +205,7 @@ OperationDoc OpArgDocModelIVIM(){
                                  "adc-ls",
                                  "auc-simple",
                                  "biexp-lm",
+                                 "biexp-batch",
                                  "biexp-ls",
 #ifdef DCMA_USE_EIGEN
                                  "kurtosis",
@@ -315,6 +325,7 @@ bool ModelIVIM(Drover &DICOM_data,
     const auto model_adc_ls = Compile_Regex("^adc?[-_]?ls?$");
     const auto model_auc = Compile_Regex("^auc?[-_]?si?m?p?l?e?$");
     const auto model_biexp_lm = Compile_Regex("^bi[-_]?e?x?p?o?n?e?n?t?i?a?l?[-_]?lm$");
+    const auto model_biexp_batch = Compile_Regex("^bi[-_]?e?x?p?o?n?e?n?t?i?a?l?[-_]?ba?t?c?h?$");
     const auto model_biexp_ls = Compile_Regex("^bi[-_]?e?x?p?o?n?e?n?t?i?a?l?[-_]?o?ls$");
     const auto model_kurtosis = Compile_Regex("^ku?r?t?o?s?i?s?");
 
@@ -433,6 +444,14 @@ bool ModelIVIM(Drover &DICOM_data,
         ud.inc_nan = TestIncludeNaN;
         ud.inaccessible_val = InaccessibleValue;
 
+        // Voxels gathered for batched fitting, which is deferred until all voxels have been sampled.
+        struct gathered_voxels_t {
+            std::mutex m;
+            std::vector<vec3<double>> positions;
+            std::vector<float> vals; // N_bvalues samples for each voxel.
+        } gathered_voxels;
+        bool fit_gathered_voxels = false;
+
         if(std::regex_match(ModelStr, model_adc_simple)){
             // Set outgoing channels accordingly.
             const int64_t N_channels = 1; // ADC.
@@ -673,6 +692,36 @@ bool ModelIVIM(Drover &DICOM_data,
                 return f;
             };
 
+        }else if(std::regex_match(ModelStr, model_biexp_batch)){
+            // Set outgoing channels accordingly.
+            const int64_t N_channels = 7; // f, D, pseudoD, attempted iters, updates, fitted model cost, voxel status.
+            auto imgarr_ptr = &((*iap_it)->imagecoll);
+            for(auto &img : imgarr_ptr->images){
+                set_channels(img, N_channels);
+            }
+
+            ud.description = "f, D, pseudo-D, attempted iters, number of updates, fitted model cost, voxel status (bi-exponential batched LM fit)";
+            ud.f_reduce = [N_bvalues,
+                           InaccessibleValue,
+                           gathered_ptr = &gathered_voxels]( std::vector<float> &vals, 
+                                                             vec3<double> pos ) -> float {
+                vals.erase(vals.begin()); // Remove the base image's value.
+                if(vals.size() != N_bvalues){
+                    throw std::runtime_error("Unmatched voxel and b-value vectors. Refusing to continue.");
+                }
+                if(vals.empty()){
+                    throw std::runtime_error("No overlapping images detected. Unable to continue.");
+                }
+
+                std::lock_guard<std::mutex> lock(gathered_ptr->m);
+                gathered_ptr->positions.emplace_back(pos);
+                gathered_ptr->vals.insert( std::end(gathered_ptr->vals), std::begin(vals), std::end(vals) );
+
+                // The fitted parameters are written after all voxels have been gathered.
+                return InaccessibleValue;
+            };
+            fit_gathered_voxels = true;
+
         }else if(std::regex_match(ModelStr, model_auc)){
             // Set outgoing channels accordingly.
             const int64_t N_channels = 1; // AUC.
@@ -728,6 +777,68 @@ bool ModelIVIM(Drover &DICOM_data,
             throw std::runtime_error("Unable to analyze images.");
         }
 
+        if(fit_gathered_voxels){
+            const int64_t chan_f  = 0;
+            const int64_t chan_D  = 1;
+            const int64_t chan_pD = 2;
+            const int64_t chan_is = 3;
+            const int64_t chan_u  = 4;
+            const int64_t chan_c  = 5;
+            const int64_t chan_s  = 6;
+
+            YLOGINFO("Fitting " << gathered_voxels.positions.size() << " voxels");
+            const int numIterations = 100;
+            const auto fits = GetBiExp_Batch(bvalues, gathered_voxels.vals, numIterations, BValueThreshold);
+
+            auto imgarr_ptr = &((*iap_it)->imagecoll);
+            int64_t N_nonfinite = 0;
+            for(size_t i = 0UL; i < fits.size(); ++i){
+                const auto [f, D, pseudoD, num_iters, num_updates, cost, voxel_status] = fits[i];
+
+                const auto &pos = gathered_voxels.positions[i];
+                const auto img_it_l = imgarr_ptr->get_images_which_encompass_point(pos);
+                if(img_it_l.size() != 1){
+                    continue;
+                }
+                const auto index_f  = img_it_l.front()->index(pos, chan_f);
+                const auto index_D  = img_it_l.front()->index(pos, chan_D);
+                const auto index_pD = img_it_l.front()->index(pos, chan_pD);
+                const auto index_is = img_it_l.front()->index(pos, chan_is);
+                const auto index_u  = img_it_l.front()->index(pos, chan_u);
+                const auto index_c  = img_it_l.front()->index(pos, chan_c);
+                const auto index_s  = img_it_l.front()->index(pos, chan_s);
+                if( (index_f < 0)
+                ||  (index_D < 0)
+                ||  (index_pD < 0)
+                ||  (index_is < 0)
+                ||  (index_u < 0)
+                ||  (index_c < 0)
+                ||  (index_s < 0) ){
+                    continue;
+                }
+                // The fit diagnostics and status are always written so failed fits can be identified. The fitted
+                // parameters are only written when the fit produced a finite f.
+                img_it_l.front()->reference(index_is) = num_iters;
+                img_it_l.front()->reference(index_u) = num_updates;
+                img_it_l.front()->reference(index_c) = cost;
+                img_it_l.front()->reference(index_s) = voxel_status;
+                if(!std::isfinite( f )){
+                    ++N_nonfinite;
+                    continue;
+                }
+                img_it_l.front()->reference(index_f) = f;
+                img_it_l.front()->reference(index_D) = D;
+                img_it_l.front()->reference(index_pD) = pseudoD;
+            }
+            if(0 < N_nonfinite){
+                YLOGWARN("Bi-exponential fit produced a non-finite f for " << N_nonfinite << " voxels");
+            }
+
+            for(auto &img : imgarr_ptr->images){
+                UpdateImageWindowCentreWidth( std::ref(img) );
+            }
+        }
+
         // Assign common metadata.
         for(auto & img : (*iap_it)->imagecoll.images){
             auto l_cm = cm;
@@ -37,6 +37,7 @@ OperationDoc OpArgDocModifyImageMetadata(){
     out.args.emplace_back();
     out.args.back() = IAWhitelistOpArgDoc();
     out.args.back().name = "ImageSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
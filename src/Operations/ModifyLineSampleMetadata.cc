@@ -33,6 +33,7 @@ OperationDoc OpArgDocModifyLineSampleMetadata(){
     out.args.emplace_back();
     out.args.back() = LSWhitelistOpArgDoc();
     out.args.back().name = "LineSampleSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
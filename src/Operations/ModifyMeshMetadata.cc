@@ -33,6 +33,7 @@ OperationDoc OpArgDocModifyMeshMetadata(){
     out.args.emplace_back();
     out.args.back() = SMWhitelistOpArgDoc();
     out.args.back().name = "MeshSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
@@ -33,6 +33,7 @@ OperationDoc OpArgDocModifyRTPlanMetadata(){
     out.args.emplace_back();
     out.args.back() = TPWhitelistOpArgDoc();
     out.args.back().name = "RTPlanSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
@@ -33,6 +33,7 @@ OperationDoc OpArgDocModifyTableMetadata(){
     out.args.emplace_back();
     out.args.back() = STWhitelistOpArgDoc();
     out.args.back().name = "TableSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
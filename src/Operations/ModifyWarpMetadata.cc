@@ -34,6 +34,7 @@ OperationDoc OpArgDocModifyWarpMetadata(){
     out.args.emplace_back();
     out.args.back() = T3WhitelistOpArgDoc();
     out.args.back().name = "TransformSelection";
+    out.args.back().flow = OpArgFlow::IngressEgress;
     out.args.back().default_val = "last";
 
     out.args.emplace_back();
@@ -13,6 +13,9 @@
 #include <filesystem>
 #include <chrono>
 #include <unordered_set>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <iomanip>            //Needed for std::put_time(...)
 #include <cstdint>
 
@@ -25,6 +28,7 @@
 #include "../Regex_Selectors.h"
 #include "../File_Loader.h"
 #include "../Operation_Dispatcher.h"
+#include "../Directory_Watcher.h"
 
 #include "PollDirectories.h"
 
@@ -36,7 +40,7 @@ OperationDoc OpArgDocPollDirectories(){
     out.tags.emplace_back("category: meta");
 
     out.desc = 
-        "This operation continuously polls ('watches') a directory, waiting for new files."
+        "This operation continuously watches a directory, waiting for new files."
         " When files are received, they are loaded and child operations are performed.";
 
     out.notes.emplace_back(
@@ -44,15 +48,20 @@ OperationDoc OpArgDocPollDirectories(){
         " Consider this operation a 'trigger' that can initiate further processing."
     );
     out.notes.emplace_back(
-        "Only file names and sizes are used to evaluate when a file was last altered."
-        " Filesystem modification times are not used, and file contents being altered will not be detected."
+        "Where supported (currently Linux, via inotify), filesystem change notifications are used to detect new and"
+        " altered files. Directories are then only enumerated once at startup, so the cost of watching does not depend"
+        " on the number of files present, idle CPU usage is negligible, and files are noticed promptly."
+        " Otherwise, directories are periodically enumerated ('polled') and only file names and sizes are used to"
+        " evaluate when a file was last altered. Polling may therefore be slow and/or inefficient for large"
+        " directories, depending on filesystem/OS caching."
     );
     out.notes.emplace_back(
-        "To reduce external dependencies, only rudimentary directory polling methods are used."
-        " Polling may therefore be slow and/or inefficient, depending on filesystem/OS caching."
+        "Change notifications are not generated for all filesystems. Notably, network filesystems that are altered by"
+        " other hosts will not generate notifications. Polling should be used for these filesystems."
     );
     out.notes.emplace_back(
-        "Files will be loaded and processed in batches sequentially, i.e., in 'blocking' mode."
+        "Watching, loading, and processing proceed concurrently, so files can be loaded while earlier batches are"
+        " being processed. However, batches are processed sequentially, in the order they became ready."
     );
     out.notes.emplace_back(
         "Before files are processed, they are loaded into the existing Drover object."
@@ -77,7 +86,8 @@ OperationDoc OpArgDocPollDirectories(){
     out.args.back().name = "PollInterval";
     out.args.back().desc = "The amount of time, in seconds, to wait between polling. Note that the time spent"
                            " polling (i.e., enumerating directory contents and metadata) is not included in this"
-                           " time, so the total polling cycle time will be larger than this interval.";
+                           " time, so the total polling cycle time will be larger than this interval."
+                           " This parameter is not used when filesystem change notifications are used.";
     out.args.back().default_val = "5.0";
     out.args.back().expected = true;
     out.args.back().examples = { "1.0", "5", "600" };
@@ -128,6 +138,29 @@ OperationDoc OpArgDocPollDirectories(){
     out.args.back().examples = { "separate", "subdirs", "altogether" };
     out.args.back().samples = OpArgSamples::Exhaustive;
 
+    out.args.emplace_back();
+    out.args.back().name = "WatchMethod";
+    out.args.back().desc = "Controls how directories are watched for changes."
+                           " Currently supported options are 'automatic', 'events', and 'polling'."
+                           "\n\n"
+                           "Use 'events' to require filesystem change notifications, 'polling' to periodically"
+                           " enumerate the directories, and 'automatic' to use change notifications when available"
+                           " and fall back to polling otherwise.";
+    out.args.back().default_val = "automatic";
+    out.args.back().expected = true;
+    out.args.back().examples = { "automatic", "events", "polling" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
+    out.args.emplace_back();
+    out.args.back().name = "QueueDepth";
+    out.args.back().desc = "The maximum number of batches that can be waiting to be loaded, and separately the maximum"
+                           " number of loaded batches that can be waiting to be processed."
+                           " Larger values allow more loading to occur while earlier batches are being processed,"
+                           " but require more memory.";
+    out.args.back().default_val = "2";
+    out.args.back().expected = true;
+    out.args.back().examples = { "1", "2", "10" };
+
     return out;
 }
 
@@ -144,6 +177,8 @@ bool PollDirectories(Drover &DICOM_data,
     const auto SettleDelay = std::stod( OptArgs.getValueStr("SettleDelay").value() );
     const auto GroupByStr = OptArgs.getValueStr("GroupBy").value();
     const auto IgnoreExistingStr = OptArgs.getValueStr("IgnoreExisting").value();
+    const auto WatchMethodStr = OptArgs.getValueStr("WatchMethod").value();
+    const auto QueueDepth = std::stol( OptArgs.getValueStr("QueueDepth").value() );
 
     int64_t filesystem_error_count = 0;
     const int64_t max_filesystem_error_count = 20;
@@ -153,11 +188,29 @@ bool PollDirectories(Drover &DICOM_data,
     const auto regex_subdirs    = Compile_Regex("^su?b[_-]?d?i?r?e?c?t?o?r?[iy]?e?s?$");
     const auto regex_altogether = Compile_Regex("^al?t?o?g?e?t?h?e?r?$");
 
+    const auto regex_auto       = Compile_Regex("^au?t?o?m?a?t?i?c?$");
+    const auto regex_events     = Compile_Regex("^ev?e?n?t?s?$");
+    const auto regex_polling    = Compile_Regex("^po?l?l?i?n?g?$");
+
     const auto IgnoreExisting  = std::regex_match(IgnoreExistingStr, regex_true);
     const auto GroupBySeparate = std::regex_match(GroupByStr, regex_separate);
     const auto GroupBySubdirs  = std::regex_match(GroupByStr, regex_subdirs);
     const auto GroupAltogether = std::regex_match(GroupByStr, regex_altogether);
 
+    auto watch_method = directory_watcher::method::automatic;
+    if(std::regex_match(WatchMethodStr, regex_auto)){
+        watch_method = directory_watcher::method::automatic;
+    }else if(std::regex_match(WatchMethodStr, regex_events)){
+        watch_method = directory_watcher::method::events;
+    }else if(std::regex_match(WatchMethodStr, regex_polling)){
+        watch_method = directory_watcher::method::polling;
+    }else{
+        throw std::invalid_argument("Watch method argument not understood. Cannot continue.");
+    }
+    if( !GroupBySeparate && !GroupBySubdirs && !GroupAltogether ){
+        throw std::invalid_argument("Grouping argument not understood. Cannot continue.");
+    }
+
     if(OptArgs.getChildren().empty()){
         YLOGWARN("No children operations specified; files will be loaded but not processed");
     }
@@ -167,8 +220,8 @@ bool PollDirectories(Drover &DICOM_data,
     if(SettleDelay < 0){
         throw std::invalid_argument("Settle delay is invalid. Cannot continue.");
     }
-    if(SettleDelay < PollInterval){
-        YLOGWARN("Settle delay is shorter than polling interval. Files will be considered settled when first detected");
+    if(QueueDepth < 1){
+        throw std::invalid_argument("Queue depth is invalid. Cannot continue.");
     }
     const auto PollInterval_ms = static_cast<int64_t>(1000.0 * PollInterval);
     const auto wait = [PollInterval_ms](){
@@ -188,286 +241,279 @@ bool PollDirectories(Drover &DICOM_data,
         throw std::invalid_argument("No directories to poll. Cannot continue.");
     }
 
-    struct file_metadata {
-        //std::filesystem::file_time_type last_time;
-        std::chrono::time_point<std::chrono::steady_clock> last_time;
-        std::uintmax_t file_size = 0U;
+    directory_watcher watcher(watch_dirs, SettleDelay, watch_method);
+    if(watcher.uses_events()){
+        YLOGINFO("Watching for filesystem changes using change notifications");
+    }else{
+        YLOGINFO("Watching for filesystem changes using polling");
+        if(SettleDelay < PollInterval){
+            YLOGWARN("Settle delay is shorter than polling interval. Files will be considered settled when first detected");
+        }
+    }
 
-        bool present   = false; // File appeared in the most recent directory enumeration.
-        bool processed = false; // File has already been processed and should be ignored.
-        bool ready     = false; // File is ready to be processed, but could be waiting for sibling files to transit.
+    // When change notifications are used, the watcher wakes as needed, so there is no need to poll regularly.
+    const auto update_timeout = watcher.uses_events() ? std::chrono::milliseconds(60'000)
+                                                      : std::chrono::milliseconds(PollInterval_ms);
+
+    // The files are handled by a pipeline so that watching, loading, and processing can all proceed concurrently.
+    //
+    // The watcher thread assembles batches of settled files, the loader thread loads each batch into a separate
+    // Drover, and this thread merges the loaded files and performs the child operations. The queues are bounded so
+    // that loading cannot run arbitrarily far ahead of processing.
+    using batch_t = std::list<std::filesystem::path>;
+    bounded_queue<batch_t> batch_queue(static_cast<size_t>(QueueDepth));
+    bounded_queue<std::unique_ptr<Drover>> loaded_queue(static_cast<size_t>(QueueDepth));
+
+    std::mutex error_m;
+    std::exception_ptr error;
+    const auto stop = [&](){
+        watcher.interrupt();
+        batch_queue.close();
+        loaded_queue.close();
     };
-
-    // Cache uses parent directory and file path as keys, file metadata as values.
-    // Parent directory key is separate to facilitate easier access to all the files sharing a common parent directory.
-    using inner_cache_t = std::map<std::filesystem::path, file_metadata>;
-    using cache_t = std::map<std::filesystem::path, inner_cache_t>;
-    cache_t cache;
-    bool first_pass = true;
-    while(true){
-        if(!first_pass) wait();
-
-        // Reset the cache visibility for each entry.
-        for(auto& block : cache){
-            for(auto& p : block.second){
-                p.second.present = false;
-            }
+    const auto record_error = [&](std::exception_ptr e){
+        {
+            std::lock_guard<std::mutex> lock(error_m);
+            if(!error) error = e;
         }
+        stop();
+    };
 
-        // Enumerate the contents of the input directories.
+    std::thread watcher_thread([&](){
         try{
-            const auto t_start = std::chrono::system_clock::now();
-            for(const auto& d : watch_dirs){
-                for(const auto& e : std::filesystem::recursive_directory_iterator(d)){
-                    if(!e.exists() || e.is_directory()) continue;
-
-                    const auto f = e.path();
-                    const auto p = f.parent_path();
-                    const auto s = e.file_size();
-                    const auto now = std::chrono::steady_clock::now();
-
-                    // Ensure the subdirectory block exists.
-                    auto& subdir = cache[p];
-
-                    // Search for an existing entry in the subdirectory block.
-                    file_metadata* entry_ptr = nullptr;
-                    auto it = subdir.find(f);
-
-
-                    // If not yet seen, create an entry including relevant metadata.
-                    if(it == subdir.end()){ 
-                        subdir[f];
-                        it = subdir.find(f);
-                        entry_ptr = &(it->second);
-
-                        entry_ptr->file_size = s;
-                        entry_ptr->last_time = now;
-
-                        entry_ptr->present   = true;
-                        entry_ptr->processed = (IgnoreExisting && first_pass);
-                        entry_ptr->ready     = false;
+            using inner_cache_t = directory_watcher::inner_cache_t;
+            using cache_t = directory_watcher::cache_t;
+
+            bool first_pass = true;
+            uint64_t last_total_count = 0U;
+            uint64_t last_ready_count = 0U;
+            while(!watcher.is_interrupted()){
+                try{
+                    const auto t_start = std::chrono::system_clock::now();
+                    if(first_pass){
+                        watcher.rescan(IgnoreExisting);
+                    }else{
+                        watcher.update(update_timeout);
                     }
 
-                    // Mark the file as present.
-                    entry_ptr = &(it->second);
-                    entry_ptr->present = true;
-
-                    // If already processed, ignore.
-                    if( entry_ptr->processed == true ) continue;
-
-                    // Otherwise if size is still being modified, then reset the entry metadata.
-                    if( s != entry_ptr->file_size ){
-                        entry_ptr->file_size = s;
-                        entry_ptr->last_time = now;
+                    const auto t_stop = std::chrono::system_clock::now();
+                    const auto elapsed = std::chrono::duration<double>(t_stop - t_start).count();
+                    if( !watcher.uses_events()
+                    &&  ( (5.0 < elapsed) 
+                        ||  ((0.5 * PollInterval) < elapsed)
+                        ||  ((0.5 * SettleDelay) < elapsed) ) ){
+                        YLOGWARN("Directory enumeration took " << elapsed << " s");
+                    }
 
-                    // Otherwise check if the file is ready to be processed.
+                }catch(const std::exception &e){
+                    ++filesystem_error_count;
+                    YLOGWARN("Encountered error enumerating directory: '" << e.what() << "'");
+                    if(filesystem_error_count < max_filesystem_error_count){
+                        YLOGINFO("Filesystem error count: " << filesystem_error_count);
                     }else{
-                        //const std::chrono::duration<double> dt = (now - entry_ptr->last_time);
-                        const auto dt = std::chrono::duration<double>(now - entry_ptr->last_time).count();
-                        entry_ptr->ready = (s == entry_ptr->file_size) && (SettleDelay < dt);
+                        throw std::runtime_error("Exceeded maximum permissable filesystem error count. Cannot continue.");
                     }
-                }
-            }
-
-            const auto t_stop = std::chrono::system_clock::now();
-            const auto elapsed = std::chrono::duration<double>(t_stop - t_start).count();
-            if( (5.0 < elapsed) 
-            ||  ((0.5 * PollInterval) < elapsed)
-            ||  ((0.5 * SettleDelay) < elapsed) ){
-                YLOGWARN("Directory enumeration took " << elapsed << " s");
-            }
-
-            first_pass = false;
-
-        }catch(const std::exception &e){
-            ++filesystem_error_count;
-            YLOGWARN("Encountered error enumerating directory: '" << e.what() << "'");
-            if(filesystem_error_count < max_filesystem_error_count){
-                YLOGINFO("Filesystem error count: " << filesystem_error_count);
-            }else{
-                throw std::runtime_error("Exceeded maximum permissable filesystem error count. Cannot continue.");
-            }
-
-            // Sleep for the polling interval time.
-            wait();
-            continue;
-        }
 
-        // Purge any entries that are no longer visible.
-        for(auto& block : cache){
-            auto it = block.second.begin();
-            const auto end = block.second.end();
-            while(it != end){
-                if(!it->second.present){
-                    it = block.second.erase(it);
-                }else{
-                    ++it;
+                    // Sleep for the polling interval time.
+                    wait();
+                    continue;
                 }
-            }
-        }
-
-        // Remove any parent directories that are empty.
-        {
-            auto it = cache.begin();
-            const auto end = cache.end();
-            while(it != end){
-                if(it->second.empty()){
-                    it = cache.erase(it);
-                }else{
-                    ++it;
-                }
-            }
-        }
+                if(watcher.is_interrupted()) break;
+                auto &cache = watcher.files();
+
+                // Report on cache contents for monitoring / debugging.
+                {
+                    uint64_t total_count     = 0U;
+                    uint64_t processed_count = 0U;
+                    uint64_t ready_count     = 0U;
+                    uint64_t pending_count   = 0U;
+                    for(auto& block : cache){
+                        for(auto& p : block.second){
+                            ++total_count;
+                            if(p.second.processed){
+                                ++processed_count;
+                            }else if(p.second.ready){
+                                ++ready_count;
+                            }else{
+                                ++pending_count;
+                            }
+                        }
+                    }
 
-        // Report on cache contents for monitoring / debugging.
-        {
-            uint64_t total_count     = 0U;
-            uint64_t processed_count = 0U;
-            uint64_t ready_count     = 0U;
-            uint64_t pending_count   = 0U;
-            for(auto& block : cache){
-                for(auto& p : block.second){
-                    ++total_count;
-                    if(p.second.processed){
-                        ++processed_count;
-                    }else if(p.second.ready){
-                        ++ready_count;
-                    }else{
-                        ++pending_count;
+                    // Avoid repeatedly reporting when idle.
+                    if( first_pass
+                    ||  !watcher.uses_events()
+                    ||  (0U < pending_count)
+                    ||  (total_count != last_total_count)
+                    ||  (ready_count != last_ready_count) ){
+                        const auto now = std::chrono::system_clock::now();
+                        const std::time_t t_now = std::chrono::system_clock::to_time_t(now);
+                        YLOGINFO("Poll results: "
+                             << "(" << ygor::get_localtime_str(t_now) << ") "
+                             << "cache contains " << total_count << " entries -- "
+                             << pending_count << " pending, "
+                             << ready_count << " ready, and "
+                             << processed_count << " processed");
                     }
+                    last_total_count = total_count;
+                    last_ready_count = ready_count;
                 }
-            }
-            {
-                const auto now = std::chrono::system_clock::now();
-                const std::time_t t_now = std::chrono::system_clock::to_time_t(now);
-                YLOGINFO("Poll results: "
-                     << "(" << ygor::get_localtime_str(t_now) << ") "
-                     << "cache contains " << total_count << " entries -- "
-                     << pending_count << " pending, "
-                     << ready_count << " ready, and "
-                     << processed_count << " processed");
-            }
-        }
-
-        // If all files are ready to process, assemble batches for later processing.
-        // Prospectively mark the file as processed to avoid a second-pass later.
-        const auto is_unprocessed = [](const inner_cache_t::value_type& p){
-                                        return !(p.second.processed);
-                                    };
-        const auto is_ready = [](const inner_cache_t::value_type& p){
-                                  return !p.second.processed && p.second.ready;
-                              };
-        const auto is_processed_or_ready = [](const inner_cache_t::value_type& p){
-                                               return (p.second.processed) || p.second.ready;
-                                           };
-
-        const auto block_has_unprocessed = [is_unprocessed](const cache_t::value_type& block){
-                                        return std::any_of( std::begin(block.second),
-                                                            std::end(block.second),
-                                                            is_unprocessed );
-                                     };
-        const auto block_ready = [&](const cache_t::value_type& block){
-                                   return std::all_of( std::begin(block.second),
-                                                       std::end(block.second),
-                                                       is_processed_or_ready );
-                               };
-
-        std::list< std::list<std::filesystem::path> > to_process;
-
-        // Treat each subdirectory as a distinct logical group.
-        if( GroupBySubdirs ){
-            for(auto& block : cache){
-                if(!block_has_unprocessed(block)) continue; // Nothing to do.
-
-                if(block_ready(block)){
-                    to_process.emplace_back();
-                    for(auto& p : block.second){
-                        if(is_ready(p)){
-                            to_process.back().emplace_back(p.first);
-                            p.second.processed = true;
+                first_pass = false;
+
+                // If all files are ready to process, assemble batches for later processing.
+                // Prospectively mark the file as processed to avoid a second-pass later.
+                const auto is_unprocessed = [](const inner_cache_t::value_type& p){
+                                                return !(p.second.processed);
+                                            };
+                const auto is_ready = [](const inner_cache_t::value_type& p){
+                                          return !p.second.processed && p.second.ready;
+                                      };
+                const auto is_processed_or_ready = [](const inner_cache_t::value_type& p){
+                                                       return (p.second.processed) || p.second.ready;
+                                                   };
+
+                const auto block_has_unprocessed = [is_unprocessed](const cache_t::value_type& block){
+                                                return std::any_of( std::begin(block.second),
+                                                                    std::end(block.second),
+                                                                    is_unprocessed );
+                                             };
+                const auto block_ready = [&](const cache_t::value_type& block){
+                                           return std::all_of( std::begin(block.second),
+                                                               std::end(block.second),
+                                                               is_processed_or_ready );
+                                       };
+
+                std::list< batch_t > to_process;
+
+                // Treat each subdirectory as a distinct logical group.
+                if( GroupBySubdirs ){
+                    for(auto& block : cache){
+                        if(!block_has_unprocessed(block)) continue; // Nothing to do.
+
+                        if(block_ready(block)){
+                            to_process.emplace_back();
+                            for(auto& p : block.second){
+                                if(is_ready(p)){
+                                    to_process.back().emplace_back(p.first);
+                                    p.second.processed = true;
+                                }
+                            }
                         }
                     }
-                }
-            }
 
-        // Treat all files as a single logical group.
-        }else if( GroupAltogether ){
-            do{
-                const bool has_unprocessed = std::any_of( std::begin(cache),
-                                                          std::end(cache),
-                                                          [&](const cache_t::value_type& c){
-                                                              return block_has_unprocessed(c);
-                                                          });
-                if(!has_unprocessed) break; // Nothing to do.
-
-                const bool all_eligible_ready = std::all_of( std::begin(cache),
-                                                             std::end(cache),
-                                                             [&](const cache_t::value_type& c){
-                                                                 return block_ready(c);
-                                                             });
-                if(all_eligible_ready){
-                    to_process.emplace_back();
+                // Treat all files as a single logical group.
+                }else if( GroupAltogether ){
+                    do{
+                        const bool has_unprocessed = std::any_of( std::begin(cache),
+                                                                  std::end(cache),
+                                                                  [&](const cache_t::value_type& c){
+                                                                      return block_has_unprocessed(c);
+                                                                  });
+                        if(!has_unprocessed) break; // Nothing to do.
+
+                        const bool all_eligible_ready = std::all_of( std::begin(cache),
+                                                                     std::end(cache),
+                                                                     [&](const cache_t::value_type& c){
+                                                                         return block_ready(c);
+                                                                     });
+                        if(all_eligible_ready){
+                            to_process.emplace_back();
+                            for(auto& block : cache){
+                                for(auto& p : block.second){
+                                    if(is_ready(p)){
+                                        to_process.back().emplace_back(p.first);
+                                        p.second.processed = true;
+                                    }
+                                }
+                            }
+                        }
+                    }while(false);
+
+                // Consider all files spearate from one another.
+                }else if( GroupBySeparate ){
                     for(auto& block : cache){
                         for(auto& p : block.second){
                             if(is_ready(p)){
+                                to_process.emplace_back();
                                 to_process.back().emplace_back(p.first);
                                 p.second.processed = true;
                             }
                         }
                     }
                 }
-            }while(false);
-
-        // Consider all files spearate from one another.
-        }else if( GroupBySeparate ){
-            for(auto& block : cache){
-                for(auto& p : block.second){
-                    if(is_ready(p)){
-                        to_process.emplace_back();
-                        to_process.back().emplace_back(p.first);
-                        p.second.processed = true;
-                    }
+
+                // Hand off the batches. This will block if the downstream stages are busy.
+                for(auto& batch : to_process){
+                    if(!batch_queue.push(std::move(batch))) break;
                 }
             }
-
-        }else{
-            throw std::invalid_argument("Grouping argument not understood. Cannot continue.");
+        }catch(...){
+            record_error(std::current_exception());
         }
+        batch_queue.close();
+    });
 
-        // Process files in batches, one batch at a time (sequentially).
-        for(const auto& batch : to_process){
-            YLOGINFO("Processing a batch with " << batch.size() << " files");
-
-            // Load the files to a placeholder Drover class.
-            Drover DD_work;
-            std::map<std::string, std::string> placeholder_1;
-            std::list<OperationArgPkg> Operations;
-            {
-                std::list<std::filesystem::path> l_batch(batch);
-                const auto res = Load_Files(DD_work, placeholder_1, FilenameLex, Operations, l_batch);
+    std::thread loader_thread([&](){
+        try{
+            while(auto batch = batch_queue.pop()){
+                YLOGINFO("Loading a batch with " << batch.value().size() << " files");
+
+                // Load the files to a placeholder Drover class.
+                auto DD_work = std::make_unique<Drover>();
+                std::map<std::string, std::string> placeholder_1;
+                std::list<OperationArgPkg> Operations;
+                const auto res = Load_Files(*DD_work, placeholder_1, FilenameLex, Operations, batch.value());
                 if(!res){
                     throw std::runtime_error("Unable to load one or more files. Refusing to continue.");
                 }
+                if( !Operations.empty() ){
+                    YLOGWARN("Loaded one or more operations. Note that loaded operations will be ignored");
+                }
+
+                if(!loaded_queue.push(std::move(DD_work))) break;
             }
-            if( !Operations.empty() ){
-                YLOGWARN("Loaded one or more operations. Note that loaded operations will be ignored");
-            }
+        }catch(...){
+            record_error(std::current_exception());
+        }
+        loaded_queue.close();
+    });
+
+    const auto join = [&](){
+        stop();
+        watcher_thread.join();
+        loader_thread.join();
+    };
+
+    // Process the loaded batches sequentially, in the order they were received.
+    bool children_succeeded = true;
+    try{
+        while(auto DD_work = loaded_queue.pop()){
+            YLOGINFO("Processing a loaded batch");
 
             // Merge the loaded files into the current Drover class.
-            DICOM_data.Consume(DD_work);
+            DICOM_data.Consume(std::move(*(DD_work.value())));
 
             auto children = OptArgs.getChildren();
             if(!children.empty()){
                 const auto res = Operation_Dispatcher(DICOM_data, InvocationMetadata, FilenameLex, children);
                 if(!res){
-                    return false;
+                    children_succeeded = false;
+                    break;
                 }
             }
         }
+    }catch(...){
+        join();
+        throw;
+    }
+    join();
 
-        // Optionally remove all processed files from input directories.
-        // ... could be quite dangerous / easy to cause data loss.
+    if(error){
+        std::rethrow_exception(error);
     }
 
-    return true;
+    // Optionally remove all processed files from input directories.
+    // ... could be quite dangerous / easy to cause data loss.
+
+    return children_succeeded;
 }
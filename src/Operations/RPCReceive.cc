@@ -1,6 +1,7 @@
 //RPCReceive.cc - A part of DICOMautomaton 2023. Written by hal clark.
 
 #include <any>
+#include <filesystem>
 #include <optional>
 #include <functional>
 #include <iterator>
@@ -24,6 +25,7 @@
 #include "../Regex_Selectors.h"
 #include "../Operation_Dispatcher.h"
 #include "../Script_Loader.h"
+#include "../File_Loader.h"
 
 #ifndef DCMA_USE_THRIFT
     #error "Attempted to compile RPC server without Apache Thrift, which is required"
@@ -46,8 +48,11 @@ using namespace ::apache::thrift::transport;
 using namespace ::apache::thrift::server;
 
 class ReceiverHandler : virtual public ::dcma::rpc::ReceiverIf {
+  private:
+    bool allow_load_files;
+
   public:
-    ReceiverHandler() {
+    explicit ReceiverHandler(bool allow_load_files) : allow_load_files(allow_load_files) {
         YLOGINFO("RPC initialization complete, awaiting procedure calls");
     }
 
@@ -99,9 +104,69 @@ class ReceiverHandler : virtual public ::dcma::rpc::ReceiverIf {
         YLOGINFO("GetSupportedOperations procedure completed");
     }
 
+    void GetProtocolInfo(::dcma::rpc::ProtocolInfo& _return,
+                         const ::dcma::rpc::ProtocolQuery& query) {
+        YLOGINFO("GetProtocolInfo procedure invoked by client supporting protocol revision " << query.client_version);
+        _return = Get_Protocol_Info();
+        YLOGINFO("GetProtocolInfo procedure completed");
+    }
+
     void LoadFiles(::dcma::rpc::LoadFilesResponse& _return,
                    const std::vector<::dcma::rpc::LoadFilesQuery> & server_filenames) {
         YLOGINFO("LoadFiles procedure invoked");
+
+        // Clients are permitted to read any file the server can, so this must be explicitly enabled.
+        if(!this->allow_load_files){
+            YLOGWARN("Refusing to load files because the LoadFiles procedure is not enabled");
+            Serialize(false, _return.success);
+            return;
+        }
+
+        // Load all files into a single Drover, mirroring the LoadFiles operation.
+        ::Drover l_DICOM_data;
+        ::metadata_map_t l_InvocationMetadata;
+        const std::string l_FilenameLex;
+        std::list<std::filesystem::path> l_Paths;
+        for(const auto& q : server_filenames){
+            l_Paths.emplace_back(q.server_filename);
+        }
+
+        bool l_ret = false;
+        try{
+            ::Drover l_DD_work;
+            std::list<OperationArgPkg> l_ops;
+            l_ret = Load_Files(l_DD_work, l_InvocationMetadata, l_FilenameLex, l_ops, l_Paths);
+            l_DICOM_data.Consume(l_DD_work);
+
+            // Scripts loaded alongside the files are executed locally, as they would be by the LoadFiles operation.
+            if( l_ret
+            &&  !l_ops.empty() ){
+                l_ret = Operation_Dispatcher(l_DICOM_data, l_InvocationMetadata, l_FilenameLex, l_ops);
+            }
+        }catch(const std::exception &e){
+            YLOGWARN("Loading files failed: '" << e.what() << "'");
+            l_ret = false;
+        }
+        if(!l_ret){
+            YLOGWARN("Unable to load one or more files");
+        }
+
+        // Serialize the outputs.
+        YLOGINFO("Serializing state");
+        Serialize(l_ret, _return.success);
+        // Clients that did not request a response encoding receive protocol revision 1 payloads.
+        ::dcma::rpc::bulk_encoding l_enc;
+        if( !server_filenames.empty()
+        &&  server_filenames.front().__isset.response_encoding ){
+            const auto &req = server_filenames.front().response_encoding;
+            l_enc = Negotiate_Bulk_Encoding(req.protocol_version,
+                                            Get_Protocol_Info().compressions,
+                                            req.compression);
+        }
+        if(l_ret){
+            Serialize(l_DICOM_data, _return.drover, l_enc);
+            _return.__isset.drover = true;
+        }
         YLOGINFO("LoadFiles procedure completed");
     }
 
@@ -144,7 +209,14 @@ class ReceiverHandler : virtual public ::dcma::rpc::ReceiverIf {
         // Serialize the outputs.
         YLOGINFO("Serializing state");
         Serialize(l_ret, _return.success);
-        Serialize(l_DICOM_data, _return.drover);
+        // Clients that did not request a response encoding receive protocol revision 1 payloads.
+        ::dcma::rpc::bulk_encoding l_enc;
+        if(query.__isset.response_encoding){
+            l_enc = Negotiate_Bulk_Encoding(query.response_encoding.protocol_version,
+                                            Get_Protocol_Info().compressions,
+                                            query.response_encoding.compression);
+        }
+        Serialize(l_DICOM_data, _return.drover, l_enc);
         Serialize(l_InvocationMetadata, _return.invocation_metadata);
         Serialize(l_FilenameLex, _return.filename_lex);
         YLOGINFO("ExecuteScript procedure completed");
@@ -174,6 +246,16 @@ OperationDoc OpArgDocRPCReceive(){
     out.args.back().expected = true;
     out.args.back().examples = { "13", "8080", "9090", "16378" };
 
+    out.args.emplace_back();
+    out.args.back().name = "AllowLoadFiles";
+    out.args.back().desc = "Controls whether clients can invoke the LoadFiles procedure, which loads files from the"
+                           " server's filesystem and returns their contents. Any file the server can read will be"
+                           " accessible to clients, so this should only be enabled on trusted networks.";
+    out.args.back().default_val = "false";
+    out.args.back().expected = true;
+    out.args.back().examples = { "true", "false" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -186,11 +268,18 @@ bool RPCReceive(Drover & /*DICOM_data*/,
 
     //---------------------------------------------- User Parameters --------------------------------------------------
     const auto Port = std::stol( OptArgs.getValueStr("Port").value() );
+    const auto AllowLoadFilesStr = OptArgs.getValueStr("AllowLoadFiles").value();
     //-----------------------------------------------------------------------------------------------------------------
 
+    const auto regex_true = Compile_Regex("^tr?u?e?$");
+    const auto AllowLoadFiles = std::regex_match(AllowLoadFilesStr, regex_true);
+    if(AllowLoadFiles){
+        YLOGWARN("Clients will be able to load any file this server can read");
+    }
+
     //using namespace ::dcma::rpc;
 
-    auto handler = std::make_shared<ReceiverHandler>();
+    auto handler = std::make_shared<ReceiverHandler>(AllowLoadFiles);
     auto processor = std::make_shared<::dcma::rpc::ReceiverProcessor>(handler);
 
     auto transport_server = std::make_shared<TServerSocket>( Port );
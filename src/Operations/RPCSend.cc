@@ -27,6 +27,7 @@
     #error "Attempted to compile RPC client without Apache Thrift, which is required"
 #endif //DCMA_USE_THRIFT
 
+#include <thrift/TApplicationException.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TBufferTransports.h>
 #include <thrift/protocol/TBinaryProtocol.h>
@@ -70,6 +71,17 @@ OperationDoc OpArgDocRPCSend(){
     out.args.back().expected = true;
     out.args.back().examples = { "localhost", "127.0.0.1" };
 
+    out.args.emplace_back();
+    out.args.back().name = "Compression";
+    out.args.back().desc = "Controls whether bulk numerical arrays (e.g., image pixels, mesh vertices) are compressed"
+                           " when both sides support protocol revision 2, which transfers them as packed binary blobs."
+                           " Compression reduces the wire size, but costs some CPU time on each side."
+                           " Remotes that only support protocol revision 1 are always sent uncompressed legacy payloads.";
+    out.args.back().default_val = "none";
+    out.args.back().expected = true;
+    out.args.back().examples = { "none", "zlib" };
+    out.args.back().samples = OpArgSamples::Exhaustive;
+
     return out;
 }
 
@@ -82,7 +94,19 @@ bool RPCSend(Drover &DICOM_data,
     //---------------------------------------------- User Parameters --------------------------------------------------
     const auto Port = std::stol( OptArgs.getValueStr("Port").value() );
     const auto Host = OptArgs.getValueStr("Host").value();
+    const auto CompressionStr = OptArgs.getValueStr("Compression").value();
     //-----------------------------------------------------------------------------------------------------------------
+    const auto regex_none = Compile_Regex("^no?n?e?$");
+    const auto regex_zlib = Compile_Regex("^zl?i?b?$");
+
+    auto preferred_compression = ::dcma::rpc::bulk_compression::UNCOMPRESSED;
+    if(std::regex_match(CompressionStr, regex_none)){
+        preferred_compression = ::dcma::rpc::bulk_compression::UNCOMPRESSED;
+    }else if(std::regex_match(CompressionStr, regex_zlib)){
+        preferred_compression = ::dcma::rpc::bulk_compression::ZLIB;
+    }else{
+        throw std::invalid_argument("Compression argument not understood");
+    }
 
     std::shared_ptr<TTransport> transport;
     //auto transport = std::make_shared<TTransport>();
@@ -96,6 +120,22 @@ bool RPCSend(Drover &DICOM_data,
     try{
         transport->open();
 
+        // Negotiate the protocol revision. Remotes predating revision 2 do not implement GetProtocolInfo, so they are
+        // sent legacy payloads.
+        ::dcma::rpc::bulk_encoding enc;
+        try{
+            ::dcma::rpc::ProtocolInfo info;
+            ::dcma::rpc::ProtocolQuery q;
+            q.client_version = dcma_rpc_protocol_version;
+            client.GetProtocolInfo(info, q);
+            enc = Negotiate_Bulk_Encoding(info.server_version, info.compressions, preferred_compression);
+        }catch(const TApplicationException &e){
+            if(e.getType() != TApplicationException::UNKNOWN_METHOD) throw;
+            YLOGINFO("Remote does not support protocol negotiation, falling back to protocol revision 1");
+        }
+        YLOGINFO("Using protocol revision " << enc.protocol_version
+                 << " with bulk array compression '" << ::dcma::rpc::to_string(enc.compression) << "'");
+
         // Enumerate the supported operations.
         {
             std::vector<::dcma::rpc::KnownOperation> known_ops;
@@ -121,10 +161,11 @@ bool RPCSend(Drover &DICOM_data,
 //      3: required string filename_lex;
 //  }
             YLOGINFO("Serializing Drover state");
-            Serialize(DICOM_data, q.drover);
+            Serialize(DICOM_data, q.drover, enc);
             Serialize(InvocationMetadata, q.invocation_metadata);
             Serialize(FilenameLex, q.filename_lex);
             std::string script = "noop();";
+            q.__set_response_encoding(enc);
 
             YLOGINFO("Issuing remote procedure call");
             ::dcma::rpc::ExecuteScriptResponse r;
@@ -193,6 +193,38 @@ OperationDoc OpArgDocRegisterImagesDemons(){
     out.args.back().expected = true;
     out.args.back().examples = { "1.0", "2.0", "5.0", "10.0" };
 
+    out.args.emplace_back();
+    out.args.back().name = "PyramidLevels";
+    out.args.back().desc = "The number of levels in a coarse-to-fine Gaussian image pyramid."
+                           " A value of 1 registers at full resolution only."
+                           " Each additional level halves the resolution along every axis with at least 8 voxels."
+                           " Registration begins at the coarsest level, and the resulting deformation field is"
+                           " upsampled to initialize the next finer level."
+                           " Coarse levels are inexpensive and capture large deformations, which improves"
+                           " convergence and reduces the number of costly full-resolution iterations.";
+    out.args.back().default_val = "1";
+    out.args.back().expected = true;
+    out.args.back().examples = { "1", "2", "3", "4" };
+
+    out.args.emplace_back();
+    out.args.back().name = "PyramidIterations";
+    out.args.back().desc = "A comma-separated list of the maximum number of iterations to perform at each pyramid"
+                           " level, ordered from the coarsest to the finest level."
+                           " Levels without an entry use MaxIterations."
+                           " Generally, more iterations should be used at coarse levels where they are inexpensive.";
+    out.args.back().default_val = "";
+    out.args.back().expected = false;
+    out.args.back().examples = { "200,100,50", "100,50", "400,200,100,25" };
+
+    out.args.emplace_back();
+    out.args.back().name = "PyramidSmoothingSigmas";
+    out.args.back().desc = "A comma-separated list of deformation field smoothing sigmas (in DICOM units, mm)"
+                           " to use at each pyramid level, ordered from the coarsest to the finest level."
+                           " Levels without an entry use DeformationFieldSmoothingSigma.";
+    out.args.back().default_val = "";
+    out.args.back().expected = false;
+    out.args.back().examples = { "4.0,2.0,1.0", "2.0,1.0" };
+
     out.args.emplace_back();
     out.args.back().name = "Verbosity";
     out.args.back().desc = "Verbosity level for logging intermediate results."
@@ -248,6 +280,9 @@ bool RegisterImagesDemons(Drover &DICOM_data,
     const auto HistogramOutlierFraction = std::stod(OptArgs.getValueStr("HistogramOutlierFraction").value());
     const auto NormalizationFactor = std::stod(OptArgs.getValueStr("NormalizationFactor").value());
     const auto MaxUpdateMagnitude = std::stod(OptArgs.getValueStr("MaxUpdateMagnitude").value());
+    const auto PyramidLevels = std::stol(OptArgs.getValueStr("PyramidLevels").value());
+    const auto PyramidIterationsOpt = OptArgs.getValueStr("PyramidIterations");
+    const auto PyramidSmoothingSigmasOpt = OptArgs.getValueStr("PyramidSmoothingSigmas");
     const auto Verbosity = std::stol(OptArgs.getValueStr("Verbosity").value());
     const auto TransformName = OptArgs.getValueStr("TransformName").value();
     const auto MetadataOpt = OptArgs.getValueStr("Metadata");
@@ -261,6 +296,11 @@ bool RegisterImagesDemons(Drover &DICOM_data,
     const bool UseHistogramMatching = std::regex_match(UseHistogramMatchingStr, regex_true);
     const bool KeepDeformedImages = std::regex_match(KeepDeformedImagesStr, regex_true);
 
+    if(PyramidLevels < 1){
+        throw std::invalid_argument("PyramidLevels must be at least 1 (got "_s + std::to_string(PyramidLevels)
+                                    + "). Cannot continue.");
+    }
+
     // Parse user-provided metadata.
     std::map<std::string, std::string> Metadata;
     if(MetadataOpt){
@@ -330,6 +370,17 @@ bool RegisterImagesDemons(Drover &DICOM_data,
     params.histogram_outlier_fraction = HistogramOutlierFraction;
     params.normalization_factor = NormalizationFactor;
     params.max_update_magnitude = MaxUpdateMagnitude;
+    params.pyramid_levels = PyramidLevels;
+    if(PyramidIterationsOpt){
+        for(const auto &t : SplitStringToVector(PyramidIterationsOpt.value(), ',', 'd')){
+            if(!t.empty()) params.pyramid_iterations.emplace_back( std::stol(t) );
+        }
+    }
+    if(PyramidSmoothingSigmasOpt){
+        for(const auto &t : SplitStringToVector(PyramidSmoothingSigmasOpt.value(), ',', 'd')){
+            if(!t.empty()) params.pyramid_smoothing_sigmas.emplace_back( std::stod(t) );
+        }
+    }
     params.verbosity = Verbosity;
 
     // Perform the registration.
@@ -356,6 +407,7 @@ bool RegisterImagesDemons(Drover &DICOM_data,
     transform->metadata["UseHistogramMatching"] = UseHistogramMatching ? "true" : "false";
     transform->metadata["MaxIterations"] = std::to_string(MaxIterations);
     transform->metadata["DeformationFieldSmoothingSigma"] = std::to_string(DeformationFieldSmoothingSigma);
+    transform->metadata["PyramidLevels"] = std::to_string(PyramidLevels);
 
     // Add to the Drover.
     DICOM_data.trans_data.emplace_back(transform);
@@ -80,6 +80,7 @@
 #include "../Font_DCMA_Minimal.h"
 #include "../DCMA_Version.h"
 #include "../File_Loader.h"
+#include "../Imebra_Shim.h"
 #include "../Script_Loader.h"
 #include "../Standard_Scripts.h"
 #include "../Standard_Guides.h"
@@ -3007,6 +3008,7 @@ bool SDL_Viewer(Drover &DICOM_data,
         std::list<OperationArgPkg> Operations;
         try{
             lfs.res = Load_Files(lfs.DICOM_data, lfs.InvocationMetadata, FilenameLex, Operations, paths);
+            Materialize_Image_Pixels(lfs.DICOM_data.image_data); // The viewer accesses pixel data directly.
             if(!Operations.empty()){
                  lfs.res = false;
                  YLOGWARN("Loaded file contains a script. Currently unable to handle script files here");
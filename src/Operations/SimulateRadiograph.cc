@@ -22,6 +22,7 @@
 #include <utility>            //Needed for std::pair.
 #include <algorithm>
 #include <optional>
+#include <cctype>
 
 #include "YgorMisc.h"         //Needed for FUNCINFO, FUNCWARN, FUNCERR macros.
 #include "YgorLog.h"
@@ -52,6 +53,81 @@
 #include "SimulateRadiograph.h"
 
 
+namespace {
+
+// Attenuation coefficients for a regular image array, stored in cubic bricks.
+//
+// Rays cross the volume at arbitrary angles, so consecutive samples along a ray (and samples from neighbouring rays)
+// are close in all three dimensions. Storing small cubes contiguously keeps these samples within a few cache lines,
+// whereas a slice-by-slice layout would touch a different image for nearly every step along oblique rays.
+struct radiograph_attenuation_volume {
+    static constexpr int64_t brick_edge_log2 = 3;
+    static constexpr int64_t brick_edge = (1L << brick_edge_log2);
+    static constexpr int64_t brick_mask = brick_edge - 1L;
+    static constexpr int64_t brick_size = brick_edge * brick_edge * brick_edge;
+
+    int64_t N_rows = 0;
+    int64_t N_cols = 0;
+    int64_t N_imgs = 0;
+
+    int64_t B_rows = 0; // Number of bricks along each axis.
+    int64_t B_cols = 0;
+    int64_t B_imgs = 0;
+
+    std::vector<float> coeffs;
+
+    radiograph_attenuation_volume(planar_image_adjacency<float,double> &img_adj,
+                                  int64_t channel){
+        const auto &first_img = img_adj.index_to_image(0).get();
+        this->N_rows = first_img.rows;
+        this->N_cols = first_img.columns;
+        this->N_imgs = static_cast<int64_t>(img_adj.int_to_img.size());
+
+        this->B_rows = (this->N_rows + brick_mask) >> brick_edge_log2;
+        this->B_cols = (this->N_cols + brick_mask) >> brick_edge_log2;
+        this->B_imgs = (this->N_imgs + brick_mask) >> brick_edge_log2;
+        this->coeffs.resize(static_cast<size_t>(this->B_rows * this->B_cols * this->B_imgs * brick_size), 0.0f);
+
+        for(int64_t k = 0; k < this->N_imgs; ++k){
+            const auto &img = img_adj.index_to_image(k).get();
+            for(int64_t i = 0; i < this->N_rows; ++i){
+                for(int64_t j = 0; j < this->N_cols; ++j){
+                    const auto voxel_val = img.value(i, j, channel);
+
+                    // Ficticious mass density encountered by the ray.
+                    const auto intensity = (voxel_val < -1000.0f) ? -1000.0f : voxel_val; // Enforce physicality.
+                    this->coeffs[this->index(i, j, k)] = 1.0f + (intensity / 1000.0f);
+                }
+            }
+        }
+    }
+
+    size_t index(int64_t i, int64_t j, int64_t k) const {
+        const auto brick = ((k >> brick_edge_log2) * this->B_rows + (i >> brick_edge_log2)) * this->B_cols
+                         + (j >> brick_edge_log2);
+        const auto within = ((k & brick_mask) * brick_edge + (i & brick_mask)) * brick_edge + (j & brick_mask);
+        return static_cast<size_t>(brick * brick_size + within);
+    }
+
+    float attenuation_coeff(int64_t i, int64_t j, int64_t k) const {
+        return this->coeffs[this->index(i, j, k)];
+    }
+};
+
+// The geometry of a single simulated radiograph.
+struct radiograph_projection {
+    vec3<double> ray_source;
+    bool ray_source_is_within_image_volume = false;
+
+    planar_image_collection<float,double> sd_image_collection;
+    planar_image<float,double> *DetectImg = nullptr;
+    planar_image<float,double> *OrthoSrcImg = nullptr;
+    plane<double> detector_plane;
+};
+
+} // namespace
+
+
 
 OperationDoc OpArgDocSimulateRadiograph(){
     OperationDoc out;
@@ -91,7 +167,9 @@ OperationDoc OpArgDocSimulateRadiograph(){
     out.args.emplace_back();
     out.args.back().name = "Filename";
     out.args.back().desc = "The filename (or full path) to which the simulated image will be saved to."
-                           " The format is FITS. Leaving empty will result in a unique name being generated.";
+                           " The format is FITS. Leaving empty will result in a unique name being generated."
+                           " When multiple radiographs are simulated, a sequential number is inserted before the"
+                           " file extension.";
     out.args.back().default_val = "";
     out.args.back().expected = true;
     out.args.back().examples = { "", "./img.fits", "sim_radiograph.fits", "/tmp/out.fits" };
@@ -107,11 +185,19 @@ OperationDoc OpArgDocSimulateRadiograph(){
                            " A source located relative to the image centre by offset (10.0, -23.4, 45.6) in the DICOM"
                            " coordinate system of a given image can be specified as 'relative(10.0, -23.4, 45.6)'."
                            " Relative offsets must be specified relative to the image centre."
+                           " A series of sources can be specified as 'arc(10.0, -23.4, 45.6, 36)', which rotates the"
+                           " relative offset (10.0, -23.4, 45.6) around the image centre in 36 equal steps, where the"
+                           " axis of rotation is orthogonal to the images."
+                           " Multiple specifications can be separated by ';'."
+                           " One radiograph is simulated for every source, and all radiographs are simulated together"
+                           " so the image volume only needs to be prepared once."
                            " Note that DICOM units (i.e., mm) are used for all coordinates.";
     out.args.back().default_val = "relative(0.0, 1000.0, 20.0)";
     out.args.back().expected = true;
     out.args.back().examples = { "relative(0.0, 1610.0, 20.0)",
-                                 "absolute(-123.0, 123.0, 1.23)" };
+                                 "absolute(-123.0, 123.0, 1.23)",
+                                 "relative(0.0, 1000.0, 0.0); relative(1000.0, 0.0, 0.0)",
+                                 "arc(0.0, 1000.0, 20.0, 36)" };
 
 
     out.args.emplace_back();
@@ -189,7 +275,7 @@ bool SimulateRadiograph(Drover &DICOM_data,
     //---------------------------------------------- User Parameters --------------------------------------------------
     const auto ImageSelectionStr = OptArgs.getValueStr("ImageSelection").value();
 
-    auto FilenameStr = OptArgs.getValueStr("Filename").value();
+    const auto FilenameStr = OptArgs.getValueStr("Filename").value();
 
     const auto SourcePositionStr = OptArgs.getValueStr("SourcePosition").value();
 
@@ -205,43 +291,59 @@ bool SimulateRadiograph(Drover &DICOM_data,
 
     const auto regex_rel = Compile_Regex("^re?l?a?t?i?v?e?.*$");
     const auto regex_abs = Compile_Regex("^ab?s?o?l?u?t?e?.*$");
+    const auto regex_arc = Compile_Regex("^arc.*$");
 
     const auto regex_mudl = Compile_Regex("^at?t?e?n?u?a?t?i?o?n?[-_]?l?e?n?g?t?h?$");
     const auto regex_exp = Compile_Regex("^expo?n?e?n?t?i?a?l?$");
 
-    const bool spos_is_relative = std::regex_match(SourcePositionStr, regex_rel);
-    const bool spos_is_absolute = std::regex_match(SourcePositionStr, regex_abs);
-
     const bool imgmodel_is_mudl = std::regex_match(ImageModelStr, regex_mudl);
     const bool imgmodel_is_exp  = std::regex_match(ImageModelStr, regex_exp);
-
-    const vec3<double> vec3_nan( std::numeric_limits<double>::quiet_NaN(),
-                                 std::numeric_limits<double>::quiet_NaN(),
-                                 std::numeric_limits<double>::quiet_NaN() );
     //-----------------------------------------------------------------------------------------------------------------
     const auto machine_eps = std::sqrt( 10.0 * std::numeric_limits<double>::epsilon() );
 
-    vec3<double> source_position = vec3_nan;
-    {
-        auto split = SplitStringToVector(SourcePositionStr, '(', 'd');
+    // Parse the source position specifications. Each resulting source position produces one radiograph.
+    struct source_spec_t {
+        enum class kind_t { relative, absolute, arc } kind;
+        std::vector<double> numbers;
+    };
+    std::vector<source_spec_t> source_specs;
+    for(auto spec : SplitStringToVector(SourcePositionStr, ';', 'd')){
+        spec.erase( std::begin(spec), std::find_if( std::begin(spec), std::end(spec),
+                                                    [](unsigned char c){ return !std::isspace(c); } ) );
+        if(spec.empty()) continue;
+
+        auto split = SplitStringToVector(spec, '(', 'd');
         split = SplitVector(split, ')', 'd');
         split = SplitVector(split, ',', 'd');
 
-        std::vector<double> numbers;
+        source_specs.emplace_back();
         for(const auto &w : split){
            try{
                const auto x = std::stod(w);
-               numbers.emplace_back(x);
+               source_specs.back().numbers.emplace_back(x);
            }catch(const std::exception &){ }
         }
-        if(numbers.size() != 3){
-            throw std::invalid_argument("Unable to parse grid/cube shape parameters. Cannot continue.");
-        }
 
-        source_position = vec3<double>( numbers.at(0),
-                                        numbers.at(1),
-                                        numbers.at(2) );
-        if(!source_position.isfinite()) throw std::invalid_argument("Source position invalid.");
+        size_t expected_numbers = 3;
+        if(std::regex_match(spec, regex_arc)){
+            source_specs.back().kind = source_spec_t::kind_t::arc;
+            expected_numbers = 4;
+        }else if(std::regex_match(spec, regex_rel)){
+            source_specs.back().kind = source_spec_t::kind_t::relative;
+        }else if(std::regex_match(spec, regex_abs)){
+            source_specs.back().kind = source_spec_t::kind_t::absolute;
+        }else{
+            throw std::invalid_argument("Source position specification not understood. Cannot continue.");
+        }
+        if(source_specs.back().numbers.size() != expected_numbers){
+            throw std::invalid_argument("Unable to parse source position parameters. Cannot continue.");
+        }
+        for(const auto &x : source_specs.back().numbers){
+            if(!std::isfinite(x)) throw std::invalid_argument("Source position invalid.");
+        }
+    }
+    if(source_specs.empty()){
+        throw std::invalid_argument("No source positions provided. Cannot continue.");
     }
 
     auto IAs_all = All_IAs( DICOM_data );
@@ -261,6 +363,9 @@ bool SimulateRadiograph(Drover &DICOM_data,
     }
 
 
+    //------------------------
+    // Preprocess the image volume. This is shared by all radiographs.
+
     // Ensure the image array is regular. (This will allow us to use a faster postion-to-image lookup.)
     {
         std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs;
@@ -294,37 +399,7 @@ bool SimulateRadiograph(Drover &DICOM_data,
     const auto N_cols = static_cast<int64_t>(img_arr_ptr->imagecoll.images.front().columns);
     const auto N_imgs = static_cast<int64_t>(img_adj.int_to_img.size());
 
-    // Determine an appropriate radiograph orientation.
     const auto img_centre = img_arr_ptr->imagecoll.center(); // TODO: For TBI, should be at the t0 point (i.e., at the level of the lung).
-    auto ray_source = vec3_nan;
-    if(spos_is_relative){
-        ray_source = img_centre + source_position;  // Should be relative to voxel at (0,0,0), not image centre.
-    }else if(spos_is_absolute){
-        ray_source = source_position;
-    }else{
-        throw std::logic_error("Unknown option. Cannot continue.");
-    }
-    if(ray_source.distance(img_centre) < machine_eps){
-        throw std::invalid_argument("Ray source point cannot coincide with image centre. Refusing to continue.");
-    }
-    const line<double> source_centre_line(ray_source, img_centre); 
-
-    // Determine which way will be 'up' in the radiograph.
-    const auto ray_unit = (img_centre - ray_source).unit();
-    auto rg_up = img_unit;
-    auto rg_left = rg_up.Cross(ray_unit).unit();
-    if(!ray_unit.GramSchmidt_orthogonalize(rg_up, rg_left)){
-        throw std::invalid_argument("Cannot orthogonalize radiograph orientation unit vectors. Cannot continue.");
-    }
-    rg_up = rg_up.unit() * -1.0;
-    rg_left = rg_left.unit() * -1.0;
-
-    YLOGINFO("Proceeding with radiograph into-plane orientation unit vector: " << ray_unit);
-    YLOGINFO("Proceeding with radiograph leftward orientation unit vector: " << rg_left);
-    YLOGINFO("Proceeding with radiograph upward orientation unit vector: " << rg_up);
-    YLOGINFO("Proceeding with ray source at: " << ray_source);
-    YLOGINFO("Proceeding with image centre at: " << img_centre);
-    YLOGINFO("Proceeding with ray source - image centre line: " << source_centre_line);
 
     // Confirm the bounding planes are all correctly oriented.
     for(const auto & img_bp : img_bps){
@@ -337,15 +412,8 @@ bool SimulateRadiograph(Drover &DICOM_data,
         throw std::logic_error("Incorrect number of bounding planes provided. Cannot continue.");
     }
 
-    // Pre-compute whether the ray source position is bounded within the image volume.
-    bool ray_source_is_within_image_volume = false;
-    {
-        int64_t N_bounds = 0;
-        for(const auto & img_bp : img_bps){
-            N_bounds += (img_bp.Is_Point_Above_Plane(ray_source)) ? 1L : 0L;
-        }
-        ray_source_is_within_image_volume = (N_bounds == 6);
-    }
+    // Convert CT numbers to attenuation coefficients once, in a layout suited to ray marching.
+    const radiograph_attenuation_volume att_vol(img_adj, Channel);
 
     // Encode the image geometry as contours for volumetric bounds determination.
     contour_collection<double> cc;
@@ -362,268 +430,385 @@ bool SimulateRadiograph(Drover &DICOM_data,
     std::list<std::reference_wrapper<contour_collection<double>>> cc_ROIs = { std::ref(cc) };
 
     //------------------------
-    // Create a detector that will encompass the images.
-    //
-    // Note: We are generous here because the source is a single point. The image projection will therefore be
-    //       magnified. If the source is too close the projection will 
-    double grid_x_margin = 5.0;
-    double grid_y_margin = 5.0;
-    double grid_z_margin = 5.0;
-
-    //Generate a grid volume bounding the ROI(s). We ask for many images in order to compress the pxl_dz taken by each.
-    // Only two are actually allocated.
-    const auto NumberOfPanelImages = 1000L;
-    auto sd_image_collection = Symmetrically_Contiguously_Grid_Volume<float,double>(
-             cc_ROIs, 
-             grid_x_margin, grid_y_margin, grid_z_margin,
-             RadiographRows, RadiographColumns, /*number_of_channels=*/ 1, NumberOfPanelImages, 
-             source_centre_line, rg_left, (rg_up * -1.0),
-             /*pixel_fill=*/ 0.0, 
-             /*only_top_and_bottom=*/ true);
-
-    //Get handles for each image.
-    planar_image<float, double> *DetectImg = &(*std::next(sd_image_collection.images.begin(),0));
-    planar_image<float, double> *OrthoSrcImg = &(*std::next(sd_image_collection.images.begin(),1));
-
-    // Confirm the detector image is oriented correctly.
-    //
-    // Note: the detector will always be on the opposite side of the image centre compared with the source point
-    // (i.e., the source will always points towards the image centre).
-    {
-        const auto dICSP = img_centre - source_position;
-        const auto dDPIC = DetectImg->center() - img_centre;
-        if(dICSP.Dot(dDPIC) < 0.0){
-            std::swap(DetectImg, OrthoSrcImg);
+    // Determine the ray source positions.
+    std::vector<vec3<double>> ray_sources;
+    for(const auto &spec : source_specs){
+        const vec3<double> v( spec.numbers.at(0),
+                              spec.numbers.at(1),
+                              spec.numbers.at(2) );
+        if(spec.kind == source_spec_t::kind_t::relative){
+            ray_sources.emplace_back( img_centre + v );  // Should be relative to voxel at (0,0,0), not image centre.
+
+        }else if(spec.kind == source_spec_t::kind_t::absolute){
+            ray_sources.emplace_back( v );
+
+        }else if(spec.kind == source_spec_t::kind_t::arc){
+            // Rotate the relative offset around the axis through the image centre that is orthogonal to the images,
+            // using equally-spaced angles over a full revolution.
+            const auto N_arc = static_cast<int64_t>( std::round(spec.numbers.at(3)) );
+            if(N_arc < 1){
+                throw std::invalid_argument("Arcs must contain at least one source position. Cannot continue.");
+            }
+            for(int64_t n = 0; n < N_arc; ++n){
+                const auto angle = 2.0 * std::acos(-1.0) * static_cast<double>(n) / static_cast<double>(N_arc);
+                const auto c = std::cos(angle);
+                const auto s = std::sin(angle);
+                const auto v_rot = v * c + img_unit.Cross(v) * s + img_unit * (img_unit.Dot(v) * (1.0 - c));
+                ray_sources.emplace_back( img_centre + v_rot );
+            }
+        }else{
+            throw std::logic_error("Unknown option. Cannot continue.");
         }
     }
+    YLOGINFO("Simulating " << ray_sources.size() << " radiograph(s)");
 
-    DetectImg->metadata["Description"] = "Virtual radiograph detector";
-    OrthoSrcImg->metadata["Description"] = "(unused)";
+    //------------------------
+    // Create a detector for each ray source.
+    std::list<radiograph_projection> projections;
+    for(const auto &ray_source : ray_sources){
+        if(ray_source.distance(img_centre) < machine_eps){
+            throw std::invalid_argument("Ray source point cannot coincide with image centre. Refusing to continue.");
+        }
+        const line<double> source_centre_line(ray_source, img_centre); 
+
+        // Determine which way will be 'up' in the radiograph.
+        const auto ray_unit = (img_centre - ray_source).unit();
+        auto rg_up = img_unit;
+        auto rg_left = rg_up.Cross(ray_unit).unit();
+        if(!ray_unit.GramSchmidt_orthogonalize(rg_up, rg_left)){
+            throw std::invalid_argument("Cannot orthogonalize radiograph orientation unit vectors. Cannot continue.");
+        }
+        rg_up = rg_up.unit() * -1.0;
+        rg_left = rg_left.unit() * -1.0;
+
+        YLOGINFO("Proceeding with radiograph into-plane orientation unit vector: " << ray_unit);
+        YLOGINFO("Proceeding with radiograph leftward orientation unit vector: " << rg_left);
+        YLOGINFO("Proceeding with radiograph upward orientation unit vector: " << rg_up);
+        YLOGINFO("Proceeding with ray source at: " << ray_source);
+        YLOGINFO("Proceeding with image centre at: " << img_centre);
+        YLOGINFO("Proceeding with ray source - image centre line: " << source_centre_line);
+
+        projections.emplace_back();
+        auto &proj = projections.back();
+        proj.ray_source = ray_source;
+
+        // Pre-compute whether the ray source position is bounded within the image volume.
+        {
+            int64_t N_bounds = 0;
+            for(const auto & img_bp : img_bps){
+                N_bounds += (img_bp.Is_Point_Above_Plane(ray_source)) ? 1L : 0L;
+            }
+            proj.ray_source_is_within_image_volume = (N_bounds == 6);
+        }
 
-    const auto detector_plane = DetectImg->image_plane();
+        // Create a detector that will encompass the images.
+        //
+        // Note: We are generous here because the source is a single point. The image projection will therefore be
+        //       magnified. If the source is too close the projection will 
+        double grid_x_margin = 5.0;
+        double grid_y_margin = 5.0;
+        double grid_z_margin = 5.0;
+
+        //Generate a grid volume bounding the ROI(s). We ask for many images in order to compress the pxl_dz taken by each.
+        // Only two are actually allocated.
+        const auto NumberOfPanelImages = 1000L;
+        proj.sd_image_collection = Symmetrically_Contiguously_Grid_Volume<float,double>(
+                 cc_ROIs, 
+                 grid_x_margin, grid_y_margin, grid_z_margin,
+                 RadiographRows, RadiographColumns, /*number_of_channels=*/ 1, NumberOfPanelImages, 
+                 source_centre_line, rg_left, (rg_up * -1.0),
+                 /*pixel_fill=*/ 0.0, 
+                 /*only_top_and_bottom=*/ true);
+
+        //Get handles for each image.
+        proj.DetectImg = &(*std::next(proj.sd_image_collection.images.begin(),0));
+        proj.OrthoSrcImg = &(*std::next(proj.sd_image_collection.images.begin(),1));
+
+        // Confirm the detector image is oriented correctly.
+        //
+        // Note: the detector will always be on the opposite side of the image centre compared with the source point
+        // (i.e., the source will always points towards the image centre).
+        {
+            const auto dICSP = img_centre - ray_source;
+            const auto dDPIC = proj.DetectImg->center() - img_centre;
+            if(dICSP.Dot(dDPIC) < 0.0){
+                std::swap(proj.DetectImg, proj.OrthoSrcImg);
+            }
+        }
+
+        proj.DetectImg->metadata["Description"] = "Virtual radiograph detector";
+        proj.OrthoSrcImg->metadata["Description"] = "(unused)";
+
+        proj.detector_plane = proj.DetectImg->image_plane();
+    }
 
     //------------------------
-    // March rays through the image data.
-    {
-        std::mutex printer; // Who gets to print to the console and iterate the counter.
-        int64_t completed = 0;
+    // March a single ray through the image data, returning the accumulated attenuation-length product.
+    const auto march_ray = [&](const radiograph_projection &proj,
+                               int64_t RadiographRow,
+                               int64_t RadiographCol) -> double {
+        const auto &ray_source = proj.ray_source;
+
+        // Construct a line segment between the source and detector. 
+        const auto ray_terminus = proj.DetectImg->position(RadiographRow, RadiographCol);
+        const auto ray_line = line<double>(ray_source, ray_terminus);
+
+        // Find the intersection of the ray with the detector bounding planes.
+        vec3<double> detector_panel_bp_intersection;
+        if(!proj.detector_plane.Intersects_With_Line_Once(ray_line, detector_panel_bp_intersection)){
+            throw std::logic_error("Ray line does not intersect far image array bounding plane. Cannot continue.");
+        }
+        const auto ray_ls = line_segment<double>(ray_source, detector_panel_bp_intersection);
 
-        work_queue<std::function<void(void)>> wq;
-        for(int64_t RadiographRow = 0; RadiographRow < RadiographRows; ++RadiographRow){
-            wq.submit_task([&,RadiographRow]() -> void {
-                for(int64_t RadiographCol = 0; RadiographCol < RadiographColumns; ++RadiographCol){
-
-                    // Construct a line segment between the source and detector. 
-                    const auto ray_terminus = DetectImg->position(RadiographRow, RadiographCol);
-                    const auto ray_line = line<double>(ray_source, ray_terminus);
-
-                    // Find the intersection of the ray with the detector bounding planes.
-                    vec3<double> detector_panel_bp_intersection;
-                    if(!detector_plane.Intersects_With_Line_Once(ray_line, detector_panel_bp_intersection)){
-                        throw std::logic_error("Ray line does not intersect far image array bounding plane. Cannot continue.");
-                    }
-                    const auto ray_ls = line_segment<double>(ray_source, detector_panel_bp_intersection);
-
-                    // Find the intersections of the ray and the bounding box containing the images.
-                    std::vector<vec3<double>> bp_intersections;
-                    for(const auto & img_bp : img_bps){
-                        vec3<double> P;
-                        //if(img_bp.Intersects_With_Line_Once(ray_line, P)){
-                        if(img_bp.Intersects_With_Line_Segment_Once(ray_ls, P)){
-
-                            // Determine if the intersection point is on a face of the cube.
-                            const auto bp_centre = img_bp.Project_Onto_Plane_Orthogonally(img_centre);
-                            const auto dP = (P - bp_centre);
-                            const auto dP_x = std::abs(dP.Dot(row_unit));
-                            const auto dP_y = std::abs(dP.Dot(col_unit));
-                            const auto dP_z = std::abs(dP.Dot(img_unit));
-
-                            const auto max_x = (static_cast<double>(N_cols) * pxl_dx * 0.5);
-                            const auto max_y = (static_cast<double>(N_rows) * pxl_dy * 0.5);
-                            const auto max_z = (static_cast<double>(N_imgs) * pxl_dz * 0.5);
-
-                            if( (dP_x <= max_x)
-                            &&  (dP_y <= max_y)
-                            &&  (dP_z <= max_z) ){
-                                bp_intersections.emplace_back(P);
-                            }
-                        }
-                    }
+        // Find the intersections of the ray and the bounding box containing the images.
+        std::vector<vec3<double>> bp_intersections;
+        for(const auto & img_bp : img_bps){
+            vec3<double> P;
+            //if(img_bp.Intersects_With_Line_Once(ray_line, P)){
+            if(img_bp.Intersects_With_Line_Segment_Once(ray_ls, P)){
+
+                // Determine if the intersection point is on a face of the cube.
+                const auto bp_centre = img_bp.Project_Onto_Plane_Orthogonally(img_centre);
+                const auto dP = (P - bp_centre);
+                const auto dP_x = std::abs(dP.Dot(row_unit));
+                const auto dP_y = std::abs(dP.Dot(col_unit));
+                const auto dP_z = std::abs(dP.Dot(img_unit));
+
+                const auto max_x = (static_cast<double>(N_cols) * pxl_dx * 0.5);
+                const auto max_y = (static_cast<double>(N_rows) * pxl_dy * 0.5);
+                const auto max_z = (static_cast<double>(N_imgs) * pxl_dz * 0.5);
+
+                if( (dP_x <= max_x)
+                &&  (dP_y <= max_y)
+                &&  (dP_z <= max_z) ){
+                    bp_intersections.emplace_back(P);
+                }
+            }
+        }
 
-                    // Explicitly add the ray source point if it is bounded within the image volume.
-                    if(ray_source_is_within_image_volume){
-                        bp_intersections.emplace_back(ray_source);
-                    }
+        // Explicitly add the ray source point if it is bounded within the image volume.
+        if(proj.ray_source_is_within_image_volume){
+            bp_intersections.emplace_back(ray_source);
+        }
 
-                    // Skip rays that do not intersect the image volume twice.
-                    if(bp_intersections.size() != 2){
-                        continue;
-                    }
+        // Skip rays that do not intersect the image volume twice.
+        if(bp_intersections.size() != 2){
+            return 0.0;
+        }
 
-                    // Explicitly state the ray start and end positions using identified bounding-box intersection points.
-                    const vec3<double> ray_start = bp_intersections[0];
-                    const vec3<double> ray_end = bp_intersections[1];
-                    const auto ray_direction = (ray_end - ray_start).unit();
-                    const auto ray_total_sq_dist = ray_end.sq_dist(ray_start);
-
-                    // Determine whether moving from tail to head along the ray will increase or decrease the
-                    // row/col/img coordinates. Note that the direction will never change.
-                    const int64_t incr_row = (col_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
-                    const int64_t incr_col = (row_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
-                    const int64_t incr_img = (img_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
-
-                    // Determine the amount the ray will traverse due to incrementing i, j, or k individually.
-                    const auto true_ray_pos_dR_incr_row = ray_direction * (std::abs(col_unit.Dot(ray_direction)) * pxl_dy);
-                    const auto true_ray_pos_dR_incr_col = ray_direction * (std::abs(row_unit.Dot(ray_direction)) * pxl_dx);
-                    const auto true_ray_pos_dR_incr_img = ray_direction * (std::abs(img_unit.Dot(ray_direction)) * pxl_dz);
-
-                    const auto true_ray_pos_dR_incr_row_length = true_ray_pos_dR_incr_row.length();
-                    const auto true_ray_pos_dR_incr_col_length = true_ray_pos_dR_incr_col.length();
-                    const auto true_ray_pos_dR_incr_img_length = true_ray_pos_dR_incr_img.length();
-
-                    const auto blocky_ray_pos_dR_incr_row = col_unit * (pxl_dy * static_cast<double>(incr_row));
-                    const auto blocky_ray_pos_dR_incr_col = row_unit * (pxl_dx * static_cast<double>(incr_col));
-                    const auto blocky_ray_pos_dR_incr_img = img_unit * (pxl_dz * static_cast<double>(incr_img));
-
-                    // Determine the pseudo integer coordinates for the starting point.
-                    //
-                    // Note that these coordinates will not necessarily intersect any real voxels. They are defined only
-                    // by the (infinite) regular grid that coincides with the real voxels.
-                    const auto ray_start_grid_offset = ray_start - grid_zero;
-                    const auto ray_start_row_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(col_unit)/pxl_dy ) );
-                    const auto ray_start_col_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(row_unit)/pxl_dx ) );
-                    const auto ray_start_img_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(img_unit)/pxl_dz ) );
-
-                    int64_t ray_i = ray_start_row_index;
-                    int64_t ray_j = ray_start_col_index;
-                    int64_t ray_k = ray_start_img_index;
-
-                    vec3<double> true_ray_pos = ray_start;
-                    vec3<double> blocky_ray_pos = grid_zero + col_unit * (static_cast<double>(ray_i) * pxl_dy)
-                                                            + row_unit * (static_cast<double>(ray_j) * pxl_dx)
-                                                            + img_unit * (static_cast<double>(ray_k) * pxl_dz);
-
-                    // Each time the ray samples the CT number, the ray is simulated to have interacted with the medium
-                    // for the length of the ray advancement.
-                    //
-                    // For purposes of simulating a radiograph, the remaining fractional ray intensity could be
-                    // immediately reduced by multiplying by a factor of exp(-attenuation_coeff*dL). However, it is
-                    // easier to sum all the attenuation_coeff*dL contributions and apply the reduction factor once at
-                    // the end.
-                    double accumulated_attenuation_length_product = 0.0;
-                    double last_move_dist = 0.0;
-
-                    while(true){
-                        // Test which single increment (either i, j, or k) remaing the closest to the ray line.
-                        const auto cand_pos_i = blocky_ray_pos + blocky_ray_pos_dR_incr_row;
-                        const auto cand_pos_j = blocky_ray_pos + blocky_ray_pos_dR_incr_col;
-                        const auto cand_pos_k = blocky_ray_pos + blocky_ray_pos_dR_incr_img;
-
-                        const auto cand_sq_dist_i = ray_line.Sq_Distance_To_Point( cand_pos_i );
-                        const auto cand_sq_dist_j = ray_line.Sq_Distance_To_Point( cand_pos_j );
-                        const auto cand_sq_dist_k = ray_line.Sq_Distance_To_Point( cand_pos_k );
-
-                        if( (cand_sq_dist_i <= cand_sq_dist_j) && (cand_sq_dist_i <= cand_sq_dist_k) ){
-                            blocky_ray_pos = cand_pos_i;
-                            true_ray_pos += true_ray_pos_dR_incr_row;
-                            last_move_dist = true_ray_pos_dR_incr_row_length;
-                            ray_i += incr_row;
-                        }else if( cand_sq_dist_j <= cand_sq_dist_k ){
-                            blocky_ray_pos = cand_pos_j;
-                            true_ray_pos += true_ray_pos_dR_incr_col;
-                            last_move_dist = true_ray_pos_dR_incr_col_length;
-                            ray_j += incr_col;
-                        }else{
-                            blocky_ray_pos = cand_pos_k;
-                            true_ray_pos += true_ray_pos_dR_incr_img;
-                            last_move_dist = true_ray_pos_dR_incr_img_length;
-                            ray_k += incr_img;
-                        }
+        // Explicitly state the ray start and end positions using identified bounding-box intersection points.
+        const vec3<double> ray_start = bp_intersections[0];
+        const vec3<double> ray_end = bp_intersections[1];
+        const auto ray_direction = (ray_end - ray_start).unit();
+        const auto ray_total_sq_dist = ray_end.sq_dist(ray_start);
+
+        // Determine whether moving from tail to head along the ray will increase or decrease the
+        // row/col/img coordinates. Note that the direction will never change.
+        const int64_t incr_row = (col_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
+        const int64_t incr_col = (row_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
+        const int64_t incr_img = (img_unit.Dot(ray_direction) < 0.0) ? -1L : 1L;
+
+        // Determine the amount the ray will traverse due to incrementing i, j, or k individually.
+        const auto true_ray_pos_dR_incr_row = ray_direction * (std::abs(col_unit.Dot(ray_direction)) * pxl_dy);
+        const auto true_ray_pos_dR_incr_col = ray_direction * (std::abs(row_unit.Dot(ray_direction)) * pxl_dx);
+        const auto true_ray_pos_dR_incr_img = ray_direction * (std::abs(img_unit.Dot(ray_direction)) * pxl_dz);
+
+        const auto true_ray_pos_dR_incr_row_length = true_ray_pos_dR_incr_row.length();
+        const auto true_ray_pos_dR_incr_col_length = true_ray_pos_dR_incr_col.length();
+        const auto true_ray_pos_dR_incr_img_length = true_ray_pos_dR_incr_img.length();
+
+        const auto blocky_ray_pos_dR_incr_row = col_unit * (pxl_dy * static_cast<double>(incr_row));
+        const auto blocky_ray_pos_dR_incr_col = row_unit * (pxl_dx * static_cast<double>(incr_col));
+        const auto blocky_ray_pos_dR_incr_img = img_unit * (pxl_dz * static_cast<double>(incr_img));
+
+        // Determine the pseudo integer coordinates for the starting point.
+        //
+        // Note that these coordinates will not necessarily intersect any real voxels. They are defined only
+        // by the (infinite) regular grid that coincides with the real voxels.
+        const auto ray_start_grid_offset = ray_start - grid_zero;
+        const auto ray_start_row_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(col_unit)/pxl_dy ) );
+        const auto ray_start_col_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(row_unit)/pxl_dx ) );
+        const auto ray_start_img_index = static_cast<int64_t>( std::round( ray_start_grid_offset.Dot(img_unit)/pxl_dz ) );
+
+        int64_t ray_i = ray_start_row_index;
+        int64_t ray_j = ray_start_col_index;
+        int64_t ray_k = ray_start_img_index;
+
+        vec3<double> true_ray_pos = ray_start;
+        vec3<double> blocky_ray_pos = grid_zero + col_unit * (static_cast<double>(ray_i) * pxl_dy)
+                                                + row_unit * (static_cast<double>(ray_j) * pxl_dx)
+                                                + img_unit * (static_cast<double>(ray_k) * pxl_dz);
+
+        // Each time the ray samples the CT number, the ray is simulated to have interacted with the medium
+        // for the length of the ray advancement.
+        //
+        // For purposes of simulating a radiograph, the remaining fractional ray intensity could be
+        // immediately reduced by multiplying by a factor of exp(-attenuation_coeff*dL). However, it is
+        // easier to sum all the attenuation_coeff*dL contributions and apply the reduction factor once at
+        // the end.
+        double accumulated_attenuation_length_product = 0.0;
+        double last_move_dist = 0.0;
+
+        while(true){
+            // Test which single increment (either i, j, or k) remaing the closest to the ray line.
+            const auto cand_pos_i = blocky_ray_pos + blocky_ray_pos_dR_incr_row;
+            const auto cand_pos_j = blocky_ray_pos + blocky_ray_pos_dR_incr_col;
+            const auto cand_pos_k = blocky_ray_pos + blocky_ray_pos_dR_incr_img;
+
+            const auto cand_sq_dist_i = ray_line.Sq_Distance_To_Point( cand_pos_i );
+            const auto cand_sq_dist_j = ray_line.Sq_Distance_To_Point( cand_pos_j );
+            const auto cand_sq_dist_k = ray_line.Sq_Distance_To_Point( cand_pos_k );
+
+            if( (cand_sq_dist_i <= cand_sq_dist_j) && (cand_sq_dist_i <= cand_sq_dist_k) ){
+                blocky_ray_pos = cand_pos_i;
+                true_ray_pos += true_ray_pos_dR_incr_row;
+                last_move_dist = true_ray_pos_dR_incr_row_length;
+                ray_i += incr_row;
+            }else if( cand_sq_dist_j <= cand_sq_dist_k ){
+                blocky_ray_pos = cand_pos_j;
+                true_ray_pos += true_ray_pos_dR_incr_col;
+                last_move_dist = true_ray_pos_dR_incr_col_length;
+                ray_j += incr_col;
+            }else{
+                blocky_ray_pos = cand_pos_k;
+                true_ray_pos += true_ray_pos_dR_incr_img;
+                last_move_dist = true_ray_pos_dR_incr_img_length;
+                ray_k += incr_img;
+            }
 
-                        // Terminate if the geometry is invalid.
-                        if( pxl_diagonal_sq_length < true_ray_pos.sq_dist(blocky_ray_pos) ){
-                            throw std::runtime_error("Real ray position and blocky ray position differ by more than a voxel diagonal");
-                        }
+            // Terminate if the geometry is invalid.
+            if( pxl_diagonal_sq_length < true_ray_pos.sq_dist(blocky_ray_pos) ){
+                throw std::runtime_error("Real ray position and blocky ray position differ by more than a voxel diagonal");
+            }
 
-                        // Process the voxel.
-                        if( ( 0 <= ray_i ) && (ray_i < N_rows)
-                        &&  ( 0 <= ray_j ) && (ray_j < N_cols)
-                        &&  ( 0 <= ray_k ) && (ray_k < N_imgs) ){
-                            const auto intersecting_img_refw = img_adj.index_to_image(ray_k);
-                            const auto voxel_val = intersecting_img_refw.get().value(ray_i, ray_j, Channel);
+            // Process the voxel.
+            if( ( 0 <= ray_i ) && (ray_i < N_rows)
+            &&  ( 0 <= ray_j ) && (ray_j < N_cols)
+            &&  ( 0 <= ray_k ) && (ray_k < N_imgs) ){
+                const auto attenuation_coeff = att_vol.attenuation_coeff(ray_i, ray_j, ray_k);
 
-                            // Ficticious mass density encountered by the ray.
-                            const auto intensity = (voxel_val < -1000.0f) ? -1000.0f : voxel_val; // Enforce physicality.
-                            const auto attenuation_coeff = 1.0f + (intensity / 1000.0f); 
+                accumulated_attenuation_length_product += attenuation_coeff * last_move_dist;
 
-                            accumulated_attenuation_length_product += attenuation_coeff * last_move_dist;
-                            
-                            // Could alternately invoke a more generic user function using (i,j,k) and the various ray
-                            // positions/distances here.
+                // Could alternately invoke a more generic user function using (i,j,k) and the various ray
+                // positions/distances here.
 
-                            //  ... TODO ...
+                //  ... TODO ...
 
-                        }
+            }
 
-                        // Terminate if the ray has traveled far enough.
-                        const auto ray_traveled_sq_dist = ray_start.sq_dist(true_ray_pos);
-                        if(ray_total_sq_dist <= ray_traveled_sq_dist){
-                            break;
-                        }
-                    }
+            // Terminate if the ray has traveled far enough.
+            const auto ray_traveled_sq_dist = ray_start.sq_dist(true_ray_pos);
+            if(ray_total_sq_dist <= ray_traveled_sq_dist){
+                break;
+            }
+        }
+        return accumulated_attenuation_length_product;
+    };
 
-                    //Record the result in the image.
-                    DetectImg->reference(RadiographRow, RadiographCol, 0) = static_cast<float>(accumulated_attenuation_length_product);
-                }
+    //------------------------
+    // March rays through the image data.
+    //
+    // Detector pixels are processed in square tiles. Rays from neighbouring pixels follow nearly the same path, so
+    // each tile repeatedly samples the same few bricks of the attenuation volume. Tiles for all projections are
+    // queued together so every thread stays busy across the whole set.
+    {
+        const int64_t tile_edge = 16;
+        const int64_t tiles_per_row = (RadiographColumns + tile_edge - 1) / tile_edge;
+        const int64_t tiles_per_col = (RadiographRows + tile_edge - 1) / tile_edge;
+        const int64_t tiles_per_projection = tiles_per_row * tiles_per_col;
 
-                {
-                    // Report progress.
-                    std::lock_guard<std::mutex> lock(printer);
-                    ++completed;
-                    YLOGINFO("Completed " << completed << " of " << RadiographRows 
-                          << " --> " << static_cast<int>(1000.0*(completed)/RadiographRows)/10.0 << "% done");
-                }
-            });
+        std::mutex printer; // Who gets to print to the console and iterate the counter.
+        std::map<const radiograph_projection *, int64_t> completed_tiles;
+        int64_t completed = 0;
+        const int64_t N_projections = static_cast<int64_t>(projections.size());
 
+        work_queue<std::function<void(void)>> wq;
+        for(const auto &proj : projections){
+            const auto proj_ptr = &proj;
+            for(int64_t tile = 0; tile < tiles_per_projection; ++tile){
+                wq.submit_task([&,proj_ptr,tile]() -> void {
+                    const auto row_begin = (tile / tiles_per_row) * tile_edge;
+                    const auto col_begin = (tile % tiles_per_row) * tile_edge;
+                    const auto row_end = std::min(row_begin + tile_edge, static_cast<int64_t>(RadiographRows));
+                    const auto col_end = std::min(col_begin + tile_edge, static_cast<int64_t>(RadiographColumns));
+
+                    for(int64_t RadiographRow = row_begin; RadiographRow < row_end; ++RadiographRow){
+                        for(int64_t RadiographCol = col_begin; RadiographCol < col_end; ++RadiographCol){
+                            const auto alp = march_ray(*proj_ptr, RadiographRow, RadiographCol);
+
+                            //Record the result in the image.
+                            proj_ptr->DetectImg->reference(RadiographRow, RadiographCol, 0) = static_cast<float>(alp);
+                        }
+                    }
+
+                    {
+                        // Report progress.
+                        std::lock_guard<std::mutex> lock(printer);
+                        if(++completed_tiles[proj_ptr] == tiles_per_projection){
+                            ++completed;
+                            YLOGINFO("Completed " << completed << " of " << N_projections
+                                  << " --> " << static_cast<int>(1000.0*(completed)/N_projections)/10.0 << "% done");
+                        }
+                    }
+                });
+            }
         }
     } // Complete tasks and terminate thread pool.
 
     //------------------------
 
-    // Post-process the image according to user criteria.
-    if(imgmodel_is_mudl){
-        // Do nothing -- no need to transform.
-
-    }else if(imgmodel_is_exp){
-        // Implement a generic radiograph image with exponential attenuation.
-        for(int64_t row = 0; row < RadiographRows; ++row){
-            for(int64_t col = 0; col < RadiographColumns; ++col){
-                const auto alp = DetectImg->reference(row, col, 0);
-                const auto att = 1.0 - std::exp(-alp * AttenuationScale);
-                DetectImg->reference(row, col, 0) = att;
+    DICOM_data.image_data.emplace_back( std::make_shared<Image_Array>() );
+    auto &out_imagecoll = DICOM_data.image_data.back()->imagecoll;
+
+    int64_t projection_index = 0;
+    for(auto &proj : projections){
+        auto *DetectImg = proj.DetectImg;
+
+        // Post-process the image according to user criteria.
+        if(imgmodel_is_mudl){
+            // Do nothing -- no need to transform.
+
+        }else if(imgmodel_is_exp){
+            // Implement a generic radiograph image with exponential attenuation.
+            for(int64_t row = 0; row < RadiographRows; ++row){
+                for(int64_t col = 0; col < RadiographColumns; ++col){
+                    const auto alp = DetectImg->reference(row, col, 0);
+                    const auto att = 1.0 - std::exp(-alp * AttenuationScale);
+                    DetectImg->reference(row, col, 0) = att;
+                }
             }
+
+        }else{
+            throw std::invalid_argument("Image model not understood. Unable to continue.");
         }
 
-    }else{
-        throw std::invalid_argument("Image model not understood. Unable to continue.");
-    }
+        // Save image maps to file.
+        std::string l_FilenameStr = FilenameStr;
+        if(l_FilenameStr.empty()){
+            l_FilenameStr = Get_Unique_Sequential_Filename("/tmp/dicomautomaton_simulateradiograph_", 6, ".fits");
+
+        }else if(1UL < projections.size()){
+            // Distinguish the radiographs by inserting the projection number before the extension.
+            std::stringstream ss;
+            ss << "_" << std::setw(4) << std::setfill('0') << projection_index;
+            const auto dir_pos = l_FilenameStr.find_last_of('/');
+            const auto ext_pos = l_FilenameStr.find_last_of('.');
+            if( (ext_pos != std::string::npos)
+            &&  ( (dir_pos == std::string::npos) || (dir_pos < ext_pos) ) ){
+                l_FilenameStr.insert(ext_pos, ss.str());
+            }else{
+                l_FilenameStr += ss.str();
+            }
+        }
 
-    // Save image maps to file.
-    if(FilenameStr.empty()){
-        FilenameStr = Get_Unique_Sequential_Filename("/tmp/dicomautomaton_simulateradiograph_", 6, ".fits");
-    }
+        if(!WriteToFITS(*DetectImg, l_FilenameStr)){
+            throw std::runtime_error("Unable to write FITS file for simulated radiograph.");
+        }
 
-    if(!WriteToFITS(*DetectImg, FilenameStr)){
-        throw std::runtime_error("Unable to write FITS file for simulated radiograph.");
+        // Insert the image maps as images for later processing and/or viewing, if desired.
+        out_imagecoll.images.emplace_back( *DetectImg );
+        ++projection_index;
     }
 
-    // Insert the image maps as images for later processing and/or viewing, if desired.
-    *OrthoSrcImg = *DetectImg;
-    sd_image_collection.images.resize(1);
-
-    DICOM_data.image_data.emplace_back( std::make_shared<Image_Array>() );
-    DICOM_data.image_data.back()->imagecoll = sd_image_collection;
-
     return true;
 }
-
@@ -0,0 +1,224 @@
+//SimulateRadiograph_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the SimulateRadiograph operation, focusing on the handling of multiple source
+// positions.
+// Tests are separated into their own file because SimulateRadiograph is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "../Structs.h"
+#include "../Operation_Dispatcher.h"
+
+
+namespace {
+
+struct temp_dir {
+    std::filesystem::path path;
+    temp_dir(){
+        std::random_device rd;
+        this->path = std::filesystem::temp_directory_path()
+                   / ("dcma_simulate_radiograph_test_" + std::to_string(rd()) + "_" + std::to_string(rd()));
+        std::filesystem::create_directories(this->path);
+    }
+    ~temp_dir(){
+        std::error_code ec;
+        std::filesystem::remove_all(this->path, ec);
+    }
+};
+
+} // namespace
+
+// A small, regular CT volume containing an off-centre dense block so projections from different directions differ.
+static
+std::shared_ptr<Image_Array>
+make_test_ct_array(){
+    const int64_t N = 8;
+    auto ia = std::make_shared<Image_Array>();
+    for(int64_t i = 0; i < N; ++i){
+        ia->imagecoll.images.emplace_back();
+        auto &img = ia->imagecoll.images.back();
+        img.init_buffer(N, N, 1);
+        img.init_spatial(1.0, 1.0, 1.0, vec3<double>(0.0, 0.0, 0.0), vec3<double>(0.0, 0.0, static_cast<double>(i)));
+        img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+        img.fill_pixels(0.0f);
+        for(int64_t r = 1; r < 4; ++r){
+            for(int64_t c = 2; c < 6; ++c){
+                if((2 <= i) && (i < 5)) img.reference(r, c, 0) = 1000.0f;
+            }
+        }
+        img.metadata["Modality"] = "CT";
+    }
+    return ia;
+}
+
+// Simulate radiographs of the test volume. The radiographs are returned as the last image array.
+static
+std::shared_ptr<Image_Array>
+simulate(const std::string &source_positions, const std::filesystem::path &filename){
+    Drover d;
+    d.image_data.emplace_back( make_test_ct_array() );
+
+    OperationArgPkg op("SimulateRadiograph");
+    op.insert("SourcePosition", source_positions);
+    op.insert("Filename", filename.string());
+    op.insert("Rows", "12");
+    op.insert("Columns", "12");
+
+    std::map<std::string, std::string> InvocationMetadata;
+    const std::string FilenameLex;
+    std::list<OperationArgPkg> ops = { op };
+    REQUIRE(Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+    REQUIRE(d.image_data.size() == 2);
+    return d.image_data.back();
+}
+
+static
+std::vector<float>
+pixels_of(const planar_image<float,double> &img){
+    std::vector<float> out;
+    for(int64_t r = 0; r < img.rows; ++r){
+        for(int64_t c = 0; c < img.columns; ++c){
+            out.emplace_back( img.value(r, c, 0) );
+        }
+    }
+    return out;
+}
+
+static
+std::vector<std::string>
+filenames_in(const std::filesystem::path &dir){
+    std::vector<std::string> out;
+    for(const auto &e : std::filesystem::directory_iterator(dir)){
+        if(e.is_regular_file()) out.emplace_back( e.path().filename().string() );
+    }
+    std::sort(std::begin(out), std::end(out));
+    return out;
+}
+
+
+TEST_CASE("SimulateRadiograph with a single source is unchanged"){
+    temp_dir td;
+    const auto ia = simulate("relative(0.0, 100.0, 0.0)", td.path / "single.fits");
+
+    // The filename is used verbatim, without any numbering.
+    REQUIRE(filenames_in(td.path) == std::vector<std::string>{ "single.fits" });
+    REQUIRE(ia->imagecoll.images.size() == 1);
+
+    const auto &img = ia->imagecoll.images.front();
+    REQUIRE(img.rows == 12);
+    REQUIRE(img.columns == 12);
+    REQUIRE(img.metadata.at("Description") == "Virtual radiograph detector");
+
+    // The volume attenuates, so some rays must have accumulated attenuation.
+    const auto pixels = pixels_of(img);
+    REQUIRE(std::any_of(std::begin(pixels), std::end(pixels), [](float x){ return (0.0f < x); }));
+
+    SUBCASE("each projection in a batch matches the corresponding single-source radiograph"){
+        temp_dir td2;
+        const auto ia2 = simulate("relative(0.0, 100.0, 0.0); relative(100.0, 0.0, 0.0)", td2.path / "batch.fits");
+        REQUIRE(ia2->imagecoll.images.size() == 2);
+        REQUIRE(pixels_of(ia2->imagecoll.images.front()) == pixels);
+
+        temp_dir td3;
+        const auto ia3 = simulate("relative(100.0, 0.0, 0.0)", td3.path / "single.fits");
+        REQUIRE(pixels_of(ia2->imagecoll.images.back()) == pixels_of(ia3->imagecoll.images.front()));
+        REQUIRE(pixels_of(ia2->imagecoll.images.back()) != pixels);
+    }
+
+    SUBCASE("a single-step arc matches the equivalent relative source"){
+        temp_dir td2;
+        const auto ia2 = simulate("arc(0.0, 100.0, 0.0, 1)", td2.path / "arc.fits");
+        REQUIRE(filenames_in(td2.path) == std::vector<std::string>{ "arc.fits" });
+        REQUIRE(ia2->imagecoll.images.size() == 1);
+        REQUIRE(pixels_of(ia2->imagecoll.images.front()) == pixels);
+    }
+}
+
+TEST_CASE("SimulateRadiograph expands arcs into equally-spaced sources"){
+    temp_dir td;
+    const auto ia = simulate("arc(0.0, 100.0, 0.0, 4)", td.path / "rg.fits");
+    REQUIRE(ia->imagecoll.images.size() == 4);
+
+    // The volume occupies [-0.5, 7.5] along each axis.
+    const vec3<double> centre(3.5, 3.5, 3.5);
+
+    // Detectors are placed opposite the source, so they should also be rotated in equal steps about the axis
+    // orthogonal to the images.
+    std::vector<vec3<double>> dirs;
+    for(const auto &img : ia->imagecoll.images){
+        const auto d = img.center() - centre;
+        REQUIRE(std::abs(d.z) < 1E-6);
+        dirs.emplace_back( d.unit() );
+    }
+    const auto first_norm = (ia->imagecoll.images.front().center() - centre).length();
+    for(const auto &img : ia->imagecoll.images){
+        REQUIRE((img.center() - centre).length() == doctest::Approx(first_norm));
+    }
+    for(size_t i = 0; i < dirs.size(); ++i){
+        const auto &a = dirs.at(i);
+        const auto &b = dirs.at((i + 1) % dirs.size());
+        REQUIRE(a.Dot(b) == doctest::Approx(0.0).epsilon(1E-6));
+        REQUIRE(std::abs(a.Cross(b).z) == doctest::Approx(1.0).epsilon(1E-6));
+    }
+    REQUIRE(dirs.at(0).Dot(dirs.at(2)) == doctest::Approx(-1.0));
+
+    // The first source is the unrotated offset, so the detector is on the opposite side.
+    REQUIRE(dirs.at(0).y == doctest::Approx(-1.0));
+
+    SUBCASE("arcs can be mixed with other specifications"){
+        temp_dir td2;
+        const auto ia2 = simulate("relative(0.0, 100.0, 20.0);arc(0.0, 100.0, 0.0, 3); absolute(3.5, -100.0, 10.0)",
+                                  td2.path / "mixed.fits");
+        REQUIRE(ia2->imagecoll.images.size() == 5);
+    }
+
+    SUBCASE("invalid arcs are rejected"){
+        temp_dir td2;
+        Drover d;
+        d.image_data.emplace_back( make_test_ct_array() );
+        for(const auto &spec : { "arc(0.0, 100.0, 0.0)", "arc(0.0, 100.0, 0.0, 0)" }){
+            OperationArgPkg op("SimulateRadiograph");
+            op.insert("SourcePosition", spec);
+            op.insert("Filename", (td2.path / "bad.fits").string());
+            op.insert("Rows", "4");
+            op.insert("Columns", "4");
+
+            std::map<std::string, std::string> InvocationMetadata;
+            const std::string FilenameLex;
+            std::list<OperationArgPkg> ops = { op };
+            REQUIRE(!Operation_Dispatcher(d, InvocationMetadata, FilenameLex, ops));
+        }
+        REQUIRE(filenames_in(td2.path).empty());
+    }
+}
+
+TEST_CASE("SimulateRadiograph numbers the files of multiple radiographs"){
+    temp_dir td;
+
+    SUBCASE("the number is inserted before the extension"){
+        simulate("arc(0.0, 100.0, 0.0, 3)", td.path / "rg.fits");
+        REQUIRE(filenames_in(td.path) == std::vector<std::string>{ "rg_0000.fits", "rg_0001.fits", "rg_0002.fits" });
+    }
+
+    SUBCASE("the number is appended when there is no extension"){
+        const auto dir = td.path / "out.d";
+        std::filesystem::create_directories(dir);
+        simulate("relative(0.0, 100.0, 0.0);relative(100.0, 0.0, 0.0)", dir / "rg");
+        REQUIRE(filenames_in(dir) == std::vector<std::string>{ "rg_0000", "rg_0001" });
+    }
+}
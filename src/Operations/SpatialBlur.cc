@@ -55,8 +55,9 @@ OperationDoc OpArgDocSpatialBlur(){
     out.args.back().name = "GaussianOpenSigma";
     out.args.back().desc = "Controls the number of neighbours to consider (only) when using the gaussian_open estimator."
                       " The number of pixels is computed automatically to accommodate the specified sigma"
-                      " (currently ignored pixels have 3*sigma or less weighting). Be aware this operation can take"
-                      " an enormous amount of time, since the pixel neighbourhoods quickly grow large.";
+                      " (currently ignored pixels have 3*sigma or less weighting). The blur is computed separably,"
+                      " and a recursive filter is used for large sigma, so the cost does not grow appreciably with"
+                      " sigma.";
     out.args.back().default_val = "1.5";
     out.args.back().expected = true;
     out.args.back().examples = { "0.5",
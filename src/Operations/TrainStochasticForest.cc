@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <map>
@@ -191,27 +192,28 @@ bool TrainStochasticForest(Drover &DICOM_data,
     num_array<double> X(N, M);
     num_array<double> y(N, 1);
 
-    for(int64_t r = data_row_min; r <= data_row_max; ++r){
-        const int64_t sample_idx = r - data_row_min;
-
-        // Extract dependent variable.
-        const auto dep_val_opt = table.value(r, dep_col);
-        if(!dep_val_opt){
-            throw std::invalid_argument("Missing value at row "_s + std::to_string(r) + ", col " + std::to_string(dep_col));
-        }
-        y.coeff(sample_idx, 0) = std::stod(dep_val_opt.value());
-
-        // Extract features.
-        int64_t feat_idx = 0;
-        for(int64_t c = col_min; c <= col_max; ++c){
-            if(c == dep_col) continue;
-            const auto val_opt = table.value(r, c);
-            if(!val_opt){
-                throw std::invalid_argument("Missing value at row "_s + std::to_string(r) + ", col " + std::to_string(c));
+    // Numeric cells are stored in typed form, so whole columns can be extracted without parsing.
+    const auto extract_column = [&](int64_t c, const std::function<void(int64_t, double)> &f){
+        const auto vals = table.column_as_reals(c, {data_row_min, data_row_max});
+        for(int64_t sample_idx = 0; sample_idx < N; ++sample_idx){
+            const auto &v = vals.at(sample_idx);
+            if(!v){
+                const auto r = data_row_min + sample_idx;
+                throw std::invalid_argument("Missing or non-numeric value at row "_s + std::to_string(r) + ", col " + std::to_string(c));
             }
-            X.coeff(sample_idx, feat_idx) = std::stod(val_opt.value());
-            ++feat_idx;
+            f(sample_idx, v.value());
         }
+    };
+
+    // Extract dependent variable.
+    extract_column(dep_col, [&](int64_t sample_idx, double v){ y.coeff(sample_idx, 0) = v; });
+
+    // Extract features.
+    int64_t feat_idx = 0;
+    for(int64_t c = col_min; c <= col_max; ++c){
+        if(c == dep_col) continue;
+        extract_column(c, [&](int64_t sample_idx, double v){ X.coeff(sample_idx, feat_idx) = v; });
+        ++feat_idx;
     }
 
     // Train the model.
@@ -45,7 +45,10 @@ OperationDoc OpArgDocTransaction(){
         " Side-effects will therefore be committed immediately, regardless of whether the transaction succeeds."
     );
     out.notes.emplace_back(
-        "This operation duplicates the full internal data state, so can be memory-intensive."
+        "The snapshot shares data with the internal state, and objects are duplicated before a child operation"
+        " could modify them. Operations that do not declare which objects they modify cause all objects to be"
+        " duplicated, so transactions will often temporarily require memory for both the original and modified"
+        " objects. Objects are duplicated at most once per transaction."
     );
 
     return out;
@@ -68,8 +71,8 @@ bool Transaction(Drover &DICOM_data,
         YLOGWARN("No children operations specified, forgoing transaction");
     }else{
 
-        // Copy Drover and other relevant internal state.
-        const auto orig_DICOM_data = DICOM_data.Deep_Copy();
+        // Snapshot the Drover and copy other relevant internal state.
+        const Drover_Snapshot orig_DICOM_data(DICOM_data);
         const auto orig_InvocationMetadata = InvocationMetadata;
 
         // Perform children operations.
@@ -79,7 +82,7 @@ bool Transaction(Drover &DICOM_data,
             
         }else{
             YLOGWARN("Transaction failed. Reverting state");
-            DICOM_data = orig_DICOM_data;
+            orig_DICOM_data.Restore(DICOM_data);
             InvocationMetadata = orig_InvocationMetadata;
             return false;
         }
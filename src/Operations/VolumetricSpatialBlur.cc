@@ -1,6 +1,7 @@
 //VolumetricSpatialBlur.cc - A part of DICOMautomaton 2019. Written by hal clark.
 
 #include <any>
+#include <cmath>
 #include <optional>
 #include <functional>
 #include <iterator>
@@ -16,6 +17,7 @@
 
 #include "../Structs.h"
 #include "../Regex_Selectors.h"
+#include "../String_Parsing.h"
 #include "../YgorImages_Functors/Grouping/Misc_Functors.h"
 #include "../YgorImages_Functors/Compute/Volumetric_Spatial_Blur.h"
 
@@ -72,16 +74,43 @@ OperationDoc OpArgDocVolumetricSpatialBlur(){
     out.args.emplace_back();
     out.args.back().name = "Estimator";
     out.args.back().desc = "Controls which type of blur is computed."
-                           " Currently, 'Gaussian' refers to a fixed sigma=1 (in pixel coordinates, not DICOM units)"
+                           " 'Gaussian' refers to a fixed sigma=1 (in pixel coordinates, not DICOM units)"
                            " Gaussian blur that extends for 3*sigma thus providing a 7x7x7 window."
-                           " Note that applying this kernel N times will approximate a Gaussian with sigma=N."
-                           " Also note that boundary voxels will cause accessible voxels within the same window to be more"
+                           " It ignores the 'Sigma' parameter."
+                           " 'Gaussian-truncated' and 'Gaussian-recursive' use the 'Sigma' parameter (in DICOM units)"
+                           " and account for the voxel dimensions, which need not be isotropic."
+                           " The truncated variant uses kernels that extend for 3*sigma, so the cost grows with sigma."
+                           " The recursive variant uses a third-order recursive filter (Young and van Vliet) whose cost"
+                           " does not depend on sigma, but which is less accurate for small sigma (less than ~1 voxel)."
+                           " 'Gaussian-auto' selects the cheaper of the two for each direction."
+                           " Note that boundary voxels will cause accessible voxels within the same window to be more"
                            " heavily weighted. Try avoid boundaries or add extra margins if possible.";
     out.args.back().default_val = "Gaussian";
     out.args.back().expected = true;
-    out.args.back().examples = { "Gaussian" };
+    out.args.back().examples = { "Gaussian",
+                                 "Gaussian-truncated",
+                                 "Gaussian-recursive",
+                                 "Gaussian-auto" };
     out.args.back().samples = OpArgSamples::Exhaustive;
 
+
+    out.args.emplace_back();
+    out.args.back().name = "Sigma";
+    out.args.back().desc = "The standard deviation of the Gaussian, in DICOM units (i.e., mm)."
+                           " Either a single value can be provided, which is used in all directions, or three"
+                           " comma-separated values for the row-aligned, column-aligned, and image-orthogonal"
+                           " directions, respectively."
+                           " A value of zero disables blurring along the corresponding direction."
+                           " This parameter is only used by the 'Gaussian-truncated', 'Gaussian-recursive', and"
+                           " 'Gaussian-auto' estimators.";
+    out.args.back().default_val = "1.0";
+    out.args.back().expected = true;
+    out.args.back().examples = { "0.5",
+                                 "1.0",
+                                 "5.0",
+                                 "2.0, 2.0, 0.0",
+                                 "1.0, 1.0, 3.0" };
+
     return out;
 }
 
@@ -100,9 +129,23 @@ bool VolumetricSpatialBlur(Drover &DICOM_data,
     const auto Channel = std::stol( OptArgs.getValueStr("Channel").value() );
 
     const auto EstimatorStr = OptArgs.getValueStr("Estimator").value();
+    const auto SigmaStr = OptArgs.getValueStr("Sigma").value();
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto regex_gauss = Compile_Regex("^ga?u?s?s?i?a?n?$");
+    const auto regex_gauss_trunc = Compile_Regex("^ga?u?s?s?i?a?n?[-_]?tr?u?n?c?a?t?e?d?$");
+    const auto regex_gauss_recur = Compile_Regex("^ga?u?s?s?i?a?n?[-_]?re?c?u?r?s?i?v?e?$");
+    const auto regex_gauss_auto  = Compile_Regex("^ga?u?s?s?i?a?n?[-_]?au?t?o?m?a?t?i?c?$");
+
+    const auto sigmas = parse_numbers(",", SigmaStr);
+    if( (sigmas.size() != 1) && (sigmas.size() != 3) ){
+        throw std::invalid_argument("Sigma should contain either one or three numbers. Refusing to continue.");
+    }
+    for(const auto &s : sigmas){
+        if(!std::isfinite(s) || (s < 0.0)){
+            throw std::invalid_argument("Sigma should be finite and non-negative. Refusing to continue.");
+        }
+    }
 
     auto cc_all = All_CCs( DICOM_data );
     auto cc_ROIs = Whitelist( cc_all, ROILabelRegex, NormalizedROILabelRegex, ROISelection );
@@ -117,8 +160,17 @@ bool VolumetricSpatialBlur(Drover &DICOM_data,
         // Planar derivatives.
         ComputeVolumetricSpatialBlurUserData ud;
         ud.channel = Channel;
+        ud.sigma_row    = sigmas.at(0);
+        ud.sigma_column = (sigmas.size() == 3) ? sigmas.at(1) : sigmas.at(0);
+        ud.sigma_image  = (sigmas.size() == 3) ? sigmas.at(2) : sigmas.at(0);
         if(std::regex_match(EstimatorStr, regex_gauss)){
             ud.estimator = VolumetricSpatialBlurEstimator::Gaussian;
+        }else if(std::regex_match(EstimatorStr, regex_gauss_trunc)){
+            ud.estimator = VolumetricSpatialBlurEstimator::GaussianTruncated;
+        }else if(std::regex_match(EstimatorStr, regex_gauss_recur)){
+            ud.estimator = VolumetricSpatialBlurEstimator::GaussianRecursive;
+        }else if(std::regex_match(EstimatorStr, regex_gauss_auto)){
+            ud.estimator = VolumetricSpatialBlurEstimator::GaussianAutomatic;
         }else{
             throw std::invalid_argument("Estimator not understood. Refusing to continue.");
         }
@@ -17,6 +17,7 @@
 #include "../Structs.h"
 #include "../Regex_Selectors.h"
 #include "../YgorImages_Functors/Grouping/Misc_Functors.h"
+#include "../YgorImages_Functors/Compute/Volumetric_Spatial_Blur.h"
 #include "../YgorImages_Functors/Compute/Volumetric_Spatial_Derivative.h"
 
 #include "VolumetricSpatialDerivative.h"
@@ -96,6 +97,21 @@ OperationDoc OpArgDocVolumetricSpatialDerivative(){
                                  "non-maximum-suppression" };
     out.args.back().samples = OpArgSamples::Exhaustive;
 
+
+    out.args.emplace_back();
+    out.args.back().name = "Sigma";
+    out.args.back().desc = "If positive, the images are first smoothed with an isotropic Gaussian having this standard"
+                           " deviation (in DICOM units, i.e., mm) to suppress noise, i.e., a derivative-of-Gaussian"
+                           " estimator is computed. Voxel dimensions are taken into account, and the cost of smoothing"
+                           " does not grow appreciably with sigma."
+                           " Note that only the selected channel(s) and voxels within the ROI(s) are smoothed."
+                           " A value of zero disables smoothing.";
+    out.args.back().default_val = "0.0";
+    out.args.back().expected = true;
+    out.args.back().examples = { "0.0",
+                                 "1.0",
+                                 "2.5" };
+
     return out;
 }
 
@@ -115,6 +131,7 @@ bool VolumetricSpatialDerivative(Drover &DICOM_data,
 
     const auto EstimatorStr = OptArgs.getValueStr("Estimator").value();
     const auto MethodStr = OptArgs.getValueStr("Method").value();
+    const auto Sigma = std::stod( OptArgs.getValueStr("Sigma").value() );
 
     //-----------------------------------------------------------------------------------------------------------------
     const auto regex_1st = Compile_Regex("^fi?r?s?t?$");
@@ -157,6 +174,20 @@ bool VolumetricSpatialDerivative(Drover &DICOM_data,
         ////////////////////////
 */
 
+        // Pre-smoothing.
+        if(0.0 < Sigma){
+            ComputeVolumetricSpatialBlurUserData bud;
+            bud.channel = Channel;
+            bud.estimator = VolumetricSpatialBlurEstimator::GaussianAutomatic;
+            bud.sigma_row = Sigma;
+            bud.sigma_column = Sigma;
+            bud.sigma_image = Sigma;
+            if(!(*iap_it)->imagecoll.Compute_Images( ComputeVolumetricSpatialBlur,
+                                                     {}, cc_ROIs, &bud )){
+                throw std::runtime_error("Unable to smooth images prior to computing volumetric partial derivative.");
+            }
+        }
+
         // Planar derivatives.
         ComputeVolumetricSpatialDerivativeUserData ud;
         ud.channel = Channel;
@@ -11,12 +11,255 @@
 #include <utility>
 #include <cstdint>
 #include <unordered_set>
+#include <unordered_map>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
 
 #include "YgorString.h"
 #include "YgorMath.h"
 
 #include "Structs.h"
 
+// The maximum number of distinct parsed selectors and value matchers to retain.
+static constexpr size_t selector_cache_capacity = 4096;
+
+// ---------------------------------- Selector Programs --------------------------------
+
+// A selector specifier parsed into a form that can be evaluated repeatedly without re-parsing.
+//
+// Parsing a specifier requires evaluating many regexes, so specifiers are parsed once and cached.
+struct compiled_selector {
+    enum class kind {
+        multiple,          // "key1@value1;key2@value2".
+        key_missing,       // "keymissing@key".
+        inverted_key_value,// "!key@value".
+        key_value,         // "key@value".
+        none,              // "none" or "!none".
+        all,               // "all" or "!all".
+        nth,               // "first", "second", "third", or inverted variants.
+        last,              // "last" or "!last".
+        positive_number,   // "#N" or "!#N".
+        negative_number,   // "#-N" or "!#-N".
+        numerous,          // "numerous" or "!numerous".
+        fewest,            // "fewest" or "!fewest".
+        more_than,         // "more-than(N)" or "!more-than(N)".
+        fewer_than,        // "fewer-than(N)" or "!fewer-than(N)".
+    } k = kind::none;
+
+    bool inverted = false;
+    int64_t N = 0;
+    std::string key;
+    std::string value;
+    std::vector<std::string> parts; // Individual specifiers, for 'multiple' selectors.
+};
+
+static
+compiled_selector
+Parse_Selector(const std::string &Specifier){
+    compiled_selector out;
+
+    // Multiple key-value specifications stringified together.
+    // For example, "key1@value1;key2@value2".
+    do{
+        static const auto regex_split = Compile_Regex("^.*;.*$");
+        if(!std::regex_match(Specifier, regex_split)) break; // Not a multi-key@value statement.
+
+        auto v_kvs = SplitStringToVector(Specifier, ';', 'd');
+        if(v_kvs.size() <= 1) throw std::logic_error("Unable to separate multiple key@value specifiers");
+
+        out.k = compiled_selector::kind::multiple;
+        out.parts = v_kvs;
+        return out;
+    }while(false);
+
+    // A keyword and a single key name.
+    // For example, "keymissing@key".
+    do{
+        static const auto regex_split = Compile_Regex("^keymissing@.*$");
+        if(!std::regex_match(Specifier, regex_split)) break; // Not a keymissing@key statement.
+        
+        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
+        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate keymissing@key specifier");
+        if(v_k_v.size() != 2) break; // Not a keymissing@key statement (hint: maybe multiple @'s present?).
+
+        out.k = compiled_selector::kind::key_missing;
+        out.key = v_k_v.back();
+        return out;
+    }while(false);
+
+    // Inverted regex key-value specifications stringified together.
+    // For example, "!key@value".
+    do{
+        static const auto regex_split = Compile_Regex("^[!].*@.*$");
+        if(!std::regex_match(Specifier, regex_split)) break; // Not a key@value statement.
+        
+        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
+        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate !key@value specifier");
+        if(v_k_v.size() != 2) break; // Not a key@value statement (hint: maybe multiple @'s present?).
+
+        out.k = compiled_selector::kind::inverted_key_value;
+        out.key = v_k_v.front().substr(1);
+        out.value = v_k_v.back();
+        return out;
+    }while(false);
+
+    // A single key-value specifications stringified together.
+    // For example, "key@value".
+    do{
+        static const auto regex_split = Compile_Regex("^.*@.*$");
+        if(!std::regex_match(Specifier, regex_split)) break; // Not a key@value statement.
+        
+        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
+        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate key@value specifier");
+        if(v_k_v.size() != 2) break; // Not a key@value statement (hint: maybe multiple @'s present?).
+
+        out.k = compiled_selector::kind::key_value;
+        out.key = v_k_v.front();
+        out.value = v_k_v.back();
+        return out;
+    }while(false);
+
+    // Single-word positional specifiers, i.e. "all", "none", "first", "last", or zero-based 
+    // numerical specifiers, e.g., "#0" (front), "#1" (second), "#-0" (last), and "#-1" (second-from-last).
+    do{
+        static const auto regex_none  = Compile_Regex("^[[:space:]]*non?e?[[:space:]]*$");
+        static const auto regex_all   = Compile_Regex("^[[:space:]]*al?l?[[:space:]]*$");
+        static const auto regex_1st   = Compile_Regex("^[[:space:]]*fir?s?t?[[:space:]]*$");
+        static const auto regex_2nd   = Compile_Regex("^[[:space:]]*se?c?o?n?d?[[:space:]]*$");
+        static const auto regex_3rd   = Compile_Regex("^[[:space:]]*th?i?r?d?[[:space:]]*$");
+        static const auto regex_last  = Compile_Regex("^[[:space:]]*la?s?t?[[:space:]]*$");
+        static const auto regex_pnum  = Compile_Regex("^[[:space:]]*[#][0-9]+[[:space:]]*$");
+        static const auto regex_nnum  = Compile_Regex("^[[:space:]]*[#]-[0-9]+[[:space:]]*$");
+        static const auto regex_numer = Compile_Regex("^[[:space:]]*num?e?r?o?u?s?[[:space:]]*$");
+        static const auto regex_few   = Compile_Regex("^[[:space:]]*fewest?[[:space:]]*$");
+        static const auto regex_moret = Compile_Regex("^[[:space:]]*mor?e?[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
+        static const auto regex_fewt  = Compile_Regex("^[[:space:]]*fewer[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
+
+        static const auto regex_i_none  = Compile_Regex("^[[:space:]]*[!][[:space:]]*non?e?[[:space:]]*$"); // Inverted variants of the above.
+        static const auto regex_i_all   = Compile_Regex("^[[:space:]]*[!][[:space:]]*al?l?[[:space:]]*$");
+        static const auto regex_i_1st   = Compile_Regex("^[[:space:]]*[!][[:space:]]*fir?s?t?[[:space:]]*$");
+        static const auto regex_i_2nd   = Compile_Regex("^[[:space:]]*[!][[:space:]]*se?c?o?n?d?[[:space:]]*$");
+        static const auto regex_i_3rd   = Compile_Regex("^[[:space:]]*[!][[:space:]]*th?i?r?d?[[:space:]]*$");
+        static const auto regex_i_last  = Compile_Regex("^[[:space:]]*[!][[:space:]]*la?s?t?[[:space:]]*$");
+        static const auto regex_i_pnum  = Compile_Regex("^[[:space:]]*[!][[:space:]]*[#][0-9]+[[:space:]]*$");
+        static const auto regex_i_nnum  = Compile_Regex("^[[:space:]]*[!][[:space:]]*[#]-[0-9]+[[:space:]]*$");
+        static const auto regex_i_numer = Compile_Regex("^[[:space:]]*[!][[:space:]]*num?e?r?o?u?s?[[:space:]]*$");
+        static const auto regex_i_few   = Compile_Regex("^[[:space:]]*[!][[:space:]]*fewest?[[:space:]]*$");
+        static const auto regex_i_moret = Compile_Regex("^[[:space:]]*[!][[:space:]]*mor?e?[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
+        static const auto regex_i_fewt  = Compile_Regex("^[[:space:]]*[!][[:space:]]*fewer[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
+
+        const auto set = [&](compiled_selector::kind k, bool inverted){
+            out.k = k;
+            out.inverted = inverted;
+            return out;
+        };
+
+        if(std::regex_match(Specifier, regex_i_none)) return set(compiled_selector::kind::none, true);
+        if(std::regex_match(Specifier, regex_none))   return set(compiled_selector::kind::none, false);
+        if(std::regex_match(Specifier, regex_i_all))  return set(compiled_selector::kind::all, true);
+        if(std::regex_match(Specifier, regex_all))    return set(compiled_selector::kind::all, false);
+
+        if( std::regex_match(Specifier, regex_i_1st) ){ out.N = 1; return set(compiled_selector::kind::nth, true); }
+        if( std::regex_match(Specifier, regex_i_2nd) ){ out.N = 2; return set(compiled_selector::kind::nth, true); }
+        if( std::regex_match(Specifier, regex_i_3rd) ){ out.N = 3; return set(compiled_selector::kind::nth, true); }
+        if( std::regex_match(Specifier, regex_1st) ){ out.N = 1; return set(compiled_selector::kind::nth, false); }
+        if( std::regex_match(Specifier, regex_2nd) ){ out.N = 2; return set(compiled_selector::kind::nth, false); }
+        if( std::regex_match(Specifier, regex_3rd) ){ out.N = 3; return set(compiled_selector::kind::nth, false); }
+
+        if(std::regex_match(Specifier, regex_i_last)) return set(compiled_selector::kind::last, true);
+        if(std::regex_match(Specifier, regex_last))   return set(compiled_selector::kind::last, false);
+
+        if(std::regex_match(Specifier, regex_i_pnum)){
+            auto pnum_extractor = std::regex("^[[:space:]]*[!][[:space:]]*[#]([0-9]+)[[:space:]]*$",
+                                             std::regex::icase |
+                                             std::regex::optimize |
+                                             std::regex::extended);
+            out.N = static_cast<int64_t>(std::stoul(GetFirstRegex(Specifier, pnum_extractor)));
+            return set(compiled_selector::kind::positive_number, true);
+        }
+        if(std::regex_match(Specifier, regex_pnum)){
+            auto pnum_extractor = std::regex("^[[:space:]]*[#]([0-9]+)[[:space:]]*$",
+                                             std::regex::icase |
+                                             std::regex::optimize |
+                                             std::regex::extended);
+            out.N = static_cast<int64_t>(std::stoul(GetFirstRegex(Specifier, pnum_extractor)));
+            return set(compiled_selector::kind::positive_number, false);
+        }
+
+        if(std::regex_match(Specifier, regex_i_nnum)){
+            auto nnum_extractor = std::regex("^[[:space:]]*[!][[:space:]]*[#]-([0-9]+)[[:space:]]*$",
+                                             std::regex::icase |
+                                             std::regex::optimize |
+                                             std::regex::extended);
+            out.N = static_cast<int64_t>(std::stoul(GetFirstRegex(Specifier, nnum_extractor)));
+            return set(compiled_selector::kind::negative_number, true);
+        }
+        if(std::regex_match(Specifier, regex_nnum)){
+            auto nnum_extractor = std::regex("^[[:space:]]*[#]-([0-9]+)[[:space:]]*$",
+                                             std::regex::icase |
+                                             std::regex::optimize |
+                                             std::regex::extended);
+            out.N = static_cast<int64_t>(std::stoul(GetFirstRegex(Specifier, nnum_extractor)));
+            return set(compiled_selector::kind::negative_number, false);
+        }
+
+        // 'Numerous' and 'fewest' selectors.
+        if(std::regex_match(Specifier, regex_numer))   return set(compiled_selector::kind::numerous, false);
+        if(std::regex_match(Specifier, regex_i_numer)) return set(compiled_selector::kind::numerous, true);
+        if(std::regex_match(Specifier, regex_few))     return set(compiled_selector::kind::fewest, false);
+        if(std::regex_match(Specifier, regex_i_few))   return set(compiled_selector::kind::fewest, true);
+
+        // 'more_than(N)', 'fewer_than(N)', and inverted selectors.
+        {
+            const bool selector_moret = std::regex_match(Specifier, regex_moret);
+            const bool selector_fewt  = std::regex_match(Specifier, regex_fewt);
+
+            const bool selector_i_moret = std::regex_match(Specifier, regex_i_moret);
+            const bool selector_i_fewt  = std::regex_match(Specifier, regex_i_fewt);
+
+            if( selector_moret || selector_fewt || selector_i_moret || selector_i_fewt ){
+                const auto num_extractor = std::regex(".*[(]([-]?[0-9]+)[)][[:space:]]*$",
+                                                      std::regex::icase |
+                                                      std::regex::optimize |
+                                                      std::regex::extended);
+                out.N = std::stol(GetFirstRegex(Specifier, num_extractor));
+                return set( (selector_moret || selector_i_moret) ? compiled_selector::kind::more_than
+                                                                 : compiled_selector::kind::fewer_than,
+                            (selector_i_moret || selector_i_fewt) );
+            }
+        }
+
+    }while(false);
+
+    throw std::invalid_argument("Selection is not valid. Cannot continue.");
+    return out;
+}
+
+// Retrieve a parsed selector, parsing it only if it has not been seen before.
+static
+std::shared_ptr<const compiled_selector>
+Compile_Selector(const std::string &Specifier){
+    static std::mutex m;
+    static std::map<std::string, std::shared_ptr<const compiled_selector>> cache;
+    {
+        std::lock_guard<std::mutex> lock(m);
+        const auto it = cache.find(Specifier);
+        if(it != std::end(cache)) return it->second;
+    }
+
+    // Parse outside the lock. Invalid specifiers throw and are not cached.
+    auto cs = std::make_shared<const compiled_selector>( Parse_Selector(Specifier) );
+
+    std::lock_guard<std::mutex> lock(m);
+    if(selector_cache_capacity <= cache.size()) cache.clear(); // Guard against unbounded growth.
+    return cache.emplace(Specifier, cs).first->second;
+}
+
+
 // ------------------------------------- Templates -------------------------------------
 
 // Whitelist image arrays or point clouds using a limited vocabulary of specifiers.
@@ -33,21 +276,18 @@ Whitelist_Core( L lops,
     constexpr bool is_cc = std::is_same< decltype(lops),
                                          decltype(All_CCs( Drover() )) >::value;
 
+    const auto cs_ptr = Compile_Selector(Specifier);
+    const auto &cs = *cs_ptr;
+
     // Multiple key-value specifications stringified together.
     // For example, "key1@value1;key2@value2".
-    do{
-        const auto regex_split = Compile_Regex("^.*;.*$");
-        if(!std::regex_match(Specifier, regex_split)) break; // Not a multi-key@value statement.
-
-        auto v_kvs = SplitStringToVector(Specifier, ';', 'd');
-        if(v_kvs.size() <= 1) throw std::logic_error("Unable to separate multiple key@value specifiers");
-
+    if(cs.k == compiled_selector::kind::multiple){
         // Because 'filtering' each selector will modify the positional selectors, we evaluate
         // each selector on the full (unaltered) input list, then combine the selection, and finally
         // de-duplicate the results.
         using lops_t = decltype(lops);
         lops_t all;
-        for(auto & keyvalue : v_kvs){
+        for(const auto & keyvalue : cs.parts){
             auto l_lops = Whitelist(lops, keyvalue, Opts);
             all.splice(std::end(all), l_lops);
         }
@@ -79,40 +319,25 @@ Whitelist_Core( L lops,
         lops = all;
         YLOGDEBUG("Multiple selection: selected " << lops.size() << " elements after deduplication");
         return lops;
-    }while(false);
+    }
 
     // A keyword and a single key name.
     // For example, "keymissing@key".
-    do{
-        const auto regex_split = Compile_Regex("^keymissing@.*$");
-        if(!std::regex_match(Specifier, regex_split)) break; // Not a keymissing@key statement.
-        
-        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
-        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate keymissing@key specifier");
-        if(v_k_v.size() != 2) break; // Not a keymissing@key statement (hint: maybe multiple @'s present?).
-
+    if(cs.k == compiled_selector::kind::key_missing){
         // Emulate this feature using a bogus regex that will never match when the key is present, but treat NAs as if
         // they match. So the only thing that will match are objects lacking this key.
         auto Opts_l = Opts;
         Opts_l.nas = Regex_Selector_Opts::NAs::Include;
-        const std::string key = v_k_v.back();
         const std::string val = "gKNcTv4s5WXEsweUKIUqsDb7M0GvDI0J3G4LinJSKVYcSLg6V3GEQW2wa";
 
-        lops = Whitelist(lops, key, val, Opts_l);
+        lops = Whitelist(lops, cs.key, val, Opts_l);
         return lops;
-    }while(false);
+    }
 
     // Inverted regex key-value specifications stringified together.
     // For example, "!key@value".
-    do{
-        const auto regex_split = Compile_Regex("^[!].*@.*$");
-        if(!std::regex_match(Specifier, regex_split)) break; // Not a key@value statement.
-        
-        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
-        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate !key@value specifier");
-        if(v_k_v.size() != 2) break; // Not a key@value statement (hint: maybe multiple @'s present?).
-
-        auto lops_after = Whitelist(lops, v_k_v.front().substr(1), v_k_v.back(), Opts);
+    if(cs.k == compiled_selector::kind::inverted_key_value){
+        auto lops_after = Whitelist(lops, cs.key, cs.value, Opts);
         for(const auto &l : lops_after){
             if constexpr ( is_cc ){
                 lops.remove_if( [&](const auto &cc_refw){
@@ -122,148 +347,69 @@ Whitelist_Core( L lops,
                 lops.remove( l );
             }
         }
-
         return lops;
-    }while(false);
+    }
 
     // A single key-value specifications stringified together.
     // For example, "key@value".
-    do{
-        const auto regex_split = Compile_Regex("^.*@.*$");
-        if(!std::regex_match(Specifier, regex_split)) break; // Not a key@value statement.
-        
-        auto v_k_v = SplitStringToVector(Specifier, '@', 'd');
-        if(v_k_v.size() <= 1) throw std::logic_error("Unable to separate key@value specifier");
-        if(v_k_v.size() != 2) break; // Not a key@value statement (hint: maybe multiple @'s present?).
-
-        lops = Whitelist(lops, v_k_v.front(), v_k_v.back(), Opts);
+    if(cs.k == compiled_selector::kind::key_value){
+        lops = Whitelist(lops, cs.key, cs.value, Opts);
         return lops;
-    }while(false);
+    }
 
     // Single-word positional specifiers, i.e. "all", "none", "first", "last", or zero-based 
     // numerical specifiers, e.g., "#0" (front), "#1" (second), "#-0" (last), and "#-1" (second-from-last).
-    do{
-        const auto regex_none  = Compile_Regex("^[[:space:]]*non?e?[[:space:]]*$");
-        const auto regex_all   = Compile_Regex("^[[:space:]]*al?l?[[:space:]]*$");
-        const auto regex_1st   = Compile_Regex("^[[:space:]]*fir?s?t?[[:space:]]*$");
-        const auto regex_2nd   = Compile_Regex("^[[:space:]]*se?c?o?n?d?[[:space:]]*$");
-        const auto regex_3rd   = Compile_Regex("^[[:space:]]*th?i?r?d?[[:space:]]*$");
-        const auto regex_last  = Compile_Regex("^[[:space:]]*la?s?t?[[:space:]]*$");
-        const auto regex_pnum  = Compile_Regex("^[[:space:]]*[#][0-9]+[[:space:]]*$");
-        const auto regex_nnum  = Compile_Regex("^[[:space:]]*[#]-[0-9]+[[:space:]]*$");
-        const auto regex_numer = Compile_Regex("^[[:space:]]*num?e?r?o?u?s?[[:space:]]*$");
-        const auto regex_few   = Compile_Regex("^[[:space:]]*fewest?[[:space:]]*$");
-        const auto regex_moret = Compile_Regex("^[[:space:]]*mor?e?[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
-        const auto regex_fewt  = Compile_Regex("^[[:space:]]*fewer[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
-
-        const auto regex_i_none  = Compile_Regex("^[[:space:]]*[!][[:space:]]*non?e?[[:space:]]*$"); // Inverted variants of the above.
-        const auto regex_i_all   = Compile_Regex("^[[:space:]]*[!][[:space:]]*al?l?[[:space:]]*$");
-        const auto regex_i_1st   = Compile_Regex("^[[:space:]]*[!][[:space:]]*fir?s?t?[[:space:]]*$");
-        const auto regex_i_2nd   = Compile_Regex("^[[:space:]]*[!][[:space:]]*se?c?o?n?d?[[:space:]]*$");
-        const auto regex_i_3rd   = Compile_Regex("^[[:space:]]*[!][[:space:]]*th?i?r?d?[[:space:]]*$");
-        const auto regex_i_last  = Compile_Regex("^[[:space:]]*[!][[:space:]]*la?s?t?[[:space:]]*$");
-        const auto regex_i_pnum  = Compile_Regex("^[[:space:]]*[!][[:space:]]*[#][0-9]+[[:space:]]*$");
-        const auto regex_i_nnum  = Compile_Regex("^[[:space:]]*[!][[:space:]]*[#]-[0-9]+[[:space:]]*$");
-        const auto regex_i_numer = Compile_Regex("^[[:space:]]*[!][[:space:]]*num?e?r?o?u?s?[[:space:]]*$");
-        const auto regex_i_few   = Compile_Regex("^[[:space:]]*[!][[:space:]]*fewest?[[:space:]]*$");
-        const auto regex_i_moret = Compile_Regex("^[[:space:]]*[!][[:space:]]*mor?e?[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
-        const auto regex_i_fewt  = Compile_Regex("^[[:space:]]*[!][[:space:]]*fewer[-_]?t?h?[ae]?n?[-_]?[(][-]?[0-9]+[)][[:space:]]*$");
-        
-        if(std::regex_match(Specifier, regex_i_none)){
-            return lops;
-        }
-        if(std::regex_match(Specifier, regex_none)){
-            lops.clear();
-            return lops;
-        }
-
-        if(std::regex_match(Specifier, regex_i_all)){
-            lops.clear();
-            return lops;
-        }
-        if(std::regex_match(Specifier, regex_all)){
-            return lops;
-        }
-
-        if( std::regex_match(Specifier, regex_i_1st)
-        ||  std::regex_match(Specifier, regex_i_2nd) 
-        ||  std::regex_match(Specifier, regex_i_3rd)  ){
-            size_t N = 0; // Target.
-            if( std::regex_match(Specifier, regex_i_1st) ){ N = 1;
-            }else if( std::regex_match(Specifier, regex_i_2nd) ){ N = 2;
-            }else if( std::regex_match(Specifier, regex_i_3rd) ){ N = 3;
-            }else{
-                throw std::logic_error("Regex positional specifier not understood. Cannot continue.");
-            }
-
-            decltype(lops) out;
-            size_t i = 1;
-            for(const auto &l : lops) if(N != i++) out.emplace_back(l);
-            return out;
-        }
+    if(cs.k == compiled_selector::kind::none){
+        if(!cs.inverted) lops.clear();
+        return lops;
+    }
 
-        if( std::regex_match(Specifier, regex_1st)
-        ||  std::regex_match(Specifier, regex_2nd) 
-        ||  std::regex_match(Specifier, regex_3rd)  ){
-            size_t N = 0; // Target.
-            if( std::regex_match(Specifier, regex_1st) ){ N = 1;
-            }else if( std::regex_match(Specifier, regex_2nd) ){ N = 2;
-            }else if( std::regex_match(Specifier, regex_3rd) ){ N = 3;
-            }else{
-                throw std::logic_error("Regex positional specifier not understood. Cannot continue.");
-            }
+    if(cs.k == compiled_selector::kind::all){
+        if(cs.inverted) lops.clear();
+        return lops;
+    }
 
-            decltype(lops) out;
-            size_t i = 1;
-            for(const auto &l : lops) if(N == i++) out.emplace_back(l);
-            return out;
+    if(cs.k == compiled_selector::kind::nth){
+        const size_t N = static_cast<size_t>(cs.N); // Target.
+        decltype(lops) out;
+        size_t i = 1;
+        for(const auto &l : lops){
+            if((N == i++) != cs.inverted) out.emplace_back(l);
         }
+        return out;
+    }
 
-        if(std::regex_match(Specifier, regex_i_last)){
+    if(cs.k == compiled_selector::kind::last){
+        if(cs.inverted){
             if(!lops.empty()) lops.pop_back();
             return lops;
         }
-        if(std::regex_match(Specifier, regex_last)){
-            decltype(lops) out;
-            if(!lops.empty()) out.emplace_back(lops.back());
-            return out;
-        }
-
-        if(std::regex_match(Specifier, regex_i_pnum)){
-            auto pnum_extractor = std::regex("^[[:space:]]*[!][[:space:]]*[#]([0-9]+)[[:space:]]*$",
-                                             std::regex::icase |
-                                             std::regex::optimize |
-                                             std::regex::extended);
-            auto N = std::stoul(GetFirstRegex(Specifier, pnum_extractor));
+        decltype(lops) out;
+        if(!lops.empty()) out.emplace_back(lops.back());
+        return out;
+    }
 
+    if(cs.k == compiled_selector::kind::positive_number){
+        const auto N = static_cast<size_t>(cs.N);
+        if(cs.inverted){
             if(N < lops.size()){
                 auto l_it = std::next( lops.begin(), N );
                 lops.erase( l_it );
             }
             return lops;
         }
-        if(std::regex_match(Specifier, regex_pnum)){
-            auto pnum_extractor = std::regex("^[[:space:]]*[#]([0-9]+)[[:space:]]*$",
-                                             std::regex::icase |
-                                             std::regex::optimize |
-                                             std::regex::extended);
-            auto N = std::stoul(GetFirstRegex(Specifier, pnum_extractor));
 
-            decltype(lops) out;
-            if(N < lops.size()){
-                auto l_it = std::next( lops.begin(), N );
-                out.emplace_back(*l_it);
-            }
-            return out;
+        decltype(lops) out;
+        if(N < lops.size()){
+            auto l_it = std::next( lops.begin(), N );
+            out.emplace_back(*l_it);
         }
+        return out;
+    }
 
-        if(std::regex_match(Specifier, regex_i_nnum)){
-            auto nnum_extractor = std::regex("^[[:space:]]*[!][[:space:]]*[#]-([0-9]+)[[:space:]]*$",
-                                             std::regex::icase |
-                                             std::regex::optimize |
-                                             std::regex::extended);
-            auto N = std::stoul(GetFirstRegex(Specifier, nnum_extractor));
-
+    if(cs.k == compiled_selector::kind::negative_number){
+        const auto N = static_cast<size_t>(cs.N);
+        if(cs.inverted){
             if(N < lops.size()) return lops;
 
             // Note: this one is slightly harder than the rest because you cannot directly erase() a reverse iterator.
@@ -275,159 +421,130 @@ Whitelist_Core( L lops,
             }
             return out;
         }
-        if(std::regex_match(Specifier, regex_nnum)){
-            auto nnum_extractor = std::regex("^[[:space:]]*[#]-([0-9]+)[[:space:]]*$",
-                                             std::regex::icase |
-                                             std::regex::optimize |
-                                             std::regex::extended);
-            auto N = std::stoul(GetFirstRegex(Specifier, nnum_extractor));
 
-            decltype(lops) out;
-            if(N < lops.size()){
-                auto l_it = std::next( lops.rbegin(), N );
-                out.emplace_back(*l_it);
-            }
-            return out;
+        decltype(lops) out;
+        if(N < lops.size()){
+            auto l_it = std::next( lops.rbegin(), N );
+            out.emplace_back(*l_it);
         }
+        return out;
+    }
 
-        const auto extract_count = []( const typename decltype(lops)::value_type &l ) -> size_t {
-            constexpr bool is_cc = std::is_same< decltype(lops),
-                                                 decltype(All_CCs( Drover() )) >::value;
+    const auto extract_count = []( const typename decltype(lops)::value_type &l ) -> size_t {
+        constexpr bool is_cc = std::is_same< decltype(lops),
+                                             decltype(All_CCs( Drover() )) >::value;
 
-            if constexpr (is_cc){
-                // Do nothing.
-            }else{
-                if( (*l) == nullptr ){
-                    throw std::runtime_error("Encountered invalid pointer");
-                }
+        if constexpr (is_cc){
+            // Do nothing.
+        }else{
+            if( (*l) == nullptr ){
+                throw std::runtime_error("Encountered invalid pointer");
             }
+        }
 
-            size_t count = 0UL;
+        size_t count = 0UL;
 
-            if constexpr (is_cc){
-                count = l.get().contours.size();
-
-            }else if constexpr (std::is_same< decltype(lops),
-                                              std::list<std::list<std::shared_ptr<Image_Array>>::iterator> >::value){
-                count = (*l)->imagecoll.images.size();
-
-            }else if constexpr (std::is_same< decltype(lops),
-                                              std::list<std::list<std::shared_ptr<Point_Cloud>>::iterator> >::value){
-                count = (*l)->pset.points.size();
-
-            }else if constexpr (std::is_same< decltype(lops),
-                                              std::list<std::list<std::shared_ptr<Surface_Mesh>>::iterator> >::value){
-                // Not exactly sure what to do here, so let's go for total number of elements needed to specify
-                // the mesh, which is approximately related to the the number of bytes needed for storage (i.e.,
-                // one type of 'size').
-                count = (*l)->meshes.vertices.size() + (*l)->meshes.faces.size();
-
-            }else if constexpr (std::is_same< decltype(lops),
-                                              std::list<std::list<std::shared_ptr<RTPlan>>::iterator> >::value){
-                const auto count_static_keyframes = [](const RTPlan &t) -> size_t {
-                                                        size_t c = 0;
-                                                        for(const auto &ds : t.dynamic_states) c += ds.static_states.size();
-                                                        return c;
-                                                    };
-                count = count_static_keyframes(*(*l));
-
-            }else if constexpr (std::is_same< decltype(lops),
-                                              std::list<std::list<std::shared_ptr<Line_Sample>>::iterator> >::value){
-                count = (*l)->line.samples.size();
+        if constexpr (is_cc){
+            count = l.get().contours.size();
 
-            }else{
-                throw std::invalid_argument("The 'more-than' and 'fewer-than' selectors are not implemented for this data type");
-            }
-            return count;
-        };
+        }else if constexpr (std::is_same< decltype(lops),
+                                          std::list<std::list<std::shared_ptr<Image_Array>>::iterator> >::value){
+            count = (*l)->imagecoll.images.size();
 
-        // 'Numerous' and 'fewest' selectors.
-        {
-            const bool numerous_pos = std::regex_match(Specifier, regex_numer);
-            const bool numerous_neg = std::regex_match(Specifier, regex_i_numer);
+        }else if constexpr (std::is_same< decltype(lops),
+                                          std::list<std::list<std::shared_ptr<Point_Cloud>>::iterator> >::value){
+            count = (*l)->pset.points.size();
 
-            const bool fewest_pos = std::regex_match(Specifier, regex_few);
-            const bool fewest_neg = std::regex_match(Specifier, regex_i_few);
+        }else if constexpr (std::is_same< decltype(lops),
+                                          std::list<std::list<std::shared_ptr<Surface_Mesh>>::iterator> >::value){
+            // Not exactly sure what to do here, so let's go for total number of elements needed to specify
+            // the mesh, which is approximately related to the the number of bytes needed for storage (i.e.,
+            // one type of 'size').
+            count = (*l)->meshes.vertices.size() + (*l)->meshes.faces.size();
 
-            if( numerous_pos || numerous_neg || fewest_pos || fewest_neg ){
+        }else if constexpr (std::is_same< decltype(lops),
+                                          std::list<std::list<std::shared_ptr<RTPlan>>::iterator> >::value){
+            const auto count_static_keyframes = [](const RTPlan &t) -> size_t {
+                                                    size_t c = 0;
+                                                    for(const auto &ds : t.dynamic_states) c += ds.static_states.size();
+                                                    return c;
+                                                };
+            count = count_static_keyframes(*(*l));
 
-                if(lops.empty()) return lops;
+        }else if constexpr (std::is_same< decltype(lops),
+                                          std::list<std::list<std::shared_ptr<Line_Sample>>::iterator> >::value){
+            count = (*l)->line.samples.size();
 
-                auto m = std::max_element( std::begin(lops), std::end(lops),
-                                           [=]( const typename decltype(lops)::value_type &l,
-                                                const typename decltype(lops)::value_type &r ) -> bool {
-                    if constexpr (is_cc){
-                        // Do nothing.
-                    }else{
-                        if( ( (*l) == nullptr )
-                        ||  ( (*r) == nullptr ) ){
-                            throw std::runtime_error("Encountered invalid pointer");
-                        }
-                    }
+        }else{
+            throw std::invalid_argument("The 'more-than' and 'fewer-than' selectors are not implemented for this data type");
+        }
+        return count;
+    };
 
-                    const auto sort_order = [&](size_t l, size_t r) -> bool {
-                        return (numerous_pos || numerous_neg) ? (l < r) : (r < l);
-                    };
+    // 'Numerous' and 'fewest' selectors.
+    if( (cs.k == compiled_selector::kind::numerous)
+    ||  (cs.k == compiled_selector::kind::fewest) ){
+        if(lops.empty()) return lops;
 
-                    const auto N_l = extract_count(l);
-                    const auto N_r = extract_count(r);
+        const bool numerous = (cs.k == compiled_selector::kind::numerous);
+        auto m = std::max_element( std::begin(lops), std::end(lops),
+                                   [=]( const typename decltype(lops)::value_type &l,
+                                        const typename decltype(lops)::value_type &r ) -> bool {
+            if constexpr (is_cc){
+                // Do nothing.
+            }else{
+                if( ( (*l) == nullptr )
+                ||  ( (*r) == nullptr ) ){
+                    throw std::runtime_error("Encountered invalid pointer");
+                }
+            }
 
-                    return sort_order(N_l, N_r);
-                } );
+            const auto sort_order = [&](size_t l, size_t r) -> bool {
+                return (numerous) ? (l < r) : (r < l);
+            };
 
-                decltype(lops) largest;
-                largest.splice( std::end(largest), lops, m );
+            const auto N_l = extract_count(l);
+            const auto N_r = extract_count(r);
 
-                return (numerous_pos || fewest_pos) ? largest : lops;
-            }
-        }
+            return sort_order(N_l, N_r);
+        } );
 
-        // 'more_than(N)', 'fewer_than(N)', and inverted selectors.
-        {
-            const bool selector_moret = std::regex_match(Specifier, regex_moret);
-            const bool selector_fewt  = std::regex_match(Specifier, regex_fewt);
+        decltype(lops) largest;
+        largest.splice( std::end(largest), lops, m );
 
-            const bool selector_i_moret = std::regex_match(Specifier, regex_i_moret);
-            const bool selector_i_fewt  = std::regex_match(Specifier, regex_i_fewt);
+        return (cs.inverted) ? lops : largest;
+    }
 
-            if( selector_moret || selector_fewt || selector_i_moret || selector_i_fewt ){
-                if(lops.empty()) return lops;
+    // 'more_than(N)', 'fewer_than(N)', and inverted selectors.
+    if( (cs.k == compiled_selector::kind::more_than)
+    ||  (cs.k == compiled_selector::kind::fewer_than) ){
+        if(lops.empty()) return lops;
+
+        const auto N = cs.N;
+        const auto eval = [&](size_t count) -> bool {
+            const bool is_moret = (N < static_cast<int64_t>(count));
+            const bool is_fewt  = (static_cast<int64_t>(count) < N);
+            const bool selected = (cs.k == compiled_selector::kind::more_than) ? is_moret : is_fewt;
+            return (cs.inverted) ? !selected : selected;
+        };
 
-                const auto num_extractor = std::regex(".*[(]([-]?[0-9]+)[)][[:space:]]*$",
-                                                      std::regex::icase |
-                                                      std::regex::optimize |
-                                                      std::regex::extended);
-                const auto N = std::stol(GetFirstRegex(Specifier, num_extractor));
-
-                const auto eval = [&](size_t count) -> bool {
-                    const bool is_moret = (N < static_cast<int64_t>(count));
-                    const bool is_fewt  = (static_cast<int64_t>(count) < N);
-                    return (selector_moret) ? is_moret :
-                           (selector_fewt)  ? is_fewt :
-                           (selector_i_moret) ? !is_moret :
-                           (selector_i_fewt)  ? !is_fewt : false;
-                };
-
-                decltype(lops) out;
-                for(const auto &l : lops){
-                    if constexpr (is_cc){
-                        // Do nothing.
-                    }else{
-                        if( (*l) == nullptr ){
-                            throw std::runtime_error("Encountered invalid pointer");
-                        }
-                    }
-                    const size_t count = extract_count(l);
-
-                    if(eval(count)){
-                        out.emplace_back(l);
-                    }
+        decltype(lops) out;
+        for(const auto &l : lops){
+            if constexpr (is_cc){
+                // Do nothing.
+            }else{
+                if( (*l) == nullptr ){
+                    throw std::runtime_error("Encountered invalid pointer");
                 }
-                return out;
             }
-        }
+            const size_t count = extract_count(l);
 
-    }while(false);
+            if(eval(count)){
+                out.emplace_back(l);
+            }
+        }
+        return out;
+    }
 
     throw std::invalid_argument("Selection is not valid. Cannot continue.");
     decltype(lops) out;
@@ -465,6 +582,127 @@ Compile_Regex(const std::string& input){
                              std::regex::ECMAScript);
 }
 
+// Matchers for metadata values.
+//
+// Note: Compile_Regex() produces case-insensitive ECMAScript regexes, where '.' does not match line terminators.
+//       Literal fast-paths are only taken when they are guaranteed to agree with the regex.
+static
+bool
+is_literal_regex_char(char c){
+    const auto uc = static_cast<unsigned char>(c);
+    return (std::isalnum(uc) != 0)
+        || (c == ' ') || (c == '_') || (c == '-') || (c == ',') || (c == ':') || (c == '/')
+        || (c == '=') || (c == '#') || (c == '@') || (c == '%') || (c == '&') || (c == '~')
+        || (c == '<') || (c == '>') || (c == '\'') || (c == '"');
+}
+
+static
+bool
+contains_line_terminator(const std::string &s, size_t pos = 0){
+    return (s.find_first_of("\n\r", pos) != std::string::npos);
+}
+
+static
+bool
+iequal_prefix(const std::string &value, const std::string &literal){
+    if(value.size() < literal.size()) return false;
+    for(size_t i = 0; i < literal.size(); ++i){
+        const auto a = std::tolower(static_cast<unsigned char>(value[i]));
+        const auto b = std::tolower(static_cast<unsigned char>(literal[i]));
+        if(a != b) return false;
+    }
+    return true;
+}
+
+metadata_value_matcher::metadata_value_matcher(const std::string &pattern) : m(method::regex) {
+    // Strip anchors, which are redundant because the whole value must match.
+    std::string body = pattern;
+    if(!body.empty() && (body.front() == '^')) body.erase(0, 1);
+    if(!body.empty() && (body.back() == '$')) body.pop_back();
+
+    std::string l_literal = body;
+    bool has_wildcard_suffix = false;
+    if( (2 <= l_literal.size())
+    &&  (l_literal.compare(l_literal.size() - 2, 2, ".*") == 0) ){
+        l_literal.erase(l_literal.size() - 2);
+        has_wildcard_suffix = true;
+    }
+    const bool is_literal = std::all_of(std::begin(l_literal), std::end(l_literal), is_literal_regex_char);
+
+    if(is_literal && has_wildcard_suffix && l_literal.empty()){
+        this->m = method::any;
+    }else if(is_literal && has_wildcard_suffix){
+        this->m = method::prefix;
+        this->literal = l_literal;
+    }else if(is_literal){
+        this->m = method::exact;
+        this->literal = l_literal;
+    }else{
+        this->re = Compile_Regex(pattern);
+    }
+}
+
+bool metadata_value_matcher::matches(const std::string &value) const {
+    switch(this->m){
+        case method::any:
+            return !contains_line_terminator(value);
+        case method::exact:
+            return (value.size() == this->literal.size()) && iequal_prefix(value, this->literal);
+        case method::prefix:
+            return iequal_prefix(value, this->literal) && !contains_line_terminator(value, this->literal.size());
+        case method::regex:
+            return std::regex_match(value, this->re);
+    }
+    throw std::logic_error("Matcher method not understood. Cannot continue.");
+    return false;
+}
+
+metadata_value_matcher::method metadata_value_matcher::get_method() const {
+    return this->m;
+}
+
+std::shared_ptr<const metadata_value_matcher>
+Compile_Value_Matcher(const std::string &pattern){
+    static std::mutex m;
+    static std::map<std::string, std::shared_ptr<const metadata_value_matcher>> cache;
+    {
+        std::lock_guard<std::mutex> lock(m);
+        const auto it = cache.find(pattern);
+        if(it != std::end(cache)) return it->second;
+    }
+
+    // Compile outside the lock. Invalid regexes throw and are not cached.
+    auto vm = std::make_shared<const metadata_value_matcher>(pattern);
+
+    std::lock_guard<std::mutex> lock(m);
+    if(selector_cache_capacity <= cache.size()) cache.clear(); // Guard against unbounded growth.
+    return cache.emplace(pattern, vm).first->second;
+}
+
+// Memoizes match results for the distinct values encountered during a single selection pass.
+//
+// Many objects typically share the same metadata value (e.g., all contours in an ROI share an ROIName), so this
+// indexes values to results and evaluates the regex only once per distinct value.
+class memoized_value_matcher {
+    private:
+        std::shared_ptr<const metadata_value_matcher> vm;
+        std::unordered_map<std::string, bool> memo;
+
+    public:
+        explicit memoized_value_matcher(const std::string &pattern) : vm(Compile_Value_Matcher(pattern)) {};
+
+        bool operator()(const std::string &value){
+            if(this->vm->get_method() != metadata_value_matcher::method::regex){
+                return this->vm->matches(value);
+            }
+            const auto it = this->memo.find(value);
+            if(it != std::end(this->memo)) return it->second;
+            const bool res = this->vm->matches(value);
+            this->memo.emplace(value, res);
+            return res;
+        }
+};
+
 // A class for managing multiple mutually-exclusive regexes, e.g., method selectors.
 regex_group::regex_group() : prefix_length(2) {};
 
@@ -654,7 +892,7 @@ Whitelist( std::list<std::reference_wrapper<contour_collection<double>>> ccs,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     ccs.remove_if([&](std::reference_wrapper<contour_collection<double>> cc) -> bool {
         if(cc.get().contours.empty()) return true; // Remove collections containing no contours.
@@ -662,13 +900,13 @@ Whitelist( std::list<std::reference_wrapper<contour_collection<double>>> ccs,
         if(Opts.validation == Regex_Selector_Opts::Validation::Representative){
             auto ValueOpt = cc.get().contours.front().GetMetadataValueAs<std::string>(MetadataKey);
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("Regex selector representative->NAs option not understood. Cannot continue.");
 
@@ -685,7 +923,7 @@ Whitelist( std::list<std::reference_wrapper<contour_collection<double>>> ccs,
 
             }else{
                 for(const auto & Value : Values){
-                    if( !std::regex_match(Value,theregex) ) return true;
+                    if( !value_matches(Value) ) return true;
                 }
                 return false;
             }
@@ -849,7 +1087,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Image_Array>>::iterator> ias,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     ias.remove_if([&](std::list<std::shared_ptr<Image_Array>>::iterator iap_it) -> bool {
         if((*iap_it) == nullptr) return true;
@@ -858,13 +1096,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Image_Array>>::iterator> ias,
         if(Opts.validation == Regex_Selector_Opts::Validation::Representative){
             auto ValueOpt = (*iap_it)->imagecoll.images.front().GetMetadataValueAs<std::string>(MetadataKey);
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("Regex selector representative->NAs option not understood. Cannot continue.");
 
@@ -881,7 +1119,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Image_Array>>::iterator> ias,
 
             }else{
                 for(const auto & Value : Values){
-                    if( !std::regex_match(Value,theregex) ) return true;
+                    if( !value_matches(Value) ) return true;
                 }
                 return false;
             }
@@ -900,7 +1138,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Image_Array>>::iterator> ias,
            std::string Specifier,
            Regex_Selector_Opts Opts ){
 
-    return Whitelist_Core( std::move(ias), std::move(Specifier), Opts );
+    auto out = Whitelist_Core( std::move(ias), std::move(Specifier), Opts );
+
+    // Selection is how operations access image arrays, so any deferred pixel data are decoded now.
+    std::list<std::shared_ptr<Image_Array>> selected;
+    for(const auto &iap_it : out) selected.push_back(*iap_it);
+    Decode_Deferred_Pixels(selected);
+    return out;
 }
 
 
@@ -960,7 +1204,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Point_Cloud>>::iterator> pcs,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     pcs.remove_if([&](std::list<std::shared_ptr<Point_Cloud>>::iterator pcp_it) -> bool {
         if((*pcp_it) == nullptr) return true;
@@ -973,13 +1217,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Point_Cloud>>::iterator> pcs,
 
             auto ValueOpt = (*pcp_it)->pset.GetMetadataValueAs<std::string>(MetadataKey);
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -1060,7 +1304,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Surface_Mesh>>::iterator> sms,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     sms.remove_if([&](std::list<std::shared_ptr<Surface_Mesh>>::iterator smp_it) -> bool {
         if((*smp_it) == nullptr) return true;
@@ -1079,13 +1323,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Surface_Mesh>>::iterator> sms,
                       (*smp_it)->meshes.metadata[MetadataKey] :
                       std::optional<std::string>();
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -1166,7 +1410,7 @@ Whitelist( std::list<std::list<std::shared_ptr<RTPlan>>::iterator> tps,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     tps.remove_if([&](std::list<std::shared_ptr<RTPlan>>::iterator tpp_it) -> bool {
         if((*tpp_it) == nullptr) return true;
@@ -1186,13 +1430,13 @@ Whitelist( std::list<std::list<std::shared_ptr<RTPlan>>::iterator> tps,
             // TODO: support selection of Dynamic_Machine_State and Static_Machine_State metadata too.
 
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -1272,7 +1516,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Line_Sample>>::iterator> lss,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     lss.remove_if([&](std::list<std::shared_ptr<Line_Sample>>::iterator lsp_it) -> bool {
         if((*lsp_it) == nullptr) return true;
@@ -1288,13 +1532,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Line_Sample>>::iterator> lss,
                       (*lsp_it)->line.metadata[MetadataKey] :
                       std::optional<std::string>();
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -1372,7 +1616,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Transform3>>::iterator> t3s,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     t3s.remove_if([&](std::list<std::shared_ptr<Transform3>>::iterator t3p_it) -> bool {
         if((*t3p_it) == nullptr) return true;
@@ -1386,13 +1630,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Transform3>>::iterator> t3s,
                       (*t3p_it)->metadata[MetadataKey] :
                       std::optional<std::string>();
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -1469,7 +1713,7 @@ Whitelist( std::list<std::list<std::shared_ptr<Sparse_Table>>::iterator> sts,
            std::string MetadataValueRegex,
            Regex_Selector_Opts Opts ){
 
-    auto theregex = Compile_Regex(std::move(MetadataValueRegex));
+    memoized_value_matcher value_matches(MetadataValueRegex);
 
     sts.remove_if([&](std::list<std::shared_ptr<Sparse_Table>>::iterator stp_it) -> bool {
         if((*stp_it) == nullptr) return true;
@@ -1485,13 +1729,13 @@ Whitelist( std::list<std::list<std::shared_ptr<Sparse_Table>>::iterator> sts,
                       (*stp_it)->table.metadata[MetadataKey] :
                       std::optional<std::string>();
             if(ValueOpt){
-                return !(std::regex_match(ValueOpt.value(),theregex));
+                return !(value_matches(ValueOpt.value()));
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Include){
                 return false;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::Exclude){
                 return true;
             }else if(Opts.nas == Regex_Selector_Opts::NAs::TreatAsEmpty){
-                return !(std::regex_match("",theregex));
+                return !(value_matches(""));
             }
             throw std::logic_error("NAs option not understood. Cannot continue.");
         }
@@ -8,6 +8,8 @@
 #include <functional>
 #include <regex>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "YgorString.h"
 #include "YgorMath.h"
@@ -44,6 +46,37 @@ std::regex
 Compile_Regex(const std::string& input);
 
 
+// A matcher for metadata values that is equivalent to std::regex_match with a regex from Compile_Regex().
+//
+// Patterns that are effectively literals (e.g., 'Body', '^Body$', 'Body.*', or '.*') are matched using direct
+// case-insensitive string comparison, avoiding regex evaluation entirely. All other patterns fall back to the regex.
+class metadata_value_matcher {
+    public:
+        enum class method {
+            any,    // Matches every single-line value.
+            exact,  // Case-insensitive string equality.
+            prefix, // Case-insensitive prefix, followed by anything on the same line.
+            regex,  // Full regex evaluation.
+        };
+
+    private:
+        method m;
+        std::string literal;
+        std::regex re;
+
+    public:
+        explicit metadata_value_matcher(const std::string &pattern);
+
+        bool matches(const std::string &value) const;
+        method get_method() const;
+};
+
+// Retrieve a shared matcher for the given pattern. Matchers are compiled once and cached, so repeated evaluation of
+// the same selector avoids recompiling the regex.
+std::shared_ptr<const metadata_value_matcher>
+Compile_Value_Matcher(const std::string &pattern);
+
+
 // A class for managing multiple mutually-exclusive regexes, e.g., method selectors.
 class regex_group {
     private:
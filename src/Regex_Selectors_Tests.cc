@@ -0,0 +1,106 @@
+//Regex_Selectors_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the selector routines defined in Regex_Selectors.cc.
+// Tests are separated into their own file because Regex_Selectors_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <functional>
+#include <list>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorMath.h"
+
+#include "Structs.h"
+#include "Regex_Selectors.h"
+
+
+TEST_CASE("metadata_value_matcher agrees with regex matching"){
+    const std::vector<std::string> patterns = { ".*", "^.*$", "body", "^body$", "Body.*", "^Bo", "bo.*$",
+                                                "", "^$", "PTV 70", "ptv-70.*", "Left_Parotid",
+                                                "a|b", "b.dy", "[bB]ody", ".*body.*", "body.*.*", "x\\.y" };
+    const std::vector<std::string> values = { "", "body", "BODY", "Body ", "bodyx", "bo", "b",
+                                              "Body\nx", "Body\n", "\nBody", "\r",
+                                              "PTV 70", "ptv 70", "PTV-70", "ptv-70 extra", "ptv-70\n",
+                                              "Left_Parotid", "left_parotid", "a", "x.y" };
+
+    int64_t literal_count = 0;
+    for(const auto &p : patterns){
+        const metadata_value_matcher vm(p);
+        if(vm.get_method() != metadata_value_matcher::method::regex) ++literal_count;
+
+        const auto re = Compile_Regex(p);
+        for(const auto &v : values){
+            CAPTURE(p);
+            CAPTURE(v);
+            REQUIRE(vm.matches(v) == std::regex_match(v, re));
+        }
+    }
+
+    // Most common selectors should avoid regex evaluation entirely.
+    REQUIRE(metadata_value_matcher(".*").get_method() == metadata_value_matcher::method::any);
+    REQUIRE(metadata_value_matcher("^Body$").get_method() == metadata_value_matcher::method::exact);
+    REQUIRE(metadata_value_matcher("Body.*").get_method() == metadata_value_matcher::method::prefix);
+    REQUIRE(metadata_value_matcher(".*Body.*").get_method() == metadata_value_matcher::method::regex);
+    REQUIRE(12 <= literal_count);
+
+    // Matchers are shared.
+    REQUIRE(Compile_Value_Matcher("body").get() == Compile_Value_Matcher("body").get());
+}
+
+TEST_CASE("contour selectors"){
+    std::list<contour_collection<double>> storage;
+    const auto add_roi = [&](const std::string &name, int64_t N){
+        storage.emplace_back();
+        for(int64_t i = 0; i < N; ++i){
+            storage.back().contours.emplace_back();
+            storage.back().contours.back().closed = true;
+            storage.back().contours.back().points.emplace_back( vec3<double>(0.0, 0.0, 0.0) );
+            storage.back().contours.back().metadata["ROIName"] = name;
+        }
+    };
+    add_roi("Body", 3);
+    add_roi("PTV 70", 5);
+    add_roi("Left_Parotid", 1);
+    add_roi("body_outer", 2);
+
+    std::list<std::reference_wrapper<contour_collection<double>>> ccs;
+    for(auto &cc : storage) ccs.emplace_back( std::ref(cc) );
+
+    const auto names = [](const std::list<std::reference_wrapper<contour_collection<double>>> &l){
+        std::vector<std::string> out;
+        for(const auto &cc : l) out.emplace_back( cc.get().contours.front().metadata.at("ROIName") );
+        return out;
+    };
+
+    // Evaluate each selector twice, since the second evaluation uses cached programs.
+    for(int64_t pass = 0; pass < 2; ++pass){
+        REQUIRE(names(Whitelist(ccs, "all")) == std::vector<std::string>{"Body", "PTV 70", "Left_Parotid", "body_outer"});
+        REQUIRE(names(Whitelist(ccs, "!all")).empty());
+        REQUIRE(names(Whitelist(ccs, "none")).empty());
+        REQUIRE(names(Whitelist(ccs, "first")) == std::vector<std::string>{"Body"});
+        REQUIRE(names(Whitelist(ccs, "!first")) == std::vector<std::string>{"PTV 70", "Left_Parotid", "body_outer"});
+        REQUIRE(names(Whitelist(ccs, "second")) == std::vector<std::string>{"PTV 70"});
+        REQUIRE(names(Whitelist(ccs, "last")) == std::vector<std::string>{"body_outer"});
+        REQUIRE(names(Whitelist(ccs, "#2")) == std::vector<std::string>{"Left_Parotid"});
+        REQUIRE(names(Whitelist(ccs, "#-1")) == std::vector<std::string>{"Left_Parotid"});
+        REQUIRE(names(Whitelist(ccs, "numerous")) == std::vector<std::string>{"PTV 70"});
+        REQUIRE(names(Whitelist(ccs, "fewest")) == std::vector<std::string>{"Left_Parotid"});
+        REQUIRE(names(Whitelist(ccs, "more-than(2)")) == std::vector<std::string>{"Body", "PTV 70"});
+        REQUIRE(names(Whitelist(ccs, "!fewer-than(3)")) == std::vector<std::string>{"Body", "PTV 70"});
+
+        REQUIRE(names(Whitelist(ccs, "ROIName@body")) == std::vector<std::string>{"Body"});
+        REQUIRE(names(Whitelist(ccs, "ROIName@^body.*")) == std::vector<std::string>{"Body", "body_outer"});
+        REQUIRE(names(Whitelist(ccs, "!ROIName@body.*")) == std::vector<std::string>{"PTV 70", "Left_Parotid"});
+        REQUIRE(names(Whitelist(ccs, "ROIName@.*parotid|ptv.*")) == std::vector<std::string>{"PTV 70", "Left_Parotid"});
+        REQUIRE(names(Whitelist(ccs, "ROIName@body;ROIName@ptv 70")).size() == 2);
+        REQUIRE(names(Whitelist(ccs, "keymissing@ROIName")).empty());
+        REQUIRE(names(Whitelist(ccs, "keymissing@NormalizedROIName")).size() == 4);
+    }
+
+    REQUIRE_THROWS(Whitelist(ccs, "not a valid selector"));
+}
+
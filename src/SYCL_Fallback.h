@@ -4,6 +4,12 @@
 // It is meant to help compile and run SYCL code when the compiler or toolchain lacks support.
 // Code compiled with this mock header will NOT have any runtime support.
 // Based on the SYCL 2020 standard (but missing a lot of functionality!).
+//
+// Queues are in-order and asynchronous. Command groups are executed by a dispatcher thread owned by the queue, and
+// kernels are split into chunks that are run by a pool of worker threads. Submissions return an event that can be
+// waited on or passed to handler::depends_on(). Reductions accumulate into per-chunk partials that are combined in a
+// fixed order. Work-group barriers are supported (where ucontext is available) by switching work-items to cooperative
+// fibers when a barrier is first encountered.
 
 #ifndef SYCL_FALLBACK_HPP
 #define SYCL_FALLBACK_HPP
@@ -12,15 +18,27 @@
 #include <array>
 #include <functional>
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
 #include <memory>
 #include <iostream>
 #include <type_traits> // Required for std::enable_if and std::is_integral
 #include <exception>
+#include <stdexcept>
 #include <cmath>
 #include <condition_variable>
+#include <deque>
+#include <limits>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <tuple>
+#include <utility>
+
+#if defined(__linux__) && __has_include(<ucontext.h>)
+    #include <ucontext.h>
+    #define SYCL_FALLBACK_HAS_FIBERS 1
+#endif
 
 #include "YgorThreadPool.h"
 
@@ -35,6 +53,16 @@ namespace info {
         vendor,
         version
     };
+
+    enum class event : int {
+        command_execution_status
+    };
+
+    enum class event_command_status : int {
+        submitted,
+        running,
+        complete
+    };
 }
 
 namespace access {
@@ -43,6 +71,33 @@ namespace access {
     enum class placeholder { false_t, true_t };
 }
 
+// Properties are accepted for compatibility. Queues are always in-order.
+namespace property {
+    namespace queue {
+        struct in_order {};
+    }
+    namespace reduction {
+        struct initialize_to_identity {};
+    }
+}
+
+class property_list {
+    bool init_to_identity = false;
+
+    void add(const property::queue::in_order &){}
+    void add(const property::reduction::initialize_to_identity &){ this->init_to_identity = true; }
+
+public:
+    template <typename... Props,
+              typename = std::enable_if_t<((std::is_same_v<Props, property::queue::in_order>
+                                         || std::is_same_v<Props, property::reduction::initialize_to_identity>) && ...)>>
+    property_list(Props... props){
+        (this->add(props), ...);
+    }
+
+    bool initializes_to_identity() const { return this->init_to_identity; }
+};
+
 
 // =============================================================================
 // Forward declarations
@@ -72,7 +127,7 @@ struct range {
     std::array<size_t, Dims> dims;
 
     // Use SFINAE to ensure we only catch integer types
-    template<typename... Args, 
+    template<typename... Args,
              typename = std::enable_if_t<(std::is_integral_v<Args> && ...)>>
     range(Args... args) : dims{static_cast<size_t>(args)...} {}
 
@@ -93,12 +148,12 @@ struct id {
     std::array<size_t, Dims> val;
 
     id() : val{} {}
-    
+
     // Use SFINAE to ensure we only catch integer types
-    template<typename... Args, 
+    template<typename... Args,
              typename = std::enable_if_t<(std::is_integral_v<Args> && ...)>>
     id(Args... args) : val{static_cast<size_t>(args)...} {}
-    
+
     // Allow implicit conversion from array for internal loop logic
     id(const std::array<size_t, Dims>& arr) : val(arr) {}
 
@@ -112,10 +167,11 @@ struct item {
     range<Dims> r;
     id<Dims> i;
 
-    item(range<Dims> range_val, id<Dims> id_val) 
+    item(range<Dims> range_val, id<Dims> id_val)
         : r(range_val), i(id_val) {}
 
     id<Dims> get_id() const { return i; }
+    size_t get_id(int d) const { return i[d]; }
     range<Dims> get_range() const { return r; }
     size_t get_linear_id() const {
         size_t idx = 0;
@@ -129,6 +185,116 @@ struct item {
     }
 };
 
+namespace detail {
+
+// Row-major conversions between multi-dimensional and linear indices.
+template <int Dims>
+size_t linearize(const id<Dims> &i, const range<Dims> &r){
+    size_t idx = 0;
+    for(int d = 0; d < Dims; ++d){
+        idx = idx * r[d] + i[d];
+    }
+    return idx;
+}
+
+template <int Dims>
+id<Dims> delinearize(size_t linear, const range<Dims> &r){
+    std::array<size_t, Dims> out{};
+    for(int d = Dims - 1; d >= 0; --d){
+        out[d] = linear % r[d];
+        linear /= r[d];
+    }
+    return id<Dims>(out);
+}
+
+// Advance to the next index in row-major order.
+template <int Dims>
+void increment(id<Dims> &i, const range<Dims> &r){
+    for(int d = Dims - 1; d >= 0; --d){
+        if(++(i.val[d]) < r[d]) return;
+        i.val[d] = 0U;
+    }
+}
+
+class group_executor;
+
+} // namespace detail
+
+template <int Dims>
+class nd_range {
+    range<Dims> global_r;
+    range<Dims> local_r;
+
+public:
+    nd_range(range<Dims> global_size, range<Dims> local_size)
+        : global_r(global_size), local_r(local_size) {}
+
+    range<Dims> get_global_range() const { return global_r; }
+    range<Dims> get_local_range() const { return local_r; }
+    range<Dims> get_group_range() const {
+        std::array<size_t, Dims> out{};
+        for(int d = 0; d < Dims; ++d){
+            out[d] = (local_r[d] == 0U) ? 0U : global_r[d] / local_r[d];
+        }
+        range<Dims> r;
+        r.dims = out;
+        return r;
+    }
+};
+
+template <int Dims>
+class group {
+    id<Dims> group_id;
+    range<Dims> group_r;
+    range<Dims> local_r;
+    detail::group_executor *executor = nullptr;
+
+    template <int D> friend void group_barrier(const group<D> &);
+
+public:
+    group(id<Dims> gid, range<Dims> gr, range<Dims> lr, detail::group_executor *ex)
+        : group_id(gid), group_r(gr), local_r(lr), executor(ex) {}
+
+    id<Dims> get_group_id() const { return group_id; }
+    size_t get_group_id(int d) const { return group_id[d]; }
+    size_t operator[](int d) const { return group_id[d]; }
+    range<Dims> get_local_range() const { return local_r; }
+    range<Dims> get_group_range() const { return group_r; }
+    size_t get_group_linear_id() const { return detail::linearize(group_id, group_r); }
+    size_t get_local_linear_range() const { return local_r.size(); }
+};
+
+template <int Dims>
+class nd_item {
+    id<Dims> global_id;
+    id<Dims> local_id;
+    range<Dims> global_r;
+    group<Dims> grp;
+
+public:
+    nd_item(id<Dims> gid, id<Dims> lid, range<Dims> gr, group<Dims> g)
+        : global_id(gid), local_id(lid), global_r(gr), grp(g) {}
+
+    id<Dims> get_global_id() const { return global_id; }
+    size_t get_global_id(int d) const { return global_id[d]; }
+    size_t get_global_linear_id() const { return detail::linearize(global_id, global_r); }
+    id<Dims> get_local_id() const { return local_id; }
+    size_t get_local_id(int d) const { return local_id[d]; }
+    size_t get_local_linear_id() const { return detail::linearize(local_id, grp.get_local_range()); }
+    group<Dims> get_group() const { return grp; }
+    size_t get_group(int d) const { return grp.get_group_id(d); }
+    size_t get_group_linear_id() const { return grp.get_group_linear_id(); }
+    range<Dims> get_global_range() const { return global_r; }
+    size_t get_global_range(int d) const { return global_r[d]; }
+    range<Dims> get_local_range() const { return grp.get_local_range(); }
+    size_t get_local_range(int d) const { return grp.get_local_range()[d]; }
+    range<Dims> get_group_range() const { return grp.get_group_range(); }
+    size_t get_group_range(int d) const { return grp.get_group_range()[d]; }
+
+    // Deprecated in SYCL 2020 in favour of group_barrier(), but still widely used.
+    void barrier() const { group_barrier(grp); }
+};
+
 class device {
 public:
     // SYCL 2020 get_info uses template specialization
@@ -143,10 +309,109 @@ public:
     }
 };
 
+
+// =============================================================================
+// Synchronization: event
+// =============================================================================
+
+namespace detail {
+
+// Completion state shared by an event and the command it represents.
+struct event_state {
+    std::mutex m;
+    std::condition_variable cv;
+    info::event_command_status status = info::event_command_status::submitted;
+    std::exception_ptr exception = nullptr;
+    bool exception_reported = false;
+
+    void set_running(){
+        std::lock_guard<std::mutex> lock(this->m);
+        this->status = info::event_command_status::running;
+    }
+
+    void finish(std::exception_ptr e){
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            this->exception = e;
+            this->status = info::event_command_status::complete;
+        }
+        this->cv.notify_all();
+    }
+
+    void wait(){
+        std::unique_lock<std::mutex> lock(this->m);
+        this->cv.wait(lock, [&](){ return this->status == info::event_command_status::complete; });
+    }
+
+    // Asynchronous errors are delivered only once, either via the event or the queue.
+    std::exception_ptr take_exception(){
+        std::lock_guard<std::mutex> lock(this->m);
+        if(this->exception_reported) return nullptr;
+        this->exception_reported = true;
+        return this->exception;
+    }
+};
+
+} // namespace detail
+
+class event {
+    std::shared_ptr<detail::event_state> state;
+
+public:
+    // A default-constructed event is already complete.
+    event() = default;
+    explicit event(std::shared_ptr<detail::event_state> s) : state(std::move(s)) {}
+
+    void wait(){
+        if(this->state) this->state->wait();
+    }
+    void wait_and_throw(){
+        this->wait();
+        if(this->state){
+            if(auto e = this->state->take_exception()) std::rethrow_exception(e);
+        }
+    }
+    static void wait(const std::vector<event> &events){
+        for(auto e : events) e.wait();
+    }
+    static void wait_and_throw(const std::vector<event> &events){
+        for(auto e : events) e.wait_and_throw();
+    }
+
+    template <info::event Param>
+    info::event_command_status get_info() const {
+        static_assert(Param == info::event::command_execution_status, "Unsupported event query");
+        if(!this->state) return info::event_command_status::complete;
+        std::lock_guard<std::mutex> lock(this->state->m);
+        return this->state->status;
+    }
+};
+
+
 // =============================================================================
-// Memory Model: buffer, accessor
+// Memory Model: buffer, accessor, local_accessor
 // =============================================================================
 
+namespace detail {
+
+// Tracks the most recent command to access a buffer, so the buffer can wait for it upon destruction.
+struct buffer_state {
+    std::mutex m;
+    event last;
+
+    ~buffer_state(){
+        this->last.wait();
+    }
+};
+
+// Work-group local memory for the work-group currently being executed on this thread.
+inline char *& local_memory_base(){
+    static thread_local char *base = nullptr;
+    return base;
+}
+
+} // namespace detail
+
 // Minimal buffer: Manages ownership or wraps existing pointers
 template <typename T, int Dims = 1>
 class buffer {
@@ -155,35 +420,42 @@ class buffer {
     range<Dims> r;
     bool use_host_ptr = false;
 
+    // Destroyed (and therefore waited on) before the storage is released.
+    std::shared_ptr<detail::buffer_state> state = std::make_shared<detail::buffer_state>();
+
 public:
     // Constructor: Owns data
-    buffer(range<Dims> r) : r(r), data_storage(std::make_shared<std::vector<T>>(r.size())) {}
+    buffer(range<Dims> r) : data_storage(std::make_shared<std::vector<T>>(r.size())), r(r) {}
 
     // Constructor: Wraps host pointer
     buffer(T* data, range<Dims> r) : host_ptr(data), r(r), use_host_ptr(true) {}
 
+    ~buffer(){
+        // Copies share the state; the last copy to be destroyed waits for outstanding work.
+        this->state.reset();
+    }
+
     // Internal helper to get raw pointer
     T* get_pointer() const {
         return use_host_ptr ? host_ptr : data_storage->data();
     }
 
     range<Dims> get_range() const { return r; }
+
+    const std::shared_ptr<detail::buffer_state> & get_state() const { return state; }
 };
 
 // Accessor: The view into the buffer
-template <typename T, int Dims = 1, 
-          access::mode Mode = access::mode::read_write, 
+template <typename T, int Dims = 1,
+          access::mode Mode = access::mode::read_write,
           access::target Target = access::target::global_buffer>
 class accessor {
     T* ptr;
     range<Dims> r;
 
 public:
-    // Update: Accept a reference to the handler
-    accessor(buffer<T, Dims>& buf, handler& /*h*/) 
-        : ptr(buf.get_pointer()), r(buf.get_range()) {
-        //h.require(*this); // Register the dependency (even if it's a no-op)
-    }
+    // Registers the buffer with the command group, so the buffer can wait for the command.
+    accessor(buffer<T, Dims>& buf, handler& h);
 
     // 1D Access
     T& operator[](id<1> index) const {
@@ -202,6 +474,34 @@ public:
     T& operator[](id<3> index) const {
         return ptr[index[0] * (r[1] * r[2]) + index[1] * r[2] + index[2]];
     }
+
+    T* get_pointer() const { return ptr; }
+    range<Dims> get_range() const { return r; }
+};
+
+// Work-group local scratch memory. Storage is allocated for each work-group as it is executed, and is shared by the
+// work-items in the group. Contents are uninitialized.
+template <typename T, int Dims = 1>
+class local_accessor {
+    size_t offset = 0;
+    range<Dims> r;
+
+public:
+    local_accessor(range<Dims> r, handler& h);
+
+    T* get_pointer() const {
+        return reinterpret_cast<T*>(detail::local_memory_base() + this->offset);
+    }
+
+    T& operator[](size_t index) const {
+        return this->get_pointer()[index];
+    }
+    T& operator[](id<Dims> index) const {
+        return this->get_pointer()[detail::linearize(index, r)];
+    }
+
+    range<Dims> get_range() const { return r; }
+    size_t size() const { return r.size(); }
 };
 
 // =============================================================================
@@ -212,183 +512,761 @@ template <typename T, int Dims>
 accessor(buffer<T, Dims>&, handler&) -> accessor<T, Dims, access::mode::read_write, access::target::global_buffer>;
 
 
+// =============================================================================
+// Reductions
+// =============================================================================
+
+template <typename T = void>
+struct plus {
+    T operator()(const T &a, const T &b) const { return a + b; }
+};
+template <>
+struct plus<void> {
+    template <typename T>
+    T operator()(const T &a, const T &b) const { return a + b; }
+};
+
+template <typename T = void>
+struct minimum {
+    T operator()(const T &a, const T &b) const { return (b < a) ? b : a; }
+};
+template <>
+struct minimum<void> {
+    template <typename T>
+    T operator()(const T &a, const T &b) const { return (b < a) ? b : a; }
+};
+
+template <typename T = void>
+struct maximum {
+    T operator()(const T &a, const T &b) const { return (a < b) ? b : a; }
+};
+template <>
+struct maximum<void> {
+    template <typename T>
+    T operator()(const T &a, const T &b) const { return (a < b) ? b : a; }
+};
+
+namespace detail {
+
+template <typename Op, template <typename> class Functor>
+struct is_functor : std::false_type {};
+template <typename T, template <typename> class Functor>
+struct is_functor<Functor<T>, Functor> : std::true_type {};
+
+// The identity of the built-in operations for arithmetic types.
+template <typename T, typename Op>
+T known_identity(){
+    static_assert(std::is_arithmetic_v<T>, "An explicit identity is required for this reduction");
+    if constexpr (is_functor<Op, plus>::value){
+        return T{};
+    }else if constexpr (is_functor<Op, minimum>::value){
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max();
+    }else if constexpr (is_functor<Op, maximum>::value){
+        return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::lowest();
+    }else{
+        static_assert(!std::is_same_v<T, T>, "An explicit identity is required for this reduction");
+    }
+}
+
+template <typename T, typename Op>
+struct reduction_descriptor {
+    using value_type = T;
+    using operation_type = Op;
+
+    T *var;
+    T identity;
+    Op op;
+    bool initialize_to_identity;
+};
+
+template <typename T>
+struct is_reduction : std::false_type {};
+template <typename T, typename Op>
+struct is_reduction<reduction_descriptor<T, Op>> : std::true_type {};
+
+} // namespace detail
+
+// Accumulates a work-item's contributions to a reduction.
+template <typename T, typename Op>
+class reducer {
+    T value;
+    Op op;
+
+public:
+    reducer(T identity, Op o) : value(identity), op(o) {}
+
+    reducer& combine(const T &v){
+        this->value = this->op(this->value, v);
+        return *this;
+    }
+
+    template <typename U = T, typename = std::enable_if_t<detail::is_functor<Op, plus>::value, U>>
+    reducer& operator+=(const U &v){
+        return this->combine(v);
+    }
+    template <typename U = T, typename = std::enable_if_t<detail::is_functor<Op, plus>::value, U>>
+    reducer& operator++(){
+        return this->combine(static_cast<T>(1));
+    }
+
+    const T & get() const { return this->value; }
+};
+
+template <typename T, typename Op>
+detail::reduction_descriptor<T, Op>
+reduction(T *var, Op op, const property_list &props = {}){
+    return { var, detail::known_identity<T, Op>(), op, props.initializes_to_identity() };
+}
+
+template <typename T, typename Op>
+detail::reduction_descriptor<T, Op>
+reduction(T *var, const T &identity, Op op, const property_list &props = {}){
+    return { var, identity, op, props.initializes_to_identity() };
+}
+
+template <typename T, typename Op>
+detail::reduction_descriptor<T, Op>
+reduction(buffer<T, 1> &buf, handler &h, Op op, const property_list &props = {});
+
+
 // =============================================================================
 // Execution Model: handler, queue
 // =============================================================================
 
-class handler {
-    work_queue<std::function<void(void)>>* task_queue = nullptr;
-    size_t worker_hint = 1;
+namespace detail {
+
+using task_queue_t = work_queue<std::function<void(void)>>;
+
+// The number of chunks a kernel is divided into.
+inline size_t chunk_count(size_t total_work_items, size_t worker_hint){
+    constexpr size_t chunks_per_worker = 4U;
+    return std::min(total_work_items, std::max<size_t>(worker_hint * chunks_per_worker, 1U));
+}
+
+// Run f(chunk, begin, end) for each chunk using the worker pool, blocking until all chunks are complete. The first
+// exception encountered is rethrown.
+template <typename Submitter>
+void run_chunks(task_queue_t *task_queue, size_t total_work_items, size_t N_chunks, Submitter submitter){
+    if(total_work_items == 0){
+        return;
+    }
+    if((task_queue == nullptr) || (N_chunks <= 1U)){
+        for(size_t chunk = 0; chunk < N_chunks; ++chunk){
+            submitter(chunk, (total_work_items * chunk) / N_chunks, (total_work_items * (chunk + 1U)) / N_chunks);
+        }
+        return;
+    }
+
+    std::mutex completion_mutex;
+    std::condition_variable completion_cv;
+    size_t completed_chunks = 0;
+    std::mutex exception_mutex;
+    std::exception_ptr captured_exception = nullptr;
+
+    for(size_t chunk = 0; chunk < N_chunks; ++chunk){
+        const size_t begin = (total_work_items * chunk) / N_chunks;
+        const size_t end = (total_work_items * (chunk + 1U)) / N_chunks;
+        if(begin >= end){
+            std::lock_guard<std::mutex> lock(completion_mutex);
+            ++completed_chunks;
+            continue;
+        }
+
+        task_queue->submit_task([&, chunk, begin, end](){
+            try{
+                submitter(chunk, begin, end);
+            }catch(...){
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if(!captured_exception){
+                    captured_exception = std::current_exception();
+                }
+            }
+            std::lock_guard<std::mutex> lock(completion_mutex);
+            ++completed_chunks;
+            completion_cv.notify_one();
+        });
+    }
 
-    template <typename Submitter>
-    void run_chunks(size_t total_work_items, Submitter submitter){
-        constexpr size_t chunks_per_worker = 4U;
-        if(total_work_items == 0){
+    std::unique_lock<std::mutex> lock(completion_mutex);
+    completion_cv.wait(lock, [&](){ return completed_chunks == N_chunks; });
+    lock.unlock();
+
+    if(captured_exception){
+        std::rethrow_exception(captured_exception);
+    }
+}
+
+// Executes the work-items of one work-group at a time on the current thread.
+//
+// Work-items are run sequentially, which is cheap, unless the kernel contains barriers. To detect them, the first
+// work-item is run as a fiber. If it reaches a barrier, every work-item in the group is run as a fiber and the
+// fibers are switched cooperatively so that all work-items reach each barrier before any proceed. SYCL requires
+// barriers to be encountered by all work-items in a group, so subsequent groups use the same strategy.
+class group_executor {
+    std::unique_ptr<std::max_align_t[]> local_memory;
+
+    void (*fn)(void *, size_t) = nullptr;
+    void *fn_ctx = nullptr;
+    size_t N_items = 0;
+
+    enum class barrier_use { unknown, absent, present };
+    barrier_use barriers = barrier_use::unknown;
+
+#ifdef SYCL_FALLBACK_HAS_FIBERS
+    static constexpr size_t fiber_stack_size = 256U * 1024U;
+
+    ucontext_t scheduler_ctx;
+    std::vector<ucontext_t> fiber_ctxs;
+    std::vector<std::unique_ptr<char[]>> fiber_stacks;
+    std::vector<char> finished;
+    size_t current = 0;
+    bool in_fiber = false;
+    std::exception_ptr fiber_exception = nullptr;
+
+    static group_executor *& active(){
+        static thread_local group_executor *ex = nullptr;
+        return ex;
+    }
+
+    static void fiber_entry(){
+        auto *ex = active();
+        const size_t i = ex->current;
+        try{
+            ex->fn(ex->fn_ctx, i);
+        }catch(...){
+            if(!ex->fiber_exception) ex->fiber_exception = std::current_exception();
+        }
+        ex->finished[i] = 1;
+        // Returning resumes the scheduler via uc_link.
+    }
+
+    void start_fiber(size_t i){
+        if(!this->fiber_stacks[i]){
+            this->fiber_stacks[i] = std::make_unique<char[]>(fiber_stack_size);
+        }
+        auto &ctx = this->fiber_ctxs[i];
+        if(getcontext(&ctx) != 0){
+            throw std::runtime_error("Unable to create work-item fiber");
+        }
+        ctx.uc_stack.ss_sp = this->fiber_stacks[i].get();
+        ctx.uc_stack.ss_size = fiber_stack_size;
+        ctx.uc_link = &(this->scheduler_ctx);
+        makecontext(&ctx, &group_executor::fiber_entry, 0);
+        this->finished[i] = 0;
+        this->resume_fiber(i);
+    }
+
+    void resume_fiber(size_t i){
+        active() = this;
+        this->current = i;
+        this->in_fiber = true;
+        swapcontext(&(this->scheduler_ctx), &(this->fiber_ctxs[i]));
+        this->in_fiber = false;
+    }
+
+    void run_fibers(bool first_started){
+        // The first work-item (if started) is already waiting at a barrier.
+        for(size_t i = (first_started ? 1U : 0U); i < this->N_items; ++i){
+            this->start_fiber(i);
+        }
+        // Each round releases every waiting work-item from the barrier they all reached in the previous round.
+        while(true){
+            bool any_waiting = false;
+            for(size_t i = 0; i < this->N_items; ++i){
+                if(!this->finished[i]){
+                    any_waiting = true;
+                    this->resume_fiber(i);
+                }
+            }
+            if(!any_waiting) break;
+        }
+        if(this->fiber_exception){
+            auto e = this->fiber_exception;
+            this->fiber_exception = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+#endif // SYCL_FALLBACK_HAS_FIBERS
+
+public:
+    explicit group_executor(size_t local_bytes){
+        const size_t N = (local_bytes + sizeof(std::max_align_t) - 1U) / sizeof(std::max_align_t);
+        if(0U < N){
+            this->local_memory = std::make_unique<std::max_align_t[]>(N);
+        }
+    }
+
+    template <typename F>
+    void run_group(size_t N, F &f){
+        this->fn = [](void *ctx, size_t i){ (*static_cast<F*>(ctx))(i); };
+        this->fn_ctx = static_cast<void*>(&f);
+        this->N_items = N;
+        local_memory_base() = reinterpret_cast<char*>(this->local_memory.get());
+
+#ifdef SYCL_FALLBACK_HAS_FIBERS
+        // Contexts must not be relocated while fibers are suspended, so storage is only grown between groups.
+        if(this->fiber_ctxs.size() < N){
+            this->fiber_ctxs.resize(N);
+            this->fiber_stacks.resize(N);
+        }
+        this->finished.assign(N, 1);
+        if((this->barriers == barrier_use::unknown) && (1U < N)){
+            this->start_fiber(0U);
+            this->barriers = this->finished[0] ? barrier_use::absent : barrier_use::present;
+            if(this->barriers == barrier_use::present){
+                this->run_fibers(true);
+                return;
+            }
+            if(this->fiber_exception){
+                auto e = this->fiber_exception;
+                this->fiber_exception = nullptr;
+                std::rethrow_exception(e);
+            }
+            for(size_t i = 1U; i < N; ++i) this->fn(this->fn_ctx, i);
+            return;
+        }
+        if(this->barriers == barrier_use::present){
+            this->run_fibers(false);
             return;
         }
+#endif // SYCL_FALLBACK_HAS_FIBERS
+        for(size_t i = 0U; i < N; ++i) this->fn(this->fn_ctx, i);
+    }
 
-        const size_t desired_chunks = std::min(total_work_items, std::max<size_t>(worker_hint * chunks_per_worker, 1U));
-        if((task_queue == nullptr) || (desired_chunks <= 1U)){
-            submitter(0U, total_work_items);
+    void barrier(){
+#ifdef SYCL_FALLBACK_HAS_FIBERS
+        if(this->in_fiber){
+            const size_t i = this->current;
+            this->in_fiber = false;
+            swapcontext(&(this->fiber_ctxs[i]), &(this->scheduler_ctx));
             return;
         }
+#endif // SYCL_FALLBACK_HAS_FIBERS
+        if(this->N_items <= 1U) return;
+        throw std::runtime_error("Work-group barriers are not supported here, or were encountered non-uniformly");
+    }
+};
 
-        std::mutex completion_mutex;
-        std::condition_variable completion_cv;
-        size_t completed_chunks = 0;
-        std::mutex exception_mutex;
-        std::exception_ptr captured_exception = nullptr;
+// Invoke a kernel with an index and any reducers.
+template <int Dims, typename Func, typename... Reducers>
+void invoke_range_kernel(const Func &kernel, const range<Dims> &r, const id<Dims> &i, Reducers&... reducers){
+    if constexpr (std::is_invocable_v<const Func&, item<Dims>, Reducers&...>) {
+        kernel(item<Dims>(r, i), reducers...);
+    } else {
+        kernel(i, reducers...);
+    }
+}
 
-        for(size_t chunk = 0; chunk < desired_chunks; ++chunk){
-            const size_t begin = (total_work_items * chunk) / desired_chunks;
-            const size_t end = (total_work_items * (chunk + 1U)) / desired_chunks;
-            if(begin >= end){
-                std::lock_guard<std::mutex> lock(completion_mutex);
-                ++completed_chunks;
-                continue;
-            }
+template <typename Tuple, size_t... Is>
+auto make_reducers(const Tuple &reductions, std::index_sequence<Is...>){
+    return std::make_tuple( reducer<typename std::tuple_element_t<Is, Tuple>::value_type,
+                                    typename std::tuple_element_t<Is, Tuple>::operation_type>(
+                                std::get<Is>(reductions).identity, std::get<Is>(reductions).op )... );
+}
+
+// Combine the per-chunk partials, in chunk order, into the reduction variable.
+template <size_t I, typename Reduction, typename Partials>
+void finalize_reduction(const Reduction &red, const Partials &partials){
+    auto acc = red.initialize_to_identity ? red.identity : *(red.var);
+    for(const auto &p : partials){
+        acc = red.op(acc, std::get<I>(p).get());
+    }
+    *(red.var) = acc;
+}
+
+template <typename Tuple, typename Partials, size_t... Is>
+void finalize_reductions(const Tuple &reductions, const Partials &partials, std::index_sequence<Is...>){
+    ( finalize_reduction<Is>(std::get<Is>(reductions), partials), ... );
+}
+
+} // namespace detail
+
+template <int Dims>
+void group_barrier(const group<Dims> &g){
+    if(g.executor != nullptr) g.executor->barrier();
+}
 
-            task_queue->submit_task([&, begin, end](){
-                try{
-                    submitter(begin, end);
-                }catch(...){
-                    std::lock_guard<std::mutex> lock(exception_mutex);
-                    if(!captured_exception){
-                        captured_exception = std::current_exception();
+class handler {
+    friend class queue;
+    template <typename T, int Dims, access::mode Mode, access::target Target> friend class accessor;
+    template <typename T, int Dims> friend class local_accessor;
+    template <typename T, typename Op>
+    friend detail::reduction_descriptor<T, Op> reduction(buffer<T, 1> &, handler &, Op, const property_list &);
+
+    detail::task_queue_t* task_queue = nullptr;
+    size_t worker_hint = 1;
+
+    std::function<void(void)> command;
+    std::vector<event> dependencies;
+    std::vector<std::shared_ptr<detail::buffer_state>> buffers;
+    size_t local_bytes = 0;
+
+    void set_command(std::function<void(void)> f){
+        if(this->command){
+            throw std::logic_error("A command group can only contain a single command");
+        }
+        this->command = std::move(f);
+    }
+
+    void register_buffer(const std::shared_ptr<detail::buffer_state> &s){
+        this->buffers.emplace_back(s);
+    }
+
+    size_t reserve_local_memory(size_t bytes, size_t alignment){
+        const size_t offset = ((this->local_bytes + alignment - 1U) / alignment) * alignment;
+        this->local_bytes = offset + bytes;
+        return offset;
+    }
+
+    template <int Dims, typename Func, typename Reductions>
+    void set_range_command(range<Dims> r, Func kernel, Reductions reductions){
+        auto *tq = this->task_queue;
+        const size_t workers = this->worker_hint;
+        this->set_command([=](){
+            const size_t total = r.size();
+            const size_t N_chunks = detail::chunk_count(total, workers);
+            constexpr auto N_reductions = std::tuple_size_v<Reductions>;
+            const auto is = std::make_index_sequence<N_reductions>();
+            std::vector<decltype(detail::make_reducers(reductions, is))> partials;
+            for(size_t i = 0; i < N_chunks; ++i) partials.emplace_back(detail::make_reducers(reductions, is));
+
+            detail::run_chunks(tq, total, N_chunks, [&](size_t chunk, size_t begin, size_t end){
+                std::apply([&](auto&... reducers){
+                    auto i = detail::delinearize(begin, r);
+                    for(size_t linear = begin; linear < end; ++linear){
+                        detail::invoke_range_kernel(kernel, r, i, reducers...);
+                        detail::increment(i, r);
                     }
-                }
-                std::lock_guard<std::mutex> lock(completion_mutex);
-                ++completed_chunks;
-                completion_cv.notify_one();
+                }, partials[chunk]);
             });
+            detail::finalize_reductions(reductions, partials, is);
+        });
+    }
+
+    template <int Dims, typename Func, typename Reductions>
+    void set_nd_range_command(nd_range<Dims> ndr, Func kernel, Reductions reductions){
+        const auto global_r = ndr.get_global_range();
+        const auto local_r = ndr.get_local_range();
+        const auto group_r = ndr.get_group_range();
+        for(int d = 0; d < Dims; ++d){
+            if((local_r[d] == 0U) || (global_r[d] % local_r[d] != 0U)){
+                throw std::invalid_argument("Global range must be a positive multiple of the local range");
+            }
         }
 
-        std::unique_lock<std::mutex> lock(completion_mutex);
-        completion_cv.wait(lock, [&](){ return completed_chunks == desired_chunks; });
-        lock.unlock();
+        auto *tq = this->task_queue;
+        const size_t workers = this->worker_hint;
+        const size_t local_mem = this->local_bytes;
+        this->set_command([=](){
+            const size_t N_groups = group_r.size();
+            const size_t N_local = local_r.size();
+            const size_t N_chunks = detail::chunk_count(N_groups, workers);
+            constexpr auto N_reductions = std::tuple_size_v<Reductions>;
+            const auto is = std::make_index_sequence<N_reductions>();
+            std::vector<decltype(detail::make_reducers(reductions, is))> partials;
+            for(size_t i = 0; i < N_chunks; ++i) partials.emplace_back(detail::make_reducers(reductions, is));
+
+            detail::run_chunks(tq, N_groups, N_chunks, [&](size_t chunk, size_t begin, size_t end){
+                auto &p = partials[chunk];
+                detail::group_executor executor(local_mem);
+                for(size_t g = begin; g < end; ++g){
+                    const auto group_id = detail::delinearize(g, group_r);
+                    const group<Dims> grp(group_id, group_r, local_r, &executor);
+                    auto work_item = [&](size_t l){
+                        const auto local_id = detail::delinearize(l, local_r);
+                        std::array<size_t, Dims> global_id{};
+                        for(int d = 0; d < Dims; ++d) global_id[d] = group_id[d] * local_r[d] + local_id[d];
+                        const nd_item<Dims> it(id<Dims>(global_id), local_id, global_r, grp);
+                        std::apply([&](auto&... reducers){ kernel(it, reducers...); }, p);
+                    };
+                    executor.run_group(N_local, work_item);
+                }
+                detail::local_memory_base() = nullptr;
+            });
+            detail::finalize_reductions(reductions, partials, is);
+        });
+    }
 
-        if(captured_exception){
-            std::rethrow_exception(captured_exception);
+    // Separate the trailing kernel from the leading reductions.
+    template <typename Range, typename Tuple, size_t... Is>
+    void dispatch(const Range &r, Tuple &&args, std::index_sequence<Is...>){
+        constexpr size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+        auto reductions = std::make_tuple(std::get<Is>(args)...);
+        static_assert((detail::is_reduction<std::decay_t<std::tuple_element_t<Is, std::decay_t<Tuple>>>>::value && ...),
+                      "Only reductions can precede the kernel");
+        auto kernel = std::get<N - 1U>(args);
+        if constexpr (std::is_same_v<Range, nd_range<1>> || std::is_same_v<Range, nd_range<2>> || std::is_same_v<Range, nd_range<3>>){
+            this->set_nd_range_command(r, std::move(kernel), std::move(reductions));
+        }else{
+            this->set_range_command(r, std::move(kernel), std::move(reductions));
         }
     }
 
 public:
     handler() = default;
 
-    handler(work_queue<std::function<void(void)>>* q, size_t n_workers)
+    handler(detail::task_queue_t* q, size_t n_workers)
         : task_queue(q), worker_hint(std::max<size_t>(n_workers, 1U)) {}
 
     // Factory for creating accessors from buffers within a command group
     template <typename T, int Dims, access::mode Mode, access::target Target>
-    void require(const accessor<T, Dims, Mode, Target>& acc) {
-        // No-op in synchronous CPU fallback
+    void require(const accessor<T, Dims, Mode, Target>&) {
+        // No-op: buffers are registered when accessors are created.
+    }
+
+    // The command will not begin until the given commands have completed.
+    void depends_on(event e){
+        this->dependencies.emplace_back(std::move(e));
+    }
+    void depends_on(const std::vector<event> &events){
+        this->dependencies.insert(std::end(this->dependencies), std::begin(events), std::end(events));
     }
 
     // --- PARALLEL FOR IMPLEMENTATIONS ---
 
-    // 1D
-    template <typename KernelName = void, typename Func>
-    void parallel_for(range<1> r, Func kernel) {
-        this->run_chunks(r[0], [&](size_t begin, size_t end){
-            for (size_t i = begin; i < end; ++i) {
-                if constexpr (std::is_invocable_v<Func, item<1>>) {
-                    kernel(item<1>(r, id<1>(i)));
-                } else {
-                    kernel(id<1>(i));
-                }
-            }
-        });
+    // Arguments are zero or more reductions followed by the kernel. The kernel accepts an item or id, followed by
+    // one reducer per reduction.
+    template <typename KernelName = void, int Dims, typename... Rest>
+    void parallel_for(range<Dims> r, Rest&&... rest) {
+        static_assert(0U < sizeof...(Rest), "A kernel is required");
+        this->dispatch(r, std::forward_as_tuple(rest...), std::make_index_sequence<sizeof...(Rest) - 1U>());
+    }
+
+    // The kernel accepts an nd_item, followed by one reducer per reduction.
+    template <typename KernelName = void, int Dims, typename... Rest>
+    void parallel_for(nd_range<Dims> r, Rest&&... rest) {
+        static_assert(0U < sizeof...(Rest), "A kernel is required");
+        this->dispatch(r, std::forward_as_tuple(rest...), std::make_index_sequence<sizeof...(Rest) - 1U>());
     }
 
-    // 2D
     template <typename KernelName = void, typename Func>
-    void parallel_for(range<2> r, Func kernel) {
-        const size_t total = r[0] * r[1];
-        this->run_chunks(total, [&](size_t begin, size_t end){
-            for (size_t linear = begin; linear < end; ++linear) {
-                const size_t i = linear / r[1];
-                const size_t j = linear % r[1];
-                id<2> idx(i, j);
-                if constexpr (std::is_invocable_v<Func, item<2>>) {
-                    kernel(item<2>(r, idx));
-                } else {
-                    kernel(idx);
-                }
+    void single_task(Func kernel) {
+        this->set_command([=](){ kernel(); });
+    }
+
+    void memcpy(void *dest, const void *src, size_t num_bytes) {
+        this->set_command([=](){ std::memcpy(dest, src, num_bytes); });
+    }
+
+    template <typename T>
+    void fill(T *ptr, const T &pattern, size_t count) {
+        this->set_command([=](){ std::fill(ptr, ptr + count, pattern); });
+    }
+};
+
+template <typename T, int Dims, access::mode Mode, access::target Target>
+accessor<T, Dims, Mode, Target>::accessor(buffer<T, Dims>& buf, handler& h)
+    : ptr(buf.get_pointer()), r(buf.get_range()) {
+    h.register_buffer(buf.get_state());
+}
+
+template <typename T, int Dims>
+local_accessor<T, Dims>::local_accessor(range<Dims> r_in, handler& h)
+    : offset(h.reserve_local_memory(sizeof(T) * r_in.size(), alignof(T))), r(r_in) {}
+
+template <typename T, typename Op>
+detail::reduction_descriptor<T, Op>
+reduction(buffer<T, 1> &buf, handler &h, Op op, const property_list &props){
+    h.register_buffer(buf.get_state());
+    return { buf.get_pointer(), detail::known_identity<T, Op>(), op, props.initializes_to_identity() };
+}
+
+namespace detail {
+
+// Commands are executed in submission order by a dedicated dispatcher thread, which divides each kernel among the
+// worker pool. The host thread is free to continue (e.g., to submit more commands) while kernels execute.
+class queue_state {
+  public:
+    task_queue_t task_queue;
+    size_t worker_count;
+
+  private:
+    struct pending_command {
+        std::function<void(void)> command;
+        std::vector<event> dependencies;
+        std::shared_ptr<event_state> state;
+    };
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<pending_command> pending;
+    bool stopping = false;
+    std::vector<std::shared_ptr<event_state>> outstanding; // Events whose errors have not been reported.
+    event last;
+    std::thread dispatcher;
+
+    void dispatch_loop(){
+        while(true){
+            pending_command pc;
+            {
+                std::unique_lock<std::mutex> lock(this->m);
+                this->cv.wait(lock, [&](){ return this->stopping || !this->pending.empty(); });
+                if(this->pending.empty()) return;
+                pc = std::move(this->pending.front());
+                this->pending.pop_front();
             }
-        });
+
+            std::exception_ptr e = nullptr;
+            try{
+                for(auto &d : pc.dependencies) d.wait();
+                pc.state->set_running();
+                pc.command();
+            }catch(...){
+                e = std::current_exception();
+            }
+            pc.state->finish(e);
+        }
     }
 
-    // 3D
-    template <typename KernelName = void, typename Func>
-    void parallel_for(range<3> r, Func kernel) {
-        const size_t row_size = r[2];
-        const size_t plane_size = r[1] * r[2];
-        const size_t total = r[0] * plane_size;
-        this->run_chunks(total, [&](size_t begin, size_t end){
-            for (size_t linear = begin; linear < end; ++linear) {
-                const size_t i = linear / plane_size;
-                const size_t rem = linear % plane_size;
-                const size_t j = rem / row_size;
-                const size_t k = rem % row_size;
-                id<3> idx(i, j, k);
-                if constexpr (std::is_invocable_v<Func, item<3>>) {
-                    kernel(item<3>(r, idx));
-                } else {
-                    kernel(idx);
-                }
+  public:
+    explicit queue_state(size_t workers)
+        : task_queue(static_cast<unsigned int>(workers)),
+          worker_count(workers),
+          dispatcher([this](){ this->dispatch_loop(); }) {}
+
+    ~queue_state(){
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            this->stopping = true;
+        }
+        this->cv.notify_all();
+        this->dispatcher.join();
+    }
+
+    event enqueue(std::function<void(void)> command, std::vector<event> dependencies){
+        auto state = std::make_shared<event_state>();
+        event ev(state);
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            // Forget completed commands that succeeded.
+            this->outstanding.erase(std::remove_if(std::begin(this->outstanding), std::end(this->outstanding),
+                                                   [](const std::shared_ptr<event_state> &s){
+                                                       std::lock_guard<std::mutex> lock(s->m);
+                                                       return (s->status == info::event_command_status::complete)
+                                                           && !s->exception;
+                                                   }),
+                                    std::end(this->outstanding));
+            this->outstanding.emplace_back(state);
+            this->pending.push_back({ std::move(command), std::move(dependencies), state });
+            this->last = ev;
+        }
+        this->cv.notify_one();
+        return ev;
+    }
+
+    // Since commands execute in order, waiting for the latest command waits for all commands.
+    void wait(){
+        event ev;
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            ev = this->last;
+        }
+        ev.wait();
+    }
+
+    exception_list take_exceptions(){
+        std::vector<std::shared_ptr<event_state>> states;
+        {
+            std::lock_guard<std::mutex> lock(this->m);
+            states.swap(this->outstanding);
+        }
+        exception_list out;
+        for(auto &s : states){
+            bool complete = false;
+            {
+                std::lock_guard<std::mutex> lock(s->m);
+                complete = (s->status == info::event_command_status::complete);
             }
-        });
+            if(!complete){
+                std::lock_guard<std::mutex> lock(this->m);
+                this->outstanding.emplace_back(s);
+                continue;
+            }
+            if(auto e = s->take_exception()) out.emplace_back(e);
+        }
+        return out;
     }
 };
 
+} // namespace detail
+
 class queue {
     std::function<void(exception_list)> async_handler;
-    size_t worker_count = 1;
-    std::shared_ptr<work_queue<std::function<void(void)>>> task_queue;
+    std::shared_ptr<detail::queue_state> state;
     device dev_instance;
 
     void initialize_task_queue(){
         constexpr unsigned int fallback_worker_count = 2U;
         const unsigned int hw = std::thread::hardware_concurrency();
-        this->worker_count = (hw == 0U) ? fallback_worker_count : static_cast<size_t>(hw);
-        this->task_queue = std::make_shared<work_queue<std::function<void(void)>>>(static_cast<unsigned int>(this->worker_count));
+        const size_t worker_count = (hw == 0U) ? fallback_worker_count : static_cast<size_t>(hw);
+        this->state = std::make_shared<detail::queue_state>(worker_count);
     }
 
 public:
     // Simple constructor
-    queue() : dev_instance() { this->initialize_task_queue(); } 
-    queue(default_selector_t) : dev_instance() { this->initialize_task_queue(); }
+    queue() : dev_instance() { this->initialize_task_queue(); }
+    queue(const property_list &) : dev_instance() { this->initialize_task_queue(); }
+    queue(default_selector_t, const property_list & = {}) : dev_instance() { this->initialize_task_queue(); }
     template <class AsyncHandler>
-    queue(default_selector_t, AsyncHandler h) : async_handler(h), dev_instance() { this->initialize_task_queue(); }
+    queue(default_selector_t, AsyncHandler h, const property_list & = {}) : async_handler(h), dev_instance() { this->initialize_task_queue(); }
 
-    // Submit a command group function (CGF)
+    // Submit a command group function (CGF). The CGF is evaluated immediately, but the command it defines executes
+    // asynchronously, after all previously submitted commands.
     template <typename T>
-    void submit(T cgf) {
-        handler h(this->task_queue.get(), this->worker_count);
+    event submit(T cgf) {
+        handler h(&(this->state->task_queue), this->state->worker_count);
         cgf(h);
+        if(!h.command){
+            return event();
+        }
+        auto ev = this->state->enqueue(std::move(h.command), std::move(h.dependencies));
+        for(auto &b : h.buffers){
+            std::lock_guard<std::mutex> lock(b->m);
+            b->last = ev;
+        }
+        return ev;
     }
 
     void wait() {
-        // No-op: execution is already done
+        this->state->wait();
     }
+
+    // Deliver any asynchronous errors to the asynchronous handler. Without a handler, the first error is rethrown.
+    void throw_asynchronous() {
+        auto errors = this->state->take_exceptions();
+        if(errors.empty()) return;
+        if(this->async_handler){
+            this->async_handler(errors);
+        }else{
+            std::rethrow_exception(errors.front());
+        }
+    }
+
     void wait_and_throw() {
-        // No-op: execution is already done and no async backend exists.
+        this->wait();
+        this->throw_asynchronous();
     }
 
-    template <typename Func>
-    void parallel_for(range<1> r, Func kernel){
-        handler h(this->task_queue.get(), this->worker_count);
-        h.parallel_for(r, kernel);
+    template <typename KernelName = void, int Dims, typename... Rest>
+    event parallel_for(range<Dims> r, Rest&&... rest){
+        return this->submit([&](handler &h){ h.parallel_for(r, std::forward<Rest>(rest)...); });
     }
-    template <typename Func>
-    void parallel_for(range<2> r, Func kernel){
-        handler h(this->task_queue.get(), this->worker_count);
-        h.parallel_for(r, kernel);
+    template <typename KernelName = void, int Dims, typename... Rest>
+    event parallel_for(nd_range<Dims> r, Rest&&... rest){
+        return this->submit([&](handler &h){ h.parallel_for(r, std::forward<Rest>(rest)...); });
     }
-    template <typename Func>
-    void parallel_for(range<3> r, Func kernel){
-        handler h(this->task_queue.get(), this->worker_count);
-        h.parallel_for(r, kernel);
+    template <typename KernelName = void, typename Func>
+    event single_task(Func kernel){
+        return this->submit([&](handler &h){ h.single_task(kernel); });
+    }
+    event memcpy(void *dest, const void *src, size_t num_bytes){
+        return this->submit([&](handler &h){ h.memcpy(dest, src, num_bytes); });
+    }
+    template <typename T>
+    event fill(T *ptr, const T &pattern, size_t count){
+        return this->submit([&](handler &h){ h.fill(ptr, pattern, count); });
     }
 
     // Other helpers
@@ -414,7 +1292,6 @@ inline double floor(double v){ return std::floor(v); }
 inline double sqrt(double v){ return std::sqrt(v); }
 inline double exp(double v){ return std::exp(v); }
 
-
 // =============================================================================
 // Image Sampling Support (fallback implementation)
 // =============================================================================
@@ -4,8 +4,13 @@
 #include <numeric>
 #include <iostream>
 #include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <set>
 #include <mutex>
+#include <stdexcept>
 #include <thread>
 
 #include "doctest20251212/doctest.h"
@@ -51,6 +56,7 @@ TEST_CASE("SYCL 2D: Matrix Indexing") {
             acc[idx] = static_cast<int>(idx[0] * 10 + idx[1]);
         });
     });
+    q.wait();
 
     // Verify row 2, col 5
     CHECK(matrix[2 * COLS + 5] == 25);
@@ -71,6 +77,7 @@ TEST_CASE("SYCL 3D: Volumetric Indexing") {
             acc[idx] = 1;
         });
     });
+    q.wait();
 
     // Check a few points
     CHECK(volume[0] == 1);
@@ -104,6 +111,7 @@ TEST_CASE("SYCL Kernel Signatures: item vs id") {
             acc[it.get_id()] = 200;
         });
     });
+    q.wait();
 
     CHECK(data_id[0] == 100);
     CHECK(data_item[0] == 200);
@@ -129,7 +137,7 @@ TEST_CASE("SYCL 1D: Each Index Executed Exactly Once") {
     sycl::queue q;
     q.parallel_for(sycl::range<1>(N), [&](sycl::id<1> idx) {
         counts[idx[0]].fetch_add(1, std::memory_order_relaxed);
-    });
+    }).wait();
 
     size_t n_incorrect = 0;
     for(const auto &v : counts){
@@ -148,7 +156,7 @@ TEST_CASE("SYCL 2D: parallel_for Direct Queue API") {
     sycl::queue q;
     q.parallel_for(sycl::range<2>(rows, cols), [&](sycl::id<2> idx) {
         matrix[idx[0] * cols + idx[1]] = static_cast<int>((idx[0] + 1U) * (idx[1] + 1U));
-    });
+    }).wait();
 
     CHECK(matrix[0] == 1);
     CHECK(matrix[(rows - 1U) * cols + (cols - 1U)] == static_cast<int>(rows * cols));
@@ -163,7 +171,7 @@ TEST_CASE("SYCL Parallel Execution Uses Multiple Worker Threads") {
     q.parallel_for(sycl::range<1>(N), [&](sycl::id<1>) {
         std::lock_guard<std::mutex> lock(thread_ids_mutex);
         thread_ids.insert(std::this_thread::get_id());
-    });
+    }).wait();
 
     if(std::thread::hardware_concurrency() > 1U){
         CHECK(thread_ids.size() > 1U);
@@ -194,3 +202,219 @@ TEST_CASE("SYCL Sampled Image Nearest and Linear Modes") {
     sycl::sampled_image<float, 3> linear_img(data.data(), 2, 2, 1, 1, linear_sampler);
     CHECK(linear_img.read(0.5, 0.5, 0.0).x == doctest::Approx(15.0f));
 }
+
+TEST_CASE("SYCL Reductions: sum, min, and max") {
+    const size_t N = 10007;
+    std::vector<double> data(N);
+    for(size_t i = 0; i < N; ++i){
+        data[i] = static_cast<double>((i * 7919U) % N) - 100.0;
+    }
+    const double *d = data.data();
+
+    sycl::queue q;
+    double sum = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    int64_t count = 1000; // Combined with the result, since it is not initialized to the identity.
+    q.parallel_for(sycl::range<1>(N),
+                   sycl::reduction(&sum, sycl::plus<double>(),
+                                   sycl::property_list{sycl::property::reduction::initialize_to_identity{}}),
+                   sycl::reduction(&min, sycl::minimum<double>(),
+                                   sycl::property_list{sycl::property::reduction::initialize_to_identity{}}),
+                   sycl::reduction(&max, sycl::maximum<>(),
+                                   sycl::property_list{sycl::property::reduction::initialize_to_identity{}}),
+                   sycl::reduction(&count, sycl::plus<>()),
+                   [=](sycl::id<1> i, auto &s, auto &lo, auto &hi, auto &c) {
+        s += d[i[0]];
+        lo.combine(d[i[0]]);
+        hi.combine(d[i[0]]);
+        ++c;
+    }).wait();
+
+    CHECK(sum == doctest::Approx(std::accumulate(data.begin(), data.end(), 0.0)));
+    CHECK(min == *std::min_element(data.begin(), data.end()));
+    CHECK(max == *std::max_element(data.begin(), data.end()));
+    CHECK(count == static_cast<int64_t>(N) + 1000);
+
+    SUBCASE("multi-dimensional ranges with item kernels and explicit identities"){
+        int64_t product = 1;
+        q.parallel_for(sycl::range<3>(3, 4, 5),
+                       sycl::reduction(&product, int64_t(1), std::multiplies<int64_t>()),
+                       [=](sycl::item<3> it, auto &p) {
+            p.combine( (it.get_linear_id() % 3U == 0U) ? 2 : 1 );
+        });
+        q.wait();
+        CHECK(product == (int64_t(1) << 20));
+    }
+
+    SUBCASE("reductions into buffers"){
+        std::vector<int> sum_storage(1, 0);
+        {
+            sycl::buffer<int, 1> buf(sum_storage.data(), sycl::range<1>(1));
+            q.submit([&](sycl::handler &h) {
+                auto red = sycl::reduction(buf, h, sycl::plus<int>());
+                h.parallel_for(sycl::range<1>(100), red, [=](sycl::id<1> i, auto &s) {
+                    s += static_cast<int>(i[0]);
+                });
+            });
+        }
+        CHECK(sum_storage[0] == 4950);
+    }
+}
+
+TEST_CASE("SYCL nd_range: work-group ids and local memory with barriers") {
+    const size_t N = 4096;
+    const size_t L = 64;
+    std::vector<double> data(N);
+    std::iota(data.begin(), data.end(), 0.0);
+    std::vector<double> group_sums(N / L, 0.0);
+    std::vector<size_t> ids(N, 0);
+    const double *in = data.data();
+    double *out = group_sums.data();
+    size_t *id_out = ids.data();
+
+    sycl::queue q;
+    q.submit([&](sycl::handler &h) {
+        sycl::local_accessor<double, 1> scratch(sycl::range<1>(L), h);
+        h.parallel_for(sycl::nd_range<1>(sycl::range<1>(N), sycl::range<1>(L)), [=](sycl::nd_item<1> it) {
+            const size_t g = it.get_global_id(0);
+            const size_t l = it.get_local_id(0);
+            id_out[g] = it.get_group(0) * it.get_local_range(0) + l;
+            scratch[l] = in[g];
+            sycl::group_barrier(it.get_group());
+
+            // Tree reduction in local memory.
+            for(size_t stride = L / 2U; 0U < stride; stride /= 2U){
+                if(l < stride){
+                    scratch[l] += scratch[l + stride];
+                }
+                it.barrier();
+            }
+            if(l == 0U){
+                out[it.get_group_linear_id()] = scratch[0];
+            }
+        });
+    });
+    q.wait_and_throw();
+
+    size_t n_incorrect = 0;
+    for(size_t i = 0; i < N; ++i){
+        if(ids[i] != i) ++n_incorrect;
+    }
+    CHECK(n_incorrect == 0U);
+    for(size_t g = 0; g < N / L; ++g){
+        const double first = static_cast<double>(g * L);
+        const double expected = L * first + static_cast<double>(L * (L - 1U)) / 2.0;
+        CHECK(group_sums[g] == doctest::Approx(expected));
+    }
+
+    SUBCASE("kernels without barriers and with reductions"){
+        double total = 0.0;
+        q.parallel_for(sycl::nd_range<2>(sycl::range<2>(32, 32), sycl::range<2>(8, 4)),
+                       sycl::reduction(&total, sycl::plus<double>()),
+                       [=](sycl::nd_item<2> it, auto &s) {
+            s += static_cast<double>(it.get_global_linear_id());
+        }).wait();
+        CHECK(total == doctest::Approx(1024.0 * 1023.0 / 2.0));
+    }
+
+    SUBCASE("invalid work-group sizes are rejected"){
+        CHECK_THROWS(q.parallel_for(sycl::nd_range<1>(sycl::range<1>(100), sycl::range<1>(7)), [=](sycl::nd_item<1>) {}));
+    }
+}
+
+TEST_CASE("SYCL Events: asynchronous submission, dependencies, and errors") {
+    const size_t N = 1 << 16;
+    std::vector<double> a(N, 1.0);
+    std::vector<double> b(N, 0.0);
+    double *pa = a.data();
+    double *pb = b.data();
+
+    sycl::queue q1;
+    sycl::queue q2;
+
+    // Commands on one queue execute in order.
+    q1.parallel_for(sycl::range<1>(N), [=](sycl::id<1> i) { pa[i[0]] *= 2.0; });
+    auto e1 = q1.parallel_for(sycl::range<1>(N), [=](sycl::id<1> i) { pa[i[0]] += 1.0; });
+
+    // Commands on another queue can depend on them.
+    auto e2 = q2.submit([&](sycl::handler &h) {
+        h.depends_on(e1);
+        h.parallel_for(sycl::range<1>(N), [=](sycl::id<1> i) { pb[i[0]] = pa[i[0]] * 10.0; });
+    });
+    e2.wait();
+    CHECK(e1.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::complete);
+    CHECK(b.front() == doctest::Approx(30.0));
+    CHECK(b.back() == doctest::Approx(30.0));
+
+    SUBCASE("single tasks and memory operations"){
+        double v = 0.0;
+        q1.fill(pb, 5.0, N);
+        q1.single_task([=]() { pb[0] += 1.0; });
+        q1.memcpy(&v, pb, sizeof(double)).wait();
+        CHECK(v == doctest::Approx(6.0));
+        CHECK(b[1] == doctest::Approx(5.0));
+    }
+
+    SUBCASE("errors are delivered to the asynchronous handler"){
+        size_t N_errors = 0;
+        sycl::queue qe(sycl::default_selector_v, [&](sycl::exception_list l){ N_errors += l.size(); });
+        qe.parallel_for(sycl::range<1>(10), [=](sycl::id<1> i) {
+            if(i[0] == 5U) throw std::runtime_error("test");
+        });
+        qe.wait_and_throw();
+        CHECK(N_errors == 1U);
+
+        // Errors are only reported once.
+        qe.wait_and_throw();
+        CHECK(N_errors == 1U);
+
+        sycl::queue qn;
+        auto e = qn.single_task([=]() { throw std::runtime_error("test"); });
+        CHECK_THROWS(e.wait_and_throw());
+        CHECK_NOTHROW(qn.wait_and_throw());
+    }
+}
+
+TEST_CASE("SYCL Reduction benchmark") {
+    // Compare a serial host accumulation (as required without reductions) with a reduction kernel.
+    const size_t N = 1 << 24;
+    std::vector<float> a(N);
+    std::vector<float> b(N);
+    for(size_t i = 0; i < N; ++i){
+        a[i] = static_cast<float>(i % 1000U) * 0.01f;
+        b[i] = static_cast<float>((i * 7U) % 1000U) * 0.01f;
+    }
+    const float *pa = a.data();
+    const float *pb = b.data();
+
+    sycl::queue q;
+    std::vector<double> terms(N);
+    double *pt = terms.data();
+
+    const auto t_start = std::chrono::steady_clock::now();
+    q.parallel_for(sycl::range<1>(N), [=](sycl::id<1> i) {
+        const double d = static_cast<double>(pa[i[0]]) - static_cast<double>(pb[i[0]]);
+        pt[i[0]] = d * d;
+    }).wait();
+    double serial = 0.0;
+    for(const auto &t : terms) serial += t;
+    const auto t_serial = std::chrono::steady_clock::now();
+
+    double reduced = 0.0;
+    q.parallel_for(sycl::range<1>(N),
+                   sycl::reduction(&reduced, sycl::plus<double>()),
+                   [=](sycl::id<1> i, auto &s) {
+        const double d = static_cast<double>(pa[i[0]]) - static_cast<double>(pb[i[0]]);
+        s += d * d;
+    }).wait();
+    const auto t_reduced = std::chrono::steady_clock::now();
+
+    const auto ms = [](auto t0, auto t1){
+        return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / 1000.0;
+    };
+    MESSAGE("Sum of squared differences over " << N << " elements:"
+            << " kernel + serial accumulation " << ms(t_start, t_serial) << " ms,"
+            << " reduction " << ms(t_serial, t_reduced) << " ms");
+    CHECK(reduced == doctest::Approx(serial));
+}
@@ -23,8 +23,6 @@
 #include <cstdint>
 #include <type_traits>
 
-#include <boost/algorithm/string/predicate.hpp>
-
 #include <Explicator.h>
 
 #include "YgorMisc.h"         //Needed for FUNCINFO, FUNCWARN, FUNCERR macros.
@@ -983,22 +981,20 @@ Generate_Operation_List( const std::list<script_statement_t> &statements,
                          std::list<OperationArgPkg> &op_list,
                          std::list<script_feedback_t> &feedback ){
 
-    auto op_name_mapping = Known_Operations();
-    Explicator op_name_X( Operation_Lexicon() );
-
     bool compilation_successful = true;
     std::list<OperationArgPkg> out;
     for(const auto &s : statements){
 
         // Find or estimate the canonical name. If not an exact match, issue an error or fuzzy-match with a warning.
         const auto user_op_name = to_str(s.func_name);
-        const auto canonical_op_name = op_name_X(user_op_name);
-        if( op_name_X.last_best_score < 0.6 ){
+        const auto resolved = Resolve_Operation(user_op_name);
+        const auto canonical_op_name = (resolved.op == nullptr) ? user_op_name : resolved.op->name;
+        if( resolved.score < 0.6 ){
             report(feedback, script_feedback_severity_t::err, s.get_valid_cwct(),
                    "Operation '"_s + user_op_name + "' not understood.");
             compilation_successful = false;
 
-        }else if( op_name_X.last_best_score < 1.0 ){
+        }else if( resolved.score < 1.0 ){
             report(feedback, script_feedback_severity_t::warn, s.get_valid_cwct(),
                    "Selecting operation '"_s + canonical_op_name + "' because '"_s + user_op_name + "' not understood.");
         }
@@ -1007,19 +1003,14 @@ Generate_Operation_List( const std::list<script_statement_t> &statements,
         // Find or estimate the canonical name for arguments.
         std::map<std::string, std::string> Argument_Lexicon;
         std::map<std::string, std::list<std::string>> Exhaustive_Arguments;
-        for(const auto &op_func : op_name_mapping){
-            if(boost::iequals(op_func.first, canonical_op_name)){
+        if(resolved.op != nullptr){
+            //Attempt to insert all expected, documented parameters with the default value.
+            for(const auto &r : resolved.op->doc.args){
+                Argument_Lexicon[r.name] = r.name;
 
-                //Attempt to insert all expected, documented parameters with the default value.
-                auto OpDocs = op_func.second.first();
-                for(const auto &r : OpDocs.args){
-                    Argument_Lexicon[r.name] = r.name;
-
-                    if(r.samples == OpArgSamples::Exhaustive){
-                        Exhaustive_Arguments[r.name] = r.examples;
-                    }
+                if(r.samples == OpArgSamples::Exhaustive){
+                    Exhaustive_Arguments[r.name] = r.examples;
                 }
-                break;
             }
         }
 
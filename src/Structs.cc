@@ -8,6 +8,7 @@
 #include <functional>
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
@@ -32,6 +33,7 @@
 #include "Structs.h"
 #include "Tables.h"
 #include "Dose_Meld.h"
+#include "Contour_Rasterization.h"
 
 //This is a mapping from the segmentation history to a human-readable description.
 // Try avoid using commas or tabs to make dumping as csv easier. This should in
@@ -533,10 +535,30 @@ Image_Array::Image_Array(const Image_Array &rhs){
 Image_Array & Image_Array::operator=(const Image_Array &rhs){
     if(this != &rhs){
         this->imagecoll  = rhs.imagecoll;
+        this->pixels_dirty = true;
     }
     return *this;
 }
 
+static std::mutex deferred_pixel_decoder_mutex;
+static std::function<void(std::list<std::shared_ptr<Image_Array>> &)> deferred_pixel_decoder;
+
+void Register_Deferred_Pixel_Decoder(std::function<void(std::list<std::shared_ptr<Image_Array>> &)> decoder){
+    std::lock_guard<std::mutex> lock(deferred_pixel_decoder_mutex);
+    deferred_pixel_decoder = std::move(decoder);
+    return;
+}
+
+void Decode_Deferred_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays){
+    std::function<void(std::list<std::shared_ptr<Image_Array>> &)> decoder;
+    {
+        std::lock_guard<std::mutex> lock(deferred_pixel_decoder_mutex);
+        decoder = deferred_pixel_decoder;
+    }
+    if(decoder) decoder(img_arrays);
+    return;
+}
+
 //---------------------------------------------------------------------------------------------------------------------------
 //-------------------------------------------------------- Point_Cloud ------------------------------------------------------
 //---------------------------------------------------------------------------------------------------------------------------
@@ -1150,6 +1172,18 @@ void Drover::Bounded_Dose_General( std::list<double> *pixel_doses,
     // map<cc_iter, pair<Total dose (in unscaled integer units), Number of voxels>>.
     auto accumulated_dose = drover_bnded_dose_accm_dose_map_factory();
 
+    //Voxels are counted once for every contour that bounds them, so overlapping contours within the same ROI are
+    // rasterized individually rather than merged. Contours are split once here since the masks are cached by content.
+    std::list<std::list<contour_collection<double>>> split_ccs;
+    for(const auto &cc : this->contour_data->ccs){
+        split_ccs.emplace_back();
+        for(const auto &c : cc.contours){
+            if(c.points.size() < 3) continue;
+            split_ccs.back().emplace_back();
+            split_ccs.back().back().contours.push_back(c);
+        }
+    }
+
     //Loop over the attached dose datasets (NOT the dose slices!). It is implied that we have to sum up doses 
     // from each attached data in order to find the total (actual) dose.
     //
@@ -1165,122 +1199,58 @@ void Drover::Bounded_Dose_General( std::list<double> *pixel_doses,
         for(auto & image : dd_it->imagecoll.images){
             //Note: i_it is something like std::list<planar_image<T,R>>::iterator.
     
-            for(auto cc_it = this->contour_data->ccs.begin(); cc_it != this->contour_data->ccs.end(); ++cc_it){
-
-                for(auto c_it = cc_it->contours.begin(); c_it != cc_it->contours.end(); ++c_it){
-                    if(c_it->points.size() < 3) continue;
-
-                    const auto filtering_avg_point = c_it->First_N_Point_Avg(3); //Average_Point(); //Just need a point at the correct height, somewhere inside contour.
-                    if(!image.sandwiches_point_within_top_bottom_planes(filtering_avg_point)) continue;
- 
-                    //Now we have a contour of points and pixel data (note: we can ignore the z components for both) 
-                    // which may or may not lie within the contour. This is called the 'Point-in-polygon' problem and is
-                    // a well-known problem. Unfortunately, it can be a costly problem to solve. We will bound the contour with
-                    // a cartesian bounding box (in the XY plane) and poll each point. We can immediately ignore points outside the box.
-                    // This will save a considerable amount of time for small contours within a large volume, and probably won't greatly
-                    // slow the large contour/large volume case too much.
-                    //
-                    // We then examine line crossings. For a regular polygon, whether or not the number of line crossings (from the point
-                    // to infinity (in this case - the edge of the box)) is even or odd will determine whether or not the point is within
-                    // the contour. I *believe* there would be an issue if the contour would wrap around and touch exactly on some segment
-                    // (like a "C" where the two sharp edges touch to form an "O".) ***BEWARE*** that this is most likely the case!
-                    //
-                    // See http://www.visibone.com/inpoly/ (Accessed Jan 2012,) 
-                    //     http://paulbourke.net/geometry/insidepoly/ (January 2012,)
-                    //     http://stackoverflow.com/questions/217578/point-in-polygon-aka-hit-test (January 2012).
-                    //     NOTE: Some web servers/web applications used to have to implement this routine to deal with image maps. 
-                    //           Check their sources for leads if looking/scrounging for code. I would like a fully 3D version!
-                    //
-                    //     |---------------------|
-                    //     | /-----\  /--------\ |
-                    //     | |     |__|        / |
-                    //     |/                 /  |
-                    //     ||   X            /   |
-                    //     | \______________/    |
-                    //     |---------------------|
-                    //
-                    const contour_of_points<double> BB(c_it->Bounding_Box_Along(vec3<double>(1.0,0.0,0.0)));
-                    const float alrgnum(1E30);
-                    float min_x = alrgnum, max_x = -alrgnum;
-                    float min_y = alrgnum, max_y = -alrgnum;
-                    for(const auto & point : BB.points){
-                        if(point.x < min_x) min_x = point.x;
-                        if(point.x > max_x) max_x = point.x;
-                        if(point.y < min_y) min_y = point.y;
-                        if(point.y > max_y) max_y = point.y;
-                    }
-                    if((min_x == alrgnum) || (min_y == alrgnum) || (max_x == -alrgnum) || (max_y == -alrgnum)){
-                        YLOGERR("Unable to find a reasonable bounding box around this contour");
-                    }
-    
-                    //Now cycle through every pixel in the plane. This is kind of a shit way to do this, but then again this entire program is basically
-                    // a shit way to do it. I would like to have had more time to properly fix/plan/think about what I've got here...  -h
-                    for(int64_t i=0; i<image.rows; ++i)  for(int64_t j=0; j<image.columns; ++j){
+            auto split_it = split_ccs.begin();
+            for(auto cc_it = this->contour_data->ccs.begin(); cc_it != this->contour_data->ccs.end(); ++cc_it, ++split_it){
+                for(auto &single_cc : *split_it){
+
+                    //Voxels bounded by the contour are found via scanline rasterization rather than testing every voxel
+                    // against the contour. Masks are cached, so repeatedly evaluating the same ROIs on the same dose grid
+                    // reuses them.
+                    const auto mask = Rasterize_Contours_Cached(image, { std::ref(single_cc) },
+                                                                Mutate_Voxels_Opts::Inclusivity::Centre,
+                                                                Mutate_Voxels_Opts::ContourOverlap::Ignore);
+                    mask->visit_bounded([&](int64_t i, int64_t j){
                         const auto pos = image.position(i,j);
-                        const float X = pos.x, Y = pos.y;
-    
-                        //Check if it is outside the bounding box.
-                        if(!isininc(min_x,X,max_x) || !isininc(min_y,Y,max_y)) continue;
-    
-                        bool is_in_the_polygon = false;
-                        auto p_j = --(c_it->points.end());
-                        for(auto p_i = c_it->points.begin(); p_i != c_it->points.end(); p_j = (p_i++)){
-                            //If the points cross a line, we simply toggle the 'bool is_in_the_polygon.'
-                            if( ((p_i->y <= Y) && (Y < p_j->y)) || ((p_j->y <= Y) && (Y < p_i->y)) ){ 
-                                const auto B = (p_j->x - p_i->x)*(Y - p_i->y)/(p_j->y - p_i->y);
-                                if(X < (B + p_i->x)){
-                                    is_in_the_polygon = !is_in_the_polygon;
-                                }
-                            }
-                        }
 
-                        if(is_in_the_polygon){
-                            //-----------------------------------------------------------------------------------------------------------------------
-                            //YLOGINFO("Bounding box (x,y)min (x,y)max = (" << min_x << "," << min_y << ") (" << max_x << "," << max_y << ")");
-                            //YLOGINFO("Point has (X,Y) = " << X << " " << Y);
+                        //NOTE: Remember: this is some integer representing dose. If we want a clamped [0:1] 
+                        // value, we would use the clamped_channel(...) member instead!
+                        const auto pointval = static_cast<int64_t>(image.value(i,j,0)); //Greyscale or R channel. We assume the channels satisfy: R = G = B.
+                        const auto pointdose = static_cast<double>(pointval); 
 
-                            //NOTE: Remember: this is some integer representing dose. If we want a clamped [0:1] 
-                            // value, we would use the clamped_channel(...) member instead!
-                            const auto pointval = static_cast<int64_t>(image.value(i,j,0)); //Greyscale or R channel. We assume the channels satisfy: R = G = B.
-                            const auto pointdose = static_cast<double>(pointval); 
-
-                            if(mean_doses != nullptr){
-                                accumulated_dose[cc_it].first  += pointval;
-                                accumulated_dose[cc_it].second += 1;
-                            }
-                            if(bulk_doses != nullptr){
-                                (*bulk_doses)[cc_it].push_back(pointdose);
-                            }
+                        if(mean_doses != nullptr){
+                            accumulated_dose[cc_it].first  += pointval;
+                            accumulated_dose[cc_it].second += 1;
+                        }
+                        if(bulk_doses != nullptr){
+                            (*bulk_doses)[cc_it].push_back(pointdose);
+                        }
 
-                            if(pixel_doses != nullptr){
-                                pixel_doses->push_back(pointdose); 
-                            }
+                        if(pixel_doses != nullptr){
+                            pixel_doses->push_back(pointdose); 
+                        }
 
-                            if(min_max_doses != nullptr){
-                                if(pointdose < (*min_max_doses)[cc_it].first)  (*min_max_doses)[cc_it].first  = pointdose; //min.
-                                if(pointdose > (*min_max_doses)[cc_it].second) (*min_max_doses)[cc_it].second = pointdose; //max.
-                            }
+                        if(min_max_doses != nullptr){
+                            if(pointdose < (*min_max_doses)[cc_it].first)  (*min_max_doses)[cc_it].first  = pointdose; //min.
+                            if(pointdose > (*min_max_doses)[cc_it].second) (*min_max_doses)[cc_it].second = pointdose; //max.
+                        }
 
-                            if(pos_doses != nullptr){
-                                const vec3<double> r_dx = image.row_unit*image.pxl_dx*0.5;
-                                const vec3<double> r_dy = image.col_unit*image.pxl_dy*0.5;
-                                const auto tup = std::make_tuple(pos, r_dx, r_dy, pointdose, i, j);
+                        if(pos_doses != nullptr){
+                            const vec3<double> r_dx = image.row_unit*image.pxl_dx*0.5;
+                            const vec3<double> r_dy = image.col_unit*image.pxl_dy*0.5;
+                            const auto tup = std::make_tuple(pos, r_dx, r_dy, pointdose, i, j);
 
-                                if(Fselection(tup)) (*pos_doses)[cc_it].push_back(tup);
-                            }
-                            if(cent_moms != nullptr){ //Centralized moments. This routine requires a centroid for each cc.
-                                const auto cc_centroid = cc_centroids[cc_it];
-                                for(int p = 0; p < 5; ++p) for(int q = 0; q < 5; ++q) for(int r = 0; r < 5; ++r){
-                                    //const std::array<int,3> triplet = {p,q,r};
-                                    const auto spatial = pow(pos.x-cc_centroid.x,p)*pow(pos.y-cc_centroid.y,q)*pow(pos.z-cc_centroid.z,r);
-                                    const auto grid_factor = image.pxl_dx * image.pxl_dy * image.pxl_dz;
-                                    (*cent_moms)[cc_it][{p,q,r}] += spatial*pointdose*grid_factor;
-                                }
+                            if(Fselection(tup)) (*pos_doses)[cc_it].push_back(tup);
+                        }
+                        if(cent_moms != nullptr){ //Centralized moments. This routine requires a centroid for each cc.
+                            const auto cc_centroid = cc_centroids[cc_it];
+                            for(int p = 0; p < 5; ++p) for(int q = 0; q < 5; ++q) for(int r = 0; r < 5; ++r){
+                                //const std::array<int,3> triplet = {p,q,r};
+                                const auto spatial = pow(pos.x-cc_centroid.x,p)*pow(pos.y-cc_centroid.y,q)*pow(pos.z-cc_centroid.z,r);
+                                const auto grid_factor = image.pxl_dx * image.pxl_dy * image.pxl_dz;
+                                (*cent_moms)[cc_it][{p,q,r}] += spatial*pointdose*grid_factor;
                             }
-
-                            //-----------------------------------------------------------------------------------------------------------------------
                         }
-                    }
+                    });
                 }
             }
         }
@@ -1989,6 +1959,121 @@ Drover_Cache::trim_except(int64_t version_num){
     this->drovers.swap(l_drovers);
     return;
 }
+
+//---------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------ Drover_Snapshot ----------------------------------------------------
+//---------------------------------------------------------------------------------------------------------------------------
+namespace {
+
+// Objects protected by snapshots. Counts are needed because snapshots can be nested, e.g., nested Transactions.
+struct snapshot_registry_t {
+    std::mutex m;
+    int64_t snapshots = 0;
+    std::map<const void*, int64_t> protected_objs;
+};
+
+snapshot_registry_t &
+get_snapshot_registry(){
+    static snapshot_registry_t registry;
+    return registry;
+}
+
+template <class F>
+void
+for_each_object(const Drover &d, F f){
+    if(d.contour_data != nullptr) f(d.contour_data.get());
+    for(const auto& x : d.image_data)  if(x != nullptr) f(x.get());
+    for(const auto& x : d.point_data)  if(x != nullptr) f(x.get());
+    for(const auto& x : d.smesh_data)  if(x != nullptr) f(x.get());
+    for(const auto& x : d.rtplan_data) if(x != nullptr) f(x.get());
+    for(const auto& x : d.lsamp_data)  if(x != nullptr) f(x.get());
+    for(const auto& x : d.trans_data)  if(x != nullptr) f(x.get());
+    for(const auto& x : d.table_data)  if(x != nullptr) f(x.get());
+    return;
+}
+
+std::shared_ptr<Contour_Data>
+clone_object(const Contour_Data &in){
+    return in.Duplicate();
+}
+
+template <class T>
+std::shared_ptr<T>
+clone_object(const T &in){
+    return std::make_shared<T>(in);
+}
+
+template <class T>
+bool
+detach_object(std::shared_ptr<T> &obj){
+    if(obj == nullptr) return false;
+    {
+        auto &reg = get_snapshot_registry();
+        std::lock_guard<std::mutex> lock(reg.m);
+        if(reg.protected_objs.count(static_cast<const void*>(obj.get())) == 0) return false;
+    }
+    obj = clone_object(*obj);
+    return true;
+}
+
+} // namespace
+
+Drover_Snapshot::Drover_Snapshot(const Drover &in) : state(in) {
+    auto &reg = get_snapshot_registry();
+    std::lock_guard<std::mutex> lock(reg.m);
+    ++(reg.snapshots);
+    for_each_object(this->state, [&](const void *p){ ++(reg.protected_objs[p]); });
+}
+
+Drover_Snapshot::~Drover_Snapshot(){
+    auto &reg = get_snapshot_registry();
+    std::lock_guard<std::mutex> lock(reg.m);
+    --(reg.snapshots);
+    for_each_object(this->state, [&](const void *p){
+        auto it = reg.protected_objs.find(p);
+        if( (it != reg.protected_objs.end())
+        &&  (--(it->second) <= 0) ){
+            reg.protected_objs.erase(it);
+        }
+    });
+}
+
+// Only the object pointers are replaced. Detached copies are released when the Drover no longer refers to them.
+void
+Drover_Snapshot::Restore(Drover &out) const {
+    out = this->state;
+    return;
+}
+
+bool
+Drover_Snapshot::Active(){
+    auto &reg = get_snapshot_registry();
+    std::lock_guard<std::mutex> lock(reg.m);
+    return (0 < reg.snapshots);
+}
+
+bool Drover_Snapshot::Detach(std::shared_ptr<Contour_Data> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Image_Array> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Point_Cloud> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Surface_Mesh> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<RTPlan> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Line_Sample> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Transform3> &obj){ return detach_object(obj); }
+bool Drover_Snapshot::Detach(std::shared_ptr<Sparse_Table> &obj){ return detach_object(obj); }
+
+int64_t
+Drover_Snapshot::Detach(Drover &DICOM_data){
+    int64_t n = 0;
+    if(Drover_Snapshot::Detach(DICOM_data.contour_data)) ++n;
+    for(auto& x : DICOM_data.image_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.point_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.smesh_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.rtplan_data) if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.lsamp_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.trans_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    for(auto& x : DICOM_data.table_data)  if(Drover_Snapshot::Detach(x)) ++n;
+    return n;
+}
         
 
 //---------------------------------------------------------------------------------------------------------------------------
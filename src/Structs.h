@@ -3,6 +3,7 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <optional>
 #include <initializer_list>
 #include <list>
@@ -124,6 +125,10 @@ class Image_Array { //: public Base_Array {
 
         std::string filename; //The filename from which the data originated, if applicable.
 
+        // Set if the pixel data might differ from the files they were loaded from. Only clean pixel data can be
+        // discarded and decoded again later. Copies are always dirty, since they are typically made to be modified.
+        bool pixels_dirty = true;
+
         //Constructor/Destructors.
         Image_Array();
         Image_Array(const Image_Array &rhs); //Performs a deep copy (unless copying self).
@@ -132,6 +137,12 @@ class Image_Array { //: public Base_Array {
         Image_Array & operator=(const Image_Array &rhs); //Performs a deep copy (unless copying self).
 };
 
+// Image pixel data can be left undecoded when files are loaded. The loader registers a decoder here, which is invoked
+// whenever image arrays are selected (i.e., when an operation first accesses them). Without a registered decoder,
+// nothing is done.
+void Register_Deferred_Pixel_Decoder(std::function<void(std::list<std::shared_ptr<Image_Array>> &)> decoder);
+void Decode_Deferred_Pixels(std::list<std::shared_ptr<Image_Array>> &img_arrays);
+
 
 // This class is meant to hold a simple 3D point cloud.
 class Point_Cloud {
@@ -575,6 +586,56 @@ struct Drover_Cache {
     trim_except(int64_t version_num);
 };
 
+//---------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------ Drover_Snapshot ----------------------------------------------------
+//---------------------------------------------------------------------------------------------------------------------------
+// A copy-on-write snapshot of a Drover's state.
+//
+// Taking a snapshot only copies the object pointers, so the snapshot shares every object with the Drover. While a
+// snapshot exists, its objects are 'protected' and must be detached before they are modified. Detaching replaces the
+// Drover's pointer with a private copy of the object, leaving the original with the snapshot. Objects that are never
+// detached are never copied, so taking and restoring a snapshot costs time and memory proportional to the objects
+// that were modified rather than the size of the data.
+//
+// Note that objects are modified in-place through their pointers, so detaching is cooperative. Operation_Dispatcher
+// detaches objects before each operation, but code that modifies objects directly must call Detach() itself.
+class Drover_Snapshot {
+  private:
+    Drover state; // Shallow copy.
+
+  public:
+    explicit Drover_Snapshot(const Drover &in);
+    ~Drover_Snapshot();
+
+    Drover_Snapshot(const Drover_Snapshot &) = delete;
+    Drover_Snapshot& operator=(const Drover_Snapshot &) = delete;
+
+    // Revert the Drover to the state when the snapshot was taken.
+    void
+    Restore(Drover &out) const;
+
+    // Whether any snapshot currently exists.
+    static bool
+    Active();
+
+    // Replace the object with a private copy if it is protected by any snapshot.
+    //
+    // Returns true if the object was copied.
+    static bool Detach(std::shared_ptr<Contour_Data> &obj);
+    static bool Detach(std::shared_ptr<Image_Array> &obj);
+    static bool Detach(std::shared_ptr<Point_Cloud> &obj);
+    static bool Detach(std::shared_ptr<Surface_Mesh> &obj);
+    static bool Detach(std::shared_ptr<RTPlan> &obj);
+    static bool Detach(std::shared_ptr<Line_Sample> &obj);
+    static bool Detach(std::shared_ptr<Transform3> &obj);
+    static bool Detach(std::shared_ptr<Sparse_Table> &obj);
+
+    // Detach all protected objects held by the Drover.
+    //
+    // Returns the number of objects that were copied.
+    static int64_t Detach(Drover &DICOM_data);
+};
+
 //---------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------ Operation Argument Classes -----------------------------------------------
 //---------------------------------------------------------------------------------------------------------------------------
@@ -638,6 +699,10 @@ enum class OpArgVisibility {
 
 enum class OpArgFlow {
     // This class is used to denote whether operation arguments are used as inputs (ingress) or outputs (egress).
+    //
+    // Operation_Dispatcher uses these flows to limit which objects are copied for Drover snapshots. If any argument
+    // of an operation has a known flow, every argument that selects objects the operation modifies must be marked as
+    // egress.
     Ingress,
     Egress,
     IngressEgress,
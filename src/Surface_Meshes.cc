@@ -14,6 +14,8 @@
 #include <limits>
 #include <cmath>
 #include <cstdint>
+#include <optional>
+#include <unordered_map>
 
 #include <utility>            //Needed for std::pair.
 #include <algorithm>
@@ -76,6 +78,510 @@
 // ----------------------------------------------- Pure contour meshing -----------------------------------------------
 namespace dcma_surface_meshes {
 
+// Marching Cubes lookup tables.
+
+// Use a curb vertex inclusivity int (8 bits) to determine which (of 12) edges are intersected by the ROI surface.
+static const std::array<int32_t, 256> aiCubeEdgeFlags { {
+    0b000000000000, 0b000100001001, 0b001000000011, 0b001100001010, 0b010000000110, 0b010100001111, 0b011000000101,
+    0b011100001100, 0b100000001100, 0b100100000101, 0b101000001111, 0b101100000110, 0b110000001010, 0b110100000011,
+    0b111000001001, 0b111100000000, 0b000110010000, 0b000010011001, 0b001110010011, 0b001010011010, 0b010110010110,
+    0b010010011111, 0b011110010101, 0b011010011100, 0b100110011100, 0b100010010101, 0b101110011111, 0b101010010110,
+    0b110110011010, 0b110010010011, 0b111110011001, 0b111010010000, 0b001000110000, 0b001100111001, 0b000000110011,
+    0b000100111010, 0b011000110110, 0b011100111111, 0b010000110101, 0b010100111100, 0b101000111100, 0b101100110101,
+    0b100000111111, 0b100100110110, 0b111000111010, 0b111100110011, 0b110000111001, 0b110100110000, 0b001110100000,
+    0b001010101001, 0b000110100011, 0b000010101010, 0b011110100110, 0b011010101111, 0b010110100101, 0b010010101100,
+    0b101110101100, 0b101010100101, 0b100110101111, 0b100010100110, 0b111110101010, 0b111010100011, 0b110110101001,
+    0b110010100000, 0b010001100000, 0b010101101001, 0b011001100011, 0b011101101010, 0b000001100110, 0b000101101111,
+    0b001001100101, 0b001101101100, 0b110001101100, 0b110101100101, 0b111001101111, 0b111101100110, 0b100001101010,
+    0b100101100011, 0b101001101001, 0b101101100000, 0b010111110000, 0b010011111001, 0b011111110011, 0b011011111010,
+    0b000111110110, 0b000011111111, 0b001111110101, 0b001011111100, 0b110111111100, 0b110011110101, 0b111111111111,
+    0b111011110110, 0b100111111010, 0b100011110011, 0b101111111001, 0b101011110000, 0b011001010000, 0b011101011001,
+    0b010001010011, 0b010101011010, 0b001001010110, 0b001101011111, 0b000001010101, 0b000101011100, 0b111001011100,
+    0b111101010101, 0b110001011111, 0b110101010110, 0b101001011010, 0b101101010011, 0b100001011001, 0b100101010000,
+    0b011111000000, 0b011011001001, 0b010111000011, 0b010011001010, 0b001111000110, 0b001011001111, 0b000111000101,
+    0b000011001100, 0b111111001100, 0b111011000101, 0b110111001111, 0b110011000110, 0b101111001010, 0b101011000011,
+    0b100111001001, 0b100011000000, 0b100011000000, 0b100111001001, 0b101011000011, 0b101111001010, 0b110011000110,
+    0b110111001111, 0b111011000101, 0b111111001100, 0b000011001100, 0b000111000101, 0b001011001111, 0b001111000110,
+    0b010011001010, 0b010111000011, 0b011011001001, 0b011111000000, 0b100101010000, 0b100001011001, 0b101101010011,
+    0b101001011010, 0b110101010110, 0b110001011111, 0b111101010101, 0b111001011100, 0b000101011100, 0b000001010101,
+    0b001101011111, 0b001001010110, 0b010101011010, 0b010001010011, 0b011101011001, 0b011001010000, 0b101011110000,
+    0b101111111001, 0b100011110011, 0b100111111010, 0b111011110110, 0b111111111111, 0b110011110101, 0b110111111100,
+    0b001011111100, 0b001111110101, 0b000011111111, 0b000111110110, 0b011011111010, 0b011111110011, 0b010011111001,
+    0b010111110000, 0b101101100000, 0b101001101001, 0b100101100011, 0b100001101010, 0b111101100110, 0b111001101111,
+    0b110101100101, 0b110001101100, 0b001101101100, 0b001001100101, 0b000101101111, 0b000001100110, 0b011101101010,
+    0b011001100011, 0b010101101001, 0b010001100000, 0b110010100000, 0b110110101001, 0b111010100011, 0b111110101010,
+    0b100010100110, 0b100110101111, 0b101010100101, 0b101110101100, 0b010010101100, 0b010110100101, 0b011010101111,
+    0b011110100110, 0b000010101010, 0b000110100011, 0b001010101001, 0b001110100000, 0b110100110000, 0b110000111001,
+    0b111100110011, 0b111000111010, 0b100100110110, 0b100000111111, 0b101100110101, 0b101000111100, 0b010100111100,
+    0b010000110101, 0b011100111111, 0b011000110110, 0b000100111010, 0b000000110011, 0b001100111001, 0b001000110000,
+    0b111010010000, 0b111110011001, 0b110010010011, 0b110110011010, 0b101010010110, 0b101110011111, 0b100010010101,
+    0b100110011100, 0b011010011100, 0b011110010101, 0b010010011111, 0b010110010110, 0b001010011010, 0b001110010011,
+    0b000010011001, 0b000110010000, 0b111100000000, 0b111000001001, 0b110100000011, 0b110000001010, 0b101100000110,
+    0b101000001111, 0b100100000101, 0b100000001100, 0b011100001100, 0b011000000101, 0b010100001111, 0b010000000110,
+    0b001100001010, 0b001000000011, 0b000100001001, 0b000000000000
+} };
+
+// Determine which triangulation (0-5 triangles) is needed given the edge-surface intersections.
+static const std::array< std::array<int32_t, 16>, 256> a2iTriangleConnectionTable  { {
+       { -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  1,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  8,  3,    9,  8,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,    1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  2, 10,    0,  2,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  8,  3,    2, 10,  8,   10,  9,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0, 11,  2,    8, 11,  0,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  9,  0,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1, 11,  2,    1,  9, 11,    9,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3, 10,  1,   11, 10,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0, 10,  1,    0,  8, 10,    8, 11, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  9,  0,    3, 11,  9,   11, 10,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  8, 10,   10,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  3,  0,    7,  3,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  1,  9,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  1,  9,    4,  7,  1,    7,  3,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  4,  7,    3,  0,  4,    1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  2, 10,    9,  0,  2,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2, 10,  9,    2,  9,  7,    2,  7,  3,    7,  9,  4,   -1, -1, -1,   -1 },
+       {  8,  4,  7,    3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  4,  7,   11,  2,  4,    2,  0,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  0,  1,    8,  4,  7,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  7, 11,    9,  4, 11,    9, 11,  2,    9,  2,  1,   -1, -1, -1,   -1 },
+       {  3, 10,  1,    3, 11, 10,    7,  8,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1, 11, 10,    1,  4, 11,    1,  0,  4,    7, 11,  4,   -1, -1, -1,   -1 },
+       {  4,  7,  8,    9,  0, 11,    9, 11, 10,   11,  0,  3,   -1, -1, -1,   -1 },
+       {  4,  7, 11,    4, 11,  9,    9, 11, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  5,  4,    0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  5,  4,    1,  5,  0,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  5,  4,    8,  3,  5,    3,  1,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,    9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  0,  8,    1,  2, 10,    4,  9,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5,  2, 10,    5,  4,  2,    4,  0,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2, 10,  5,    3,  2,  5,    3,  5,  4,    3,  4,  8,   -1, -1, -1,   -1 },
+       {  9,  5,  4,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0, 11,  2,    0,  8, 11,    4,  9,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  5,  4,    0,  1,  5,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  1,  5,    2,  5,  8,    2,  8, 11,    4,  8,  5,   -1, -1, -1,   -1 },
+       { 10,  3, 11,   10,  1,  3,    9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  9,  5,    0,  8,  1,    8, 10,  1,    8, 11, 10,   -1, -1, -1,   -1 },
+       {  5,  4,  0,    5,  0, 11,    5, 11, 10,   11,  0,  3,   -1, -1, -1,   -1 },
+       {  5,  4,  8,    5,  8, 10,   10,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  7,  8,    5,  7,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  3,  0,    9,  5,  3,    5,  7,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  7,  8,    0,  1,  7,    1,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  5,  3,    3,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  7,  8,    9,  5,  7,   10,  1,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  1,  2,    9,  5,  0,    5,  3,  0,    5,  7,  3,   -1, -1, -1,   -1 },
+       {  8,  0,  2,    8,  2,  5,    8,  5,  7,   10,  5,  2,   -1, -1, -1,   -1 },
+       {  2, 10,  5,    2,  5,  3,    3,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7,  9,  5,    7,  8,  9,    3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  5,  7,    9,  7,  2,    9,  2,  0,    2,  7, 11,   -1, -1, -1,   -1 },
+       {  2,  3, 11,    0,  1,  8,    1,  7,  8,    1,  5,  7,   -1, -1, -1,   -1 },
+       { 11,  2,  1,   11,  1,  7,    7,  1,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  5,  8,    8,  5,  7,   10,  1,  3,   10,  3, 11,   -1, -1, -1,   -1 },
+       {  5,  7,  0,    5,  0,  9,    7, 11,  0,    1,  0, 10,   11, 10,  0,   -1 },
+       { 11, 10,  0,   11,  0,  3,   10,  5,  0,    8,  0,  7,    5,  7,  0,   -1 },
+       { 11, 10,  5,    7, 11,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  0,  1,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  8,  3,    1,  9,  8,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  6,  5,    2,  6,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  6,  5,    1,  2,  6,    3,  0,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  6,  5,    9,  0,  6,    0,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5,  9,  8,    5,  8,  2,    5,  2,  6,    3,  2,  8,   -1, -1, -1,   -1 },
+       {  2,  3, 11,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  0,  8,   11,  2,  0,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  1,  9,    2,  3, 11,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5, 10,  6,    1,  9,  2,    9, 11,  2,    9,  8, 11,   -1, -1, -1,   -1 },
+       {  6,  3, 11,    6,  5,  3,    5,  1,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8, 11,    0, 11,  5,    0,  5,  1,    5, 11,  6,   -1, -1, -1,   -1 },
+       {  3, 11,  6,    0,  3,  6,    0,  6,  5,    0,  5,  9,   -1, -1, -1,   -1 },
+       {  6,  5,  9,    6,  9, 11,   11,  9,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5, 10,  6,    4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  3,  0,    4,  7,  3,    6,  5, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  9,  0,    5, 10,  6,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  6,  5,    1,  9,  7,    1,  7,  3,    7,  9,  4,   -1, -1, -1,   -1 },
+       {  6,  1,  2,    6,  5,  1,    4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2,  5,    5,  2,  6,    3,  0,  4,    3,  4,  7,   -1, -1, -1,   -1 },
+       {  8,  4,  7,    9,  0,  5,    0,  6,  5,    0,  2,  6,   -1, -1, -1,   -1 },
+       {  7,  3,  9,    7,  9,  4,    3,  2,  9,    5,  9,  6,    2,  6,  9,   -1 },
+       {  3, 11,  2,    7,  8,  4,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5, 10,  6,    4,  7,  2,    4,  2,  0,    2,  7, 11,   -1, -1, -1,   -1 },
+       {  0,  1,  9,    4,  7,  8,    2,  3, 11,    5, 10,  6,   -1, -1, -1,   -1 },
+       {  9,  2,  1,    9, 11,  2,    9,  4, 11,    7, 11,  4,    5, 10,  6,   -1 },
+       {  8,  4,  7,    3, 11,  5,    3,  5,  1,    5, 11,  6,   -1, -1, -1,   -1 },
+       {  5,  1, 11,    5, 11,  6,    1,  0, 11,    7, 11,  4,    0,  4, 11,   -1 },
+       {  0,  5,  9,    0,  6,  5,    0,  3,  6,   11,  6,  3,    8,  4,  7,   -1 },
+       {  6,  5,  9,    6,  9, 11,    4,  7,  9,    7, 11,  9,   -1, -1, -1,   -1 },
+       { 10,  4,  9,    6,  4, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4, 10,  6,    4,  9, 10,    0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  0,  1,   10,  6,  0,    6,  4,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  3,  1,    8,  1,  6,    8,  6,  4,    6,  1, 10,   -1, -1, -1,   -1 },
+       {  1,  4,  9,    1,  2,  4,    2,  6,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  0,  8,    1,  2,  9,    2,  4,  9,    2,  6,  4,   -1, -1, -1,   -1 },
+       {  0,  2,  4,    4,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  3,  2,    8,  2,  4,    4,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  4,  9,   10,  6,  4,   11,  2,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  2,    2,  8, 11,    4,  9, 10,    4, 10,  6,   -1, -1, -1,   -1 },
+       {  3, 11,  2,    0,  1,  6,    0,  6,  4,    6,  1, 10,   -1, -1, -1,   -1 },
+       {  6,  4,  1,    6,  1, 10,    4,  8,  1,    2,  1, 11,    8, 11,  1,   -1 },
+       {  9,  6,  4,    9,  3,  6,    9,  1,  3,   11,  6,  3,   -1, -1, -1,   -1 },
+       {  8, 11,  1,    8,  1,  0,   11,  6,  1,    9,  1,  4,    6,  4,  1,   -1 },
+       {  3, 11,  6,    3,  6,  0,    0,  6,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  6,  4,  8,   11,  6,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7, 10,  6,    7,  8, 10,    8,  9, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  7,  3,    0, 10,  7,    0,  9, 10,    6,  7, 10,   -1, -1, -1,   -1 },
+       { 10,  6,  7,    1, 10,  7,    1,  7,  8,    1,  8,  0,   -1, -1, -1,   -1 },
+       { 10,  6,  7,   10,  7,  1,    1,  7,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2,  6,    1,  6,  8,    1,  8,  9,    8,  6,  7,   -1, -1, -1,   -1 },
+       {  2,  6,  9,    2,  9,  1,    6,  7,  9,    0,  9,  3,    7,  3,  9,   -1 },
+       {  7,  8,  0,    7,  0,  6,    6,  0,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7,  3,  2,    6,  7,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  3, 11,   10,  6,  8,   10,  8,  9,    8,  6,  7,   -1, -1, -1,   -1 },
+       {  2,  0,  7,    2,  7, 11,    0,  9,  7,    6,  7, 10,    9, 10,  7,   -1 },
+       {  1,  8,  0,    1,  7,  8,    1, 10,  7,    6,  7, 10,    2,  3, 11,   -1 },
+       { 11,  2,  1,   11,  1,  7,   10,  6,  1,    6,  7,  1,   -1, -1, -1,   -1 },
+       {  8,  9,  6,    8,  6,  7,    9,  1,  6,   11,  6,  3,    1,  3,  6,   -1 },
+       {  0,  9,  1,   11,  6,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7,  8,  0,    7,  0,  6,    3, 11,  0,   11,  6,  0,   -1, -1, -1,   -1 },
+       {  7, 11,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  0,  8,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  1,  9,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  1,  9,    8,  3,  1,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  1,  2,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,    3,  0,  8,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  9,  0,    2, 10,  9,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  6, 11,  7,    2, 10,  3,   10,  8,  3,   10,  9,  8,   -1, -1, -1,   -1 },
+       {  7,  2,  3,    6,  2,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  7,  0,  8,    7,  6,  0,    6,  2,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  7,  6,    2,  3,  7,    0,  1,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  6,  2,    1,  8,  6,    1,  9,  8,    8,  7,  6,   -1, -1, -1,   -1 },
+       { 10,  7,  6,   10,  1,  7,    1,  3,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  7,  6,    1,  7, 10,    1,  8,  7,    1,  0,  8,   -1, -1, -1,   -1 },
+       {  0,  3,  7,    0,  7, 10,    0, 10,  9,    6, 10,  7,   -1, -1, -1,   -1 },
+       {  7,  6, 10,    7, 10,  8,    8, 10,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  6,  8,  4,   11,  8,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  6, 11,    3,  0,  6,    0,  4,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  6, 11,    8,  4,  6,    9,  0,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  4,  6,    9,  6,  3,    9,  3,  1,   11,  3,  6,   -1, -1, -1,   -1 },
+       {  6,  8,  4,    6, 11,  8,    2, 10,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,    3,  0, 11,    0,  6, 11,    0,  4,  6,   -1, -1, -1,   -1 },
+       {  4, 11,  8,    4,  6, 11,    0,  2,  9,    2, 10,  9,   -1, -1, -1,   -1 },
+       { 10,  9,  3,   10,  3,  2,    9,  4,  3,   11,  3,  6,    4,  6,  3,   -1 },
+       {  8,  2,  3,    8,  4,  2,    4,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  4,  2,    4,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  9,  0,    2,  3,  4,    2,  4,  6,    4,  3,  8,   -1, -1, -1,   -1 },
+       {  1,  9,  4,    1,  4,  2,    2,  4,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  1,  3,    8,  6,  1,    8,  4,  6,    6, 10,  1,   -1, -1, -1,   -1 },
+       { 10,  1,  0,   10,  0,  6,    6,  0,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  6,  3,    4,  3,  8,    6, 10,  3,    0,  3,  9,   10,  9,  3,   -1 },
+       { 10,  9,  4,    6, 10,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  9,  5,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,    4,  9,  5,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5,  0,  1,    5,  4,  0,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  7,  6,    8,  3,  4,    3,  5,  4,    3,  1,  5,   -1, -1, -1,   -1 },
+       {  9,  5,  4,   10,  1,  2,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  6, 11,  7,    1,  2, 10,    0,  8,  3,    4,  9,  5,   -1, -1, -1,   -1 },
+       {  7,  6, 11,    5,  4, 10,    4,  2, 10,    4,  0,  2,   -1, -1, -1,   -1 },
+       {  3,  4,  8,    3,  5,  4,    3,  2,  5,   10,  5,  2,   11,  7,  6,   -1 },
+       {  7,  2,  3,    7,  6,  2,    5,  4,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  5,  4,    0,  8,  6,    0,  6,  2,    6,  8,  7,   -1, -1, -1,   -1 },
+       {  3,  6,  2,    3,  7,  6,    1,  5,  0,    5,  4,  0,   -1, -1, -1,   -1 },
+       {  6,  2,  8,    6,  8,  7,    2,  1,  8,    4,  8,  5,    1,  5,  8,   -1 },
+       {  9,  5,  4,   10,  1,  6,    1,  7,  6,    1,  3,  7,   -1, -1, -1,   -1 },
+       {  1,  6, 10,    1,  7,  6,    1,  0,  7,    8,  7,  0,    9,  5,  4,   -1 },
+       {  4,  0, 10,    4, 10,  5,    0,  3, 10,    6, 10,  7,    3,  7, 10,   -1 },
+       {  7,  6, 10,    7, 10,  8,    5,  4, 10,    4,  8, 10,   -1, -1, -1,   -1 },
+       {  6,  9,  5,    6, 11,  9,   11,  8,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  6, 11,    0,  6,  3,    0,  5,  6,    0,  9,  5,   -1, -1, -1,   -1 },
+       {  0, 11,  8,    0,  5, 11,    0,  1,  5,    5,  6, 11,   -1, -1, -1,   -1 },
+       {  6, 11,  3,    6,  3,  5,    5,  3,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 10,    9,  5, 11,    9, 11,  8,   11,  5,  6,   -1, -1, -1,   -1 },
+       {  0, 11,  3,    0,  6, 11,    0,  9,  6,    5,  6,  9,    1,  2, 10,   -1 },
+       { 11,  8,  5,   11,  5,  6,    8,  0,  5,   10,  5,  2,    0,  2,  5,   -1 },
+       {  6, 11,  3,    6,  3,  5,    2, 10,  3,   10,  5,  3,   -1, -1, -1,   -1 },
+       {  5,  8,  9,    5,  2,  8,    5,  6,  2,    3,  8,  2,   -1, -1, -1,   -1 },
+       {  9,  5,  6,    9,  6,  0,    0,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  5,  8,    1,  8,  0,    5,  6,  8,    3,  8,  2,    6,  2,  8,   -1 },
+       {  1,  5,  6,    2,  1,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  3,  6,    1,  6, 10,    3,  8,  6,    5,  6,  9,    8,  9,  6,   -1 },
+       { 10,  1,  0,   10,  0,  6,    9,  5,  0,    5,  6,  0,   -1, -1, -1,   -1 },
+       {  0,  3,  8,    5,  6, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  5,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  5, 10,    7,  5, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  5, 10,   11,  7,  5,    8,  3,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5, 11,  7,    5, 10, 11,    1,  9,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 10,  7,  5,   10, 11,  7,    9,  8,  1,    8,  3,  1,   -1, -1, -1,   -1 },
+       { 11,  1,  2,   11,  7,  1,    7,  5,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,    1,  2,  7,    1,  7,  5,    7,  2, 11,   -1, -1, -1,   -1 },
+       {  9,  7,  5,    9,  2,  7,    9,  0,  2,    2, 11,  7,   -1, -1, -1,   -1 },
+       {  7,  5,  2,    7,  2, 11,    5,  9,  2,    3,  2,  8,    9,  8,  2,   -1 },
+       {  2,  5, 10,    2,  3,  5,    3,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  2,  0,    8,  5,  2,    8,  7,  5,   10,  2,  5,   -1, -1, -1,   -1 },
+       {  9,  0,  1,    5, 10,  3,    5,  3,  7,    3, 10,  2,   -1, -1, -1,   -1 },
+       {  9,  8,  2,    9,  2,  1,    8,  7,  2,   10,  2,  5,    7,  5,  2,   -1 },
+       {  1,  3,  5,    3,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  7,    0,  7,  1,    1,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  0,  3,    9,  3,  5,    5,  3,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9,  8,  7,    5,  9,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5,  8,  4,    5, 10,  8,   10, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  5,  0,  4,    5, 11,  0,    5, 10, 11,   11,  3,  0,   -1, -1, -1,   -1 },
+       {  0,  1,  9,    8,  4, 10,    8, 10, 11,   10,  4,  5,   -1, -1, -1,   -1 },
+       { 10, 11,  4,   10,  4,  5,   11,  3,  4,    9,  4,  1,    3,  1,  4,   -1 },
+       {  2,  5,  1,    2,  8,  5,    2, 11,  8,    4,  5,  8,   -1, -1, -1,   -1 },
+       {  0,  4, 11,    0, 11,  3,    4,  5, 11,    2, 11,  1,    5,  1, 11,   -1 },
+       {  0,  2,  5,    0,  5,  9,    2, 11,  5,    4,  5,  8,   11,  8,  5,   -1 },
+       {  9,  4,  5,    2, 11,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  5, 10,    3,  5,  2,    3,  4,  5,    3,  8,  4,   -1, -1, -1,   -1 },
+       {  5, 10,  2,    5,  2,  4,    4,  2,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3, 10,  2,    3,  5, 10,    3,  8,  5,    4,  5,  8,    0,  1,  9,   -1 },
+       {  5, 10,  2,    5,  2,  4,    1,  9,  2,    9,  4,  2,   -1, -1, -1,   -1 },
+       {  8,  4,  5,    8,  5,  3,    3,  5,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  4,  5,    1,  0,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  8,  4,  5,    8,  5,  3,    9,  0,  5,    0,  3,  5,   -1, -1, -1,   -1 },
+       {  9,  4,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4, 11,  7,    4,  9, 11,    9, 10, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  8,  3,    4,  9,  7,    9, 11,  7,    9, 10, 11,   -1, -1, -1,   -1 },
+       {  1, 10, 11,    1, 11,  4,    1,  4,  0,    7,  4, 11,   -1, -1, -1,   -1 },
+       {  3,  1,  4,    3,  4,  8,    1, 10,  4,    7,  4, 11,   10, 11,  4,   -1 },
+       {  4, 11,  7,    9, 11,  4,    9,  2, 11,    9,  1,  2,   -1, -1, -1,   -1 },
+       {  9,  7,  4,    9, 11,  7,    9,  1, 11,    2, 11,  1,    0,  8,  3,   -1 },
+       { 11,  7,  4,   11,  4,  2,    2,  4,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { 11,  7,  4,   11,  4,  2,    8,  3,  4,    3,  2,  4,   -1, -1, -1,   -1 },
+       {  2,  9, 10,    2,  7,  9,    2,  3,  7,    7,  4,  9,   -1, -1, -1,   -1 },
+       {  9, 10,  7,    9,  7,  4,   10,  2,  7,    8,  7,  0,    2,  0,  7,   -1 },
+       {  3,  7, 10,    3, 10,  2,    7,  4, 10,    1, 10,  0,    4,  0, 10,   -1 },
+       {  1, 10,  2,    8,  7,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  9,  1,    4,  1,  7,    7,  1,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  9,  1,    4,  1,  7,    0,  8,  1,    8,  7,  1,   -1, -1, -1,   -1 },
+       {  4,  0,  3,    7,  4,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  4,  8,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9, 10,  8,   10, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  0,  9,    3,  9, 11,   11,  9, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  1, 10,    0, 10,  8,    8, 10, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  1, 10,   11,  3, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  2, 11,    1, 11,  9,    9, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  0,  9,    3,  9, 11,    1,  2,  9,    2, 11,  9,   -1, -1, -1,   -1 },
+       {  0,  2, 11,    8,  0, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  3,  2, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  3,  8,    2,  8, 10,   10,  8,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  9, 10,  2,    0,  9,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  2,  3,  8,    2,  8, 10,    0,  1,  8,    1, 10,  8,   -1, -1, -1,   -1 },
+       {  1, 10,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  1,  3,  8,    9,  1,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  9,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       {  0,  3,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
+       { -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 }
+} };
+
+// Convert an edge index to the corner vertex indices for a cube.
+static const std::array< std::array<int32_t, 2>, 12> a2iEdgeConnection { {
+    {0, 1}, {1, 2}, {2, 3}, {3, 0},  // Bottom face.
+    {4, 5}, {5, 6}, {6, 7}, {7, 4},  // Top face.
+    {0, 4}, {1, 5}, {2, 6}, {3, 7}   // Side faces.
+} };
+
+// Consistently orient the faces of a Marching Cubes mesh so that normals point outward.
+//
+// Note that consistent reorientation can legitimately fail for non-orientable objects (e.g., Klein bottles).
+// Note that non-manifold meshes are difficult to orient consistently since adjacency information can be
+// incomplete.
+static
+bool
+Reorient_Faces(fv_surface_mesh<double, uint64_t> &fv_mesh){
+    uint64_t connected_component = 0;
+    if(!fv_mesh.faces.empty()){
+
+        // Make all faces triangles.
+        fv_mesh.convert_to_triangles();
+
+        // Regenerate involved faces index.
+        fv_mesh.recreate_involved_face_index();
+        const auto N_faces = fv_mesh.faces.size();
+
+        // Vector to track which faces belong to which connected components.
+        std::vector<uint64_t> face_component(N_faces, 0UL);
+
+        // Vector used to keep track of each connected component's signed volume.
+        std::vector<Stats::Running_Sum<double>> component_signed_volume;
+
+        // Create state to track which faces have been re-oriented.
+        enum class orientation_t : uint8_t {
+            unknown,
+            reoriented,
+        };
+        std::vector<orientation_t> reoriented_faces( N_faces, orientation_t::unknown );
+        const auto rf_beg = std::begin(reoriented_faces);
+        const auto rf_end = std::end(reoriented_faces);
+
+        // Prime the search and begin processing faces.
+        //
+        // Each individual mesh will be processed one-at-a-time, since we won't be able to traverse disconnected
+        // meshes by moving along face adjacencies.
+        auto p_it = std::find(rf_beg, rf_end, orientation_t::unknown );
+        while(p_it != rf_end){
+            component_signed_volume.emplace_back(); // Prime the signed volume for this component.
+            component_signed_volume.back().Digest(0.0);
+
+            const auto starting_face = static_cast<uint64_t>( std::distance( rf_beg, p_it ) );
+            reoriented_faces[starting_face] = orientation_t::reoriented;
+
+            // Create a set of half-edges that we expect adjacent faces to contain.
+            std::set<std::pair<uint64_t,uint64_t>> expected_half_edges;
+
+            // Prime it with the half-edges from the starting face.
+            uint64_t A = fv_mesh.faces[starting_face][0];
+            uint64_t B = fv_mesh.faces[starting_face][1];
+            uint64_t C = fv_mesh.faces[starting_face][2];
+            expected_half_edges.insert({ B, A });
+            expected_half_edges.insert({ C, B });
+            expected_half_edges.insert({ A, C });
+
+            // Create a face queue, which contains all the adjacent faces we need to visit.
+            std::set<uint64_t> adj_faces;
+
+            // Prime the list with all nearby faces we still need to visit.
+{
+    const uint64_t i = starting_face;
+    std::map<uint64_t, uint16_t> l_adj_faces;
+    for(const auto &j : fv_mesh.faces.at(i)){ // j refers to a vertex.
+        for(const auto &k : fv_mesh.involved_faces.at(j)){ // lookup the involved faces for vert j.
+            if(k != i) l_adj_faces[k] += 1U;
+        }
+    }
+    //std::set<uint64_t> result;
+    for(const auto &p : l_adj_faces){
+        const auto j = p.first;
+        if( (1U < p.second)
+        &&  (reoriented_faces.at(j) == orientation_t::unknown) ){
+            //result.insert(j);
+            adj_faces.insert(j);
+        }
+    }
+}
+
+            // While there are half-edges still in the queue.
+            while(!adj_faces.empty()){
+                const auto i = *std::begin(adj_faces);
+                A = fv_mesh.faces[i][0];
+                B = fv_mesh.faces[i][1];
+                C = fv_mesh.faces[i][2];
+
+                // Check if at least one half-edge is expected.
+                // If any are found, this face already has the correct orientation.
+                // If none are found, reorient the face.
+                // Note that there might be clashes due to non-orientability, but we ignore them for now (TODO).
+                auto AB_found = (expected_half_edges.count({ A, B }) != 0);
+                auto BC_found = (expected_half_edges.count({ B, C }) != 0);
+                auto CA_found = (expected_half_edges.count({ C, A }) != 0);
+
+                if( !AB_found
+                &&  !BC_found
+                &&  !CA_found ){
+                    std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
+                    A = fv_mesh.faces[i][0];
+                    B = fv_mesh.faces[i][1];
+                    C = fv_mesh.faces[i][2];
+                    AB_found = (expected_half_edges.count({ A, B }) != 0);
+                    BC_found = (expected_half_edges.count({ B, C }) != 0);
+                    CA_found = (expected_half_edges.count({ C, A }) != 0);
+                }
+
+                // The face is now considered to be consistently oriented.
+                // (This is done, even if there are topological issues, to ensure we don't get stuck on a face.)
+                reoriented_faces[i] = orientation_t::reoriented;
+                face_component[i] = connected_component;
+
+                // Add the current face's contribution to the signed volume.
+                //
+                // Note: using suggestion to only use a single linear dimension from
+                // https://math.stackexchange.com/questions/689418/how-to-compute-surface-normal-pointing-out-of-the-object
+                // I'm not certain if this is valid for meshes with holes...
+                try{
+                    const vec3<double> pos = (fv_mesh.vertices[A] + fv_mesh.vertices[B] + fv_mesh.vertices[C]) / 3.0;
+                    const vec3<double> cross = (fv_mesh.vertices[B] - fv_mesh.vertices[A]).Cross(fv_mesh.vertices[C] - fv_mesh.vertices[A]);
+                    const vec3<double> norm = cross.unit();
+                    const double area = cross.length() * 0.5;
+                    component_signed_volume.back().Digest(norm.x * pos.x * area);
+                }catch(const std::exception &){}; // In case the face is denegerate.
+
+                // Note that it's possible the face will not be able to find relevant half-edges.
+                // This can happen during marching cubes if an isolated voxel in the corner of an image volume is
+                // high and surrounded by all low voxels -- the face won't have any neighbours at all, so no
+                // matching half-edges will be found.
+                //
+                // Since a solitary face cannot be oriented, put it back the way it was and move on.
+                if( !AB_found
+                &&  !BC_found
+                &&  !CA_found ){
+                    std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
+                    adj_faces.erase(i);
+                    continue;
+                }
+
+
+                // Add neighbouring faces, but only those that share at least one edge.
+                // Faces of interest will appear at least twice when enumerating the adjacent faces for all vertices.
+                {
+                    std::map<uint64_t, uint16_t> l_adj_faces;
+                    for(const auto &j : fv_mesh.faces.at(i)){ // j refers to a vertex.
+                        for(const auto &k : fv_mesh.involved_faces.at(j)){ // lookup the involved faces for vert j.
+                            if(k != i) l_adj_faces[k] += 1U;
+                        }
+                    }
+                    //std::set<uint64_t> result;
+                    for(const auto &p : l_adj_faces){
+                        const auto j = p.first;
+                        if( (1U < p.second)
+                        &&  (reoriented_faces.at(j) == orientation_t::unknown) ){
+                            //result.insert(j);
+                            adj_faces.insert(j);
+                        }
+                    }
+                }
+
+                // Remove this face from the queue.
+                adj_faces.erase(i);
+
+                // Add half-edges relevant for adjacent faces.
+                if(!AB_found) expected_half_edges.insert({ B, A });
+                if(!BC_found) expected_half_edges.insert({ C, B });
+                if(!CA_found) expected_half_edges.insert({ A, C });
+
+                // Remove the half-edges that we matched.
+                // We assume no other faces will match (assuming manifold mesh).
+                if(AB_found) expected_half_edges.erase({ A, B });
+                if(BC_found) expected_half_edges.erase({ B, C });
+                if(CA_found) expected_half_edges.erase({ C, A });
+            }
+
+            // If the queue is empty, but there are still faces that need to be re-oriented, then there are multiple
+            // disconnected meshes. Start again using one of the faces as a new prototype.
+            ++connected_component;
+
+            // Search for the next unknown face.
+            p_it = std::find(p_it, rf_end, orientation_t::unknown );
+        }
+
+        // Normals should (barring non-orientability) be consistent. But we still need to decide if they correctly
+        // point outward. We can use signed volume to evaluate this.
+        for(size_t i = 0; i < N_faces; ++i){
+            const auto pos_orien = (0.0 <= component_signed_volume[face_component[i]].Current_Sum());
+            if(!pos_orien) std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
+        }
+    }
+    YLOGINFO("Finished re-orienting mesh with " << connected_component << " connected components");
+    return true;
+}
+
+
 // Marching Cubes core implementation. This routine must be fed an image volume.
 //
 // NOTE: This implementation borrows from the public domain implementation available at
@@ -115,315 +621,13 @@ Marching_Cubes_Implementation(
 
     const bool has_signed_dist_func = (sdf != nullptr);
 
-    // ============================================== Marching Cubes ================================================
-
-    // Use a curb vertex inclusivity int (8 bits) to determine which (of 12) edges are intersected by the ROI surface.
-    std::array<int32_t, 256> aiCubeEdgeFlags { {
-        0b000000000000, 0b000100001001, 0b001000000011, 0b001100001010, 0b010000000110, 0b010100001111, 0b011000000101,
-        0b011100001100, 0b100000001100, 0b100100000101, 0b101000001111, 0b101100000110, 0b110000001010, 0b110100000011,
-        0b111000001001, 0b111100000000, 0b000110010000, 0b000010011001, 0b001110010011, 0b001010011010, 0b010110010110,
-        0b010010011111, 0b011110010101, 0b011010011100, 0b100110011100, 0b100010010101, 0b101110011111, 0b101010010110,
-        0b110110011010, 0b110010010011, 0b111110011001, 0b111010010000, 0b001000110000, 0b001100111001, 0b000000110011,
-        0b000100111010, 0b011000110110, 0b011100111111, 0b010000110101, 0b010100111100, 0b101000111100, 0b101100110101,
-        0b100000111111, 0b100100110110, 0b111000111010, 0b111100110011, 0b110000111001, 0b110100110000, 0b001110100000,
-        0b001010101001, 0b000110100011, 0b000010101010, 0b011110100110, 0b011010101111, 0b010110100101, 0b010010101100,
-        0b101110101100, 0b101010100101, 0b100110101111, 0b100010100110, 0b111110101010, 0b111010100011, 0b110110101001,
-        0b110010100000, 0b010001100000, 0b010101101001, 0b011001100011, 0b011101101010, 0b000001100110, 0b000101101111,
-        0b001001100101, 0b001101101100, 0b110001101100, 0b110101100101, 0b111001101111, 0b111101100110, 0b100001101010,
-        0b100101100011, 0b101001101001, 0b101101100000, 0b010111110000, 0b010011111001, 0b011111110011, 0b011011111010,
-        0b000111110110, 0b000011111111, 0b001111110101, 0b001011111100, 0b110111111100, 0b110011110101, 0b111111111111,
-        0b111011110110, 0b100111111010, 0b100011110011, 0b101111111001, 0b101011110000, 0b011001010000, 0b011101011001,
-        0b010001010011, 0b010101011010, 0b001001010110, 0b001101011111, 0b000001010101, 0b000101011100, 0b111001011100,
-        0b111101010101, 0b110001011111, 0b110101010110, 0b101001011010, 0b101101010011, 0b100001011001, 0b100101010000,
-        0b011111000000, 0b011011001001, 0b010111000011, 0b010011001010, 0b001111000110, 0b001011001111, 0b000111000101,
-        0b000011001100, 0b111111001100, 0b111011000101, 0b110111001111, 0b110011000110, 0b101111001010, 0b101011000011,
-        0b100111001001, 0b100011000000, 0b100011000000, 0b100111001001, 0b101011000011, 0b101111001010, 0b110011000110,
-        0b110111001111, 0b111011000101, 0b111111001100, 0b000011001100, 0b000111000101, 0b001011001111, 0b001111000110,
-        0b010011001010, 0b010111000011, 0b011011001001, 0b011111000000, 0b100101010000, 0b100001011001, 0b101101010011,
-        0b101001011010, 0b110101010110, 0b110001011111, 0b111101010101, 0b111001011100, 0b000101011100, 0b000001010101,
-        0b001101011111, 0b001001010110, 0b010101011010, 0b010001010011, 0b011101011001, 0b011001010000, 0b101011110000,
-        0b101111111001, 0b100011110011, 0b100111111010, 0b111011110110, 0b111111111111, 0b110011110101, 0b110111111100,
-        0b001011111100, 0b001111110101, 0b000011111111, 0b000111110110, 0b011011111010, 0b011111110011, 0b010011111001,
-        0b010111110000, 0b101101100000, 0b101001101001, 0b100101100011, 0b100001101010, 0b111101100110, 0b111001101111,
-        0b110101100101, 0b110001101100, 0b001101101100, 0b001001100101, 0b000101101111, 0b000001100110, 0b011101101010,
-        0b011001100011, 0b010101101001, 0b010001100000, 0b110010100000, 0b110110101001, 0b111010100011, 0b111110101010,
-        0b100010100110, 0b100110101111, 0b101010100101, 0b101110101100, 0b010010101100, 0b010110100101, 0b011010101111,
-        0b011110100110, 0b000010101010, 0b000110100011, 0b001010101001, 0b001110100000, 0b110100110000, 0b110000111001,
-        0b111100110011, 0b111000111010, 0b100100110110, 0b100000111111, 0b101100110101, 0b101000111100, 0b010100111100,
-        0b010000110101, 0b011100111111, 0b011000110110, 0b000100111010, 0b000000110011, 0b001100111001, 0b001000110000,
-        0b111010010000, 0b111110011001, 0b110010010011, 0b110110011010, 0b101010010110, 0b101110011111, 0b100010010101,
-        0b100110011100, 0b011010011100, 0b011110010101, 0b010010011111, 0b010110010110, 0b001010011010, 0b001110010011,
-        0b000010011001, 0b000110010000, 0b111100000000, 0b111000001001, 0b110100000011, 0b110000001010, 0b101100000110,
-        0b101000001111, 0b100100000101, 0b100000001100, 0b011100001100, 0b011000000101, 0b010100001111, 0b010000000110,
-        0b001100001010, 0b001000000011, 0b000100001001, 0b000000000000
-    } };
-
-    // Determine which triangulation (0-5 triangles) is needed given the edge-surface intersections.
-    std::array< std::array<int32_t, 16>, 256> a2iTriangleConnectionTable  { {
-           { -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  1,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  8,  3,    9,  8,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,    1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  2, 10,    0,  2,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  8,  3,    2, 10,  8,   10,  9,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0, 11,  2,    8, 11,  0,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  9,  0,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1, 11,  2,    1,  9, 11,    9,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3, 10,  1,   11, 10,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0, 10,  1,    0,  8, 10,    8, 11, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  9,  0,    3, 11,  9,   11, 10,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  8, 10,   10,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  3,  0,    7,  3,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  1,  9,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  1,  9,    4,  7,  1,    7,  3,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  4,  7,    3,  0,  4,    1,  2, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  2, 10,    9,  0,  2,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2, 10,  9,    2,  9,  7,    2,  7,  3,    7,  9,  4,   -1, -1, -1,   -1 },
-           {  8,  4,  7,    3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  4,  7,   11,  2,  4,    2,  0,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  0,  1,    8,  4,  7,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  7, 11,    9,  4, 11,    9, 11,  2,    9,  2,  1,   -1, -1, -1,   -1 },
-           {  3, 10,  1,    3, 11, 10,    7,  8,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1, 11, 10,    1,  4, 11,    1,  0,  4,    7, 11,  4,   -1, -1, -1,   -1 },
-           {  4,  7,  8,    9,  0, 11,    9, 11, 10,   11,  0,  3,   -1, -1, -1,   -1 },
-           {  4,  7, 11,    4, 11,  9,    9, 11, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  5,  4,    0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  5,  4,    1,  5,  0,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  5,  4,    8,  3,  5,    3,  1,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,    9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  0,  8,    1,  2, 10,    4,  9,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5,  2, 10,    5,  4,  2,    4,  0,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2, 10,  5,    3,  2,  5,    3,  5,  4,    3,  4,  8,   -1, -1, -1,   -1 },
-           {  9,  5,  4,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0, 11,  2,    0,  8, 11,    4,  9,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  5,  4,    0,  1,  5,    2,  3, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  1,  5,    2,  5,  8,    2,  8, 11,    4,  8,  5,   -1, -1, -1,   -1 },
-           { 10,  3, 11,   10,  1,  3,    9,  5,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  9,  5,    0,  8,  1,    8, 10,  1,    8, 11, 10,   -1, -1, -1,   -1 },
-           {  5,  4,  0,    5,  0, 11,    5, 11, 10,   11,  0,  3,   -1, -1, -1,   -1 },
-           {  5,  4,  8,    5,  8, 10,   10,  8, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  7,  8,    5,  7,  9,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  3,  0,    9,  5,  3,    5,  7,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  7,  8,    0,  1,  7,    1,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  5,  3,    3,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  7,  8,    9,  5,  7,   10,  1,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  1,  2,    9,  5,  0,    5,  3,  0,    5,  7,  3,   -1, -1, -1,   -1 },
-           {  8,  0,  2,    8,  2,  5,    8,  5,  7,   10,  5,  2,   -1, -1, -1,   -1 },
-           {  2, 10,  5,    2,  5,  3,    3,  5,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7,  9,  5,    7,  8,  9,    3, 11,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  5,  7,    9,  7,  2,    9,  2,  0,    2,  7, 11,   -1, -1, -1,   -1 },
-           {  2,  3, 11,    0,  1,  8,    1,  7,  8,    1,  5,  7,   -1, -1, -1,   -1 },
-           { 11,  2,  1,   11,  1,  7,    7,  1,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  5,  8,    8,  5,  7,   10,  1,  3,   10,  3, 11,   -1, -1, -1,   -1 },
-           {  5,  7,  0,    5,  0,  9,    7, 11,  0,    1,  0, 10,   11, 10,  0,   -1 },
-           { 11, 10,  0,   11,  0,  3,   10,  5,  0,    8,  0,  7,    5,  7,  0,   -1 },
-           { 11, 10,  5,    7, 11,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  0,  1,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  8,  3,    1,  9,  8,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  6,  5,    2,  6,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  6,  5,    1,  2,  6,    3,  0,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  6,  5,    9,  0,  6,    0,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5,  9,  8,    5,  8,  2,    5,  2,  6,    3,  2,  8,   -1, -1, -1,   -1 },
-           {  2,  3, 11,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  0,  8,   11,  2,  0,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  1,  9,    2,  3, 11,    5, 10,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5, 10,  6,    1,  9,  2,    9, 11,  2,    9,  8, 11,   -1, -1, -1,   -1 },
-           {  6,  3, 11,    6,  5,  3,    5,  1,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8, 11,    0, 11,  5,    0,  5,  1,    5, 11,  6,   -1, -1, -1,   -1 },
-           {  3, 11,  6,    0,  3,  6,    0,  6,  5,    0,  5,  9,   -1, -1, -1,   -1 },
-           {  6,  5,  9,    6,  9, 11,   11,  9,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5, 10,  6,    4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  3,  0,    4,  7,  3,    6,  5, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  9,  0,    5, 10,  6,    8,  4,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  6,  5,    1,  9,  7,    1,  7,  3,    7,  9,  4,   -1, -1, -1,   -1 },
-           {  6,  1,  2,    6,  5,  1,    4,  7,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2,  5,    5,  2,  6,    3,  0,  4,    3,  4,  7,   -1, -1, -1,   -1 },
-           {  8,  4,  7,    9,  0,  5,    0,  6,  5,    0,  2,  6,   -1, -1, -1,   -1 },
-           {  7,  3,  9,    7,  9,  4,    3,  2,  9,    5,  9,  6,    2,  6,  9,   -1 },
-           {  3, 11,  2,    7,  8,  4,   10,  6,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5, 10,  6,    4,  7,  2,    4,  2,  0,    2,  7, 11,   -1, -1, -1,   -1 },
-           {  0,  1,  9,    4,  7,  8,    2,  3, 11,    5, 10,  6,   -1, -1, -1,   -1 },
-           {  9,  2,  1,    9, 11,  2,    9,  4, 11,    7, 11,  4,    5, 10,  6,   -1 },
-           {  8,  4,  7,    3, 11,  5,    3,  5,  1,    5, 11,  6,   -1, -1, -1,   -1 },
-           {  5,  1, 11,    5, 11,  6,    1,  0, 11,    7, 11,  4,    0,  4, 11,   -1 },
-           {  0,  5,  9,    0,  6,  5,    0,  3,  6,   11,  6,  3,    8,  4,  7,   -1 },
-           {  6,  5,  9,    6,  9, 11,    4,  7,  9,    7, 11,  9,   -1, -1, -1,   -1 },
-           { 10,  4,  9,    6,  4, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4, 10,  6,    4,  9, 10,    0,  8,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  0,  1,   10,  6,  0,    6,  4,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  3,  1,    8,  1,  6,    8,  6,  4,    6,  1, 10,   -1, -1, -1,   -1 },
-           {  1,  4,  9,    1,  2,  4,    2,  6,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  0,  8,    1,  2,  9,    2,  4,  9,    2,  6,  4,   -1, -1, -1,   -1 },
-           {  0,  2,  4,    4,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  3,  2,    8,  2,  4,    4,  2,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  4,  9,   10,  6,  4,   11,  2,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  2,    2,  8, 11,    4,  9, 10,    4, 10,  6,   -1, -1, -1,   -1 },
-           {  3, 11,  2,    0,  1,  6,    0,  6,  4,    6,  1, 10,   -1, -1, -1,   -1 },
-           {  6,  4,  1,    6,  1, 10,    4,  8,  1,    2,  1, 11,    8, 11,  1,   -1 },
-           {  9,  6,  4,    9,  3,  6,    9,  1,  3,   11,  6,  3,   -1, -1, -1,   -1 },
-           {  8, 11,  1,    8,  1,  0,   11,  6,  1,    9,  1,  4,    6,  4,  1,   -1 },
-           {  3, 11,  6,    3,  6,  0,    0,  6,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  6,  4,  8,   11,  6,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7, 10,  6,    7,  8, 10,    8,  9, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  7,  3,    0, 10,  7,    0,  9, 10,    6,  7, 10,   -1, -1, -1,   -1 },
-           { 10,  6,  7,    1, 10,  7,    1,  7,  8,    1,  8,  0,   -1, -1, -1,   -1 },
-           { 10,  6,  7,   10,  7,  1,    1,  7,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2,  6,    1,  6,  8,    1,  8,  9,    8,  6,  7,   -1, -1, -1,   -1 },
-           {  2,  6,  9,    2,  9,  1,    6,  7,  9,    0,  9,  3,    7,  3,  9,   -1 },
-           {  7,  8,  0,    7,  0,  6,    6,  0,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7,  3,  2,    6,  7,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  3, 11,   10,  6,  8,   10,  8,  9,    8,  6,  7,   -1, -1, -1,   -1 },
-           {  2,  0,  7,    2,  7, 11,    0,  9,  7,    6,  7, 10,    9, 10,  7,   -1 },
-           {  1,  8,  0,    1,  7,  8,    1, 10,  7,    6,  7, 10,    2,  3, 11,   -1 },
-           { 11,  2,  1,   11,  1,  7,   10,  6,  1,    6,  7,  1,   -1, -1, -1,   -1 },
-           {  8,  9,  6,    8,  6,  7,    9,  1,  6,   11,  6,  3,    1,  3,  6,   -1 },
-           {  0,  9,  1,   11,  6,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7,  8,  0,    7,  0,  6,    3, 11,  0,   11,  6,  0,   -1, -1, -1,   -1 },
-           {  7, 11,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  0,  8,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  1,  9,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  1,  9,    8,  3,  1,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  1,  2,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,    3,  0,  8,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  9,  0,    2, 10,  9,    6, 11,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  6, 11,  7,    2, 10,  3,   10,  8,  3,   10,  9,  8,   -1, -1, -1,   -1 },
-           {  7,  2,  3,    6,  2,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  7,  0,  8,    7,  6,  0,    6,  2,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  7,  6,    2,  3,  7,    0,  1,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  6,  2,    1,  8,  6,    1,  9,  8,    8,  7,  6,   -1, -1, -1,   -1 },
-           { 10,  7,  6,   10,  1,  7,    1,  3,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  7,  6,    1,  7, 10,    1,  8,  7,    1,  0,  8,   -1, -1, -1,   -1 },
-           {  0,  3,  7,    0,  7, 10,    0, 10,  9,    6, 10,  7,   -1, -1, -1,   -1 },
-           {  7,  6, 10,    7, 10,  8,    8, 10,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  6,  8,  4,   11,  8,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  6, 11,    3,  0,  6,    0,  4,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  6, 11,    8,  4,  6,    9,  0,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  4,  6,    9,  6,  3,    9,  3,  1,   11,  3,  6,   -1, -1, -1,   -1 },
-           {  6,  8,  4,    6, 11,  8,    2, 10,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,    3,  0, 11,    0,  6, 11,    0,  4,  6,   -1, -1, -1,   -1 },
-           {  4, 11,  8,    4,  6, 11,    0,  2,  9,    2, 10,  9,   -1, -1, -1,   -1 },
-           { 10,  9,  3,   10,  3,  2,    9,  4,  3,   11,  3,  6,    4,  6,  3,   -1 },
-           {  8,  2,  3,    8,  4,  2,    4,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  4,  2,    4,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  9,  0,    2,  3,  4,    2,  4,  6,    4,  3,  8,   -1, -1, -1,   -1 },
-           {  1,  9,  4,    1,  4,  2,    2,  4,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  1,  3,    8,  6,  1,    8,  4,  6,    6, 10,  1,   -1, -1, -1,   -1 },
-           { 10,  1,  0,   10,  0,  6,    6,  0,  4,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  6,  3,    4,  3,  8,    6, 10,  3,    0,  3,  9,   10,  9,  3,   -1 },
-           { 10,  9,  4,    6, 10,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  9,  5,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,    4,  9,  5,   11,  7,  6,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5,  0,  1,    5,  4,  0,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  7,  6,    8,  3,  4,    3,  5,  4,    3,  1,  5,   -1, -1, -1,   -1 },
-           {  9,  5,  4,   10,  1,  2,    7,  6, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  6, 11,  7,    1,  2, 10,    0,  8,  3,    4,  9,  5,   -1, -1, -1,   -1 },
-           {  7,  6, 11,    5,  4, 10,    4,  2, 10,    4,  0,  2,   -1, -1, -1,   -1 },
-           {  3,  4,  8,    3,  5,  4,    3,  2,  5,   10,  5,  2,   11,  7,  6,   -1 },
-           {  7,  2,  3,    7,  6,  2,    5,  4,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  5,  4,    0,  8,  6,    0,  6,  2,    6,  8,  7,   -1, -1, -1,   -1 },
-           {  3,  6,  2,    3,  7,  6,    1,  5,  0,    5,  4,  0,   -1, -1, -1,   -1 },
-           {  6,  2,  8,    6,  8,  7,    2,  1,  8,    4,  8,  5,    1,  5,  8,   -1 },
-           {  9,  5,  4,   10,  1,  6,    1,  7,  6,    1,  3,  7,   -1, -1, -1,   -1 },
-           {  1,  6, 10,    1,  7,  6,    1,  0,  7,    8,  7,  0,    9,  5,  4,   -1 },
-           {  4,  0, 10,    4, 10,  5,    0,  3, 10,    6, 10,  7,    3,  7, 10,   -1 },
-           {  7,  6, 10,    7, 10,  8,    5,  4, 10,    4,  8, 10,   -1, -1, -1,   -1 },
-           {  6,  9,  5,    6, 11,  9,   11,  8,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  6, 11,    0,  6,  3,    0,  5,  6,    0,  9,  5,   -1, -1, -1,   -1 },
-           {  0, 11,  8,    0,  5, 11,    0,  1,  5,    5,  6, 11,   -1, -1, -1,   -1 },
-           {  6, 11,  3,    6,  3,  5,    5,  3,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 10,    9,  5, 11,    9, 11,  8,   11,  5,  6,   -1, -1, -1,   -1 },
-           {  0, 11,  3,    0,  6, 11,    0,  9,  6,    5,  6,  9,    1,  2, 10,   -1 },
-           { 11,  8,  5,   11,  5,  6,    8,  0,  5,   10,  5,  2,    0,  2,  5,   -1 },
-           {  6, 11,  3,    6,  3,  5,    2, 10,  3,   10,  5,  3,   -1, -1, -1,   -1 },
-           {  5,  8,  9,    5,  2,  8,    5,  6,  2,    3,  8,  2,   -1, -1, -1,   -1 },
-           {  9,  5,  6,    9,  6,  0,    0,  6,  2,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  5,  8,    1,  8,  0,    5,  6,  8,    3,  8,  2,    6,  2,  8,   -1 },
-           {  1,  5,  6,    2,  1,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  3,  6,    1,  6, 10,    3,  8,  6,    5,  6,  9,    8,  9,  6,   -1 },
-           { 10,  1,  0,   10,  0,  6,    9,  5,  0,    5,  6,  0,   -1, -1, -1,   -1 },
-           {  0,  3,  8,    5,  6, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  5,  6,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  5, 10,    7,  5, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  5, 10,   11,  7,  5,    8,  3,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5, 11,  7,    5, 10, 11,    1,  9,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 10,  7,  5,   10, 11,  7,    9,  8,  1,    8,  3,  1,   -1, -1, -1,   -1 },
-           { 11,  1,  2,   11,  7,  1,    7,  5,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,    1,  2,  7,    1,  7,  5,    7,  2, 11,   -1, -1, -1,   -1 },
-           {  9,  7,  5,    9,  2,  7,    9,  0,  2,    2, 11,  7,   -1, -1, -1,   -1 },
-           {  7,  5,  2,    7,  2, 11,    5,  9,  2,    3,  2,  8,    9,  8,  2,   -1 },
-           {  2,  5, 10,    2,  3,  5,    3,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  2,  0,    8,  5,  2,    8,  7,  5,   10,  2,  5,   -1, -1, -1,   -1 },
-           {  9,  0,  1,    5, 10,  3,    5,  3,  7,    3, 10,  2,   -1, -1, -1,   -1 },
-           {  9,  8,  2,    9,  2,  1,    8,  7,  2,   10,  2,  5,    7,  5,  2,   -1 },
-           {  1,  3,  5,    3,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  7,    0,  7,  1,    1,  7,  5,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  0,  3,    9,  3,  5,    5,  3,  7,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9,  8,  7,    5,  9,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5,  8,  4,    5, 10,  8,   10, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  5,  0,  4,    5, 11,  0,    5, 10, 11,   11,  3,  0,   -1, -1, -1,   -1 },
-           {  0,  1,  9,    8,  4, 10,    8, 10, 11,   10,  4,  5,   -1, -1, -1,   -1 },
-           { 10, 11,  4,   10,  4,  5,   11,  3,  4,    9,  4,  1,    3,  1,  4,   -1 },
-           {  2,  5,  1,    2,  8,  5,    2, 11,  8,    4,  5,  8,   -1, -1, -1,   -1 },
-           {  0,  4, 11,    0, 11,  3,    4,  5, 11,    2, 11,  1,    5,  1, 11,   -1 },
-           {  0,  2,  5,    0,  5,  9,    2, 11,  5,    4,  5,  8,   11,  8,  5,   -1 },
-           {  9,  4,  5,    2, 11,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  5, 10,    3,  5,  2,    3,  4,  5,    3,  8,  4,   -1, -1, -1,   -1 },
-           {  5, 10,  2,    5,  2,  4,    4,  2,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3, 10,  2,    3,  5, 10,    3,  8,  5,    4,  5,  8,    0,  1,  9,   -1 },
-           {  5, 10,  2,    5,  2,  4,    1,  9,  2,    9,  4,  2,   -1, -1, -1,   -1 },
-           {  8,  4,  5,    8,  5,  3,    3,  5,  1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  4,  5,    1,  0,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  8,  4,  5,    8,  5,  3,    9,  0,  5,    0,  3,  5,   -1, -1, -1,   -1 },
-           {  9,  4,  5,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4, 11,  7,    4,  9, 11,    9, 10, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  8,  3,    4,  9,  7,    9, 11,  7,    9, 10, 11,   -1, -1, -1,   -1 },
-           {  1, 10, 11,    1, 11,  4,    1,  4,  0,    7,  4, 11,   -1, -1, -1,   -1 },
-           {  3,  1,  4,    3,  4,  8,    1, 10,  4,    7,  4, 11,   10, 11,  4,   -1 },
-           {  4, 11,  7,    9, 11,  4,    9,  2, 11,    9,  1,  2,   -1, -1, -1,   -1 },
-           {  9,  7,  4,    9, 11,  7,    9,  1, 11,    2, 11,  1,    0,  8,  3,   -1 },
-           { 11,  7,  4,   11,  4,  2,    2,  4,  0,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { 11,  7,  4,   11,  4,  2,    8,  3,  4,    3,  2,  4,   -1, -1, -1,   -1 },
-           {  2,  9, 10,    2,  7,  9,    2,  3,  7,    7,  4,  9,   -1, -1, -1,   -1 },
-           {  9, 10,  7,    9,  7,  4,   10,  2,  7,    8,  7,  0,    2,  0,  7,   -1 },
-           {  3,  7, 10,    3, 10,  2,    7,  4, 10,    1, 10,  0,    4,  0, 10,   -1 },
-           {  1, 10,  2,    8,  7,  4,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  9,  1,    4,  1,  7,    7,  1,  3,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  9,  1,    4,  1,  7,    0,  8,  1,    8,  7,  1,   -1, -1, -1,   -1 },
-           {  4,  0,  3,    7,  4,  3,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  4,  8,  7,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9, 10,  8,   10, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  0,  9,    3,  9, 11,   11,  9, 10,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  1, 10,    0, 10,  8,    8, 10, 11,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  1, 10,   11,  3, 10,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  2, 11,    1, 11,  9,    9, 11,  8,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  0,  9,    3,  9, 11,    1,  2,  9,    2, 11,  9,   -1, -1, -1,   -1 },
-           {  0,  2, 11,    8,  0, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  3,  2, 11,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  3,  8,    2,  8, 10,   10,  8,  9,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  9, 10,  2,    0,  9,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  2,  3,  8,    2,  8, 10,    0,  1,  8,    1, 10,  8,   -1, -1, -1,   -1 },
-           {  1, 10,  2,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  1,  3,  8,    9,  1,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  9,  1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           {  0,  3,  8,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 },
-           { -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1, -1, -1,   -1 }
-    } };
+    // Compile the signed distance function so it can be evaluated in batches.
+    std::optional<csg::sdf::tape> sdf_tape;
+    if(has_signed_dist_func){
+        sdf_tape.emplace(sdf);
+    }
 
-    // Convert an edge index to the corner vertex indices for a cube.
-    const std::array< std::array<int32_t, 2>, 12> a2iEdgeConnection { {
-        {0, 1}, {1, 2}, {2, 3}, {3, 0},  // Bottom face.
-        {4, 5}, {5, 6}, {6, 7}, {7, 4},  // Top face.
-        {0, 4}, {1, 5}, {2, 6}, {3, 7}   // Side faces.
-    } };
+    // ============================================== Marching Cubes ================================================
 
     // Storage for partially-connected meshes within the plane of a single image.
     // Data is processed one image at a time and we only merge meshes and de-duplicate out-of-plane vertices afterward.
@@ -543,6 +747,77 @@ Marching_Cubes_Implementation(
             throw std::invalid_argument("Regular grids are required for this algorithm -- images must all have the same number of rows and columns");
         }
 
+        // Sample the signed distance function at the Marching Cube voxel corners.
+        //
+        // The corners form a grid of (N_rows + 1) x (N_cols + 1) positions on two planes. Blocks of voxels that are
+        // entirely inside or outside of the surface, according to the interval bounds, are not sampled. Instead, a
+        // bound (which has the correct classification and will therefore produce no faces) is used. The remaining
+        // positions are evaluated together in batches.
+        const int64_t N_grid_rows = N_rows + 1;
+        const int64_t N_grid_cols = N_cols + 1;
+        const auto grid_index = [&](int64_t layer, int64_t row, int64_t col) -> int64_t {
+            return (layer * N_grid_rows + row) * N_grid_cols + col;
+        };
+        std::vector<double> sdf_grid;
+        if(has_signed_dist_func){
+            const auto pos_0 = img_refw.get().position(0, 0);
+            const auto grid_position = [&](int64_t layer, int64_t row, int64_t col) -> vec3<double> {
+                return pos_0 + row_unit * (pxl_dx * row) + col_unit * (pxl_dy * col) + img_unit * (pxl_dz * layer);
+            };
+            sdf_grid.resize(2 * N_grid_rows * N_grid_cols);
+            std::vector<uint8_t> needs_eval(sdf_grid.size(), 0);
+
+            const int64_t block_width = 8;
+            for(int64_t r0 = 0; r0 < N_rows; r0 += block_width){
+                const auto r1 = std::min<int64_t>(N_rows, r0 + block_width);
+                for(int64_t c0 = 0; c0 < N_cols; c0 += block_width){
+                    const auto c1 = std::min<int64_t>(N_cols, c0 + block_width);
+
+                    // Bound the SDF over the ball enclosing all corners of the block.
+                    const auto corner_lo = grid_position(0, r0, c0);
+                    const auto corner_hi = grid_position(1, r1, c1);
+                    const auto bounds = sdf_tape->evaluate_interval( (corner_lo + corner_hi) * 0.5,
+                                                                     (corner_hi - corner_lo).length() * 0.5 );
+                    const bool all_above = (inclusion_threshold < bounds.lo);
+                    const bool all_below = (bounds.hi < inclusion_threshold);
+                    for(int64_t layer = 0; layer < 2; ++layer){
+                        for(int64_t row = r0; row <= r1; ++row){
+                            for(int64_t col = c0; col <= c1; ++col){
+                                const auto i = grid_index(layer, row, col);
+                                if(!all_above && !all_below){
+                                    needs_eval[i] = 1;
+                                }else if(needs_eval[i] == 0){
+                                    sdf_grid[i] = (all_above) ? bounds.lo : bounds.hi;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::vector<int64_t> indices;
+            std::vector<double> xs, ys, zs;
+            for(int64_t layer = 0; layer < 2; ++layer){
+                for(int64_t row = 0; row < N_grid_rows; ++row){
+                    for(int64_t col = 0; col < N_grid_cols; ++col){
+                        const auto i = grid_index(layer, row, col);
+                        if(needs_eval[i] == 0) continue;
+                        const auto p = grid_position(layer, row, col);
+                        indices.emplace_back(i);
+                        xs.emplace_back(p.x);
+                        ys.emplace_back(p.y);
+                        zs.emplace_back(p.z);
+                    }
+                }
+            }
+            std::vector<double> vals(indices.size());
+            csg::sdf::tape::workspace w;
+            sdf_tape->evaluate(xs.data(), ys.data(), zs.data(), vals.data(), static_cast<int64_t>(vals.size()), w);
+            for(size_t j = 0; j < indices.size(); ++j){
+                sdf_grid[indices[j]] = vals[j];
+            }
+        }
+
         // Generate a generic list of vertex index offsets to check for vertex deduplication.
         // This list will be offset by the current voxel coordinates and unreachable neighbours will be pruned.
         std::set<int64_t> vscor_to_check;
@@ -618,11 +893,16 @@ Marching_Cubes_Implementation(
 
                 // Use the provided signed distance function to 'override' the image voxel intensities.
                 //
-                // This approach is slow but extremely flexible for meshing complicated shapes (e.g., Booleans).
+                // This approach is extremely flexible for meshing complicated shapes (e.g., Booleans).
                 }else{
-                    for(int32_t corner = 0; corner < 8; ++corner){
-                        afCubeValue[corner] = sdf->evaluate_sdf(pos + a2fVertexOffset[corner]);
-                    }
+                    afCubeValue[0] = sdf_grid[grid_index(0, row,     col    )];
+                    afCubeValue[1] = sdf_grid[grid_index(0, row + 1, col    )];
+                    afCubeValue[2] = sdf_grid[grid_index(0, row + 1, col + 1)];
+                    afCubeValue[3] = sdf_grid[grid_index(0, row,     col + 1)];
+                    afCubeValue[4] = sdf_grid[grid_index(1, row,     col    )];
+                    afCubeValue[5] = sdf_grid[grid_index(1, row + 1, col    )];
+                    afCubeValue[6] = sdf_grid[grid_index(1, row + 1, col + 1)];
+                    afCubeValue[7] = sdf_grid[grid_index(1, row,     col + 1)];
                 }
                 
                 // Convert vertex inclusion to a bitmask.
@@ -856,195 +1136,251 @@ Marching_Cubes_Implementation(
 //    fv_mesh.merge_duplicate_vertices(final_merge_tol);
 
     YLOGINFO("Orienting face normals..");
-    // Note that consistent reorientation can legitimately fail for non-orientable objects (e.g., Klein bottles).
-    // Note that non-manifold meshes are difficult to orient consistently since adjacency information can be
-    // incomplete.
-    const auto reorient_faces = [](fv_surface_mesh<double, uint64_t> &fv_mesh) -> bool {
-        uint64_t connected_component = 0;
-        if(!fv_mesh.faces.empty()){
-
-            // Make all faces triangles.
-            fv_mesh.convert_to_triangles();
-
-            // Regenerate involved faces index.
-            fv_mesh.recreate_involved_face_index();
-            const auto N_faces = fv_mesh.faces.size();
-
-            // Vector to track which faces belong to which connected components.
-            std::vector<uint64_t> face_component(N_faces, 0UL);
-
-            // Vector used to keep track of each connected component's signed volume.
-            std::vector<Stats::Running_Sum<double>> component_signed_volume;
-
-            // Create state to track which faces have been re-oriented.
-            enum class orientation_t : uint8_t {
-                unknown,
-                reoriented,
-            };
-            std::vector<orientation_t> reoriented_faces( N_faces, orientation_t::unknown );
-            const auto rf_beg = std::begin(reoriented_faces);
-            const auto rf_end = std::end(reoriented_faces);
-
-            // Prime the search and begin processing faces.
-            //
-            // Each individual mesh will be processed one-at-a-time, since we won't be able to traverse disconnected
-            // meshes by moving along face adjacencies.
-            auto p_it = std::find(rf_beg, rf_end, orientation_t::unknown );
-            while(p_it != rf_end){
-                component_signed_volume.emplace_back(); // Prime the signed volume for this component.
-                component_signed_volume.back().Digest(0.0);
-
-                const auto starting_face = static_cast<uint64_t>( std::distance( rf_beg, p_it ) );
-                reoriented_faces[starting_face] = orientation_t::reoriented;
-
-                // Create a set of half-edges that we expect adjacent faces to contain.
-                std::set<std::pair<uint64_t,uint64_t>> expected_half_edges;
-
-                // Prime it with the half-edges from the starting face.
-                uint64_t A = fv_mesh.faces[starting_face][0];
-                uint64_t B = fv_mesh.faces[starting_face][1];
-                uint64_t C = fv_mesh.faces[starting_face][2];
-                expected_half_edges.insert({ B, A });
-                expected_half_edges.insert({ C, B });
-                expected_half_edges.insert({ A, C });
-
-                // Create a face queue, which contains all the adjacent faces we need to visit.
-                std::set<uint64_t> adj_faces;
-
-                // Prime the list with all nearby faces we still need to visit.
-    {
-        const uint64_t i = starting_face;
-        std::map<uint64_t, uint16_t> l_adj_faces;
-        for(const auto &j : fv_mesh.faces.at(i)){ // j refers to a vertex.
-            for(const auto &k : fv_mesh.involved_faces.at(j)){ // lookup the involved faces for vert j.
-                if(k != i) l_adj_faces[k] += 1U;
-            }
-        }
-        //std::set<uint64_t> result;
-        for(const auto &p : l_adj_faces){
-            const auto j = p.first;
-            if( (1U < p.second)
-            &&  (reoriented_faces.at(j) == orientation_t::unknown) ){
-                //result.insert(j);
-                adj_faces.insert(j);
-            }
-        }
+    if(!Reorient_Faces(fv_mesh)){
+        YLOGWARN("Unable to consistently re-orient mesh. This should never happen after marching cubes");
     }
 
-                // While there are half-edges still in the queue.
-                while(!adj_faces.empty()){
-                    const auto i = *std::begin(adj_faces);
-                    A = fv_mesh.faces[i][0];
-                    B = fv_mesh.faces[i][1];
-                    C = fv_mesh.faces[i][2];
-
-                    // Check if at least one half-edge is expected.
-                    // If any are found, this face already has the correct orientation.
-                    // If none are found, reorient the face.
-                    // Note that there might be clashes due to non-orientability, but we ignore them for now (TODO).
-                    auto AB_found = (expected_half_edges.count({ A, B }) != 0);
-                    auto BC_found = (expected_half_edges.count({ B, C }) != 0);
-                    auto CA_found = (expected_half_edges.count({ C, A }) != 0);
-
-                    if( !AB_found
-                    &&  !BC_found
-                    &&  !CA_found ){
-                        std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
-                        A = fv_mesh.faces[i][0];
-                        B = fv_mesh.faces[i][1];
-                        C = fv_mesh.faces[i][2];
-                        AB_found = (expected_half_edges.count({ A, B }) != 0);
-                        BC_found = (expected_half_edges.count({ B, C }) != 0);
-                        CA_found = (expected_half_edges.count({ C, A }) != 0);
-                    }
+    YLOGINFO("Removing disconnected vertices..");
+    fv_mesh.recreate_involved_face_index();
+    fv_mesh.remove_disconnected_vertices();
+    fv_mesh.involved_faces.clear();
 
-                    // The face is now considered to be consistently oriented.
-                    // (This is done, even if there are topological issues, to ensure we don't get stuck on a face.)
-                    reoriented_faces[i] = orientation_t::reoriented;
-                    face_component[i] = connected_component;
+    YLOGINFO("The triangulated surface has " << fv_mesh.vertices.size() << " vertices"
+             " and " << fv_mesh.faces.size() << " faces");
+  
+    return fv_mesh;
+}
 
-                    // Add the current face's contribution to the signed volume.
-                    //
-                    // Note: using suggestion to only use a single linear dimension from
-                    // https://math.stackexchange.com/questions/689418/how-to-compute-surface-normal-pointing-out-of-the-object
-                    // I'm not certain if this is valid for meshes with holes...
-                    try{
-                        const vec3<double> pos = (fv_mesh.vertices[A] + fv_mesh.vertices[B] + fv_mesh.vertices[C]) / 3.0;
-                        const vec3<double> cross = (fv_mesh.vertices[B] - fv_mesh.vertices[A]).Cross(fv_mesh.vertices[C] - fv_mesh.vertices[A]);
-                        const vec3<double> norm = cross.unit();
-                        const double area = cross.length() * 0.5;
-                        component_signed_volume.back().Digest(norm.x * pos.x * area);
-                    }catch(const std::exception &){}; // In case the face is denegerate.
-
-                    // Note that it's possible the face will not be able to find relevant half-edges.
-                    // This can happen during marching cubes if an isolated voxel in the corner of an image volume is
-                    // high and surrounded by all low voxels -- the face won't have any neighbours at all, so no
-                    // matching half-edges will be found.
-                    //
-                    // Since a solitary face cannot be oriented, put it back the way it was and move on.
-                    if( !AB_found
-                    &&  !BC_found
-                    &&  !CA_found ){
-                        std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
-                        adj_faces.erase(i);
-                        continue;
-                    }
 
 
-                    // Add neighbouring faces, but only those that share at least one edge.
-                    // Faces of interest will appear at least twice when enumerating the adjacent faces for all vertices.
-                    {
-                        std::map<uint64_t, uint16_t> l_adj_faces;
-                        for(const auto &j : fv_mesh.faces.at(i)){ // j refers to a vertex.
-                            for(const auto &k : fv_mesh.involved_faces.at(j)){ // lookup the involved faces for vert j.
-                                if(k != i) l_adj_faces[k] += 1U;
-                            }
-                        }
-                        //std::set<uint64_t> result;
-                        for(const auto &p : l_adj_faces){
-                            const auto j = p.first;
-                            if( (1U < p.second)
-                            &&  (reoriented_faces.at(j) == orientation_t::unknown) ){
-                                //result.insert(j);
-                                adj_faces.insert(j);
-                            }
-                        }
-                    }
+// Number of cells along each axis of the bricks used by the narrow-band Marching Cubes implementation.
+static const int64_t narrow_band_brick_width = 8;
 
-                    // Remove this face from the queue.
-                    adj_faces.erase(i);
+// A regular lattice of sample positions used by the narrow-band Marching Cubes implementation.
+//
+// Node (i, j, k) is located at origin + axes[0]*i + axes[1]*j + axes[2]*k, and cells span adjacent nodes.
+// If slice_origins is provided, node (i, j, k) is instead located at slice_origins[k] + axes[0]*i + axes[1]*j so that
+// slices can be irregularly spaced; axes[2] then only indicates the nominal slice spacing.
+// Values are provided by the callbacks, so the lattice itself does not need to be stored.
+struct narrow_band_lattice {
+    vec3<double> origin;
+    std::array<vec3<double>, 3> axes;
+    std::array<int64_t, 3> N = {{ 0, 0, 0 }}; // The number of nodes along each axis.
+    std::vector<vec3<double>> slice_origins; // Optional. Either empty or N[2] positions.
+
+    // Bound the values of all nodes in the inclusive range [lo, hi]. Bounds must be conservative.
+    std::function<csg::sdf::interval(const std::array<int64_t, 3> &lo,
+                                     const std::array<int64_t, 3> &hi)> bound;
+
+    // Sample all nodes in the inclusive range [lo, hi]. Values are stored with the last index varying fastest.
+    std::function<void(const std::array<int64_t, 3> &lo,
+                       const std::array<int64_t, 3> &hi,
+                       std::vector<double> &out)> sample;
+
+    vec3<double> position(int64_t i, int64_t j, int64_t k) const {
+        if(!this->slice_origins.empty()){
+            return this->slice_origins[k] + this->axes[0] * static_cast<double>(i)
+                                          + this->axes[1] * static_cast<double>(j);
+        }
+        return this->origin + this->axes[0] * static_cast<double>(i)
+                            + this->axes[1] * static_cast<double>(j)
+                            + this->axes[2] * static_cast<double>(k);
+    }
+};
 
-                    // Add half-edges relevant for adjacent faces.
-                    if(!AB_found) expected_half_edges.insert({ B, A });
-                    if(!BC_found) expected_half_edges.insert({ C, B });
-                    if(!CA_found) expected_half_edges.insert({ A, C });
+// Marching Cubes restricted to a narrow band around the surface.
+//
+// The lattice is recursively subdivided (i.e., an octree) and regions whose bounds show they are entirely inside or
+// outside of the surface are discarded. Only bricks straddling the surface are sampled and meshed, so time and memory
+// scale with the surface area rather than the volume. Vertices are keyed by the lattice edge (or node) they lie on, so
+// bricks share vertices exactly and the resulting mesh is watertight.
+static
+fv_surface_mesh<double, uint64_t>
+Marching_Cubes_Narrow_Band(
+        const narrow_band_lattice &lat,
+        double inclusion_threshold, // The voxel value threshold demarcating surface 'interior' and 'exterior.'
+        bool below_is_interior ){   // Controls how the inclusion_threshold is interpretted.
+
+    using idx3 = std::array<int64_t, 3>;
+    const auto L = narrow_band_brick_width;
+    const int64_t N0 = lat.N[0];
+    const int64_t N1 = lat.N[1];
+    const int64_t N2 = lat.N[2];
+    if( (N0 < 2) || (N1 < 2) || (N2 < 2) ){
+        throw std::invalid_argument("Lattice is too small to contain any cells. Cannot continue.");
+    }
 
-                    // Remove the half-edges that we matched.
-                    // We assume no other faces will match (assuming manifold mesh).
-                    if(AB_found) expected_half_edges.erase({ A, B });
-                    if(BC_found) expected_half_edges.erase({ B, C });
-                    if(CA_found) expected_half_edges.erase({ C, A });
-                }
+    // Tolerance for deciding if a vertex coincides with a lattice node. Coincident vertices are merged, which avoids
+    // creating zero-area faces.
+    constexpr auto machine_eps = std::numeric_limits<double>::epsilon();
+    const auto dvec3_tol = std::max<double>(
+                               std::min<double>( { lat.axes[0].length(), lat.axes[1].length(), lat.axes[2].length() } ) * 1E-4,
+                               std::sqrt(machine_eps) * 100.0 );
 
-                // If the queue is empty, but there are still faces that need to be re-oriented, then there are multiple
-                // disconnected meshes. Start again using one of the faces as a new prototype.
-                ++connected_component;
+    const auto is_interior = [&](double v) -> bool {
+        return (below_is_interior) ? (v <= inclusion_threshold) : (inclusion_threshold <= v);
+    };
 
-                // Search for the next unknown face.
-                p_it = std::find(p_it, rf_end, orientation_t::unknown );
+    // Find the bricks that could contain the surface.
+    std::vector<std::pair<idx3, idx3>> leaves; // Cell ranges [lo, hi).
+    std::function<void(const idx3 &, const idx3 &)> descend = [&](const idx3 &lo, const idx3 &hi) -> void {
+        const auto b = lat.bound(lo, hi);
+        if( (b.hi < inclusion_threshold) || (inclusion_threshold < b.lo) ) return;
+
+        // Split long axes at a multiple of the brick width so that leaves align with a regular grid of bricks.
+        std::array<int64_t, 3> mid;
+        bool is_leaf = true;
+        for(size_t a = 0; a < 3; ++a){
+            const auto ext = hi[a] - lo[a];
+            mid[a] = hi[a];
+            if(L < ext){
+                mid[a] = lo[a] + (((ext / 2) + L - 1) / L) * L;
+                is_leaf = false;
             }
-
-            // Normals should (barring non-orientability) be consistent. But we still need to decide if they correctly
-            // point outward. We can use signed volume to evaluate this.
-            for(size_t i = 0; i < N_faces; ++i){
-                const auto pos_orien = (0.0 <= component_signed_volume[face_component[i]].Current_Sum());
-                if(!pos_orien) std::swap( fv_mesh.faces[i][0], fv_mesh.faces[i][1] );
+        }
+        if(is_leaf){
+            leaves.emplace_back(lo, hi);
+            return;
+        }
+        for(int32_t octant = 0; octant < 8; ++octant){
+            idx3 l_lo;
+            idx3 l_hi;
+            bool empty = false;
+            for(size_t a = 0; a < 3; ++a){
+                const bool upper = ((octant >> a) & 1) != 0;
+                l_lo[a] = upper ? mid[a] : lo[a];
+                l_hi[a] = upper ? hi[a] : mid[a];
+                empty = empty || (l_hi[a] <= l_lo[a]);
             }
+            if(!empty) descend(l_lo, l_hi);
         }
-        YLOGINFO("Finished re-orienting mesh with " << connected_component << " connected components");
-        return true;
     };
-    if(!reorient_faces(fv_mesh)){
+    descend({{ 0, 0, 0 }}, {{ N0 - 1, N1 - 1, N2 - 1 }});
+
+    const auto bricks_along = [&](int64_t N) -> int64_t { return (N - 1 + L - 1) / L; };
+    YLOGINFO("Meshing " << leaves.size() << " of " << (bricks_along(N0) * bricks_along(N1) * bricks_along(N2))
+             << " bricks which could contain the surface");
+
+    // Mesh each brick independently.
+    //
+    // Corners are ordered as in the Marching Cubes lookup tables. Offsets are along (axis 0, axis 1, axis 2).
+    const std::array<idx3, 8> corner_offsets { {
+        {{ 0, 0, 0 }}, {{ 1, 0, 0 }}, {{ 1, 1, 0 }}, {{ 0, 1, 0 }},
+        {{ 0, 0, 1 }}, {{ 1, 0, 1 }}, {{ 1, 1, 1 }}, {{ 0, 1, 1 }}
+    } };
+    const auto node_key = [&](const idx3 &n) -> int64_t {
+        return (n[0] * N1 + n[1]) * N2 + n[2];
+    };
+    struct brick_mesh_t {
+        std::vector<int64_t> keys; // Vertex keys, i.e., the lattice edge or node the vertex lies on.
+        std::vector<vec3<double>> verts;
+        std::vector<std::array<int64_t, 3>> faces; // Specified using vertex keys.
+    };
+    std::vector<brick_mesh_t> brick_meshes(leaves.size());
+    {
+        work_queue<std::function<void(void)>> wq;
+        for(size_t l = 0; l < leaves.size(); ++l){
+            wq.submit_task([&, l]() -> void {
+                const auto &lo = leaves[l].first;
+                const auto &hi = leaves[l].second;
+                auto &bm = brick_meshes[l];
+
+                std::vector<double> vals;
+                lat.sample(lo, hi, vals);
+                const int64_t n1 = hi[1] - lo[1] + 1;
+                const int64_t n2 = hi[2] - lo[2] + 1;
+                const auto value = [&](const idx3 &n) -> double {
+                    return vals[((n[0] - lo[0]) * n1 + (n[1] - lo[1])) * n2 + (n[2] - lo[2])];
+                };
+
+                std::set<int64_t> emitted;
+                for(int64_t i = lo[0]; i < hi[0]; ++i){
+                    for(int64_t j = lo[1]; j < hi[1]; ++j){
+                        for(int64_t k = lo[2]; k < hi[2]; ++k){
+                            std::array<idx3, 8> corners;
+                            int32_t iFlagIndex = 0;
+                            for(int32_t corner = 0; corner < 8; ++corner){
+                                corners[corner] = {{ i + corner_offsets[corner][0],
+                                                     j + corner_offsets[corner][1],
+                                                     k + corner_offsets[corner][2] }};
+                                if(is_interior(value(corners[corner]))) iFlagIndex |= (1 << corner);
+                            }
+
+                            const int32_t iEdgeFlags = aiCubeEdgeFlags[iFlagIndex];
+                            if(iEdgeFlags == 0) continue;
+
+                            std::array<int64_t, 12> edge_keys;
+                            for(int32_t edge = 0; edge < 12; ++edge){
+                                if(!(iEdgeFlags & (1 << edge))) continue;
+
+                                // Always interpolate from the lower node so that neighbouring cells (and bricks)
+                                // produce identical vertices.
+                                auto A = corners[a2iEdgeConnection[edge][0]];
+                                auto B = corners[a2iEdgeConnection[edge][1]];
+                                if(B < A) std::swap(A, B);
+                                const int64_t axis = (A[0] != B[0]) ? 0 : ( (A[1] != B[1]) ? 1 : 2 );
+
+                                const double value_A = value(A);
+                                const double value_B = value(B);
+                                const double lin_interp = (inclusion_threshold - value_A) / (value_B - value_A);
+                                const double surf_dl = std::isfinite(lin_interp) ? std::clamp(lin_interp, 0.0, 1.0)
+                                                                                 : static_cast<double>(0.5);
+                                const auto pos_A = lat.position(A[0], A[1], A[2]);
+                                const auto pos_B = lat.position(B[0], B[1], B[2]);
+                                const auto edge_length = pos_A.distance(pos_B);
+
+                                int64_t key;
+                                vec3<double> v;
+                                if(surf_dl * edge_length < dvec3_tol){
+                                    key = node_key(A) * 4 + 3;
+                                    v = pos_A;
+                                }else if((1.0 - surf_dl) * edge_length < dvec3_tol){
+                                    key = node_key(B) * 4 + 3;
+                                    v = pos_B;
+                                }else{
+                                    key = node_key(A) * 4 + axis;
+                                    v = pos_A + (pos_B - pos_A) * surf_dl;
+                                }
+                                edge_keys[edge] = key;
+                                if(emitted.insert(key).second){
+                                    bm.keys.emplace_back(key);
+                                    bm.verts.emplace_back(v);
+                                }
+                            }
+
+                            for(int32_t tri = 0; tri < 5; tri++){
+                                if(a2iTriangleConnectionTable[iFlagIndex][3*tri] < 0) break;
+                                const auto k0 = edge_keys[ a2iTriangleConnectionTable[iFlagIndex][3*tri + 0] ];
+                                const auto k1 = edge_keys[ a2iTriangleConnectionTable[iFlagIndex][3*tri + 1] ];
+                                const auto k2 = edge_keys[ a2iTriangleConnectionTable[iFlagIndex][3*tri + 2] ];
+
+                                // Faces collapsed by merging coincident vertices are degenerate and can be omitted.
+                                if( (k0 == k1) || (k0 == k2) || (k1 == k2) ) continue;
+                                bm.faces.push_back({{ k0, k1, k2 }});
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    YLOGINFO("Joining mesh partitions..");
+    fv_surface_mesh<double, uint64_t> fv_mesh;
+    std::unordered_map<int64_t, uint64_t> key_to_index;
+    for(const auto &bm : brick_meshes){
+        for(size_t i = 0; i < bm.keys.size(); ++i){
+            const auto ins = key_to_index.insert({ bm.keys[i], static_cast<uint64_t>(fv_mesh.vertices.size()) });
+            if(ins.second) fv_mesh.vertices.emplace_back(bm.verts[i]);
+        }
+        for(const auto &f : bm.faces){
+            fv_mesh.faces.push_back({ key_to_index.at(f[0]), key_to_index.at(f[1]), key_to_index.at(f[2]) });
+        }
+    }
+    brick_meshes.clear();
+
+    YLOGINFO("Orienting face normals..");
+    if(!Reorient_Faces(fv_mesh)){
         YLOGWARN("Unable to consistently re-orient mesh. This should never happen after marching cubes");
     }
 
@@ -1055,10 +1391,135 @@ Marching_Cubes_Implementation(
 
     YLOGINFO("The triangulated surface has " << fv_mesh.vertices.size() << " vertices"
              " and " << fv_mesh.faces.size() << " faces");
-  
     return fv_mesh;
 }
 
+// Narrow-band Marching Cubes for an image volume.
+//
+// Image voxel centres are used as lattice nodes, and the lattice is padded by one node on every side with an exterior
+// value so that surfaces touching the edge of the volume are closed. Bounds are derived from the minimum and maximum
+// voxel values within each brick.
+static
+fv_surface_mesh<double, uint64_t>
+Marching_Cubes_Narrow_Band_Images(
+        const std::list<std::reference_wrapper<planar_image<float,double>>> &grid_imgs,
+        double inclusion_threshold,
+        bool below_is_interior ){
+
+    const double ExteriorVal = inclusion_threshold + (below_is_interior ? 1.0 : -1.0);
+
+    const auto GridZ = grid_imgs.front().get().image_plane().N_0;
+    planar_image_adjacency<float,double> img_adj( grid_imgs, {}, GridZ );
+    const auto [img_num_min, img_num_max] = img_adj.get_min_max_indices();
+    std::vector<std::reference_wrapper<planar_image<float,double>>> imgs;
+    for(int64_t i = img_num_min; i <= img_num_max; ++i){
+        imgs.emplace_back( img_adj.index_to_image(i) );
+    }
+
+    const auto &img_0 = imgs.front().get();
+    const auto N_rows = img_0.rows;
+    const auto N_cols = img_0.columns;
+    const auto N_imgs = static_cast<int64_t>(imgs.size());
+    for(const auto &img_refw : imgs){
+        if( (N_rows != img_refw.get().rows)
+        ||  (N_cols != img_refw.get().columns) ){
+            throw std::invalid_argument("Regular grids are required for this algorithm -- images must all have the same number of rows and columns");
+        }
+    }
+
+    narrow_band_lattice lat;
+    lat.axes[0] = img_0.row_unit.unit() * img_0.pxl_dx;
+    lat.axes[1] = img_0.col_unit.unit() * img_0.pxl_dy;
+    lat.axes[2] = img_0.ortho_unit() * img_0.pxl_dz;
+    lat.origin = img_0.position(0, 0) - lat.axes[0] - lat.axes[1] - lat.axes[2];
+    lat.N = {{ N_rows + 2, N_cols + 2, N_imgs + 2 }};
+
+    // Use each image's own position, like the dense implementation, so irregular slice spacing is honoured.
+    // The padding slices are placed one neighbouring slice spacing beyond the first and last images.
+    for(const auto &img_refw : imgs){
+        lat.slice_origins.emplace_back( img_refw.get().position(0, 0) - lat.axes[0] - lat.axes[1] );
+    }
+    {
+        const auto dz_front = (1 < N_imgs) ? (lat.slice_origins[1] - lat.slice_origins[0]) : lat.axes[2];
+        const auto dz_back  = (1 < N_imgs) ? (lat.slice_origins[N_imgs - 1] - lat.slice_origins[N_imgs - 2]) : lat.axes[2];
+        const auto front = lat.slice_origins.front() - dz_front;
+        const auto back  = lat.slice_origins.back() + dz_back;
+        lat.slice_origins.insert( std::begin(lat.slice_origins), front );
+        lat.slice_origins.emplace_back( back );
+    }
+
+    lat.sample = [&](const std::array<int64_t, 3> &lo,
+                     const std::array<int64_t, 3> &hi,
+                     std::vector<double> &out) -> void {
+        out.clear();
+        out.reserve((hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1));
+        for(int64_t i = lo[0]; i <= hi[0]; ++i){
+            for(int64_t j = lo[1]; j <= hi[1]; ++j){
+                for(int64_t k = lo[2]; k <= hi[2]; ++k){
+                    const bool in_volume = (0 < i) && (i <= N_rows)
+                                        && (0 < j) && (j <= N_cols)
+                                        && (0 < k) && (k <= N_imgs);
+                    out.emplace_back( in_volume ? imgs[k - 1].get().value(i - 1, j - 1, 0) : ExteriorVal );
+                }
+            }
+        }
+    };
+
+    // Pre-compute bounds for every brick. Larger regions are bounded by combining bricks.
+    const auto L = narrow_band_brick_width;
+    std::array<int64_t, 3> N_bricks;
+    for(size_t a = 0; a < 3; ++a) N_bricks[a] = (lat.N[a] - 1 + L - 1) / L;
+    std::vector<csg::sdf::interval> brick_bounds(N_bricks[0] * N_bricks[1] * N_bricks[2]);
+    const auto brick_index = [&](int64_t b0, int64_t b1, int64_t b2) -> int64_t {
+        return (b0 * N_bricks[1] + b1) * N_bricks[2] + b2;
+    };
+    {
+        work_queue<std::function<void(void)>> wq;
+        for(int64_t b0 = 0; b0 < N_bricks[0]; ++b0){
+            wq.submit_task([&, b0]() -> void {
+                std::vector<double> vals;
+                for(int64_t b1 = 0; b1 < N_bricks[1]; ++b1){
+                    for(int64_t b2 = 0; b2 < N_bricks[2]; ++b2){
+                        const std::array<int64_t, 3> lo = {{ b0 * L, b1 * L, b2 * L }};
+                        const std::array<int64_t, 3> hi = {{ std::min<int64_t>(lo[0] + L, lat.N[0] - 1),
+                                                             std::min<int64_t>(lo[1] + L, lat.N[1] - 1),
+                                                             std::min<int64_t>(lo[2] + L, lat.N[2] - 1) }};
+                        lat.sample(lo, hi, vals);
+                        csg::sdf::interval b = { std::numeric_limits<double>::infinity(),
+                                                 -std::numeric_limits<double>::infinity() };
+                        for(const auto &v : vals){
+                            if(!std::isfinite(v)){
+                                // Non-finite voxels can not be bounded.
+                                b = { -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity() };
+                                break;
+                            }
+                            b.lo = std::min(b.lo, v);
+                            b.hi = std::max(b.hi, v);
+                        }
+                        brick_bounds[brick_index(b0, b1, b2)] = b;
+                    }
+                }
+            });
+        }
+    }
+    lat.bound = [&](const std::array<int64_t, 3> &lo,
+                    const std::array<int64_t, 3> &hi) -> csg::sdf::interval {
+        csg::sdf::interval b = { std::numeric_limits<double>::infinity(),
+                                 -std::numeric_limits<double>::infinity() };
+        for(int64_t b0 = lo[0] / L; b0 <= (hi[0] - 1) / L; ++b0){
+            for(int64_t b1 = lo[1] / L; b1 <= (hi[1] - 1) / L; ++b1){
+                for(int64_t b2 = lo[2] / L; b2 <= (hi[2] - 1) / L; ++b2){
+                    const auto &l_b = brick_bounds[brick_index(b0, b1, b2)];
+                    b.lo = std::min(b.lo, l_b.lo);
+                    b.hi = std::max(b.hi, l_b.hi);
+                }
+            }
+        }
+        return b;
+    };
+
+    return Marching_Cubes_Narrow_Band(lat, inclusion_threshold, below_is_interior);
+}
 
 
 // This sub-routine performs the Marching Cubes algorithm for the given ROI contours.
@@ -1243,6 +1704,13 @@ Estimate_Surface_Mesh_Marching_Cubes(
         throw std::logic_error("Grid images do not form a rectilinear grid. Cannot continue");
     }
 
+    // The grid is padded with exterior voxels on all sides, so the narrow band produces the same surface.
+    if(params.NarrowBand){
+        return Marching_Cubes_Narrow_Band_Images( grid_imgs,
+                                                  inclusion_threshold,
+                                                  below_is_interior );
+    }
+
     // Offload the actual Marching Cubes computation.
     return Marching_Cubes_Implementation( grid_imgs,
                                           std::shared_ptr<csg::sdf::node>(),
@@ -1282,6 +1750,46 @@ Estimate_Surface_Mesh_Marching_Cubes(
     const double margin_y = min_res_y;
     const double margin_z = min_res_z;
 
+    // Only sample the SDF near the surface, avoiding a dense image volume altogether.
+    if(params.NarrowBand){
+        const csg::sdf::tape t(sdf);
+
+        narrow_band_lattice lat;
+        lat.axes[0] = vec3<double>(min_res_x, 0.0, 0.0);
+        lat.axes[1] = vec3<double>(0.0, min_res_y, 0.0);
+        lat.axes[2] = vec3<double>(0.0, 0.0, min_res_z);
+        lat.origin = bb.min - vec3<double>(margin_x, margin_y, margin_z);
+        lat.N = {{ static_cast<int64_t>(std::ceil((bb.max.x - bb.min.x)/min_res_x)) + 3,
+                   static_cast<int64_t>(std::ceil((bb.max.y - bb.min.y)/min_res_y)) + 3,
+                   static_cast<int64_t>(std::ceil((bb.max.z - bb.min.z)/min_res_z)) + 3 }};
+
+        lat.bound = [&](const std::array<int64_t, 3> &lo,
+                        const std::array<int64_t, 3> &hi) -> csg::sdf::interval {
+            const auto p_lo = lat.position(lo[0], lo[1], lo[2]);
+            const auto p_hi = lat.position(hi[0], hi[1], hi[2]);
+            return t.evaluate_interval( (p_lo + p_hi) * 0.5, (p_hi - p_lo).length() * 0.5 );
+        };
+        lat.sample = [&](const std::array<int64_t, 3> &lo,
+                         const std::array<int64_t, 3> &hi,
+                         std::vector<double> &out) -> void {
+            std::vector<double> xs, ys, zs;
+            for(int64_t i = lo[0]; i <= hi[0]; ++i){
+                for(int64_t j = lo[1]; j <= hi[1]; ++j){
+                    for(int64_t k = lo[2]; k <= hi[2]; ++k){
+                        const auto p = lat.position(i, j, k);
+                        xs.emplace_back(p.x);
+                        ys.emplace_back(p.y);
+                        zs.emplace_back(p.z);
+                    }
+                }
+            }
+            out.resize(xs.size());
+            csg::sdf::tape::workspace w;
+            t.evaluate(xs.data(), ys.data(), zs.data(), out.data(), static_cast<int64_t>(out.size()), w);
+        };
+        return Marching_Cubes_Narrow_Band(lat, inclusion_threshold, below_is_interior);
+    }
+
     const auto N_cols = static_cast<int64_t>(std::ceil((bb.max.x - bb.min.x)/min_res_x));
     const auto N_rows = static_cast<int64_t>(std::ceil((bb.max.y - bb.min.y)/min_res_y));
     const auto N_imgs = static_cast<int64_t>(std::ceil((bb.max.z - bb.min.z)/min_res_z));
@@ -1362,6 +1870,12 @@ Estimate_Surface_Mesh_Marching_Cubes(
         throw std::logic_error("Grid images do not form a rectilinear grid. Cannot continue");
     }
 
+    if(params.NarrowBand){
+        return Marching_Cubes_Narrow_Band_Images( grid_imgs,
+                                                  inclusion_threshold,
+                                                  below_is_interior );
+    }
+
     // Offload the actual Marching Cubes computation.
     return Marching_Cubes_Implementation( grid_imgs,
                                           std::shared_ptr<csg::sdf::node>(),
@@ -44,6 +44,14 @@ namespace dcma_surface_meshes {
         //   mesh should be nearly identical to the input contours. Note that meshes with high quality will generally have too
         //   many vertices to reasonably dilate or erode.
         ReproductionQuality RQ = ReproductionQuality::High;
+
+        // Restrict Marching Cubes to a narrow band around the surface, which is found by adaptively subdividing the
+        // volume. Time and memory then scale with the surface area rather than the volume. If false, every voxel is
+        // visited.
+        //
+        // Note that the image variant pads the volume with exterior voxels, so surfaces touching the edge of the
+        // images are closed, whereas the dense implementation leaves them open.
+        bool NarrowBand = false;
     };
 
     fv_surface_mesh<double, uint64_t>
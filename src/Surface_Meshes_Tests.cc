@@ -0,0 +1,209 @@
+//Surface_Meshes_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the surface meshing routines defined in Surface_Meshes.cc.
+// Tests are separated into their own file because Surface_Meshes_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "Surface_Meshes.h"
+
+
+// An image volume sampling the signed distance to a sphere. Slices are separated by 'slice_spacing', which need not
+// match the voxel thickness.
+static
+std::list<planar_image<float,double>>
+make_sphere_images(const vec3<double> &centre, double radius, int64_t N, double slice_spacing, double pxl_dz){
+    std::list<planar_image<float,double>> imgs;
+    for(int64_t k = 0; k < N; ++k){
+        imgs.emplace_back();
+        auto &img = imgs.back();
+        img.init_buffer(N, N, 1);
+        img.init_spatial(1.0, 1.0, pxl_dz, vec3<double>(0.0, 0.0, 0.0),
+                         vec3<double>(0.0, 0.0, static_cast<double>(k) * slice_spacing));
+        img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+        for(int64_t r = 0; r < N; ++r){
+            for(int64_t c = 0; c < N; ++c){
+                img.reference(r, c, 0) = static_cast<float>(img.position(r, c).distance(centre) - radius);
+            }
+        }
+    }
+    return imgs;
+}
+
+static
+std::list<std::reference_wrapper<planar_image<float,double>>>
+make_refs(std::list<planar_image<float,double>> &imgs){
+    std::list<std::reference_wrapper<planar_image<float,double>>> out;
+    for(auto &img : imgs) out.emplace_back( std::ref(img) );
+    return out;
+}
+
+// A closed, manifold triangle mesh has every edge shared by exactly two faces.
+static
+bool
+is_watertight(const fv_surface_mesh<double, uint64_t> &mesh){
+    std::map<std::pair<uint64_t, uint64_t>, int64_t> edge_counts;
+    for(const auto &f : mesh.faces){
+        for(size_t i = 0; i < f.size(); ++i){
+            auto a = f[i];
+            auto b = f[(i + 1) % f.size()];
+            if(b < a) std::swap(a, b);
+            ++edge_counts[{a, b}];
+        }
+    }
+    return !edge_counts.empty()
+        && std::all_of(std::begin(edge_counts), std::end(edge_counts),
+                       [](const auto &p){ return (p.second == 2); });
+}
+
+static
+double
+surface_area(const fv_surface_mesh<double, uint64_t> &mesh){
+    double area = 0.0;
+    for(const auto &f : mesh.faces){
+        const auto &A = mesh.vertices.at(f.at(0));
+        const auto &B = mesh.vertices.at(f.at(1));
+        const auto &C = mesh.vertices.at(f.at(2));
+        area += (B - A).Cross(C - A).length() * 0.5;
+    }
+    return area;
+}
+
+static
+double
+max_radial_error(const fv_surface_mesh<double, uint64_t> &mesh, const vec3<double> &centre, double radius){
+    double err = 0.0;
+    for(const auto &v : mesh.vertices){
+        err = std::max(err, std::abs(v.distance(centre) - radius));
+    }
+    return err;
+}
+
+
+TEST_CASE("narrow-band image meshing matches the dense implementation"){
+    const vec3<double> centre(10.0, 10.0, 10.0);
+    const double radius = 6.0;
+    auto imgs = make_sphere_images(centre, radius, 21, 1.0, 1.0);
+    const auto img_refs = make_refs(imgs);
+
+    dcma_surface_meshes::Parameters dense_params;
+    REQUIRE(!dense_params.NarrowBand); // The dense implementation is the default.
+    const auto dense = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(img_refs, 0.0, true, dense_params);
+
+    dcma_surface_meshes::Parameters nb_params;
+    nb_params.NarrowBand = true;
+    const auto nb = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(img_refs, 0.0, true, nb_params);
+
+    REQUIRE(0 < dense.faces.size());
+    REQUIRE(0 < nb.faces.size());
+    REQUIRE(is_watertight(nb));
+
+    // The sphere does not touch the edge of the volume, so both should sample the same surface.
+    const auto dense_area = surface_area(dense);
+    const auto nb_area = surface_area(nb);
+    REQUIRE(std::abs(nb_area - dense_area) < 0.02 * dense_area);
+    REQUIRE(max_radial_error(nb, centre, radius) < 0.5);
+    REQUIRE(max_radial_error(dense, centre, radius) < 0.5);
+}
+
+TEST_CASE("narrow-band image meshing closes surfaces touching the volume edge"){
+    // The sphere extends beyond the image volume, so the surface is clipped by the volume boundary.
+    const vec3<double> centre(0.0, 10.0, 10.0);
+    auto imgs = make_sphere_images(centre, 6.0, 21, 1.0, 1.0);
+    const auto img_refs = make_refs(imgs);
+
+    dcma_surface_meshes::Parameters nb_params;
+    nb_params.NarrowBand = true;
+    const auto nb = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(img_refs, 0.0, true, nb_params);
+    REQUIRE(is_watertight(nb));
+}
+
+TEST_CASE("narrow-band image meshing uses image positions when slice spacing differs from voxel thickness"){
+    const vec3<double> centre(10.0, 10.0, 20.0);
+    const double radius = 6.0;
+    auto imgs = make_sphere_images(centre, radius, 21, 2.0, 1.0);
+    const auto img_refs = make_refs(imgs);
+
+    dcma_surface_meshes::Parameters nb_params;
+    nb_params.NarrowBand = true;
+    const auto nb = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(img_refs, 0.0, true, nb_params);
+
+    REQUIRE(is_watertight(nb));
+    REQUIRE(max_radial_error(nb, centre, radius) < 1.0);
+
+    double z_min = std::numeric_limits<double>::infinity();
+    double z_max = -std::numeric_limits<double>::infinity();
+    for(const auto &v : nb.vertices){
+        z_min = std::min(z_min, v.z);
+        z_max = std::max(z_max, v.z);
+    }
+    REQUIRE(std::abs(z_min - (centre.z - radius)) < 1.0);
+    REQUIRE(std::abs(z_max - (centre.z + radius)) < 1.0);
+}
+
+TEST_CASE("narrow-band contour meshing matches the dense implementation"){
+    // A cylinder of stacked circular contours.
+    const vec3<double> centre(10.0, 10.0, 0.0);
+    const double radius = 5.0;
+    const int64_t N_verts = 24;
+    std::list<contour_collection<double>> ccs;
+    ccs.emplace_back();
+    for(int64_t k = 0; k < 9; ++k){
+        contour_of_points<double> c;
+        c.closed = true;
+        for(int64_t i = 0; i < N_verts; ++i){
+            const double t = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(N_verts);
+            c.points.emplace_back( centre + vec3<double>(radius * std::cos(t), radius * std::sin(t), static_cast<double>(k)) );
+        }
+        ccs.back().contours.emplace_back(c);
+    }
+    std::list<std::reference_wrapper<contour_collection<double>>> cc_refs;
+    for(auto &cc : ccs) cc_refs.emplace_back( std::ref(cc) );
+
+    dcma_surface_meshes::Parameters dense_params;
+    dense_params.GridRows = 32;
+    dense_params.GridColumns = 32;
+    dense_params.NarrowBand = false;
+    const auto dense = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(cc_refs, dense_params);
+
+    auto nb_params = dense_params;
+    nb_params.NarrowBand = true;
+    const auto nb = dcma_surface_meshes::Estimate_Surface_Mesh_Marching_Cubes(cc_refs, nb_params);
+
+    REQUIRE(0 < dense.faces.size());
+    REQUIRE(is_watertight(dense));
+    REQUIRE(is_watertight(nb));
+
+    // The rasterized grid is padded with exterior voxels, so both implementations extract the same surface.
+    const auto dense_area = surface_area(dense);
+    const auto nb_area = surface_area(nb);
+    REQUIRE(std::abs(nb_area - dense_area) < 0.01 * dense_area);
+
+    const auto z_extent = [](const fv_surface_mesh<double, uint64_t> &mesh){
+        double z_min = std::numeric_limits<double>::infinity();
+        double z_max = -std::numeric_limits<double>::infinity();
+        for(const auto &v : mesh.vertices){
+            z_min = std::min(z_min, v.z);
+            z_max = std::max(z_max, v.z);
+        }
+        return std::make_pair(z_min, z_max);
+    };
+    const auto [dense_z_min, dense_z_max] = z_extent(dense);
+    const auto [nb_z_min, nb_z_max] = z_extent(nb);
+    REQUIRE(std::abs(nb_z_min - dense_z_min) < 1.0E-3);
+    REQUIRE(std::abs(nb_z_max - dense_z_max) < 1.0E-3);
+}
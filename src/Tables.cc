@@ -1,4 +1,8 @@
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
 #include <set>
 #include <list>
 #include <string>
@@ -10,6 +14,10 @@
 #include <ostream>
 #include <iomanip>
 #include <cstdint>
+#include <system_error>
+#include <tuple>
+#include <variant>
+#include <vector>
 
 #include "YgorString.h"
 #include "YgorMisc.h"
@@ -109,6 +117,91 @@ specifiers_t specifiers_intersection(const specifiers_t &a,
     return c;
 }
 
+// Typed cell values.
+
+cell_value_t to_cell_value(const std::string &s){
+    const auto beg = s.data();
+    const auto end = s.data() + s.size();
+    std::array<char, 64> buf;
+
+    // Integers.
+    {
+        int64_t x = 0;
+        const auto [ptr, ec] = std::from_chars(beg, end, x);
+        if( (ec == std::errc()) && (ptr == end) ){
+            const auto [b_end, b_ec] = std::to_chars(buf.data(), buf.data() + buf.size(), x);
+            if( (b_ec == std::errc())
+            &&  (s.compare(0, std::string::npos, buf.data(), b_end - buf.data()) == 0) ){
+                return x;
+            }
+        }
+    }
+
+    // Reals.
+#if defined(__cpp_lib_to_chars)
+    if( !s.empty()
+    &&  (std::isdigit(static_cast<unsigned char>(s.back())) != 0) ){ // Avoid 'nan' and 'inf'.
+        double x = 0.0;
+        const auto [ptr, ec] = std::from_chars(beg, end, x);
+        if( (ec == std::errc()) && (ptr == end) ){
+            const auto [b_end, b_ec] = std::to_chars(buf.data(), buf.data() + buf.size(), x);
+            if( (b_ec == std::errc())
+            &&  (s.compare(0, std::string::npos, buf.data(), b_end - buf.data()) == 0) ){
+                return x;
+            }
+        }
+    }
+#endif // defined(__cpp_lib_to_chars)
+
+    return s;
+}
+
+std::string to_string(const cell_value_t &v){
+    if(const auto *s = std::get_if<std::string>(&v)) return *s;
+
+    std::array<char, 64> buf;
+    std::to_chars_result res;
+    if(const auto *i = std::get_if<int64_t>(&v)){
+        res = std::to_chars(buf.data(), buf.data() + buf.size(), *i);
+    }else{
+#if defined(__cpp_lib_to_chars)
+        res = std::to_chars(buf.data(), buf.data() + buf.size(), std::get<double>(v));
+#else
+        throw std::logic_error("Real cells are not supported on this platform");
+#endif // defined(__cpp_lib_to_chars)
+    }
+    if(res.ec != std::errc()){
+        throw std::runtime_error("Unable to convert cell to string");
+    }
+    return std::string(buf.data(), res.ptr);
+}
+
+static
+std::optional<double>
+cell_as_real(const cell_value_t &v){
+    if(const auto *i = std::get_if<int64_t>(&v)) return static_cast<double>(*i);
+    if(const auto *x = std::get_if<double>(&v)) return *x;
+
+    // Text cells that could not be stored as numbers, e.g., '1.50' or ' 2'.
+    const auto &s = std::get<std::string>(v);
+    try{
+        size_t pos = 0;
+        const auto x = std::stod(s, &pos);
+        if(s.find_first_not_of(" \t", pos) == std::string::npos) return x;
+    }catch(const std::exception &){}
+    return {};
+}
+
+// column class.
+
+std::optional<size_t>
+column::find(int64_t row) const {
+    const auto end = std::end(this->rows);
+    const auto it = std::lower_bound(std::begin(this->rows), end, row);
+    if( (it == end) || (*it != row) ) return {};
+    return static_cast<size_t>(std::distance(std::begin(this->rows), it));
+}
+
 // table2 class.
 
 table2::table2(){};
@@ -117,11 +210,10 @@ cell_coord_t
 table2::min_max_row() const {
     int64_t min = std::numeric_limits<int64_t>::max();
     int64_t max = std::numeric_limits<int64_t>::lowest();
-    if(const auto it = std::rbegin(this->data); it != std::rend(this->data)){
-        max = it->get_row();
-    }
-    if(const auto it = std::begin(this->data); it != std::end(this->data)){
-        min = it->get_row();
+    for(const auto& [c, col] : this->columns){
+        if(col.rows.empty()) continue;
+        min = std::min<int64_t>(min, col.rows.front());
+        max = std::max<int64_t>(max, col.rows.back());
     }
     if(max < min){
         throw std::runtime_error("No data available, min and max rows are not defined");
@@ -131,25 +223,17 @@ table2::min_max_row() const {
 
 cell_coord_t
 table2::min_max_col() const {
-    int64_t min = std::numeric_limits<int64_t>::max();
-    int64_t max = std::numeric_limits<int64_t>::lowest();
-
-    for(const auto& c : this->data){
-        const auto col = c.get_col();
-        max = std::max<int64_t>(max, col);
-        min = std::min<int64_t>(min, col);
-    }
-    if(max < min){
+    if(this->columns.empty()){
         throw std::runtime_error("No data available, min and max columns are not defined");
     }
-    return {min, max};
+    return { std::begin(this->columns)->first, std::rbegin(this->columns)->first };
 }
 
 cell_coord_t
 table2::standard_min_max_row() const {
     const int64_t zero = 0;
     const int64_t ten = 10;
-    if(this->data.empty()){
+    if(this->empty()){
         return { zero, ten };
     }
     auto [min_row, max_row] = this->min_max_row();
@@ -160,19 +244,33 @@ cell_coord_t
 table2::standard_min_max_col() const {
     const int64_t zero = 0;
     const int64_t five = 5;
-    if(this->data.empty()){
+    if(this->empty()){
         return { zero, five };
     }
     auto [min_col, max_col] = this->min_max_col();
     return { std::min<int64_t>( zero, min_col ), std::max<int64_t>( five, max_col + 2 ) };
 }
 
+size_t
+table2::size() const {
+    size_t out = 0;
+    for(const auto& [c, col] : this->columns) out += col.rows.size();
+    return out;
+}
+
+bool
+table2::empty() const {
+    return this->columns.empty();
+}
+
 std::optional<std::string>
 table2::value(int64_t row, int64_t col) const {
     std::optional<std::string> out;
-    auto it = this->data.find( cell<std::string>(row, col, "") );
-    if(it != std::end(this->data)){
-        out = it->val;
+    const auto c_it = this->columns.find(col);
+    if(c_it != std::end(this->columns)){
+        if(const auto i = c_it->second.find(row)){
+            out = to_string(c_it->second.vals[i.value()]);
+        }
     }
     return out;
 }
@@ -180,21 +278,128 @@ table2::value(int64_t row, int64_t col) const {
 std::optional<std::reference_wrapper<std::string>>
 table2::value_ref(int64_t row, int64_t col){
     std::optional<std::reference_wrapper<std::string>> out;
-    auto it = this->data.find( cell<std::string>(row, col, "") );
-    if(it != std::end(this->data)){
-        // NOTE: std::set does not care about the cell's content, but doesn't know this.
-        // So we have to cast away the const on the value. Do NOT cast away the const
-        // on the row or column numbers!
-        out = std::ref(const_cast<std::string&>(it->val));
+    auto c_it = this->columns.find(col);
+    if(c_it != std::end(this->columns)){
+        if(const auto i = c_it->second.find(row)){
+            auto &v = c_it->second.vals[i.value()];
+            if(!std::holds_alternative<std::string>(v)){
+                v = to_string(v);
+            }
+            out = std::ref(std::get<std::string>(v));
+        }
     }
     return out;
 }
 
+std::optional<double>
+table2::value_as_real(int64_t row, int64_t col) const {
+    const auto c_it = this->columns.find(col);
+    if(c_it != std::end(this->columns)){
+        if(const auto i = c_it->second.find(row)){
+            return cell_as_real(c_it->second.vals[i.value()]);
+        }
+    }
+    return {};
+}
+
+std::optional<int64_t>
+table2::value_as_integer(int64_t row, int64_t col) const {
+    const auto c_it = this->columns.find(col);
+    if(c_it != std::end(this->columns)){
+        if(const auto i = c_it->second.find(row)){
+            const auto &v = c_it->second.vals[i.value()];
+            if(const auto *x = std::get_if<int64_t>(&v)) return *x;
+            if(const auto *s = std::get_if<std::string>(&v)){
+                try{
+                    size_t pos = 0;
+                    const auto x = std::stoll(*s, &pos);
+                    if(s->find_first_not_of(" \t", pos) == std::string::npos) return static_cast<int64_t>(x);
+                }catch(const std::exception &){}
+            }
+        }
+    }
+    return {};
+}
+
+std::vector<std::optional<double>>
+table2::column_as_reals(int64_t col, cell_coord_t row_bounds) const {
+    const auto [row_min, row_max] = row_bounds;
+    std::vector<std::optional<double>> out;
+    if(row_max < row_min) return out;
+    out.resize(static_cast<size_t>(row_max - row_min + 1));
+
+    const auto c_it = this->columns.find(col);
+    if(c_it == std::end(this->columns)) return out;
+    const auto &l_col = c_it->second;
+
+    const auto beg = std::lower_bound(std::begin(l_col.rows), std::end(l_col.rows), row_min);
+    for(auto it = beg; (it != std::end(l_col.rows)) && (*it <= row_max); ++it){
+        const auto i = std::distance(std::begin(l_col.rows), it);
+        out[static_cast<size_t>(*it - row_min)] = cell_as_real(l_col.vals[i]);
+    }
+    return out;
+}
+
+cell_type
+table2::column_type(int64_t col, std::optional<cell_coord_t> row_bounds) const {
+    const auto c_it = this->columns.find(col);
+    if(c_it == std::end(this->columns)) return cell_type::text;
+    const auto &l_col = c_it->second;
+
+    bool any = false;
+    auto out = cell_type::integer;
+    for(size_t i = 0; i < l_col.rows.size(); ++i){
+        if( row_bounds
+        &&  ( (l_col.rows[i] < row_bounds.value().first)
+           || (row_bounds.value().second < l_col.rows[i]) ) ) continue;
+        any = true;
+
+        const auto &v = l_col.vals[i];
+        if(std::holds_alternative<std::string>(v)) return cell_type::text;
+        if(std::holds_alternative<double>(v)) out = cell_type::real;
+    }
+    return any ? out : cell_type::text;
+}
+
+void
+table2::visit_cells(const std::function<void(int64_t r, int64_t c, const cell_value_t &v)> &f) const {
+    if(!f){
+        throw std::invalid_argument("Invalid user functor");
+    }
+
+    // Merge the columns into row-major order.
+    using cursor_t = std::tuple<int64_t, int64_t, const column*, size_t>; // row, col, column, index.
+    std::vector<cursor_t> cursors;
+    cursors.reserve(this->columns.size());
+    for(const auto& [c, col] : this->columns){
+        if(!col.rows.empty()) cursors.emplace_back(col.rows.front(), c, &col, 0);
+    }
+    const auto gt = [](const cursor_t &A, const cursor_t &B){
+        return std::make_pair(std::get<0>(A), std::get<1>(A)) > std::make_pair(std::get<0>(B), std::get<1>(B));
+    };
+    std::make_heap(std::begin(cursors), std::end(cursors), gt);
+
+    while(!cursors.empty()){
+        std::pop_heap(std::begin(cursors), std::end(cursors), gt);
+        auto &[r, c, col, i] = cursors.back();
+        f(r, c, col->vals[i]);
+
+        ++i;
+        if(i < col->rows.size()){
+            r = col->rows[i];
+            std::push_heap(std::begin(cursors), std::end(cursors), gt);
+        }else{
+            cursors.pop_back();
+        }
+    }
+    return;
+}
+
 int64_t
 table2::next_empty_row() const {
     int64_t out = 0;
-    if(const auto it = std::rbegin(this->data); it != std::rend(this->data)){
-        out = it->get_row() + 1;
+    if(!this->empty()){
+        out = this->min_max_row().second + 1;
     }
     return out;
 }
@@ -202,8 +407,8 @@ table2::next_empty_row() const {
 int64_t
 table2::next_empty_col() const {
     int64_t out = 0;
-    for(const auto& c : this->data){
-        out = std::max<int64_t>(out, c.get_col() + 1);
+    if(!this->empty()){
+        out = std::max<int64_t>(out, std::rbegin(this->columns)->first + 1);
     }
     return out;
 }
@@ -211,7 +416,6 @@ table2::next_empty_col() const {
 cell_coord_t
 table2::jump_navigate(cell_coord_t current_pos,
                       cell_coord_t direction) const {
-
     const auto [dir_row, dir_col] = direction;
     const bool inc_row = (0L < dir_row);
     const bool dec_row = (dir_row < 0L);
@@ -274,20 +478,41 @@ table2::jump_navigate(cell_coord_t current_pos,
 
 void
 table2::inject(int64_t row, int64_t col, const std::string& val){
-    cell<std::string> n(row, col, val);
-    auto it = this->data.find( n );
-    if(it != std::end(this->data)){
-        (const_cast<cell<std::string>&>(*it)).val = val;
+    auto &l_col = this->columns[col];
+
+    // Appending rows is the most common case.
+    if( l_col.rows.empty()
+    ||  (l_col.rows.back() < row) ){
+        l_col.rows.push_back(row);
+        l_col.vals.push_back(to_cell_value(val));
+        return;
+    }
+
+    const auto it = std::lower_bound(std::begin(l_col.rows), std::end(l_col.rows), row);
+    const auto i = std::distance(std::begin(l_col.rows), it);
+    if( (it != std::end(l_col.rows)) && (*it == row) ){
+        l_col.vals[i] = to_cell_value(val);
     }else{
-        this->data.insert( n );
+        l_col.rows.insert(it, row);
+        l_col.vals.insert(std::next(std::begin(l_col.vals), i), to_cell_value(val));
     }
     return;
 }
 
 void
 table2::remove(int64_t row, int64_t col){
-    cell<std::string> n(row, col, "");
-    this->data.erase(n);
+    auto c_it = this->columns.find(col);
+    if(c_it == std::end(this->columns)) return;
+    auto &l_col = c_it->second;
+
+    if(const auto i = l_col.find(row)){
+        l_col.rows.erase(std::next(std::begin(l_col.rows), i.value()));
+        l_col.vals.erase(std::next(std::begin(l_col.vals), i.value()));
+    }
+    if(l_col.rows.empty()){
+        this->columns.erase(c_it);
+    }
+    return;
 }
 
 void
@@ -299,34 +524,30 @@ table2::visit_block( cell_coord_t row_bounds,
     }
     for(int64_t row = row_bounds.first; row <= row_bounds.second; ++row){
         for(int64_t col = col_bounds.first; col <= col_bounds.second; ++col){
-            cell<std::string> shtl(row, col, "");
-            cell<std::string>* cell_ptr = &shtl;
-            
-            auto it = this->data.find( shtl );
-            const bool cell_already_present = (it != std::end(this->data));
-            if(cell_already_present){
-                cell_ptr = &(const_cast<cell<std::string>&>(*it));
-            }
+            const auto orig = this->value(row, col);
+            const bool cell_already_present = !!orig;
+            std::string val = orig.value_or("");
 
-            const auto res = f(row, col, cell_ptr->val);
+            const auto res = f(row, col, val);
 
             if(cell_already_present){
                 if(false){
                 }else if(res == action::remove){
-                    this->data.erase(it);
-                }else if(res == action::automatic){
-                    if(cell_ptr->val.empty()){
-                        this->data.erase(it);
-                    }
+                    this->remove(row, col);
+                }else if( (res == action::automatic)
+                      &&  val.empty() ){
+                    this->remove(row, col);
+                }else if(val != orig.value()){
+                    this->inject(row, col, val);
                 }
 
             }else{
                 if(false){
                 }else if(res == action::add){
-                    this->data.insert(*cell_ptr);
+                    this->inject(row, col, val);
                 }else if(res == action::automatic){
-                    if(!(cell_ptr->val.empty())){
-                        this->data.insert(*cell_ptr);
+                    if(!(val.empty())){
+                        this->inject(row, col, val);
                     }
                 }
             }
@@ -352,14 +573,14 @@ table2::get_empty_rows( std::optional<cell_coord_t> mmr_opt,
     if(!mmc_opt) mmc_opt = this->min_max_col();
 
     specifiers_t nonempty_rows;
-    for(const auto &cell : this->data){
-        const auto r = cell.get_row();
-        const auto c = cell.get_row();
-        if( (mmr_opt.value().first <= r)
-        &&  (r <= mmr_opt.value().second)
-        &&  (mmc_opt.value().first <= c)
-        &&  (c <= mmc_opt.value().second) ){
-            nonempty_rows.insert(r);
+    for(const auto& [c, col] : this->columns){
+        if( (c < mmc_opt.value().first)
+        ||  (mmc_opt.value().second < c) ) continue;
+        for(const auto &r : col.rows){
+            if( (mmr_opt.value().first <= r)
+            &&  (r <= mmr_opt.value().second) ){
+                nonempty_rows.insert(r);
+            }
         }
     };
 
@@ -377,49 +598,41 @@ table2::get_empty_rows( std::optional<cell_coord_t> mmr_opt,
 void
 table2::delete_rows( specifiers_t rows_to_delete ){
     if(rows_to_delete.empty()) return;
+    if(this->empty()) return;
 
     const auto mmr = this->min_max_row();
-    const auto mmc = this->min_max_col();
-
-    // Ensure the cells of all deleted row are completely empty.
-    for(const auto &r : rows_to_delete){
-        for(auto c = mmc.first; c <= mmc.second; ++c){
-            this->remove(r, c);
-        }
-    }
 
-    // Get a list of rows that need to be shifted.
-    std::map<int64_t, int64_t> row_map; // row number NEW --> row number OLD.
-    int64_t offset_row = mmr.first;
-    for(auto r = mmr.first; r <= mmr.second; ++r){
-        const auto is_being_removed = (rows_to_delete.count(r) != 0);
-        if(!is_being_removed){
-            if(offset_row != r){
-                row_map[offset_row] = r;
-            }
-            ++offset_row;
+    // Only rows within the table can cause other rows to shift.
+    const std::vector<int64_t> deleted( rows_to_delete.lower_bound(mmr.first),
+                                        rows_to_delete.upper_bound(mmr.second) );
+
+    for(auto c_it = std::begin(this->columns); c_it != std::end(this->columns); ){
+        auto &l_col = c_it->second;
+        size_t n = 0;
+        for(size_t i = 0; i < l_col.rows.size(); ++i){
+            const auto r = l_col.rows[i];
+            if(rows_to_delete.count(r) != 0) continue;
+
+            // Shift the cell upward by the number of deleted rows that precede it.
+            const auto shift = std::distance( std::begin(deleted),
+                                              std::lower_bound(std::begin(deleted), std::end(deleted), r) );
+            l_col.rows[n] = r - shift;
+            if(n != i) l_col.vals[n] = std::move(l_col.vals[i]);
+            ++n;
         }
-    }
+        l_col.rows.resize(n);
+        l_col.vals.resize(n);
 
-    // Now walk over the rows that need to be assigned into, always pulling from the OLD
-    // row into the NEW row so we don't overwrite data.
-    //
-    // TODO: there must be a faster way to do this by finding the relevant cells, extracting them, modifying the row
-    // number, and then reinserting.
-    //
-    for(const auto& [new_row, old_row] : row_map){
-        for(auto c = mmc.first; c <= mmc.second; ++c){
-            const auto v_opt = this->value(old_row, c);
-            if(v_opt){
-                this->inject(new_row, c, v_opt.value());
-                this->remove(old_row, c);
-            }
+        if(l_col.rows.empty()){
+            c_it = this->columns.erase(c_it);
+        }else{
+            ++c_it;
         }
     }
     return;
 }
 
-std::list< table2::data_iter_t >
+std::list< cell_coord_t >
 table2::find_cells( const std::list<std::regex> &regexes,
                     std::optional<cell_coord_t> mmr_opt,
                     std::optional<cell_coord_t> mmc_opt ) const {
@@ -432,33 +645,31 @@ table2::find_cells( const std::list<std::regex> &regexes,
     const auto c_min = mmc_opt.value().first;
     const auto c_max = mmc_opt.value().second;
 
-    std::list< table2::data_iter_t > out;
-
-    const auto end = std::end(this->data);
-    for(auto it = std::begin(this->data); it != end; ++it){
-        const auto r = it->get_row();
-        const auto c = it->get_col();
+    std::list< cell_coord_t > out;
+    this->visit_cells([&](int64_t r, int64_t c, const cell_value_t &v){
         if( (r_min <= r)
         &&  (r <= r_max)
         &&  (c_min <= c)
-        &&  (c <= c_max)
-        &&  std::any_of( std::begin(regexes), std::end(regexes),
-                         [&](const std::regex &r) -> bool {
-                             return std::regex_match(it->val, r);
-                         }) ){
-            out.emplace_back(it);
+        &&  (c <= c_max) ){
+            const auto s = to_string(v);
+            if( std::any_of( std::begin(regexes), std::end(regexes),
+                             [&](const std::regex &r) -> bool {
+                                 return std::regex_match(s, r);
+                             }) ){
+                out.emplace_back(r, c);
+            }
         }
-    }
+    });
 
     return out;
 }
 
 std::pair<specifiers_t, specifiers_t>
-table2::get_specifiers( const std::list< data_iter_t > &cells ) const {
+table2::get_specifiers( const std::list< cell_coord_t > &cells ) const {
     std::pair<specifiers_t, specifiers_t> out;
-    for(const auto &c_it : cells){
-        out.first.insert(c_it->get_row());
-        out.second.insert(c_it->get_col());
+    for(const auto &c : cells){
+        out.first.insert(c.first);
+        out.second.insert(c.second);
     }
     return out;
 }
@@ -542,7 +753,7 @@ table2::reshape_widen( specifiers_t key_columns,
 
 void
 table2::read_csv( std::istream &is ){
-    this->data.clear();
+    this->columns.clear();
     this->metadata.clear();
 
     const std::string quotes = "\"";  // Characters that open a quote at beginning of line only.
@@ -585,7 +796,7 @@ table2::read_csv( std::istream &is ){
     std::string line;
     while(std::getline(ss, line) || std::getline(is, line)){
         ++row_num;
-        bool inside_quote;
+        bool inside_quote = false;
         std::string cell;
 
         int64_t col_num = 0;
@@ -652,7 +863,7 @@ table2::read_csv( std::istream &is ){
         }
     }
 
-    if(this->data.empty()){
+    if(this->empty()){
         throw std::runtime_error("Unable to extract any data from file");
     }
     return;
@@ -668,10 +879,27 @@ table2::write_csv( std::ostream &os,
     const char quote = '"';
     const char esc = '\\';
 
+    // Walk each column's cells in order alongside the rows, avoiding a search for every cell.
+    std::vector<std::pair<const column*, size_t>> cursors;
+    for(int64_t col = col_min; col <= col_max; ++col){
+        const auto c_it = this->columns.find(col);
+        const column *l_col = (c_it == std::end(this->columns)) ? nullptr : &(c_it->second);
+        size_t i = 0;
+        if(l_col != nullptr){
+            i = std::distance(std::begin(l_col->rows), std::lower_bound(std::begin(l_col->rows), std::end(l_col->rows), row_min));
+        }
+        cursors.emplace_back(l_col, i);
+    }
+
     for(int64_t row = row_min; row <= row_max; ++row){
-        for(int64_t col = col_min; col <= col_max; ++col){
-            const auto val = this->value(row, col).value_or("");
-            if(!val.empty()) os << std::quoted(val, quote, esc);
+        for(auto& [l_col, i] : cursors){
+            if( (l_col != nullptr)
+            &&  (i < l_col->rows.size())
+            &&  (l_col->rows[i] == row) ){
+                const auto val = to_string(l_col->vals[i]);
+                if(!val.empty()) os << std::quoted(val, quote, esc);
+                ++i;
+            }
             os << separator;
         }
         os << "\n";
@@ -694,8 +922,8 @@ table2::write_csv( std::ostream &os,
 int main(){
 
     tables::table2 t;
-    t.data.emplace(12, 23, "test cell 1");
-    t.data.emplace(123, 234, "test cell 2");
+    t.inject(12, 23, "test cell 1");
+    t.inject(123, 234, "test cell 2");
 
     const auto [min_row, max_row] = t.min_max_row();
     const auto [min_col, max_col] = t.min_max_row();
@@ -710,7 +938,7 @@ int main(){
     std::cout << "Is (12, 23) present? " << !!t.value(12, 23) << std::endl;
     std::cout << "Value of cell (12, 23): '" << t.value(12, 23).value().get() << "'" << std::endl;
 
-    std::cout << "Number of cells prior to visitation: " << t.data.size() << std::endl;
+    std::cout << "Number of cells prior to visitation: " << t.size() << std::endl;
 
     tables::visitor_func_t f_1 = [](int64_t row, int64_t col, std::string& v) -> tables::action {
         if(!v.empty()){
@@ -727,14 +955,14 @@ int main(){
     };
 
     t.visit_standard_block(f_1);
-    std::cout << "Number of cells after visitation (automatic): " << t.data.size() << std::endl;
+    std::cout << "Number of cells after visitation (automatic): " << t.size() << std::endl;
 
     tables::visitor_func_t f_2 = [](int64_t row, int64_t col, std::string& v) -> tables::action {
         return tables::action::add; // Add all cells, even if empty.
     };
 
     t.visit_standard_block(f_2);
-    std::cout << "Number of cells after visitation (add): " << t.data.size() << std::endl;
+    std::cout << "Number of cells after visitation (add): " << t.size() << std::endl;
 
 
     tables::visitor_func_t f_3 = [](int64_t row, int64_t col, std::string& v) -> tables::action {
@@ -742,7 +970,7 @@ int main(){
     };
 
     t.visit_standard_block(f_3);
-    std::cout << "Number of cells after visitation (remove): " << t.data.size() << std::endl;
+    std::cout << "Number of cells after visitation (remove): " << t.size() << std::endl;
 
     return 0;
 }
@@ -2,10 +2,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <set>
 #include <list>
 #include <map>
 #include <string>
+#include <variant>
+#include <vector>
 #include <regex>
 #include <optional>
 #include <functional>
@@ -52,11 +55,32 @@ using specifiers_t = std::set<int64_t>; // Used to specify rows or columns.
 specifiers_t specifiers_intersection(const specifiers_t& a,
                                      const specifiers_t& b);
 
+// Cells are stored in typed form. Integers and reals are only stored as such when they can be converted back to the
+// original string exactly, so the string representation of every cell is preserved.
+using cell_value_t = std::variant<int64_t, double, std::string>;
+
+enum class cell_type {
+    integer,
+    real,
+    text,
+};
+
+// Convert a string to the narrowest cell type that exactly reproduces it, and vice-versa.
+cell_value_t to_cell_value(const std::string &s);
+std::string to_string(const cell_value_t &v);
+
+// A single column of cells. Only occupied rows are stored, so sparse columns are compact.
+struct column {
+    std::vector<int64_t> rows;       // Sorted.
+    std::vector<cell_value_t> vals;  // Parallel to rows.
+
+    // Returns the index of the row's cell, if present.
+    std::optional<size_t> find(int64_t row) const;
+};
+
 struct table2 {
-    //std::set< std::variant<cell<std::string>,
-    //                       cell<double>,
-    //                       cell<int64_t>>> data;
-    std::set< cell<std::string> > data;
+    // Columnar storage, keyed by column number. Columns without any cells are not retained.
+    std::map<int64_t, column> columns;
 
     std::map<std::string, std::string> metadata;
 
@@ -90,12 +114,34 @@ struct table2 {
     // Remove existing cell, if present.
     void remove(int64_t row, int64_t col);
 
+    // The number of cells present.
+    size_t size() const;
+    bool empty() const;
+
     // Const value extraction.
     std::optional<std::string> value(int64_t row, int64_t col) const;
 
     // Optional is disengaged if cell does not exist.
+    //
+    // Note that the cell is converted to text so that it can be modified via the reference.
     std::optional<std::reference_wrapper<std::string>> value_ref(int64_t row, int64_t col);
 
+    // Typed value extraction. Optional is disengaged if the cell does not exist or is not numeric.
+    //
+    // Integer and real cells are returned without parsing. Text cells are parsed, if possible.
+    std::optional<double> value_as_real(int64_t row, int64_t col) const;
+    std::optional<int64_t> value_as_integer(int64_t row, int64_t col) const;
+
+    // Extract a column's values as reals for the given (inclusive) rows. Missing or non-numeric cells are disengaged.
+    std::vector<std::optional<double>> column_as_reals(int64_t col, cell_coord_t row_bounds) const;
+
+    // The narrowest type that can represent all cells in the column within the given (inclusive) rows.
+    // Returns text if there are no cells.
+    cell_type column_type(int64_t col, std::optional<cell_coord_t> row_bounds = {}) const;
+
+    // Visit every cell that is present in row-major order.
+    void visit_cells(const std::function<void(int64_t r, int64_t c, const cell_value_t &v)> &f) const;
+
     // Visits every cell within the bounds (inclusive), even if not active.
     // Whether the cell should be engaged or disengaged after iteration is controlled by the user functor.
     void visit_block( cell_coord_t row_bounds,
@@ -114,15 +160,15 @@ struct table2 {
     void delete_rows( specifiers_t rows_to_delete );
 
     // Search for cells where the contents match one of the given regexes.
-    using data_iter_t = decltype( std::begin(data) );
-    std::list< data_iter_t >
+    // Cell coordinates are returned in row-major order.
+    std::list< cell_coord_t >
     find_cells( const std::list<std::regex> &r,
                 std::optional<cell_coord_t> row_bounds = {},
                 std::optional<cell_coord_t> col_bounds = {} ) const;
 
     // Convert cell references into row and column specifiers.
     std::pair<specifiers_t, specifiers_t>
-    get_specifiers( const std::list< data_iter_t > &cells ) const;
+    get_specifiers( const std::list< cell_coord_t > &cells ) const;
 
     // Make a long table into a wide table by computing the intersection using the key columns.
     // Rows within the bounds can be selectively ignored (e.g., headers).
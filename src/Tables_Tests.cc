@@ -0,0 +1,199 @@
+//Tables_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the sparse table class defined in Tables.cc.
+// Tests are separated into their own file because Tables_obj is linked into
+// shared libraries which don't include doctest implementation.
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "Tables.h"
+
+
+TEST_CASE("tables::to_cell_value preserves strings exactly"){
+    CHECK(std::holds_alternative<int64_t>(tables::to_cell_value("0")));
+    CHECK(std::holds_alternative<int64_t>(tables::to_cell_value("-123")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("007")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("+1")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value(" 1")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("1.50")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("nan")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("")));
+    CHECK(std::holds_alternative<std::string>(tables::to_cell_value("Mean dose")));
+
+    for(const std::string s : { "0", "-123", "9223372036854775807", "1.5", "0.333333", "-2.25", "1e+06", "1e-05",
+                                "1.50", "007", "+1", "abc", "", " 1 " }){
+        CHECK(tables::to_string(tables::to_cell_value(s)) == s);
+    }
+}
+
+TEST_CASE("tables::table2 cell access"){
+    tables::table2 t;
+    REQUIRE(t.empty());
+    REQUIRE(t.next_empty_row() == 0);
+    REQUIRE(t.next_empty_col() == 0);
+
+    t.inject(0, 0, "Name");
+    t.inject(0, 1, "Dose");
+    t.inject(1, 0, "Heart");
+    t.inject(1, 1, "12.5");
+    t.inject(2, 0, "Lung");
+    t.inject(2, 1, "7");
+    t.inject(5, 3, "x");
+
+    REQUIRE(t.size() == 7);
+    REQUIRE(t.min_max_row() == tables::cell_coord_t{0, 5});
+    REQUIRE(t.min_max_col() == tables::cell_coord_t{0, 3});
+    REQUIRE(t.next_empty_row() == 6);
+    REQUIRE(t.next_empty_col() == 4);
+
+    SUBCASE("values"){
+        REQUIRE(t.value(1, 1).value() == "12.5");
+        REQUIRE(!t.value(3, 1));
+        REQUIRE(t.value_as_real(1, 1).value() == doctest::Approx(12.5));
+        REQUIRE(t.value_as_real(2, 1).value() == doctest::Approx(7.0));
+        REQUIRE(t.value_as_integer(2, 1).value() == 7);
+        REQUIRE(!t.value_as_integer(1, 1));
+        REQUIRE(!t.value_as_real(1, 0));
+        REQUIRE(t.column_type(1) == tables::cell_type::text);
+        REQUIRE(t.column_type(1, tables::cell_coord_t{1, 2}) == tables::cell_type::real);
+
+        const auto reals = t.column_as_reals(1, {0, 3});
+        REQUIRE(reals.size() == 4);
+        REQUIRE(!reals[0]);
+        REQUIRE(reals[1].value() == doctest::Approx(12.5));
+        REQUIRE(reals[2].value() == doctest::Approx(7.0));
+        REQUIRE(!reals[3]);
+    }
+
+    SUBCASE("overwrite, insert, and remove"){
+        t.inject(1, 1, "abc");
+        t.inject(0, 2, "Inserted");
+        REQUIRE(t.value(1, 1).value() == "abc");
+        REQUIRE(t.value(0, 2).value() == "Inserted");
+
+        t.remove(5, 3);
+        REQUIRE(t.min_max_col() == tables::cell_coord_t{0, 2});
+        REQUIRE(t.min_max_row() == tables::cell_coord_t{0, 2});
+
+        auto ref = t.value_ref(2, 1);
+        REQUIRE(ref);
+        ref.value().get() += "0";
+        REQUIRE(t.value(2, 1).value() == "70");
+    }
+
+    SUBCASE("visit_cells is row-major"){
+        std::vector<tables::cell_coord_t> coords;
+        t.visit_cells([&](int64_t r, int64_t c, const tables::cell_value_t &){ coords.emplace_back(r, c); });
+        const std::vector<tables::cell_coord_t> expected = { {0,0}, {0,1}, {1,0}, {1,1}, {2,0}, {2,1}, {5,3} };
+        REQUIRE(coords == expected);
+    }
+
+    SUBCASE("visit_block actions"){
+        t.visit_block({0, 2}, {0, 1}, [](int64_t r, int64_t c, std::string &v){
+            if(r == 0) return tables::action::remove;
+            if(c == 1) v += "!";
+            return tables::action::automatic;
+        });
+        REQUIRE(!t.value(0, 0));
+        REQUIRE(t.value(1, 1).value() == "12.5!");
+        REQUIRE(t.value(2, 1).value() == "7!");
+
+        t.visit_block({10, 10}, {0, 1}, [](int64_t, int64_t, std::string &){ return tables::action::add; });
+        REQUIRE(t.value(10, 0).value() == "");
+        REQUIRE(t.next_empty_row() == 11);
+    }
+
+    SUBCASE("find_cells and delete_rows"){
+        const auto cells = t.find_cells({ std::regex("L.*"), std::regex("7") });
+        const auto [rows, cols] = t.get_specifiers(cells);
+        REQUIRE(rows == tables::specifiers_t{2});
+        REQUIRE(cols == tables::specifiers_t{0, 1});
+
+        t.delete_rows({1, 3});
+        REQUIRE(t.value(1, 0).value() == "Lung");
+        REQUIRE(t.value(3, 3).value() == "x");
+        REQUIRE(!t.value(5, 3));
+        REQUIRE(t.get_empty_rows() == tables::specifiers_t{2});
+    }
+}
+
+TEST_CASE("tables::table2 reshape_widen"){
+    tables::table2 t;
+    const std::vector<std::vector<std::string>> rows = { { "ROI", "Metric", "Value" },
+                                                         { "Heart", "Mean", "1.5" },
+                                                         { "Lung", "Mean", "2.5" },
+                                                         { "Heart", "Max", "3" },
+                                                         { "Lung", "Max", "4" } };
+    for(size_t r = 0; r < rows.size(); ++r){
+        for(size_t c = 0; c < rows[r].size(); ++c){
+            t.inject(r, c, rows[r][c]);
+        }
+    }
+    t.reshape_widen({0}, {0});
+    REQUIRE(t.min_max_row() == tables::cell_coord_t{0, 2});
+    REQUIRE(t.value(1, 0).value() == "Heart");
+    REQUIRE(t.value(1, 2).value() == "1.5");
+    REQUIRE(t.value(1, 3).value() == "Max");
+    REQUIRE(t.value(1, 4).value() == "3");
+    REQUIRE(t.value(2, 4).value() == "4");
+}
+
+TEST_CASE("tables::table2 CSV round-trip"){
+    tables::table2 t;
+    t.inject(0, 0, "a,b");
+    t.inject(0, 1, "1.50");
+    t.inject(1, 0, "2");
+    t.inject(1, 2, "-3.25");
+
+    std::stringstream ss;
+    t.write_csv(ss);
+
+    tables::table2 u;
+    u.read_csv(ss);
+    REQUIRE(u.size() == t.size());
+    t.visit_cells([&](int64_t r, int64_t c, const tables::cell_value_t &v){
+        REQUIRE(u.value(r, c).value() == tables::to_string(v));
+    });
+}
+
+TEST_CASE("tables::table2 benchmark"){
+    // A table resembling radiomics output: a header row followed by many rows of numeric features.
+    const int64_t N_rows = 20000;
+    const int64_t N_cols = 25;
+
+    const auto t_start = std::chrono::steady_clock::now();
+    tables::table2 t;
+    for(int64_t c = 0; c < N_cols; ++c) t.inject(0, c, "Feature" + std::to_string(c));
+    for(int64_t r = 1; r <= N_rows; ++r){
+        for(int64_t c = 0; c < N_cols; ++c){
+            t.inject(r, c, std::to_string(r * c) + ".5");
+        }
+    }
+    const auto t_inject = std::chrono::steady_clock::now();
+
+    double sum = 0.0;
+    for(int64_t c = 0; c < N_cols; ++c){
+        for(const auto &v : t.column_as_reals(c, {1, N_rows})) sum += v.value_or(0.0);
+    }
+    const auto t_reduce = std::chrono::steady_clock::now();
+
+    std::stringstream ss;
+    t.write_csv(ss);
+    const auto t_write = std::chrono::steady_clock::now();
+
+    const auto ms = [](auto a, auto b){ return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    MESSAGE("Table with " << t.size() << " cells: inject " << ms(t_start, t_inject) << " ms,"
+            << " column reduction " << ms(t_inject, t_reduce) << " ms,"
+            << " CSV export " << ms(t_reduce, t_write) << " ms");
+    REQUIRE(t.column_type(1, tables::cell_coord_t{1, N_rows}) == tables::cell_type::real);
+    REQUIRE(0.0 < sum);
+}
@@ -22,6 +22,7 @@
 
 #include "../../Thread_Pool.h"
 #include "../Grouping/Misc_Functors.h"
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
 #include "Compare_Images.h"
 
@@ -616,11 +617,11 @@ bool ComputeCompareImages(planar_image_collection<float,double> &imagecoll,
                 return;
             };
 
-            Mutate_Voxels<float,double>( img_refw,
-                                         { img_refw },
-                                         ccsl, 
-                                         mv_opts, 
-                                         f_bounded );
+            Mutate_Voxels_Rasterized( img_refw,
+                                      { img_refw },
+                                      ccsl, 
+                                      mv_opts, 
+                                      f_bounded );
 
             if(user_data_s->comparison_method == ComputeCompareImagesUserData::ComparisonMethod::Discrepancy){
                 UpdateImageDescription( img_refw, "Compared (discrepancy)" );
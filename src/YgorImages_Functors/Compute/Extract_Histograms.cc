@@ -14,6 +14,7 @@
 
 #include "../../Thread_Pool.h"
 #include "../../Metadata.h"
+#include "../../Contour_Rasterization.h"
 #include "../Grouping/Misc_Functors.h"
 #include "../ConvenienceRoutines.h"
 #include "Extract_Histograms.h"
@@ -65,6 +66,23 @@ bool ComputeExtractHistograms(planar_image_collection<float,double> &imagecoll,
         return false;
     }
 
+    // Invoke a Mutate_Voxels-style functor on every bounded voxel. This is equivalent to Mutate_Voxels with the
+    // single-voxel, in-place, no-op-mask options set above.
+    const auto visit_bounded_voxels = [&](std::reference_wrapper<planar_image<float,double>> img_refw,
+                                          const std::list<std::reference_wrapper<contour_collection<double>>> &l_ccsl,
+                                          auto &f_bounded) -> void {
+        auto &l_img = img_refw.get();
+        const auto mask = Rasterize_Contours_Cached( l_img, l_ccsl,
+                                                     user_data_s->mutation_opts.inclusivity,
+                                                     user_data_s->mutation_opts.contouroverlap );
+        mask->visit_bounded([&](int64_t row, int64_t col){
+            for(int64_t chan = 0; chan < l_img.channels; ++chan){
+                f_bounded(row, col, chan, img_refw, img_refw, l_img.reference(row, col, chan));
+            }
+        });
+        return;
+    };
+
     // Logically partition the contours.
     //
     // Note: At the moment we exclusively use ROIName, but we *could* use any metadata tag here.
@@ -140,11 +158,9 @@ bool ComputeExtractHistograms(planar_image_collection<float,double> &imagecoll,
                         return;
                     };
 
-                    Mutate_Voxels<float,double>( img_refw,
-                                                 { img_refw },
-                                                 named_ccsl.second, 
-                                                 user_data_s->mutation_opts, 
-                                                 f_bounded );
+                    // Bounded voxels are found via cached scanline rasterization, so the second pass over the same
+                    // image and ROI reuses the mask from the first.
+                    visit_bounded_voxels(img_refw, named_ccsl.second, f_bounded);
 
                     // Merge the results.
                     if( std::isfinite(local_minimum) 
@@ -304,11 +320,7 @@ bool ComputeExtractHistograms(planar_image_collection<float,double> &imagecoll,
                         return;
                     };
 
-                    Mutate_Voxels<float,double>( img_refw,
-                                                 { img_refw },
-                                                 named_ccsl.second, 
-                                                 user_data_s->mutation_opts, 
-                                                 f_bounded );
+                    visit_bounded_voxels(img_refw, named_ccsl.second, f_bounded);
 
                     add_counts(); // Commit all remaining bins from the shuttle.
                 } // Loop over all named ccs.
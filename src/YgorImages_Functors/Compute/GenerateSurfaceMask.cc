@@ -13,6 +13,7 @@
 #include <cstdint>
 
 #include "../../Thread_Pool.h"
+#include "../../Contour_Rasterization.h"
 #include "../Grouping/Misc_Functors.h"
 #include "GenerateSurfaceMask.h"
 #include "YgorImages.h"
@@ -90,11 +91,6 @@ bool ComputeGenerateSurfaceMask(planar_image_collection<float,double> &imagecoll
         }
 
         planar_image<float,double> &img = std::ref(*selected_imgs.front());
-        //Loop over the rois, rows, columns, channels, and finally any selected images.
-        const auto row_unit   = img.row_unit;
-        const auto col_unit   = img.col_unit;
-        const auto ortho_unit = img.ortho_unit();
-   
         img.fill_pixels( 0, std::numeric_limits<float>::quiet_NaN() );
         
         //Find the (ranked) nearest images (above and below, if there are any) for later use.
@@ -124,6 +120,20 @@ bool ComputeGenerateSurfaceMask(planar_image_collection<float,double> &imagecoll
             continue;
         }
 
+        //Voxels bounded by the selected contours are found via scanline rasterization once per image, rather than
+        // testing every voxel and its neighbours against every contour.
+        const auto mask = Rasterize_Contours_Cached(img, cc_select,
+                                                    Mutate_Voxels_Opts::Inclusivity::Centre,
+                                                    Mutate_Voxels_Opts::ContourOverlap::Ignore);
+        const auto mask_above = above.empty() ? nullptr
+                              : Rasterize_Contours_Cached(*(above.front()), cc_select,
+                                                          Mutate_Voxels_Opts::Inclusivity::Centre,
+                                                          Mutate_Voxels_Opts::ContourOverlap::Ignore);
+        const auto mask_below = below.empty() ? nullptr
+                              : Rasterize_Contours_Cached(*(below.front()), cc_select,
+                                                          Mutate_Voxels_Opts::Inclusivity::Centre,
+                                                          Mutate_Voxels_Opts::ContourOverlap::Ignore);
+
         //Loop over the pixels of the image.
         {
             work_queue<std::function<void(void)>> wq;
@@ -133,30 +143,13 @@ bool ComputeGenerateSurfaceMask(planar_image_collection<float,double> &imagecoll
                         const auto point = img.position(row,col);
 
                         //Check if there are any ROI's this voxel is inside. 
-                        bool is_in_an_roi = false;
-                        for(auto &ccs : cc_select){
-                            for(auto & contour : ccs.get().contours){
-                                if(contour.points.empty()) continue;
-                                if(! img.encompasses_contour_of_points(contour)) continue;
-
-                                //Prepare a contour for fast is-point-within-the-polygon checking.
-                                auto BestFitPlane = contour.Least_Squares_Best_Fit_Plane(ortho_unit);
-                                auto ProjectedContour = contour.Project_Onto_Plane_Orthogonally(BestFitPlane);
-                                const bool AlreadyProjected = true;
-                
-                                auto ProjectedPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                                is_in_an_roi = ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                                           ProjectedPoint,
-                                                                                                           AlreadyProjected);
-                                if(is_in_an_roi) break;
-                            }
-                            if(is_in_an_roi) break;
-                        }
+                        const bool is_in_an_roi = mask->contains(row, col);
                         img.reference(row, col, 0) =  (is_in_an_roi) ? (user_data_s->interior_val)
                                                                      : (user_data_s->background_val);
 
                         //Create a lambda routine that takes an image and checks in-plane if any neighbours are (!is_in_an_roi).
                         auto check_inclusion = [&](const planar_image<float,double> &limg,
+                                                   const roi_mask &lmask,
                                                    int64_t boxr ) -> bool {
 
                                 //Project the original image's position onto the plane of this image, so we know where the central
@@ -172,38 +165,20 @@ bool ComputeGenerateSurfaceMask(planar_image_collection<float,double> &imagecoll
                                     for(auto bcol = (lcol-boxr); bcol <= (lcol+boxr); ++bcol){
                                         //Check if the coordinates are legal and in the ROI.
                                         if( !isininc(0,brow,limg.rows-1) || !isininc(0,bcol,limg.columns-1) ) continue;
-                                        const auto bpoint = limg.position(brow, bcol);
-
-                                        for(auto &ccs : cc_select){
-                                            for(auto & contour : ccs.get().contours){
-                                                if(contour.points.empty()) continue;
-                                                if(! limg.encompasses_contour_of_points(contour)) continue;
-
-                                                //Prepare a contour for fast is-point-within-the-polygon checking.
-                                                auto BestFitPlane = contour.Least_Squares_Best_Fit_Plane(ortho_unit);
-                                                auto ProjectedContour = contour.Project_Onto_Plane_Orthogonally(BestFitPlane);
-                                                const bool AlreadyProjected = true;
-                                
-                                                auto ProjectedPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(bpoint);
-                                                const auto bis_in_an_roi = ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                                                                       ProjectedPoint,
-                                                                                                                                       AlreadyProjected);
-                                                if(bis_in_an_roi != is_in_an_roi) return true;
-                                            }
-                                        }
+                                        if(lmask.contains(brow, bcol) != is_in_an_roi) return true;
                                     }
                                 }
                                 return false; //No point (!is_in_an_roi) was found.
                         };
 
 
-                        if(check_inclusion(img, 1)){
+                        if(check_inclusion(img, *mask, 1)){
                             img.reference(row, col, 0) = user_data_s->surface_val;
 
                         //Apply the check to the nearest neighbouring image slices.
-                        }else if( !above.empty() && check_inclusion(*(above.front()), 0) ){
+                        }else if( !above.empty() && check_inclusion(*(above.front()), *mask_above, 0) ){
                             img.reference(row, col, 0) = user_data_s->surface_val;
-                        }else if( !below.empty() && check_inclusion(*(below.front()), 0) ){
+                        }else if( !below.empty() && check_inclusion(*(below.front()), *mask_below, 0) ){
                             img.reference(row, col, 0) = user_data_s->surface_val;
                         }
                     }
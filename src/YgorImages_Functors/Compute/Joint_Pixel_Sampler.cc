@@ -15,6 +15,7 @@
 
 #include "../../Thread_Pool.h"
 #include "../Grouping/Misc_Functors.h"
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
 #include "Joint_Pixel_Sampler.h"
 #include "YgorImages.h"
@@ -258,11 +259,11 @@ bool ComputeJointPixelSampler(planar_image_collection<float,double> &imagecoll,
                 return;
             };
 
-            Mutate_Voxels<float,double>( img_refw,
-                                         { img_refw },
-                                         ccsl, 
-                                         mv_opts, 
-                                         f_bounded );
+            Mutate_Voxels_Rasterized( img_refw,
+                                      { img_refw },
+                                      ccsl, 
+                                      mv_opts, 
+                                      f_bounded );
 
             UpdateImageDescription( img_refw, user_data_s->description );
             UpdateImageWindowCentreWidth( img_refw );
@@ -14,6 +14,7 @@
 
 #include "../../Thread_Pool.h"
 #include "../Grouping/Misc_Functors.h"
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
 #include "Volumetric_Neighbourhood_Sampler.h"
 #include "YgorImages.h"
@@ -297,11 +298,11 @@ bool ComputeVolumetricNeighbourhoodSampler(planar_image_collection<float,double>
                 return;
             };
 
-            Mutate_Voxels<float,double>( img_refw,
-                                         { img_refw },
-                                         ccsl, 
-                                         mv_opts, 
-                                         f_bounded );
+            Mutate_Voxels_Rasterized( img_refw,
+                                      { img_refw },
+                                      ccsl, 
+                                      mv_opts, 
+                                      f_bounded );
 
             if(!(user_data_s->description.empty())){
                 UpdateImageDescription( img_refw, user_data_s->description );
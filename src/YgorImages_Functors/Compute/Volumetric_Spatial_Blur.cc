@@ -1,5 +1,7 @@
 //Volumetric_Spatial_Blur.cc.
 
+#include <array>
+#include <cmath>
 #include <exception>
 #include <any>
 #include <optional>
@@ -10,6 +12,8 @@
 #include <random>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <cstdint>
 
 #include "YgorImages.h"
@@ -21,19 +25,131 @@
 #include "YgorClustering.hpp"
 #include "../../Thread_Pool.h"
 #include "../Grouping/Misc_Functors.h"
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
+#include "../../Gaussian_Blur.h"
 #include "Volumetric_Neighbourhood_Sampler.h"
 
 #include "Volumetric_Spatial_Blur.h"
 
 
+// Blur the whole image array with a separable Gaussian, updating only the voxels within the ROIs.
+static
+bool
+Blur_Separable_Gaussian(planar_image_collection<float,double> &imagecoll,
+                        std::list<std::reference_wrapper<contour_collection<double>>> ccsl,
+                        const ComputeVolumetricSpatialBlurUserData &ud){
+
+    std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs;
+    for(auto &img : imagecoll.images){
+        selected_imgs.push_back( std::ref(img) );
+    }
+    if(selected_imgs.empty() || !Images_Form_Rectilinear_Grid(selected_imgs)){
+        YLOGWARN("Images do not form a rectilinear grid. Cannot continue");
+        return false;
+    }
+
+    const int64_t rows = imagecoll.images.front().rows;
+    const int64_t cols = imagecoll.images.front().columns;
+    const int64_t channels = imagecoll.images.front().channels;
+    for(const auto &img : imagecoll.images){
+        if( (img.rows != rows) || (img.columns != cols) || (img.channels != channels) ){
+            YLOGWARN("Images have inconsistent dimensions. Cannot continue");
+            return false;
+        }
+    }
+
+    const auto orientation_normal = Average_Contour_Normals(ccsl);
+    planar_image_adjacency<float,double> img_adj( {}, { { std::ref(imagecoll) } }, orientation_normal );
+    const auto N_imgs = static_cast<int64_t>(img_adj.int_to_img.size());
+    if(N_imgs != static_cast<int64_t>(imagecoll.images.size())){
+        YLOGWARN("Unable to order images. Cannot continue");
+        return false;
+    }
+
+    // Convert sigma to voxel units. The image spacing is taken from the image positions rather than the voxel
+    // thickness, which can differ.
+    const auto &first_img = img_adj.index_to_image(0).get();
+    double slice_spacing = first_img.pxl_dz;
+    if(1 < N_imgs){
+        const auto &last_img = img_adj.index_to_image(N_imgs - 1).get();
+        slice_spacing = std::abs( (last_img.position(0, 0) - first_img.position(0, 0)).Dot(orientation_normal) )
+                      / static_cast<double>(N_imgs - 1);
+    }
+    GaussianBlurParams params;
+    params.sigma = {{ ud.sigma_image / slice_spacing,
+                      ud.sigma_row / first_img.pxl_dx,
+                      ud.sigma_column / first_img.pxl_dy }};
+    params.method = (ud.estimator == VolumetricSpatialBlurEstimator::GaussianTruncated) ? GaussianBlurMethod::Truncated
+                  : (ud.estimator == VolumetricSpatialBlurEstimator::GaussianRecursive) ? GaussianBlurMethod::Recursive
+                                                                                        : GaussianBlurMethod::Automatic;
+    YLOGINFO("Blurring with sigma = (" << params.sigma[0] << ", " << params.sigma[1] << ", " << params.sigma[2]
+             << ") voxels along the image, row, and column directions");
+
+    // Blur a dense copy of the images. All channels are blurred so the layout matches the images.
+    const std::array<int64_t, 3> dims = {{ N_imgs, rows, cols }};
+    std::vector<float> vol(N_imgs * rows * cols * channels);
+    const auto vol_index = [&](int64_t i, int64_t r, int64_t c, int64_t ch) -> size_t {
+        return static_cast<size_t>(((i * rows + r) * cols + c) * channels + ch);
+    };
+    for(int64_t i = 0; i < N_imgs; ++i){
+        const auto &img = img_adj.index_to_image(i).get();
+        for(int64_t r = 0; r < rows; ++r){
+            for(int64_t c = 0; c < cols; ++c){
+                for(int64_t ch = 0; ch < channels; ++ch){
+                    vol[vol_index(i, r, c, ch)] = img.value(r, c, ch);
+                }
+            }
+        }
+    }
+    Gaussian_Blur_Volume(vol.data(), dims, channels, params);
+
+    Mutate_Voxels_Opts mv_opts;
+    mv_opts.editstyle      = Mutate_Voxels_Opts::EditStyle::InPlace;
+    mv_opts.inclusivity    = Mutate_Voxels_Opts::Inclusivity::Centre;
+    mv_opts.contouroverlap = Mutate_Voxels_Opts::ContourOverlap::Ignore;
+    mv_opts.aggregate      = Mutate_Voxels_Opts::Aggregate::First;
+    mv_opts.adjacency      = Mutate_Voxels_Opts::Adjacency::SingleVoxel;
+    mv_opts.maskmod        = Mutate_Voxels_Opts::MaskMod::Noop;
+
+    work_queue<std::function<void(void)>> wq;
+    for(auto &img : imagecoll.images){
+        std::reference_wrapper< planar_image<float, double>> img_refw( std::ref(img) );
+        const auto i = img_adj.image_to_index(img_refw);
+        wq.submit_task([&,img_refw,i]() -> void {
+            auto f_bounded = [&](int64_t E_row, int64_t E_col, int64_t channel,
+                                 std::reference_wrapper<planar_image<float,double>> /*img_refw*/,
+                                 std::reference_wrapper<planar_image<float,double>> /*mask_img_refw*/,
+                                 float &voxel_val) {
+                if( (ud.channel >= 0) && (channel != ud.channel) ){
+                    return;
+                }
+                voxel_val = vol[vol_index(i, E_row, E_col, channel)];
+            };
+            Mutate_Voxels_Rasterized( img_refw,
+                                      { img_refw },
+                                      ccsl,
+                                      mv_opts,
+                                      f_bounded );
+        });
+    }
+    return true;
+}
+
 bool ComputeVolumetricSpatialBlur(planar_image_collection<float,double> &imagecoll,
                       std::list<std::reference_wrapper<planar_image_collection<float,double>>> /*external_imgs*/,
                       std::list<std::reference_wrapper<contour_collection<double>>> ccsl,
                       std::any user_data ){
 
-    // This routine computes 3D blurs. Currently, only Gaussians are supported. Specifically, a 1-sigma Gaussian (in
-    // pixel units, not DICOM units) with a fixed 3*sigma extent. This blur is separable and is thus applied in three
+    // This routine computes 3D blurs. Currently, only Gaussians are supported.
+    //
+    // The separable Gaussian estimators accept sigma (in DICOM units) for each direction and account for the voxel
+    // dimensions. They blur the whole image array using three 1D passes (either truncated kernels or a recursive
+    // filter with cost independent of sigma) and then update the voxels within the ROIs. Non-finite and inaccessible
+    // voxels are ignored and the remaining weights are renormalized.
+    //
+    // The legacy 'Gaussian' estimator is a 1-sigma Gaussian (in pixel units, not DICOM units) with a fixed 3*sigma
+    // extent. This blur is separable and is thus applied in three
     // directions successively. The spacing between adjacent voxels is not taken into account, so voxels should have
     // isotropic dimensions (or the blur will be non-isotropic). The effective window considered by this Gaussian is
     // 7x7x7 voxels. If voxels are inaccessible or non-finite they will be ignored and other voxels in the neighbourhood
@@ -170,6 +286,13 @@ bool ComputeVolumetricSpatialBlur(planar_image_collection<float,double> &imageco
             }
         }
 
+    }else if( (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianTruncated)
+          ||  (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianRecursive)
+          ||  (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianAutomatic) ){
+        if(!Blur_Separable_Gaussian(imagecoll, ccsl, *user_data_s)){
+            return false;
+        }
+
     }else{
         throw std::invalid_argument("Unrecognized user-provided estimator argument.");
     }
@@ -179,13 +302,20 @@ bool ComputeVolumetricSpatialBlur(planar_image_collection<float,double> &imageco
     std::string img_desc;
     if(user_data_s->estimator == VolumetricSpatialBlurEstimator::Gaussian){
         img_desc += "volumetric Gaussian blurred";
+        img_desc += " (in pixel coord.s)";
+
+    }else if( (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianTruncated)
+          ||  (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianRecursive)
+          ||  (user_data_s->estimator == VolumetricSpatialBlurEstimator::GaussianAutomatic) ){
+        img_desc += "volumetric Gaussian blurred (sigma = ";
+        img_desc += std::to_string(user_data_s->sigma_row) + ", ";
+        img_desc += std::to_string(user_data_s->sigma_column) + ", ";
+        img_desc += std::to_string(user_data_s->sigma_image) + " mm)";
 
     }else{
         throw std::invalid_argument("Unrecognized user-provided estimator");
     }
 
-    img_desc += " (in pixel coord.s)";
-
     for(auto &img : imagecoll.images){
         UpdateImageDescription( std::ref(img), img_desc );
         UpdateImageWindowCentreWidth( std::ref(img) );
@@ -12,7 +12,12 @@ template <class T> class contour_collection;
 
 typedef enum { // Controls which blur is computed.
 
-    Gaussian // Numerically-approximated Gaussian with fixed (3-sigma) extent.
+    Gaussian, // Numerically-approximated Gaussian with fixed (3-sigma) extent.
+
+    // Separable Gaussians with user-specified sigma (in DICOM units; mm).
+    GaussianTruncated, // Sampled kernel with a fixed (3-sigma) extent.
+    GaussianRecursive, // Recursive (IIR) filter with cost independent of sigma.
+    GaussianAutomatic  // Whichever of the above is cheaper for each axis.
 
 } VolumetricSpatialBlurEstimator;
 
@@ -23,6 +28,16 @@ struct ComputeVolumetricSpatialBlurUserData {
     // The channel to analyze. If negative, all channels are analyzed.
     int64_t channel = -1;
 
+    // The standard deviation of separable Gaussians (in DICOM units; mm) along the row-, column-, and image-aligned
+    // directions. Voxel dimensions are taken into account, so anisotropic voxels receive an isotropic blur when all
+    // three are equal.
+    //
+    // Note: Only applicable to the separable Gaussian estimators. A non-positive sigma disables blurring along that
+    //       direction.
+    double sigma_row = 1.0;
+    double sigma_column = 1.0;
+    double sigma_image = 1.0;
+
 };
 
 bool ComputeVolumetricSpatialBlur(planar_image_collection<float,double> &,
@@ -24,6 +24,8 @@
 #include "YgorStats.h"       //Needed for Stats:: namespace.
 #include "YgorString.h"      //Needed for GetFirstRegex(...)
 
+#include "../../Contour_Rasterization.h"
+
 
 const auto boxr = 2; //The inclusive 'radius' of the square box to use to average nearby pixels. Controls amount of spatial averaging.
 
@@ -69,11 +71,6 @@ bool ComputeCentralizedMoments(planar_image_collection<float,double>::images_lis
     //Paint all pixels black.
     working.fill_pixels(static_cast<float>(0));
 
-    //Loop over the rois, rows, columns, channels, and finally any selected images (if applicable).
-    const auto row_unit   = first_img_it->row_unit;
-    const auto col_unit   = first_img_it->col_unit;
-    const auto ortho_unit = first_img_it->ortho_unit();
-
     //Loop over the rois, rows, columns, channels, and finally any selected images (if applicable).
     for(const auto & ref_wrapped_cc : ccsl){
         const auto AssumePlanarContours = true;
@@ -100,37 +97,16 @@ bool ComputeCentralizedMoments(planar_image_collection<float,double>::images_lis
             //const auto ROIName = ReplaceAllInstances(roi->metadata["ROIName"], "[_]", " ");
             //const auto ROIName = roi->metadata["ROIName"];
     
-    /*
-            //Construct a bounding box to reduce computational demand of checking every voxel.
-            auto BBox = roi->Bounding_Box_Along(row_unit, 1.0);
-            auto BBoxBestFitPlane = BBox.Least_Squares_Best_Fit_Plane(vec3<double>(0.0,0.0,1.0));
-            auto BBoxProjectedContour = BBox.Project_Onto_Plane_Orthogonally(BBoxBestFitPlane);
-            const bool BBoxAlreadyProjected = true;
-    */
-    
-            //Prepare a contour for fast is-point-within-the-polygon checking.
-            auto BestFitPlane = roi.Least_Squares_Best_Fit_Plane(ortho_unit);
-            auto ProjectedContour = roi.Project_Onto_Plane_Orthogonally(BestFitPlane);
-            const bool AlreadyProjected = true;
+            //Voxels bounded by the contour are found via scanline rasterization rather than per-voxel point-in-polygon tests.
+            const auto mask = Rasterize_Contour_Cached(*first_img_it, roi);
     
             for(auto row = 0; row < first_img_it->rows; ++row){
                 for(auto col = 0; col < first_img_it->columns; ++col){
                     //Figure out the spatial location of the present voxel.
                     const auto point = first_img_it->position(row,col);
     
-    /*
-                    //Check if within the bounding box. It will generally be cheaper than the full contour (4 points vs. ? points).
-                    auto BBoxProjectedPoint = BBoxBestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                    if(!BBoxProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BBoxBestFitPlane,
-                                                                                        BBoxProjectedPoint,
-                                                                                        BBoxAlreadyProjected)) continue;
-    */
-    
-                    //Perform a more detailed check to see if we are in the ROI.
-                    auto ProjectedPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                    if(ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                   ProjectedPoint,
-                                                                                   AlreadyProjected)){
+                    //Check if the voxel is bounded by the contour.
+                    if(mask->contains(row, col)){
                         for(auto chan = 0; chan < first_img_it->channels; ++chan){
                             //Check if another ROI has already written to this voxel. Bail if so.
                             {
@@ -149,13 +125,7 @@ bool ComputeCentralizedMoments(planar_image_collection<float,double>::images_lis
                                         //Check if the coordinates are legal and in the ROI.
                                         if( !isininc(0,lrow,img_it->rows-1) || !isininc(0,lcol,img_it->columns-1) ) continue;
     
-                                        //const auto boxpoint = first_img_it->spatial_location(row,col);  //For standard contours(?).
-                                        //const auto neighbourpoint = vec3<double>(lrow*1.0, lcol*1.0, SliceLocation*1.0);  //For the pixel integer contours.
-                                        const auto neighbourpoint = first_img_it->position(lrow,lcol);
-                                        auto ProjectedNeighbourPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(neighbourpoint);
-                                        if(!ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                                        ProjectedNeighbourPoint,
-                                                                                                        AlreadyProjected)) continue;
+                                        if(!mask->contains(lrow, lcol)) continue;
                                         const auto val = static_cast<double>(img_it->value(lrow, lcol, chan));
                                         in_pixs.push_back(val);
                                     }
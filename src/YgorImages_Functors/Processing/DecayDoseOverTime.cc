@@ -7,6 +7,7 @@
 #include <cstdint>
 
 #include "../../BED_Conversion.h"
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
 #include "DecayDoseOverTime.h"
 #include "YgorImages.h"
@@ -132,11 +133,11 @@ bool DecayDoseOverTime(planar_image_collection<float,double>::images_list_it_t f
     std::list<std::reference_wrapper<planar_image<float,double>>> selected_imgs;
     for(auto &img_it : selected_img_its) selected_imgs.push_back( std::ref(*img_it) );
 
-    Mutate_Voxels<float,double>( std::ref(*first_img_it),
-                                 selected_imgs, 
-                                 ccsl, 
-                                 ebv_opts, 
-                                 f_bounded );
+    Mutate_Voxels_Rasterized( std::ref(*first_img_it),
+                              selected_imgs, 
+                              ccsl, 
+                              ebv_opts, 
+                              f_bounded );
 
     //Alter the first image's metadata to reflect that averaging has occurred. You might want to consider
     // a selective whitelist approach so that unique IDs are not duplicated accidentally.
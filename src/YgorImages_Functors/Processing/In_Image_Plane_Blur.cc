@@ -1,4 +1,6 @@
 
+#include <array>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <limits>
@@ -7,6 +9,7 @@
 #include <string>
 
 #include "../ConvenienceRoutines.h"
+#include "../../Gaussian_Blur.h"
 #include "In_Image_Plane_Blur.h"
 #include "YgorImages.h"
 #include "YgorMisc.h"
@@ -40,9 +43,14 @@ bool InPlaneImageBlur(
     //Record the min and max actual pixel values for windowing purposes.
     Stats::Running_MinMax<float> minmax_pixel;
 
-    //There is a dedicated function for non-fixed ("open") Gaussian blur.
+    //Non-fixed ("open") Gaussian blurs are computed separably, so the cost does not grow with the area of the kernel.
     if(user_data_s->estimator == BlurEstimator::gaussian_open){
-        working.Gaussian_Pixel_Blur({ }, user_data_s->gaussian_sigma);
+        GaussianBlurParams params;
+        params.sigma = {{ 0.0, user_data_s->gaussian_sigma, user_data_s->gaussian_sigma }};
+        params.method = GaussianBlurMethod::Automatic;
+        params.threads = 1; // Images are already processed in parallel.
+        const std::array<int64_t, 3> dims = {{ 1, working.rows, working.columns }};
+        Gaussian_Blur_Volume(working.data.data(), dims, working.channels, params);
 
         //Loop over the rows, columns, and channels.
         for(auto row = 0; row < working.rows; ++row){
@@ -0,0 +1,306 @@
+//Liver_Kinetic_Voxel_Fitting.h.
+#pragma once
+
+#ifdef DCMA_USE_GNU_GSL
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+#include "YgorLog.h"
+#include "YgorStats.h"       //Needed for Stats:: namespace.
+
+#include "../../Thread_Pool.h"
+#include "../../Contour_Rasterization.h"
+
+
+// Options for voxel-wise kinetic model fitting.
+struct KineticModel_Voxel_Fitting_Opts {
+    // The edge length of the square voxel tiles that are distributed to worker threads.
+    int64_t tile_size = 16;
+
+    // The number of worker threads. Zero means use all available cores.
+    int64_t concurrency = 0;
+
+    // Whether to seed each fit with the parameters of an already-converged neighbouring voxel.
+    bool warm_start = true;
+
+    // Contrast enhancement prior to this time is assumed to be baseline, and is subtracted from each time course.
+    double ContrastInjectionLeadTime = 0.0;
+};
+
+// Summary of a voxel-wise fitting pass.
+struct KineticModel_Voxel_Fitting_Summary {
+    int64_t fit_count = 0;
+    int64_t failure_count = 0;
+
+    // Extrema of the fitted k1A, tauA, k1V, tauV, and k2 parameters, for windowing purposes.
+    std::array<Stats::Running_MinMax<float>, 5> minmax;
+};
+
+
+// Fit a kinetic model to the time course of every voxel bounded by the mask.
+//
+// Voxels are partitioned into square tiles, which are distributed across a thread pool. Within a tile voxels are
+// visited in row-major order so the time course images are accessed with good locality, and each fit is seeded with
+// the parameters of the left (or, failing that, upper) neighbour when it converged successfully. Warm-starting only
+// ever uses neighbours in the same tile, so the results do not depend on thread scheduling.
+//
+// Each thread reuses a single copy of the model state and time course buffer, so only the time course samples are
+// replaced between fits. The time-ordering of the images is also determined once rather than for each voxel.
+//
+// The provided 'fit' functor must accept and return the model state by value; it is invoked concurrently and so must
+// be reentrant. The 'on_fitted' functor, if provided, is invoked after each fit (concurrently) and can be used for
+// reporting.
+template <class P, class F_fit>
+KineticModel_Voxel_Fitting_Summary
+KineticModel_Fit_Voxels( const planar_image<float,double> &first_img,
+                         const std::list<planar_image_collection<float,double>::images_list_it_t> &selected_img_its,
+                         const roi_mask &mask,
+                         const P &model_template,
+                         F_fit fit,
+                         const std::function<void(int64_t, int64_t, int64_t, const P &)> &on_fitted,
+                         const std::array<std::reference_wrapper<planar_image<float,double>>, 5> &out_imgs,
+                         const KineticModel_Voxel_Fitting_Opts &opts ){
+
+    KineticModel_Voxel_Fitting_Summary summary;
+
+    if( (mask.rows != first_img.rows)
+    ||  (mask.columns != first_img.columns) ){
+        throw std::invalid_argument("Mask and image dimensions differ. Cannot continue.");
+    }
+    const int64_t tile_size = std::max<int64_t>(1, opts.tile_size);
+    const int64_t channels = first_img.channels;
+
+    // Order the time course images once, since the ordering is the same for every voxel.
+    std::vector<std::pair<double, const planar_image<float,double> *>> time_ordered;
+    for(const auto &img_it : selected_img_its){
+        const auto dt = img_it->GetMetadataValueAs<double>("dt");
+        if(!dt) throw std::runtime_error("Image is missing time metadata. Cannot continue.");
+        if( (img_it->rows != first_img.rows)
+        ||  (img_it->columns != first_img.columns)
+        ||  (img_it->channels != first_img.channels) ){
+            throw std::invalid_argument("Time course images have inconsistent dimensions. Cannot continue.");
+        }
+        time_ordered.emplace_back( dt.value(), std::addressof(*img_it) );
+    }
+    std::stable_sort( std::begin(time_ordered), std::end(time_ordered),
+                      [](const auto &l, const auto &r){ return (l.first < r.first); } );
+    if(time_ordered.empty()) return summary;
+
+    // The number of leading samples that precede contrast injection.
+    const auto N_preinject = static_cast<int64_t>( std::count_if( std::begin(time_ordered), std::end(time_ordered),
+                                  [&](const auto &p){ return (p.first <= opts.ContrastInjectionLeadTime); } ) );
+
+    // Identify the tiles that contain at least one bounded voxel.
+    std::vector<std::pair<int64_t, int64_t>> tiles; // (row, col) of the top-left voxel.
+    for(int64_t tr = 0; tr < mask.rows; tr += tile_size){
+        for(int64_t tc = 0; tc < mask.columns; tc += tile_size){
+            bool occupied = false;
+            for(int64_t r = tr; (r < std::min(tr + tile_size, mask.rows)) && !occupied; ++r){
+                for(int64_t i = mask.row_offsets[r]; i < mask.row_offsets[r+1]; ++i){
+                    if( (mask.runs[i].first < (tc + tile_size))
+                    &&  (tc < mask.runs[i].second) ){
+                        occupied = true;
+                        break;
+                    }
+                }
+            }
+            if(occupied) tiles.emplace_back(tr, tc);
+        }
+    }
+
+    const double expected_count = static_cast<double>(mask.count() * channels);
+    int64_t completed_count = 0;
+    const auto start_t = boost::posix_time::microsec_clock::local_time();
+    std::mutex saver;
+
+    // Per-thread state, reused for every tile processed by the thread.
+    struct thread_state_t {
+        P state;
+        std::shared_ptr<samples_1D<double>> time_course;
+        std::vector<std::array<double, 5>> converged; // Parameters fitted within the current tile.
+    };
+    auto make_thread_state = [&](){
+        auto ts = std::make_unique<thread_state_t>();
+        ts->state = model_template;
+        ts->time_course = std::make_shared<samples_1D<double>>();
+        ts->time_course->uncertainties_known_to_be_independent_and_random = true;
+        ts->converged.resize(static_cast<size_t>(tile_size * tile_size * channels));
+        return ts;
+    };
+    std::mutex thread_state_mutex;
+    std::map<std::thread::id, std::unique_ptr<thread_state_t>> thread_states;
+
+    const auto process_tile = [&](int64_t tr, int64_t tc){
+        thread_state_t *ts = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(thread_state_mutex);
+            auto &ts_ptr = thread_states[std::this_thread::get_id()];
+            if(ts_ptr == nullptr) ts_ptr = make_thread_state();
+            ts = ts_ptr.get();
+        }
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+        std::fill( std::begin(ts->converged), std::end(ts->converged), std::array<double, 5>{{ nan, nan, nan, nan, nan }} );
+        const auto converged_index = [&](int64_t r, int64_t c, int64_t chan) -> size_t {
+            return static_cast<size_t>( ((r - tr) * tile_size + (c - tc)) * channels + chan );
+        };
+
+        int64_t l_fit_count = 0;
+        int64_t l_failure_count = 0;
+        std::array<float, 5> l_min;
+        std::array<float, 5> l_max;
+        l_min.fill( std::numeric_limits<float>::infinity() );
+        l_max.fill( -std::numeric_limits<float>::infinity() );
+
+        for(int64_t r = tr; r < std::min(tr + tile_size, mask.rows); ++r){
+            for(int64_t i = mask.row_offsets[r]; i < mask.row_offsets[r+1]; ++i){
+                const int64_t c_begin = std::max(tc, mask.runs[i].first);
+                const int64_t c_end = std::min(tc + tile_size, mask.runs[i].second);
+                for(int64_t c = c_begin; c < c_end; ++c){
+                    for(int64_t chan = 0; chan < channels; ++chan){
+
+                        // Harvest the time course, replacing the samples from the previous fit.
+                        auto &samples = ts->time_course->samples;
+                        samples.resize(time_ordered.size());
+                        double preinject_sum = 0.0;
+                        for(size_t n = 0; n < time_ordered.size(); ++n){
+                            const auto val = static_cast<double>(time_ordered[n].second->value(r, c, chan));
+                            samples[n] = {{ time_ordered[n].first, 0.0, val, 0.0 }};
+                            if(static_cast<int64_t>(n) < N_preinject) preinject_sum += val;
+                        }
+
+                        // Correct any unaccounted-for contrast enhancement shifts by subtracting the mean from the
+                        // pre-injection period. (If we don't do this, the optimizer goes crazy because the model has
+                        // to be zero at t=0.)
+                        if(0 < N_preinject){
+                            const auto themean = preinject_sum / static_cast<double>(N_preinject);
+                            for(auto &s : samples) s[2] -= themean;
+                        }else{
+                            const auto preinject = ts->time_course->Select_Those_Within_Inc(-1E99, opts.ContrastInjectionLeadTime);
+                            const auto themean = preinject.Mean_y()[0];
+                            *(ts->time_course) = ts->time_course->Sum_With(0.0-themean);
+                        }
+
+                        // Reset the fitted parameters, seeding them from a converged neighbour if possible.
+                        auto &state = ts->state;
+                        state.FittingPerformed = false;
+                        state.FittingSuccess = false;
+                        state.cROI = ts->time_course;
+                        state.RSS  = nan;
+                        state.k1A  = nan;
+                        state.tauA = nan;
+                        state.k1V  = nan;
+                        state.tauV = nan;
+                        state.k2   = nan;
+
+                        if(opts.warm_start){
+                            const std::array<double, 5> *seed = nullptr;
+                            if( (tc < c) && std::isfinite(ts->converged[converged_index(r, c-1, chan)][0]) ){
+                                seed = &(ts->converged[converged_index(r, c-1, chan)]);
+                            }else if( (tr < r) && std::isfinite(ts->converged[converged_index(r-1, c, chan)][0]) ){
+                                seed = &(ts->converged[converged_index(r-1, c, chan)]);
+                            }
+                            if(seed != nullptr){
+                                state.k1A  = (*seed)[0];
+                                state.tauA = (*seed)[1];
+                                state.k1V  = (*seed)[2];
+                                state.tauV = (*seed)[3];
+                                state.k2   = (*seed)[4];
+                            }
+                        }
+
+                        const P after_state = fit(state);
+
+                        ++l_fit_count;
+                        if(!after_state.FittingSuccess) ++l_failure_count;
+
+                        const std::array<double, 5> params = {{ after_state.k1A, after_state.tauA,
+                                                                after_state.k1V, after_state.tauV,
+                                                                after_state.k2 }};
+                        const bool all_finite = std::all_of( std::begin(params), std::end(params),
+                                                             [](double x){ return std::isfinite(x); } );
+                        if(after_state.FittingSuccess && all_finite){
+                            ts->converged[converged_index(r, c, chan)] = params;
+                        }
+
+                        if(on_fitted) on_fitted(r, c, chan, after_state);
+
+                        // Update pixel values. Each voxel belongs to exactly one tile, so no locking is needed.
+                        for(size_t p = 0; p < params.size(); ++p){
+                            const auto p_f = static_cast<float>(params[p]);
+                            out_imgs[p].get().reference(r, c, chan) = p_f;
+                            if(p_f < l_min[p]) l_min[p] = p_f;
+                            if(l_max[p] < p_f) l_max[p] = p_f;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Merge the results and report progress.
+        std::lock_guard<std::mutex> lock(saver);
+        summary.fit_count += l_fit_count;
+        summary.failure_count += l_failure_count;
+        for(size_t p = 0; p < l_min.size(); ++p){
+            if(l_min[p] <= l_max[p]){
+                summary.minmax[p].Digest(l_min[p]);
+                summary.minmax[p].Digest(l_max[p]);
+            }
+        }
+
+        completed_count += l_fit_count;
+        if(0 < completed_count){
+            const auto actual_count = static_cast<double>(completed_count);
+            const auto current_t = boost::posix_time::microsec_clock::local_time();
+            const auto elapsed_dt = (current_t - start_t).total_milliseconds();
+            const auto expected_dt = static_cast<int64_t>( static_cast<double>(elapsed_dt) * (expected_count / actual_count) );
+            const boost::posix_time::ptime predicted_dt( start_t + boost::posix_time::milliseconds(expected_dt) );
+            YLOGINFO("Progress: "
+                << actual_count << "/" << expected_count << " = "
+                << static_cast<double>(static_cast<int64_t>(1000.0 * actual_count / expected_count)) / 10.0
+                << "%. Expected finish time: " << predicted_dt);
+        }
+        return;
+    };
+
+    std::exception_ptr first_error;
+    {
+        const auto concurrency = (0 < opts.concurrency) ? opts.concurrency
+                               : std::max<int64_t>(1, static_cast<int64_t>(std::thread::hardware_concurrency()));
+        work_queue<std::function<void(void)>> wq(static_cast<unsigned int>(concurrency));
+        for(const auto &t : tiles){
+            wq.submit_task([&, t]() -> void {
+                try{
+                    process_tile(t.first, t.second);
+                }catch(const std::exception &){
+                    std::lock_guard<std::mutex> lock(saver);
+                    if(!first_error) first_error = std::current_exception();
+                }
+            });
+        }
+    } // Complete tasks and terminate thread pool.
+
+    // Propagate worker failures to the caller.
+    if(first_error) std::rethrow_exception(first_error);
+
+    return summary;
+}
+
+#endif // DCMA_USE_GNU_GSL
@@ -0,0 +1,296 @@
+//Liver_Kinetic_Voxel_Fitting_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the voxel-wise kinetic model fitting engine defined in
+// Liver_Kinetic_Voxel_Fitting.h.
+// Tests are separated into their own file because the liver kinetic functors are linked into
+// shared libraries which don't include doctest implementation.
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "../../Contour_Rasterization.h"
+#include "Liver_Kinetic_Voxel_Fitting.h"
+
+
+namespace {
+
+// A stand-in for the liver kinetic model state. Only the members used by the fitting engine are provided.
+//
+// The model is I(t) = k1A * (1 - exp(-tauA * t)). The remaining parameters are derived from the fitted ones so that
+// every output parameter map is exercised.
+struct test_model_state {
+    bool FittingPerformed = false;
+    bool FittingSuccess = false;
+    std::shared_ptr<samples_1D<double>> cROI;
+    double RSS  = std::numeric_limits<double>::quiet_NaN();
+    double k1A  = std::numeric_limits<double>::quiet_NaN();
+    double tauA = std::numeric_limits<double>::quiet_NaN();
+    double k1V  = std::numeric_limits<double>::quiet_NaN();
+    double tauV = std::numeric_limits<double>::quiet_NaN();
+    double k2   = std::numeric_limits<double>::quiet_NaN();
+
+    // Used to confirm that a fit was seeded. Not part of the real model states.
+    bool seeded = false;
+};
+
+} // namespace
+
+static const int64_t test_rows = 14;
+static const int64_t test_cols = 14;
+static const int64_t test_time_points = 16;
+
+static
+double
+true_k1A(int64_t row, int64_t col){
+    return 50.0 + 2.0 * static_cast<double>(row) + 1.0 * static_cast<double>(col);
+}
+
+static
+double
+true_tauA(int64_t row, int64_t col){
+    return 0.15 + 0.010 * static_cast<double>(row) + 0.005 * static_cast<double>(col);
+}
+
+static
+planar_image<float,double>
+make_test_image(){
+    planar_image<float,double> img;
+    img.init_buffer(test_rows, test_cols, 1);
+    img.init_spatial(1.0, 1.0, 1.0, vec3<double>(0.0, 0.0, 0.0), vec3<double>(0.0, 0.0, 0.0));
+    img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+    img.fill_pixels(0.0f);
+    return img;
+}
+
+// A time course in which every voxel follows the model with distinct parameters. The images are deliberately
+// inserted out of temporal order.
+static
+planar_image_collection<float,double>
+make_test_time_course(){
+    planar_image_collection<float,double> imgcoll;
+    for(int64_t n = 0; n < test_time_points; ++n){
+        const auto i = (n * 5) % test_time_points;
+        const auto t = static_cast<double>(i);
+        imgcoll.images.emplace_back( make_test_image() );
+        auto &img = imgcoll.images.back();
+        img.metadata["dt"] = std::to_string(t);
+        for(int64_t r = 0; r < test_rows; ++r){
+            for(int64_t c = 0; c < test_cols; ++c){
+                const auto I = true_k1A(r, c) * (1.0 - std::exp(-true_tauA(r, c) * t));
+                img.reference(r, c, 0) = static_cast<float>(I);
+            }
+        }
+    }
+    return imgcoll;
+}
+
+static
+contour_of_points<double>
+make_test_square(double x_min, double x_max, double y_min, double y_max){
+    contour_of_points<double> c;
+    c.closed = true;
+    c.points.emplace_back( vec3<double>(x_min, y_min, 0.0) );
+    c.points.emplace_back( vec3<double>(x_max, y_min, 0.0) );
+    c.points.emplace_back( vec3<double>(x_max, y_max, 0.0) );
+    c.points.emplace_back( vec3<double>(x_min, y_max, 0.0) );
+    return c;
+}
+
+// Gauss-Newton least-squares fit of the test model. The fit iterates to convergence from the provided parameters (or
+// a fixed default guess when they are not finite) so the converged result does not depend on the starting point.
+static
+test_model_state
+fit_test_model(test_model_state state){
+    state.seeded = std::isfinite(state.k1A) && std::isfinite(state.tauA);
+    double A = state.seeded ? state.k1A  : 40.0;
+    double k = state.seeded ? state.tauA : 0.2;
+
+    const auto &samples = state.cROI->samples;
+    bool converged = false;
+    for(int64_t iter = 0; (iter < 200) && !converged; ++iter){
+        double JTJ_AA = 0.0, JTJ_Ak = 0.0, JTJ_kk = 0.0;
+        double JTr_A = 0.0, JTr_k = 0.0;
+        for(const auto &s : samples){
+            const auto t = s[0];
+            const auto e = std::exp(-k * t);
+            const auto r = s[2] - A * (1.0 - e);
+            const auto dA = 1.0 - e;
+            const auto dk = A * t * e;
+            JTJ_AA += dA * dA;
+            JTJ_Ak += dA * dk;
+            JTJ_kk += dk * dk;
+            JTr_A += dA * r;
+            JTr_k += dk * r;
+        }
+        const auto det = JTJ_AA * JTJ_kk - JTJ_Ak * JTJ_Ak;
+        if(!(0.0 < std::abs(det))) break;
+        const auto step_A = ( JTJ_kk * JTr_A - JTJ_Ak * JTr_k) / det;
+        const auto step_k = (-JTJ_Ak * JTr_A + JTJ_AA * JTr_k) / det;
+        A += step_A;
+        k += step_k;
+        converged = (std::abs(step_A) < 1E-12 * std::abs(A)) && (std::abs(step_k) < 1E-12 * std::abs(k));
+    }
+
+    double RSS = 0.0;
+    for(const auto &s : samples){
+        const auto r = s[2] - A * (1.0 - std::exp(-k * s[0]));
+        RSS += r * r;
+    }
+
+    state.FittingPerformed = true;
+    state.FittingSuccess = converged;
+    state.RSS  = RSS;
+    state.k1A  = A;
+    state.tauA = k;
+    state.k1V  = A * k;
+    state.tauV = 1.0 / k;
+    state.k2   = A - k;
+    return state;
+}
+
+struct test_fit_results {
+    KineticModel_Voxel_Fitting_Summary summary;
+    std::array<planar_image<float,double>, 5> maps;
+    std::map<std::pair<int64_t, int64_t>, int64_t> visits;
+    int64_t seeded_count = 0;
+};
+
+static
+test_fit_results
+fit_test_volume(planar_image_collection<float,double> &imgcoll,
+                const roi_mask &mask,
+                const KineticModel_Voxel_Fitting_Opts &opts){
+    std::list<planar_image_collection<float,double>::images_list_it_t> selected_img_its;
+    for(auto it = std::begin(imgcoll.images); it != std::end(imgcoll.images); ++it){
+        selected_img_its.push_back(it);
+    }
+
+    test_fit_results res;
+    for(auto &m : res.maps){
+        m = make_test_image();
+        m.fill_pixels(-1.0f);
+    }
+
+    std::mutex m;
+    const auto on_fitted = [&](int64_t row, int64_t col, int64_t, const test_model_state &after_state) -> void {
+        std::lock_guard<std::mutex> lock(m);
+        res.visits[{row, col}] += 1;
+        if(after_state.seeded) ++res.seeded_count;
+    };
+
+    res.summary = KineticModel_Fit_Voxels<test_model_state>(
+                      imgcoll.images.front(), selected_img_its, mask, test_model_state(),
+                      fit_test_model, on_fitted,
+                      {{ res.maps[0], res.maps[1], res.maps[2], res.maps[3], res.maps[4] }},
+                      opts );
+    return res;
+}
+
+
+TEST_CASE("KineticModel_Fit_Voxels matches per-voxel fits"){
+    auto imgcoll = make_test_time_course();
+
+    // Two overlapping squares in the same ROI. Voxels bounded by both are fitted once, as a union.
+    contour_collection<double> cc;
+    cc.contours.emplace_back( make_test_square(1.5, 8.5, 1.5, 7.5) );
+    cc.contours.emplace_back( make_test_square(5.5, 12.5, 4.5, 11.5) );
+    std::list<std::reference_wrapper<contour_collection<double>>> ccsl = { std::ref(cc) };
+    const auto mask = Rasterize_Contours( imgcoll.images.front(), ccsl,
+                                          Mutate_Voxels_Opts::Inclusivity::Centre,
+                                          Mutate_Voxels_Opts::ContourOverlap::Ignore );
+
+    int64_t separate_count = 0;
+    for(auto &c : cc.contours){
+        contour_collection<double> cc_single;
+        cc_single.contours.emplace_back(c);
+        std::list<std::reference_wrapper<contour_collection<double>>> ccsl_single = { std::ref(cc_single) };
+        separate_count += Rasterize_Contours( imgcoll.images.front(), ccsl_single,
+                                              Mutate_Voxels_Opts::Inclusivity::Centre,
+                                              Mutate_Voxels_Opts::ContourOverlap::Ignore ).count();
+    }
+    REQUIRE(0 < mask.count());
+    REQUIRE(mask.count() < separate_count);
+
+    // Reference: every voxel is its own tile, fitted serially from the default initial guess.
+    KineticModel_Voxel_Fitting_Opts ref_opts;
+    ref_opts.tile_size = 1;
+    ref_opts.concurrency = 1;
+    ref_opts.warm_start = false;
+    const auto ref = fit_test_volume(imgcoll, mask, ref_opts);
+
+    REQUIRE(ref.summary.fit_count == mask.count());
+    REQUIRE(ref.summary.failure_count == 0);
+    REQUIRE(ref.seeded_count == 0);
+    REQUIRE(static_cast<int64_t>(ref.visits.size()) == mask.count());
+    for(const auto &v : ref.visits) REQUIRE(v.second == 1);
+
+    for(int64_t r = 0; r < test_rows; ++r){
+        for(int64_t c = 0; c < test_cols; ++c){
+            if(!mask.contains(r, c)){
+                REQUIRE(ref.maps[0].value(r, c, 0) == -1.0f);
+                continue;
+            }
+            REQUIRE(ref.maps[0].value(r, c, 0) == doctest::Approx(true_k1A(r, c)).epsilon(1E-4));
+            REQUIRE(ref.maps[1].value(r, c, 0) == doctest::Approx(true_tauA(r, c)).epsilon(1E-4));
+        }
+    }
+
+    for(const int64_t tile_size : { 3, 4, 16 }){
+        for(const bool warm_start : { false, true }){
+            CAPTURE(tile_size);
+            CAPTURE(warm_start);
+
+            KineticModel_Voxel_Fitting_Opts opts;
+            opts.tile_size = tile_size;
+            opts.concurrency = 4;
+            opts.warm_start = warm_start;
+            const auto res = fit_test_volume(imgcoll, mask, opts);
+
+            REQUIRE(res.summary.fit_count == ref.summary.fit_count);
+            REQUIRE(res.summary.failure_count == ref.summary.failure_count);
+            REQUIRE(res.visits == ref.visits);
+            if(warm_start){
+                REQUIRE(0 < res.seeded_count);
+            }else{
+                REQUIRE(res.seeded_count == 0);
+            }
+
+            for(size_t p = 0; p < res.maps.size(); ++p){
+                for(int64_t r = 0; r < test_rows; ++r){
+                    for(int64_t c = 0; c < test_cols; ++c){
+                        REQUIRE(res.maps[p].value(r, c, 0) == doctest::Approx(ref.maps[p].value(r, c, 0)).epsilon(1E-5));
+                    }
+                }
+                REQUIRE(res.summary.minmax[p].Current_Min() == doctest::Approx(ref.summary.minmax[p].Current_Min()).epsilon(1E-5));
+                REQUIRE(res.summary.minmax[p].Current_Max() == doctest::Approx(ref.summary.minmax[p].Current_Max()).epsilon(1E-5));
+            }
+        }
+    }
+}
+
+TEST_CASE("KineticModel_Fit_Voxels rejects mismatched masks"){
+    auto imgcoll = make_test_time_course();
+    roi_mask mask;
+    mask.rows = test_rows + 1;
+    mask.columns = test_cols;
+    mask.row_offsets.assign(static_cast<size_t>(mask.rows + 1), 0);
+
+    KineticModel_Voxel_Fitting_Opts opts;
+    REQUIRE_THROWS_AS(fit_test_volume(imgcoll, mask, opts), std::invalid_argument);
+}
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "../../Contour_Rasterization.h"
 #include "../ConvenienceRoutines.h"
 #include "YgorFilesDirs.h"   //Needed for Does_File_Exist_And_Can_Be_Read(...), etc..
 #include "YgorImages.h"
@@ -49,48 +50,15 @@ bool PixelHistogramAnalysis(planar_image_collection<float,double>::images_list_i
         }
     }
 
-    //Loop over the rois, rows, columns, channels, and finally any selected images (if applicable).
-    const auto row_unit   = local_img_it->row_unit;
-    const auto col_unit   = local_img_it->col_unit;
-    const auto ortho_unit = local_img_it->ortho_unit();
-
     uint32_t roi_numb = 0;
     for(const auto &roi : rois){
         ++roi_numb;
-/*
-        //Construct a bounding box to reduce computational demand of checking every voxel.
-        auto BBox = roi->Bounding_Box_Along(row_unit, 1.0);
-        auto BBoxBestFitPlane = BBox.Least_Squares_Best_Fit_Plane(vec3<double>(0.0,0.0,1.0));
-        auto BBoxProjectedContour = BBox.Project_Onto_Plane_Orthogonally(BBoxBestFitPlane);
-        const bool BBoxAlreadyProjected = true;
-*/
-
-        //Prepare a contour for fast is-point-within-the-polygon checking.
-        auto BestFitPlane = roi->Least_Squares_Best_Fit_Plane(ortho_unit);
-        auto ProjectedContour = roi->Project_Onto_Plane_Orthogonally(BestFitPlane);
-//auto BestFitPlane = roi.Least_Squares_Best_Fit_Plane(orthog_unit);
-//auto ProjectedContour = roi.Project_Onto_Plane_Orthogonally(BestFitPlane);
-        const bool AlreadyProjected = true;
-
+        //Voxels bounded by the contour are found via scanline rasterization rather than per-voxel point-in-polygon tests.
+        const auto mask = Rasterize_Contour_Cached(*local_img_it, *roi);
 
         for(auto row = 0; row < local_img_it->rows; ++row){
             for(auto col = 0; col < local_img_it->columns; ++col){
-                //Figure out the spatial location of the present voxel.
-                const auto point = local_img_it->position(row,col);
-
-/*
-                //Check if within the bounding box. It will generally be cheaper than the full contour (4 points vs. ? points).
-                auto BBoxProjectedPoint = BBoxBestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                if(!BBoxProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BBoxBestFitPlane,
-                                                                                    BBoxProjectedPoint,
-                                                                                    BBoxAlreadyProjected)) continue;
-*/
-
-                //If we're in the bounding box, perform a more detailed check to see if we are in the ROI.
-                auto ProjectedPoint = BestFitPlane.Project_Onto_Plane_Orthogonally(point);
-                if(!ProjectedContour.Is_Point_In_Polygon_Projected_Orthogonally(BestFitPlane,
-                                                                                ProjectedPoint,
-                                                                                AlreadyProjected)) continue;
+                if(!mask->contains(row, col)) continue;
                 for(auto chan = 0; chan < local_img_it->channels; ++chan){
                     const auto val = static_cast<double>(local_img_it->value(row, col, chan));
                     pixel_vals[roi_numb].push_back(val);
@@ -9,6 +9,39 @@ namespace py dcma.rpc
 // --------------------------------------------------------------------
 typedef map<string, string> metadata_t;
 
+// --------------------------------------------------------------------
+// Bulk numerical arrays.
+// --------------------------------------------------------------------
+// Protocol revision 1 encodes every array as a list of individually-tagged elements. Revision 2 adds the optional
+// '*_blob' fields below, which carry pixel buffers, vertex arrays, and index arrays as packed binary blobs. When a blob
+// is provided the corresponding legacy list is left empty. Peers negotiate the revision via GetProtocolInfo(), and a
+// peer that does not implement it (or does not request revision 2) is only ever sent revision 1 payloads.
+enum bulk_dtype {
+    FLOAT32 = 1,
+    FLOAT64 = 2,
+    UINT32 = 3,
+    UINT64 = 4,
+}
+enum bulk_endianness {
+    LITTLE = 1,
+    BIG = 2,
+}
+enum bulk_compression {
+    UNCOMPRESSED = 0,
+    ZLIB = 1,
+}
+struct bulk_array {
+    1: required bulk_dtype dtype;
+    2: required bulk_endianness endianness;
+    3: required bulk_compression compression;
+    4: required i64 count; // Number of elements (not bytes) after decompression.
+    5: required binary payload;
+}
+struct bulk_encoding {
+    1: required i64 protocol_version = 1;
+    2: required bulk_compression compression = bulk_compression.UNCOMPRESSED;
+}
+
 struct vec3_double {
     1: required double x;
     2: required double y;
@@ -18,6 +51,7 @@ struct contour_of_points_double {
     1: required list<vec3_double> points;
     2: required bool closed;
     3: required metadata_t metadata;
+    4: optional bulk_array points_blob; // FLOAT64, packed (x,y,z) triplets.
 }
 struct contour_collection_double {
     1: required list<contour_of_points_double> contours;
@@ -27,6 +61,9 @@ struct point_set_double {
     2: required list<vec3_double> normals;
     3: required list<i64> colours; // NOTE: should be uint32 with 8-bit packed RGBA.
     4: required metadata_t metadata;
+    5: optional bulk_array points_blob;  // FLOAT64, packed (x,y,z) triplets.
+    6: optional bulk_array normals_blob; // FLOAT64, packed (x,y,z) triplets.
+    7: optional bulk_array colours_blob; // UINT32.
 }
 struct sample4_double { // NOTE: wrapper for std::array<double,4>.
     1: required double x;
@@ -46,6 +83,11 @@ struct fv_surface_mesh_double_int64 { // NOTE: uint64_t not supported, so using
     4: required list<list<i64>> faces; // NOTE: should be uint64_t rather than int64_t.
     5: required list<list<i64>> involved_faces; // NOTE: should be uint64_t rather than int64_t.
     6: required metadata_t metadata;
+    7: optional bulk_array vertices_blob;       // FLOAT64, packed (x,y,z) triplets.
+    8: optional bulk_array vertex_normals_blob; // FLOAT64, packed (x,y,z) triplets.
+    9: optional bulk_array vertex_colours_blob; // UINT32.
+    10: optional bulk_array face_offsets_blob;  // UINT64, N_faces + 1 offsets into face_indices_blob.
+    11: optional bulk_array face_indices_blob;  // UINT64, concatenated vertex indices. involved_faces is not sent.
 }
 
 // --------------------------------------------------------------------
@@ -64,6 +106,7 @@ struct planar_image_double_double {
     10: required vec3_double row_unit;
     11: required vec3_double col_unit;
     12: required metadata_t metadata;
+    13: optional bulk_array data_blob; // FLOAT32, same layout as data.
 }
 struct planar_image_collection_double_double {
     1: required list<planar_image_double_double> images; // NOTE: for <float,double>, but float not available.
@@ -187,6 +230,7 @@ struct KnownOperation {
 
 struct LoadFilesQuery {
     1: required string server_filename;
+    2: optional bulk_encoding response_encoding; // Only honoured for the first query.
 }
 struct LoadFilesResponse {
     1: required bool success;
@@ -198,6 +242,7 @@ struct ExecuteScriptQuery{
     1: required Drover drover;
     2: required metadata_t invocation_metadata;
     3: required string filename_lex;
+    4: optional bulk_encoding response_encoding;
 }
 struct ExecuteScriptResponse {
     1: required bool success;
@@ -207,6 +252,15 @@ struct ExecuteScriptResponse {
 }
 
 
+struct ProtocolQuery {
+    1: required i64 client_version; // Highest protocol revision the client supports.
+}
+struct ProtocolInfo {
+    1: required i64 server_version; // Highest protocol revision the server supports.
+    2: required list<bulk_compression> compressions;
+}
+
+
 service Receiver {
     // NOTE: these methods are currently implemented in the RPCReceive operation.
     //
@@ -218,6 +272,11 @@ service Receiver {
         1: OperationsQuery query
     );
 
+    // Report the protocol revision and bulk array compression schemes supported by this server.
+    // Servers predating protocol revision 2 reply with an 'unknown method' exception.
+    ProtocolInfo
+    GetProtocolInfo(1: ProtocolQuery query);
+
     // Level 2 interface: Drover interchange.
     //
     // Load files into a Drover RPC-proxy object.
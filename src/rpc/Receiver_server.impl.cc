@@ -67,6 +67,10 @@ class ReceiverHandler : virtual public ReceiverIf {
         }
     }
 
+    void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) {
+        _return = Get_Protocol_Info();
+    }
+
     void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) {
         YLOGINFO("LoadFiles implementation goes here");
     }
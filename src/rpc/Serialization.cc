@@ -18,6 +18,18 @@
 #include <variant>
 #include <any>
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 
 #include "YgorMisc.h"
 #include "YgorLog.h"
@@ -114,6 +126,176 @@ void Deserialize( const double &in, float &out ){
     out = static_cast<float>(in);
 }
 
+// --------------------------------------------------------------------
+// Bulk numerical arrays.
+// --------------------------------------------------------------------
+// Payloads are always written little-endian. Readers accept either byte order and any of the supported dtypes, converting
+// to the requested native type as needed.
+static bool host_is_little_endian(){
+    const uint16_t x = 1;
+    uint8_t b = 0;
+    std::memcpy(&b, &x, 1);
+    return (b == 1);
+}
+
+template <class T> dcma::rpc::bulk_dtype::type bulk_dtype_of();
+template <> dcma::rpc::bulk_dtype::type bulk_dtype_of<float>(){    return dcma::rpc::bulk_dtype::FLOAT32; }
+template <> dcma::rpc::bulk_dtype::type bulk_dtype_of<double>(){   return dcma::rpc::bulk_dtype::FLOAT64; }
+template <> dcma::rpc::bulk_dtype::type bulk_dtype_of<uint32_t>(){ return dcma::rpc::bulk_dtype::UINT32; }
+template <> dcma::rpc::bulk_dtype::type bulk_dtype_of<uint64_t>(){ return dcma::rpc::bulk_dtype::UINT64; }
+
+static int64_t bulk_dtype_size(dcma::rpc::bulk_dtype::type dtype){
+    switch(dtype){
+        case dcma::rpc::bulk_dtype::FLOAT32: return sizeof(float);
+        case dcma::rpc::bulk_dtype::FLOAT64: return sizeof(double);
+        case dcma::rpc::bulk_dtype::UINT32:  return sizeof(uint32_t);
+        case dcma::rpc::bulk_dtype::UINT64:  return sizeof(uint64_t);
+    }
+    throw std::runtime_error("Bulk array dtype not recognized");
+}
+
+static void bulk_compress(std::string &payload){
+    std::string out;
+    {
+        boost::iostreams::filtering_ostream ofs;
+        ofs.push(boost::iostreams::zlib_compressor(boost::iostreams::zlib::best_speed));
+        ofs.push(boost::iostreams::back_inserter(out));
+        ofs.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    } // Flush.
+    payload.swap(out);
+}
+
+static std::string bulk_decompress(const std::string &payload, int64_t expected_size){
+    // The element count is supplied by the peer, so the reservation is bounded by the maximum zlib compression ratio.
+    std::string out;
+    out.reserve(static_cast<size_t>(std::min<int64_t>(expected_size, 1032 * static_cast<int64_t>(payload.size()) + 64)));
+    boost::iostreams::filtering_istream ifs;
+    ifs.push(boost::iostreams::zlib_decompressor());
+    ifs.push(boost::iostreams::array_source(payload.data(), payload.size()));
+    boost::iostreams::copy(ifs, boost::iostreams::back_inserter(out));
+    return out;
+}
+
+// Packs a contiguous array of native elements.
+template <class T>
+static void encode_bulk( const T *in, int64_t N, const dcma::rpc::bulk_encoding &enc, dcma::rpc::bulk_array &out ){
+    out.dtype = bulk_dtype_of<T>();
+    out.endianness = dcma::rpc::bulk_endianness::LITTLE;
+    out.compression = dcma::rpc::bulk_compression::UNCOMPRESSED;
+    out.count = N;
+    out.payload.resize(N * sizeof(T));
+    if(0 < N) std::memcpy(&out.payload[0], in, N * sizeof(T));
+    if(!host_is_little_endian()){
+        for(int64_t i = 0; i < N; ++i){
+            auto *b = &out.payload[i * sizeof(T)];
+            std::reverse(b, b + sizeof(T));
+        }
+    }
+    if(enc.compression == dcma::rpc::bulk_compression::ZLIB){
+        bulk_compress(out.payload);
+        out.compression = dcma::rpc::bulk_compression::ZLIB;
+    }
+}
+
+template <class S, class T>
+static void convert_bulk( const char *in, int64_t N, bool swap, T *out ){
+    if(!swap && std::is_same<S,T>::value){
+        if(0 < N) std::memcpy(out, in, N * sizeof(T));
+        return;
+    }
+    for(int64_t i = 0; i < N; ++i){
+        char b[sizeof(S)];
+        std::memcpy(b, in + i * sizeof(S), sizeof(S));
+        if(swap) std::reverse(b, b + sizeof(S));
+        S s;
+        std::memcpy(&s, b, sizeof(S));
+        out[i] = static_cast<T>(s);
+    }
+}
+
+// Unpacks into a vector of native elements, converting the dtype and byte order if necessary.
+template <class T>
+static std::vector<T> decode_bulk( const dcma::rpc::bulk_array &in ){
+    const int64_t elem_size = bulk_dtype_size(in.dtype);
+    if( (in.count < 0)
+    ||  ((std::numeric_limits<int64_t>::max() / elem_size) < in.count) ){
+        throw std::runtime_error("Bulk array element count is invalid");
+    }
+    const int64_t N = in.count;
+    const int64_t expected_size = N * elem_size;
+
+    std::string decompressed;
+    const std::string *raw = &in.payload;
+    if(in.compression == dcma::rpc::bulk_compression::ZLIB){
+        decompressed = bulk_decompress(in.payload, expected_size);
+        raw = &decompressed;
+    }else if(in.compression != dcma::rpc::bulk_compression::UNCOMPRESSED){
+        throw std::runtime_error("Bulk array compression not recognized");
+    }
+    if(static_cast<int64_t>(raw->size()) != expected_size){
+        throw std::runtime_error("Bulk array payload size does not match element count");
+    }
+
+    const bool swap = ((in.endianness == dcma::rpc::bulk_endianness::LITTLE) != host_is_little_endian());
+    std::vector<T> out(N);
+    switch(in.dtype){
+        case dcma::rpc::bulk_dtype::FLOAT32: convert_bulk<float>(raw->data(), N, swap, out.data()); break;
+        case dcma::rpc::bulk_dtype::FLOAT64: convert_bulk<double>(raw->data(), N, swap, out.data()); break;
+        case dcma::rpc::bulk_dtype::UINT32:  convert_bulk<uint32_t>(raw->data(), N, swap, out.data()); break;
+        case dcma::rpc::bulk_dtype::UINT64:  convert_bulk<uint64_t>(raw->data(), N, swap, out.data()); break;
+    }
+    return out;
+}
+
+// Packs a range of vec3 as (x,y,z) triplets.
+template <class It>
+static void encode_bulk_vec3( It begin, It end, const dcma::rpc::bulk_encoding &enc, dcma::rpc::bulk_array &out ){
+    std::vector<double> shtl;
+    shtl.reserve(3 * std::distance(begin, end));
+    for(auto it = begin; it != end; ++it){
+        shtl.push_back(it->x);
+        shtl.push_back(it->y);
+        shtl.push_back(it->z);
+    }
+    encode_bulk(shtl.data(), static_cast<int64_t>(shtl.size()), enc, out);
+}
+
+template <class C>
+static void decode_bulk_vec3( const dcma::rpc::bulk_array &in, C &out ){
+    const auto shtl = decode_bulk<double>(in);
+    if((shtl.size() % 3) != 0){
+        throw std::runtime_error("Bulk vec3 array does not contain a whole number of triplets");
+    }
+    for(size_t i = 0; i < shtl.size(); i += 3){
+        out.emplace_back(shtl[i], shtl[i+1], shtl[i+2]);
+    }
+}
+
+static bool use_bulk_arrays( const dcma::rpc::bulk_encoding &enc ){
+    return (2 <= enc.protocol_version);
+}
+
+dcma::rpc::bulk_encoding Negotiate_Bulk_Encoding( int64_t peer_version,
+                                                  const std::vector<dcma::rpc::bulk_compression::type> &peer_compressions,
+                                                  dcma::rpc::bulk_compression::type preferred ){
+    dcma::rpc::bulk_encoding enc; // Defaults to protocol revision 1.
+    enc.protocol_version = std::min<int64_t>(peer_version, dcma_rpc_protocol_version);
+    if(enc.protocol_version < 1) enc.protocol_version = 1;
+    if( use_bulk_arrays(enc)
+    &&  (std::find(std::begin(peer_compressions), std::end(peer_compressions), preferred) != std::end(peer_compressions)) ){
+        enc.compression = preferred;
+    }
+    return enc;
+}
+
+dcma::rpc::ProtocolInfo Get_Protocol_Info(){
+    dcma::rpc::ProtocolInfo out;
+    out.server_version = dcma_rpc_protocol_version;
+    out.compressions = { dcma::rpc::bulk_compression::UNCOMPRESSED,
+                         dcma::rpc::bulk_compression::ZLIB };
+    return out;
+}
+
 // --------------------------------------------------------------------
 // Ygor classes -- YgorMath.h.
 // --------------------------------------------------------------------
@@ -145,7 +327,7 @@ void Deserialize( const dcma::rpc::vec3_double &in, vec3<double> &out ){
 }
 
 // contour_of_points<double>
-void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_points_double &out ){
+void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_points_double &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     // Note: due to padding, the following may not be able to detect if the contour_of_points class has members added.
     static_assert( (   sizeof(decltype(in.points))
@@ -154,31 +336,43 @@ void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_point
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.points, out.points);
+    if(use_bulk_arrays(enc)){
+        out.__isset.points_blob = true;
+        encode_bulk_vec3(std::begin(in.points), std::end(in.points), enc, out.points_blob);
+    }else{
+        SERIALIZE_CONTAINER(in.points, out.points);
+    }
     Serialize(in.closed, out.closed);
     Serialize(in.metadata, out.metadata);
 }
 void Deserialize( const dcma::rpc::contour_of_points_double &in, contour_of_points<double> &out ){
-    DESERIALIZE_CONTAINER(in.points, out.points);
+    if(in.__isset.points_blob){
+        decode_bulk_vec3(in.points_blob, out.points);
+    }else{
+        DESERIALIZE_CONTAINER(in.points, out.points);
+    }
     Deserialize(in.closed, out.closed);
     Deserialize(in.metadata, out.metadata);
 }
 
 // contour_collection<double>
-void Serialize( const contour_collection<double> &in, dcma::rpc::contour_collection_double &out ){
+void Serialize( const contour_collection<double> &in, dcma::rpc::contour_collection_double &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( sizeof(decltype(in.contours)) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.contours, out.contours);
+    for(const auto& c : in.contours){
+        out.contours.emplace_back();
+        Serialize(c, out.contours.back(), enc);
+    }
 }
 void Deserialize( const dcma::rpc::contour_collection_double &in, contour_collection<double> &out ){
     DESERIALIZE_CONTAINER(in.contours, out.contours);
 }
 
 // point_set<double>
-void Serialize( const point_set<double> &in, dcma::rpc::point_set_double &out ){
+void Serialize( const point_set<double> &in, dcma::rpc::point_set_double &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.points))
                      + sizeof(decltype(in.normals))
@@ -187,15 +381,36 @@ void Serialize( const point_set<double> &in, dcma::rpc::point_set_double &out ){
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.points, out.points);
-    SERIALIZE_CONTAINER(in.normals, out.normals);
-    SERIALIZE_CONTAINER(in.colours, out.colours);
+    if(use_bulk_arrays(enc)){
+        out.__isset.points_blob = true;
+        out.__isset.normals_blob = true;
+        out.__isset.colours_blob = true;
+        encode_bulk_vec3(std::begin(in.points), std::end(in.points), enc, out.points_blob);
+        encode_bulk_vec3(std::begin(in.normals), std::end(in.normals), enc, out.normals_blob);
+        encode_bulk(in.colours.data(), static_cast<int64_t>(in.colours.size()), enc, out.colours_blob);
+    }else{
+        SERIALIZE_CONTAINER(in.points, out.points);
+        SERIALIZE_CONTAINER(in.normals, out.normals);
+        SERIALIZE_CONTAINER(in.colours, out.colours);
+    }
     Serialize(in.metadata, out.metadata);
 }
 void Deserialize( const dcma::rpc::point_set_double &in, point_set<double> &out ){
-    DESERIALIZE_CONTAINER(in.points, out.points);
-    DESERIALIZE_CONTAINER(in.normals, out.normals);
-    DESERIALIZE_CONTAINER(in.colours, out.colours);
+    if(in.__isset.points_blob){
+        decode_bulk_vec3(in.points_blob, out.points);
+    }else{
+        DESERIALIZE_CONTAINER(in.points, out.points);
+    }
+    if(in.__isset.normals_blob){
+        decode_bulk_vec3(in.normals_blob, out.normals);
+    }else{
+        DESERIALIZE_CONTAINER(in.normals, out.normals);
+    }
+    if(in.__isset.colours_blob){
+        out.colours = decode_bulk<uint32_t>(in.colours_blob);
+    }else{
+        DESERIALIZE_CONTAINER(in.colours, out.colours);
+    }
     Deserialize(in.metadata, out.metadata);
 }
 
@@ -234,7 +449,7 @@ void Deserialize( const dcma::rpc::samples_1D_double &in, samples_1D<double> &ou
 }
 
 // fv_surface_mesh<double,uint64_t>
-void Serialize( const fv_surface_mesh<double,uint64_t> &in, dcma::rpc::fv_surface_mesh_double_int64 &out ){
+void Serialize( const fv_surface_mesh<double,uint64_t> &in, dcma::rpc::fv_surface_mesh_double_int64 &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.vertices))
                      + sizeof(decltype(in.vertex_normals))
@@ -245,30 +460,86 @@ void Serialize( const fv_surface_mesh<double,uint64_t> &in, dcma::rpc::fv_surfac
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.vertices, out.vertices);
-    SERIALIZE_CONTAINER(in.vertex_normals, out.vertex_normals);
-    SERIALIZE_CONTAINER(in.vertex_colours, out.vertex_colours);
-    for(const auto& f : in.faces){
-        out.faces.emplace_back();
-        SERIALIZE_CONTAINER(f, out.faces.back());
-    }
-    for(const auto& f : in.involved_faces){
-        out.involved_faces.emplace_back();
-        SERIALIZE_CONTAINER(f, out.involved_faces.back());
+    if(use_bulk_arrays(enc)){
+        out.__isset.vertices_blob = true;
+        out.__isset.vertex_normals_blob = true;
+        out.__isset.vertex_colours_blob = true;
+        out.__isset.face_offsets_blob = true;
+        out.__isset.face_indices_blob = true;
+        encode_bulk_vec3(std::begin(in.vertices), std::end(in.vertices), enc, out.vertices_blob);
+        encode_bulk_vec3(std::begin(in.vertex_normals), std::end(in.vertex_normals), enc, out.vertex_normals_blob);
+        encode_bulk(in.vertex_colours.data(), static_cast<int64_t>(in.vertex_colours.size()), enc, out.vertex_colours_blob);
+
+        // Faces are flattened into a compressed-row layout. The involved_faces index is derived data, so it is omitted
+        // and regenerated by the receiver.
+        std::vector<uint64_t> offsets;
+        std::vector<uint64_t> indices;
+        offsets.reserve(in.faces.size() + 1);
+        offsets.push_back(0);
+        for(const auto& f : in.faces){
+            indices.insert(std::end(indices), std::begin(f), std::end(f));
+            offsets.push_back(indices.size());
+        }
+        encode_bulk(offsets.data(), static_cast<int64_t>(offsets.size()), enc, out.face_offsets_blob);
+        encode_bulk(indices.data(), static_cast<int64_t>(indices.size()), enc, out.face_indices_blob);
+    }else{
+        SERIALIZE_CONTAINER(in.vertices, out.vertices);
+        SERIALIZE_CONTAINER(in.vertex_normals, out.vertex_normals);
+        SERIALIZE_CONTAINER(in.vertex_colours, out.vertex_colours);
+        for(const auto& f : in.faces){
+            out.faces.emplace_back();
+            SERIALIZE_CONTAINER(f, out.faces.back());
+        }
+        for(const auto& f : in.involved_faces){
+            out.involved_faces.emplace_back();
+            SERIALIZE_CONTAINER(f, out.involved_faces.back());
+        }
     }
     Serialize(in.metadata, out.metadata);
 }
 void Deserialize( const dcma::rpc::fv_surface_mesh_double_int64 &in, fv_surface_mesh<double,uint64_t> &out ){
-    DESERIALIZE_CONTAINER(in.vertices, out.vertices);
-    DESERIALIZE_CONTAINER(in.vertex_normals, out.vertex_normals);
-    DESERIALIZE_CONTAINER(in.vertex_colours, out.vertex_colours);
-    for(const auto& f : in.faces){
-        out.faces.emplace_back();
-        DESERIALIZE_CONTAINER(f, out.faces.back());
+    if(in.__isset.vertices_blob){
+        decode_bulk_vec3(in.vertices_blob, out.vertices);
+    }else{
+        DESERIALIZE_CONTAINER(in.vertices, out.vertices);
     }
-    for(const auto& f : in.involved_faces){
-        out.involved_faces.emplace_back();
-        DESERIALIZE_CONTAINER(f, out.involved_faces.back());
+    if(in.__isset.vertex_normals_blob){
+        decode_bulk_vec3(in.vertex_normals_blob, out.vertex_normals);
+    }else{
+        DESERIALIZE_CONTAINER(in.vertex_normals, out.vertex_normals);
+    }
+    if(in.__isset.vertex_colours_blob){
+        out.vertex_colours = decode_bulk<uint32_t>(in.vertex_colours_blob);
+    }else{
+        DESERIALIZE_CONTAINER(in.vertex_colours, out.vertex_colours);
+    }
+    if(in.__isset.face_offsets_blob || in.__isset.face_indices_blob){
+        if(!in.__isset.face_offsets_blob || !in.__isset.face_indices_blob){
+            throw std::runtime_error("Incomplete bulk face arrays");
+        }
+        const auto offsets = decode_bulk<uint64_t>(in.face_offsets_blob);
+        const auto indices = decode_bulk<uint64_t>(in.face_indices_blob);
+        if( offsets.empty()
+        ||  (offsets.front() != 0)
+        ||  (offsets.back() != indices.size())
+        ||  !std::is_sorted(std::begin(offsets), std::end(offsets)) ){
+            throw std::runtime_error("Bulk face offsets are invalid");
+        }
+        out.faces.reserve(out.faces.size() + offsets.size() - 1);
+        for(size_t i = 1; i < offsets.size(); ++i){
+            out.faces.emplace_back( std::next(std::begin(indices), offsets[i-1]),
+                                    std::next(std::begin(indices), offsets[i]) );
+        }
+        out.recreate_involved_face_index();
+    }else{
+        for(const auto& f : in.faces){
+            out.faces.emplace_back();
+            DESERIALIZE_CONTAINER(f, out.faces.back());
+        }
+        for(const auto& f : in.involved_faces){
+            out.involved_faces.emplace_back();
+            DESERIALIZE_CONTAINER(f, out.involved_faces.back());
+        }
     }
     Deserialize(in.metadata, out.metadata);
 }
@@ -277,7 +548,7 @@ void Deserialize( const dcma::rpc::fv_surface_mesh_double_int64 &in, fv_surface_
 // Ygor classes -- YgorImages.h.
 // --------------------------------------------------------------------
 // planar_image<float,double>
-void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_double_double &out ){
+void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_double_double &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.data))
                      + sizeof(decltype(in.rows))
@@ -294,7 +565,12 @@ void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_do
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.data, out.data);
+    if(use_bulk_arrays(enc)){
+        out.__isset.data_blob = true;
+        encode_bulk(in.data.data(), static_cast<int64_t>(in.data.size()), enc, out.data_blob);
+    }else{
+        SERIALIZE_CONTAINER(in.data, out.data);
+    }
     Serialize(in.rows, out.rows);
     Serialize(in.columns, out.columns);
     Serialize(in.channels, out.channels);
@@ -308,7 +584,11 @@ void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_do
     Serialize(in.metadata, out.metadata);
 }
 void Deserialize( const dcma::rpc::planar_image_double_double &in, planar_image<float,double> &out ){
-    DESERIALIZE_CONTAINER(in.data, out.data);
+    if(in.__isset.data_blob){
+        out.data = decode_bulk<float>(in.data_blob);
+    }else{
+        DESERIALIZE_CONTAINER(in.data, out.data);
+    }
     Deserialize(in.rows, out.rows);
     Deserialize(in.columns, out.columns);
     Deserialize(in.channels, out.channels);
@@ -323,13 +603,16 @@ void Deserialize( const dcma::rpc::planar_image_double_double &in, planar_image<
 }
 
 // planar_image_collection<float,double>
-void Serialize( const planar_image_collection<float,double> &in, dcma::rpc::planar_image_collection_double_double &out ){
+void Serialize( const planar_image_collection<float,double> &in, dcma::rpc::planar_image_collection_double_double &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( sizeof(decltype(in.images)) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.images, out.images);
+    for(const auto& img : in.images){
+        out.images.emplace_back();
+        Serialize(img, out.images.back(), enc);
+    }
 }
 void Deserialize( const dcma::rpc::planar_image_collection_double_double &in, planar_image_collection<float,double> &out ){
     DESERIALIZE_CONTAINER(in.images, out.images);
@@ -352,17 +635,17 @@ void Serialize( const tables::table2 &in, dcma::rpc::table2 &out ){
                      + sizeof(decltype(tables::cell<std::string>().val)) ) == sizeof(tables::cell<std::string>),
                    "Class layout is unexpected. Were members added?" );
     // tables::table2
-    static_assert( (   sizeof(decltype(in.data))
+    static_assert( (   sizeof(decltype(in.columns))
                      + sizeof(decltype(in.metadata)) ) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    for(const auto &c : in.data){
+    in.visit_cells([&](int64_t r, int64_t c, const tables::cell_value_t &v){
         out.data.emplace_back();
-        Serialize(c.get_row(), out.data.back().row);
-        Serialize(c.get_col(), out.data.back().col);
-        Serialize(c.val,       out.data.back().val);
-    }
+        Serialize(r, out.data.back().row);
+        Serialize(c, out.data.back().col);
+        Serialize(tables::to_string(v), out.data.back().val);
+    });
     Serialize(in.metadata, out.metadata);
 }
 void Deserialize( const dcma::rpc::table2 &in, tables::table2 &out ){
@@ -384,27 +667,30 @@ void Deserialize( const dcma::rpc::table2 &in, tables::table2 &out ){
 // DICOMautomaton classes -- Structs.h.
 // --------------------------------------------------------------------
 // Contour_Data
-void Serialize( const Contour_Data &in, dcma::rpc::Contour_Data &out ){
+void Serialize( const Contour_Data &in, dcma::rpc::Contour_Data &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( sizeof(decltype(in.ccs)) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    SERIALIZE_CONTAINER(in.ccs, out.ccs);
+    for(const auto& cc : in.ccs){
+        out.ccs.emplace_back();
+        Serialize(cc, out.ccs.back(), enc);
+    }
 }
 void Deserialize( const dcma::rpc::Contour_Data &in, Contour_Data &out ){
     DESERIALIZE_CONTAINER(in.ccs, out.ccs);
 }
 
 // Image_Array
-void Serialize( const Image_Array &in, dcma::rpc::Image_Array &out ){
+void Serialize( const Image_Array &in, dcma::rpc::Image_Array &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.imagecoll))
                      + sizeof(decltype(in.filename)) ) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    Serialize(in.imagecoll, out.imagecoll);
+    Serialize(in.imagecoll, out.imagecoll, enc);
     Serialize(in.filename, out.filename);
 }
 void Deserialize( const dcma::rpc::Image_Array &in, Image_Array &out ){
@@ -413,20 +699,20 @@ void Deserialize( const dcma::rpc::Image_Array &in, Image_Array &out ){
 }
 
 // Point_Cloud
-void Serialize( const Point_Cloud &in, dcma::rpc::Point_Cloud &out ){
+void Serialize( const Point_Cloud &in, dcma::rpc::Point_Cloud &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( sizeof(decltype(in.pset)) == sizeof(decltype(in)),
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    Serialize(in.pset, out.pset);
+    Serialize(in.pset, out.pset, enc);
 }
 void Deserialize( const dcma::rpc::Point_Cloud &in, Point_Cloud &out ){
     Deserialize(in.pset, out.pset);
 }
 
 // Surface_Mesh
-void Serialize( const Surface_Mesh &in, dcma::rpc::Surface_Mesh &out ){
+void Serialize( const Surface_Mesh &in, dcma::rpc::Surface_Mesh &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.meshes))
                      + sizeof(decltype(in.vertex_attributes))
@@ -434,7 +720,7 @@ void Serialize( const Surface_Mesh &in, dcma::rpc::Surface_Mesh &out ){
                    "Class layout is unexpected. Were members added?" );
 #endif // defined(PERFORM_CLASS_LAYOUT_CHECKS)
 
-    Serialize(in.meshes, out.meshes);
+    Serialize(in.meshes, out.meshes, enc);
 
     // TODO.
     if(!in.vertex_attributes.empty()){
@@ -599,7 +885,7 @@ void Deserialize( const dcma::rpc::Sparse_Table &in, Sparse_Table &out ){
 }
 
 // Drover
-void Serialize( const Drover &in, dcma::rpc::Drover &out ){
+void Serialize( const Drover &in, dcma::rpc::Drover &out, const dcma::rpc::bulk_encoding &enc ){
 #if defined(PERFORM_CLASS_LAYOUT_CHECKS)
     static_assert( (   sizeof(decltype(in.contour_data))
                      + sizeof(decltype(in.image_data))
@@ -616,7 +902,7 @@ void Serialize( const Drover &in, dcma::rpc::Drover &out ){
     if(in.Has_Contour_Data() && !in.contour_data->ccs.empty()){
         out.__set_contour_data( {} ); // Field is optional, so ensure it is marked as set.
         out.contour_data.emplace_back();
-        Serialize(*(in.contour_data), out.contour_data.back());
+        Serialize(*(in.contour_data), out.contour_data.back(), enc);
     }
     //
     // For a list-of-pointers contour_data member.
@@ -633,7 +919,7 @@ void Serialize( const Drover &in, dcma::rpc::Drover &out ){
         std::vector<dcma::rpc::Image_Array> shtl;
         for(const auto& ptr : in.image_data){
             shtl.emplace_back();
-            Serialize(*ptr, shtl.back());
+            Serialize(*ptr, shtl.back(), enc);
         }
         out.__set_image_data( shtl ); // Field is optional, so ensure it is marked as set.
     }
@@ -642,7 +928,7 @@ void Serialize( const Drover &in, dcma::rpc::Drover &out ){
         std::vector<dcma::rpc::Point_Cloud> shtl;
         for(const auto& ptr : in.point_data){
             shtl.emplace_back();
-            Serialize(*ptr, shtl.back());
+            Serialize(*ptr, shtl.back(), enc);
         }
         out.__set_point_data( shtl ); // Field is optional, so ensure it is marked as set.
     }
@@ -651,7 +937,7 @@ void Serialize( const Drover &in, dcma::rpc::Drover &out ){
         std::vector<dcma::rpc::Surface_Mesh> shtl;
         for(const auto& ptr : in.smesh_data){
             shtl.emplace_back();
-            Serialize(*ptr, shtl.back());
+            Serialize(*ptr, shtl.back(), enc);
         }
         out.__set_smesh_data( shtl ); // Field is optional, so ensure it is marked as set.
     }
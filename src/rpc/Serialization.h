@@ -37,6 +37,18 @@
 
 #include "Serialization.h"
 
+// The highest protocol revision implemented here. Revision 2 carries bulk arrays as packed binary blobs.
+constexpr int64_t dcma_rpc_protocol_version = 2;
+
+// Selects the bulk array encoding to use when sending to a peer with the given capabilities.
+// Peers that do not support revision 2 are always sent revision 1 (legacy) payloads.
+dcma::rpc::bulk_encoding Negotiate_Bulk_Encoding( int64_t peer_version,
+                                                  const std::vector<dcma::rpc::bulk_compression::type> &peer_compressions,
+                                                  dcma::rpc::bulk_compression::type preferred );
+
+// Describes the protocol revision and compression schemes supported here.
+dcma::rpc::ProtocolInfo Get_Protocol_Info();
+
 // Helper functions.
 void Serialize( const bool &in, bool &out );
 void Deserialize( const bool &in, bool &out );
@@ -68,16 +80,13 @@ void Deserialize( const dcma::rpc::metadata_t &in, metadata_map_t &out );
 void Serialize( const vec3<double> &in, dcma::rpc::vec3_double &out ); 
 void Deserialize( const dcma::rpc::vec3_double &in, vec3<double> &out ); 
 
-void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_points_double &out );
-void Deserialize( const dcma::rpc::contour_of_points_double &in, contour_of_points<double> &out );
-
-void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_points_double &out );
+void Serialize( const contour_of_points<double> &in, dcma::rpc::contour_of_points_double &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::contour_of_points_double &in, contour_of_points<double> &out );
 
-void Serialize( const contour_collection<double> &in, dcma::rpc::contour_collection_double &out );
+void Serialize( const contour_collection<double> &in, dcma::rpc::contour_collection_double &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::contour_collection_double &in, contour_collection<double> &out );
 
-void Serialize( const point_set<double> &in, dcma::rpc::point_set_double &out );
+void Serialize( const point_set<double> &in, dcma::rpc::point_set_double &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::point_set_double &in, point_set<double> &out );
 
 void Serialize( const std::array<double,4> &in, dcma::rpc::sample4_double &out );
@@ -86,16 +95,16 @@ void Deserialize( const dcma::rpc::sample4_double &in, std::array<double,4> &out
 void Serialize( const samples_1D<double> &in, dcma::rpc::samples_1D_double &out );
 void Deserialize( const dcma::rpc::samples_1D_double &in, samples_1D<double> &out );
 
-void Serialize( const fv_surface_mesh<double,uint64_t> &in, dcma::rpc::fv_surface_mesh_double_int64 &out );
+void Serialize( const fv_surface_mesh<double,uint64_t> &in, dcma::rpc::fv_surface_mesh_double_int64 &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::fv_surface_mesh_double_int64 &in, fv_surface_mesh<double,uint64_t> &out );
 
 // --------------------------------------------------------------------
 // Ygor classes -- YgorImages.h.
 // --------------------------------------------------------------------
-void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_double_double &out );
+void Serialize( const planar_image<float,double> &in, dcma::rpc::planar_image_double_double &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::planar_image_double_double &in, planar_image<float,double> &out );
 
-void Serialize( const planar_image_collection<float,double> &in, dcma::rpc::planar_image_collection_double_double &out );
+void Serialize( const planar_image_collection<float,double> &in, dcma::rpc::planar_image_collection_double_double &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::planar_image_collection_double_double &in, planar_image_collection<float,double> &out );
 
 // --------------------------------------------------------------------
@@ -107,16 +116,16 @@ void Deserialize( const dcma::rpc::table2 &in, tables::table2 &out );
 // --------------------------------------------------------------------
 // DICOMautomaton classes -- Structs.h.
 // --------------------------------------------------------------------
-void Serialize( const Contour_Data &in, dcma::rpc::Contour_Data &out );
+void Serialize( const Contour_Data &in, dcma::rpc::Contour_Data &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::Contour_Data &in, Contour_Data &out );
 
-void Serialize( const Image_Array &in, dcma::rpc::Image_Array &out );
+void Serialize( const Image_Array &in, dcma::rpc::Image_Array &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::Image_Array &in, Image_Array &out );
 
-void Serialize( const Point_Cloud &in, dcma::rpc::Point_Cloud &out );
+void Serialize( const Point_Cloud &in, dcma::rpc::Point_Cloud &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::Point_Cloud &in, Point_Cloud &out );
 
-void Serialize( const Surface_Mesh &in, dcma::rpc::Surface_Mesh &out );
+void Serialize( const Surface_Mesh &in, dcma::rpc::Surface_Mesh &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::Surface_Mesh &in, Surface_Mesh &out );
 
 void Serialize( const Static_Machine_State &in, dcma::rpc::Static_Machine_State &out );
@@ -137,7 +146,7 @@ void Deserialize( const dcma::rpc::Transform3 &in, Transform3 &out );
 void Serialize( const Sparse_Table &in, dcma::rpc::Sparse_Table &out );
 void Deserialize( const dcma::rpc::Sparse_Table &in, Sparse_Table &out );
 
-void Serialize( const Drover &in, dcma::rpc::Drover &out ); 
+void Serialize( const Drover &in, dcma::rpc::Drover &out, const dcma::rpc::bulk_encoding &enc = dcma::rpc::bulk_encoding() );
 void Deserialize( const dcma::rpc::Drover &in, Drover &out ); 
 
 // --------------------------------------------------------------------
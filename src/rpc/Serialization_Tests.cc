@@ -0,0 +1,323 @@
+//Serialization_Tests.cc - A part of DICOMautomaton 2026. Written by hal clark.
+//
+// This file contains unit tests for the protocol revision 2 bulk array encoding implemented in Serialization.cc.
+// Tests are separated into their own file because Thrift_objs is linked into shared libraries which don't include
+// doctest implementation.
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../doctest20251212/doctest.h"
+
+#include "YgorImages.h"
+#include "YgorMath.h"
+
+#include "gen-cpp/DCMA_types.h"
+
+#include "Serialization.h"
+
+
+static
+dcma::rpc::bulk_encoding
+make_encoding(dcma::rpc::bulk_compression::type compression = dcma::rpc::bulk_compression::UNCOMPRESSED){
+    dcma::rpc::bulk_encoding enc;
+    enc.protocol_version = 2;
+    enc.compression = compression;
+    return enc;
+}
+
+static
+point_set<double>
+make_test_point_set(int64_t N){
+    point_set<double> ps;
+    for(int64_t i = 0; i < N; ++i){
+        const auto x = static_cast<double>(i);
+        ps.points.emplace_back(x, -2.0 * x, 0.125 * x);
+        ps.normals.emplace_back(0.0, 0.0, 1.0);
+        ps.colours.emplace_back(0xFF000000U + static_cast<uint32_t>(i));
+    }
+    ps.metadata["Tag"] = "test";
+    return ps;
+}
+
+static
+fv_surface_mesh<double, uint64_t>
+make_test_mesh(){
+    fv_surface_mesh<double, uint64_t> mesh;
+    mesh.vertices = { vec3<double>(0.0, 0.0, 0.0),
+                      vec3<double>(1.0, 0.0, 0.0),
+                      vec3<double>(1.0, 1.0, 0.0),
+                      vec3<double>(0.0, 1.0, 0.0),
+                      vec3<double>(0.5, 0.5, 1.0) };
+    // Faces of mixed arity exercise the offset array.
+    mesh.faces = { { 0, 1, 2, 3 },
+                   { 0, 1, 4 },
+                   { 1, 2, 4 },
+                   { 2, 3, 4 },
+                   { 3, 0, 4 } };
+    mesh.recreate_involved_face_index();
+    return mesh;
+}
+
+// Packs values with the given byte order, independent of the host byte order.
+template <class T, class U>
+static
+std::string
+pack(const std::vector<T> &vals, bool big_endian){
+    static_assert(sizeof(T) == sizeof(U), "Integer type must match the element size");
+    std::string out;
+    for(const auto &v : vals){
+        U u;
+        std::memcpy(&u, &v, sizeof(T));
+        for(size_t i = 0; i < sizeof(U); ++i){
+            const auto shift = 8 * (big_endian ? (sizeof(U) - 1 - i) : i);
+            out.push_back(static_cast<char>((u >> shift) & 0xFF));
+        }
+    }
+    return out;
+}
+
+static
+dcma::rpc::bulk_array
+make_blob(dcma::rpc::bulk_dtype::type dtype, dcma::rpc::bulk_endianness::type endianness, int64_t count, const std::string &payload){
+    dcma::rpc::bulk_array out;
+    out.dtype = dtype;
+    out.endianness = endianness;
+    out.compression = dcma::rpc::bulk_compression::UNCOMPRESSED;
+    out.count = count;
+    out.payload = payload;
+    return out;
+}
+
+
+TEST_CASE("bulk arrays round-trip each dtype"){
+    SUBCASE("FLOAT64 and UINT32 via point_set"){
+        const auto ps = make_test_point_set(10);
+        dcma::rpc::point_set_double rpc_ps;
+        Serialize(ps, rpc_ps, make_encoding());
+
+        REQUIRE(rpc_ps.__isset.points_blob);
+        REQUIRE(rpc_ps.__isset.colours_blob);
+        REQUIRE(rpc_ps.points.empty());
+        REQUIRE(rpc_ps.colours.empty());
+        REQUIRE(rpc_ps.points_blob.dtype == dcma::rpc::bulk_dtype::FLOAT64);
+        REQUIRE(rpc_ps.points_blob.count == 30);
+        REQUIRE(rpc_ps.colours_blob.dtype == dcma::rpc::bulk_dtype::UINT32);
+        REQUIRE(rpc_ps.colours_blob.count == 10);
+
+        point_set<double> out;
+        Deserialize(rpc_ps, out);
+        REQUIRE(out.points == ps.points);
+        REQUIRE(out.normals == ps.normals);
+        REQUIRE(out.colours == ps.colours);
+        REQUIRE(out.metadata == ps.metadata);
+    }
+
+    SUBCASE("FLOAT32 via planar_image"){
+        planar_image<float,double> img;
+        img.init_buffer(3, 4, 2);
+        img.init_spatial(1.0, 1.0, 1.0, vec3<double>(0.0, 0.0, 0.0), vec3<double>(0.0, 0.0, 0.0));
+        img.init_orientation(vec3<double>(0.0, 1.0, 0.0), vec3<double>(1.0, 0.0, 0.0));
+        for(size_t i = 0; i < img.data.size(); ++i){
+            img.data[i] = 0.5f * static_cast<float>(i) - 3.0f;
+        }
+
+        dcma::rpc::planar_image_double_double rpc_img;
+        Serialize(img, rpc_img, make_encoding());
+        REQUIRE(rpc_img.__isset.data_blob);
+        REQUIRE(rpc_img.data.empty());
+        REQUIRE(rpc_img.data_blob.dtype == dcma::rpc::bulk_dtype::FLOAT32);
+        REQUIRE(rpc_img.data_blob.count == static_cast<int64_t>(img.data.size()));
+
+        planar_image<float,double> out;
+        Deserialize(rpc_img, out);
+        REQUIRE(out.rows == img.rows);
+        REQUIRE(out.columns == img.columns);
+        REQUIRE(out.channels == img.channels);
+        REQUIRE(out.data == img.data);
+    }
+
+    SUBCASE("UINT64 via surface mesh faces"){
+        const auto mesh = make_test_mesh();
+        dcma::rpc::fv_surface_mesh_double_int64 rpc_mesh;
+        Serialize(mesh, rpc_mesh, make_encoding());
+        REQUIRE(rpc_mesh.faces.empty());
+        REQUIRE(rpc_mesh.involved_faces.empty());
+        REQUIRE(rpc_mesh.face_offsets_blob.dtype == dcma::rpc::bulk_dtype::UINT64);
+        REQUIRE(rpc_mesh.face_offsets_blob.count == 6);
+        REQUIRE(rpc_mesh.face_indices_blob.dtype == dcma::rpc::bulk_dtype::UINT64);
+        REQUIRE(rpc_mesh.face_indices_blob.count == 16);
+
+        fv_surface_mesh<double, uint64_t> out;
+        Deserialize(rpc_mesh, out);
+        REQUIRE(out.vertices == mesh.vertices);
+        REQUIRE(out.faces == mesh.faces);
+        REQUIRE(out.involved_faces == mesh.involved_faces);
+    }
+
+    SUBCASE("protocol revision 1 does not use bulk arrays"){
+        const auto ps = make_test_point_set(4);
+        dcma::rpc::point_set_double rpc_ps;
+        Serialize(ps, rpc_ps);
+        REQUIRE(!rpc_ps.__isset.points_blob);
+        REQUIRE(rpc_ps.points.size() == 4);
+
+        point_set<double> out;
+        Deserialize(rpc_ps, out);
+        REQUIRE(out.points == ps.points);
+        REQUIRE(out.colours == ps.colours);
+    }
+}
+
+TEST_CASE("bulk arrays in either byte order are decoded"){
+    const std::vector<double> xyz = { 1.5, -2.25, 3.0e10, -0.0, 7.0, 1.0e-300 };
+    const std::vector<uint32_t> colours = { 0x01020304U, 0xFFFFFFFEU };
+
+    for(const bool big_endian : { false, true }){
+        CAPTURE(big_endian);
+        const auto endianness = big_endian ? dcma::rpc::bulk_endianness::BIG
+                                           : dcma::rpc::bulk_endianness::LITTLE;
+        dcma::rpc::point_set_double rpc_ps;
+        rpc_ps.__isset.points_blob = true;
+        rpc_ps.__isset.colours_blob = true;
+        rpc_ps.points_blob = make_blob(dcma::rpc::bulk_dtype::FLOAT64, endianness, 6, pack<double, uint64_t>(xyz, big_endian));
+        rpc_ps.colours_blob = make_blob(dcma::rpc::bulk_dtype::UINT32, endianness, 2, pack<uint32_t, uint32_t>(colours, big_endian));
+
+        point_set<double> out;
+        Deserialize(rpc_ps, out);
+        REQUIRE(out.points.size() == 2);
+        REQUIRE(out.points[0] == vec3<double>(xyz[0], xyz[1], xyz[2]));
+        REQUIRE(out.points[1] == vec3<double>(xyz[3], xyz[4], xyz[5]));
+        REQUIRE(out.colours == colours);
+    }
+
+    // Blobs are converted to the native dtype, so a FLOAT32 sender is accepted where FLOAT64 is produced.
+    const std::vector<float> xyz_f = { 1.5f, -2.25f, 4.0f };
+    dcma::rpc::point_set_double rpc_ps;
+    rpc_ps.__isset.points_blob = true;
+    rpc_ps.points_blob = make_blob(dcma::rpc::bulk_dtype::FLOAT32, dcma::rpc::bulk_endianness::BIG, 3, pack<float, uint32_t>(xyz_f, true));
+    point_set<double> out;
+    Deserialize(rpc_ps, out);
+    REQUIRE(out.points.size() == 1);
+    REQUIRE(out.points[0] == vec3<double>(1.5, -2.25, 4.0));
+}
+
+TEST_CASE("ZLIB-compressed bulk arrays round-trip"){
+    const auto enc = make_encoding(dcma::rpc::bulk_compression::ZLIB);
+
+    // Normals are all identical, so they should compress well.
+    const auto ps = make_test_point_set(1000);
+    dcma::rpc::point_set_double rpc_ps;
+    Serialize(ps, rpc_ps, enc);
+    REQUIRE(rpc_ps.points_blob.compression == dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(rpc_ps.normals_blob.compression == dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(rpc_ps.colours_blob.compression == dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(rpc_ps.normals_blob.count == 3000);
+    REQUIRE(rpc_ps.normals_blob.payload.size() < 3000 * sizeof(double) / 10);
+
+    point_set<double> out_ps;
+    Deserialize(rpc_ps, out_ps);
+    REQUIRE(out_ps.points == ps.points);
+    REQUIRE(out_ps.normals == ps.normals);
+    REQUIRE(out_ps.colours == ps.colours);
+
+    const auto mesh = make_test_mesh();
+    dcma::rpc::fv_surface_mesh_double_int64 rpc_mesh;
+    Serialize(mesh, rpc_mesh, enc);
+    REQUIRE(rpc_mesh.face_indices_blob.compression == dcma::rpc::bulk_compression::ZLIB);
+    fv_surface_mesh<double, uint64_t> out_mesh;
+    Deserialize(rpc_mesh, out_mesh);
+    REQUIRE(out_mesh.vertices == mesh.vertices);
+    REQUIRE(out_mesh.faces == mesh.faces);
+
+    // Empty arrays are also valid.
+    const point_set<double> empty;
+    dcma::rpc::point_set_double rpc_empty;
+    Serialize(empty, rpc_empty, enc);
+    point_set<double> out_empty;
+    Deserialize(rpc_empty, out_empty);
+    REQUIRE(out_empty.points.empty());
+    REQUIRE(out_empty.colours.empty());
+}
+
+TEST_CASE("bulk arrays with a count that does not match the payload are rejected"){
+    SUBCASE("point_set"){
+        for(const auto compression : { dcma::rpc::bulk_compression::UNCOMPRESSED, dcma::rpc::bulk_compression::ZLIB }){
+            CAPTURE(compression);
+            dcma::rpc::point_set_double rpc_ps;
+            Serialize(make_test_point_set(5), rpc_ps, make_encoding(compression));
+
+            auto too_many = rpc_ps;
+            too_many.points_blob.count += 3;
+            point_set<double> out;
+            REQUIRE_THROWS_AS(Deserialize(too_many, out), std::runtime_error);
+
+            auto too_few = rpc_ps;
+            too_few.colours_blob.count -= 1;
+            REQUIRE_THROWS_AS(Deserialize(too_few, out), std::runtime_error);
+
+            auto negative = rpc_ps;
+            negative.normals_blob.count = -1;
+            REQUIRE_THROWS_AS(Deserialize(negative, out), std::runtime_error);
+
+            auto overflow = rpc_ps;
+            overflow.points_blob.count = std::numeric_limits<int64_t>::max();
+            REQUIRE_THROWS_AS(Deserialize(overflow, out), std::runtime_error);
+        }
+
+        // The payload must hold whole (x,y,z) triplets.
+        dcma::rpc::point_set_double rpc_ps;
+        rpc_ps.__isset.points_blob = true;
+        rpc_ps.points_blob = make_blob(dcma::rpc::bulk_dtype::FLOAT64, dcma::rpc::bulk_endianness::LITTLE, 2,
+                                       pack<double, uint64_t>({ 1.0, 2.0 }, false));
+        point_set<double> out;
+        REQUIRE_THROWS_AS(Deserialize(rpc_ps, out), std::runtime_error);
+    }
+
+    SUBCASE("surface mesh faces"){
+        dcma::rpc::fv_surface_mesh_double_int64 rpc_mesh;
+        Serialize(make_test_mesh(), rpc_mesh, make_encoding());
+
+        auto bad_indices = rpc_mesh;
+        bad_indices.face_indices_blob.count += 1;
+        fv_surface_mesh<double, uint64_t> out;
+        REQUIRE_THROWS_AS(Deserialize(bad_indices, out), std::runtime_error);
+
+        auto bad_offsets = rpc_mesh;
+        bad_offsets.face_offsets_blob.count -= 1;
+        REQUIRE_THROWS_AS(Deserialize(bad_offsets, out), std::runtime_error);
+
+        // Offsets that do not span the index array are inconsistent even when each blob is self-consistent.
+        auto short_offsets = rpc_mesh;
+        short_offsets.face_offsets_blob = make_blob(dcma::rpc::bulk_dtype::UINT64, dcma::rpc::bulk_endianness::LITTLE, 2,
+                                                    pack<uint64_t, uint64_t>({ 0, 4 }, false));
+        REQUIRE_THROWS_AS(Deserialize(short_offsets, out), std::runtime_error);
+
+        auto missing = rpc_mesh;
+        missing.__isset.face_indices_blob = false;
+        REQUIRE_THROWS_AS(Deserialize(missing, out), std::runtime_error);
+    }
+}
+
+TEST_CASE("Negotiate_Bulk_Encoding falls back to what the peer supports"){
+    const std::vector<dcma::rpc::bulk_compression::type> all = { dcma::rpc::bulk_compression::UNCOMPRESSED,
+                                                                 dcma::rpc::bulk_compression::ZLIB };
+    const std::vector<dcma::rpc::bulk_compression::type> none = { dcma::rpc::bulk_compression::UNCOMPRESSED };
+
+    auto enc = Negotiate_Bulk_Encoding(1, all, dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(enc.protocol_version == 1);
+    REQUIRE(enc.compression == dcma::rpc::bulk_compression::UNCOMPRESSED);
+
+    enc = Negotiate_Bulk_Encoding(2, none, dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(enc.protocol_version == 2);
+    REQUIRE(enc.compression == dcma::rpc::bulk_compression::UNCOMPRESSED);
+
+    enc = Negotiate_Bulk_Encoding(99, all, dcma::rpc::bulk_compression::ZLIB);
+    REQUIRE(enc.protocol_version == dcma_rpc_protocol_version);
+    REQUIRE(enc.compression == dcma::rpc::bulk_compression::ZLIB);
+}
+
@@ -13,6 +13,404 @@
 
 namespace dcma { namespace rpc {
 
+int _kbulk_dtypeValues[] = {
+  bulk_dtype::FLOAT32,
+  bulk_dtype::FLOAT64,
+  bulk_dtype::UINT32,
+  bulk_dtype::UINT64
+};
+const char* _kbulk_dtypeNames[] = {
+  "FLOAT32",
+  "FLOAT64",
+  "UINT32",
+  "UINT64"
+};
+const std::map<int, const char*> _bulk_dtype_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(4, _kbulk_dtypeValues, _kbulk_dtypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+
+std::ostream& operator<<(std::ostream& out, const bulk_dtype::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_dtype_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_dtype_VALUES_TO_NAMES.end()) {
+    out << it->second;
+  } else {
+    out << static_cast<int>(val);
+  }
+  return out;
+}
+
+std::string to_string(const bulk_dtype::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_dtype_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_dtype_VALUES_TO_NAMES.end()) {
+    return std::string(it->second);
+  } else {
+    return std::to_string(static_cast<int>(val));
+  }
+}
+
+int _kbulk_endiannessValues[] = {
+  bulk_endianness::LITTLE,
+  bulk_endianness::BIG
+};
+const char* _kbulk_endiannessNames[] = {
+  "LITTLE",
+  "BIG"
+};
+const std::map<int, const char*> _bulk_endianness_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(2, _kbulk_endiannessValues, _kbulk_endiannessNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+
+std::ostream& operator<<(std::ostream& out, const bulk_endianness::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_endianness_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_endianness_VALUES_TO_NAMES.end()) {
+    out << it->second;
+  } else {
+    out << static_cast<int>(val);
+  }
+  return out;
+}
+
+std::string to_string(const bulk_endianness::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_endianness_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_endianness_VALUES_TO_NAMES.end()) {
+    return std::string(it->second);
+  } else {
+    return std::to_string(static_cast<int>(val));
+  }
+}
+
+int _kbulk_compressionValues[] = {
+  bulk_compression::UNCOMPRESSED,
+  bulk_compression::ZLIB
+};
+const char* _kbulk_compressionNames[] = {
+  "UNCOMPRESSED",
+  "ZLIB"
+};
+const std::map<int, const char*> _bulk_compression_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(2, _kbulk_compressionValues, _kbulk_compressionNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+
+std::ostream& operator<<(std::ostream& out, const bulk_compression::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_compression_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_compression_VALUES_TO_NAMES.end()) {
+    out << it->second;
+  } else {
+    out << static_cast<int>(val);
+  }
+  return out;
+}
+
+std::string to_string(const bulk_compression::type& val) {
+  std::map<int, const char*>::const_iterator it = _bulk_compression_VALUES_TO_NAMES.find(val);
+  if (it != _bulk_compression_VALUES_TO_NAMES.end()) {
+    return std::string(it->second);
+  } else {
+    return std::to_string(static_cast<int>(val));
+  }
+}
+
+
+bulk_array::~bulk_array() noexcept {
+}
+
+
+void bulk_array::__set_dtype(const bulk_dtype::type val) {
+  this->dtype = val;
+}
+
+void bulk_array::__set_endianness(const bulk_endianness::type val) {
+  this->endianness = val;
+}
+
+void bulk_array::__set_compression(const bulk_compression::type val) {
+  this->compression = val;
+}
+
+void bulk_array::__set_count(const int64_t val) {
+  this->count = val;
+}
+
+void bulk_array::__set_payload(const std::string& val) {
+  this->payload = val;
+}
+std::ostream& operator<<(std::ostream& out, const bulk_array& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t bulk_array::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_dtype = false;
+  bool isset_endianness = false;
+  bool isset_compression = false;
+  bool isset_count = false;
+  bool isset_payload = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast0;
+          xfer += iprot->readI32(ecast0);
+          this->dtype = static_cast<bulk_dtype::type>(ecast0);
+          isset_dtype = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast1;
+          xfer += iprot->readI32(ecast1);
+          this->endianness = static_cast<bulk_endianness::type>(ecast1);
+          isset_endianness = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast2;
+          xfer += iprot->readI32(ecast2);
+          this->compression = static_cast<bulk_compression::type>(ecast2);
+          isset_compression = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->count);
+          isset_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->payload);
+          isset_payload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_dtype)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_endianness)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_compression)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_count)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_payload)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t bulk_array::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("bulk_array");
+
+  xfer += oprot->writeFieldBegin("dtype", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->dtype));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("endianness", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->endianness));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compression", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->compression));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("count", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->count);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("payload", ::apache::thrift::protocol::T_STRING, 5);
+  xfer += oprot->writeBinary(this->payload);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(bulk_array &a, bulk_array &b) {
+  using ::std::swap;
+  swap(a.dtype, b.dtype);
+  swap(a.endianness, b.endianness);
+  swap(a.compression, b.compression);
+  swap(a.count, b.count);
+  swap(a.payload, b.payload);
+}
+
+bulk_array::bulk_array(const bulk_array& other3) {
+  dtype = other3.dtype;
+  endianness = other3.endianness;
+  compression = other3.compression;
+  count = other3.count;
+  payload = other3.payload;
+}
+bulk_array& bulk_array::operator=(const bulk_array& other4) {
+  dtype = other4.dtype;
+  endianness = other4.endianness;
+  compression = other4.compression;
+  count = other4.count;
+  payload = other4.payload;
+  return *this;
+}
+void bulk_array::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "bulk_array(";
+  out << "dtype=" << to_string(dtype);
+  out << ", " << "endianness=" << to_string(endianness);
+  out << ", " << "compression=" << to_string(compression);
+  out << ", " << "count=" << to_string(count);
+  out << ", " << "payload=" << to_string(payload);
+  out << ")";
+}
+
+
+bulk_encoding::~bulk_encoding() noexcept {
+}
+
+
+void bulk_encoding::__set_protocol_version(const int64_t val) {
+  this->protocol_version = val;
+}
+
+void bulk_encoding::__set_compression(const bulk_compression::type val) {
+  this->compression = val;
+}
+std::ostream& operator<<(std::ostream& out, const bulk_encoding& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t bulk_encoding::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_protocol_version = false;
+  bool isset_compression = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->protocol_version);
+          isset_protocol_version = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast5;
+          xfer += iprot->readI32(ecast5);
+          this->compression = static_cast<bulk_compression::type>(ecast5);
+          isset_compression = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_protocol_version)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_compression)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t bulk_encoding::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("bulk_encoding");
+
+  xfer += oprot->writeFieldBegin("protocol_version", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->protocol_version);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compression", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->compression));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(bulk_encoding &a, bulk_encoding &b) {
+  using ::std::swap;
+  swap(a.protocol_version, b.protocol_version);
+  swap(a.compression, b.compression);
+}
+
+bulk_encoding::bulk_encoding(const bulk_encoding& other6) noexcept {
+  protocol_version = other6.protocol_version;
+  compression = other6.compression;
+}
+bulk_encoding& bulk_encoding::operator=(const bulk_encoding& other7) noexcept {
+  protocol_version = other7.protocol_version;
+  compression = other7.compression;
+  return *this;
+}
+void bulk_encoding::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "bulk_encoding(";
+  out << "protocol_version=" << to_string(protocol_version);
+  out << ", " << "compression=" << to_string(compression);
+  out << ")";
+}
+
 
 vec3_double::~vec3_double() noexcept {
 }
@@ -131,15 +529,15 @@ void swap(vec3_double &a, vec3_double &b) {
   swap(a.z, b.z);
 }
 
-vec3_double::vec3_double(const vec3_double& other0) noexcept {
-  x = other0.x;
-  y = other0.y;
-  z = other0.z;
+vec3_double::vec3_double(const vec3_double& other8) noexcept {
+  x = other8.x;
+  y = other8.y;
+  z = other8.z;
 }
-vec3_double& vec3_double::operator=(const vec3_double& other1) noexcept {
-  x = other1.x;
-  y = other1.y;
-  z = other1.z;
+vec3_double& vec3_double::operator=(const vec3_double& other9) noexcept {
+  x = other9.x;
+  y = other9.y;
+  z = other9.z;
   return *this;
 }
 void vec3_double::printTo(std::ostream& out) const {
@@ -167,6 +565,11 @@ void contour_of_points_double::__set_closed(const bool val) {
 void contour_of_points_double::__set_metadata(const metadata_t& val) {
   this->metadata = val;
 }
+
+void contour_of_points_double::__set_points_blob(const bulk_array& val) {
+  this->points_blob = val;
+__isset.points_blob = true;
+}
 std::ostream& operator<<(std::ostream& out, const contour_of_points_double& obj)
 {
   obj.printTo(out);
@@ -202,14 +605,14 @@ uint32_t contour_of_points_double::read(::apache::thrift::protocol::TProtocol* i
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->points.clear();
-            uint32_t _size2;
-            ::apache::thrift::protocol::TType _etype5;
-            xfer += iprot->readListBegin(_etype5, _size2);
-            this->points.resize(_size2);
-            uint32_t _i6;
-            for (_i6 = 0; _i6 < _size2; ++_i6)
+            uint32_t _size10;
+            ::apache::thrift::protocol::TType _etype13;
+            xfer += iprot->readListBegin(_etype13, _size10);
+            this->points.resize(_size10);
+            uint32_t _i14;
+            for (_i14 = 0; _i14 < _size10; ++_i14)
             {
-              xfer += this->points[_i6].read(iprot);
+              xfer += this->points[_i14].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -230,17 +633,17 @@ uint32_t contour_of_points_double::read(::apache::thrift::protocol::TProtocol* i
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size7;
-            ::apache::thrift::protocol::TType _ktype8;
-            ::apache::thrift::protocol::TType _vtype9;
-            xfer += iprot->readMapBegin(_ktype8, _vtype9, _size7);
-            uint32_t _i11;
-            for (_i11 = 0; _i11 < _size7; ++_i11)
+            uint32_t _size15;
+            ::apache::thrift::protocol::TType _ktype16;
+            ::apache::thrift::protocol::TType _vtype17;
+            xfer += iprot->readMapBegin(_ktype16, _vtype17, _size15);
+            uint32_t _i19;
+            for (_i19 = 0; _i19 < _size15; ++_i19)
             {
-              std::string _key12;
-              xfer += iprot->readString(_key12);
-              std::string& _val13 = this->metadata[_key12];
-              xfer += iprot->readString(_val13);
+              std::string _key20;
+              xfer += iprot->readString(_key20);
+              std::string& _val21 = this->metadata[_key20];
+              xfer += iprot->readString(_val21);
             }
             xfer += iprot->readMapEnd();
           }
@@ -249,6 +652,14 @@ uint32_t contour_of_points_double::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->points_blob.read(iprot);
+          this->__isset.points_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -275,10 +686,10 @@ uint32_t contour_of_points_double::write(::apache::thrift::protocol::TProtocol*
   xfer += oprot->writeFieldBegin("points", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->points.size()));
-    std::vector<vec3_double> ::const_iterator _iter14;
-    for (_iter14 = this->points.begin(); _iter14 != this->points.end(); ++_iter14)
+    std::vector<vec3_double> ::const_iterator _iter22;
+    for (_iter22 = this->points.begin(); _iter22 != this->points.end(); ++_iter22)
     {
-      xfer += (*_iter14).write(oprot);
+      xfer += (*_iter22).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -291,16 +702,21 @@ uint32_t contour_of_points_double::write(::apache::thrift::protocol::TProtocol*
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter15;
-    for (_iter15 = this->metadata.begin(); _iter15 != this->metadata.end(); ++_iter15)
+    std::map<std::string, std::string> ::const_iterator _iter23;
+    for (_iter23 = this->metadata.begin(); _iter23 != this->metadata.end(); ++_iter23)
     {
-      xfer += oprot->writeString(_iter15->first);
-      xfer += oprot->writeString(_iter15->second);
+      xfer += oprot->writeString(_iter23->first);
+      xfer += oprot->writeString(_iter23->second);
     }
     xfer += oprot->writeMapEnd();
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.points_blob) {
+    xfer += oprot->writeFieldBegin("points_blob", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->points_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -311,17 +727,23 @@ void swap(contour_of_points_double &a, contour_of_points_double &b) {
   swap(a.points, b.points);
   swap(a.closed, b.closed);
   swap(a.metadata, b.metadata);
+  swap(a.points_blob, b.points_blob);
+  swap(a.__isset, b.__isset);
 }
 
-contour_of_points_double::contour_of_points_double(const contour_of_points_double& other16) {
-  points = other16.points;
-  closed = other16.closed;
-  metadata = other16.metadata;
+contour_of_points_double::contour_of_points_double(const contour_of_points_double& other24) {
+  points = other24.points;
+  closed = other24.closed;
+  metadata = other24.metadata;
+  points_blob = other24.points_blob;
+  __isset = other24.__isset;
 }
-contour_of_points_double& contour_of_points_double::operator=(const contour_of_points_double& other17) {
-  points = other17.points;
-  closed = other17.closed;
-  metadata = other17.metadata;
+contour_of_points_double& contour_of_points_double::operator=(const contour_of_points_double& other25) {
+  points = other25.points;
+  closed = other25.closed;
+  metadata = other25.metadata;
+  points_blob = other25.points_blob;
+  __isset = other25.__isset;
   return *this;
 }
 void contour_of_points_double::printTo(std::ostream& out) const {
@@ -330,6 +752,7 @@ void contour_of_points_double::printTo(std::ostream& out) const {
   out << "points=" << to_string(points);
   out << ", " << "closed=" << to_string(closed);
   out << ", " << "metadata=" << to_string(metadata);
+  out << ", " << "points_blob="; (__isset.points_blob ? (out << to_string(points_blob)) : (out << "<null>"));
   out << ")";
 }
 
@@ -374,14 +797,14 @@ uint32_t contour_collection_double::read(::apache::thrift::protocol::TProtocol*
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->contours.clear();
-            uint32_t _size18;
-            ::apache::thrift::protocol::TType _etype21;
-            xfer += iprot->readListBegin(_etype21, _size18);
-            this->contours.resize(_size18);
-            uint32_t _i22;
-            for (_i22 = 0; _i22 < _size18; ++_i22)
+            uint32_t _size26;
+            ::apache::thrift::protocol::TType _etype29;
+            xfer += iprot->readListBegin(_etype29, _size26);
+            this->contours.resize(_size26);
+            uint32_t _i30;
+            for (_i30 = 0; _i30 < _size26; ++_i30)
             {
-              xfer += this->contours[_i22].read(iprot);
+              xfer += this->contours[_i30].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -412,10 +835,10 @@ uint32_t contour_collection_double::write(::apache::thrift::protocol::TProtocol*
   xfer += oprot->writeFieldBegin("contours", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->contours.size()));
-    std::vector<contour_of_points_double> ::const_iterator _iter23;
-    for (_iter23 = this->contours.begin(); _iter23 != this->contours.end(); ++_iter23)
+    std::vector<contour_of_points_double> ::const_iterator _iter31;
+    for (_iter31 = this->contours.begin(); _iter31 != this->contours.end(); ++_iter31)
     {
-      xfer += (*_iter23).write(oprot);
+      xfer += (*_iter31).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -431,11 +854,11 @@ void swap(contour_collection_double &a, contour_collection_double &b) {
   swap(a.contours, b.contours);
 }
 
-contour_collection_double::contour_collection_double(const contour_collection_double& other24) {
-  contours = other24.contours;
+contour_collection_double::contour_collection_double(const contour_collection_double& other32) {
+  contours = other32.contours;
 }
-contour_collection_double& contour_collection_double::operator=(const contour_collection_double& other25) {
-  contours = other25.contours;
+contour_collection_double& contour_collection_double::operator=(const contour_collection_double& other33) {
+  contours = other33.contours;
   return *this;
 }
 void contour_collection_double::printTo(std::ostream& out) const {
@@ -465,6 +888,21 @@ void point_set_double::__set_colours(const std::vector<int64_t> & val) {
 void point_set_double::__set_metadata(const metadata_t& val) {
   this->metadata = val;
 }
+
+void point_set_double::__set_points_blob(const bulk_array& val) {
+  this->points_blob = val;
+__isset.points_blob = true;
+}
+
+void point_set_double::__set_normals_blob(const bulk_array& val) {
+  this->normals_blob = val;
+__isset.normals_blob = true;
+}
+
+void point_set_double::__set_colours_blob(const bulk_array& val) {
+  this->colours_blob = val;
+__isset.colours_blob = true;
+}
 std::ostream& operator<<(std::ostream& out, const point_set_double& obj)
 {
   obj.printTo(out);
@@ -501,14 +939,14 @@ uint32_t point_set_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->points.clear();
-            uint32_t _size26;
-            ::apache::thrift::protocol::TType _etype29;
-            xfer += iprot->readListBegin(_etype29, _size26);
-            this->points.resize(_size26);
-            uint32_t _i30;
-            for (_i30 = 0; _i30 < _size26; ++_i30)
+            uint32_t _size34;
+            ::apache::thrift::protocol::TType _etype37;
+            xfer += iprot->readListBegin(_etype37, _size34);
+            this->points.resize(_size34);
+            uint32_t _i38;
+            for (_i38 = 0; _i38 < _size34; ++_i38)
             {
-              xfer += this->points[_i30].read(iprot);
+              xfer += this->points[_i38].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -521,14 +959,14 @@ uint32_t point_set_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->normals.clear();
-            uint32_t _size31;
-            ::apache::thrift::protocol::TType _etype34;
-            xfer += iprot->readListBegin(_etype34, _size31);
-            this->normals.resize(_size31);
-            uint32_t _i35;
-            for (_i35 = 0; _i35 < _size31; ++_i35)
+            uint32_t _size39;
+            ::apache::thrift::protocol::TType _etype42;
+            xfer += iprot->readListBegin(_etype42, _size39);
+            this->normals.resize(_size39);
+            uint32_t _i43;
+            for (_i43 = 0; _i43 < _size39; ++_i43)
             {
-              xfer += this->normals[_i35].read(iprot);
+              xfer += this->normals[_i43].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -541,14 +979,14 @@ uint32_t point_set_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->colours.clear();
-            uint32_t _size36;
-            ::apache::thrift::protocol::TType _etype39;
-            xfer += iprot->readListBegin(_etype39, _size36);
-            this->colours.resize(_size36);
-            uint32_t _i40;
-            for (_i40 = 0; _i40 < _size36; ++_i40)
+            uint32_t _size44;
+            ::apache::thrift::protocol::TType _etype47;
+            xfer += iprot->readListBegin(_etype47, _size44);
+            this->colours.resize(_size44);
+            uint32_t _i48;
+            for (_i48 = 0; _i48 < _size44; ++_i48)
             {
-              xfer += iprot->readI64(this->colours[_i40]);
+              xfer += iprot->readI64(this->colours[_i48]);
             }
             xfer += iprot->readListEnd();
           }
@@ -561,17 +999,17 @@ uint32_t point_set_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size41;
-            ::apache::thrift::protocol::TType _ktype42;
-            ::apache::thrift::protocol::TType _vtype43;
-            xfer += iprot->readMapBegin(_ktype42, _vtype43, _size41);
-            uint32_t _i45;
-            for (_i45 = 0; _i45 < _size41; ++_i45)
+            uint32_t _size49;
+            ::apache::thrift::protocol::TType _ktype50;
+            ::apache::thrift::protocol::TType _vtype51;
+            xfer += iprot->readMapBegin(_ktype50, _vtype51, _size49);
+            uint32_t _i53;
+            for (_i53 = 0; _i53 < _size49; ++_i53)
             {
-              std::string _key46;
-              xfer += iprot->readString(_key46);
-              std::string& _val47 = this->metadata[_key46];
-              xfer += iprot->readString(_val47);
+              std::string _key54;
+              xfer += iprot->readString(_key54);
+              std::string& _val55 = this->metadata[_key54];
+              xfer += iprot->readString(_val55);
             }
             xfer += iprot->readMapEnd();
           }
@@ -580,6 +1018,30 @@ uint32_t point_set_double::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->points_blob.read(iprot);
+          this->__isset.points_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->normals_blob.read(iprot);
+          this->__isset.normals_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->colours_blob.read(iprot);
+          this->__isset.colours_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -608,10 +1070,10 @@ uint32_t point_set_double::write(::apache::thrift::protocol::TProtocol* oprot) c
   xfer += oprot->writeFieldBegin("points", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->points.size()));
-    std::vector<vec3_double> ::const_iterator _iter48;
-    for (_iter48 = this->points.begin(); _iter48 != this->points.end(); ++_iter48)
+    std::vector<vec3_double> ::const_iterator _iter56;
+    for (_iter56 = this->points.begin(); _iter56 != this->points.end(); ++_iter56)
     {
-      xfer += (*_iter48).write(oprot);
+      xfer += (*_iter56).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -620,10 +1082,10 @@ uint32_t point_set_double::write(::apache::thrift::protocol::TProtocol* oprot) c
   xfer += oprot->writeFieldBegin("normals", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->normals.size()));
-    std::vector<vec3_double> ::const_iterator _iter49;
-    for (_iter49 = this->normals.begin(); _iter49 != this->normals.end(); ++_iter49)
+    std::vector<vec3_double> ::const_iterator _iter57;
+    for (_iter57 = this->normals.begin(); _iter57 != this->normals.end(); ++_iter57)
     {
-      xfer += (*_iter49).write(oprot);
+      xfer += (*_iter57).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -632,10 +1094,10 @@ uint32_t point_set_double::write(::apache::thrift::protocol::TProtocol* oprot) c
   xfer += oprot->writeFieldBegin("colours", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->colours.size()));
-    std::vector<int64_t> ::const_iterator _iter50;
-    for (_iter50 = this->colours.begin(); _iter50 != this->colours.end(); ++_iter50)
+    std::vector<int64_t> ::const_iterator _iter58;
+    for (_iter58 = this->colours.begin(); _iter58 != this->colours.end(); ++_iter58)
     {
-      xfer += oprot->writeI64((*_iter50));
+      xfer += oprot->writeI64((*_iter58));
     }
     xfer += oprot->writeListEnd();
   }
@@ -644,16 +1106,31 @@ uint32_t point_set_double::write(::apache::thrift::protocol::TProtocol* oprot) c
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter51;
-    for (_iter51 = this->metadata.begin(); _iter51 != this->metadata.end(); ++_iter51)
+    std::map<std::string, std::string> ::const_iterator _iter59;
+    for (_iter59 = this->metadata.begin(); _iter59 != this->metadata.end(); ++_iter59)
     {
-      xfer += oprot->writeString(_iter51->first);
-      xfer += oprot->writeString(_iter51->second);
+      xfer += oprot->writeString(_iter59->first);
+      xfer += oprot->writeString(_iter59->second);
     }
     xfer += oprot->writeMapEnd();
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.points_blob) {
+    xfer += oprot->writeFieldBegin("points_blob", ::apache::thrift::protocol::T_STRUCT, 5);
+    xfer += this->points_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.normals_blob) {
+    xfer += oprot->writeFieldBegin("normals_blob", ::apache::thrift::protocol::T_STRUCT, 6);
+    xfer += this->normals_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.colours_blob) {
+    xfer += oprot->writeFieldBegin("colours_blob", ::apache::thrift::protocol::T_STRUCT, 7);
+    xfer += this->colours_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -665,19 +1142,31 @@ void swap(point_set_double &a, point_set_double &b) {
   swap(a.normals, b.normals);
   swap(a.colours, b.colours);
   swap(a.metadata, b.metadata);
+  swap(a.points_blob, b.points_blob);
+  swap(a.normals_blob, b.normals_blob);
+  swap(a.colours_blob, b.colours_blob);
+  swap(a.__isset, b.__isset);
 }
 
-point_set_double::point_set_double(const point_set_double& other52) {
-  points = other52.points;
-  normals = other52.normals;
-  colours = other52.colours;
-  metadata = other52.metadata;
-}
-point_set_double& point_set_double::operator=(const point_set_double& other53) {
-  points = other53.points;
-  normals = other53.normals;
-  colours = other53.colours;
-  metadata = other53.metadata;
+point_set_double::point_set_double(const point_set_double& other60) {
+  points = other60.points;
+  normals = other60.normals;
+  colours = other60.colours;
+  metadata = other60.metadata;
+  points_blob = other60.points_blob;
+  normals_blob = other60.normals_blob;
+  colours_blob = other60.colours_blob;
+  __isset = other60.__isset;
+}
+point_set_double& point_set_double::operator=(const point_set_double& other61) {
+  points = other61.points;
+  normals = other61.normals;
+  colours = other61.colours;
+  metadata = other61.metadata;
+  points_blob = other61.points_blob;
+  normals_blob = other61.normals_blob;
+  colours_blob = other61.colours_blob;
+  __isset = other61.__isset;
   return *this;
 }
 void point_set_double::printTo(std::ostream& out) const {
@@ -687,6 +1176,9 @@ void point_set_double::printTo(std::ostream& out) const {
   out << ", " << "normals=" << to_string(normals);
   out << ", " << "colours=" << to_string(colours);
   out << ", " << "metadata=" << to_string(metadata);
+  out << ", " << "points_blob="; (__isset.points_blob ? (out << to_string(points_blob)) : (out << "<null>"));
+  out << ", " << "normals_blob="; (__isset.normals_blob ? (out << to_string(normals_blob)) : (out << "<null>"));
+  out << ", " << "colours_blob="; (__isset.colours_blob ? (out << to_string(colours_blob)) : (out << "<null>"));
   out << ")";
 }
 
@@ -828,17 +1320,17 @@ void swap(sample4_double &a, sample4_double &b) {
   swap(a.sigma_f, b.sigma_f);
 }
 
-sample4_double::sample4_double(const sample4_double& other54) noexcept {
-  x = other54.x;
-  sigma_x = other54.sigma_x;
-  f = other54.f;
-  sigma_f = other54.sigma_f;
+sample4_double::sample4_double(const sample4_double& other62) noexcept {
+  x = other62.x;
+  sigma_x = other62.sigma_x;
+  f = other62.f;
+  sigma_f = other62.sigma_f;
 }
-sample4_double& sample4_double::operator=(const sample4_double& other55) noexcept {
-  x = other55.x;
-  sigma_x = other55.sigma_x;
-  f = other55.f;
-  sigma_f = other55.sigma_f;
+sample4_double& sample4_double::operator=(const sample4_double& other63) noexcept {
+  x = other63.x;
+  sigma_x = other63.sigma_x;
+  f = other63.f;
+  sigma_f = other63.sigma_f;
   return *this;
 }
 void sample4_double::printTo(std::ostream& out) const {
@@ -902,14 +1394,14 @@ uint32_t samples_1D_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->samples.clear();
-            uint32_t _size56;
-            ::apache::thrift::protocol::TType _etype59;
-            xfer += iprot->readListBegin(_etype59, _size56);
-            this->samples.resize(_size56);
-            uint32_t _i60;
-            for (_i60 = 0; _i60 < _size56; ++_i60)
+            uint32_t _size64;
+            ::apache::thrift::protocol::TType _etype67;
+            xfer += iprot->readListBegin(_etype67, _size64);
+            this->samples.resize(_size64);
+            uint32_t _i68;
+            for (_i68 = 0; _i68 < _size64; ++_i68)
             {
-              xfer += this->samples[_i60].read(iprot);
+              xfer += this->samples[_i68].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -930,17 +1422,17 @@ uint32_t samples_1D_double::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size61;
-            ::apache::thrift::protocol::TType _ktype62;
-            ::apache::thrift::protocol::TType _vtype63;
-            xfer += iprot->readMapBegin(_ktype62, _vtype63, _size61);
-            uint32_t _i65;
-            for (_i65 = 0; _i65 < _size61; ++_i65)
+            uint32_t _size69;
+            ::apache::thrift::protocol::TType _ktype70;
+            ::apache::thrift::protocol::TType _vtype71;
+            xfer += iprot->readMapBegin(_ktype70, _vtype71, _size69);
+            uint32_t _i73;
+            for (_i73 = 0; _i73 < _size69; ++_i73)
             {
-              std::string _key66;
-              xfer += iprot->readString(_key66);
-              std::string& _val67 = this->metadata[_key66];
-              xfer += iprot->readString(_val67);
+              std::string _key74;
+              xfer += iprot->readString(_key74);
+              std::string& _val75 = this->metadata[_key74];
+              xfer += iprot->readString(_val75);
             }
             xfer += iprot->readMapEnd();
           }
@@ -975,10 +1467,10 @@ uint32_t samples_1D_double::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeFieldBegin("samples", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->samples.size()));
-    std::vector<sample4_double> ::const_iterator _iter68;
-    for (_iter68 = this->samples.begin(); _iter68 != this->samples.end(); ++_iter68)
+    std::vector<sample4_double> ::const_iterator _iter76;
+    for (_iter76 = this->samples.begin(); _iter76 != this->samples.end(); ++_iter76)
     {
-      xfer += (*_iter68).write(oprot);
+      xfer += (*_iter76).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -991,11 +1483,11 @@ uint32_t samples_1D_double::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter69;
-    for (_iter69 = this->metadata.begin(); _iter69 != this->metadata.end(); ++_iter69)
+    std::map<std::string, std::string> ::const_iterator _iter77;
+    for (_iter77 = this->metadata.begin(); _iter77 != this->metadata.end(); ++_iter77)
     {
-      xfer += oprot->writeString(_iter69->first);
-      xfer += oprot->writeString(_iter69->second);
+      xfer += oprot->writeString(_iter77->first);
+      xfer += oprot->writeString(_iter77->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1013,15 +1505,15 @@ void swap(samples_1D_double &a, samples_1D_double &b) {
   swap(a.metadata, b.metadata);
 }
 
-samples_1D_double::samples_1D_double(const samples_1D_double& other70) {
-  samples = other70.samples;
-  uncertainties_known_to_be_independent_and_random = other70.uncertainties_known_to_be_independent_and_random;
-  metadata = other70.metadata;
+samples_1D_double::samples_1D_double(const samples_1D_double& other78) {
+  samples = other78.samples;
+  uncertainties_known_to_be_independent_and_random = other78.uncertainties_known_to_be_independent_and_random;
+  metadata = other78.metadata;
 }
-samples_1D_double& samples_1D_double::operator=(const samples_1D_double& other71) {
-  samples = other71.samples;
-  uncertainties_known_to_be_independent_and_random = other71.uncertainties_known_to_be_independent_and_random;
-  metadata = other71.metadata;
+samples_1D_double& samples_1D_double::operator=(const samples_1D_double& other79) {
+  samples = other79.samples;
+  uncertainties_known_to_be_independent_and_random = other79.uncertainties_known_to_be_independent_and_random;
+  metadata = other79.metadata;
   return *this;
 }
 void samples_1D_double::printTo(std::ostream& out) const {
@@ -1061,6 +1553,31 @@ void fv_surface_mesh_double_int64::__set_involved_faces(const std::vector<std::v
 void fv_surface_mesh_double_int64::__set_metadata(const metadata_t& val) {
   this->metadata = val;
 }
+
+void fv_surface_mesh_double_int64::__set_vertices_blob(const bulk_array& val) {
+  this->vertices_blob = val;
+__isset.vertices_blob = true;
+}
+
+void fv_surface_mesh_double_int64::__set_vertex_normals_blob(const bulk_array& val) {
+  this->vertex_normals_blob = val;
+__isset.vertex_normals_blob = true;
+}
+
+void fv_surface_mesh_double_int64::__set_vertex_colours_blob(const bulk_array& val) {
+  this->vertex_colours_blob = val;
+__isset.vertex_colours_blob = true;
+}
+
+void fv_surface_mesh_double_int64::__set_face_offsets_blob(const bulk_array& val) {
+  this->face_offsets_blob = val;
+__isset.face_offsets_blob = true;
+}
+
+void fv_surface_mesh_double_int64::__set_face_indices_blob(const bulk_array& val) {
+  this->face_indices_blob = val;
+__isset.face_indices_blob = true;
+}
 std::ostream& operator<<(std::ostream& out, const fv_surface_mesh_double_int64& obj)
 {
   obj.printTo(out);
@@ -1099,14 +1616,14 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->vertices.clear();
-            uint32_t _size72;
-            ::apache::thrift::protocol::TType _etype75;
-            xfer += iprot->readListBegin(_etype75, _size72);
-            this->vertices.resize(_size72);
-            uint32_t _i76;
-            for (_i76 = 0; _i76 < _size72; ++_i76)
+            uint32_t _size80;
+            ::apache::thrift::protocol::TType _etype83;
+            xfer += iprot->readListBegin(_etype83, _size80);
+            this->vertices.resize(_size80);
+            uint32_t _i84;
+            for (_i84 = 0; _i84 < _size80; ++_i84)
             {
-              xfer += this->vertices[_i76].read(iprot);
+              xfer += this->vertices[_i84].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1119,14 +1636,14 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->vertex_normals.clear();
-            uint32_t _size77;
-            ::apache::thrift::protocol::TType _etype80;
-            xfer += iprot->readListBegin(_etype80, _size77);
-            this->vertex_normals.resize(_size77);
-            uint32_t _i81;
-            for (_i81 = 0; _i81 < _size77; ++_i81)
+            uint32_t _size85;
+            ::apache::thrift::protocol::TType _etype88;
+            xfer += iprot->readListBegin(_etype88, _size85);
+            this->vertex_normals.resize(_size85);
+            uint32_t _i89;
+            for (_i89 = 0; _i89 < _size85; ++_i89)
             {
-              xfer += this->vertex_normals[_i81].read(iprot);
+              xfer += this->vertex_normals[_i89].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1139,14 +1656,14 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->vertex_colours.clear();
-            uint32_t _size82;
-            ::apache::thrift::protocol::TType _etype85;
-            xfer += iprot->readListBegin(_etype85, _size82);
-            this->vertex_colours.resize(_size82);
-            uint32_t _i86;
-            for (_i86 = 0; _i86 < _size82; ++_i86)
+            uint32_t _size90;
+            ::apache::thrift::protocol::TType _etype93;
+            xfer += iprot->readListBegin(_etype93, _size90);
+            this->vertex_colours.resize(_size90);
+            uint32_t _i94;
+            for (_i94 = 0; _i94 < _size90; ++_i94)
             {
-              xfer += iprot->readI64(this->vertex_colours[_i86]);
+              xfer += iprot->readI64(this->vertex_colours[_i94]);
             }
             xfer += iprot->readListEnd();
           }
@@ -1159,23 +1676,23 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->faces.clear();
-            uint32_t _size87;
-            ::apache::thrift::protocol::TType _etype90;
-            xfer += iprot->readListBegin(_etype90, _size87);
-            this->faces.resize(_size87);
-            uint32_t _i91;
-            for (_i91 = 0; _i91 < _size87; ++_i91)
+            uint32_t _size95;
+            ::apache::thrift::protocol::TType _etype98;
+            xfer += iprot->readListBegin(_etype98, _size95);
+            this->faces.resize(_size95);
+            uint32_t _i99;
+            for (_i99 = 0; _i99 < _size95; ++_i99)
             {
               {
-                this->faces[_i91].clear();
-                uint32_t _size92;
-                ::apache::thrift::protocol::TType _etype95;
-                xfer += iprot->readListBegin(_etype95, _size92);
-                this->faces[_i91].resize(_size92);
-                uint32_t _i96;
-                for (_i96 = 0; _i96 < _size92; ++_i96)
+                this->faces[_i99].clear();
+                uint32_t _size100;
+                ::apache::thrift::protocol::TType _etype103;
+                xfer += iprot->readListBegin(_etype103, _size100);
+                this->faces[_i99].resize(_size100);
+                uint32_t _i104;
+                for (_i104 = 0; _i104 < _size100; ++_i104)
                 {
-                  xfer += iprot->readI64(this->faces[_i91][_i96]);
+                  xfer += iprot->readI64(this->faces[_i99][_i104]);
                 }
                 xfer += iprot->readListEnd();
               }
@@ -1191,23 +1708,23 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->involved_faces.clear();
-            uint32_t _size97;
-            ::apache::thrift::protocol::TType _etype100;
-            xfer += iprot->readListBegin(_etype100, _size97);
-            this->involved_faces.resize(_size97);
-            uint32_t _i101;
-            for (_i101 = 0; _i101 < _size97; ++_i101)
+            uint32_t _size105;
+            ::apache::thrift::protocol::TType _etype108;
+            xfer += iprot->readListBegin(_etype108, _size105);
+            this->involved_faces.resize(_size105);
+            uint32_t _i109;
+            for (_i109 = 0; _i109 < _size105; ++_i109)
             {
               {
-                this->involved_faces[_i101].clear();
-                uint32_t _size102;
-                ::apache::thrift::protocol::TType _etype105;
-                xfer += iprot->readListBegin(_etype105, _size102);
-                this->involved_faces[_i101].resize(_size102);
-                uint32_t _i106;
-                for (_i106 = 0; _i106 < _size102; ++_i106)
+                this->involved_faces[_i109].clear();
+                uint32_t _size110;
+                ::apache::thrift::protocol::TType _etype113;
+                xfer += iprot->readListBegin(_etype113, _size110);
+                this->involved_faces[_i109].resize(_size110);
+                uint32_t _i114;
+                for (_i114 = 0; _i114 < _size110; ++_i114)
                 {
-                  xfer += iprot->readI64(this->involved_faces[_i101][_i106]);
+                  xfer += iprot->readI64(this->involved_faces[_i109][_i114]);
                 }
                 xfer += iprot->readListEnd();
               }
@@ -1223,17 +1740,17 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size107;
-            ::apache::thrift::protocol::TType _ktype108;
-            ::apache::thrift::protocol::TType _vtype109;
-            xfer += iprot->readMapBegin(_ktype108, _vtype109, _size107);
-            uint32_t _i111;
-            for (_i111 = 0; _i111 < _size107; ++_i111)
+            uint32_t _size115;
+            ::apache::thrift::protocol::TType _ktype116;
+            ::apache::thrift::protocol::TType _vtype117;
+            xfer += iprot->readMapBegin(_ktype116, _vtype117, _size115);
+            uint32_t _i119;
+            for (_i119 = 0; _i119 < _size115; ++_i119)
             {
-              std::string _key112;
-              xfer += iprot->readString(_key112);
-              std::string& _val113 = this->metadata[_key112];
-              xfer += iprot->readString(_val113);
+              std::string _key120;
+              xfer += iprot->readString(_key120);
+              std::string& _val121 = this->metadata[_key120];
+              xfer += iprot->readString(_val121);
             }
             xfer += iprot->readMapEnd();
           }
@@ -1242,6 +1759,46 @@ uint32_t fv_surface_mesh_double_int64::read(::apache::thrift::protocol::TProtoco
           xfer += iprot->skip(ftype);
         }
         break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->vertices_blob.read(iprot);
+          this->__isset.vertices_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->vertex_normals_blob.read(iprot);
+          this->__isset.vertex_normals_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->vertex_colours_blob.read(iprot);
+          this->__isset.vertex_colours_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 10:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->face_offsets_blob.read(iprot);
+          this->__isset.face_offsets_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 11:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->face_indices_blob.read(iprot);
+          this->__isset.face_indices_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1274,10 +1831,10 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("vertices", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->vertices.size()));
-    std::vector<vec3_double> ::const_iterator _iter114;
-    for (_iter114 = this->vertices.begin(); _iter114 != this->vertices.end(); ++_iter114)
+    std::vector<vec3_double> ::const_iterator _iter122;
+    for (_iter122 = this->vertices.begin(); _iter122 != this->vertices.end(); ++_iter122)
     {
-      xfer += (*_iter114).write(oprot);
+      xfer += (*_iter122).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -1286,10 +1843,10 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("vertex_normals", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->vertex_normals.size()));
-    std::vector<vec3_double> ::const_iterator _iter115;
-    for (_iter115 = this->vertex_normals.begin(); _iter115 != this->vertex_normals.end(); ++_iter115)
+    std::vector<vec3_double> ::const_iterator _iter123;
+    for (_iter123 = this->vertex_normals.begin(); _iter123 != this->vertex_normals.end(); ++_iter123)
     {
-      xfer += (*_iter115).write(oprot);
+      xfer += (*_iter123).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -1298,10 +1855,10 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("vertex_colours", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->vertex_colours.size()));
-    std::vector<int64_t> ::const_iterator _iter116;
-    for (_iter116 = this->vertex_colours.begin(); _iter116 != this->vertex_colours.end(); ++_iter116)
+    std::vector<int64_t> ::const_iterator _iter124;
+    for (_iter124 = this->vertex_colours.begin(); _iter124 != this->vertex_colours.end(); ++_iter124)
     {
-      xfer += oprot->writeI64((*_iter116));
+      xfer += oprot->writeI64((*_iter124));
     }
     xfer += oprot->writeListEnd();
   }
@@ -1310,15 +1867,15 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("faces", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->faces.size()));
-    std::vector<std::vector<int64_t> > ::const_iterator _iter117;
-    for (_iter117 = this->faces.begin(); _iter117 != this->faces.end(); ++_iter117)
+    std::vector<std::vector<int64_t> > ::const_iterator _iter125;
+    for (_iter125 = this->faces.begin(); _iter125 != this->faces.end(); ++_iter125)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter117).size()));
-        std::vector<int64_t> ::const_iterator _iter118;
-        for (_iter118 = (*_iter117).begin(); _iter118 != (*_iter117).end(); ++_iter118)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter125).size()));
+        std::vector<int64_t> ::const_iterator _iter126;
+        for (_iter126 = (*_iter125).begin(); _iter126 != (*_iter125).end(); ++_iter126)
         {
-          xfer += oprot->writeI64((*_iter118));
+          xfer += oprot->writeI64((*_iter126));
         }
         xfer += oprot->writeListEnd();
       }
@@ -1330,15 +1887,15 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("involved_faces", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->involved_faces.size()));
-    std::vector<std::vector<int64_t> > ::const_iterator _iter119;
-    for (_iter119 = this->involved_faces.begin(); _iter119 != this->involved_faces.end(); ++_iter119)
+    std::vector<std::vector<int64_t> > ::const_iterator _iter127;
+    for (_iter127 = this->involved_faces.begin(); _iter127 != this->involved_faces.end(); ++_iter127)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter119).size()));
-        std::vector<int64_t> ::const_iterator _iter120;
-        for (_iter120 = (*_iter119).begin(); _iter120 != (*_iter119).end(); ++_iter120)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter127).size()));
+        std::vector<int64_t> ::const_iterator _iter128;
+        for (_iter128 = (*_iter127).begin(); _iter128 != (*_iter127).end(); ++_iter128)
         {
-          xfer += oprot->writeI64((*_iter120));
+          xfer += oprot->writeI64((*_iter128));
         }
         xfer += oprot->writeListEnd();
       }
@@ -1350,16 +1907,41 @@ uint32_t fv_surface_mesh_double_int64::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 6);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter121;
-    for (_iter121 = this->metadata.begin(); _iter121 != this->metadata.end(); ++_iter121)
+    std::map<std::string, std::string> ::const_iterator _iter129;
+    for (_iter129 = this->metadata.begin(); _iter129 != this->metadata.end(); ++_iter129)
     {
-      xfer += oprot->writeString(_iter121->first);
-      xfer += oprot->writeString(_iter121->second);
+      xfer += oprot->writeString(_iter129->first);
+      xfer += oprot->writeString(_iter129->second);
     }
     xfer += oprot->writeMapEnd();
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.vertices_blob) {
+    xfer += oprot->writeFieldBegin("vertices_blob", ::apache::thrift::protocol::T_STRUCT, 7);
+    xfer += this->vertices_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.vertex_normals_blob) {
+    xfer += oprot->writeFieldBegin("vertex_normals_blob", ::apache::thrift::protocol::T_STRUCT, 8);
+    xfer += this->vertex_normals_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.vertex_colours_blob) {
+    xfer += oprot->writeFieldBegin("vertex_colours_blob", ::apache::thrift::protocol::T_STRUCT, 9);
+    xfer += this->vertex_colours_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.face_offsets_blob) {
+    xfer += oprot->writeFieldBegin("face_offsets_blob", ::apache::thrift::protocol::T_STRUCT, 10);
+    xfer += this->face_offsets_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.face_indices_blob) {
+    xfer += oprot->writeFieldBegin("face_indices_blob", ::apache::thrift::protocol::T_STRUCT, 11);
+    xfer += this->face_indices_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1373,23 +1955,41 @@ void swap(fv_surface_mesh_double_int64 &a, fv_surface_mesh_double_int64 &b) {
   swap(a.faces, b.faces);
   swap(a.involved_faces, b.involved_faces);
   swap(a.metadata, b.metadata);
+  swap(a.vertices_blob, b.vertices_blob);
+  swap(a.vertex_normals_blob, b.vertex_normals_blob);
+  swap(a.vertex_colours_blob, b.vertex_colours_blob);
+  swap(a.face_offsets_blob, b.face_offsets_blob);
+  swap(a.face_indices_blob, b.face_indices_blob);
+  swap(a.__isset, b.__isset);
 }
 
-fv_surface_mesh_double_int64::fv_surface_mesh_double_int64(const fv_surface_mesh_double_int64& other122) {
-  vertices = other122.vertices;
-  vertex_normals = other122.vertex_normals;
-  vertex_colours = other122.vertex_colours;
-  faces = other122.faces;
-  involved_faces = other122.involved_faces;
-  metadata = other122.metadata;
-}
-fv_surface_mesh_double_int64& fv_surface_mesh_double_int64::operator=(const fv_surface_mesh_double_int64& other123) {
-  vertices = other123.vertices;
-  vertex_normals = other123.vertex_normals;
-  vertex_colours = other123.vertex_colours;
-  faces = other123.faces;
-  involved_faces = other123.involved_faces;
-  metadata = other123.metadata;
+fv_surface_mesh_double_int64::fv_surface_mesh_double_int64(const fv_surface_mesh_double_int64& other130) {
+  vertices = other130.vertices;
+  vertex_normals = other130.vertex_normals;
+  vertex_colours = other130.vertex_colours;
+  faces = other130.faces;
+  involved_faces = other130.involved_faces;
+  metadata = other130.metadata;
+  vertices_blob = other130.vertices_blob;
+  vertex_normals_blob = other130.vertex_normals_blob;
+  vertex_colours_blob = other130.vertex_colours_blob;
+  face_offsets_blob = other130.face_offsets_blob;
+  face_indices_blob = other130.face_indices_blob;
+  __isset = other130.__isset;
+}
+fv_surface_mesh_double_int64& fv_surface_mesh_double_int64::operator=(const fv_surface_mesh_double_int64& other131) {
+  vertices = other131.vertices;
+  vertex_normals = other131.vertex_normals;
+  vertex_colours = other131.vertex_colours;
+  faces = other131.faces;
+  involved_faces = other131.involved_faces;
+  metadata = other131.metadata;
+  vertices_blob = other131.vertices_blob;
+  vertex_normals_blob = other131.vertex_normals_blob;
+  vertex_colours_blob = other131.vertex_colours_blob;
+  face_offsets_blob = other131.face_offsets_blob;
+  face_indices_blob = other131.face_indices_blob;
+  __isset = other131.__isset;
   return *this;
 }
 void fv_surface_mesh_double_int64::printTo(std::ostream& out) const {
@@ -1401,6 +2001,11 @@ void fv_surface_mesh_double_int64::printTo(std::ostream& out) const {
   out << ", " << "faces=" << to_string(faces);
   out << ", " << "involved_faces=" << to_string(involved_faces);
   out << ", " << "metadata=" << to_string(metadata);
+  out << ", " << "vertices_blob="; (__isset.vertices_blob ? (out << to_string(vertices_blob)) : (out << "<null>"));
+  out << ", " << "vertex_normals_blob="; (__isset.vertex_normals_blob ? (out << to_string(vertex_normals_blob)) : (out << "<null>"));
+  out << ", " << "vertex_colours_blob="; (__isset.vertex_colours_blob ? (out << to_string(vertex_colours_blob)) : (out << "<null>"));
+  out << ", " << "face_offsets_blob="; (__isset.face_offsets_blob ? (out << to_string(face_offsets_blob)) : (out << "<null>"));
+  out << ", " << "face_indices_blob="; (__isset.face_indices_blob ? (out << to_string(face_indices_blob)) : (out << "<null>"));
   out << ")";
 }
 
@@ -1456,6 +2061,11 @@ void planar_image_double_double::__set_col_unit(const vec3_double& val) {
 void planar_image_double_double::__set_metadata(const metadata_t& val) {
   this->metadata = val;
 }
+
+void planar_image_double_double::__set_data_blob(const bulk_array& val) {
+  this->data_blob = val;
+__isset.data_blob = true;
+}
 std::ostream& operator<<(std::ostream& out, const planar_image_double_double& obj)
 {
   obj.printTo(out);
@@ -1500,14 +2110,14 @@ uint32_t planar_image_double_double::read(::apache::thrift::protocol::TProtocol*
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->data.clear();
-            uint32_t _size124;
-            ::apache::thrift::protocol::TType _etype127;
-            xfer += iprot->readListBegin(_etype127, _size124);
-            this->data.resize(_size124);
-            uint32_t _i128;
-            for (_i128 = 0; _i128 < _size124; ++_i128)
+            uint32_t _size132;
+            ::apache::thrift::protocol::TType _etype135;
+            xfer += iprot->readListBegin(_etype135, _size132);
+            this->data.resize(_size132);
+            uint32_t _i136;
+            for (_i136 = 0; _i136 < _size132; ++_i136)
             {
-              xfer += iprot->readDouble(this->data[_i128]);
+              xfer += iprot->readDouble(this->data[_i136]);
             }
             xfer += iprot->readListEnd();
           }
@@ -1600,17 +2210,17 @@ uint32_t planar_image_double_double::read(::apache::thrift::protocol::TProtocol*
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size129;
-            ::apache::thrift::protocol::TType _ktype130;
-            ::apache::thrift::protocol::TType _vtype131;
-            xfer += iprot->readMapBegin(_ktype130, _vtype131, _size129);
-            uint32_t _i133;
-            for (_i133 = 0; _i133 < _size129; ++_i133)
+            uint32_t _size137;
+            ::apache::thrift::protocol::TType _ktype138;
+            ::apache::thrift::protocol::TType _vtype139;
+            xfer += iprot->readMapBegin(_ktype138, _vtype139, _size137);
+            uint32_t _i141;
+            for (_i141 = 0; _i141 < _size137; ++_i141)
             {
-              std::string _key134;
-              xfer += iprot->readString(_key134);
-              std::string& _val135 = this->metadata[_key134];
-              xfer += iprot->readString(_val135);
+              std::string _key142;
+              xfer += iprot->readString(_key142);
+              std::string& _val143 = this->metadata[_key142];
+              xfer += iprot->readString(_val143);
             }
             xfer += iprot->readMapEnd();
           }
@@ -1619,6 +2229,14 @@ uint32_t planar_image_double_double::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 13:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->data_blob.read(iprot);
+          this->__isset.data_blob = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1663,10 +2281,10 @@ uint32_t planar_image_double_double::write(::apache::thrift::protocol::TProtocol
   xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_DOUBLE, static_cast<uint32_t>(this->data.size()));
-    std::vector<double> ::const_iterator _iter136;
-    for (_iter136 = this->data.begin(); _iter136 != this->data.end(); ++_iter136)
+    std::vector<double> ::const_iterator _iter144;
+    for (_iter144 = this->data.begin(); _iter144 != this->data.end(); ++_iter144)
     {
-      xfer += oprot->writeDouble((*_iter136));
+      xfer += oprot->writeDouble((*_iter144));
     }
     xfer += oprot->writeListEnd();
   }
@@ -1715,16 +2333,21 @@ uint32_t planar_image_double_double::write(::apache::thrift::protocol::TProtocol
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 12);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter137;
-    for (_iter137 = this->metadata.begin(); _iter137 != this->metadata.end(); ++_iter137)
+    std::map<std::string, std::string> ::const_iterator _iter145;
+    for (_iter145 = this->metadata.begin(); _iter145 != this->metadata.end(); ++_iter145)
     {
-      xfer += oprot->writeString(_iter137->first);
-      xfer += oprot->writeString(_iter137->second);
+      xfer += oprot->writeString(_iter145->first);
+      xfer += oprot->writeString(_iter145->second);
     }
     xfer += oprot->writeMapEnd();
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.data_blob) {
+    xfer += oprot->writeFieldBegin("data_blob", ::apache::thrift::protocol::T_STRUCT, 13);
+    xfer += this->data_blob.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1744,35 +2367,41 @@ void swap(planar_image_double_double &a, planar_image_double_double &b) {
   swap(a.row_unit, b.row_unit);
   swap(a.col_unit, b.col_unit);
   swap(a.metadata, b.metadata);
+  swap(a.data_blob, b.data_blob);
+  swap(a.__isset, b.__isset);
 }
 
-planar_image_double_double::planar_image_double_double(const planar_image_double_double& other138) {
-  data = other138.data;
-  rows = other138.rows;
-  columns = other138.columns;
-  channels = other138.channels;
-  pxl_dx = other138.pxl_dx;
-  pxl_dy = other138.pxl_dy;
-  pxl_dz = other138.pxl_dz;
-  anchor = other138.anchor;
-  offset = other138.offset;
-  row_unit = other138.row_unit;
-  col_unit = other138.col_unit;
-  metadata = other138.metadata;
-}
-planar_image_double_double& planar_image_double_double::operator=(const planar_image_double_double& other139) {
-  data = other139.data;
-  rows = other139.rows;
-  columns = other139.columns;
-  channels = other139.channels;
-  pxl_dx = other139.pxl_dx;
-  pxl_dy = other139.pxl_dy;
-  pxl_dz = other139.pxl_dz;
-  anchor = other139.anchor;
-  offset = other139.offset;
-  row_unit = other139.row_unit;
-  col_unit = other139.col_unit;
-  metadata = other139.metadata;
+planar_image_double_double::planar_image_double_double(const planar_image_double_double& other146) {
+  data = other146.data;
+  rows = other146.rows;
+  columns = other146.columns;
+  channels = other146.channels;
+  pxl_dx = other146.pxl_dx;
+  pxl_dy = other146.pxl_dy;
+  pxl_dz = other146.pxl_dz;
+  anchor = other146.anchor;
+  offset = other146.offset;
+  row_unit = other146.row_unit;
+  col_unit = other146.col_unit;
+  metadata = other146.metadata;
+  data_blob = other146.data_blob;
+  __isset = other146.__isset;
+}
+planar_image_double_double& planar_image_double_double::operator=(const planar_image_double_double& other147) {
+  data = other147.data;
+  rows = other147.rows;
+  columns = other147.columns;
+  channels = other147.channels;
+  pxl_dx = other147.pxl_dx;
+  pxl_dy = other147.pxl_dy;
+  pxl_dz = other147.pxl_dz;
+  anchor = other147.anchor;
+  offset = other147.offset;
+  row_unit = other147.row_unit;
+  col_unit = other147.col_unit;
+  metadata = other147.metadata;
+  data_blob = other147.data_blob;
+  __isset = other147.__isset;
   return *this;
 }
 void planar_image_double_double::printTo(std::ostream& out) const {
@@ -1790,6 +2419,7 @@ void planar_image_double_double::printTo(std::ostream& out) const {
   out << ", " << "row_unit=" << to_string(row_unit);
   out << ", " << "col_unit=" << to_string(col_unit);
   out << ", " << "metadata=" << to_string(metadata);
+  out << ", " << "data_blob="; (__isset.data_blob ? (out << to_string(data_blob)) : (out << "<null>"));
   out << ")";
 }
 
@@ -1834,14 +2464,14 @@ uint32_t planar_image_collection_double_double::read(::apache::thrift::protocol:
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->images.clear();
-            uint32_t _size140;
-            ::apache::thrift::protocol::TType _etype143;
-            xfer += iprot->readListBegin(_etype143, _size140);
-            this->images.resize(_size140);
-            uint32_t _i144;
-            for (_i144 = 0; _i144 < _size140; ++_i144)
+            uint32_t _size148;
+            ::apache::thrift::protocol::TType _etype151;
+            xfer += iprot->readListBegin(_etype151, _size148);
+            this->images.resize(_size148);
+            uint32_t _i152;
+            for (_i152 = 0; _i152 < _size148; ++_i152)
             {
-              xfer += this->images[_i144].read(iprot);
+              xfer += this->images[_i152].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1872,10 +2502,10 @@ uint32_t planar_image_collection_double_double::write(::apache::thrift::protocol
   xfer += oprot->writeFieldBegin("images", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->images.size()));
-    std::vector<planar_image_double_double> ::const_iterator _iter145;
-    for (_iter145 = this->images.begin(); _iter145 != this->images.end(); ++_iter145)
+    std::vector<planar_image_double_double> ::const_iterator _iter153;
+    for (_iter153 = this->images.begin(); _iter153 != this->images.end(); ++_iter153)
     {
-      xfer += (*_iter145).write(oprot);
+      xfer += (*_iter153).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -1891,11 +2521,11 @@ void swap(planar_image_collection_double_double &a, planar_image_collection_doub
   swap(a.images, b.images);
 }
 
-planar_image_collection_double_double::planar_image_collection_double_double(const planar_image_collection_double_double& other146) {
-  images = other146.images;
+planar_image_collection_double_double::planar_image_collection_double_double(const planar_image_collection_double_double& other154) {
+  images = other154.images;
 }
-planar_image_collection_double_double& planar_image_collection_double_double::operator=(const planar_image_collection_double_double& other147) {
-  images = other147.images;
+planar_image_collection_double_double& planar_image_collection_double_double::operator=(const planar_image_collection_double_double& other155) {
+  images = other155.images;
   return *this;
 }
 void planar_image_collection_double_double::printTo(std::ostream& out) const {
@@ -2023,15 +2653,15 @@ void swap(cell_string &a, cell_string &b) {
   swap(a.val, b.val);
 }
 
-cell_string::cell_string(const cell_string& other148) {
-  row = other148.row;
-  col = other148.col;
-  val = other148.val;
+cell_string::cell_string(const cell_string& other156) {
+  row = other156.row;
+  col = other156.col;
+  val = other156.val;
 }
-cell_string& cell_string::operator=(const cell_string& other149) {
-  row = other149.row;
-  col = other149.col;
-  val = other149.val;
+cell_string& cell_string::operator=(const cell_string& other157) {
+  row = other157.row;
+  col = other157.col;
+  val = other157.val;
   return *this;
 }
 void cell_string::printTo(std::ostream& out) const {
@@ -2089,14 +2719,14 @@ uint32_t table2::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->data.clear();
-            uint32_t _size150;
-            ::apache::thrift::protocol::TType _etype153;
-            xfer += iprot->readListBegin(_etype153, _size150);
-            this->data.resize(_size150);
-            uint32_t _i154;
-            for (_i154 = 0; _i154 < _size150; ++_i154)
+            uint32_t _size158;
+            ::apache::thrift::protocol::TType _etype161;
+            xfer += iprot->readListBegin(_etype161, _size158);
+            this->data.resize(_size158);
+            uint32_t _i162;
+            for (_i162 = 0; _i162 < _size158; ++_i162)
             {
-              xfer += this->data[_i154].read(iprot);
+              xfer += this->data[_i162].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -2109,17 +2739,17 @@ uint32_t table2::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size155;
-            ::apache::thrift::protocol::TType _ktype156;
-            ::apache::thrift::protocol::TType _vtype157;
-            xfer += iprot->readMapBegin(_ktype156, _vtype157, _size155);
-            uint32_t _i159;
-            for (_i159 = 0; _i159 < _size155; ++_i159)
+            uint32_t _size163;
+            ::apache::thrift::protocol::TType _ktype164;
+            ::apache::thrift::protocol::TType _vtype165;
+            xfer += iprot->readMapBegin(_ktype164, _vtype165, _size163);
+            uint32_t _i167;
+            for (_i167 = 0; _i167 < _size163; ++_i167)
             {
-              std::string _key160;
-              xfer += iprot->readString(_key160);
-              std::string& _val161 = this->metadata[_key160];
-              xfer += iprot->readString(_val161);
+              std::string _key168;
+              xfer += iprot->readString(_key168);
+              std::string& _val169 = this->metadata[_key168];
+              xfer += iprot->readString(_val169);
             }
             xfer += iprot->readMapEnd();
           }
@@ -2152,10 +2782,10 @@ uint32_t table2::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->data.size()));
-    std::vector<cell_string> ::const_iterator _iter162;
-    for (_iter162 = this->data.begin(); _iter162 != this->data.end(); ++_iter162)
+    std::vector<cell_string> ::const_iterator _iter170;
+    for (_iter170 = this->data.begin(); _iter170 != this->data.end(); ++_iter170)
     {
-      xfer += (*_iter162).write(oprot);
+      xfer += (*_iter170).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -2164,11 +2794,11 @@ uint32_t table2::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter163;
-    for (_iter163 = this->metadata.begin(); _iter163 != this->metadata.end(); ++_iter163)
+    std::map<std::string, std::string> ::const_iterator _iter171;
+    for (_iter171 = this->metadata.begin(); _iter171 != this->metadata.end(); ++_iter171)
     {
-      xfer += oprot->writeString(_iter163->first);
-      xfer += oprot->writeString(_iter163->second);
+      xfer += oprot->writeString(_iter171->first);
+      xfer += oprot->writeString(_iter171->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -2185,13 +2815,13 @@ void swap(table2 &a, table2 &b) {
   swap(a.metadata, b.metadata);
 }
 
-table2::table2(const table2& other164) {
-  data = other164.data;
-  metadata = other164.metadata;
+table2::table2(const table2& other172) {
+  data = other172.data;
+  metadata = other172.metadata;
 }
-table2& table2::operator=(const table2& other165) {
-  data = other165.data;
-  metadata = other165.metadata;
+table2& table2::operator=(const table2& other173) {
+  data = other173.data;
+  metadata = other173.metadata;
   return *this;
 }
 void table2::printTo(std::ostream& out) const {
@@ -2243,14 +2873,14 @@ uint32_t Contour_Data::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->ccs.clear();
-            uint32_t _size166;
-            ::apache::thrift::protocol::TType _etype169;
-            xfer += iprot->readListBegin(_etype169, _size166);
-            this->ccs.resize(_size166);
-            uint32_t _i170;
-            for (_i170 = 0; _i170 < _size166; ++_i170)
+            uint32_t _size174;
+            ::apache::thrift::protocol::TType _etype177;
+            xfer += iprot->readListBegin(_etype177, _size174);
+            this->ccs.resize(_size174);
+            uint32_t _i178;
+            for (_i178 = 0; _i178 < _size174; ++_i178)
             {
-              xfer += this->ccs[_i170].read(iprot);
+              xfer += this->ccs[_i178].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -2281,10 +2911,10 @@ uint32_t Contour_Data::write(::apache::thrift::protocol::TProtocol* oprot) const
   xfer += oprot->writeFieldBegin("ccs", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->ccs.size()));
-    std::vector<contour_collection_double> ::const_iterator _iter171;
-    for (_iter171 = this->ccs.begin(); _iter171 != this->ccs.end(); ++_iter171)
+    std::vector<contour_collection_double> ::const_iterator _iter179;
+    for (_iter179 = this->ccs.begin(); _iter179 != this->ccs.end(); ++_iter179)
     {
-      xfer += (*_iter171).write(oprot);
+      xfer += (*_iter179).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -2300,11 +2930,11 @@ void swap(Contour_Data &a, Contour_Data &b) {
   swap(a.ccs, b.ccs);
 }
 
-Contour_Data::Contour_Data(const Contour_Data& other172) {
-  ccs = other172.ccs;
+Contour_Data::Contour_Data(const Contour_Data& other180) {
+  ccs = other180.ccs;
 }
-Contour_Data& Contour_Data::operator=(const Contour_Data& other173) {
-  ccs = other173.ccs;
+Contour_Data& Contour_Data::operator=(const Contour_Data& other181) {
+  ccs = other181.ccs;
   return *this;
 }
 void Contour_Data::printTo(std::ostream& out) const {
@@ -2412,13 +3042,13 @@ void swap(Image_Array &a, Image_Array &b) {
   swap(a.filename, b.filename);
 }
 
-Image_Array::Image_Array(const Image_Array& other174) {
-  imagecoll = other174.imagecoll;
-  filename = other174.filename;
+Image_Array::Image_Array(const Image_Array& other182) {
+  imagecoll = other182.imagecoll;
+  filename = other182.filename;
 }
-Image_Array& Image_Array::operator=(const Image_Array& other175) {
-  imagecoll = other175.imagecoll;
-  filename = other175.filename;
+Image_Array& Image_Array::operator=(const Image_Array& other183) {
+  imagecoll = other183.imagecoll;
+  filename = other183.filename;
   return *this;
 }
 void Image_Array::printTo(std::ostream& out) const {
@@ -2507,11 +3137,11 @@ void swap(Point_Cloud &a, Point_Cloud &b) {
   swap(a.pset, b.pset);
 }
 
-Point_Cloud::Point_Cloud(const Point_Cloud& other176) {
-  pset = other176.pset;
+Point_Cloud::Point_Cloud(const Point_Cloud& other184) {
+  pset = other184.pset;
 }
-Point_Cloud& Point_Cloud::operator=(const Point_Cloud& other177) {
-  pset = other177.pset;
+Point_Cloud& Point_Cloud::operator=(const Point_Cloud& other185) {
+  pset = other185.pset;
   return *this;
 }
 void Point_Cloud::printTo(std::ostream& out) const {
@@ -2599,11 +3229,11 @@ void swap(Surface_Mesh &a, Surface_Mesh &b) {
   swap(a.meshes, b.meshes);
 }
 
-Surface_Mesh::Surface_Mesh(const Surface_Mesh& other178) {
-  meshes = other178.meshes;
+Surface_Mesh::Surface_Mesh(const Surface_Mesh& other186) {
+  meshes = other186.meshes;
 }
-Surface_Mesh& Surface_Mesh::operator=(const Surface_Mesh& other179) {
-  meshes = other179.meshes;
+Surface_Mesh& Surface_Mesh::operator=(const Surface_Mesh& other187) {
+  meshes = other187.meshes;
   return *this;
 }
 void Surface_Mesh::printTo(std::ostream& out) const {
@@ -2903,14 +3533,14 @@ uint32_t Static_Machine_State::read(::apache::thrift::protocol::TProtocol* iprot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->JawPositionsX.clear();
-            uint32_t _size180;
-            ::apache::thrift::protocol::TType _etype183;
-            xfer += iprot->readListBegin(_etype183, _size180);
-            this->JawPositionsX.resize(_size180);
-            uint32_t _i184;
-            for (_i184 = 0; _i184 < _size180; ++_i184)
+            uint32_t _size188;
+            ::apache::thrift::protocol::TType _etype191;
+            xfer += iprot->readListBegin(_etype191, _size188);
+            this->JawPositionsX.resize(_size188);
+            uint32_t _i192;
+            for (_i192 = 0; _i192 < _size188; ++_i192)
             {
-              xfer += iprot->readDouble(this->JawPositionsX[_i184]);
+              xfer += iprot->readDouble(this->JawPositionsX[_i192]);
             }
             xfer += iprot->readListEnd();
           }
@@ -2923,14 +3553,14 @@ uint32_t Static_Machine_State::read(::apache::thrift::protocol::TProtocol* iprot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->JawPositionsY.clear();
-            uint32_t _size185;
-            ::apache::thrift::protocol::TType _etype188;
-            xfer += iprot->readListBegin(_etype188, _size185);
-            this->JawPositionsY.resize(_size185);
-            uint32_t _i189;
-            for (_i189 = 0; _i189 < _size185; ++_i189)
+            uint32_t _size193;
+            ::apache::thrift::protocol::TType _etype196;
+            xfer += iprot->readListBegin(_etype196, _size193);
+            this->JawPositionsY.resize(_size193);
+            uint32_t _i197;
+            for (_i197 = 0; _i197 < _size193; ++_i197)
             {
-              xfer += iprot->readDouble(this->JawPositionsY[_i189]);
+              xfer += iprot->readDouble(this->JawPositionsY[_i197]);
             }
             xfer += iprot->readListEnd();
           }
@@ -2943,14 +3573,14 @@ uint32_t Static_Machine_State::read(::apache::thrift::protocol::TProtocol* iprot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->MLCPositionsX.clear();
-            uint32_t _size190;
-            ::apache::thrift::protocol::TType _etype193;
-            xfer += iprot->readListBegin(_etype193, _size190);
-            this->MLCPositionsX.resize(_size190);
-            uint32_t _i194;
-            for (_i194 = 0; _i194 < _size190; ++_i194)
+            uint32_t _size198;
+            ::apache::thrift::protocol::TType _etype201;
+            xfer += iprot->readListBegin(_etype201, _size198);
+            this->MLCPositionsX.resize(_size198);
+            uint32_t _i202;
+            for (_i202 = 0; _i202 < _size198; ++_i202)
             {
-              xfer += iprot->readDouble(this->MLCPositionsX[_i194]);
+              xfer += iprot->readDouble(this->MLCPositionsX[_i202]);
             }
             xfer += iprot->readListEnd();
           }
@@ -2963,17 +3593,17 @@ uint32_t Static_Machine_State::read(::apache::thrift::protocol::TProtocol* iprot
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size195;
-            ::apache::thrift::protocol::TType _ktype196;
-            ::apache::thrift::protocol::TType _vtype197;
-            xfer += iprot->readMapBegin(_ktype196, _vtype197, _size195);
-            uint32_t _i199;
-            for (_i199 = 0; _i199 < _size195; ++_i199)
+            uint32_t _size203;
+            ::apache::thrift::protocol::TType _ktype204;
+            ::apache::thrift::protocol::TType _vtype205;
+            xfer += iprot->readMapBegin(_ktype204, _vtype205, _size203);
+            uint32_t _i207;
+            for (_i207 = 0; _i207 < _size203; ++_i207)
             {
-              std::string _key200;
-              xfer += iprot->readString(_key200);
-              std::string& _val201 = this->metadata[_key200];
-              xfer += iprot->readString(_val201);
+              std::string _key208;
+              xfer += iprot->readString(_key208);
+              std::string& _val209 = this->metadata[_key208];
+              xfer += iprot->readString(_val209);
             }
             xfer += iprot->readMapEnd();
           }
@@ -3118,10 +3748,10 @@ uint32_t Static_Machine_State::write(::apache::thrift::protocol::TProtocol* opro
   xfer += oprot->writeFieldBegin("JawPositionsX", ::apache::thrift::protocol::T_LIST, 19);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_DOUBLE, static_cast<uint32_t>(this->JawPositionsX.size()));
-    std::vector<double> ::const_iterator _iter202;
-    for (_iter202 = this->JawPositionsX.begin(); _iter202 != this->JawPositionsX.end(); ++_iter202)
+    std::vector<double> ::const_iterator _iter210;
+    for (_iter210 = this->JawPositionsX.begin(); _iter210 != this->JawPositionsX.end(); ++_iter210)
     {
-      xfer += oprot->writeDouble((*_iter202));
+      xfer += oprot->writeDouble((*_iter210));
     }
     xfer += oprot->writeListEnd();
   }
@@ -3130,10 +3760,10 @@ uint32_t Static_Machine_State::write(::apache::thrift::protocol::TProtocol* opro
   xfer += oprot->writeFieldBegin("JawPositionsY", ::apache::thrift::protocol::T_LIST, 20);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_DOUBLE, static_cast<uint32_t>(this->JawPositionsY.size()));
-    std::vector<double> ::const_iterator _iter203;
-    for (_iter203 = this->JawPositionsY.begin(); _iter203 != this->JawPositionsY.end(); ++_iter203)
+    std::vector<double> ::const_iterator _iter211;
+    for (_iter211 = this->JawPositionsY.begin(); _iter211 != this->JawPositionsY.end(); ++_iter211)
     {
-      xfer += oprot->writeDouble((*_iter203));
+      xfer += oprot->writeDouble((*_iter211));
     }
     xfer += oprot->writeListEnd();
   }
@@ -3142,10 +3772,10 @@ uint32_t Static_Machine_State::write(::apache::thrift::protocol::TProtocol* opro
   xfer += oprot->writeFieldBegin("MLCPositionsX", ::apache::thrift::protocol::T_LIST, 21);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_DOUBLE, static_cast<uint32_t>(this->MLCPositionsX.size()));
-    std::vector<double> ::const_iterator _iter204;
-    for (_iter204 = this->MLCPositionsX.begin(); _iter204 != this->MLCPositionsX.end(); ++_iter204)
+    std::vector<double> ::const_iterator _iter212;
+    for (_iter212 = this->MLCPositionsX.begin(); _iter212 != this->MLCPositionsX.end(); ++_iter212)
     {
-      xfer += oprot->writeDouble((*_iter204));
+      xfer += oprot->writeDouble((*_iter212));
     }
     xfer += oprot->writeListEnd();
   }
@@ -3154,11 +3784,11 @@ uint32_t Static_Machine_State::write(::apache::thrift::protocol::TProtocol* opro
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 22);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter205;
-    for (_iter205 = this->metadata.begin(); _iter205 != this->metadata.end(); ++_iter205)
+    std::map<std::string, std::string> ::const_iterator _iter213;
+    for (_iter213 = this->metadata.begin(); _iter213 != this->metadata.end(); ++_iter213)
     {
-      xfer += oprot->writeString(_iter205->first);
-      xfer += oprot->writeString(_iter205->second);
+      xfer += oprot->writeString(_iter213->first);
+      xfer += oprot->writeString(_iter213->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -3195,53 +3825,53 @@ void swap(Static_Machine_State &a, Static_Machine_State &b) {
   swap(a.metadata, b.metadata);
 }
 
-Static_Machine_State::Static_Machine_State(const Static_Machine_State& other206) {
-  CumulativeMetersetWeight = other206.CumulativeMetersetWeight;
-  ControlPointIndex = other206.ControlPointIndex;
-  GantryAngle = other206.GantryAngle;
-  GantryRotationDirection = other206.GantryRotationDirection;
-  BeamLimitingDeviceAngle = other206.BeamLimitingDeviceAngle;
-  BeamLimitingDeviceRotationDirection = other206.BeamLimitingDeviceRotationDirection;
-  PatientSupportAngle = other206.PatientSupportAngle;
-  PatientSupportRotationDirection = other206.PatientSupportRotationDirection;
-  TableTopEccentricAngle = other206.TableTopEccentricAngle;
-  TableTopEccentricRotationDirection = other206.TableTopEccentricRotationDirection;
-  TableTopVerticalPosition = other206.TableTopVerticalPosition;
-  TableTopLongitudinalPosition = other206.TableTopLongitudinalPosition;
-  TableTopLateralPosition = other206.TableTopLateralPosition;
-  TableTopPitchAngle = other206.TableTopPitchAngle;
-  TableTopPitchRotationDirection = other206.TableTopPitchRotationDirection;
-  TableTopRollAngle = other206.TableTopRollAngle;
-  TableTopRollRotationDirection = other206.TableTopRollRotationDirection;
-  IsocentrePosition = other206.IsocentrePosition;
-  JawPositionsX = other206.JawPositionsX;
-  JawPositionsY = other206.JawPositionsY;
-  MLCPositionsX = other206.MLCPositionsX;
-  metadata = other206.metadata;
-}
-Static_Machine_State& Static_Machine_State::operator=(const Static_Machine_State& other207) {
-  CumulativeMetersetWeight = other207.CumulativeMetersetWeight;
-  ControlPointIndex = other207.ControlPointIndex;
-  GantryAngle = other207.GantryAngle;
-  GantryRotationDirection = other207.GantryRotationDirection;
-  BeamLimitingDeviceAngle = other207.BeamLimitingDeviceAngle;
-  BeamLimitingDeviceRotationDirection = other207.BeamLimitingDeviceRotationDirection;
-  PatientSupportAngle = other207.PatientSupportAngle;
-  PatientSupportRotationDirection = other207.PatientSupportRotationDirection;
-  TableTopEccentricAngle = other207.TableTopEccentricAngle;
-  TableTopEccentricRotationDirection = other207.TableTopEccentricRotationDirection;
-  TableTopVerticalPosition = other207.TableTopVerticalPosition;
-  TableTopLongitudinalPosition = other207.TableTopLongitudinalPosition;
-  TableTopLateralPosition = other207.TableTopLateralPosition;
-  TableTopPitchAngle = other207.TableTopPitchAngle;
-  TableTopPitchRotationDirection = other207.TableTopPitchRotationDirection;
-  TableTopRollAngle = other207.TableTopRollAngle;
-  TableTopRollRotationDirection = other207.TableTopRollRotationDirection;
-  IsocentrePosition = other207.IsocentrePosition;
-  JawPositionsX = other207.JawPositionsX;
-  JawPositionsY = other207.JawPositionsY;
-  MLCPositionsX = other207.MLCPositionsX;
-  metadata = other207.metadata;
+Static_Machine_State::Static_Machine_State(const Static_Machine_State& other214) {
+  CumulativeMetersetWeight = other214.CumulativeMetersetWeight;
+  ControlPointIndex = other214.ControlPointIndex;
+  GantryAngle = other214.GantryAngle;
+  GantryRotationDirection = other214.GantryRotationDirection;
+  BeamLimitingDeviceAngle = other214.BeamLimitingDeviceAngle;
+  BeamLimitingDeviceRotationDirection = other214.BeamLimitingDeviceRotationDirection;
+  PatientSupportAngle = other214.PatientSupportAngle;
+  PatientSupportRotationDirection = other214.PatientSupportRotationDirection;
+  TableTopEccentricAngle = other214.TableTopEccentricAngle;
+  TableTopEccentricRotationDirection = other214.TableTopEccentricRotationDirection;
+  TableTopVerticalPosition = other214.TableTopVerticalPosition;
+  TableTopLongitudinalPosition = other214.TableTopLongitudinalPosition;
+  TableTopLateralPosition = other214.TableTopLateralPosition;
+  TableTopPitchAngle = other214.TableTopPitchAngle;
+  TableTopPitchRotationDirection = other214.TableTopPitchRotationDirection;
+  TableTopRollAngle = other214.TableTopRollAngle;
+  TableTopRollRotationDirection = other214.TableTopRollRotationDirection;
+  IsocentrePosition = other214.IsocentrePosition;
+  JawPositionsX = other214.JawPositionsX;
+  JawPositionsY = other214.JawPositionsY;
+  MLCPositionsX = other214.MLCPositionsX;
+  metadata = other214.metadata;
+}
+Static_Machine_State& Static_Machine_State::operator=(const Static_Machine_State& other215) {
+  CumulativeMetersetWeight = other215.CumulativeMetersetWeight;
+  ControlPointIndex = other215.ControlPointIndex;
+  GantryAngle = other215.GantryAngle;
+  GantryRotationDirection = other215.GantryRotationDirection;
+  BeamLimitingDeviceAngle = other215.BeamLimitingDeviceAngle;
+  BeamLimitingDeviceRotationDirection = other215.BeamLimitingDeviceRotationDirection;
+  PatientSupportAngle = other215.PatientSupportAngle;
+  PatientSupportRotationDirection = other215.PatientSupportRotationDirection;
+  TableTopEccentricAngle = other215.TableTopEccentricAngle;
+  TableTopEccentricRotationDirection = other215.TableTopEccentricRotationDirection;
+  TableTopVerticalPosition = other215.TableTopVerticalPosition;
+  TableTopLongitudinalPosition = other215.TableTopLongitudinalPosition;
+  TableTopLateralPosition = other215.TableTopLateralPosition;
+  TableTopPitchAngle = other215.TableTopPitchAngle;
+  TableTopPitchRotationDirection = other215.TableTopPitchRotationDirection;
+  TableTopRollAngle = other215.TableTopRollAngle;
+  TableTopRollRotationDirection = other215.TableTopRollRotationDirection;
+  IsocentrePosition = other215.IsocentrePosition;
+  JawPositionsX = other215.JawPositionsX;
+  JawPositionsY = other215.JawPositionsY;
+  MLCPositionsX = other215.MLCPositionsX;
+  metadata = other215.metadata;
   return *this;
 }
 void Static_Machine_State::printTo(std::ostream& out) const {
@@ -3344,14 +3974,14 @@ uint32_t Dynamic_Machine_State::read(::apache::thrift::protocol::TProtocol* ipro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->static_states.clear();
-            uint32_t _size208;
-            ::apache::thrift::protocol::TType _etype211;
-            xfer += iprot->readListBegin(_etype211, _size208);
-            this->static_states.resize(_size208);
-            uint32_t _i212;
-            for (_i212 = 0; _i212 < _size208; ++_i212)
+            uint32_t _size216;
+            ::apache::thrift::protocol::TType _etype219;
+            xfer += iprot->readListBegin(_etype219, _size216);
+            this->static_states.resize(_size216);
+            uint32_t _i220;
+            for (_i220 = 0; _i220 < _size216; ++_i220)
             {
-              xfer += this->static_states[_i212].read(iprot);
+              xfer += this->static_states[_i220].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -3364,17 +3994,17 @@ uint32_t Dynamic_Machine_State::read(::apache::thrift::protocol::TProtocol* ipro
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size213;
-            ::apache::thrift::protocol::TType _ktype214;
-            ::apache::thrift::protocol::TType _vtype215;
-            xfer += iprot->readMapBegin(_ktype214, _vtype215, _size213);
-            uint32_t _i217;
-            for (_i217 = 0; _i217 < _size213; ++_i217)
+            uint32_t _size221;
+            ::apache::thrift::protocol::TType _ktype222;
+            ::apache::thrift::protocol::TType _vtype223;
+            xfer += iprot->readMapBegin(_ktype222, _vtype223, _size221);
+            uint32_t _i225;
+            for (_i225 = 0; _i225 < _size221; ++_i225)
             {
-              std::string _key218;
-              xfer += iprot->readString(_key218);
-              std::string& _val219 = this->metadata[_key218];
-              xfer += iprot->readString(_val219);
+              std::string _key226;
+              xfer += iprot->readString(_key226);
+              std::string& _val227 = this->metadata[_key226];
+              xfer += iprot->readString(_val227);
             }
             xfer += iprot->readMapEnd();
           }
@@ -3419,10 +4049,10 @@ uint32_t Dynamic_Machine_State::write(::apache::thrift::protocol::TProtocol* opr
   xfer += oprot->writeFieldBegin("static_states", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->static_states.size()));
-    std::vector<Static_Machine_State> ::const_iterator _iter220;
-    for (_iter220 = this->static_states.begin(); _iter220 != this->static_states.end(); ++_iter220)
+    std::vector<Static_Machine_State> ::const_iterator _iter228;
+    for (_iter228 = this->static_states.begin(); _iter228 != this->static_states.end(); ++_iter228)
     {
-      xfer += (*_iter220).write(oprot);
+      xfer += (*_iter228).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -3431,11 +4061,11 @@ uint32_t Dynamic_Machine_State::write(::apache::thrift::protocol::TProtocol* opr
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter221;
-    for (_iter221 = this->metadata.begin(); _iter221 != this->metadata.end(); ++_iter221)
+    std::map<std::string, std::string> ::const_iterator _iter229;
+    for (_iter229 = this->metadata.begin(); _iter229 != this->metadata.end(); ++_iter229)
     {
-      xfer += oprot->writeString(_iter221->first);
-      xfer += oprot->writeString(_iter221->second);
+      xfer += oprot->writeString(_iter229->first);
+      xfer += oprot->writeString(_iter229->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -3454,17 +4084,17 @@ void swap(Dynamic_Machine_State &a, Dynamic_Machine_State &b) {
   swap(a.metadata, b.metadata);
 }
 
-Dynamic_Machine_State::Dynamic_Machine_State(const Dynamic_Machine_State& other222) {
-  BeamNumber = other222.BeamNumber;
-  FinalCumulativeMetersetWeight = other222.FinalCumulativeMetersetWeight;
-  static_states = other222.static_states;
-  metadata = other222.metadata;
+Dynamic_Machine_State::Dynamic_Machine_State(const Dynamic_Machine_State& other230) {
+  BeamNumber = other230.BeamNumber;
+  FinalCumulativeMetersetWeight = other230.FinalCumulativeMetersetWeight;
+  static_states = other230.static_states;
+  metadata = other230.metadata;
 }
-Dynamic_Machine_State& Dynamic_Machine_State::operator=(const Dynamic_Machine_State& other223) {
-  BeamNumber = other223.BeamNumber;
-  FinalCumulativeMetersetWeight = other223.FinalCumulativeMetersetWeight;
-  static_states = other223.static_states;
-  metadata = other223.metadata;
+Dynamic_Machine_State& Dynamic_Machine_State::operator=(const Dynamic_Machine_State& other231) {
+  BeamNumber = other231.BeamNumber;
+  FinalCumulativeMetersetWeight = other231.FinalCumulativeMetersetWeight;
+  static_states = other231.static_states;
+  metadata = other231.metadata;
   return *this;
 }
 void Dynamic_Machine_State::printTo(std::ostream& out) const {
@@ -3523,14 +4153,14 @@ uint32_t RTPlan::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->dynamic_states.clear();
-            uint32_t _size224;
-            ::apache::thrift::protocol::TType _etype227;
-            xfer += iprot->readListBegin(_etype227, _size224);
-            this->dynamic_states.resize(_size224);
-            uint32_t _i228;
-            for (_i228 = 0; _i228 < _size224; ++_i228)
+            uint32_t _size232;
+            ::apache::thrift::protocol::TType _etype235;
+            xfer += iprot->readListBegin(_etype235, _size232);
+            this->dynamic_states.resize(_size232);
+            uint32_t _i236;
+            for (_i236 = 0; _i236 < _size232; ++_i236)
             {
-              xfer += this->dynamic_states[_i228].read(iprot);
+              xfer += this->dynamic_states[_i236].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -3543,17 +4173,17 @@ uint32_t RTPlan::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->metadata.clear();
-            uint32_t _size229;
-            ::apache::thrift::protocol::TType _ktype230;
-            ::apache::thrift::protocol::TType _vtype231;
-            xfer += iprot->readMapBegin(_ktype230, _vtype231, _size229);
-            uint32_t _i233;
-            for (_i233 = 0; _i233 < _size229; ++_i233)
+            uint32_t _size237;
+            ::apache::thrift::protocol::TType _ktype238;
+            ::apache::thrift::protocol::TType _vtype239;
+            xfer += iprot->readMapBegin(_ktype238, _vtype239, _size237);
+            uint32_t _i241;
+            for (_i241 = 0; _i241 < _size237; ++_i241)
             {
-              std::string _key234;
-              xfer += iprot->readString(_key234);
-              std::string& _val235 = this->metadata[_key234];
-              xfer += iprot->readString(_val235);
+              std::string _key242;
+              xfer += iprot->readString(_key242);
+              std::string& _val243 = this->metadata[_key242];
+              xfer += iprot->readString(_val243);
             }
             xfer += iprot->readMapEnd();
           }
@@ -3586,10 +4216,10 @@ uint32_t RTPlan::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeFieldBegin("dynamic_states", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->dynamic_states.size()));
-    std::vector<Dynamic_Machine_State> ::const_iterator _iter236;
-    for (_iter236 = this->dynamic_states.begin(); _iter236 != this->dynamic_states.end(); ++_iter236)
+    std::vector<Dynamic_Machine_State> ::const_iterator _iter244;
+    for (_iter244 = this->dynamic_states.begin(); _iter244 != this->dynamic_states.end(); ++_iter244)
     {
-      xfer += (*_iter236).write(oprot);
+      xfer += (*_iter244).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -3598,11 +4228,11 @@ uint32_t RTPlan::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeFieldBegin("metadata", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter237;
-    for (_iter237 = this->metadata.begin(); _iter237 != this->metadata.end(); ++_iter237)
+    std::map<std::string, std::string> ::const_iterator _iter245;
+    for (_iter245 = this->metadata.begin(); _iter245 != this->metadata.end(); ++_iter245)
     {
-      xfer += oprot->writeString(_iter237->first);
-      xfer += oprot->writeString(_iter237->second);
+      xfer += oprot->writeString(_iter245->first);
+      xfer += oprot->writeString(_iter245->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -3619,13 +4249,13 @@ void swap(RTPlan &a, RTPlan &b) {
   swap(a.metadata, b.metadata);
 }
 
-RTPlan::RTPlan(const RTPlan& other238) {
-  dynamic_states = other238.dynamic_states;
-  metadata = other238.metadata;
+RTPlan::RTPlan(const RTPlan& other246) {
+  dynamic_states = other246.dynamic_states;
+  metadata = other246.metadata;
 }
-RTPlan& RTPlan::operator=(const RTPlan& other239) {
-  dynamic_states = other239.dynamic_states;
-  metadata = other239.metadata;
+RTPlan& RTPlan::operator=(const RTPlan& other247) {
+  dynamic_states = other247.dynamic_states;
+  metadata = other247.metadata;
   return *this;
 }
 void RTPlan::printTo(std::ostream& out) const {
@@ -3714,11 +4344,11 @@ void swap(Line_Sample &a, Line_Sample &b) {
   swap(a.line, b.line);
 }
 
-Line_Sample::Line_Sample(const Line_Sample& other240) {
-  line = other240.line;
+Line_Sample::Line_Sample(const Line_Sample& other248) {
+  line = other248.line;
 }
-Line_Sample& Line_Sample::operator=(const Line_Sample& other241) {
-  line = other241.line;
+Line_Sample& Line_Sample::operator=(const Line_Sample& other249) {
+  line = other249.line;
   return *this;
 }
 void Line_Sample::printTo(std::ostream& out) const {
@@ -3783,11 +4413,11 @@ void swap(Transform3 &a, Transform3 &b) {
   (void) b;
 }
 
-Transform3::Transform3(const Transform3& other242) noexcept {
-  (void) other242;
+Transform3::Transform3(const Transform3& other250) noexcept {
+  (void) other250;
 }
-Transform3& Transform3::operator=(const Transform3& other243) noexcept {
-  (void) other243;
+Transform3& Transform3::operator=(const Transform3& other251) noexcept {
+  (void) other251;
   return *this;
 }
 void Transform3::printTo(std::ostream& out) const {
@@ -3874,11 +4504,11 @@ void swap(Sparse_Table &a, Sparse_Table &b) {
   swap(a.table, b.table);
 }
 
-Sparse_Table::Sparse_Table(const Sparse_Table& other244) {
-  table = other244.table;
+Sparse_Table::Sparse_Table(const Sparse_Table& other252) {
+  table = other252.table;
 }
-Sparse_Table& Sparse_Table::operator=(const Sparse_Table& other245) {
-  table = other245.table;
+Sparse_Table& Sparse_Table::operator=(const Sparse_Table& other253) {
+  table = other253.table;
   return *this;
 }
 void Sparse_Table::printTo(std::ostream& out) const {
@@ -3964,14 +4594,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->contour_data.clear();
-            uint32_t _size246;
-            ::apache::thrift::protocol::TType _etype249;
-            xfer += iprot->readListBegin(_etype249, _size246);
-            this->contour_data.resize(_size246);
-            uint32_t _i250;
-            for (_i250 = 0; _i250 < _size246; ++_i250)
+            uint32_t _size254;
+            ::apache::thrift::protocol::TType _etype257;
+            xfer += iprot->readListBegin(_etype257, _size254);
+            this->contour_data.resize(_size254);
+            uint32_t _i258;
+            for (_i258 = 0; _i258 < _size254; ++_i258)
             {
-              xfer += this->contour_data[_i250].read(iprot);
+              xfer += this->contour_data[_i258].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -3984,14 +4614,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->image_data.clear();
-            uint32_t _size251;
-            ::apache::thrift::protocol::TType _etype254;
-            xfer += iprot->readListBegin(_etype254, _size251);
-            this->image_data.resize(_size251);
-            uint32_t _i255;
-            for (_i255 = 0; _i255 < _size251; ++_i255)
+            uint32_t _size259;
+            ::apache::thrift::protocol::TType _etype262;
+            xfer += iprot->readListBegin(_etype262, _size259);
+            this->image_data.resize(_size259);
+            uint32_t _i263;
+            for (_i263 = 0; _i263 < _size259; ++_i263)
             {
-              xfer += this->image_data[_i255].read(iprot);
+              xfer += this->image_data[_i263].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4004,14 +4634,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->point_data.clear();
-            uint32_t _size256;
-            ::apache::thrift::protocol::TType _etype259;
-            xfer += iprot->readListBegin(_etype259, _size256);
-            this->point_data.resize(_size256);
-            uint32_t _i260;
-            for (_i260 = 0; _i260 < _size256; ++_i260)
+            uint32_t _size264;
+            ::apache::thrift::protocol::TType _etype267;
+            xfer += iprot->readListBegin(_etype267, _size264);
+            this->point_data.resize(_size264);
+            uint32_t _i268;
+            for (_i268 = 0; _i268 < _size264; ++_i268)
             {
-              xfer += this->point_data[_i260].read(iprot);
+              xfer += this->point_data[_i268].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4024,14 +4654,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->smesh_data.clear();
-            uint32_t _size261;
-            ::apache::thrift::protocol::TType _etype264;
-            xfer += iprot->readListBegin(_etype264, _size261);
-            this->smesh_data.resize(_size261);
-            uint32_t _i265;
-            for (_i265 = 0; _i265 < _size261; ++_i265)
+            uint32_t _size269;
+            ::apache::thrift::protocol::TType _etype272;
+            xfer += iprot->readListBegin(_etype272, _size269);
+            this->smesh_data.resize(_size269);
+            uint32_t _i273;
+            for (_i273 = 0; _i273 < _size269; ++_i273)
             {
-              xfer += this->smesh_data[_i265].read(iprot);
+              xfer += this->smesh_data[_i273].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4044,14 +4674,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->rtplan_data.clear();
-            uint32_t _size266;
-            ::apache::thrift::protocol::TType _etype269;
-            xfer += iprot->readListBegin(_etype269, _size266);
-            this->rtplan_data.resize(_size266);
-            uint32_t _i270;
-            for (_i270 = 0; _i270 < _size266; ++_i270)
+            uint32_t _size274;
+            ::apache::thrift::protocol::TType _etype277;
+            xfer += iprot->readListBegin(_etype277, _size274);
+            this->rtplan_data.resize(_size274);
+            uint32_t _i278;
+            for (_i278 = 0; _i278 < _size274; ++_i278)
             {
-              xfer += this->rtplan_data[_i270].read(iprot);
+              xfer += this->rtplan_data[_i278].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4064,14 +4694,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->lsamp_data.clear();
-            uint32_t _size271;
-            ::apache::thrift::protocol::TType _etype274;
-            xfer += iprot->readListBegin(_etype274, _size271);
-            this->lsamp_data.resize(_size271);
-            uint32_t _i275;
-            for (_i275 = 0; _i275 < _size271; ++_i275)
+            uint32_t _size279;
+            ::apache::thrift::protocol::TType _etype282;
+            xfer += iprot->readListBegin(_etype282, _size279);
+            this->lsamp_data.resize(_size279);
+            uint32_t _i283;
+            for (_i283 = 0; _i283 < _size279; ++_i283)
             {
-              xfer += this->lsamp_data[_i275].read(iprot);
+              xfer += this->lsamp_data[_i283].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4084,14 +4714,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->trans_data.clear();
-            uint32_t _size276;
-            ::apache::thrift::protocol::TType _etype279;
-            xfer += iprot->readListBegin(_etype279, _size276);
-            this->trans_data.resize(_size276);
-            uint32_t _i280;
-            for (_i280 = 0; _i280 < _size276; ++_i280)
+            uint32_t _size284;
+            ::apache::thrift::protocol::TType _etype287;
+            xfer += iprot->readListBegin(_etype287, _size284);
+            this->trans_data.resize(_size284);
+            uint32_t _i288;
+            for (_i288 = 0; _i288 < _size284; ++_i288)
             {
-              xfer += this->trans_data[_i280].read(iprot);
+              xfer += this->trans_data[_i288].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4104,14 +4734,14 @@ uint32_t Drover::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->table_data.clear();
-            uint32_t _size281;
-            ::apache::thrift::protocol::TType _etype284;
-            xfer += iprot->readListBegin(_etype284, _size281);
-            this->table_data.resize(_size281);
-            uint32_t _i285;
-            for (_i285 = 0; _i285 < _size281; ++_i285)
+            uint32_t _size289;
+            ::apache::thrift::protocol::TType _etype292;
+            xfer += iprot->readListBegin(_etype292, _size289);
+            this->table_data.resize(_size289);
+            uint32_t _i293;
+            for (_i293 = 0; _i293 < _size289; ++_i293)
             {
-              xfer += this->table_data[_i285].read(iprot);
+              xfer += this->table_data[_i293].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4141,10 +4771,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("contour_data", ::apache::thrift::protocol::T_LIST, 1);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->contour_data.size()));
-      std::vector<Contour_Data> ::const_iterator _iter286;
-      for (_iter286 = this->contour_data.begin(); _iter286 != this->contour_data.end(); ++_iter286)
+      std::vector<Contour_Data> ::const_iterator _iter294;
+      for (_iter294 = this->contour_data.begin(); _iter294 != this->contour_data.end(); ++_iter294)
       {
-        xfer += (*_iter286).write(oprot);
+        xfer += (*_iter294).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4154,10 +4784,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("image_data", ::apache::thrift::protocol::T_LIST, 2);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->image_data.size()));
-      std::vector<Image_Array> ::const_iterator _iter287;
-      for (_iter287 = this->image_data.begin(); _iter287 != this->image_data.end(); ++_iter287)
+      std::vector<Image_Array> ::const_iterator _iter295;
+      for (_iter295 = this->image_data.begin(); _iter295 != this->image_data.end(); ++_iter295)
       {
-        xfer += (*_iter287).write(oprot);
+        xfer += (*_iter295).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4167,10 +4797,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("point_data", ::apache::thrift::protocol::T_LIST, 3);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->point_data.size()));
-      std::vector<Point_Cloud> ::const_iterator _iter288;
-      for (_iter288 = this->point_data.begin(); _iter288 != this->point_data.end(); ++_iter288)
+      std::vector<Point_Cloud> ::const_iterator _iter296;
+      for (_iter296 = this->point_data.begin(); _iter296 != this->point_data.end(); ++_iter296)
       {
-        xfer += (*_iter288).write(oprot);
+        xfer += (*_iter296).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4180,10 +4810,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("smesh_data", ::apache::thrift::protocol::T_LIST, 4);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->smesh_data.size()));
-      std::vector<Surface_Mesh> ::const_iterator _iter289;
-      for (_iter289 = this->smesh_data.begin(); _iter289 != this->smesh_data.end(); ++_iter289)
+      std::vector<Surface_Mesh> ::const_iterator _iter297;
+      for (_iter297 = this->smesh_data.begin(); _iter297 != this->smesh_data.end(); ++_iter297)
       {
-        xfer += (*_iter289).write(oprot);
+        xfer += (*_iter297).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4193,10 +4823,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("rtplan_data", ::apache::thrift::protocol::T_LIST, 5);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->rtplan_data.size()));
-      std::vector<RTPlan> ::const_iterator _iter290;
-      for (_iter290 = this->rtplan_data.begin(); _iter290 != this->rtplan_data.end(); ++_iter290)
+      std::vector<RTPlan> ::const_iterator _iter298;
+      for (_iter298 = this->rtplan_data.begin(); _iter298 != this->rtplan_data.end(); ++_iter298)
       {
-        xfer += (*_iter290).write(oprot);
+        xfer += (*_iter298).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4206,10 +4836,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("lsamp_data", ::apache::thrift::protocol::T_LIST, 6);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->lsamp_data.size()));
-      std::vector<Line_Sample> ::const_iterator _iter291;
-      for (_iter291 = this->lsamp_data.begin(); _iter291 != this->lsamp_data.end(); ++_iter291)
+      std::vector<Line_Sample> ::const_iterator _iter299;
+      for (_iter299 = this->lsamp_data.begin(); _iter299 != this->lsamp_data.end(); ++_iter299)
       {
-        xfer += (*_iter291).write(oprot);
+        xfer += (*_iter299).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4219,10 +4849,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("trans_data", ::apache::thrift::protocol::T_LIST, 7);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->trans_data.size()));
-      std::vector<Transform3> ::const_iterator _iter292;
-      for (_iter292 = this->trans_data.begin(); _iter292 != this->trans_data.end(); ++_iter292)
+      std::vector<Transform3> ::const_iterator _iter300;
+      for (_iter300 = this->trans_data.begin(); _iter300 != this->trans_data.end(); ++_iter300)
       {
-        xfer += (*_iter292).write(oprot);
+        xfer += (*_iter300).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4232,10 +4862,10 @@ uint32_t Drover::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("table_data", ::apache::thrift::protocol::T_LIST, 8);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->table_data.size()));
-      std::vector<Sparse_Table> ::const_iterator _iter293;
-      for (_iter293 = this->table_data.begin(); _iter293 != this->table_data.end(); ++_iter293)
+      std::vector<Sparse_Table> ::const_iterator _iter301;
+      for (_iter301 = this->table_data.begin(); _iter301 != this->table_data.end(); ++_iter301)
       {
-        xfer += (*_iter293).write(oprot);
+        xfer += (*_iter301).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4259,27 +4889,27 @@ void swap(Drover &a, Drover &b) {
   swap(a.__isset, b.__isset);
 }
 
-Drover::Drover(const Drover& other294) {
-  contour_data = other294.contour_data;
-  image_data = other294.image_data;
-  point_data = other294.point_data;
-  smesh_data = other294.smesh_data;
-  rtplan_data = other294.rtplan_data;
-  lsamp_data = other294.lsamp_data;
-  trans_data = other294.trans_data;
-  table_data = other294.table_data;
-  __isset = other294.__isset;
-}
-Drover& Drover::operator=(const Drover& other295) {
-  contour_data = other295.contour_data;
-  image_data = other295.image_data;
-  point_data = other295.point_data;
-  smesh_data = other295.smesh_data;
-  rtplan_data = other295.rtplan_data;
-  lsamp_data = other295.lsamp_data;
-  trans_data = other295.trans_data;
-  table_data = other295.table_data;
-  __isset = other295.__isset;
+Drover::Drover(const Drover& other302) {
+  contour_data = other302.contour_data;
+  image_data = other302.image_data;
+  point_data = other302.point_data;
+  smesh_data = other302.smesh_data;
+  rtplan_data = other302.rtplan_data;
+  lsamp_data = other302.lsamp_data;
+  trans_data = other302.trans_data;
+  table_data = other302.table_data;
+  __isset = other302.__isset;
+}
+Drover& Drover::operator=(const Drover& other303) {
+  contour_data = other303.contour_data;
+  image_data = other303.image_data;
+  point_data = other303.point_data;
+  smesh_data = other303.smesh_data;
+  rtplan_data = other303.rtplan_data;
+  lsamp_data = other303.lsamp_data;
+  trans_data = other303.trans_data;
+  table_data = other303.table_data;
+  __isset = other303.__isset;
   return *this;
 }
 void Drover::printTo(std::ostream& out) const {
@@ -4351,11 +4981,11 @@ void swap(OperationsQuery &a, OperationsQuery &b) {
   (void) b;
 }
 
-OperationsQuery::OperationsQuery(const OperationsQuery& other296) noexcept {
-  (void) other296;
+OperationsQuery::OperationsQuery(const OperationsQuery& other304) noexcept {
+  (void) other304;
 }
-OperationsQuery& OperationsQuery::operator=(const OperationsQuery& other297) noexcept {
-  (void) other297;
+OperationsQuery& OperationsQuery::operator=(const OperationsQuery& other305) noexcept {
+  (void) other305;
   return *this;
 }
 void OperationsQuery::printTo(std::ostream& out) const {
@@ -4442,11 +5072,11 @@ void swap(KnownOperation &a, KnownOperation &b) {
   swap(a.name, b.name);
 }
 
-KnownOperation::KnownOperation(const KnownOperation& other298) {
-  name = other298.name;
+KnownOperation::KnownOperation(const KnownOperation& other306) {
+  name = other306.name;
 }
-KnownOperation& KnownOperation::operator=(const KnownOperation& other299) {
-  name = other299.name;
+KnownOperation& KnownOperation::operator=(const KnownOperation& other307) {
+  name = other307.name;
   return *this;
 }
 void KnownOperation::printTo(std::ostream& out) const {
@@ -4464,6 +5094,11 @@ LoadFilesQuery::~LoadFilesQuery() noexcept {
 void LoadFilesQuery::__set_server_filename(const std::string& val) {
   this->server_filename = val;
 }
+
+void LoadFilesQuery::__set_response_encoding(const bulk_encoding& val) {
+  this->response_encoding = val;
+__isset.response_encoding = true;
+}
 std::ostream& operator<<(std::ostream& out, const LoadFilesQuery& obj)
 {
   obj.printTo(out);
@@ -4501,6 +5136,14 @@ uint32_t LoadFilesQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->response_encoding.read(iprot);
+          this->__isset.response_encoding = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4524,6 +5167,11 @@ uint32_t LoadFilesQuery::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeString(this->server_filename);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.response_encoding) {
+    xfer += oprot->writeFieldBegin("response_encoding", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->response_encoding.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -4532,19 +5180,26 @@ uint32_t LoadFilesQuery::write(::apache::thrift::protocol::TProtocol* oprot) con
 void swap(LoadFilesQuery &a, LoadFilesQuery &b) {
   using ::std::swap;
   swap(a.server_filename, b.server_filename);
+  swap(a.response_encoding, b.response_encoding);
+  swap(a.__isset, b.__isset);
 }
 
-LoadFilesQuery::LoadFilesQuery(const LoadFilesQuery& other300) {
-  server_filename = other300.server_filename;
+LoadFilesQuery::LoadFilesQuery(const LoadFilesQuery& other308) {
+  server_filename = other308.server_filename;
+  response_encoding = other308.response_encoding;
+  __isset = other308.__isset;
 }
-LoadFilesQuery& LoadFilesQuery::operator=(const LoadFilesQuery& other301) {
-  server_filename = other301.server_filename;
+LoadFilesQuery& LoadFilesQuery::operator=(const LoadFilesQuery& other309) {
+  server_filename = other309.server_filename;
+  response_encoding = other309.response_encoding;
+  __isset = other309.__isset;
   return *this;
 }
 void LoadFilesQuery::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
   out << "LoadFilesQuery(";
   out << "server_filename=" << to_string(server_filename);
+  out << ", " << "response_encoding="; (__isset.response_encoding ? (out << to_string(response_encoding)) : (out << "<null>"));
   out << ")";
 }
 
@@ -4646,15 +5301,15 @@ void swap(LoadFilesResponse &a, LoadFilesResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-LoadFilesResponse::LoadFilesResponse(const LoadFilesResponse& other302) {
-  success = other302.success;
-  drover = other302.drover;
-  __isset = other302.__isset;
+LoadFilesResponse::LoadFilesResponse(const LoadFilesResponse& other310) {
+  success = other310.success;
+  drover = other310.drover;
+  __isset = other310.__isset;
 }
-LoadFilesResponse& LoadFilesResponse::operator=(const LoadFilesResponse& other303) {
-  success = other303.success;
-  drover = other303.drover;
-  __isset = other303.__isset;
+LoadFilesResponse& LoadFilesResponse::operator=(const LoadFilesResponse& other311) {
+  success = other311.success;
+  drover = other311.drover;
+  __isset = other311.__isset;
   return *this;
 }
 void LoadFilesResponse::printTo(std::ostream& out) const {
@@ -4681,6 +5336,11 @@ void ExecuteScriptQuery::__set_invocation_metadata(const metadata_t& val) {
 void ExecuteScriptQuery::__set_filename_lex(const std::string& val) {
   this->filename_lex = val;
 }
+
+void ExecuteScriptQuery::__set_response_encoding(const bulk_encoding& val) {
+  this->response_encoding = val;
+__isset.response_encoding = true;
+}
 std::ostream& operator<<(std::ostream& out, const ExecuteScriptQuery& obj)
 {
   obj.printTo(out);
@@ -4724,17 +5384,17 @@ uint32_t ExecuteScriptQuery::read(::apache::thrift::protocol::TProtocol* iprot)
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->invocation_metadata.clear();
-            uint32_t _size304;
-            ::apache::thrift::protocol::TType _ktype305;
-            ::apache::thrift::protocol::TType _vtype306;
-            xfer += iprot->readMapBegin(_ktype305, _vtype306, _size304);
-            uint32_t _i308;
-            for (_i308 = 0; _i308 < _size304; ++_i308)
+            uint32_t _size312;
+            ::apache::thrift::protocol::TType _ktype313;
+            ::apache::thrift::protocol::TType _vtype314;
+            xfer += iprot->readMapBegin(_ktype313, _vtype314, _size312);
+            uint32_t _i316;
+            for (_i316 = 0; _i316 < _size312; ++_i316)
             {
-              std::string _key309;
-              xfer += iprot->readString(_key309);
-              std::string& _val310 = this->invocation_metadata[_key309];
-              xfer += iprot->readString(_val310);
+              std::string _key317;
+              xfer += iprot->readString(_key317);
+              std::string& _val318 = this->invocation_metadata[_key317];
+              xfer += iprot->readString(_val318);
             }
             xfer += iprot->readMapEnd();
           }
@@ -4751,6 +5411,14 @@ uint32_t ExecuteScriptQuery::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->response_encoding.read(iprot);
+          this->__isset.response_encoding = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4781,11 +5449,11 @@ uint32_t ExecuteScriptQuery::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeFieldBegin("invocation_metadata", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->invocation_metadata.size()));
-    std::map<std::string, std::string> ::const_iterator _iter311;
-    for (_iter311 = this->invocation_metadata.begin(); _iter311 != this->invocation_metadata.end(); ++_iter311)
+    std::map<std::string, std::string> ::const_iterator _iter319;
+    for (_iter319 = this->invocation_metadata.begin(); _iter319 != this->invocation_metadata.end(); ++_iter319)
     {
-      xfer += oprot->writeString(_iter311->first);
-      xfer += oprot->writeString(_iter311->second);
+      xfer += oprot->writeString(_iter319->first);
+      xfer += oprot->writeString(_iter319->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -4795,6 +5463,11 @@ uint32_t ExecuteScriptQuery::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeString(this->filename_lex);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.response_encoding) {
+    xfer += oprot->writeFieldBegin("response_encoding", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->response_encoding.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -4805,17 +5478,23 @@ void swap(ExecuteScriptQuery &a, ExecuteScriptQuery &b) {
   swap(a.drover, b.drover);
   swap(a.invocation_metadata, b.invocation_metadata);
   swap(a.filename_lex, b.filename_lex);
+  swap(a.response_encoding, b.response_encoding);
+  swap(a.__isset, b.__isset);
 }
 
-ExecuteScriptQuery::ExecuteScriptQuery(const ExecuteScriptQuery& other312) {
-  drover = other312.drover;
-  invocation_metadata = other312.invocation_metadata;
-  filename_lex = other312.filename_lex;
+ExecuteScriptQuery::ExecuteScriptQuery(const ExecuteScriptQuery& other320) {
+  drover = other320.drover;
+  invocation_metadata = other320.invocation_metadata;
+  filename_lex = other320.filename_lex;
+  response_encoding = other320.response_encoding;
+  __isset = other320.__isset;
 }
-ExecuteScriptQuery& ExecuteScriptQuery::operator=(const ExecuteScriptQuery& other313) {
-  drover = other313.drover;
-  invocation_metadata = other313.invocation_metadata;
-  filename_lex = other313.filename_lex;
+ExecuteScriptQuery& ExecuteScriptQuery::operator=(const ExecuteScriptQuery& other321) {
+  drover = other321.drover;
+  invocation_metadata = other321.invocation_metadata;
+  filename_lex = other321.filename_lex;
+  response_encoding = other321.response_encoding;
+  __isset = other321.__isset;
   return *this;
 }
 void ExecuteScriptQuery::printTo(std::ostream& out) const {
@@ -4824,6 +5503,7 @@ void ExecuteScriptQuery::printTo(std::ostream& out) const {
   out << "drover=" << to_string(drover);
   out << ", " << "invocation_metadata=" << to_string(invocation_metadata);
   out << ", " << "filename_lex=" << to_string(filename_lex);
+  out << ", " << "response_encoding="; (__isset.response_encoding ? (out << to_string(response_encoding)) : (out << "<null>"));
   out << ")";
 }
 
@@ -4899,17 +5579,17 @@ uint32_t ExecuteScriptResponse::read(::apache::thrift::protocol::TProtocol* ipro
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->invocation_metadata.clear();
-            uint32_t _size314;
-            ::apache::thrift::protocol::TType _ktype315;
-            ::apache::thrift::protocol::TType _vtype316;
-            xfer += iprot->readMapBegin(_ktype315, _vtype316, _size314);
-            uint32_t _i318;
-            for (_i318 = 0; _i318 < _size314; ++_i318)
+            uint32_t _size322;
+            ::apache::thrift::protocol::TType _ktype323;
+            ::apache::thrift::protocol::TType _vtype324;
+            xfer += iprot->readMapBegin(_ktype323, _vtype324, _size322);
+            uint32_t _i326;
+            for (_i326 = 0; _i326 < _size322; ++_i326)
             {
-              std::string _key319;
-              xfer += iprot->readString(_key319);
-              std::string& _val320 = this->invocation_metadata[_key319];
-              xfer += iprot->readString(_val320);
+              std::string _key327;
+              xfer += iprot->readString(_key327);
+              std::string& _val328 = this->invocation_metadata[_key327];
+              xfer += iprot->readString(_val328);
             }
             xfer += iprot->readMapEnd();
           }
@@ -4958,11 +5638,11 @@ uint32_t ExecuteScriptResponse::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("invocation_metadata", ::apache::thrift::protocol::T_MAP, 3);
     {
       xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->invocation_metadata.size()));
-      std::map<std::string, std::string> ::const_iterator _iter321;
-      for (_iter321 = this->invocation_metadata.begin(); _iter321 != this->invocation_metadata.end(); ++_iter321)
+      std::map<std::string, std::string> ::const_iterator _iter329;
+      for (_iter329 = this->invocation_metadata.begin(); _iter329 != this->invocation_metadata.end(); ++_iter329)
       {
-        xfer += oprot->writeString(_iter321->first);
-        xfer += oprot->writeString(_iter321->second);
+        xfer += oprot->writeString(_iter329->first);
+        xfer += oprot->writeString(_iter329->second);
       }
       xfer += oprot->writeMapEnd();
     }
@@ -4987,19 +5667,19 @@ void swap(ExecuteScriptResponse &a, ExecuteScriptResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ExecuteScriptResponse::ExecuteScriptResponse(const ExecuteScriptResponse& other322) {
-  success = other322.success;
-  drover = other322.drover;
-  invocation_metadata = other322.invocation_metadata;
-  filename_lex = other322.filename_lex;
-  __isset = other322.__isset;
+ExecuteScriptResponse::ExecuteScriptResponse(const ExecuteScriptResponse& other330) {
+  success = other330.success;
+  drover = other330.drover;
+  invocation_metadata = other330.invocation_metadata;
+  filename_lex = other330.filename_lex;
+  __isset = other330.__isset;
 }
-ExecuteScriptResponse& ExecuteScriptResponse::operator=(const ExecuteScriptResponse& other323) {
-  success = other323.success;
-  drover = other323.drover;
-  invocation_metadata = other323.invocation_metadata;
-  filename_lex = other323.filename_lex;
-  __isset = other323.__isset;
+ExecuteScriptResponse& ExecuteScriptResponse::operator=(const ExecuteScriptResponse& other331) {
+  success = other331.success;
+  drover = other331.drover;
+  invocation_metadata = other331.invocation_metadata;
+  filename_lex = other331.filename_lex;
+  __isset = other331.__isset;
   return *this;
 }
 void ExecuteScriptResponse::printTo(std::ostream& out) const {
@@ -5012,4 +5692,233 @@ void ExecuteScriptResponse::printTo(std::ostream& out) const {
   out << ")";
 }
 
+
+ProtocolQuery::~ProtocolQuery() noexcept {
+}
+
+
+void ProtocolQuery::__set_client_version(const int64_t val) {
+  this->client_version = val;
+}
+std::ostream& operator<<(std::ostream& out, const ProtocolQuery& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ProtocolQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_client_version = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->client_version);
+          isset_client_version = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_client_version)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t ProtocolQuery::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ProtocolQuery");
+
+  xfer += oprot->writeFieldBegin("client_version", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->client_version);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ProtocolQuery &a, ProtocolQuery &b) {
+  using ::std::swap;
+  swap(a.client_version, b.client_version);
+}
+
+ProtocolQuery::ProtocolQuery(const ProtocolQuery& other332) noexcept {
+  client_version = other332.client_version;
+}
+ProtocolQuery& ProtocolQuery::operator=(const ProtocolQuery& other333) noexcept {
+  client_version = other333.client_version;
+  return *this;
+}
+void ProtocolQuery::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ProtocolQuery(";
+  out << "client_version=" << to_string(client_version);
+  out << ")";
+}
+
+
+ProtocolInfo::~ProtocolInfo() noexcept {
+}
+
+
+void ProtocolInfo::__set_server_version(const int64_t val) {
+  this->server_version = val;
+}
+
+void ProtocolInfo::__set_compressions(const std::vector<bulk_compression::type> & val) {
+  this->compressions = val;
+}
+std::ostream& operator<<(std::ostream& out, const ProtocolInfo& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ProtocolInfo::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_server_version = false;
+  bool isset_compressions = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->server_version);
+          isset_server_version = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->compressions.clear();
+            uint32_t _size334;
+            ::apache::thrift::protocol::TType _etype337;
+            xfer += iprot->readListBegin(_etype337, _size334);
+            this->compressions.resize(_size334);
+            uint32_t _i338;
+            for (_i338 = 0; _i338 < _size334; ++_i338)
+            {
+              int32_t ecast339;
+              xfer += iprot->readI32(ecast339);
+              this->compressions[_i338] = static_cast<bulk_compression::type>(ecast339);
+            }
+            xfer += iprot->readListEnd();
+          }
+          isset_compressions = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_server_version)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_compressions)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t ProtocolInfo::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ProtocolInfo");
+
+  xfer += oprot->writeFieldBegin("server_version", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->server_version);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compressions", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->compressions.size()));
+    std::vector<bulk_compression::type> ::const_iterator _iter340;
+    for (_iter340 = this->compressions.begin(); _iter340 != this->compressions.end(); ++_iter340)
+    {
+      xfer += oprot->writeI32(static_cast<int32_t>((*_iter340)));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ProtocolInfo &a, ProtocolInfo &b) {
+  using ::std::swap;
+  swap(a.server_version, b.server_version);
+  swap(a.compressions, b.compressions);
+}
+
+ProtocolInfo::ProtocolInfo(const ProtocolInfo& other341) {
+  server_version = other341.server_version;
+  compressions = other341.compressions;
+}
+ProtocolInfo& ProtocolInfo::operator=(const ProtocolInfo& other342) {
+  server_version = other342.server_version;
+  compressions = other342.compressions;
+  return *this;
+}
+void ProtocolInfo::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ProtocolInfo(";
+  out << "server_version=" << to_string(server_version);
+  out << ", " << "compressions=" << to_string(compressions);
+  out << ")";
+}
+
 }} // namespace
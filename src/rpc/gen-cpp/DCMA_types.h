@@ -21,8 +21,53 @@
 
 namespace dcma { namespace rpc {
 
+struct bulk_dtype {
+  enum type {
+    FLOAT32 = 1,
+    FLOAT64 = 2,
+    UINT32 = 3,
+    UINT64 = 4
+  };
+};
+
+extern const std::map<int, const char*> _bulk_dtype_VALUES_TO_NAMES;
+
+std::ostream& operator<<(std::ostream& out, const bulk_dtype::type& val);
+
+std::string to_string(const bulk_dtype::type& val);
+
+struct bulk_endianness {
+  enum type {
+    LITTLE = 1,
+    BIG = 2
+  };
+};
+
+extern const std::map<int, const char*> _bulk_endianness_VALUES_TO_NAMES;
+
+std::ostream& operator<<(std::ostream& out, const bulk_endianness::type& val);
+
+std::string to_string(const bulk_endianness::type& val);
+
+struct bulk_compression {
+  enum type {
+    UNCOMPRESSED = 0,
+    ZLIB = 1
+  };
+};
+
+extern const std::map<int, const char*> _bulk_compression_VALUES_TO_NAMES;
+
+std::ostream& operator<<(std::ostream& out, const bulk_compression::type& val);
+
+std::string to_string(const bulk_compression::type& val);
+
 typedef std::map<std::string, std::string>  metadata_t;
 
+class bulk_array;
+
+class bulk_encoding;
+
 class vec3_double;
 
 class contour_of_points_double;
@@ -79,6 +124,132 @@ class ExecuteScriptQuery;
 
 class ExecuteScriptResponse;
 
+class ProtocolQuery;
+
+class ProtocolInfo;
+
+
+class bulk_array : public virtual ::apache::thrift::TBase {
+ public:
+
+  bulk_array(const bulk_array&);
+  bulk_array& operator=(const bulk_array&);
+  bulk_array() noexcept
+             : dtype(static_cast<bulk_dtype::type>(0)),
+               endianness(static_cast<bulk_endianness::type>(0)),
+               compression(static_cast<bulk_compression::type>(0)),
+               count(0),
+               payload() {
+  }
+
+  virtual ~bulk_array() noexcept;
+  /**
+   * 
+   * @see bulk_dtype
+   */
+  bulk_dtype::type dtype;
+  /**
+   * 
+   * @see bulk_endianness
+   */
+  bulk_endianness::type endianness;
+  /**
+   * 
+   * @see bulk_compression
+   */
+  bulk_compression::type compression;
+  int64_t count;
+  std::string payload;
+
+  void __set_dtype(const bulk_dtype::type val);
+
+  void __set_endianness(const bulk_endianness::type val);
+
+  void __set_compression(const bulk_compression::type val);
+
+  void __set_count(const int64_t val);
+
+  void __set_payload(const std::string& val);
+
+  bool operator == (const bulk_array & rhs) const
+  {
+    if (!(dtype == rhs.dtype))
+      return false;
+    if (!(endianness == rhs.endianness))
+      return false;
+    if (!(compression == rhs.compression))
+      return false;
+    if (!(count == rhs.count))
+      return false;
+    if (!(payload == rhs.payload))
+      return false;
+    return true;
+  }
+  bool operator != (const bulk_array &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const bulk_array & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(bulk_array &a, bulk_array &b);
+
+std::ostream& operator<<(std::ostream& out, const bulk_array& obj);
+
+
+class bulk_encoding : public virtual ::apache::thrift::TBase {
+ public:
+
+  bulk_encoding(const bulk_encoding&) noexcept;
+  bulk_encoding& operator=(const bulk_encoding&) noexcept;
+  bulk_encoding() noexcept
+                : protocol_version(1LL),
+                  compression(static_cast<bulk_compression::type>(0)) {
+    compression = static_cast<bulk_compression::type>(0);
+
+  }
+
+  virtual ~bulk_encoding() noexcept;
+  int64_t protocol_version;
+  /**
+   * 
+   * @see bulk_compression
+   */
+  bulk_compression::type compression;
+
+  void __set_protocol_version(const int64_t val);
+
+  void __set_compression(const bulk_compression::type val);
+
+  bool operator == (const bulk_encoding & rhs) const
+  {
+    if (!(protocol_version == rhs.protocol_version))
+      return false;
+    if (!(compression == rhs.compression))
+      return false;
+    return true;
+  }
+  bool operator != (const bulk_encoding &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const bulk_encoding & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(bulk_encoding &a, bulk_encoding &b);
+
+std::ostream& operator<<(std::ostream& out, const bulk_encoding& obj);
+
 
 class vec3_double : public virtual ::apache::thrift::TBase {
  public:
@@ -128,6 +299,10 @@ void swap(vec3_double &a, vec3_double &b);
 
 std::ostream& operator<<(std::ostream& out, const vec3_double& obj);
 
+typedef struct _contour_of_points_double__isset {
+  _contour_of_points_double__isset() : points_blob(false) {}
+  bool points_blob :1;
+} _contour_of_points_double__isset;
 
 class contour_of_points_double : public virtual ::apache::thrift::TBase {
  public:
@@ -142,6 +317,9 @@ class contour_of_points_double : public virtual ::apache::thrift::TBase {
   std::vector<vec3_double>  points;
   bool closed;
   metadata_t metadata;
+  bulk_array points_blob;
+
+  _contour_of_points_double__isset __isset;
 
   void __set_points(const std::vector<vec3_double> & val);
 
@@ -149,6 +327,8 @@ class contour_of_points_double : public virtual ::apache::thrift::TBase {
 
   void __set_metadata(const metadata_t& val);
 
+  void __set_points_blob(const bulk_array& val);
+
   bool operator == (const contour_of_points_double & rhs) const
   {
     if (!(points == rhs.points))
@@ -157,6 +337,10 @@ class contour_of_points_double : public virtual ::apache::thrift::TBase {
       return false;
     if (!(metadata == rhs.metadata))
       return false;
+    if (__isset.points_blob != rhs.__isset.points_blob)
+      return false;
+    else if (__isset.points_blob && !(points_blob == rhs.points_blob))
+      return false;
     return true;
   }
   bool operator != (const contour_of_points_double &rhs) const {
@@ -211,6 +395,12 @@ void swap(contour_collection_double &a, contour_collection_double &b);
 
 std::ostream& operator<<(std::ostream& out, const contour_collection_double& obj);
 
+typedef struct _point_set_double__isset {
+  _point_set_double__isset() : points_blob(false), normals_blob(false), colours_blob(false) {}
+  bool points_blob :1;
+  bool normals_blob :1;
+  bool colours_blob :1;
+} _point_set_double__isset;
 
 class point_set_double : public virtual ::apache::thrift::TBase {
  public:
@@ -225,6 +415,11 @@ class point_set_double : public virtual ::apache::thrift::TBase {
   std::vector<vec3_double>  normals;
   std::vector<int64_t>  colours;
   metadata_t metadata;
+  bulk_array points_blob;
+  bulk_array normals_blob;
+  bulk_array colours_blob;
+
+  _point_set_double__isset __isset;
 
   void __set_points(const std::vector<vec3_double> & val);
 
@@ -234,6 +429,12 @@ class point_set_double : public virtual ::apache::thrift::TBase {
 
   void __set_metadata(const metadata_t& val);
 
+  void __set_points_blob(const bulk_array& val);
+
+  void __set_normals_blob(const bulk_array& val);
+
+  void __set_colours_blob(const bulk_array& val);
+
   bool operator == (const point_set_double & rhs) const
   {
     if (!(points == rhs.points))
@@ -244,6 +445,18 @@ class point_set_double : public virtual ::apache::thrift::TBase {
       return false;
     if (!(metadata == rhs.metadata))
       return false;
+    if (__isset.points_blob != rhs.__isset.points_blob)
+      return false;
+    else if (__isset.points_blob && !(points_blob == rhs.points_blob))
+      return false;
+    if (__isset.normals_blob != rhs.__isset.normals_blob)
+      return false;
+    else if (__isset.normals_blob && !(normals_blob == rhs.normals_blob))
+      return false;
+    if (__isset.colours_blob != rhs.__isset.colours_blob)
+      return false;
+    else if (__isset.colours_blob && !(colours_blob == rhs.colours_blob))
+      return false;
     return true;
   }
   bool operator != (const point_set_double &rhs) const {
@@ -364,6 +577,14 @@ void swap(samples_1D_double &a, samples_1D_double &b);
 
 std::ostream& operator<<(std::ostream& out, const samples_1D_double& obj);
 
+typedef struct _fv_surface_mesh_double_int64__isset {
+  _fv_surface_mesh_double_int64__isset() : vertices_blob(false), vertex_normals_blob(false), vertex_colours_blob(false), face_offsets_blob(false), face_indices_blob(false) {}
+  bool vertices_blob :1;
+  bool vertex_normals_blob :1;
+  bool vertex_colours_blob :1;
+  bool face_offsets_blob :1;
+  bool face_indices_blob :1;
+} _fv_surface_mesh_double_int64__isset;
 
 class fv_surface_mesh_double_int64 : public virtual ::apache::thrift::TBase {
  public:
@@ -380,6 +601,13 @@ class fv_surface_mesh_double_int64 : public virtual ::apache::thrift::TBase {
   std::vector<std::vector<int64_t> >  faces;
   std::vector<std::vector<int64_t> >  involved_faces;
   metadata_t metadata;
+  bulk_array vertices_blob;
+  bulk_array vertex_normals_blob;
+  bulk_array vertex_colours_blob;
+  bulk_array face_offsets_blob;
+  bulk_array face_indices_blob;
+
+  _fv_surface_mesh_double_int64__isset __isset;
 
   void __set_vertices(const std::vector<vec3_double> & val);
 
@@ -393,6 +621,16 @@ class fv_surface_mesh_double_int64 : public virtual ::apache::thrift::TBase {
 
   void __set_metadata(const metadata_t& val);
 
+  void __set_vertices_blob(const bulk_array& val);
+
+  void __set_vertex_normals_blob(const bulk_array& val);
+
+  void __set_vertex_colours_blob(const bulk_array& val);
+
+  void __set_face_offsets_blob(const bulk_array& val);
+
+  void __set_face_indices_blob(const bulk_array& val);
+
   bool operator == (const fv_surface_mesh_double_int64 & rhs) const
   {
     if (!(vertices == rhs.vertices))
@@ -407,6 +645,26 @@ class fv_surface_mesh_double_int64 : public virtual ::apache::thrift::TBase {
       return false;
     if (!(metadata == rhs.metadata))
       return false;
+    if (__isset.vertices_blob != rhs.__isset.vertices_blob)
+      return false;
+    else if (__isset.vertices_blob && !(vertices_blob == rhs.vertices_blob))
+      return false;
+    if (__isset.vertex_normals_blob != rhs.__isset.vertex_normals_blob)
+      return false;
+    else if (__isset.vertex_normals_blob && !(vertex_normals_blob == rhs.vertex_normals_blob))
+      return false;
+    if (__isset.vertex_colours_blob != rhs.__isset.vertex_colours_blob)
+      return false;
+    else if (__isset.vertex_colours_blob && !(vertex_colours_blob == rhs.vertex_colours_blob))
+      return false;
+    if (__isset.face_offsets_blob != rhs.__isset.face_offsets_blob)
+      return false;
+    else if (__isset.face_offsets_blob && !(face_offsets_blob == rhs.face_offsets_blob))
+      return false;
+    if (__isset.face_indices_blob != rhs.__isset.face_indices_blob)
+      return false;
+    else if (__isset.face_indices_blob && !(face_indices_blob == rhs.face_indices_blob))
+      return false;
     return true;
   }
   bool operator != (const fv_surface_mesh_double_int64 &rhs) const {
@@ -425,6 +683,10 @@ void swap(fv_surface_mesh_double_int64 &a, fv_surface_mesh_double_int64 &b);
 
 std::ostream& operator<<(std::ostream& out, const fv_surface_mesh_double_int64& obj);
 
+typedef struct _planar_image_double_double__isset {
+  _planar_image_double_double__isset() : data_blob(false) {}
+  bool data_blob :1;
+} _planar_image_double_double__isset;
 
 class planar_image_double_double : public virtual ::apache::thrift::TBase {
  public:
@@ -453,6 +715,9 @@ class planar_image_double_double : public virtual ::apache::thrift::TBase {
   vec3_double row_unit;
   vec3_double col_unit;
   metadata_t metadata;
+  bulk_array data_blob;
+
+  _planar_image_double_double__isset __isset;
 
   void __set_data(const std::vector<double> & val);
 
@@ -478,6 +743,8 @@ class planar_image_double_double : public virtual ::apache::thrift::TBase {
 
   void __set_metadata(const metadata_t& val);
 
+  void __set_data_blob(const bulk_array& val);
+
   bool operator == (const planar_image_double_double & rhs) const
   {
     if (!(data == rhs.data))
@@ -504,6 +771,10 @@ class planar_image_double_double : public virtual ::apache::thrift::TBase {
       return false;
     if (!(metadata == rhs.metadata))
       return false;
+    if (__isset.data_blob != rhs.__isset.data_blob)
+      return false;
+    else if (__isset.data_blob && !(data_blob == rhs.data_blob))
+      return false;
     return true;
   }
   bool operator != (const planar_image_double_double &rhs) const {
@@ -1321,6 +1592,10 @@ void swap(KnownOperation &a, KnownOperation &b);
 
 std::ostream& operator<<(std::ostream& out, const KnownOperation& obj);
 
+typedef struct _LoadFilesQuery__isset {
+  _LoadFilesQuery__isset() : response_encoding(false) {}
+  bool response_encoding :1;
+} _LoadFilesQuery__isset;
 
 class LoadFilesQuery : public virtual ::apache::thrift::TBase {
  public:
@@ -1333,13 +1608,22 @@ class LoadFilesQuery : public virtual ::apache::thrift::TBase {
 
   virtual ~LoadFilesQuery() noexcept;
   std::string server_filename;
+  bulk_encoding response_encoding;
+
+  _LoadFilesQuery__isset __isset;
 
   void __set_server_filename(const std::string& val);
 
+  void __set_response_encoding(const bulk_encoding& val);
+
   bool operator == (const LoadFilesQuery & rhs) const
   {
     if (!(server_filename == rhs.server_filename))
       return false;
+    if (__isset.response_encoding != rhs.__isset.response_encoding)
+      return false;
+    else if (__isset.response_encoding && !(response_encoding == rhs.response_encoding))
+      return false;
     return true;
   }
   bool operator != (const LoadFilesQuery &rhs) const {
@@ -1408,6 +1692,10 @@ void swap(LoadFilesResponse &a, LoadFilesResponse &b);
 
 std::ostream& operator<<(std::ostream& out, const LoadFilesResponse& obj);
 
+typedef struct _ExecuteScriptQuery__isset {
+  _ExecuteScriptQuery__isset() : response_encoding(false) {}
+  bool response_encoding :1;
+} _ExecuteScriptQuery__isset;
 
 class ExecuteScriptQuery : public virtual ::apache::thrift::TBase {
  public:
@@ -1422,6 +1710,9 @@ class ExecuteScriptQuery : public virtual ::apache::thrift::TBase {
   Drover drover;
   metadata_t invocation_metadata;
   std::string filename_lex;
+  bulk_encoding response_encoding;
+
+  _ExecuteScriptQuery__isset __isset;
 
   void __set_drover(const Drover& val);
 
@@ -1429,6 +1720,8 @@ class ExecuteScriptQuery : public virtual ::apache::thrift::TBase {
 
   void __set_filename_lex(const std::string& val);
 
+  void __set_response_encoding(const bulk_encoding& val);
+
   bool operator == (const ExecuteScriptQuery & rhs) const
   {
     if (!(drover == rhs.drover))
@@ -1437,6 +1730,10 @@ class ExecuteScriptQuery : public virtual ::apache::thrift::TBase {
       return false;
     if (!(filename_lex == rhs.filename_lex))
       return false;
+    if (__isset.response_encoding != rhs.__isset.response_encoding)
+      return false;
+    else if (__isset.response_encoding && !(response_encoding == rhs.response_encoding))
+      return false;
     return true;
   }
   bool operator != (const ExecuteScriptQuery &rhs) const {
@@ -1522,6 +1819,85 @@ void swap(ExecuteScriptResponse &a, ExecuteScriptResponse &b);
 
 std::ostream& operator<<(std::ostream& out, const ExecuteScriptResponse& obj);
 
+
+class ProtocolQuery : public virtual ::apache::thrift::TBase {
+ public:
+
+  ProtocolQuery(const ProtocolQuery&) noexcept;
+  ProtocolQuery& operator=(const ProtocolQuery&) noexcept;
+  ProtocolQuery() noexcept
+                : client_version(0) {
+  }
+
+  virtual ~ProtocolQuery() noexcept;
+  int64_t client_version;
+
+  void __set_client_version(const int64_t val);
+
+  bool operator == (const ProtocolQuery & rhs) const
+  {
+    if (!(client_version == rhs.client_version))
+      return false;
+    return true;
+  }
+  bool operator != (const ProtocolQuery &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ProtocolQuery & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ProtocolQuery &a, ProtocolQuery &b);
+
+std::ostream& operator<<(std::ostream& out, const ProtocolQuery& obj);
+
+
+class ProtocolInfo : public virtual ::apache::thrift::TBase {
+ public:
+
+  ProtocolInfo(const ProtocolInfo&);
+  ProtocolInfo& operator=(const ProtocolInfo&);
+  ProtocolInfo() noexcept
+               : server_version(0) {
+  }
+
+  virtual ~ProtocolInfo() noexcept;
+  int64_t server_version;
+  std::vector<bulk_compression::type>  compressions;
+
+  void __set_server_version(const int64_t val);
+
+  void __set_compressions(const std::vector<bulk_compression::type> & val);
+
+  bool operator == (const ProtocolInfo & rhs) const
+  {
+    if (!(server_version == rhs.server_version))
+      return false;
+    if (!(compressions == rhs.compressions))
+      return false;
+    return true;
+  }
+  bool operator != (const ProtocolInfo &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ProtocolInfo & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ProtocolInfo &a, ProtocolInfo &b);
+
+std::ostream& operator<<(std::ostream& out, const ProtocolInfo& obj);
+
 }} // namespace
 
 #endif
@@ -23,6 +23,7 @@ class ReceiverIf {
  public:
   virtual ~ReceiverIf() {}
   virtual void GetSupportedOperations(std::vector<KnownOperation> & _return, const OperationsQuery& query) = 0;
+  virtual void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) = 0;
   virtual void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) = 0;
   virtual void ExecuteScript(ExecuteScriptResponse& _return, const ExecuteScriptQuery& query, const std::string& script) = 0;
 };
@@ -57,6 +58,9 @@ class ReceiverNull : virtual public ReceiverIf {
   void GetSupportedOperations(std::vector<KnownOperation> & /* _return */, const OperationsQuery& /* query */) override {
     return;
   }
+  void GetProtocolInfo(ProtocolInfo& /* _return */, const ProtocolQuery& /* query */) override {
+    return;
+  }
   void LoadFiles(LoadFilesResponse& /* _return */, const std::vector<LoadFilesQuery> & /* server_filenames */) override {
     return;
   }
@@ -169,6 +173,110 @@ class Receiver_GetSupportedOperations_presult {
 
 };
 
+typedef struct _Receiver_GetProtocolInfo_args__isset {
+  _Receiver_GetProtocolInfo_args__isset() : query(false) {}
+  bool query :1;
+} _Receiver_GetProtocolInfo_args__isset;
+
+class Receiver_GetProtocolInfo_args {
+ public:
+
+  Receiver_GetProtocolInfo_args(const Receiver_GetProtocolInfo_args&) noexcept;
+  Receiver_GetProtocolInfo_args& operator=(const Receiver_GetProtocolInfo_args&) noexcept;
+  Receiver_GetProtocolInfo_args() noexcept {
+  }
+
+  virtual ~Receiver_GetProtocolInfo_args() noexcept;
+  ProtocolQuery query;
+
+  _Receiver_GetProtocolInfo_args__isset __isset;
+
+  void __set_query(const ProtocolQuery& val);
+
+  bool operator == (const Receiver_GetProtocolInfo_args & rhs) const
+  {
+    if (!(query == rhs.query))
+      return false;
+    return true;
+  }
+  bool operator != (const Receiver_GetProtocolInfo_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Receiver_GetProtocolInfo_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Receiver_GetProtocolInfo_pargs {
+ public:
+
+
+  virtual ~Receiver_GetProtocolInfo_pargs() noexcept;
+  const ProtocolQuery* query;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Receiver_GetProtocolInfo_result__isset {
+  _Receiver_GetProtocolInfo_result__isset() : success(false) {}
+  bool success :1;
+} _Receiver_GetProtocolInfo_result__isset;
+
+class Receiver_GetProtocolInfo_result {
+ public:
+
+  Receiver_GetProtocolInfo_result(const Receiver_GetProtocolInfo_result&);
+  Receiver_GetProtocolInfo_result& operator=(const Receiver_GetProtocolInfo_result&);
+  Receiver_GetProtocolInfo_result() noexcept {
+  }
+
+  virtual ~Receiver_GetProtocolInfo_result() noexcept;
+  ProtocolInfo success;
+
+  _Receiver_GetProtocolInfo_result__isset __isset;
+
+  void __set_success(const ProtocolInfo& val);
+
+  bool operator == (const Receiver_GetProtocolInfo_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Receiver_GetProtocolInfo_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Receiver_GetProtocolInfo_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Receiver_GetProtocolInfo_presult__isset {
+  _Receiver_GetProtocolInfo_presult__isset() : success(false) {}
+  bool success :1;
+} _Receiver_GetProtocolInfo_presult__isset;
+
+class Receiver_GetProtocolInfo_presult {
+ public:
+
+
+  virtual ~Receiver_GetProtocolInfo_presult() noexcept;
+  ProtocolInfo* success;
+
+  _Receiver_GetProtocolInfo_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _Receiver_LoadFiles_args__isset {
   _Receiver_LoadFiles_args__isset() : server_filenames(false) {}
   bool server_filenames :1;
@@ -413,6 +521,9 @@ class ReceiverClient : virtual public ReceiverIf {
   void GetSupportedOperations(std::vector<KnownOperation> & _return, const OperationsQuery& query) override;
   void send_GetSupportedOperations(const OperationsQuery& query);
   void recv_GetSupportedOperations(std::vector<KnownOperation> & _return);
+  void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) override;
+  void send_GetProtocolInfo(const ProtocolQuery& query);
+  void recv_GetProtocolInfo(ProtocolInfo& _return);
   void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) override;
   void send_LoadFiles(const std::vector<LoadFilesQuery> & server_filenames);
   void recv_LoadFiles(LoadFilesResponse& _return);
@@ -435,12 +546,14 @@ class ReceiverProcessor : public ::apache::thrift::TDispatchProcessor {
   typedef std::map<std::string, ProcessFunction> ProcessMap;
   ProcessMap processMap_;
   void process_GetSupportedOperations(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetProtocolInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_LoadFiles(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ExecuteScript(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   ReceiverProcessor(::std::shared_ptr<ReceiverIf> iface) :
     iface_(iface) {
     processMap_["GetSupportedOperations"] = &ReceiverProcessor::process_GetSupportedOperations;
+    processMap_["GetProtocolInfo"] = &ReceiverProcessor::process_GetProtocolInfo;
     processMap_["LoadFiles"] = &ReceiverProcessor::process_LoadFiles;
     processMap_["ExecuteScript"] = &ReceiverProcessor::process_ExecuteScript;
   }
@@ -481,6 +594,16 @@ class ReceiverMultiface : virtual public ReceiverIf {
     return;
   }
 
+  void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetProtocolInfo(_return, query);
+    }
+    ifaces_[i]->GetProtocolInfo(_return, query);
+    return;
+  }
+
   void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -536,6 +659,9 @@ class ReceiverConcurrentClient : virtual public ReceiverIf {
   void GetSupportedOperations(std::vector<KnownOperation> & _return, const OperationsQuery& query) override;
   int32_t send_GetSupportedOperations(const OperationsQuery& query);
   void recv_GetSupportedOperations(std::vector<KnownOperation> & _return, const int32_t seqid);
+  void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) override;
+  int32_t send_GetProtocolInfo(const ProtocolQuery& query);
+  void recv_GetProtocolInfo(ProtocolInfo& _return, const int32_t seqid);
   void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) override;
   int32_t send_LoadFiles(const std::vector<LoadFilesQuery> & server_filenames);
   void recv_LoadFiles(LoadFilesResponse& _return, const int32_t seqid);
@@ -25,6 +25,11 @@ class ReceiverHandler : virtual public ReceiverIf {
     printf("GetSupportedOperations\n");
   }
 
+  void GetProtocolInfo(ProtocolInfo& _return, const ProtocolQuery& query) {
+    // Your implementation goes here
+    printf("GetProtocolInfo\n");
+  }
+
   void LoadFiles(LoadFilesResponse& _return, const std::vector<LoadFilesQuery> & server_filenames) {
     // Your implementation goes here
     printf("LoadFiles\n");
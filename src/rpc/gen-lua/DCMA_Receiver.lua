@@ -44,6 +44,37 @@ function ReceiverClient:recv_GetSupportedOperations(query)
   error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
 end
 
+function ReceiverClient:GetProtocolInfo(query)
+  self:send_GetProtocolInfo(query)
+  return self:recv_GetProtocolInfo(query)
+end
+
+function ReceiverClient:send_GetProtocolInfo(query)
+  self.oprot:writeMessageBegin('GetProtocolInfo', TMessageType.CALL, self._seqid)
+  local args = GetProtocolInfo_args:new{}
+  args.query = query
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function ReceiverClient:recv_GetProtocolInfo(query)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = GetProtocolInfo_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
+
 function ReceiverClient:LoadFiles(server_filenames)
   self:send_LoadFiles(server_filenames)
   return self:recv_LoadFiles(server_filenames)
@@ -157,6 +188,26 @@ function ReceiverProcessor:process_GetSupportedOperations(seqid, iprot, oprot, s
   return status, res
 end
 
+function ReceiverProcessor:process_GetProtocolInfo(seqid, iprot, oprot, server_ctx)
+  local args = GetProtocolInfo_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = GetProtocolInfo_result:new{}
+  local status, res = pcall(self.handler.GetProtocolInfo, self.handler, args.query)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('GetProtocolInfo', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+  return status, res
+end
+
 function ReceiverProcessor:process_LoadFiles(seqid, iprot, oprot, server_ctx)
   local args = LoadFiles_args:new{}
   local reply_type = TMessageType.REPLY
@@ -248,11 +299,11 @@ function GetSupportedOperations_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype271, _size268 = iprot:readListBegin()
-        for _i=1,_size268 do
-          local _elem272 = KnownOperation:new{}
-          _elem272:read(iprot)
-          table.insert(self.success, _elem272)
+        local _etype277, _size274 = iprot:readListBegin()
+        for _i=1,_size274 do
+          local _elem278 = KnownOperation:new{}
+          _elem278:read(iprot)
+          table.insert(self.success, _elem278)
         end
         iprot:readListEnd()
       else
@@ -271,8 +322,8 @@ function GetSupportedOperations_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter273 in ipairs(self.success) do
-      iter273:write(oprot)
+    for _,iter279 in ipairs(self.success) do
+      iter279:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -281,6 +332,78 @@ function GetSupportedOperations_result:write(oprot)
   oprot:writeStructEnd()
 end
 
+GetProtocolInfo_args = __TObject:new{
+  query
+}
+
+function GetProtocolInfo_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.query = ProtocolQuery:new{}
+        self.query:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetProtocolInfo_args:write(oprot)
+  oprot:writeStructBegin('GetProtocolInfo_args')
+  if self.query ~= nil then
+    oprot:writeFieldBegin('query', TType.STRUCT, 1)
+    self.query:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+GetProtocolInfo_result = __TObject:new{
+  success
+}
+
+function GetProtocolInfo_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.STRUCT then
+        self.success = ProtocolInfo:new{}
+        self.success:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetProtocolInfo_result:write(oprot)
+  oprot:writeStructBegin('GetProtocolInfo_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.STRUCT, 0)
+    self.success:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
 LoadFiles_args = __TObject:new{
   server_filenames
 }
@@ -294,11 +417,11 @@ function LoadFiles_args:read(iprot)
     elseif fid == 1 then
       if ftype == TType.LIST then
         self.server_filenames = {}
-        local _etype277, _size274 = iprot:readListBegin()
-        for _i=1,_size274 do
-          local _elem278 = LoadFilesQuery:new{}
-          _elem278:read(iprot)
-          table.insert(self.server_filenames, _elem278)
+        local _etype283, _size280 = iprot:readListBegin()
+        for _i=1,_size280 do
+          local _elem284 = LoadFilesQuery:new{}
+          _elem284:read(iprot)
+          table.insert(self.server_filenames, _elem284)
         end
         iprot:readListEnd()
       else
@@ -317,8 +440,8 @@ function LoadFiles_args:write(oprot)
   if self.server_filenames ~= nil then
     oprot:writeFieldBegin('server_filenames', TType.LIST, 1)
     oprot:writeListBegin(TType.STRUCT, #self.server_filenames)
-    for _,iter279 in ipairs(self.server_filenames) do
-      iter279:write(oprot)
+    for _,iter285 in ipairs(self.server_filenames) do
+      iter285:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
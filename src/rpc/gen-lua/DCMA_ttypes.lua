@@ -9,6 +9,153 @@
 require 'Thrift'
 require 'DCMA_constants'
 
+bulk_dtype = {
+  FLOAT32 = 1,
+  FLOAT64 = 2,
+  UINT32 = 3,
+  UINT64 = 4
+}
+
+bulk_endianness = {
+  LITTLE = 1,
+  BIG = 2
+}
+
+bulk_compression = {
+  UNCOMPRESSED = 0,
+  ZLIB = 1
+}
+
+bulk_array = __TObject:new{
+  dtype,
+  endianness,
+  compression,
+  count,
+  payload
+}
+
+function bulk_array:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I32 then
+        self.dtype = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I32 then
+        self.endianness = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.I32 then
+        self.compression = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.I64 then
+        self.count = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 5 then
+      if ftype == TType.STRING then
+        self.payload = iprot:readString()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function bulk_array:write(oprot)
+  oprot:writeStructBegin('bulk_array')
+  if self.dtype ~= nil then
+    oprot:writeFieldBegin('dtype', TType.I32, 1)
+    oprot:writeI32(self.dtype)
+    oprot:writeFieldEnd()
+  end
+  if self.endianness ~= nil then
+    oprot:writeFieldBegin('endianness', TType.I32, 2)
+    oprot:writeI32(self.endianness)
+    oprot:writeFieldEnd()
+  end
+  if self.compression ~= nil then
+    oprot:writeFieldBegin('compression', TType.I32, 3)
+    oprot:writeI32(self.compression)
+    oprot:writeFieldEnd()
+  end
+  if self.count ~= nil then
+    oprot:writeFieldBegin('count', TType.I64, 4)
+    oprot:writeI64(self.count)
+    oprot:writeFieldEnd()
+  end
+  if self.payload ~= nil then
+    oprot:writeFieldBegin('payload', TType.STRING, 5)
+    oprot:writeString(self.payload)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+bulk_encoding = __TObject:new{
+  protocol_version = lualongnumber.new('1'),
+  compression = 0
+}
+
+function bulk_encoding:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.protocol_version = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I32 then
+        self.compression = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function bulk_encoding:write(oprot)
+  oprot:writeStructBegin('bulk_encoding')
+  if self.protocol_version ~= nil then
+    oprot:writeFieldBegin('protocol_version', TType.I64, 1)
+    oprot:writeI64(self.protocol_version)
+    oprot:writeFieldEnd()
+  end
+  if self.compression ~= nil then
+    oprot:writeFieldBegin('compression', TType.I32, 2)
+    oprot:writeI32(self.compression)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
 vec3_double = __TObject:new{
   x,
   y,
@@ -71,7 +218,8 @@ end
 contour_of_points_double = __TObject:new{
   points,
   closed,
-  metadata
+  metadata,
+  points_blob
 }
 
 function contour_of_points_double:read(iprot)
@@ -112,6 +260,13 @@ function contour_of_points_double:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 4 then
+      if ftype == TType.STRUCT then
+        self.points_blob = bulk_array:new{}
+        self.points_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -146,6 +301,11 @@ function contour_of_points_double:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.points_blob ~= nil then
+    oprot:writeFieldBegin('points_blob', TType.STRUCT, 4)
+    self.points_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -200,7 +360,10 @@ point_set_double = __TObject:new{
   points,
   normals,
   colours,
-  metadata
+  metadata,
+  points_blob,
+  normals_blob,
+  colours_blob
 }
 
 function point_set_double:read(iprot)
@@ -260,6 +423,27 @@ function point_set_double:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 5 then
+      if ftype == TType.STRUCT then
+        self.points_blob = bulk_array:new{}
+        self.points_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 6 then
+      if ftype == TType.STRUCT then
+        self.normals_blob = bulk_array:new{}
+        self.normals_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 7 then
+      if ftype == TType.STRUCT then
+        self.colours_blob = bulk_array:new{}
+        self.colours_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -307,6 +491,21 @@ function point_set_double:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.points_blob ~= nil then
+    oprot:writeFieldBegin('points_blob', TType.STRUCT, 5)
+    self.points_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.normals_blob ~= nil then
+    oprot:writeFieldBegin('normals_blob', TType.STRUCT, 6)
+    self.normals_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.colours_blob ~= nil then
+    oprot:writeFieldBegin('colours_blob', TType.STRUCT, 7)
+    self.colours_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -470,7 +669,12 @@ fv_surface_mesh_double_int64 = __TObject:new{
   vertex_colours,
   faces,
   involved_faces,
-  metadata
+  metadata,
+  vertices_blob,
+  vertex_normals_blob,
+  vertex_colours_blob,
+  face_offsets_blob,
+  face_indices_blob
 }
 
 function fv_surface_mesh_double_int64:read(iprot)
@@ -566,6 +770,41 @@ function fv_surface_mesh_double_int64:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 7 then
+      if ftype == TType.STRUCT then
+        self.vertices_blob = bulk_array:new{}
+        self.vertices_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 8 then
+      if ftype == TType.STRUCT then
+        self.vertex_normals_blob = bulk_array:new{}
+        self.vertex_normals_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 9 then
+      if ftype == TType.STRUCT then
+        self.vertex_colours_blob = bulk_array:new{}
+        self.vertex_colours_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 10 then
+      if ftype == TType.STRUCT then
+        self.face_offsets_blob = bulk_array:new{}
+        self.face_offsets_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 11 then
+      if ftype == TType.STRUCT then
+        self.face_indices_blob = bulk_array:new{}
+        self.face_indices_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -639,6 +878,31 @@ function fv_surface_mesh_double_int64:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.vertices_blob ~= nil then
+    oprot:writeFieldBegin('vertices_blob', TType.STRUCT, 7)
+    self.vertices_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.vertex_normals_blob ~= nil then
+    oprot:writeFieldBegin('vertex_normals_blob', TType.STRUCT, 8)
+    self.vertex_normals_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.vertex_colours_blob ~= nil then
+    oprot:writeFieldBegin('vertex_colours_blob', TType.STRUCT, 9)
+    self.vertex_colours_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.face_offsets_blob ~= nil then
+    oprot:writeFieldBegin('face_offsets_blob', TType.STRUCT, 10)
+    self.face_offsets_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  if self.face_indices_blob ~= nil then
+    oprot:writeFieldBegin('face_indices_blob', TType.STRUCT, 11)
+    self.face_indices_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -655,7 +919,8 @@ planar_image_double_double = __TObject:new{
   offset,
   row_unit,
   col_unit,
-  metadata
+  metadata,
+  data_blob
 }
 
 function planar_image_double_double:read(iprot)
@@ -753,6 +1018,13 @@ function planar_image_double_double:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 13 then
+      if ftype == TType.STRUCT then
+        self.data_blob = bulk_array:new{}
+        self.data_blob:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -832,6 +1104,11 @@ function planar_image_double_double:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.data_blob ~= nil then
+    oprot:writeFieldBegin('data_blob', TType.STRUCT, 13)
+    self.data_blob:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -2034,7 +2311,8 @@ function KnownOperation:write(oprot)
 end
 
 LoadFilesQuery = __TObject:new{
-  server_filename
+  server_filename,
+  response_encoding
 }
 
 function LoadFilesQuery:read(iprot)
@@ -2049,6 +2327,13 @@ function LoadFilesQuery:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 2 then
+      if ftype == TType.STRUCT then
+        self.response_encoding = bulk_encoding:new{}
+        self.response_encoding:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -2064,6 +2349,11 @@ function LoadFilesQuery:write(oprot)
     oprot:writeString(self.server_filename)
     oprot:writeFieldEnd()
   end
+  if self.response_encoding ~= nil then
+    oprot:writeFieldBegin('response_encoding', TType.STRUCT, 2)
+    self.response_encoding:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -2119,7 +2409,8 @@ end
 ExecuteScriptQuery = __TObject:new{
   drover,
   invocation_metadata,
-  filename_lex
+  filename_lex,
+  response_encoding
 }
 
 function ExecuteScriptQuery:read(iprot)
@@ -2154,6 +2445,13 @@ function ExecuteScriptQuery:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 4 then
+      if ftype == TType.STRUCT then
+        self.response_encoding = bulk_encoding:new{}
+        self.response_encoding:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -2184,6 +2482,11 @@ function ExecuteScriptQuery:write(oprot)
     oprot:writeString(self.filename_lex)
     oprot:writeFieldEnd()
   end
+  if self.response_encoding ~= nil then
+    oprot:writeFieldBegin('response_encoding', TType.STRUCT, 4)
+    self.response_encoding:write(oprot)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -2270,4 +2573,96 @@ function ExecuteScriptResponse:write(oprot)
   end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
+end
+
+ProtocolQuery = __TObject:new{
+  client_version
+}
+
+function ProtocolQuery:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.client_version = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ProtocolQuery:write(oprot)
+  oprot:writeStructBegin('ProtocolQuery')
+  if self.client_version ~= nil then
+    oprot:writeFieldBegin('client_version', TType.I64, 1)
+    oprot:writeI64(self.client_version)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+ProtocolInfo = __TObject:new{
+  server_version,
+  compressions
+}
+
+function ProtocolInfo:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.server_version = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.LIST then
+        self.compressions = {}
+        local _etype271, _size268 = iprot:readListBegin()
+        for _i=1,_size268 do
+          local _elem272 = iprot:readI32()
+          table.insert(self.compressions, _elem272)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ProtocolInfo:write(oprot)
+  oprot:writeStructBegin('ProtocolInfo')
+  if self.server_version ~= nil then
+    oprot:writeFieldBegin('server_version', TType.I64, 1)
+    oprot:writeI64(self.server_version)
+    oprot:writeFieldEnd()
+  end
+  if self.compressions ~= nil then
+    oprot:writeFieldBegin('compressions', TType.LIST, 2)
+    oprot:writeListBegin(TType.I32, #self.compressions)
+    for _,iter273 in ipairs(self.compressions) do
+      oprot:writeI32(iter273)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
 end
\ No newline at end of file
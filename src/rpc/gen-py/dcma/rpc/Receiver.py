@@ -27,6 +27,14 @@ class Iface(object):
         """
         pass
 
+    def GetProtocolInfo(self, query):
+        """
+        Parameters:
+         - query
+
+        """
+        pass
+
     def LoadFiles(self, server_filenames):
         """
         Parameters:
@@ -84,6 +92,38 @@ class Client(Iface):
             return result.success
         raise TApplicationException(TApplicationException.MISSING_RESULT, "GetSupportedOperations failed: unknown result")
 
+    def GetProtocolInfo(self, query):
+        """
+        Parameters:
+         - query
+
+        """
+        self.send_GetProtocolInfo(query)
+        return self.recv_GetProtocolInfo()
+
+    def send_GetProtocolInfo(self, query):
+        self._oprot.writeMessageBegin('GetProtocolInfo', TMessageType.CALL, self._seqid)
+        args = GetProtocolInfo_args()
+        args.query = query
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetProtocolInfo(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetProtocolInfo_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetProtocolInfo failed: unknown result")
+
     def LoadFiles(self, server_filenames):
         """
         Parameters:
@@ -156,6 +196,7 @@ class Processor(Iface, TProcessor):
         self._handler = handler
         self._processMap = {}
         self._processMap["GetSupportedOperations"] = Processor.process_GetSupportedOperations
+        self._processMap["GetProtocolInfo"] = Processor.process_GetProtocolInfo
         self._processMap["LoadFiles"] = Processor.process_LoadFiles
         self._processMap["ExecuteScript"] = Processor.process_ExecuteScript
         self._on_message_begin = None
@@ -203,6 +244,29 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_GetProtocolInfo(self, seqid, iprot, oprot):
+        args = GetProtocolInfo_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetProtocolInfo_result()
+        try:
+            result.success = self._handler.GetProtocolInfo(args.query)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetProtocolInfo", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_LoadFiles(self, seqid, iprot, oprot):
         args = LoadFiles_args()
         args.read(iprot)
@@ -338,11 +402,11 @@ class GetSupportedOperations_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype312, _size309) = iprot.readListBegin()
-                    for _i313 in range(_size309):
-                        _elem314 = KnownOperation()
-                        _elem314.read(iprot)
-                        self.success.append(_elem314)
+                    (_etype319, _size316) = iprot.readListBegin()
+                    for _i320 in range(_size316):
+                        _elem321 = KnownOperation()
+                        _elem321.read(iprot)
+                        self.success.append(_elem321)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -359,8 +423,8 @@ class GetSupportedOperations_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter315 in self.success:
-                iter315.write(oprot)
+            for iter322 in self.success:
+                iter322.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -385,6 +449,131 @@ GetSupportedOperations_result.thrift_spec = (
 )
 
 
+class GetProtocolInfo_args(object):
+    """
+    Attributes:
+     - query
+
+    """
+
+
+    def __init__(self, query=None,):
+        self.query = query
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.query = ProtocolQuery()
+                    self.query.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetProtocolInfo_args')
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRUCT, 1)
+            self.query.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetProtocolInfo_args)
+GetProtocolInfo_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'query', [ProtocolQuery, None], None, ),  # 1
+)
+
+
+class GetProtocolInfo_result(object):
+    """
+    Attributes:
+     - success
+
+    """
+
+
+    def __init__(self, success=None,):
+        self.success = success
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = ProtocolInfo()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetProtocolInfo_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetProtocolInfo_result)
+GetProtocolInfo_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [ProtocolInfo, None], None, ),  # 0
+)
+
+
 class LoadFiles_args(object):
     """
     Attributes:
@@ -408,11 +597,11 @@ class LoadFiles_args(object):
             if fid == 1:
                 if ftype == TType.LIST:
                     self.server_filenames = []
-                    (_etype319, _size316) = iprot.readListBegin()
-                    for _i320 in range(_size316):
-                        _elem321 = LoadFilesQuery()
-                        _elem321.read(iprot)
-                        self.server_filenames.append(_elem321)
+                    (_etype326, _size323) = iprot.readListBegin()
+                    for _i327 in range(_size323):
+                        _elem328 = LoadFilesQuery()
+                        _elem328.read(iprot)
+                        self.server_filenames.append(_elem328)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -429,8 +618,8 @@ class LoadFiles_args(object):
         if self.server_filenames is not None:
             oprot.writeFieldBegin('server_filenames', TType.LIST, 1)
             oprot.writeListBegin(TType.STRUCT, len(self.server_filenames))
-            for iter322 in self.server_filenames:
-                iter322.write(oprot)
+            for iter329 in self.server_filenames:
+                iter329.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -16,6 +16,240 @@ from thrift.transport import TTransport
 all_structs = []
 
 
+class bulk_dtype(object):
+    FLOAT32 = 1
+    FLOAT64 = 2
+    UINT32 = 3
+    UINT64 = 4
+
+    _VALUES_TO_NAMES = {
+        1: "FLOAT32",
+        2: "FLOAT64",
+        3: "UINT32",
+        4: "UINT64",
+    }
+
+    _NAMES_TO_VALUES = {
+        "FLOAT32": 1,
+        "FLOAT64": 2,
+        "UINT32": 3,
+        "UINT64": 4,
+    }
+
+
+class bulk_endianness(object):
+    LITTLE = 1
+    BIG = 2
+
+    _VALUES_TO_NAMES = {
+        1: "LITTLE",
+        2: "BIG",
+    }
+
+    _NAMES_TO_VALUES = {
+        "LITTLE": 1,
+        "BIG": 2,
+    }
+
+
+class bulk_compression(object):
+    UNCOMPRESSED = 0
+    ZLIB = 1
+
+    _VALUES_TO_NAMES = {
+        0: "UNCOMPRESSED",
+        1: "ZLIB",
+    }
+
+    _NAMES_TO_VALUES = {
+        "UNCOMPRESSED": 0,
+        "ZLIB": 1,
+    }
+
+
+class bulk_array(object):
+    """
+    Attributes:
+     - dtype
+     - endianness
+     - compression
+     - count
+     - payload
+
+    """
+
+
+    def __init__(self, dtype=None, endianness=None, compression=None, count=None, payload=None,):
+        self.dtype = dtype
+        self.endianness = endianness
+        self.compression = compression
+        self.count = count
+        self.payload = payload
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I32:
+                    self.dtype = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.endianness = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.compression = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRING:
+                    self.payload = iprot.readBinary()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('bulk_array')
+        if self.dtype is not None:
+            oprot.writeFieldBegin('dtype', TType.I32, 1)
+            oprot.writeI32(self.dtype)
+            oprot.writeFieldEnd()
+        if self.endianness is not None:
+            oprot.writeFieldBegin('endianness', TType.I32, 2)
+            oprot.writeI32(self.endianness)
+            oprot.writeFieldEnd()
+        if self.compression is not None:
+            oprot.writeFieldBegin('compression', TType.I32, 3)
+            oprot.writeI32(self.compression)
+            oprot.writeFieldEnd()
+        if self.count is not None:
+            oprot.writeFieldBegin('count', TType.I64, 4)
+            oprot.writeI64(self.count)
+            oprot.writeFieldEnd()
+        if self.payload is not None:
+            oprot.writeFieldBegin('payload', TType.STRING, 5)
+            oprot.writeBinary(self.payload)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        if self.dtype is None:
+            raise TProtocolException(message='Required field dtype is unset!')
+        if self.endianness is None:
+            raise TProtocolException(message='Required field endianness is unset!')
+        if self.compression is None:
+            raise TProtocolException(message='Required field compression is unset!')
+        if self.count is None:
+            raise TProtocolException(message='Required field count is unset!')
+        if self.payload is None:
+            raise TProtocolException(message='Required field payload is unset!')
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class bulk_encoding(object):
+    """
+    Attributes:
+     - protocol_version
+     - compression
+
+    """
+
+
+    def __init__(self, protocol_version=1, compression=0,):
+        self.protocol_version = protocol_version
+        self.compression = compression
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.protocol_version = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.compression = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('bulk_encoding')
+        if self.protocol_version is not None:
+            oprot.writeFieldBegin('protocol_version', TType.I64, 1)
+            oprot.writeI64(self.protocol_version)
+            oprot.writeFieldEnd()
+        if self.compression is not None:
+            oprot.writeFieldBegin('compression', TType.I32, 2)
+            oprot.writeI32(self.compression)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        if self.protocol_version is None:
+            raise TProtocolException(message='Required field protocol_version is unset!')
+        if self.compression is None:
+            raise TProtocolException(message='Required field compression is unset!')
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class vec3_double(object):
     """
     Attributes:
@@ -107,14 +341,16 @@ class contour_of_points_double(object):
      - points
      - closed
      - metadata
+     - points_blob
 
     """
 
 
-    def __init__(self, points=None, closed=None, metadata=None,):
+    def __init__(self, points=None, closed=None, metadata=None, points_blob=None,):
         self.points = points
         self.closed = closed
         self.metadata = metadata
+        self.points_blob = points_blob
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -152,6 +388,12 @@ class contour_of_points_double(object):
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.points_blob = bulk_array()
+                    self.points_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -181,6 +423,10 @@ class contour_of_points_double(object):
                 oprot.writeString(viter15.encode('utf-8') if sys.version_info[0] == 2 else viter15)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.points_blob is not None:
+            oprot.writeFieldBegin('points_blob', TType.STRUCT, 4)
+            self.points_blob.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -280,15 +526,21 @@ class point_set_double(object):
      - normals
      - colours
      - metadata
+     - points_blob
+     - normals_blob
+     - colours_blob
 
     """
 
 
-    def __init__(self, points=None, normals=None, colours=None, metadata=None,):
+    def __init__(self, points=None, normals=None, colours=None, metadata=None, points_blob=None, normals_blob=None, colours_blob=None,):
         self.points = points
         self.normals = normals
         self.colours = colours
         self.metadata = metadata
+        self.points_blob = points_blob
+        self.normals_blob = normals_blob
+        self.colours_blob = colours_blob
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -342,6 +594,24 @@ class point_set_double(object):
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRUCT:
+                    self.points_blob = bulk_array()
+                    self.points_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.STRUCT:
+                    self.normals_blob = bulk_array()
+                    self.normals_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.STRUCT:
+                    self.colours_blob = bulk_array()
+                    self.colours_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -381,6 +651,18 @@ class point_set_double(object):
                 oprot.writeString(viter52.encode('utf-8') if sys.version_info[0] == 2 else viter52)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.points_blob is not None:
+            oprot.writeFieldBegin('points_blob', TType.STRUCT, 5)
+            self.points_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.normals_blob is not None:
+            oprot.writeFieldBegin('normals_blob', TType.STRUCT, 6)
+            self.normals_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.colours_blob is not None:
+            oprot.writeFieldBegin('colours_blob', TType.STRUCT, 7)
+            self.colours_blob.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -618,17 +900,27 @@ class fv_surface_mesh_double_int64(object):
      - faces
      - involved_faces
      - metadata
+     - vertices_blob
+     - vertex_normals_blob
+     - vertex_colours_blob
+     - face_offsets_blob
+     - face_indices_blob
 
     """
 
 
-    def __init__(self, vertices=None, vertex_normals=None, vertex_colours=None, faces=None, involved_faces=None, metadata=None,):
+    def __init__(self, vertices=None, vertex_normals=None, vertex_colours=None, faces=None, involved_faces=None, metadata=None, vertices_blob=None, vertex_normals_blob=None, vertex_colours_blob=None, face_offsets_blob=None, face_indices_blob=None,):
         self.vertices = vertices
         self.vertex_normals = vertex_normals
         self.vertex_colours = vertex_colours
         self.faces = faces
         self.involved_faces = involved_faces
         self.metadata = metadata
+        self.vertices_blob = vertices_blob
+        self.vertex_normals_blob = vertex_normals_blob
+        self.vertex_colours_blob = vertex_colours_blob
+        self.face_offsets_blob = face_offsets_blob
+        self.face_indices_blob = face_indices_blob
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -712,6 +1004,36 @@ class fv_surface_mesh_double_int64(object):
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.STRUCT:
+                    self.vertices_blob = bulk_array()
+                    self.vertices_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 8:
+                if ftype == TType.STRUCT:
+                    self.vertex_normals_blob = bulk_array()
+                    self.vertex_normals_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 9:
+                if ftype == TType.STRUCT:
+                    self.vertex_colours_blob = bulk_array()
+                    self.vertex_colours_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 10:
+                if ftype == TType.STRUCT:
+                    self.face_offsets_blob = bulk_array()
+                    self.face_offsets_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 11:
+                if ftype == TType.STRUCT:
+                    self.face_indices_blob = bulk_array()
+                    self.face_indices_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -771,6 +1093,26 @@ class fv_surface_mesh_double_int64(object):
                 oprot.writeString(viter126.encode('utf-8') if sys.version_info[0] == 2 else viter126)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.vertices_blob is not None:
+            oprot.writeFieldBegin('vertices_blob', TType.STRUCT, 7)
+            self.vertices_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.vertex_normals_blob is not None:
+            oprot.writeFieldBegin('vertex_normals_blob', TType.STRUCT, 8)
+            self.vertex_normals_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.vertex_colours_blob is not None:
+            oprot.writeFieldBegin('vertex_colours_blob', TType.STRUCT, 9)
+            self.vertex_colours_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.face_offsets_blob is not None:
+            oprot.writeFieldBegin('face_offsets_blob', TType.STRUCT, 10)
+            self.face_offsets_blob.write(oprot)
+            oprot.writeFieldEnd()
+        if self.face_indices_blob is not None:
+            oprot.writeFieldBegin('face_indices_blob', TType.STRUCT, 11)
+            self.face_indices_blob.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -816,11 +1158,12 @@ class planar_image_double_double(object):
      - row_unit
      - col_unit
      - metadata
+     - data_blob
 
     """
 
 
-    def __init__(self, data=None, rows=None, columns=None, channels=None, pxl_dx=None, pxl_dy=None, pxl_dz=None, anchor=None, offset=None, row_unit=None, col_unit=None, metadata=None,):
+    def __init__(self, data=None, rows=None, columns=None, channels=None, pxl_dx=None, pxl_dy=None, pxl_dz=None, anchor=None, offset=None, row_unit=None, col_unit=None, metadata=None, data_blob=None,):
         self.data = data
         self.rows = rows
         self.columns = columns
@@ -833,6 +1176,7 @@ class planar_image_double_double(object):
         self.row_unit = row_unit
         self.col_unit = col_unit
         self.metadata = metadata
+        self.data_blob = data_blob
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -918,6 +1262,12 @@ class planar_image_double_double(object):
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 13:
+                if ftype == TType.STRUCT:
+                    self.data_blob = bulk_array()
+                    self.data_blob.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -983,6 +1333,10 @@ class planar_image_double_double(object):
                 oprot.writeString(viter142.encode('utf-8') if sys.version_info[0] == 2 else viter142)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.data_blob is not None:
+            oprot.writeFieldBegin('data_blob', TType.STRUCT, 13)
+            self.data_blob.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -2574,12 +2928,14 @@ class LoadFilesQuery(object):
     """
     Attributes:
      - server_filename
+     - response_encoding
 
     """
 
 
-    def __init__(self, server_filename=None,):
+    def __init__(self, server_filename=None, response_encoding=None,):
         self.server_filename = server_filename
+        self.response_encoding = response_encoding
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -2595,6 +2951,12 @@ class LoadFilesQuery(object):
                     self.server_filename = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.response_encoding = bulk_encoding()
+                    self.response_encoding.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -2609,6 +2971,10 @@ class LoadFilesQuery(object):
             oprot.writeFieldBegin('server_filename', TType.STRING, 1)
             oprot.writeString(self.server_filename.encode('utf-8') if sys.version_info[0] == 2 else self.server_filename)
             oprot.writeFieldEnd()
+        if self.response_encoding is not None:
+            oprot.writeFieldBegin('response_encoding', TType.STRUCT, 2)
+            self.response_encoding.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -2706,14 +3072,16 @@ class ExecuteScriptQuery(object):
      - drover
      - invocation_metadata
      - filename_lex
+     - response_encoding
 
     """
 
 
-    def __init__(self, drover=None, invocation_metadata=None, filename_lex=None,):
+    def __init__(self, drover=None, invocation_metadata=None, filename_lex=None, response_encoding=None,):
         self.drover = drover
         self.invocation_metadata = invocation_metadata
         self.filename_lex = filename_lex
+        self.response_encoding = response_encoding
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -2746,6 +3114,12 @@ class ExecuteScriptQuery(object):
                     self.filename_lex = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.response_encoding = bulk_encoding()
+                    self.response_encoding.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -2772,6 +3146,10 @@ class ExecuteScriptQuery(object):
             oprot.writeFieldBegin('filename_lex', TType.STRING, 3)
             oprot.writeString(self.filename_lex.encode('utf-8') if sys.version_info[0] == 2 else self.filename_lex)
             oprot.writeFieldEnd()
+        if self.response_encoding is not None:
+            oprot.writeFieldBegin('response_encoding', TType.STRUCT, 4)
+            self.response_encoding.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -2897,6 +3275,160 @@ class ExecuteScriptResponse(object):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class ProtocolQuery(object):
+    """
+    Attributes:
+     - client_version
+
+    """
+
+
+    def __init__(self, client_version=None,):
+        self.client_version = client_version
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.client_version = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ProtocolQuery')
+        if self.client_version is not None:
+            oprot.writeFieldBegin('client_version', TType.I64, 1)
+            oprot.writeI64(self.client_version)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        if self.client_version is None:
+            raise TProtocolException(message='Required field client_version is unset!')
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class ProtocolInfo(object):
+    """
+    Attributes:
+     - server_version
+     - compressions
+
+    """
+
+
+    def __init__(self, server_version=None, compressions=None,):
+        self.server_version = server_version
+        self.compressions = compressions
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.server_version = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.compressions = []
+                    (_etype312, _size309) = iprot.readListBegin()
+                    for _i313 in range(_size309):
+                        _elem314 = iprot.readI32()
+                        self.compressions.append(_elem314)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ProtocolInfo')
+        if self.server_version is not None:
+            oprot.writeFieldBegin('server_version', TType.I64, 1)
+            oprot.writeI64(self.server_version)
+            oprot.writeFieldEnd()
+        if self.compressions is not None:
+            oprot.writeFieldBegin('compressions', TType.LIST, 2)
+            oprot.writeListBegin(TType.I32, len(self.compressions))
+            for iter315 in self.compressions:
+                oprot.writeI32(iter315)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        if self.server_version is None:
+            raise TProtocolException(message='Required field server_version is unset!')
+        if self.compressions is None:
+            raise TProtocolException(message='Required field compressions is unset!')
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(bulk_array)
+bulk_array.thrift_spec = (
+    None,  # 0
+    (1, TType.I32, 'dtype', None, None, ),  # 1
+    (2, TType.I32, 'endianness', None, None, ),  # 2
+    (3, TType.I32, 'compression', None, None, ),  # 3
+    (4, TType.I64, 'count', None, None, ),  # 4
+    (5, TType.STRING, 'payload', 'BINARY', None, ),  # 5
+)
+all_structs.append(bulk_encoding)
+bulk_encoding.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'protocol_version', None, 1, ),  # 1
+    (2, TType.I32, 'compression', None, 0, ),  # 2
+)
 all_structs.append(vec3_double)
 vec3_double.thrift_spec = (
     None,  # 0
@@ -2910,6 +3442,7 @@ contour_of_points_double.thrift_spec = (
     (1, TType.LIST, 'points', (TType.STRUCT, [vec3_double, None], False), None, ),  # 1
     (2, TType.BOOL, 'closed', None, None, ),  # 2
     (3, TType.MAP, 'metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+    (4, TType.STRUCT, 'points_blob', [bulk_array, None], None, ),  # 4
 )
 all_structs.append(contour_collection_double)
 contour_collection_double.thrift_spec = (
@@ -2923,6 +3456,9 @@ point_set_double.thrift_spec = (
     (2, TType.LIST, 'normals', (TType.STRUCT, [vec3_double, None], False), None, ),  # 2
     (3, TType.LIST, 'colours', (TType.I64, None, False), None, ),  # 3
     (4, TType.MAP, 'metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+    (5, TType.STRUCT, 'points_blob', [bulk_array, None], None, ),  # 5
+    (6, TType.STRUCT, 'normals_blob', [bulk_array, None], None, ),  # 6
+    (7, TType.STRUCT, 'colours_blob', [bulk_array, None], None, ),  # 7
 )
 all_structs.append(sample4_double)
 sample4_double.thrift_spec = (
@@ -2948,6 +3484,11 @@ fv_surface_mesh_double_int64.thrift_spec = (
     (4, TType.LIST, 'faces', (TType.LIST, (TType.I64, None, False), False), None, ),  # 4
     (5, TType.LIST, 'involved_faces', (TType.LIST, (TType.I64, None, False), False), None, ),  # 5
     (6, TType.MAP, 'metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 6
+    (7, TType.STRUCT, 'vertices_blob', [bulk_array, None], None, ),  # 7
+    (8, TType.STRUCT, 'vertex_normals_blob', [bulk_array, None], None, ),  # 8
+    (9, TType.STRUCT, 'vertex_colours_blob', [bulk_array, None], None, ),  # 9
+    (10, TType.STRUCT, 'face_offsets_blob', [bulk_array, None], None, ),  # 10
+    (11, TType.STRUCT, 'face_indices_blob', [bulk_array, None], None, ),  # 11
 )
 all_structs.append(planar_image_double_double)
 planar_image_double_double.thrift_spec = (
@@ -2964,6 +3505,7 @@ planar_image_double_double.thrift_spec = (
     (10, TType.STRUCT, 'row_unit', [vec3_double, None], None, ),  # 10
     (11, TType.STRUCT, 'col_unit', [vec3_double, None], None, ),  # 11
     (12, TType.MAP, 'metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 12
+    (13, TType.STRUCT, 'data_blob', [bulk_array, None], None, ),  # 13
 )
 all_structs.append(planar_image_collection_double_double)
 planar_image_collection_double_double.thrift_spec = (
@@ -3081,6 +3623,7 @@ all_structs.append(LoadFilesQuery)
 LoadFilesQuery.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'server_filename', 'UTF8', None, ),  # 1
+    (2, TType.STRUCT, 'response_encoding', [bulk_encoding, None], None, ),  # 2
 )
 all_structs.append(LoadFilesResponse)
 LoadFilesResponse.thrift_spec = (
@@ -3094,6 +3637,7 @@ ExecuteScriptQuery.thrift_spec = (
     (1, TType.STRUCT, 'drover', [Drover, None], None, ),  # 1
     (2, TType.MAP, 'invocation_metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 2
     (3, TType.STRING, 'filename_lex', 'UTF8', None, ),  # 3
+    (4, TType.STRUCT, 'response_encoding', [bulk_encoding, None], None, ),  # 4
 )
 all_structs.append(ExecuteScriptResponse)
 ExecuteScriptResponse.thrift_spec = (
@@ -3103,5 +3647,16 @@ ExecuteScriptResponse.thrift_spec = (
     (3, TType.MAP, 'invocation_metadata', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
     (4, TType.STRING, 'filename_lex', 'UTF8', None, ),  # 4
 )
+all_structs.append(ProtocolQuery)
+ProtocolQuery.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'client_version', None, None, ),  # 1
+)
+all_structs.append(ProtocolInfo)
+ProtocolInfo.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'server_version', None, None, ),  # 1
+    (2, TType.LIST, 'compressions', (TType.I32, None, False), None, ),  # 2
+)
 fix_spec(all_structs)
 del all_structs